@@ -0,0 +1,310 @@
+/*
+ShaderGen: slangp shader converter for ShaderGlass
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "BlockCompress.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <immintrin.h>
+
+using namespace std;
+
+struct BlockError
+{
+    uint64_t squared {0};
+    char     padding[56]; // keep per-thread counters on separate cache lines
+};
+
+static inline uint16_t pack565(float r, float g, float b)
+{
+    const int ri = clamp(static_cast<int>(lroundf(r * 31.0f / 255.0f)), 0, 31);
+    const int gi = clamp(static_cast<int>(lroundf(g * 63.0f / 255.0f)), 0, 63);
+    const int bi = clamp(static_cast<int>(lroundf(b * 31.0f / 255.0f)), 0, 31);
+    return static_cast<uint16_t>((ri << 11) | (gi << 5) | bi);
+}
+
+static inline void unpack565(uint16_t c, float* rgb)
+{
+    const int r = (c >> 11) & 31;
+    const int g = (c >> 5) & 63;
+    const int b = c & 31;
+    rgb[0]      = static_cast<float>((r << 3) | (r >> 2));
+    rgb[1]      = static_cast<float>((g << 2) | (g >> 4));
+    rgb[2]      = static_cast<float>((b << 3) | (b >> 2));
+}
+
+// pick nearest of four palette entries for all 16 pixels, four pixels per iteration
+static uint32_t selectIndices(const float* r, const float* g, const float* b, const float palette[4][3], uint64_t& error)
+{
+    uint32_t indices = 0;
+    for(int p = 0; p < 16; p += 4)
+    {
+        const __m128 pr = _mm_loadu_ps(r + p);
+        const __m128 pg = _mm_loadu_ps(g + p);
+        const __m128 pb = _mm_loadu_ps(b + p);
+
+        __m128  best      = _mm_set1_ps(1e30f);
+        __m128i bestIndex = _mm_setzero_si128();
+        for(int i = 0; i < 4; i++)
+        {
+            const __m128 dr   = _mm_sub_ps(pr, _mm_set1_ps(palette[i][0]));
+            const __m128 dg   = _mm_sub_ps(pg, _mm_set1_ps(palette[i][1]));
+            const __m128 db   = _mm_sub_ps(pb, _mm_set1_ps(palette[i][2]));
+            const __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+            const __m128 less = _mm_cmplt_ps(dist, best);
+            best              = _mm_min_ps(dist, best);
+            bestIndex         = _mm_or_si128(_mm_andnot_si128(_mm_castps_si128(less), bestIndex), _mm_and_si128(_mm_castps_si128(less), _mm_set1_epi32(i)));
+        }
+
+        alignas(16) int32_t idx[4];
+        alignas(16) float   dist[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(idx), bestIndex);
+        _mm_store_ps(dist, best);
+        for(int k = 0; k < 4; k++)
+        {
+            indices |= static_cast<uint32_t>(idx[k]) << ((p + k) * 2);
+            error += static_cast<uint64_t>(dist[k] + 0.5f);
+        }
+    }
+    return indices;
+}
+
+static void buildPalette(uint16_t c0, uint16_t c1, float palette[4][3])
+{
+    unpack565(c0, palette[0]);
+    unpack565(c1, palette[1]);
+    for(int c = 0; c < 3; c++)
+    {
+        palette[2][c] = floorf((2.0f * palette[0][c] + palette[1][c]) / 3.0f);
+        palette[3][c] = floorf((palette[0][c] + 2.0f * palette[1][c]) / 3.0f);
+    }
+}
+
+// BC1 color block in four-color mode, endpoints along the principal axis refined by least squares
+static void encodeColor(const uint8_t* pixels, uint8_t* block, uint64_t& error)
+{
+    alignas(16) float r[16], g[16], b[16];
+    float             mean[3] = {0, 0, 0};
+    for(int p = 0; p < 16; p++)
+    {
+        r[p] = pixels[p * 4 + 0];
+        g[p] = pixels[p * 4 + 1];
+        b[p] = pixels[p * 4 + 2];
+        mean[0] += r[p];
+        mean[1] += g[p];
+        mean[2] += b[p];
+    }
+    for(int c = 0; c < 3; c++)
+        mean[c] /= 16.0f;
+
+    float cov[6] = {0, 0, 0, 0, 0, 0};
+    for(int p = 0; p < 16; p++)
+    {
+        const float dr = r[p] - mean[0], dg = g[p] - mean[1], db = b[p] - mean[2];
+        cov[0] += dr * dr;
+        cov[1] += dr * dg;
+        cov[2] += dr * db;
+        cov[3] += dg * dg;
+        cov[4] += dg * db;
+        cov[5] += db * db;
+    }
+
+    float axis[3] = {1, 1, 1};
+    for(int i = 0; i < 8; i++)
+    {
+        const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        const float m = max(max(fabsf(x), fabsf(y)), fabsf(z));
+        if(m < 1e-6f)
+            break;
+        axis[0] = x / m;
+        axis[1] = y / m;
+        axis[2] = z / m;
+    }
+
+    float minT = 1e30f, maxT = -1e30f;
+    for(int p = 0; p < 16; p++)
+    {
+        const float t = (r[p] - mean[0]) * axis[0] + (g[p] - mean[1]) * axis[1] + (b[p] - mean[2]) * axis[2];
+        minT          = min(minT, t);
+        maxT          = max(maxT, t);
+    }
+    const float norm = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    if(norm > 1e-6f)
+    {
+        minT /= norm;
+        maxT /= norm;
+    }
+    else
+    {
+        minT = maxT = 0;
+    }
+
+    uint16_t c0 = pack565(mean[0] + axis[0] * maxT, mean[1] + axis[1] * maxT, mean[2] + axis[2] * maxT);
+    uint16_t c1 = pack565(mean[0] + axis[0] * minT, mean[1] + axis[1] * minT, mean[2] + axis[2] * minT);
+
+    float    palette[4][3];
+    uint64_t bestError   = 0;
+    uint32_t bestIndices = 0;
+    uint16_t best0 = c0, best1 = c1;
+    for(int iteration = 0; iteration < 2; iteration++)
+    {
+        if(c0 < c1)
+            swap(c0, c1);
+
+        // equal endpoints give a uniform palette, every pixel then maps to the first entry
+        uint64_t candidateError = 0;
+        buildPalette(c0, c1, palette);
+        const uint32_t indices = selectIndices(r, g, b, palette, candidateError);
+
+        if(iteration == 0 || candidateError < bestError)
+        {
+            bestError   = candidateError;
+            bestIndices = indices;
+            best0       = c0;
+            best1       = c1;
+        }
+        if(c0 == c1 || candidateError == 0)
+            break;
+
+        // least squares fit of endpoints to the chosen indices
+        static const float weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+        float              aa = 0, bb = 0, ab = 0;
+        float              ax[3] = {0, 0, 0}, bx[3] = {0, 0, 0};
+        for(int p = 0; p < 16; p++)
+        {
+            const float a     = weights[(indices >> (p * 2)) & 3];
+            const float bw    = 1.0f - a;
+            const float px[3] = {r[p], g[p], b[p]};
+            aa += a * a;
+            bb += bw * bw;
+            ab += a * bw;
+            for(int c = 0; c < 3; c++)
+            {
+                ax[c] += a * px[c];
+                bx[c] += bw * px[c];
+            }
+        }
+        const float det = aa * bb - ab * ab;
+        if(fabsf(det) < 1e-6f)
+            break;
+        float e0[3], e1[3];
+        for(int c = 0; c < 3; c++)
+        {
+            e0[c] = (ax[c] * bb - bx[c] * ab) / det;
+            e1[c] = (bx[c] * aa - ax[c] * ab) / det;
+        }
+        c0 = pack565(e0[0], e0[1], e0[2]);
+        c1 = pack565(e1[0], e1[1], e1[2]);
+    }
+
+    block[0] = static_cast<uint8_t>(best0 & 0xff);
+    block[1] = static_cast<uint8_t>(best0 >> 8);
+    block[2] = static_cast<uint8_t>(best1 & 0xff);
+    block[3] = static_cast<uint8_t>(best1 >> 8);
+    memcpy(block + 4, &bestIndices, 4);
+    error += bestError;
+}
+
+// BC4-style alpha block using the eight-value interpolation mode
+static void encodeAlpha(const uint8_t* pixels, uint8_t* block, uint64_t& error)
+{
+    int a0 = 0, a1 = 255;
+    for(int p = 0; p < 16; p++)
+    {
+        a0 = max(a0, static_cast<int>(pixels[p * 4 + 3]));
+        a1 = min(a1, static_cast<int>(pixels[p * 4 + 3]));
+    }
+
+    int palette[8];
+    palette[0] = a0;
+    palette[1] = a1;
+    for(int i = 1; i < 7; i++)
+        palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+
+    uint64_t indices = 0;
+    for(int p = 0; p < 16; p++)
+    {
+        const int a         = pixels[p * 4 + 3];
+        int       bestIndex = 0;
+        int       bestDist  = 256;
+        for(int i = 0; i < 8; i++)
+        {
+            const int dist = abs(a - palette[i]);
+            if(dist < bestDist)
+            {
+                bestDist  = dist;
+                bestIndex = i;
+            }
+        }
+        indices |= static_cast<uint64_t>(bestIndex) << (p * 3);
+        error += static_cast<uint64_t>(bestDist * bestDist);
+    }
+
+    block[0] = static_cast<uint8_t>(a0);
+    block[1] = static_cast<uint8_t>(a1);
+    for(int i = 0; i < 6; i++)
+        block[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+}
+
+BlockCompressResult blockCompress(const uint8_t* rgba, uint32_t width, uint32_t height)
+{
+    BlockCompressResult result;
+
+    bool opaque = true;
+    for(size_t i = 3; i < static_cast<size_t>(width) * height * 4 && opaque; i += 4)
+        opaque = rgba[i] == 255;
+
+    result.format              = opaque ? BlockFormat::BC1 : BlockFormat::BC3;
+    const uint32_t blockSize   = opaque ? 8 : 16;
+    const uint32_t blocksWide  = width / 4;
+    const uint32_t blocksHigh  = height / 4;
+    result.blocks.resize(static_cast<size_t>(blocksWide) * blocksHigh * blockSize);
+
+    // rows of blocks are independent, spread them across cores
+    const uint32_t          numThreads = max(1U, min(thread::hardware_concurrency(), blocksHigh));
+    vector<BlockError>      errors(numThreads);
+    vector<thread>          threads;
+    for(uint32_t t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            uint8_t pixels[64];
+            for(uint32_t by = t; by < blocksHigh; by += numThreads)
+            {
+                for(uint32_t bx = 0; bx < blocksWide; bx++)
+                {
+                    for(int y = 0; y < 4; y++)
+                        memcpy(pixels + y * 16, rgba + ((static_cast<size_t>(by) * 4 + y) * width + bx * 4) * 4, 16);
+
+                    uint8_t* block = result.blocks.data() + (static_cast<size_t>(by) * blocksWide + bx) * blockSize;
+                    if(opaque)
+                    {
+                        encodeColor(pixels, block, errors[t].squared);
+                    }
+                    else
+                    {
+                        encodeAlpha(pixels, block, errors[t].squared);
+                        encodeColor(pixels, block + 8, errors[t].squared);
+                    }
+                }
+            }
+        });
+    }
+    for(auto& t : threads)
+        t.join();
+
+    uint64_t squared = 0;
+    for(const auto& e : errors)
+        squared += e.squared;
+
+    const int    channels = opaque ? 3 : 4;
+    const double mse      = static_cast<double>(squared) / (static_cast<double>(width) * height * channels);
+    result.psnr           = mse > 0 ? 10.0 * log10(255.0 * 255.0 / mse) : 99.0;
+    return result;
+}
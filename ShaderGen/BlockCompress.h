@@ -0,0 +1,26 @@
+/*
+ShaderGen: slangp shader converter for ShaderGlass
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+enum class BlockFormat
+{
+    BC1, // opaque color
+    BC3 // color + BC4-style alpha
+};
+
+struct BlockCompressResult
+{
+    BlockFormat          format;
+    std::vector<uint8_t> blocks;
+    double               psnr; // over channels stored, against the source image
+};
+
+// compress tightly packed RGBA8 image, width and height must be multiples of 4
+BlockCompressResult blockCompress(const uint8_t* rgba, uint32_t width, uint32_t height);
@@ -5,12 +5,30 @@ GNU General Public License v3.0
 */
 
 #include "ShaderGen.h"
+#include "BlockCompress.h"
+#include "SlangPreprocessor.h"
+#include "TemplateEmitter.h"
+
+#pragma comment(lib, "windowscodecs.lib")
 
 filesystem::path startupPath;
 filesystem::path tempPath;
 filesystem::path reportPath;
+atomic<uint64_t> textureBytesDecoded    = 0;
+atomic<uint64_t> textureBytesCompressed = 0;
+atomic<uint64_t> spirvInstructions      = 0;
+atomic<uint64_t> spirvOptimized         = 0;
+thread_local vector<string> spirvReport; // per-stage counts for the file being processed
+filesystem::path            journalPath;
+ofstream                    journal;
+map<string, vector<pair<string, uint64_t>>> journaled;   // outputs of files completed by an interrupted run, by input
+thread_local vector<pair<string, uint64_t>> itemOutputs; // generated for the file being processed
+mutex                                       outputMutex; // console, report and journal, shared by workers
+unordered_set<string>                       converted;   // shaders and textures converted by workers this run
 filesystem::path listPath(_outputPath);
 vector<string>   shaderList;
+map<string, pair<filesystem::path, vector<string>>> shardLists;
+int                                                 nextPreset = 0; // number of the next preset added, after those of every shard
 
 std::string exec(const char* cmd, ofstream& log)
 {
@@ -29,21 +47,96 @@ std::string exec(const char* cmd, ofstream& log)
     return result;
 }
 
+// files are written next to their target and renamed over it once complete,
+// so an interrupted run never leaves one half-written
+filesystem::path pendingPath(const filesystem::path& target)
+{
+    auto pending(target);
+    pending += ".tmp";
+    return pending;
+}
+
+void commitFile(const filesystem::path& target)
+{
+    filesystem::rename(pendingPath(target), target);
+}
+
 void saveSource(const filesystem::path& fileName, const vector<string>& source)
 {
-    ofstream outfile(fileName);
+    ofstream outfile(pendingPath(fileName));
     for(const auto& s : source)
     {
         outfile << s << endl;
     }
     outfile.close();
+    commitFile(fileName);
 }
 
 void saveSource(const filesystem::path& fileName, const string& source)
 {
-    ofstream outfile(fileName);
+    ofstream outfile(pendingPath(fileName));
     outfile << source << endl;
     outfile.close();
+    commitFile(fileName);
+}
+
+string bin2string(const vector<uint8_t>& data)
+{
+    // up to 3 digits and a comma per byte, line break every 40
+    string output;
+    output.reserve(data.size() * 4 + data.size() / 40 + 3);
+    output += '{';
+    for(size_t i = 0; i < data.size(); i++)
+    {
+        if(i)
+        {
+            output += ',';
+        }
+        char digits[3];
+        output.append(digits, to_chars(digits, digits + sizeof(digits), static_cast<unsigned>(data[i])).ptr);
+        if((i + 1) % 40 == 0)
+        {
+            output += '\n';
+        }
+    }
+    output += "};";
+    return output;
+}
+
+vector<uint8_t> loadBinary(const filesystem::path& input)
+{
+    ifstream infile(input, fstream::binary);
+    return vector<uint8_t>(istreambuf_iterator<char>(infile), istreambuf_iterator<char>());
+}
+
+// FNV-1a
+uint64_t hashFile(const filesystem::path& input)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for(auto b : loadBinary(input))
+    {
+        hash ^= b;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// generated headers are journaled with their hash, shard and list files are shared between inputs and are not
+void commitOutput(const filesystem::path& target)
+{
+    commitFile(target);
+    itemOutputs.emplace_back(target.string(), hashFile(target));
+}
+
+// outputs of a journaled file are still as it left them
+bool isIntact(const vector<pair<string, uint64_t>>& outputs)
+{
+    for(const auto& output : outputs)
+    {
+        if(!filesystem::exists(output.first) || hashFile(output.first) != output.second)
+            return false;
+    }
+    return true;
 }
 
 filesystem::path glsl(const filesystem::path& shaderPath, const string& stage, const vector<string> source, ofstream& log)
@@ -69,18 +162,105 @@ filesystem::path glsl(const filesystem::path& shaderPath, const string& stage, c
     return output;
 }
 
-pair<string, string> spirv(const filesystem::path& input, ofstream& log)
+SpirvStats spirvStats(const filesystem::path& input)
+{
+    const auto data = loadBinary(input);
+
+    // 5 word header, then each instruction starts with its word count in the high half
+    SpirvStats stats;
+    stats.bytes = data.size();
+    for(size_t w = 5; w < data.size() / 4;)
+    {
+        uint32_t word;
+        memcpy(&word, &data[w * 4], 4);
+        const auto count = word >> 16;
+        if(count == 0)
+            throw std::runtime_error("Invalid SPIR-V");
+        w += count;
+        stats.instructions++;
+    }
+    return stats;
+}
+
+// falls back to the unoptimized module with a warning, the pass still converts as it did without spirv-opt
+filesystem::path optimize(const filesystem::path& shaderPath, const string& stage, const filesystem::path& input, ofstream& log, bool& warn)
+{
+    filesystem::path output = tempPath / shaderPath;
+    output.replace_extension("." + stage + ".opt.spv");
+    filesystem::remove(output);
+
+    // -O is dead code elimination, inlining and constant folding; bindings stay put for ShaderGlass
+    stringstream cmd;
+    cmd << "\"" << _spirvOptPath << "\" "
+        << "-O --preserve-bindings --preserve-spec-constants " << input.string() << " -o " << output.string() << " 2>&1";
+    const auto& result = exec(cmd.str().c_str(), log);
+    if(result.length() > 0)
+        log << result << endl;
+    if(result.contains("error") || !filesystem::exists(output))
+    {
+        log << "WARNING: SPIR-V optimization error, " << shaderPath << " " << stage << " left unoptimized" << endl;
+        warn = true;
+        return input;
+    }
+
+    const auto before = spirvStats(input);
+    const auto after  = spirvStats(output);
+    spirvInstructions += before.instructions;
+    spirvOptimized += after.instructions;
+
+    const auto& counts = std::format("{} {}: {} -> {} instructions, {} -> {} bytes", shaderPath.string(), stage, before.instructions, after.instructions, before.bytes, after.bytes);
+    log << "Optimized " << counts << endl;
+    spirvReport.push_back(counts);
+    return output;
+}
+
+// code from the optimized module, reflection always from glslang's so parameters dropped by spirv-opt keep their layout
+pair<string, string> spirv(const filesystem::path& input, const filesystem::path& reflectInput, ofstream& log)
 {
     stringstream cmd1, cmd2;
     cmd1 << "\"" << _spirvPath << "\" "
          << " --hlsl --shader-model 50 " << input.string() << "";
     const auto& code = exec(cmd1.str().c_str(), log);
-    cmd2 << "\"" << _spirvPath << "\" " << input.string() << " --reflect";
+    cmd2 << "\"" << _spirvPath << "\" " << reflectInput.string() << " --reflect";
     const auto& metadata = exec(cmd2.str().c_str(), log);
     return make_pair(code, metadata);
 }
 
-string fxc(const filesystem::path& shaderPath, const string& profile, const string& source, ofstream& log, bool& warn)
+void validate(const filesystem::path& input, ofstream& log)
+{
+    stringstream cmd;
+    cmd << "\"" << _spirvValPath << "\" " << input.string() << " 2>&1";
+    const auto& result = exec(cmd.str().c_str(), log);
+    if(result.length() > 0)
+    {
+        log << result << endl;
+        throw std::runtime_error("SPIR-V validation error");
+    }
+}
+
+// desktop GLSL 3.30 from the same module as HLSL, checked by glslang as a driver would
+string glslTarget(const filesystem::path& shaderPath, const string& stage, const filesystem::path& input, ofstream& log)
+{
+    stringstream cmd1, cmd2;
+    cmd1 << "\"" << _spirvPath << "\" "
+         << " --version 330 --no-es --no-420pack-extension " << input.string() << "";
+    const auto& code = exec(cmd1.str().c_str(), log);
+
+    filesystem::path output = tempPath / shaderPath;
+    output.replace_extension("." + stage + ".330.glsl");
+    saveSource(output, code);
+
+    cmd2 << "\"" << _glslPath << "\" "
+         << "--quiet -S " << stage << " " << output.string() << "";
+    const auto& result = exec(cmd2.str().c_str(), log);
+    if(result.length() > 0)
+        log << result << endl;
+    if(result.contains("error") || result.contains("ERROR"))
+        throw std::runtime_error("GLSL validation error");
+    return code;
+}
+
+string fxc(const filesystem::path& shaderPath, const string& profile, const string& source, ofstream& log, bool& warn, ShaderStats& stats)
 {
     filesystem::path input = tempPath / shaderPath;
     input.replace_extension("." + profile + ".hlsl");
@@ -114,6 +294,17 @@ string fxc(const filesystem::path& shaderPath, const string& profile, const stri
     bool         active = false;
     while(getline(infile, line))
     {
+        if(!active)
+        {
+            // disassembly listing precedes the bytecode
+            const auto& op = trim(line);
+            if(op.starts_with("sample") || op.starts_with("ld") || op.starts_with("gather4"))
+                stats.textureFetches++;
+            else if(op.starts_with("loop"))
+                stats.loops = true;
+            else if(op.starts_with("// Approximately "))
+                stats.instructions = atoi(op.c_str() + 17);
+        }
         if(line.starts_with("const BYTE g_main[] ="))
         {
             active = true;
@@ -133,21 +324,16 @@ string fxc(const filesystem::path& shaderPath, const string& profile, const stri
 
 string splitCode(const string& input)
 {
-    stringstream split;
-    split << "R\"(\n";
+    string split;
+    split.reserve(input.size() + 8);
+    split += "R\"(\n";
     for(const auto& c : input)
     {
-        if(c == '\r')
-            continue;
-        if(c == '\n')
-            split << "\n";
-        else if(c == '\"')
-            split << "\"";
-        else
-            split << c;
+        if(c != '\r')
+            split += c;
     }
-    split << ")\"";
-    return split.str();
+    split += ")\"";
+    return split;
 }
 
 int getSize(const std::string& mtype)
@@ -251,79 +437,146 @@ vector<ShaderParam> lookupParams(const vector<ShaderParam>& declaredParams, vect
     return actualParams;
 }
 
-void updateShaderList(const ShaderInfo& shaderInfo)
+// top-level category of a generated file, in class name form
+string getShardName(const ShaderInfo& info)
 {
-    ostringstream oss;
-    oss << "#include \"" << shaderInfo.relativePath.string() << "\"";
-    const auto& shaderInclude = oss.str();
-    if(find(shaderList.begin(), shaderList.end(), shaderInclude) == shaderList.end())
+    auto         category = next(info.relativePath.begin())->string();
+    stringstream shardName;
+    bool         upper = true;
+    for(const auto& c : category)
     {
-        auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %SHADER_INCLUDE%");
-        shaderList.insert(insertSpot, shaderInclude);
-        saveSource(listPath, shaderList);
+        if(c == '-' || c == '.' || c == '+' || c == ' ' || c == '(' || c == ')')
+        {
+            upper = true;
+            continue;
+        }
+        shardName << (upper ? (char)toupper(c) : c);
+        upper = false;
     }
+    return shardName.str();
 }
 
-void updateTextureList(const ShaderInfo& textureInfo)
+bool insertLine(vector<string>& list, const string& line, const string& marker)
 {
-    ostringstream oss;
-    oss << "#include \"" << textureInfo.relativePath.string() << "\"";
-    const auto& textureInclude = oss.str();
-    if(find(shaderList.begin(), shaderList.end(), textureInclude) == shaderList.end())
+    if(find(list.begin(), list.end(), line) != list.end())
+        return false;
+
+    auto insertSpot = find(list.begin(), list.end(), marker);
+    list.insert(insertSpot, line);
+    return true;
+}
+
+pair<filesystem::path, vector<string>>& getShard(const string& shardName)
+{
+    auto it = shardLists.find(shardName);
+    if(it != shardLists.end())
+        return it->second;
+
+    filesystem::path shardPath(string(_outputPath) + _libName + shardName + ".cpp");
+    if(!filesystem::exists(shardPath))
     {
-        auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %TEXTURE_INCLUDE%");
-        shaderList.insert(insertSpot, textureInclude);
+        fstream           infile(startupPath / filesystem::path("Shard.template"));
+        std::stringstream buffer;
+        buffer << infile.rdbuf();
+        auto bufferString = buffer.str();
+        replace(bufferString, "%LIB_NAME%", _libName);
+        replace(bufferString, "%SHARD_NAME%", shardName);
+
+        ofstream outfile(pendingPath(shardPath));
+        outfile << bufferString;
+        outfile.close();
+        commitFile(shardPath);
+        std::cout << "Generated shard " << shardPath.string() << ", add it to ShaderGlass.vcxproj" << endl;
+    }
+
+    // register with the library header
+    bool updated = insertLine(shaderList, "void Add" + shardName + "Presets(std::vector<std::pair<int, PresetDef*>>& list);", "// %SHARD_DECLARATION%");
+    updated |= insertLine(shaderList, "    Add" + shardName + "Presets(presets);", "// %SHARD_CALL%");
+    if(updated)
         saveSource(listPath, shaderList);
+
+    return shardLists.emplace(shardName, make_pair(shardPath, loadSource(shardPath, false))).first->second;
+}
+
+// shards of earlier runs, for numbering presets added by this one
+void loadShards()
+{
+    const string prefix(_libName);
+    const string number("list.emplace_back(");
+    for(const auto& entry : filesystem::directory_iterator(listPath.parent_path()))
+    {
+        const auto& fileName = entry.path().filename().string();
+        if(entry.path().extension() != ".cpp" || !fileName.starts_with(prefix))
+            continue;
+
+        for(const auto& line : getShard(fileName.substr(prefix.size(), fileName.size() - prefix.size() - 4)).second)
+        {
+            const auto numberStart = line.find(number);
+            if(numberStart != string::npos)
+                nextPreset = max(nextPreset, atoi(line.c_str() + numberStart + number.size()) + 1);
+        }
     }
 }
 
-void updatePresetList(const ShaderInfo& shaderInfo)
+// a shader or texture is defined in the shard of its own category, other shards only declare it
+void updateDefinitionList(const ShaderInfo& info, const string& shardName, const string& definitionMarker, const string& includeMarker)
 {
     ostringstream oss;
-    oss << "#include \"" << shaderInfo.relativePath.string() << "\"";
-    const auto& presetInclude = oss.str();
+    oss << "#include \"" << info.relativePath.string() << "\"";
+    const auto& ownerName = getShardName(info);
+    auto&       owner     = getShard(ownerName);
+    if(insertLine(owner.second, oss.str(), definitionMarker))
+        saveSource(owner.first, owner.second);
+    if(shardName == ownerName)
+        return;
 
-    ostringstream oss2;
-    oss2 << "new " << shaderInfo.className << "PresetDef(),";
-    const auto& presetClass = oss2.str();
+    auto& shard = getShard(shardName);
+    if(insertLine(shard.second, oss.str(), includeMarker))
+        saveSource(shard.first, shard.second);
+}
 
-    bool updated = false;
+void updateShaderList(const ShaderInfo& shaderInfo, const string& shardName)
+{
+    updateDefinitionList(shaderInfo, shardName, "// %SHADER_DEFINITION%", "// %SHADER_INCLUDE%");
+}
 
-    if(find(shaderList.begin(), shaderList.end(), presetInclude) == shaderList.end())
-    {
-        auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %PRESET_INCLUDE%");
-        shaderList.insert(insertSpot, presetInclude);
-        updated = true;
-    }
+void updateTextureList(const ShaderInfo& textureInfo, const string& shardName)
+{
+    updateDefinitionList(textureInfo, shardName, "// %TEXTURE_DEFINITION%", "// %TEXTURE_INCLUDE%");
+}
 
-    if(find(shaderList.begin(), shaderList.end(), presetClass) == shaderList.end())
-    {
-        auto insertSpot = find(shaderList.begin(), shaderList.end(), "// %PRESET_CLASS%");
-        shaderList.insert(insertSpot, presetClass);
-        updated = true;
-    }
+void updatePresetList(const ShaderInfo& shaderInfo)
+{
+    ostringstream oss;
+    oss << "#include \"" << shaderInfo.relativePath.string() << "\"";
+    const auto& presetInclude = oss.str();
+
+    // numbered once, the library list keeps the order presets were added in across shards
+    const auto& presetClass = "new " + shaderInfo.className + "PresetDef()";
 
+    auto& shard   = getShard(getShardName(shaderInfo));
+    bool  updated = insertLine(shard.second, presetInclude, "// %PRESET_INCLUDE%");
+    if(find_if(shard.second.begin(), shard.second.end(), [&](const string& line) { return line.find(presetClass) != string::npos; }) == shard.second.end())
+        updated |= insertLine(shard.second, std::format("    list.emplace_back({}, {});", nextPreset++, presetClass), "// %PRESET_CLASS%");
     if(updated)
-        saveSource(listPath, shaderList);
+        saveSource(shard.first, shard.second);
+}
+
+// one write per generated file
+void saveOutput(const filesystem::path& target, const string& content)
+{
+    ofstream outfile(pendingPath(target));
+    outfile.write(content.data(), content.size());
+    outfile.close();
+    commitOutput(target);
 }
 
 void populateShaderTemplate(ShaderDef def, ofstream& log)
 {
-    const auto& info = def.info;
+    // parsed on first use, workers share it
+    static const Template shaderTemplate(startupPath / filesystem::path("Shader.template"));
 
-    fstream           infile(startupPath / filesystem::path("Shader.template"));
-    std::stringstream buffer;
-    buffer << infile.rdbuf();
-    auto bufferString = buffer.str();
-    replace(bufferString, "%LIB_NAME%", _libName);
-    replace(bufferString, "%CLASS_NAME%", info.className);
-    replace(bufferString, "%SHADER_NAME%", info.shaderName);
-    replace(bufferString, "%SHADER_FORMAT%", def.format);
-    replace(bufferString, "%SHADER_CATEGORY%", info.category);
-    replace(bufferString, "%VERTEX_SOURCE%", splitCode(def.vertexSource));
-    replace(bufferString, "%FRAGMENT_SOURCE%", splitCode(def.fragmentSource));
-    replace(bufferString, "%VERTEX_BYTECODE%", def.vertexByteCode);
-    replace(bufferString, "%FRAGMENT_BYTECODE%", def.fragmentByteCode);
+    const auto& info = def.info;
 
     if(def.fragmentByteCode.empty() || def.vertexByteCode.empty())
     {
@@ -340,191 +593,180 @@ void populateShaderTemplate(ShaderDef def, ofstream& log)
     std::vector<ShaderSampler> textures;
     def.params = lookupParams(def.params, textures, def.fragmentMetadata);
 
-    ofstream          outfile(info.outputPath);
-    std::stringstream iss(bufferString);
-    while(iss.good())
+    // sources only when the template has them
+    const auto& vertexSource         = shaderTemplate.Uses("VERTEX_SOURCE") ? splitCode(def.vertexSource) : string();
+    const auto& fragmentSource       = shaderTemplate.Uses("FRAGMENT_SOURCE") ? splitCode(def.fragmentSource) : string();
+    const auto& vertexInstructions   = to_string(def.vertexStats.instructions);
+    const auto& fragmentInstructions = to_string(def.fragmentStats.instructions);
+    const auto& fragmentFetches      = to_string(def.fragmentStats.textureFetches);
+    const auto& noTarget             = string("{0};"); // arrays can't be empty, lengths are zero and pointers null instead
+
+    const TemplateValues values {{"LIB_NAME", _libName},
+                                 {"CLASS_NAME", info.className},
+                                 {"SHADER_NAME", info.shaderName},
+                                 {"SHADER_FORMAT", def.format},
+                                 {"SHADER_CATEGORY", info.category},
+                                 {"VERTEX_SOURCE", vertexSource},
+                                 {"FRAGMENT_SOURCE", fragmentSource},
+                                 {"VERTEX_BYTECODE", def.vertexByteCode},
+                                 {"FRAGMENT_BYTECODE", def.fragmentByteCode},
+                                 {"VERTEX_SPIRV", def.crossTargets ? def.vertexSpirv : noTarget},
+                                 {"FRAGMENT_SPIRV", def.crossTargets ? def.fragmentSpirv : noTarget},
+                                 {"VERTEX_GLSL", def.crossTargets ? def.vertexGlsl : noTarget},
+                                 {"FRAGMENT_GLSL", def.crossTargets ? def.fragmentGlsl : noTarget},
+                                 {"CROSS_TARGETS", def.crossTargets ? "true" : "false"},
+                                 {"VERTEX_INSTRUCTIONS", vertexInstructions},
+                                 {"FRAGMENT_INSTRUCTIONS", fragmentInstructions},
+                                 {"FRAGMENT_FETCHES", fragmentFetches},
+                                 {"FRAGMENT_LOOPS", def.fragmentStats.loops ? "true" : "false"}};
+
+    string output;
+    output.reserve(shaderTemplate.Size(values) + (def.params.size() + textures.size()) * 256 + 4096);
+    for(const auto& line : shaderTemplate.Lines())
     {
-        std::string line;
-        getline(iss, line, '\n');
-        if(line == "\"\"")
-            continue;
-        if(line.starts_with("%PARAM"))
+        const auto marker = line.Marker();
+        if(marker == "PARAM")
         {
-            replace(line, "%PARAM%", "");
             for(const auto& p : def.params)
             {
                 if(p.i != -1)
                 {
-                    string paramLine(line);
-                    replace(paramLine, "%PARAM_NAME%", p.name);
-                    replace(paramLine, "%PARAM_BUFFER%", to_string(p.buffer));
-                    replace(paramLine, "%PARAM_SIZE%", to_string(p.size));
-                    replace(paramLine, "%PARAM_OFFSET%", to_string(p.offset));
-                    replace(paramLine, "%PARAM_MIN%", to_string(p.min));
-                    replace(paramLine, "%PARAM_MAX%", to_string(p.max));
-                    replace(paramLine, "%PARAM_DEF%", to_string(p.def));
-                    replace(paramLine, "%PARAM_STEP%", to_string(p.step));
-                    replace(paramLine, "%PARAM_DESC%", p.desc);
-                    outfile << paramLine << endl;
+                    const auto& paramBuffer = to_string(p.buffer);
+                    const auto& paramSize   = to_string(p.size);
+                    const auto& paramOffset = to_string(p.offset);
+                    const auto& paramMin    = to_string(p.min);
+                    const auto& paramMax    = to_string(p.max);
+                    const auto& paramDef    = to_string(p.def);
+                    const auto& paramStep   = to_string(p.step);
+                    Template::Render(line,
+                                     output,
+                                     {{"PARAM", ""},
+                                      {"PARAM_NAME", p.name},
+                                      {"PARAM_BUFFER", paramBuffer},
+                                      {"PARAM_SIZE", paramSize},
+                                      {"PARAM_OFFSET", paramOffset},
+                                      {"PARAM_MIN", paramMin},
+                                      {"PARAM_MAX", paramMax},
+                                      {"PARAM_DEF", paramDef},
+                                      {"PARAM_STEP", paramStep},
+                                      {"PARAM_DESC", p.desc}},
+                                     &values);
                 }
             }
         }
-        else if(line.starts_with("%TEXTURE"))
+        else if(marker == "TEXTURE")
         {
-            replace(line, "%TEXTURE%", "");
             for(const auto& t : textures)
             {
-                string textureLine(line);
-                replace(textureLine, "%TEXTURE_NAME%", t.name);
-                replace(textureLine, "%TEXTURE_BINDING%", to_string(t.binding));
-                outfile << textureLine << endl;
+                const auto& binding = to_string(t.binding);
+                Template::Render(line, output, {{"TEXTURE", ""}, {"TEXTURE_NAME", t.name}, {"TEXTURE_BINDING", binding}}, &values);
             }
         }
-        else if(line.starts_with("%HEADER"))
+        else if(marker == "HEADER")
         {
-            outfile << "ShaderGlass shader " << info.category << "\\" << info.shaderName << " imported from " << _libName << ":" << endl;
-            outfile << _raUrl << def.input.generic_string() << endl;
-            outfile << "See original file for full credits and usage license with excerpts below. " << endl;
-            outfile << "This file is auto-generated, do not modify directly." << endl;
+            output += std::format("ShaderGlass shader {}\\{} imported from {}:\n", info.category, info.shaderName, _libName);
+            output += _raUrl + def.input.generic_string() + "\n";
+            output += "See original file for full credits and usage license with excerpts below. \n";
+            output += "This file is auto-generated, do not modify directly.\n";
             if(def.comments.size())
             {
-                outfile << endl;
+                output += '\n';
                 for(const auto& c : def.comments)
-                    outfile << c << endl;
+                    output += c + '\n';
             }
-            outfile << endl;
+            output += '\n';
         }
         else
-            outfile << line << endl;
+            Template::Render(line, output, values);
     }
-    outfile.close();
+    saveOutput(info.outputPath, output);
     log << "Generated ShaderDef " << info.outputPath << endl;
 }
 
-void populateTextureTemplate(TextureDef def, ofstream& log)
+void populateTextureTemplate(const TextureDef& def, ofstream& log)
 {
-    const auto& info = def.info;
+    static const Template textureTemplate(startupPath / filesystem::path("Texture.template"));
 
-    fstream           infile(startupPath / filesystem::path("Texture.template"));
-    std::stringstream buffer;
-    buffer << infile.rdbuf();
-    auto bufferString = buffer.str();
-    replace(bufferString, "%LIB_NAME%", _libName);
-    replace(bufferString, "%TEXTURE_NAME%", def.input.filename().string());
-    replace(bufferString, "%CLASS_NAME%", info.className);
-    replace(bufferString, "%TEXTURE_DATA%", def.data);
-
-    ofstream          outfile(info.outputPath);
-    std::stringstream iss(bufferString);
-    while(iss.good())
-    {
-        std::string line;
-        getline(iss, line, '\n');
-        if(line == "\"\"")
-            continue;
-        if(line.starts_with("%HEADER"))
+    const auto&          info = def.info;
+    const auto&          name = def.input.filename().string();
+    const TemplateValues values {{"LIB_NAME", _libName}, {"TEXTURE_NAME", name}, {"CLASS_NAME", info.className}, {"TEXTURE_DATA", def.data}};
+
+    string output;
+    output.reserve(textureTemplate.Size(values) + 4096);
+    for(const auto& line : textureTemplate.Lines())
+    {
+        if(line.Marker() == "HEADER")
         {
-            outfile << "ShaderGlass texture " << info.category << " / " << info.shaderName << " imported from " << _libName << ":" << endl;
-            outfile << _raUrl << def.input.generic_string() << endl;
-            outfile << "See original file for credits and usage license. " << endl;
-            outfile << "This file is auto-generated, do not modify directly." << endl;
+            output += std::format("ShaderGlass texture {} / {} imported from {}:\n", info.category, info.shaderName, _libName);
+            output += _raUrl + def.input.generic_string() + "\n";
+            output += "See original file for credits and usage license. \n";
+            output += "This file is auto-generated, do not modify directly.\n";
         }
         else
-            outfile << line << endl;
+            Template::Render(line, output, values);
     }
-    outfile.close();
+    saveOutput(info.outputPath, output);
     log << "Generated TextureDef " << info.outputPath << endl;
 }
 
+// preset parameters follow the definition they apply to, one per line
+string presetParams(const map<string, string>& params)
+{
+    string lines;
+    for(const auto& pp : params)
+        lines += "\n.Param(\"" + pp.first + "\", \"" + pp.second + "\")";
+    return lines;
+}
+
 void populatePresetTemplate(
     const filesystem::path& input, const vector<ShaderDef>& shaders, const vector<TextureDef>& textures, const vector<ShaderParam>& overrides, ofstream& log)
 {
-    const auto& info = getShaderInfo(input, "PresetDef");
-
-    fstream           infile(startupPath / filesystem::path("Preset.template"));
-    std::stringstream buffer;
-    buffer << infile.rdbuf();
-    auto bufferString = buffer.str();
-    replace(bufferString, "%LIB_NAME%", _libName);
-    replace(bufferString, "%CLASS_NAME%", info.className);
-    replace(bufferString, "%PRESET_NAME%", info.shaderName);
-    replace(bufferString, "%PRESET_CATEGORY%", info.category);
-
-    ofstream          outfile(info.outputPath);
-    std::stringstream iss(bufferString);
-    while(iss.good())
-    {
-        std::string line;
-        getline(iss, line, '\n');
-        if(line == "\"\"")
-            continue;
-        if(line.starts_with("%SHADERS%"))
-        {
-            replace(line, "%SHADERS%", "         ");
+    static const Template presetTemplate(startupPath / filesystem::path("Preset.template"));
+
+    const auto&          info = getShaderInfo(input, "PresetDef");
+    const TemplateValues values {{"LIB_NAME", _libName}, {"CLASS_NAME", info.className}, {"PRESET_NAME", info.shaderName}, {"PRESET_CATEGORY", info.category}};
 
+    string output;
+    output.reserve(presetTemplate.Size(values) + (shaders.size() + textures.size() + overrides.size()) * 256);
+    for(const auto& line : presetTemplate.Lines())
+    {
+        // section markers are blanked, keeping the indentation after them
+        const auto marker = line.Marker();
+        if(marker == "SHADERS")
+        {
             for(const auto& s : shaders)
             {
-                string shaderLine(line);
-                replace(shaderLine, "%SHADER_NAME%", s.info.className);
-
-                // append preset params
-                stringstream paramsLines;
-                for(const auto& pp : s.presetParams)
-                {
-                    string paramLine(".Param(\"%PRESET_KEY%\", \"%PRESET_VALUE%\")");
-                    replace(paramLine, "%PRESET_KEY%", pp.first);
-                    replace(paramLine, "%PRESET_VALUE%", pp.second);
-                    paramsLines << endl << paramLine;
-                }
-                replace(shaderLine, "%PRESET_PARAMS%", paramsLines.str());
-                outfile << shaderLine << endl;
+                const auto& params = presetParams(s.presetParams);
+                Template::Render(line, output, {{"SHADERS", "         "}, {"SHADER_NAME", s.info.className}, {"PRESET_PARAMS", params}}, &values);
             }
         }
-        else if(line.starts_with("%TEXTURES%"))
+        else if(marker == "TEXTURES")
         {
-            replace(line, "%TEXTURES%", "          ");
-
             for(const auto& t : textures)
             {
-                string textureLine(line);
-                replace(textureLine, "%TEXTURE_NAME%", t.info.className);
-
-                // append preset params
-                stringstream paramsLines;
-                for(const auto& pp : t.presetParams)
-                {
-                    string paramLine(".Param(\"%PRESET_KEY%\", \"%PRESET_VALUE%\")");
-                    replace(paramLine, "%PRESET_KEY%", pp.first);
-                    replace(paramLine, "%PRESET_VALUE%", pp.second);
-                    paramsLines << endl << paramLine;
-                }
-                replace(textureLine, "%TEXTURE_PARAMS%", paramsLines.str());
-                outfile << textureLine << endl;
+                const auto& params = presetParams(t.presetParams);
+                Template::Render(line, output, {{"TEXTURES", "          "}, {"TEXTURE_NAME", t.info.className}, {"TEXTURE_PARAMS", params}}, &values);
             }
         }
-        else if(line.starts_with("%OVERRIDES%"))
+        else if(marker == "OVERRIDES")
         {
-            replace(line, "%OVERRIDES%", "           ");
-
             for(const auto& o : overrides)
             {
-                string overrideLine(line);
-                replace(overrideLine, "%OVERRIDE_NAME%", o.name);
-                replace(overrideLine, "%OVERRIDE_VALUE%", to_string(o.def));
-                outfile << overrideLine << endl;
+                const auto& value = to_string(o.def);
+                Template::Render(line, output, {{"OVERRIDES", "           "}, {"OVERRIDE_NAME", o.name}, {"OVERRIDE_VALUE", value}}, &values);
             }
         }
-        else if(line.starts_with("%HEADER"))
+        else if(marker == "HEADER")
         {
-            outfile << "ShaderGlass preset " << info.category << " / " << info.shaderName << " imported from " << _libName << ":" << endl;
-            outfile << _raUrl << input.generic_string() << endl;
-            outfile << "See original file for credits and usage license. " << endl;
-            outfile << "This file is auto-generated, do not modify directly." << endl;
+            output += std::format("ShaderGlass preset {} / {} imported from {}:\n", info.category, info.shaderName, _libName);
+            output += _raUrl + input.generic_string() + "\n";
+            output += "See original file for credits and usage license. \n";
+            output += "This file is auto-generated, do not modify directly.\n";
         }
         else
-            outfile << line << endl;
+            Template::Render(line, output, values);
     }
-    outfile.close();
+    saveOutput(info.outputPath, output);
     log << "Generated PresetDef " << info.outputPath << endl;
 }
 
@@ -558,122 +800,46 @@ vector<string> loadSource(const filesystem::path& input, bool followIncludes)
 
 void processShader(ShaderDef def, ofstream& log, bool& warn)
 {
-    vector<string> vertexSource;
-    vector<string> fragmentSource;
+    // stages, parameters, format and comments in one pass, each stage gets only its own lines
+    const auto& source = preprocessSlang(def.input);
+    log << "Preprocessed " << source.inputLines << " lines into " << source.vertex.size() << " vertex and " << source.fragment.size() << " fragment lines" << endl;
+
+    for(const auto& line : source.parameters)
+        def.params.push_back(ShaderParam(line, 1, 0));
+    def.comments = source.comments;
 
-    bool        isVertex = true, isFragment = true;
-    const auto& source    = loadSource(def.input, true);
-    bool        inComment = false;
-    for(const auto& line : source)
+    if(!source.format.empty())
     {
-        auto trimLine = trim(line);
-        if(line.starts_with("#pragma parameter"))
+        const auto& format = source.format;
+        if(format.ends_with("R8G8B8A8_UNORM"))
         {
-            // de-duping as workaround for repeated includes
-            auto param = ShaderParam(line, 1, 0);
-            bool dupe = false;
-            for(const auto& p : def.params)
-            {
-                if(p.name == param.name)
-                {
-                    dupe = true;
-                    break;
-                }
-            }
-            if(!dupe)
-                def.params.push_back(param);
+            def.format = "R8G8B8A8_UNORM";
         }
-        else if(line.starts_with("#pragma stage vertex"))
+        else if(format.ends_with("R8G8B8A8_SRGB"))
         {
-            isFragment = false;
-            isVertex   = true;
-            inComment  = false;
+            def.format = "R8G8B8A8_SRGB";
         }
-        else if(line.starts_with("#pragma stage fragment"))
+        else if(format.ends_with("R32G32B32A32_SFLOAT"))
         {
-            isFragment = true;
-            isVertex   = false;
-            inComment  = false;
+            def.format = "R32G32B32A32_SFLOAT";
         }
-        else if(trimLine.starts_with("#pragma format"))
+        else if(format.ends_with("R16G16B16A16_SFLOAT"))
         {
-            if(trimLine.ends_with("R8G8B8A8_UNORM"))
-            {
-                def.format = "R8G8B8A8_UNORM";
-            }
-            else if(trimLine.ends_with("R8G8B8A8_SRGB"))
-            {
-                def.format = "R8G8B8A8_SRGB";
-            }
-            else if(trimLine.ends_with("R32G32B32A32_SFLOAT"))
-            {
-                def.format = "R32G32B32A32_SFLOAT";
-            }
-            else if(trimLine.ends_with("R16G16B16A16_SFLOAT"))
-            {
-                def.format = "R16G16B16A16_SFLOAT";
-            }
-            else
-            {
-                throw std::runtime_error("Unsupported shader format");
-            }
-        }
-        else if(trimLine.starts_with("//"))
-        {
-            if(trimLine.ends_with("*/"))
-            {
-                //def.comments.push_back(trimLine.substr(0, trimLine.length() - 2));
-                inComment = false;
-            }
-            else
-            {
-                def.comments.push_back(trimLine);
-            }
-        }
-        else if(trimLine.starts_with("/*"))
-        {
-            if(trimLine.ends_with("*/"))
-            {
-                def.comments.push_back(trimLine.substr(2, trimLine.length() - 4));
-            }
-            else if(trimLine.find_first_of("*/") == string::npos)
-            {
-                def.comments.push_back(trimLine.substr(2));
-                inComment = true;
-            }
-            else
-            {
-                // comment within line
-                if(isFragment)
-                    fragmentSource.push_back(line);
-                if(isVertex)
-                    vertexSource.push_back(line);
-            }
-        }
-        else if(inComment && trimLine.ends_with("*/"))
-        {
-            def.comments.push_back(trimLine.substr(0, trimLine.length() - 2));
-            inComment = false;
-        }
-        else if(inComment && trimLine.starts_with("*/"))
-        {
-            inComment = false;
-        }
-        else if(inComment)
-        {
-            def.comments.push_back(trimLine);
+            def.format = "R16G16B16A16_SFLOAT";
         }
         else
         {
-            if(isFragment)
-                fragmentSource.push_back(line);
-            if(isVertex)
-                vertexSource.push_back(line);
+            throw std::runtime_error("Unsupported shader format");
         }
     }
 
-    const auto& vertexOutput   = spirv(glsl(def.input, "vert", vertexSource, log), log);
-    const auto& fragmentOutput = spirv(glsl(def.input, "frag", fragmentSource, log), log);
+    // glslang runs once per stage, every target is cross-compiled from its (optimized) module
+    const auto& vertexSpirv    = glsl(def.input, "vert", source.vertex, log);
+    const auto& fragmentSpirv  = glsl(def.input, "frag", source.fragment, log);
+    const auto& vertexModule   = _optimize ? optimize(def.input, "vert", vertexSpirv, log, warn) : vertexSpirv;
+    const auto& fragmentModule = _optimize ? optimize(def.input, "frag", fragmentSpirv, log, warn) : fragmentSpirv;
+    const auto& vertexOutput   = spirv(vertexModule, vertexSpirv, log);
+    const auto& fragmentOutput = spirv(fragmentModule, fragmentSpirv, log);
     def.vertexSource           = vertexOutput.first;
     def.vertexMetadata         = vertexOutput.second;
     def.fragmentSource         = fragmentOutput.first;
@@ -683,51 +849,156 @@ void processShader(ShaderDef def, ofstream& log, bool& warn)
     metaOutput.replace_extension(".meta");
     saveSource(metaOutput, fragmentOutput.second);
 
-    def.vertexByteCode   = fxc(def.input, "vs_5_0", vertexOutput.first, log, warn);
-    def.fragmentByteCode = fxc(def.input, "ps_5_0", fragmentOutput.first, log, warn);
+    def.vertexByteCode   = fxc(def.input, "vs_5_0", vertexOutput.first, log, warn, def.vertexStats);
+    def.fragmentByteCode = fxc(def.input, "ps_5_0", fragmentOutput.first, log, warn, def.fragmentStats);
 
     replace(def.vertexByteCode, " ", "");
     replace(def.fragmentByteCode, " ", "");
 
-    populateShaderTemplate(def, log);
+    // SPIR-V and GLSL are extras for other backends, when either fails the pass keeps its DXBC without them;
+    // GLSL goes in as zero terminated bytes, some presets are too long for a string literal
+    try
+    {
+        validate(vertexModule, log);
+        validate(fragmentModule, log);
+        const auto& vertexGlsl   = glslTarget(def.input, "vert", vertexModule, log);
+        const auto& fragmentGlsl = glslTarget(def.input, "frag", fragmentModule, log);
+        def.vertexSpirv          = bin2string(loadBinary(vertexModule));
+        def.fragmentSpirv        = bin2string(loadBinary(fragmentModule));
+        def.vertexGlsl           = bin2string(vector<uint8_t>(vertexGlsl.c_str(), vertexGlsl.c_str() + vertexGlsl.size() + 1));
+        def.fragmentGlsl         = bin2string(vector<uint8_t>(fragmentGlsl.c_str(), fragmentGlsl.c_str() + fragmentGlsl.size() + 1));
+        def.crossTargets         = true;
+    }
+    catch(std::exception& e)
+    {
+        log << "WARNING: " << e.what() << ", " << def.input << " has no SPIR-V or GLSL" << endl;
+        warn = true;
+    }
+
+    populateShaderTemplate(std::move(def), log);
 }
 
-string bin2string(filesystem::path input)
+bool isCompressible(const TextureDef& def, uint32_t width, uint32_t height)
 {
-    ostringstream oss;
-    ifstream      infile(input, fstream::binary);
-    bool          first   = true;
-    int           counter = 0;
+    if(width % 4 || height % 4 || width < _minCompressSize || height < _minCompressSize)
+        return false;
+
+    // LUTs and point-sampled textures carry data rather than images
+    auto name = def.input.filename().string();
+    transform(name.begin(), name.end(), name.begin(), ::tolower);
+    if(name.find("lut") != string::npos)
+        return false;
+    auto linear = def.presetParams.find("linear");
+    if(linear == def.presetParams.end() || linear->second != "true")
+        return false;
+
+    return true;
+}
+
+// replace RGBA8 pixels with BC1/BC3 blocks when the result is close enough
+void compressTexture(const TextureDef& def, vector<uint8_t>& output, ofstream& log)
+{
+    auto header = reinterpret_cast<RawTextureHeader*>(output.data());
+    if(!isCompressible(def, header->width, header->height))
+        return;
 
-    oss << "{";
-    char c;
-    while(infile.get(c))
+    const auto result = blockCompress(output.data() + sizeof(RawTextureHeader), header->width, header->height);
+    const auto name   = result.format == BlockFormat::BC1 ? "BC1" : "BC3";
+    if(result.psnr < _minPsnr)
     {
-        if(first)
+        log << "Kept " << def.input << " uncompressed, " << name << " PSNR " << fixed << setprecision(2) << result.psnr << " dB" << endl;
+        return;
+    }
+
+    log << "Compressed " << def.input << " to " << name << ", PSNR " << fixed << setprecision(2) << result.psnr << " dB, " << (output.size() - sizeof(RawTextureHeader))
+        << " -> " << result.blocks.size() << " bytes" << endl;
+    header->format = result.format == BlockFormat::BC1 ? 71 : 77; // DXGI_FORMAT_BC1_UNORM, DXGI_FORMAT_BC3_UNORM
+    output.resize(sizeof(RawTextureHeader) + result.blocks.size());
+    memcpy(output.data() + sizeof(RawTextureHeader), result.blocks.data(), result.blocks.size());
+}
+
+// decode image into RGBA8 so ShaderGlass can upload it without WIC
+bool predecodeTexture(const filesystem::path& input, vector<uint8_t>& output)
+{
+    using Microsoft::WRL::ComPtr;
+
+    ComPtr<IWICImagingFactory> factory;
+    if(FAILED(CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory))))
+        return false;
+
+    ComPtr<IWICBitmapDecoder> decoder;
+    if(FAILED(factory->CreateDecoderFromFilename(input.wstring().c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder)))
+        return false;
+
+    ComPtr<IWICBitmapFrameDecode> frame;
+    if(FAILED(decoder->GetFrame(0, &frame)))
+        return false;
+
+    ComPtr<IWICFormatConverter> converter;
+    if(FAILED(factory->CreateFormatConverter(&converter)))
+        return false;
+
+    if(FAILED(converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0, WICBitmapPaletteTypeCustom)))
+        return false;
+
+    UINT width, height;
+    if(FAILED(converter->GetSize(&width, &height)))
+        return false;
+
+    RawTextureHeader header;
+    memcpy(header.magic, "SGTX", 4);
+    header.version   = 1;
+    header.width     = width;
+    header.height    = height;
+    header.mipLevels = 1;
+    header.format    = 28; // DXGI_FORMAT_R8G8B8A8_UNORM
+
+    const auto pixelsSize = static_cast<size_t>(width) * height * 4;
+    output.resize(sizeof(RawTextureHeader) + pixelsSize);
+    memcpy(output.data(), &header, sizeof(RawTextureHeader));
+    if(FAILED(converter->CopyPixels(nullptr, width * 4, static_cast<UINT>(pixelsSize), output.data() + sizeof(RawTextureHeader))))
+        return false;
+
+    return true;
+}
+
+// the raw container has no mip chain, so textures presets want mipmapped keep their original encoding
+bool isMipmapped(const TextureDef& def)
+{
+    const auto mipmap = def.presetParams.find("mipmap");
+    return mipmap != def.presetParams.end() && mipmap->second == "true";
+}
+
+void processTexture(TextureDef def, ofstream& log)
+{
+    vector<uint8_t> data;
+    if(_predecode && isMipmapped(def))
+    {
+        log << "Kept " << def.input << " as-is, mipmapped textures are not pre-decoded" << endl;
+    }
+    else if(_predecode)
+    {
+        if(predecodeTexture(def.input, data))
         {
-            first = false;
+            log << "Pre-decoded " << def.input << " (" << filesystem::file_size(def.input) << " -> " << data.size() << " bytes)" << endl;
+            textureBytesDecoded += data.size() - sizeof(RawTextureHeader);
+            if(_compress)
+            {
+                compressTexture(def, data, log);
+            }
+            textureBytesCompressed += data.size() - sizeof(RawTextureHeader);
         }
         else
         {
-            oss << ",";
-        }
-        oss << (int)((unsigned char)c);
-        counter++;
-        if(counter == 40)
-        {
-            counter = 0;
-            oss << endl;
+            log << "WARNING: unable to pre-decode " << def.input << ", embedding as-is" << endl;
+            data.clear();
         }
-        if(infile.eof())
-            break;
     }
-    oss << "};";
-    return oss.str();
-}
-
-void processTexture(TextureDef def, ofstream& log)
-{
-    def.data = bin2string(def.input);
+    if(data.empty())
+    {
+        data = loadBinary(def.input);
+    }
+    def.data = bin2string(data);
     populateTextureTemplate(def, log);
 }
 
@@ -880,6 +1151,12 @@ void parsePreset(const filesystem::path& input, map<string, string>& keyValues,
     infile.close();
 }
 
+// converted by a worker this run, or left from an earlier run unless forced
+bool isCurrent(const filesystem::path& input, const filesystem::path& output)
+{
+    return converted.contains(input.string()) || (!_force && filesystem::exists(output));
+}
+
 void processPreset(const filesystem::path& input, ofstream& log, bool& warn)
 {
     map<string, string>           keyValues;
@@ -888,6 +1165,8 @@ void processPreset(const filesystem::path& input, ofstream& log, bool& warn)
 
     parsePreset(input, keyValues, keyPaths);
 
+    auto              pDef       = getShaderInfo(input, "PresetDef");
+    auto              shardName  = getShardName(pDef);
     auto              numShaders = atoi(getValue("shaders", -1, keyValues, seenKeys).c_str());
     vector<ShaderDef> shaders;
     for(int i = 0; i < numShaders; i++)
@@ -897,14 +1176,13 @@ void processPreset(const filesystem::path& input, ofstream& log, bool& warn)
         shaderFullPath.make_preferred();
         auto def = ShaderDef(shaderFullPath);
         setPresetParams(def, i, keyValues, seenKeys);
-        if(_force || !filesystem::exists(def.info.outputPath))
+        if(!isCurrent(def.input, def.info.outputPath))
         {
             processShader(def, log, warn);
         }
-        updateShaderList(def.info);
+        updateShaderList(def.info, shardName);
         shaders.push_back(def);
     }
-    auto               pDef = getShaderInfo(input, "PresetDef");
     vector<TextureDef> textures;
     auto               textureList = getValue("textures", -1, keyValues, seenKeys);
     if(textureList.size())
@@ -927,11 +1205,11 @@ void processPreset(const filesystem::path& input, ofstream& log, bool& warn)
                 auto def = TextureDef(textureFullPath);
                 def.presetParams.insert(make_pair("name", textureName));
                 setPresetParams(def, textureName, keyValues, seenKeys);
-                if(_force || !filesystem::exists(def.info.outputPath))
+                if(!isCurrent(def.input, def.info.outputPath))
                 {
                     processTexture(def, log);
                 }
-                updateTextureList(def.info);
+                updateTextureList(def.info, shardName);
                 textures.push_back(def);
 
                 textureList.erase(0, pos + 1);
@@ -959,10 +1237,12 @@ void processPreset(const filesystem::path& input, ofstream& log, bool& warn)
     {
         populatePresetTemplate(input, shaders, textures, overrides, log);
     }
-    updatePresetList(getShaderInfo(input, "PresetDef"));
+    updatePresetList(pDef);
 }
 
-void processFile(const filesystem::path& input, ofstream& reportStream)
+// runs on workers too, so everything shared goes through outputMutex; texture has the preset parameters
+// of an image converted on its own, as processPreset would pass them
+void processFile(const filesystem::path& input, ofstream& reportStream, const map<string, string>* texture = nullptr)
 {
     if(input.filename().string()[0] == '-') // exclusions (files)
         return;
@@ -970,18 +1250,36 @@ void processFile(const filesystem::path& input, ofstream& reportStream)
     if(input.string()[0] == '-') // exclusions (folders)
         return;
 
+    // completed before the run was interrupted, no tools needed
+    const auto completed = journaled.find(input.string());
+    if(completed != journaled.end() && isIntact(completed->second))
+    {
+        lock_guard lock(outputMutex);
+        converted.insert(input.string());
+        std::cout << input << " ...DONE" << endl;
+        reportStream << "DONE: " << input << endl;
+        return;
+    }
+    itemOutputs.clear();
+
     auto inputString = input.string();
     std::replace(inputString.begin(), inputString.end(), '\\', '!');
     std::filesystem::path logPath(tempPath / "logs" / (inputString + ".log"));
-    std::filesystem::create_directory(tempPath / "logs");
+    std::filesystem::create_directories(tempPath / "logs");
     ofstream log(logPath);
     bool     warn = false;
     bool     err  = false;
+    string   error;
 
     try
     {
-        std::cout << input << " ...";
-        if(input.extension() == ".slang")
+        if(texture)
+        {
+            auto def         = TextureDef(input);
+            def.presetParams = *texture;
+            processTexture(def, log);
+        }
+        else if(input.extension() == ".slang")
             processShader(input, log, warn);
         else if(input.extension() == ".slangp")
             processPreset(input, log, warn);
@@ -990,18 +1288,21 @@ void processFile(const filesystem::path& input, ofstream& reportStream)
     }
     catch(std::exception& e)
     {
-        cout << e.what() << endl;
-        err = true;
+        error = e.what();
+        err   = true;
 
         log << "ERROR:" << e.what() << endl;
     }
     log.close();
 
+    lock_guard lock(outputMutex);
+    std::cout << input << " ...";
     if(err)
     {
+        spirvReport.clear();
         auto orgPath(logPath);
         std::filesystem::rename(orgPath, logPath.replace_extension(".ERROR.log"));
-        std::cout << "ERROR" << endl;
+        std::cout << error << endl << "ERROR" << endl;
         reportStream << "ERROR: " << input << endl;
     }
     else if(warn)
@@ -1016,6 +1317,61 @@ void processFile(const filesystem::path& input, ofstream& reportStream)
         std::cout << "OK" << endl;
         reportStream << "OK: " << input << endl;
     }
+    for(const auto& counts : spirvReport)
+        reportStream << "  " << counts << endl;
+    spirvReport.clear();
+
+    // failed files are not journaled and run again on resume
+    if(!err)
+    {
+        converted.insert(input.string());
+        for(const auto& output : itemOutputs)
+            journal << "output\t" << input.string() << "\t" << output.first << "\t" << std::hex << output.second << std::dec << endl;
+        journal << "done\t" << input.string() << endl;
+    }
+}
+
+// a file counts as completed once its "done" line is written, after all its outputs;
+// the journal only applies to a rerun with the same arguments
+void openJournal(const string& arguments, ofstream& reportStream)
+{
+    journalPath = tempPath / "journal.txt";
+
+    map<string, vector<pair<string, uint64_t>>> outputs;
+    ifstream                                    infile(journalPath);
+    string                                      line;
+    if(getline(infile, line) && line == "args\t" + arguments)
+    {
+        while(getline(infile, line))
+        {
+            vector<string> fields;
+            stringstream   iss(line);
+            string         field;
+            while(getline(iss, field, '\t'))
+                fields.push_back(field);
+
+            if(fields.size() == 4 && fields[0] == "output")
+                outputs[fields[1]].emplace_back(fields[2], stoull(fields[3], nullptr, 16));
+            else if(fields.size() == 2 && fields[0] == "done")
+            {
+                journaled[fields[1]] = std::move(outputs[fields[1]]);
+                outputs.erase(fields[1]);
+            }
+        }
+    }
+    infile.close();
+
+    if(journaled.size())
+    {
+        std::cout << "Resuming, " << journaled.size() << " files completed" << endl;
+        reportStream << "Resuming from " << journalPath.string() << ", " << journaled.size() << " files completed" << endl;
+        journal.open(journalPath, ios::app);
+    }
+    else
+    {
+        journal.open(journalPath, ios::trunc);
+        journal << "args\t" << arguments << endl;
+    }
 }
 
 void processListTemplate()
@@ -1029,16 +1385,157 @@ void processListTemplate()
         auto bufferString = buffer.str();
         replace(bufferString, "%LIB_NAME%", _libName);
 
-        ofstream outfile(listPath);
+        ofstream outfile(pendingPath(listPath));
         outfile << bufferString;
         outfile.close();
+        commitFile(listPath);
         std::cout << "Generated list " << listPath.string() << endl;
     }
     shaderList = loadSource(listPath, false);
 }
 
+// presets under root; a directory with an .exclude file is checked once and not descended into,
+// neither are files and directories starting with '-'
+vector<filesystem::path> scanPresets(const filesystem::path& root)
+{
+    vector<filesystem::path> presets;
+    if(filesystem::exists(root / ".exclude"))
+        return presets;
+
+    for(auto it = filesystem::recursive_directory_iterator(root); it != filesystem::recursive_directory_iterator(); it++)
+    {
+        const auto excluded = it->path().filename().string().starts_with('-');
+        if(it->is_directory())
+        {
+            if(excluded || filesystem::exists(it->path() / ".exclude"))
+                it.disable_recursion_pending();
+        }
+        else if(!excluded && it->path().extension() == ".slangp")
+            presets.push_back(it->path().lexically_normal());
+    }
+
+    // discovery order depends on the file system
+    sort(presets.begin(), presets.end());
+    return presets;
+}
+
+// shaders and textures a preset refers to, resolved as in processPreset; a texture shared by presets keeps only
+// the parameters they all agree on, so it is compressed only if every one samples it linearly, and stays
+// mipmapped if any one asks for it
+void addDependencies(const filesystem::path& input, set<filesystem::path>& shaders, map<filesystem::path, map<string, string>>& textures)
+{
+    map<string, string>           keyValues;
+    map<string, filesystem::path> keyPaths;
+    unordered_set<string>         seenKeys;
+    parsePreset(input, keyValues, keyPaths);
+
+    auto resolve = [](filesystem::path path) {
+        path = path.lexically_normal();
+        path.make_preferred();
+        return path;
+    };
+
+    const auto numShaders = atoi(getValue("shaders", -1, keyValues, seenKeys).c_str());
+    for(int i = 0; i < numShaders; i++)
+        shaders.insert(resolve(getPath("shader", i, keyValues, keyPaths, seenKeys)));
+
+    stringstream textureList(getValue("textures", -1, keyValues, seenKeys));
+    string       textureName;
+    while(getline(textureList, textureName, ';'))
+    {
+        if(!textureName.size())
+            continue;
+
+        auto def = TextureDef(resolve(getPath(textureName, "", keyValues, keyPaths, seenKeys)));
+        setPresetParams(def, textureName, keyValues, seenKeys);
+        const auto [texture, added] = textures.try_emplace(def.input, def.presetParams);
+        if(!added)
+        {
+            const auto mipmap = isMipmapped(def) || texture->second["mipmap"] == "true";
+            erase_if(texture->second, [&](const auto& param) {
+                const auto other = def.presetParams.find(param.first);
+                return other == def.presetParams.end() || other->second != param.second;
+            });
+            if(mipmap)
+                texture->second["mipmap"] = "true";
+        }
+    }
+}
+
+struct WorkItem
+{
+    filesystem::path    input;
+    uintmax_t           size; // source incl. includes, or image file
+    bool                texture;
+    map<string, string> presetParams; // textures, as the presets referencing them set them
+};
+
+// shaders and textures shared by presets are converted once, in parallel and longest first so workers finish together;
+// presets then only fill templates and update the shared shard and list files, in order
+void processTree(const filesystem::path& root, ofstream& reportStream)
+{
+    const auto                                 scanStart = chrono::steady_clock::now();
+    const auto                                 presets   = scanPresets(root);
+    set<filesystem::path>                      shaders;
+    map<filesystem::path, map<string, string>> textures;
+    for(const auto& preset : presets)
+    {
+        // a preset that does not parse fails on its own below
+        try
+        {
+            addDependencies(preset, shaders, textures);
+        }
+        catch(std::exception&)
+        { }
+    }
+
+    vector<WorkItem> items;
+    for(const auto& shader : shaders)
+    {
+        if(filesystem::exists(shader) && !isCurrent(shader, ShaderDef(shader).info.outputPath))
+        {
+            uintmax_t size = 0;
+            for(const auto& line : loadSource(shader, true))
+                size += line.size() + 1;
+            items.push_back({shader, size, false, {}});
+        }
+    }
+    for(const auto& texture : textures)
+    {
+        if(filesystem::exists(texture.first) && !isCurrent(texture.first, TextureDef(texture.first).info.outputPath))
+            items.push_back({texture.first, filesystem::file_size(texture.first), true, texture.second});
+    }
+    sort(items.begin(), items.end(), [](const WorkItem& a, const WorkItem& b) { return a.size > b.size; });
+
+    const auto  scanMs  = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - scanStart).count();
+    const auto  threads = static_cast<unsigned>(min<size_t>(max(1u, thread::hardware_concurrency()), max<size_t>(1, items.size())));
+    const auto& scanned = std::format("Scanned {} presets, {} shaders, {} textures in {} ms, converting {} on {} threads",
+                                      presets.size(), shaders.size(), textures.size(), scanMs, items.size(), threads);
+    std::cout << scanned << endl;
+    reportStream << scanned << endl;
+
+    atomic<size_t> next {0};
+    vector<thread> workers;
+    for(unsigned t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&] {
+            CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+            for(size_t i = next++; i < items.size(); i = next++)
+                processFile(items[i].input, reportStream, items[i].texture ? &items[i].presetParams : nullptr);
+            CoUninitialize();
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    for(const auto& preset : presets)
+        processFile(preset, reportStream);
+}
+
 int main(int argc, char* argv[])
 {
+    CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
     startupPath = filesystem::current_path();
     filesystem::current_path(_inputPath);
 
@@ -1050,6 +1547,12 @@ int main(int argc, char* argv[])
     reportStream << "Starting at " << (std::format("{:%Y-%m-%d %H:%M:%S}", std::chrono::system_clock::now())) << endl;
 
     processListTemplate();
+    loadShards();
+
+    string arguments;
+    for(int i = 1; i < argc; i++)
+        arguments += (i > 1 ? " " : "") + string(argv[i]);
+    openJournal(arguments, reportStream);
 
     try
     {
@@ -1061,26 +1564,25 @@ int main(int argc, char* argv[])
                 _force = true;
                 continue;
             }
+            if(input == "predecode")
+            {
+                _predecode = true;
+                continue;
+            }
+            if(input == "noopt")
+            {
+                _optimize = false;
+                continue;
+            }
+            if(input == "compress")
+            {
+                _predecode = true;
+                _compress  = true;
+                continue;
+            }
             if(input == ".")
             {
-                for(auto& p : filesystem::recursive_directory_iterator("."))
-                {
-                    if(p.path().extension() == ".slangp")
-                    {
-                        auto isExcluded  = false;
-                        auto excludePath = p.path().parent_path();
-                        do
-                        {
-                            isExcluded |= filesystem::exists(excludePath / ".exclude");
-                            excludePath = excludePath.parent_path();
-                        } while(!isExcluded && !excludePath.empty());
-
-                        if(!isExcluded)
-                        {
-                            processFile(p.path().lexically_normal(), reportStream);
-                        }
-                    }
-                }
+                processTree(".", reportStream);
             }
             else
             {
@@ -1095,12 +1597,26 @@ int main(int argc, char* argv[])
                     processFile(input, reportStream);
             }
         }
+
+        // finished, the next run starts over
+        journal.close();
+        filesystem::remove(journalPath);
     }
     catch(exception& e)
     {
         reportStream << "EXCEPTION: " << e.what() << endl;
     }
 
+    if(_predecode)
+    {
+        reportStream << "Texture memory " << textureBytesDecoded.load() << " -> " << textureBytesCompressed.load() << " bytes" << endl;
+    }
+    if(spirvInstructions)
+    {
+        reportStream << "SPIR-V instructions " << spirvInstructions.load() << " -> " << spirvOptimized.load() << endl;
+    }
     reportStream << "Finishing at " << (std::format("{:%Y-%m-%d %H:%M:%S}", std::chrono::system_clock::now())) << endl;
     reportStream.close();
+
+    CoUninitialize();
 }
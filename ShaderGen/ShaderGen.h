@@ -18,6 +18,18 @@
 #include <map>
 #include <unordered_set>
 #include <filesystem>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <format>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#define NOMINMAX
+#include <windows.h>
+#include <wincodec.h>
+#include <wrl/client.h>
 
 #include "include/json.hpp"
 
@@ -29,10 +41,28 @@ const char* _inputPath  = "..\\..\\slang-shaders";
 const char* _outputPath = "..\\ShaderGlass\\ShaderGlass\\Shaders\\";
 const char* _glslPath   = "..\\ShaderGlass\\Tools\\glslangValidator.exe";
 const char* _spirvPath  = "..\\ShaderGlass\\Tools\\spirv-cross.exe";
+const char* _spirvOptPath = "..\\ShaderGlass\\Tools\\spirv-opt.exe";
+const char* _spirvValPath = "..\\ShaderGlass\\Tools\\spirv-val.exe";
 const char* _tempPath   = "..\\ShaderGlass\\temp";
 const char* _fxcPath    = "C:\\Program Files (x86)\\Windows Kits\\10\\bin\\10.0.22621.0\\x64\\fxc.exe";
 const char* _raUrl      = "https://github.com/libretro/slang-shaders/blob/23046258f7fd02242cc6dd4c08c997a8ddb84935/";
 bool _force = false;
+bool _predecode = false;
+bool _compress = false;
+bool _optimize = true; // spirv-opt between glslang and spirv-cross
+const double _minPsnr = 40.0; // keep textures uncompressed below this quality
+const uint32_t _minCompressSize = 64; // smaller textures are mostly masks and lookup data
+
+// must match RawTextureHeader in ShaderGlass\TextureDef.h
+struct RawTextureHeader
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t mipLevels;
+    uint32_t format;
+};
 
 static inline void ltrim(std::string& s)
 {
@@ -193,6 +223,21 @@ ShaderInfo getShaderInfo(const filesystem::path& slangInput, const string& suffi
     return info;
 }
 
+// cost indicators from the fxc listing, instruction slots and texture fetches
+struct ShaderStats
+{
+    int  instructions {0};
+    int  textureFetches {0};
+    bool loops {false};
+};
+
+// size of a SPIR-V module, taken before and after spirv-opt
+struct SpirvStats
+{
+    size_t bytes {0};
+    int    instructions {0};
+};
+
 struct ShaderDef
 {
     ShaderDef(const filesystem::path& input) : input {input}, info {getShaderInfo(input, "ShaderDef")}, format{} { }
@@ -204,6 +249,13 @@ struct ShaderDef
     string              fragmentSource;
     string              fragmentByteCode;
     string              fragmentMetadata;
+    string              vertexSpirv;
+    string              fragmentSpirv;
+    string              vertexGlsl;
+    string              fragmentGlsl;
+    bool                crossTargets {false}; // SPIR-V and GLSL validated, otherwise only DXBC
+    ShaderStats         vertexStats;
+    ShaderStats         fragmentStats;
     vector<ShaderParam> params;
     ShaderInfo          info;
     string              format;
@@ -0,0 +1,633 @@
+/*
+ShaderGen: slangp shader converter for ShaderGlass
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "SlangPreprocessor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdexcept>
+
+using namespace std;
+
+constexpr int MAX_DEPTH = 32; // #include nesting and macro expansion
+
+static const char* UNKNOWN = "<unknown>"; // expression token glslang has to decide
+
+enum class Truth
+{
+    False,
+    True,
+    Unknown
+};
+
+struct Conditional
+{
+    bool parentActive; // enclosing block is kept
+    bool active;       // current branch is kept
+    bool taken;        // a branch was kept, later ones are dropped
+    bool verbatim;     // left for glslang, every branch kept along with the directives
+};
+
+// each stage sees the common lines and its own section, so it has its own macros and #if nesting
+struct StageState
+{
+    map<string, string> macros;  // object-like, name to value
+    set<string>         unknown; // function-like, or defined in a verbatim block
+    vector<Conditional> conditionals;
+    bool                receiving {true};
+    vector<string>*     output {nullptr};
+
+    bool Active() const
+    {
+        return conditionals.empty() || conditionals.back().active;
+    }
+
+    bool InVerbatim() const
+    {
+        return any_of(conditionals.begin(), conditionals.end(), [](const Conditional& c) { return c.verbatim; });
+    }
+};
+
+static string trimmed(const string& s)
+{
+    size_t first = 0, last = s.size();
+    while(first < last && isspace(static_cast<unsigned char>(s[first])))
+        first++;
+    while(last > first && isspace(static_cast<unsigned char>(s[last - 1])))
+        last--;
+    return s.substr(first, last - first);
+}
+
+static string rtrimmed(const string& s)
+{
+    size_t last = s.size();
+    while(last > 0 && isspace(static_cast<unsigned char>(s[last - 1])))
+        last--;
+    return s.substr(0, last);
+}
+
+static bool isIdentifierChar(char c)
+{
+    return isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+static bool isIdentifier(const string& token)
+{
+    return !token.empty() && (isalpha(static_cast<unsigned char>(token[0])) || token[0] == '_');
+}
+
+// defined by glslang itself (GL_ES, GL_core_profile, __VERSION__, VULKAN...)
+static bool isBuiltin(const string& name)
+{
+    return name.starts_with("GL_") || name.starts_with("__") || name == "VULKAN";
+}
+
+static string firstWord(const string& s)
+{
+    size_t n = 0;
+    while(n < s.size() && isIdentifierChar(s[n]))
+        n++;
+    return s.substr(0, n);
+}
+
+static vector<string> tokenize(const string& expression)
+{
+    static const char* pairs[] = {"&&", "||", "==", "!=", "<=", ">=", "<<", ">>"};
+
+    vector<string> tokens;
+    size_t         i = 0;
+    while(i < expression.size())
+    {
+        if(isspace(static_cast<unsigned char>(expression[i])))
+        {
+            i++;
+            continue;
+        }
+
+        const auto start = i++;
+        if(isIdentifierChar(expression[start]))
+        {
+            while(i < expression.size() && isIdentifierChar(expression[i]))
+                i++;
+        }
+        else
+        {
+            for(const auto& pair : pairs)
+            {
+                if(expression.compare(start, 2, pair) == 0)
+                {
+                    i = start + 2;
+                    break;
+                }
+            }
+        }
+        tokens.push_back(expression.substr(start, i - start));
+    }
+    return tokens;
+}
+
+// #if expression over the stage's macros, anything it can't decide makes the result unknown
+class Expression
+{
+public:
+    Expression(const StageState& state, const string& text) : m_state {state}
+    {
+        Expand(tokenize(text), 0);
+    }
+
+    Truth Evaluate()
+    {
+        if(m_failed)
+            return Truth::Unknown;
+        const auto value = Ternary();
+        if(m_failed || m_pos != m_tokens.size() || !value.known)
+            return Truth::Unknown;
+        return value.value ? Truth::True : Truth::False;
+    }
+
+private:
+    struct Value
+    {
+        long long value;
+        bool      known;
+    };
+
+    void Expand(const vector<string>& tokens, int depth)
+    {
+        if(depth > MAX_DEPTH)
+        {
+            m_failed = true;
+            return;
+        }
+
+        for(size_t t = 0; t < tokens.size(); t++)
+        {
+            const auto& token = tokens[t];
+            if(token == "defined")
+            {
+                const bool   paren = t + 1 < tokens.size() && tokens[t + 1] == "(";
+                const size_t n     = t + (paren ? 2 : 1);
+                if(n >= tokens.size() || !isIdentifier(tokens[n]) || (paren && (n + 1 >= tokens.size() || tokens[n + 1] != ")")))
+                {
+                    m_failed = true;
+                    return;
+                }
+                const auto& name = tokens[n];
+                if(isBuiltin(name) || m_state.unknown.contains(name))
+                    m_tokens.push_back(UNKNOWN);
+                else
+                    m_tokens.push_back(m_state.macros.contains(name) ? "1" : "0");
+                t = paren ? n + 1 : n;
+            }
+            else if(isIdentifier(token))
+            {
+                const auto macro = m_state.macros.find(token);
+                if(isBuiltin(token) || m_state.unknown.contains(token))
+                    m_tokens.push_back(UNKNOWN);
+                else if(macro != m_state.macros.end())
+                    Expand(tokenize(macro->second), depth + 1);
+                else
+                    m_tokens.push_back("0"); // as in C
+            }
+            else
+                m_tokens.push_back(token);
+        }
+    }
+
+    bool Accept(const char* token)
+    {
+        if(m_pos < m_tokens.size() && m_tokens[m_pos] == token)
+        {
+            m_pos++;
+            return true;
+        }
+        return false;
+    }
+
+    Value Ternary()
+    {
+        const auto condition = Binary(0);
+        if(!Accept("?"))
+            return condition;
+
+        const auto a = Ternary();
+        if(!Accept(":"))
+            m_failed = true;
+        const auto b = Ternary();
+        if(!condition.known)
+            return (a.known && b.known && a.value == b.value) ? a : Value {0, false};
+        return condition.value ? a : b;
+    }
+
+    Value Binary(size_t level)
+    {
+        static const vector<vector<string>> levels = {
+            {"||"}, {"&&"}, {"|"}, {"^"}, {"&"}, {"==", "!="}, {"<", ">", "<=", ">="}, {"<<", ">>"}, {"+", "-"}, {"*", "/", "%"}};
+
+        if(level == levels.size())
+            return Unary();
+
+        auto left = Binary(level + 1);
+        while(m_pos < m_tokens.size() && find(levels[level].begin(), levels[level].end(), m_tokens[m_pos]) != levels[level].end())
+        {
+            const auto op    = m_tokens[m_pos++];
+            const auto right = Binary(level + 1);
+            left             = Apply(op, left, right);
+        }
+        return left;
+    }
+
+    Value Apply(const string& op, Value a, Value b)
+    {
+        // a known side can decide these on its own
+        if(op == "&&")
+        {
+            if((a.known && !a.value) || (b.known && !b.value))
+                return {0, true};
+            return {1, a.known && b.known};
+        }
+        if(op == "||")
+        {
+            if((a.known && a.value) || (b.known && b.value))
+                return {1, true};
+            return {0, a.known && b.known};
+        }
+        if(!a.known || !b.known)
+            return {0, false};
+
+        if((op == "/" || op == "%") && b.value == 0)
+        {
+            m_failed = true;
+            return {0, false};
+        }
+        if(op == "|")
+            return {a.value | b.value, true};
+        if(op == "^")
+            return {a.value ^ b.value, true};
+        if(op == "&")
+            return {a.value & b.value, true};
+        if(op == "==")
+            return {a.value == b.value, true};
+        if(op == "!=")
+            return {a.value != b.value, true};
+        if(op == "<")
+            return {a.value < b.value, true};
+        if(op == ">")
+            return {a.value > b.value, true};
+        if(op == "<=")
+            return {a.value <= b.value, true};
+        if(op == ">=")
+            return {a.value >= b.value, true};
+        if(op == "<<")
+            return {a.value << b.value, true};
+        if(op == ">>")
+            return {a.value >> b.value, true};
+        if(op == "+")
+            return {a.value + b.value, true};
+        if(op == "-")
+            return {a.value - b.value, true};
+        if(op == "*")
+            return {a.value * b.value, true};
+        if(op == "/")
+            return {a.value / b.value, true};
+        return {a.value % b.value, true};
+    }
+
+    Value Unary()
+    {
+        if(Accept("!"))
+        {
+            const auto v = Unary();
+            return {!v.value, v.known};
+        }
+        if(Accept("-"))
+        {
+            const auto v = Unary();
+            return {-v.value, v.known};
+        }
+        if(Accept("~"))
+        {
+            const auto v = Unary();
+            return {~v.value, v.known};
+        }
+        if(Accept("+"))
+            return Unary();
+        if(Accept("("))
+        {
+            const auto v = Ternary();
+            if(!Accept(")"))
+                m_failed = true;
+            return v;
+        }
+        if(m_pos >= m_tokens.size())
+        {
+            m_failed = true;
+            return {0, false};
+        }
+
+        auto token = m_tokens[m_pos++];
+        if(token == UNKNOWN)
+            return {0, false};
+        while(!token.empty() && (token.back() == 'u' || token.back() == 'U' || token.back() == 'l' || token.back() == 'L'))
+            token.pop_back();
+        try
+        {
+            size_t     used;
+            const auto value = stoll(token, &used, 0);
+            if(used == token.size())
+                return {value, true};
+        }
+        catch(exception&)
+        { }
+        m_failed = true;
+        return {0, false};
+    }
+
+    const StageState& m_state;
+    vector<string>    m_tokens;
+    size_t            m_pos {0};
+    bool              m_failed {false};
+};
+
+class Preprocessor
+{
+public:
+    Preprocessor(SlangSource& source) : m_source {source}
+    {
+        m_stages[0].output = &source.vertex;
+        m_stages[1].output = &source.fragment;
+    }
+
+    void Process(const filesystem::path& input, int depth)
+    {
+        if(depth > MAX_DEPTH)
+            throw runtime_error("Too many nested includes in " + input.string());
+
+        ifstream infile(input);
+        if(!infile)
+            throw runtime_error("Unable to open " + input.string());
+
+        // a comment ends at its first */, markers inside comments and strings don't count
+        const bool collect = m_commented.insert(input).second;
+        bool       inBlock = false;
+        string     line, pending;
+        while(getline(infile, line))
+        {
+            m_source.inputLines++;
+            if(!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            string         code;
+            vector<string> comments;
+            for(size_t i = 0; i < line.size();)
+            {
+                if(inBlock)
+                {
+                    const auto end  = line.find("*/", i);
+                    const auto text = trimmed(line.substr(i, end == string::npos ? string::npos : end - i));
+                    if(end == string::npos || !text.empty())
+                        comments.push_back(text);
+                    if(end == string::npos)
+                        break;
+                    i       = end + 2;
+                    inBlock = false;
+                    code += ' ';
+                }
+                else if(line.compare(i, 2, "//") == 0)
+                {
+                    comments.push_back(trimmed(line.substr(i)));
+                    break;
+                }
+                else if(line.compare(i, 2, "/*") == 0)
+                {
+                    inBlock = true;
+                    i += 2;
+                }
+                else if(line[i] == '\"')
+                {
+                    const auto end = line.find('\"', i + 1);
+                    code += line.substr(i, end == string::npos ? string::npos : end + 1 - i);
+                    i = end == string::npos ? line.size() : end + 1;
+                }
+                else
+                    code += line[i++];
+            }
+
+            // excerpts are taken from comments on lines of their own, as before
+            if(collect && trimmed(code).empty())
+            {
+                for(const auto& comment : comments)
+                {
+                    if(comment.find("*/") == string::npos)
+                        m_source.comments.push_back(comment);
+                }
+            }
+
+            code = rtrimmed(code);
+            if(!code.empty() && code.back() == '\\')
+            {
+                pending += code.substr(0, code.size() - 1);
+                continue;
+            }
+            Line(pending + code, input, depth);
+            pending.clear();
+        }
+        if(!pending.empty())
+            Line(pending, input, depth);
+    }
+
+    void Finish(const filesystem::path& input)
+    {
+        for(const auto& stage : m_stages)
+        {
+            if(!stage.conditionals.empty())
+                throw runtime_error("Unterminated #if in " + input.string());
+        }
+    }
+
+private:
+    void Line(const string& code, const filesystem::path& input, int depth)
+    {
+        const auto text = trimmed(code);
+        if(text.empty())
+            return;
+
+        if(text[0] != '#')
+        {
+            for(auto& stage : m_stages)
+            {
+                if(stage.receiving && stage.Active())
+                    stage.output->push_back(code);
+            }
+            return;
+        }
+
+        const auto directive = trimmed(text.substr(1));
+        const auto name      = firstWord(directive);
+        const auto rest      = trimmed(directive.substr(name.size()));
+        if(name == "if" || name == "ifdef" || name == "ifndef" || name == "elif" || name == "else" || name == "endif")
+        {
+            // followed by every stage, so a #pragma stage inside a block doesn't leave the other unbalanced
+            for(auto& stage : m_stages)
+                Branch(stage, name, rest, text, input);
+            return;
+        }
+
+        // stages receiving lines together have gone through the same lines, so they agree on these
+        const bool active = any_of(begin(m_stages), end(m_stages), [](const StageState& s) { return s.receiving && s.Active(); });
+        if(!active)
+            return;
+
+        if(name == "include")
+        {
+            const auto open  = rest.find('\"');
+            const auto close = rest.find('\"', open + 1);
+            if(open == string::npos || close == string::npos)
+                throw runtime_error("Invalid #include in " + input.string());
+            Process((input.parent_path() / rest.substr(open + 1, close - open - 1)).lexically_normal(), depth + 1);
+            return;
+        }
+
+        if(name == "pragma")
+        {
+            const auto pragma = firstWord(rest);
+            if(pragma == "stage")
+            {
+                const auto stage = trimmed(rest.substr(pragma.size()));
+                if(stage != "vertex" && stage != "fragment")
+                    throw runtime_error("Unsupported shader stage " + stage + " in " + input.string());
+                m_stages[0].receiving = stage == "vertex";
+                m_stages[1].receiving = stage == "fragment";
+                return;
+            }
+            if(pragma == "parameter")
+            {
+                // repeated includes without guards declare the same parameters again
+                const auto line = "#pragma " + rest;
+                const auto id   = firstWord(trimmed(rest.substr(pragma.size())));
+                const auto dupe = find_if(m_source.parameters.begin(), m_source.parameters.end(), [&](const string& p) {
+                    return firstWord(trimmed(p.substr(strlen("#pragma parameter")))) == id;
+                });
+                if(dupe == m_source.parameters.end())
+                    m_source.parameters.push_back(line);
+                return;
+            }
+            if(pragma == "format")
+            {
+                m_source.format = "#pragma " + rest;
+                return;
+            }
+        }
+
+        for(auto& stage : m_stages)
+        {
+            if(!stage.receiving || !stage.Active())
+                continue;
+
+            if(name == "define" || name == "undef")
+            {
+                const auto macro = firstWord(rest);
+                stage.macros.erase(macro);
+                stage.unknown.erase(macro);
+                if(stage.InVerbatim() || (name == "define" && rest.size() > macro.size() && rest[macro.size()] == '('))
+                    stage.unknown.insert(macro);
+                else if(name == "define")
+                    stage.macros[macro] = trimmed(rest.substr(macro.size()));
+            }
+            stage.output->push_back(code);
+        }
+    }
+
+    static void Emit(StageState& stage, const string& line)
+    {
+        if(stage.receiving)
+            stage.output->push_back(line);
+    }
+
+    void Branch(StageState& stage, const string& name, const string& rest, const string& text, const filesystem::path& input)
+    {
+        if(name == "if" || name == "ifdef" || name == "ifndef")
+        {
+            Conditional conditional {stage.Active(), false, false, false};
+            if(conditional.parentActive)
+            {
+                const auto truth = name == "if" ? Expression(stage, rest).Evaluate()
+                                                : Expression(stage, (name == "ifndef" ? "!defined " : "defined ") + firstWord(rest)).Evaluate();
+                if(truth == Truth::Unknown)
+                {
+                    conditional.verbatim = true;
+                    conditional.active   = true;
+                    Emit(stage, text);
+                }
+                else
+                {
+                    conditional.active = truth == Truth::True;
+                    conditional.taken  = conditional.active;
+                }
+            }
+            stage.conditionals.push_back(conditional);
+            return;
+        }
+
+        if(stage.conditionals.empty())
+            throw runtime_error("#" + name + " without #if in " + input.string());
+
+        auto& conditional = stage.conditionals.back();
+        if(conditional.verbatim)
+        {
+            if(conditional.parentActive)
+                Emit(stage, text);
+        }
+        else if(name == "elif" && conditional.parentActive)
+        {
+            if(conditional.taken)
+            {
+                conditional.active = false;
+            }
+            else
+            {
+                const auto truth = Expression(stage, rest).Evaluate();
+                if(truth == Truth::Unknown)
+                {
+                    // earlier branches were all dropped, so this one starts the block for glslang
+                    conditional.verbatim = true;
+                    conditional.active   = true;
+                    Emit(stage, "#if " + rest);
+                }
+                else
+                {
+                    conditional.active = truth == Truth::True;
+                    conditional.taken  = conditional.active;
+                }
+            }
+        }
+        else if(name == "else")
+        {
+            conditional.active = conditional.parentActive && !conditional.taken;
+            conditional.taken  = true;
+        }
+
+        if(name == "endif")
+            stage.conditionals.pop_back();
+    }
+
+    SlangSource&          m_source;
+    StageState            m_stages[2]; // vertex, fragment
+    set<filesystem::path> m_commented; // files whose comments were collected
+};
+
+SlangSource preprocessSlang(const filesystem::path& input)
+{
+    SlangSource  source;
+    Preprocessor preprocessor(source);
+    preprocessor.Process(input, 0);
+    preprocessor.Finish(input);
+    return source;
+}
@@ -0,0 +1,27 @@
+/*
+ShaderGen: slangp shader converter for ShaderGlass
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+struct SlangSource
+{
+    std::vector<std::string> vertex;
+    std::vector<std::string> fragment;
+    std::vector<std::string> parameters; // #pragma parameter lines, first declaration of each name
+    std::string              format;     // #pragma format line, empty if there's none
+    std::vector<std::string> comments;   // whole-line comments, excerpts for generated headers
+    size_t                   inputLines {0}; // read from the shader and its includes
+};
+
+// splits a .slang into its stages as RetroArch does, with comments removed, includes expanded and
+// #if blocks resolved when they depend only on macros defined in the source; conditions involving
+// glslang's own macros are left for glslang, with both branches kept
+// throws std::runtime_error on missing includes and unbalanced conditionals
+SlangSource preprocessSlang(const std::filesystem::path& input);
@@ -0,0 +1,135 @@
+/*
+ShaderGen: slangp shader converter for ShaderGlass
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#include "TemplateEmitter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+static bool isPlaceholderChar(char c)
+{
+    return isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '*';
+}
+
+static const string_view* lookup(string_view name, const TemplateValues& values, const TemplateValues* outer)
+{
+    for(const auto& value : values)
+    {
+        if(value.first == name)
+            return &value.second;
+    }
+    if(outer)
+    {
+        for(const auto& value : *outer)
+        {
+            if(value.first == name)
+                return &value.second;
+        }
+    }
+    return nullptr;
+}
+
+Template::Template(const filesystem::path& path)
+{
+    ifstream infile(path);
+    if(!infile.good())
+        throw runtime_error("Unable to read " + path.string());
+    stringstream buffer;
+    buffer << infile.rdbuf();
+    const auto text = buffer.str();
+
+    // every line gets a line break, including the last one and an empty one after a final line break
+    size_t start = 0;
+    while(true)
+    {
+        const auto end = min(text.find('\n', start), text.size());
+
+        TemplateLine line;
+        string       literal;
+        for(size_t i = start; i < end; i++)
+        {
+            if(text[i] == '%')
+            {
+                size_t close = i + 1;
+                while(close < end && isPlaceholderChar(text[close]))
+                    close++;
+                if(close < end && close > i + 1 && text[close] == '%')
+                {
+                    if(!literal.empty())
+                        line.segments.push_back({std::move(literal), false});
+                    literal.clear();
+                    line.segments.push_back({text.substr(i + 1, close - i - 1), true});
+                    i = close;
+                    continue;
+                }
+            }
+            literal += text[i];
+        }
+        if(!literal.empty())
+            line.segments.push_back({std::move(literal), false});
+        m_lines.push_back(std::move(line));
+
+        if(end == text.size())
+            break;
+        start = end + 1;
+    }
+}
+
+bool Template::Uses(string_view name) const
+{
+    for(const auto& line : m_lines)
+    {
+        for(const auto& segment : line.segments)
+        {
+            if(segment.placeholder && segment.text == name)
+                return true;
+        }
+    }
+    return false;
+}
+
+size_t Template::Size(const TemplateValues& values) const
+{
+    size_t size = 0;
+    for(const auto& line : m_lines)
+    {
+        for(const auto& segment : line.segments)
+        {
+            const auto value = segment.placeholder ? lookup(segment.text, values, nullptr) : nullptr;
+            size += value ? value->size() : segment.text.size() + (segment.placeholder ? 2 : 0);
+        }
+        size++;
+    }
+    return size;
+}
+
+void Template::Render(const TemplateLine& line, string& output, const TemplateValues& values, const TemplateValues* outer)
+{
+    for(const auto& segment : line.segments)
+    {
+        if(!segment.placeholder)
+        {
+            output += segment.text;
+            continue;
+        }
+
+        const auto value = lookup(segment.text, values, outer);
+        if(value)
+            output += *value;
+        else
+        {
+            output += '%';
+            output += segment.text;
+            output += '%';
+        }
+    }
+    output += '\n';
+}
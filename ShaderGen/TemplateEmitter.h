@@ -0,0 +1,50 @@
+/*
+ShaderGen: slangp shader converter for ShaderGlass
+https://github.com/mausimus/ShaderGlass
+GNU General Public License v3.0
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// placeholder names without the %s and their values
+using TemplateValues = std::vector<std::pair<std::string_view, std::string_view>>;
+
+struct TemplateSegment
+{
+    std::string text; // literal text, or placeholder name
+    bool        placeholder {false};
+};
+
+struct TemplateLine
+{
+    std::vector<TemplateSegment> segments;
+
+    // placeholder the line starts with, marks lines the caller repeats or replaces (%PARAM%, %HEADER% etc.)
+    std::string_view Marker() const { return !segments.empty() && segments.front().placeholder ? std::string_view(segments.front().text) : std::string_view(); }
+};
+
+// .template file split once into lines of literal text and %NAME% placeholders, rendered by appending to a buffer;
+// placeholders without a value are kept as they are, e.g. the disabled %*VERTEX_SOURCE*%
+class Template
+{
+public:
+    explicit Template(const std::filesystem::path& path);
+
+    const std::vector<TemplateLine>& Lines() const { return m_lines; }
+    bool                             Uses(std::string_view name) const;
+
+    // every line rendered once, to reserve the output buffer
+    size_t Size(const TemplateValues& values) const;
+
+    // appends the line and its line break, values are looked up before outer ones
+    static void Render(const TemplateLine& line, std::string& output, const TemplateValues& values, const TemplateValues* outer = nullptr);
+
+private:
+    std::vector<TemplateLine> m_lines;
+};
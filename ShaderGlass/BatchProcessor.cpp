@@ -0,0 +1,367 @@
+#include "pch.h"
+
+#include "BatchProcessor.h"
+#include "D3D11Backend.h"
+#include "ShaderList.h"
+#include "Util/d3dHelpers.h"
+#include <chrono>
+#include <thread>
+
+std::string BatchProcessor::ToUtf8(const std::wstring& ws)
+{
+    if(ws.empty())
+        return std::string();
+    const int size = WideCharToMultiByte(CP_UTF8, 0, ws.c_str(), static_cast<int>(ws.size()), nullptr, 0, nullptr, nullptr);
+    std::string s(size, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, ws.c_str(), static_cast<int>(ws.size()), s.data(), size, nullptr, nullptr);
+    return s;
+}
+
+void BatchQueue::Push(std::unique_ptr<BatchImage> image)
+{
+    std::unique_lock lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_images.size() < m_capacity; });
+    m_images.push_back(std::move(image));
+    m_condition.notify_all();
+}
+
+bool BatchQueue::Pop(std::unique_ptr<BatchImage>& image)
+{
+    std::unique_lock lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_closed || !m_images.empty(); });
+    if(m_images.empty())
+        return false;
+
+    image = std::move(m_images.front());
+    m_images.pop_front();
+    m_condition.notify_all();
+    return true;
+}
+
+void BatchQueue::Close()
+{
+    std::unique_lock lock(m_mutex);
+    m_closed = true;
+    m_condition.notify_all();
+}
+
+BatchProcessor::BatchProcessor(const BatchOptions& options) : m_options {options} { }
+
+bool BatchProcessor::ParseArgs(int numArgs, LPWSTR* args, BatchOptions& options)
+{
+    bool batch = false;
+    for(int a = 1; a < numArgs; a++)
+    {
+        const bool hasValue = a + 1 < numArgs;
+        if(wcscmp(args[a], L"-batch") == 0)
+            batch = true;
+        else if(wcscmp(args[a], L"-preset") == 0 && hasValue)
+            options.presetName = ToUtf8(args[++a]);
+        else if(wcscmp(args[a], L"-category") == 0 && hasValue)
+            options.category = ToUtf8(args[++a]);
+        else if(wcscmp(args[a], L"-input") == 0 && hasValue)
+            options.input = args[++a];
+        else if(wcscmp(args[a], L"-output") == 0 && hasValue)
+            options.output = args[++a];
+        else if(wcscmp(args[a], L"-pixel") == 0 && hasValue)
+            options.pixelSize = max(1.0f, static_cast<float>(_wtof(args[++a])));
+        else if(wcscmp(args[a], L"-scale") == 0 && hasValue)
+            options.outputScale = max(0.01f, static_cast<float>(_wtof(args[++a])));
+        else if(wcscmp(args[a], L"-threads") == 0 && hasValue)
+            options.threads = static_cast<unsigned>(_wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-group") == 0 && hasValue)
+            options.group = max(1, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-param") == 0 && hasValue)
+        {
+            // name=value
+            const auto param = ToUtf8(args[++a]);
+            const auto eq    = param.find('=');
+            if(eq != std::string::npos)
+                options.params.push_back(std::make_pair(param.substr(0, eq), static_cast<float>(atof(param.c_str() + eq + 1))));
+        }
+    }
+    return batch;
+}
+
+bool BatchProcessor::Decode(IWICImagingFactory* factory, BatchImage& image)
+{
+    winrt::com_ptr<IWICBitmapDecoder>     decoder;
+    winrt::com_ptr<IWICBitmapFrameDecode> frame;
+    winrt::com_ptr<IWICFormatConverter>   converter;
+    if(factory && SUCCEEDED(factory->CreateDecoderFromFilename(image.inputPath.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, decoder.put())) &&
+       SUCCEEDED(decoder->GetFrame(0, frame.put())) && SUCCEEDED(factory->CreateFormatConverter(converter.put())) &&
+       SUCCEEDED(converter->Initialize(frame.get(), GUID_WICPixelFormat32bppBGRA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom)) &&
+       SUCCEEDED(converter->GetSize(&image.width, &image.height)) && image.width > 0 && image.height > 0)
+    {
+        image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+        if(FAILED(converter->CopyPixels(nullptr, image.width * 4, static_cast<UINT>(image.pixels.size()), image.pixels.data())))
+            image.pixels.clear();
+    }
+    return !image.pixels.empty();
+}
+
+bool BatchProcessor::Encode(IWICImagingFactory* factory, const BatchImage& image)
+{
+    // 24-bit like screenshots saved from the UI
+    winrt::com_ptr<IWICStream>            stream;
+    winrt::com_ptr<IWICBitmapEncoder>     encoder;
+    winrt::com_ptr<IWICBitmapFrameEncode> frame;
+    winrt::com_ptr<IWICBitmap>            bitmap;
+    WICPixelFormatGUID                    format = GUID_WICPixelFormat24bppBGR;
+    const auto                            stride = image.width * 4;
+    return factory && SUCCEEDED(factory->CreateStream(stream.put())) && SUCCEEDED(stream->InitializeFromFilename(image.outputPath.c_str(), GENERIC_WRITE)) &&
+           SUCCEEDED(factory->CreateEncoder(GUID_ContainerFormatPng, nullptr, encoder.put())) && SUCCEEDED(encoder->Initialize(stream.get(), WICBitmapEncoderNoCache)) &&
+           SUCCEEDED(encoder->CreateNewFrame(frame.put(), nullptr)) && SUCCEEDED(frame->Initialize(nullptr)) && SUCCEEDED(frame->SetSize(image.width, image.height)) &&
+           SUCCEEDED(frame->SetPixelFormat(&format)) &&
+           SUCCEEDED(factory->CreateBitmapFromMemory(
+               image.width, image.height, GUID_WICPixelFormat32bppBGRA, stride, static_cast<UINT>(image.pixels.size()), const_cast<BYTE*>(image.pixels.data()), bitmap.put())) &&
+           SUCCEEDED(frame->WriteSource(bitmap.get(), nullptr)) && SUCCEEDED(frame->Commit()) && SUCCEEDED(encoder->Commit());
+}
+
+void BatchProcessor::DecodeThreadFunc(const std::vector<std::wstring>& files, std::atomic<size_t>& next, BatchQueue& decoded)
+{
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    winrt::com_ptr<IWICImagingFactory> factory;
+    CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.put()));
+
+    for(size_t i = next++; i < files.size(); i = next++)
+    {
+        auto image       = std::make_unique<BatchImage>();
+        image->index     = i;
+        image->inputPath = files[i];
+
+        const auto fileName = files[i].substr(files[i].find_last_of(L"\\/") + 1);
+        image->outputPath   = fileName.substr(0, fileName.find_last_of(L'.')) + L".png";
+
+        Decode(factory.get(), *image);
+
+        // failures are passed on too, to keep the render order going
+        decoded.Push(std::move(image));
+    }
+
+    factory = nullptr;
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+}
+
+void BatchProcessor::EncodeThreadFunc(BatchQueue& rendered)
+{
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    winrt::com_ptr<IWICImagingFactory> factory;
+    CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.put()));
+
+    std::unique_ptr<BatchImage> image;
+    while(rendered.Pop(image))
+    {
+        if(Encode(factory.get(), *image))
+        {
+            m_written++;
+        }
+        else
+        {
+            m_failed++;
+            wprintf(L"Unable to write %s\n", image->outputPath.c_str());
+        }
+    }
+
+    factory = nullptr;
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+}
+
+void BatchProcessor::ProcessPresets(const std::vector<PresetDef*>& presets, const std::vector<std::wstring>& files, const std::vector<std::wstring>& outputDirs)
+{
+    // one decode and preprocess per image for all presets of the group
+    ChainGroup group(m_backend);
+    for(auto presetDef : presets)
+    {
+        const auto chain = group.AddChain(*presetDef);
+        for(const auto& param : m_options.params)
+        {
+            if(!group.SetParam(chain, param.first, param.second))
+                printf("%s: no parameter %s\n", presetDef->Name, param.first.c_str());
+        }
+    }
+
+    const unsigned threads = m_options.threads ? m_options.threads : max(1U, std::thread::hardware_concurrency() / 2);
+    BatchQueue     decoded(threads * 2);
+    BatchQueue     rendered(threads * 2 * presets.size());
+
+    std::atomic<size_t>      next {0};
+    std::vector<std::thread> decoders;
+    std::vector<std::thread> encoders;
+    for(unsigned t = 0; t < threads; t++)
+    {
+        decoders.emplace_back(&BatchProcessor::DecodeThreadFunc, this, std::cref(files), std::ref(next), std::ref(decoded));
+        encoders.emplace_back(&BatchProcessor::EncodeThreadFunc, this, std::ref(rendered));
+    }
+    std::thread closer([&] {
+        for(auto& d : decoders)
+            d.join();
+        decoded.Close();
+    });
+
+    // rendering stays on this thread as the D3D11 immediate context is not thread-safe;
+    // images are consecutive frames so feedback and history presets see the previous image
+    std::map<size_t, std::unique_ptr<BatchImage>> pending;
+    std::unique_ptr<BatchImage>                   image;
+    std::shared_ptr<RenderTexture>                input;
+    size_t                                        expected = 0;
+    while(decoded.Pop(image))
+    {
+        pending[image->index] = std::move(image);
+        for(auto it = pending.find(expected); it != pending.end(); it = pending.find(++expected))
+        {
+            auto ready = std::move(it->second);
+            pending.erase(it);
+            if(ready->pixels.empty())
+            {
+                m_failed += static_cast<int>(presets.size());
+                wprintf(L"Unable to read %s\n", ready->inputPath.c_str());
+                continue;
+            }
+
+            if(!input || input->width != ready->width || input->height != ready->height)
+            {
+                input = m_backend->CreateTexture({ready->width, ready->height, TextureFormat::BGRA8, false});
+                const uint32_t originalWidth  = max(1U, static_cast<uint32_t>(ready->width / m_options.pixelSize));
+                const uint32_t originalHeight = max(1U, static_cast<uint32_t>(ready->height / m_options.pixelSize));
+                const uint32_t outputWidth    = max(1U, static_cast<uint32_t>(ready->width * m_options.outputScale));
+                const uint32_t outputHeight   = max(1U, static_cast<uint32_t>(ready->height * m_options.outputScale));
+                group.Resize(ready->width, ready->height, originalWidth, originalHeight, outputWidth, outputHeight, TextureFormat::BGRA8);
+            }
+
+            m_backend->Upload(*input, ready->pixels.data(), ready->width * 4);
+            group.Render(input.get());
+            for(size_t c = 0; c < presets.size(); c++)
+            {
+                auto output = group.Output(c);
+                if(output == nullptr)
+                {
+                    m_failed++;
+                    continue;
+                }
+
+                auto result        = std::make_unique<BatchImage>();
+                result->index      = ready->index;
+                result->inputPath  = ready->inputPath;
+                result->outputPath = outputDirs[c] + L"\\" + ready->outputPath;
+                result->width      = output->width;
+                result->height     = output->height;
+                result->pixels.resize(static_cast<size_t>(output->width) * output->height * 4);
+                m_backend->Download(*output, result->pixels.data(), output->width * 4);
+                rendered.Push(std::move(result));
+            }
+        }
+    }
+
+    closer.join();
+    rendered.Close();
+    for(auto& e : encoders)
+        e.join();
+
+    if(group.RenderedPasses() < group.Passes())
+        printf("%zu of %zu passes shared between presets\n", group.Passes() - group.RenderedPasses(), group.Passes());
+}
+
+int BatchProcessor::Run()
+{
+    // report to the console we were started from, if any
+    if(AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* f;
+        freopen_s(&f, "CONOUT$", "w", stdout);
+    }
+
+    if(m_options.input.empty() || m_options.output.empty() || (m_options.presetName.empty() && m_options.category.empty()))
+    {
+        printf("Usage: ShaderGlass -batch -preset <name> | -category <category> -input <pattern> -output <directory>\n"
+               "       [-param <name>=<value>]... [-pixel <size>] [-scale <output scale>] [-threads <n>] [-group <n>]\n");
+        return 1;
+    }
+
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    // inputs
+    std::vector<std::wstring> files;
+    const auto                separator = m_options.input.find_last_of(L"\\/");
+    const auto                inputDir  = separator == std::wstring::npos ? std::wstring(L".") : m_options.input.substr(0, separator);
+    WIN32_FIND_DATAW          findData;
+    HANDLE                    find = FindFirstFileW(m_options.input.c_str(), &findData);
+    if(find != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            if(!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+                files.push_back(inputDir + L"\\" + findData.cFileName);
+        } while(FindNextFileW(find, &findData));
+        FindClose(find);
+    }
+    std::sort(files.begin(), files.end());
+
+    // presets
+    static PassthroughPresetDef passthroughDef;
+    std::vector<PresetDef*>     presets;
+    std::vector<PresetDef*>     candidates(RetroArchPresetList.begin(), RetroArchPresetList.end());
+    candidates.push_back(&passthroughDef);
+    for(auto presetDef : candidates)
+    {
+        const std::string category = presetDef->Category ? presetDef->Category : "";
+        const std::string fullName = category + "/" + presetDef->Name;
+        const bool        matches  = m_options.category.empty() ? m_options.presetName == presetDef->Name || m_options.presetName == fullName :
+                                                                  category == m_options.category || category.starts_with(m_options.category + "/");
+        if(!matches)
+            continue;
+        presets.push_back(presetDef);
+    }
+
+    if(files.empty() || presets.empty())
+    {
+        printf(files.empty() ? "No input images found\n" : "No matching preset found\n");
+        if(SUCCEEDED(comInit))
+            CoUninitialize();
+        return 1;
+    }
+
+    winrt::com_ptr<ID3D11DeviceContext> context;
+    auto                                device = util::uwp::CreateD3DDevice();
+    device->GetImmediateContext(context.put());
+    m_backend = std::make_shared<D3D11Backend>(device, context);
+
+    CreateDirectoryW(m_options.output.c_str(), nullptr);
+    const auto start = std::chrono::steady_clock::now();
+    for(size_t first = 0; first < presets.size(); first += m_options.group)
+    {
+        std::vector<PresetDef*>   group(presets.begin() + first, presets.begin() + min(presets.size(), first + m_options.group));
+        std::vector<std::wstring> outputDirs;
+        std::string               names;
+        for(auto presetDef : group)
+        {
+            // one subdirectory per preset when processing a category
+            auto outputDir = m_options.output;
+            if(!m_options.category.empty())
+            {
+                outputDir += L"\\" + std::wstring(presetDef->Name, presetDef->Name + strlen(presetDef->Name));
+                CreateDirectoryW(outputDir.c_str(), nullptr);
+            }
+            outputDirs.push_back(outputDir);
+            names += (names.empty() ? "" : ", ") + std::string(presetDef->Name);
+        }
+
+        const auto groupStart = std::chrono::steady_clock::now();
+        const auto written    = m_written.load();
+        ProcessPresets(group, files, outputDirs);
+        const auto seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - groupStart).count();
+        printf("%s: %d images in %.2f s, %.1f images/s\n", names.c_str(), m_written - written, seconds, (m_written - written) / max(seconds, 0.001f));
+    }
+    const auto seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    printf("%d images written, %d failed, %.2f s, %.1f images/s\n", m_written.load(), m_failed.load(), seconds, m_written / max(seconds, 0.001f));
+
+    m_backend = nullptr;
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+
+    return m_failed ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ChainGroup.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <wincodec.h>
+
+struct BatchOptions
+{
+    std::string                                presetName {};   // name or category/name
+    std::string                                category {};     // every preset of a category instead
+    std::wstring                               input {};        // file pattern, wildcards in the file name only
+    std::wstring                               output {};       // directory
+    std::vector<std::pair<std::string, float>> params;
+    float                                      pixelSize {1.0f};   // input pixels per original pixel
+    float                                      outputScale {1.0f}; // output size relative to input
+    unsigned                                   threads {0};        // decode and encode threads each, 0 for half the cores
+    unsigned                                   group {4};          // presets rendered from one decode and preprocess
+};
+
+struct BatchImage
+{
+    size_t               index {0}; // position in the input list, images render in this order
+    std::wstring         inputPath;
+    std::wstring         outputPath; // file name only until rendered
+    uint32_t             width {0};
+    uint32_t             height {0};
+    std::vector<uint8_t> pixels; // BGRA8, empty if decoding failed
+};
+
+// bounded hand-over between pipeline stages
+class BatchQueue
+{
+public:
+    BatchQueue(size_t capacity) : m_capacity {capacity} { }
+
+    void Push(std::unique_ptr<BatchImage> image);
+    bool Pop(std::unique_ptr<BatchImage>& image); // false once closed and drained
+    void Close();
+
+private:
+    std::mutex                              m_mutex {};
+    std::condition_variable                 m_condition;
+    std::deque<std::unique_ptr<BatchImage>> m_images;
+    size_t                                  m_capacity;
+    bool                                    m_closed {false};
+};
+
+// headless "-batch" mode: applies presets to a set of images, decoding and encoding in parallel to rendering
+class BatchProcessor
+{
+public:
+    BatchProcessor(const BatchOptions& options);
+
+    static bool ParseArgs(int numArgs, LPWSTR* args, BatchOptions& options);
+    int         Run();
+
+    // reads image->inputPath into BGRA8 pixels, leaving them empty on failure
+    static bool        Decode(IWICImagingFactory* factory, BatchImage& image);
+    // writes image.pixels to image.outputPath as 24-bit PNG
+    static bool        Encode(IWICImagingFactory* factory, const BatchImage& image);
+    static std::string ToUtf8(const std::wstring& ws);
+
+private:
+    void ProcessPresets(const std::vector<PresetDef*>& presets, const std::vector<std::wstring>& files, const std::vector<std::wstring>& outputDirs);
+    void DecodeThreadFunc(const std::vector<std::wstring>& files, std::atomic<size_t>& next, BatchQueue& decoded);
+    void EncodeThreadFunc(BatchQueue& rendered);
+
+    BatchOptions                   m_options;
+    std::shared_ptr<RenderBackend> m_backend {nullptr};
+    std::atomic<int>               m_failed {0};
+    std::atomic<int>               m_written {0};
+};
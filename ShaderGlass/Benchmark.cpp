@@ -0,0 +1,279 @@
+#include "pch.h"
+
+#include "Benchmark.h"
+#include "BatchProcessor.h"
+#include "D3D11Backend.h"
+#include "RecordingBackend.h"
+#include "ShaderList.h"
+#include "Util/d3dHelpers.h"
+#include <chrono>
+
+// nearest-rank percentile of sorted samples
+static float percentile(const std::vector<float>& sorted, float p)
+{
+    auto rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+    if(rank < 1)
+        rank = 1;
+    if(rank > sorted.size())
+        rank = sorted.size();
+    return sorted[rank - 1];
+}
+
+static std::string jsonString(const std::string& s)
+{
+    std::string escaped = "\"";
+    for(auto c : s)
+    {
+        if(c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+Benchmark::Benchmark(const BenchmarkOptions& options) : m_options {options} { }
+
+bool Benchmark::ParseArgs(int numArgs, LPWSTR* args, BenchmarkOptions& options)
+{
+    bool benchmark = false;
+    for(int a = 1; a < numArgs; a++)
+    {
+        const bool hasValue = a + 1 < numArgs;
+        if(wcscmp(args[a], L"-benchmark") == 0)
+            benchmark = true;
+        else if(wcscmp(args[a], L"-filter") == 0 && hasValue)
+            options.filter = BatchProcessor::ToUtf8(args[++a]);
+        else if(wcscmp(args[a], L"-input") == 0 && hasValue)
+            options.input = args[++a];
+        else if(wcscmp(args[a], L"-json") == 0 && hasValue)
+            options.output = args[++a];
+        else if(wcscmp(args[a], L"-frames") == 0 && hasValue)
+            options.frames = max(1, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-warmup") == 0 && hasValue)
+            options.warmup = max(0, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-pixel") == 0 && hasValue)
+        {
+            // comma-separated list, e.g. 1,2,4
+            options.pixelSizes.clear();
+            std::wstringstream list(args[++a]);
+            std::wstring       item;
+            while(std::getline(list, item, L','))
+                options.pixelSizes.push_back(max(1.0f, static_cast<float>(_wtof(item.c_str()))));
+        }
+        else if(wcscmp(args[a], L"-resolution") == 0 && hasValue)
+        {
+            // comma-separated list, e.g. 1920x1080,3840x2160
+            options.resolutions.clear();
+            std::wstringstream list(args[++a]);
+            std::wstring       item;
+            while(std::getline(list, item, L','))
+            {
+                const auto x = item.find(L'x');
+                if(x != std::wstring::npos)
+                {
+                    const auto width  = _wtoi(item.substr(0, x).c_str());
+                    const auto height = _wtoi(item.substr(x + 1).c_str());
+                    if(width > 0 && height > 0)
+                        options.resolutions.push_back(std::make_pair(static_cast<uint32_t>(width), static_cast<uint32_t>(height)));
+                }
+            }
+        }
+    }
+    return benchmark;
+}
+
+void Benchmark::RunPreset(PresetDef& presetDef, const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height)
+{
+    const std::string fullName = std::string(presetDef.Category ? presetDef.Category : "") + "/" + presetDef.Name;
+
+    auto input = m_backend->CreateTexture({width, height, TextureFormat::BGRA8, false});
+    m_backend->Upload(*input, pixels.data(), width * 4);
+
+    for(auto pixelSize : m_options.pixelSizes)
+    {
+        const uint32_t originalWidth  = max(1U, static_cast<uint32_t>(width / pixelSize));
+        const uint32_t originalHeight = max(1U, static_cast<uint32_t>(height / pixelSize));
+        for(const auto& resolution : m_options.resolutions)
+        {
+            BenchmarkResult result;
+            result.preset       = fullName;
+            result.pixelSize    = pixelSize;
+            result.outputWidth  = resolution.first;
+            result.outputHeight = resolution.second;
+
+            // what a frame asks of the backend, independent of the device
+            {
+                auto          recording = std::make_shared<RecordingBackend>();
+                HeadlessChain chain(recording, presetDef);
+                auto          recordingInput = recording->CreateTexture({width, height, TextureFormat::BGRA8, false});
+                chain.Resize(width, height, originalWidth, originalHeight, resolution.first, resolution.second, TextureFormat::BGRA8);
+                chain.Render(recordingInput.get(), 1);
+                recording->Reset();
+                chain.Render(recordingInput.get(), 2);
+                const auto stats     = recording->Stats();
+                result.draws         = stats.draws;
+                result.uploadedBytes = stats.bytesMapped;
+                result.copiedBytes   = stats.bytesCopied;
+            }
+
+            // fresh chain per case so every case sees the same frame counts
+            const auto    buildStart = std::chrono::steady_clock::now();
+            HeadlessChain chain(m_backend, presetDef);
+            chain.Resize(width, height, originalWidth, originalHeight, resolution.first, resolution.second, TextureFormat::BGRA8);
+            m_backend->Finish();
+            result.buildMs            = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+            result.passes             = chain.Passes();
+            result.textureBytes       = chain.TextureBytes();
+            result.presetTextureBytes = chain.PresetTextureBytes();
+
+            int frameCount = 1;
+            for(unsigned f = 0; f < m_options.warmup; f++)
+                chain.Render(input.get(), frameCount++);
+            m_backend->Finish();
+
+            std::vector<float> times;
+            times.reserve(m_options.frames);
+            for(unsigned f = 0; f < m_options.frames; f++)
+            {
+                const auto frameStart = std::chrono::steady_clock::now();
+                chain.Render(input.get(), frameCount++);
+                m_backend->Finish();
+                times.push_back(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+            }
+
+            double total = 0;
+            for(auto t : times)
+                total += t;
+            std::sort(times.begin(), times.end());
+            result.meanMs = static_cast<float>(total / times.size());
+            result.p50Ms  = percentile(times, 0.50f);
+            result.p95Ms  = percentile(times, 0.95f);
+            result.p99Ms  = percentile(times, 0.99f);
+            result.maxMs  = times.back();
+
+            printf("%s x%.0f %ux%u: %zu passes, mean %.3f ms, p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, %.1f MB\n",
+                   fullName.c_str(),
+                   pixelSize,
+                   resolution.first,
+                   resolution.second,
+                   result.passes,
+                   result.meanMs,
+                   result.p50Ms,
+                   result.p95Ms,
+                   result.p99Ms,
+                   result.textureBytes / (1024.0f * 1024.0f));
+            m_results.push_back(result);
+        }
+    }
+}
+
+bool Benchmark::WriteJson() const
+{
+    std::ofstream json(m_options.output, std::ios::out | std::ios::trunc);
+    if(!json.good())
+        return false;
+
+    json << std::fixed << std::setprecision(4);
+    json << "{\n";
+    json << "  \"adapter\": " << jsonString(m_adapter) << ",\n";
+    json << "  \"input\": " << jsonString(BatchProcessor::ToUtf8(m_options.input)) << ",\n";
+    json << "  \"frames\": " << m_options.frames << ",\n";
+    json << "  \"warmup\": " << m_options.warmup << ",\n";
+    json << "  \"results\": [";
+    for(size_t r = 0; r < m_results.size(); r++)
+    {
+        const auto& result = m_results[r];
+        json << (r ? ",\n" : "\n") << "    {";
+        json << "\"preset\": " << jsonString(result.preset);
+        json << ", \"pixelSize\": " << result.pixelSize;
+        json << ", \"outputWidth\": " << result.outputWidth;
+        json << ", \"outputHeight\": " << result.outputHeight;
+        json << ", \"passes\": " << result.passes;
+        json << ", \"buildMs\": " << result.buildMs;
+        json << ", \"meanMs\": " << result.meanMs;
+        json << ", \"p50Ms\": " << result.p50Ms;
+        json << ", \"p95Ms\": " << result.p95Ms;
+        json << ", \"p99Ms\": " << result.p99Ms;
+        json << ", \"maxMs\": " << result.maxMs;
+        json << ", \"textureBytes\": " << result.textureBytes;
+        json << ", \"presetTextureBytes\": " << result.presetTextureBytes;
+        json << ", \"draws\": " << result.draws;
+        json << ", \"uploadedBytes\": " << result.uploadedBytes;
+        json << ", \"copiedBytes\": " << result.copiedBytes;
+        json << "}";
+    }
+    json << "\n  ]\n}\n";
+    return json.good();
+}
+
+int Benchmark::Run()
+{
+    // report to the console we were started from, if any
+    if(AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* f;
+        freopen_s(&f, "CONOUT$", "w", stdout);
+    }
+
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    BatchImage image;
+    image.inputPath = m_options.input;
+    {
+        winrt::com_ptr<IWICImagingFactory> factory;
+        CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.put()));
+        BatchProcessor::Decode(factory.get(), image);
+    }
+
+    // bundled presets in list order, so runs are comparable
+    static PassthroughPresetDef passthroughDef;
+    std::vector<PresetDef*>     presets;
+    std::vector<PresetDef*>     candidates(RetroArchPresetList.begin(), RetroArchPresetList.end());
+    candidates.push_back(&passthroughDef);
+    for(auto presetDef : candidates)
+    {
+        const std::string fullName = std::string(presetDef->Category ? presetDef->Category : "") + "/" + presetDef->Name;
+        if(!m_options.filter.empty() && fullName.find(m_options.filter) == std::string::npos)
+            continue;
+        presets.push_back(presetDef);
+    }
+
+    if(image.pixels.empty() || presets.empty() || m_options.pixelSizes.empty() || m_options.resolutions.empty())
+    {
+        if(image.pixels.empty())
+            wprintf(L"Unable to read %s\n", m_options.input.c_str());
+        printf("Usage: ShaderGlass -benchmark [-filter <text>] [-input <image>] [-json <file>] [-frames <n>] [-warmup <n>]\n"
+               "       [-pixel <size>[,<size>]...] [-resolution <width>x<height>[,...]]\n");
+        if(SUCCEEDED(comInit))
+            CoUninitialize();
+        return 1;
+    }
+
+    winrt::com_ptr<ID3D11DeviceContext> context;
+    auto                                device = util::uwp::CreateD3DDevice();
+    device->GetImmediateContext(context.put());
+    m_backend = std::make_shared<D3D11Backend>(device, context);
+
+    winrt::com_ptr<IDXGIAdapter> adapter;
+    DXGI_ADAPTER_DESC            adapterDesc;
+    if(SUCCEEDED(device.as<IDXGIDevice>()->GetAdapter(adapter.put())) && SUCCEEDED(adapter->GetDesc(&adapterDesc)))
+        m_adapter = BatchProcessor::ToUtf8(adapterDesc.Description);
+
+    const auto start = std::chrono::steady_clock::now();
+    for(auto presetDef : presets)
+    {
+        RunPreset(*presetDef, image.pixels, image.width, image.height);
+    }
+    const auto seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    printf("%zu presets, %zu cases in %.1f s\n", presets.size(), m_results.size(), seconds);
+
+    const auto written = WriteJson();
+    if(!written)
+        wprintf(L"Unable to write %s\n", m_options.output.c_str());
+
+    m_backend = nullptr;
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+
+    return written ? 0 : 1;
+}
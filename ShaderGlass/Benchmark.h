@@ -0,0 +1,53 @@
+#pragma once
+
+#include "HeadlessChain.h"
+
+struct BenchmarkOptions
+{
+    std::string                                filter {};                           // substring of category/name, empty for every preset
+    std::wstring                               input {L"Misc\\Test Pattern.png"};  // fixed input image
+    std::wstring                               output {L"benchmark.json"};
+    std::vector<float>                         pixelSizes {1.0f, 2.0f, 4.0f};       // input pixels per original pixel
+    std::vector<std::pair<uint32_t, uint32_t>> resolutions {{1920, 1080}, {3840, 2160}};
+    unsigned                                   frames {100};
+    unsigned                                   warmup {10};
+};
+
+struct BenchmarkResult
+{
+    std::string preset;
+    float       pixelSize {1.0f};
+    uint32_t    outputWidth {0};
+    uint32_t    outputHeight {0};
+    size_t      passes {0};
+    float       buildMs {0};
+    float       meanMs {0};
+    float       p50Ms {0};
+    float       p95Ms {0};
+    float       p99Ms {0};
+    float       maxMs {0};
+    size_t      textureBytes {0};       // intermediate targets incl. original, history and feedback
+    size_t      presetTextureBytes {0}; // static textures loaded by the preset
+    uint64_t    draws {0};              // per frame
+    uint64_t    uploadedBytes {0};      // per frame, constant buffer updates
+    uint64_t    copiedBytes {0};        // per frame, feedback and history copies
+};
+
+// headless "-benchmark" mode: renders presets for a fixed number of frames over a fixed input and reports frame time statistics as JSON
+class Benchmark
+{
+public:
+    Benchmark(const BenchmarkOptions& options);
+
+    static bool ParseArgs(int numArgs, LPWSTR* args, BenchmarkOptions& options);
+    int         Run();
+
+private:
+    void RunPreset(PresetDef& presetDef, const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height);
+    bool WriteJson() const;
+
+    BenchmarkOptions               m_options;
+    std::shared_ptr<RenderBackend> m_backend {nullptr};
+    std::string                    m_adapter {};
+    std::vector<BenchmarkResult>   m_results;
+};
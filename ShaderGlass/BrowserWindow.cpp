@@ -156,7 +156,7 @@ HTREEITEM BrowserWindow::AddItemToTree(HWND hwndTV, LPTSTR lpszItem, LPARAM lPar
     // data area.
     tvi.lParam         = lParam; //(LPARAM)nLevel;
     tvins.item         = tvi;
-    tvins.hInsertAfter = hPrev;
+    tvins.hInsertAfter = TVI_LAST; // in order, also when the tree is rebuilt
 
     // Set the parent item based on the specified level.
     if(nLevel == 1)
@@ -247,7 +247,7 @@ void BrowserWindow::Build()
         menu.push_back(std::make_pair(sp->Name, WM_SHADER(i++)));
     }
 
-    AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR("Favorites"), -1, 1);
+    AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR("Favorites"), NextFolder(), 1);
 
     for(int fp = 0; fp < sizeof(favoritePresets) / sizeof(const char*); fp++)
     {
@@ -258,7 +258,7 @@ void BrowserWindow::Build()
         }
     }
 
-    auto raItem = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR("RetroArch Library"), -1, 1);
+    auto raItem = AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR("RetroArch Library"), NextFolder(), 1);
 
     std::string parentCategory("");
     int level = 2;
@@ -273,10 +273,10 @@ void BrowserWindow::Build()
             {
                 // add new parent
                 parentCategory = thisParent;
-                AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(parentCategory.c_str()), -1, 2);
+                AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(parentCategory.c_str()), NextFolder(), 2);
             }
             level = 3;
-            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.substr(slash + 1).c_str()), -1, level);
+            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.substr(slash + 1).c_str()), NextFolder(), level);
         }
         else if(m.first == parentCategory)
         {
@@ -291,7 +291,7 @@ void BrowserWindow::Build()
                 parentCategory = "";
             }
             level = 2;
-            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.c_str()), -1, level);
+            AddItemToTree(m_treeControl, convertCharArrayToLPCWSTR(m.first.c_str()), NextFolder(), level);
         }
         for(auto p : m.second)
         {
@@ -324,6 +324,114 @@ void BrowserWindow::Build()
     Resize();
 }
 
+void BrowserWindow::UpdateCosts()
+{
+    const auto& presets = m_captureManager.Presets();
+    for(size_t i = 0; i < presets.size(); i++)
+    {
+        const auto   id   = WM_SHADER(static_cast<UINT>(i));
+        auto         name = convertCharArrayToLPCWSTR(presets[i]->Name);
+        std::wstring text(name);
+        delete[] name;
+
+        if(m_showCost || m_sortByCost)
+        {
+            const auto cost = m_captureManager.EstimateCost(static_cast<unsigned>(i));
+            m_costs[id]     = cost.ops;
+            if(m_showCost)
+            {
+                auto description = convertCharArrayToLPCWSTR(cost.Describe().c_str());
+                text += L"  (" + std::wstring(description) + L")";
+                delete[] description;
+            }
+        }
+
+        TVITEM tvi;
+        tvi.mask    = TVIF_TEXT;
+        tvi.pszText = text.data();
+        for(auto items : {&m_items, &m_favorites})
+        {
+            auto item = items->find(id);
+            if(item != items->end())
+            {
+                tvi.hItem = item->second;
+                TreeView_SetItem(m_treeControl, &tvi);
+            }
+        }
+    }
+}
+
+int CALLBACK BrowserWindow::CompareItems(LPARAM lParam1, LPARAM lParam2, LPARAM lParamSort)
+{
+    // folders first in their original order, then presets by cost or original order
+    auto browser = reinterpret_cast<BrowserWindow*>(lParamSort);
+    if(lParam1 < 0 || lParam2 < 0)
+    {
+        if(lParam1 >= 0)
+            return 1;
+        if(lParam2 >= 0)
+            return -1;
+        return lParam1 > lParam2 ? -1 : (lParam1 < lParam2 ? 1 : 0);
+    }
+    if(browser->m_sortByCost)
+    {
+        const auto cost1 = browser->m_costs[static_cast<UINT>(lParam1)];
+        const auto cost2 = browser->m_costs[static_cast<UINT>(lParam2)];
+        if(cost1 != cost2)
+            return cost1 < cost2 ? -1 : 1;
+    }
+    return lParam1 < lParam2 ? -1 : (lParam1 > lParam2 ? 1 : 0);
+}
+
+void BrowserWindow::SortItems(HTREEITEM parent)
+{
+    TVSORTCB sort;
+    sort.hParent     = parent;
+    sort.lpfnCompare = CompareItems;
+    sort.lParam      = reinterpret_cast<LPARAM>(this);
+    TreeView_SortChildrenCB(m_treeControl, &sort, 0);
+
+    // control only sorts one level
+    for(auto child = TreeView_GetChild(m_treeControl, parent); child != nullptr; child = TreeView_GetNextSibling(m_treeControl, child))
+    {
+        if(TreeView_GetChild(m_treeControl, child) != nullptr)
+            SortItems(child);
+    }
+}
+
+void BrowserWindow::ShowContextMenu(int x, int y)
+{
+    if(x == -1 && y == -1)
+    {
+        // from keyboard
+        RECT rect;
+        GetWindowRect(m_treeControl, &rect);
+        x = rect.left;
+        y = rect.top;
+    }
+
+    auto menu = CreatePopupMenu();
+    AppendMenu(menu, MF_STRING | (m_showCost ? MF_CHECKED : MF_UNCHECKED), ID_BROWSER_SHOWCOST, L"Show estimated cost");
+    AppendMenu(menu, MF_STRING | (m_sortByCost ? MF_CHECKED : MF_UNCHECKED), ID_BROWSER_SORTBYCOST, L"Sort by estimated cost");
+    auto command = TrackPopupMenu(menu, TPM_RETURNCMD | TPM_NONOTIFY, x, y, 0, m_mainWindow, nullptr);
+    DestroyMenu(menu);
+
+    if(command == ID_BROWSER_SHOWCOST)
+        m_showCost = !m_showCost;
+    else if(command == ID_BROWSER_SORTBYCOST)
+        m_sortByCost = !m_sortByCost;
+    else
+        return;
+
+    // costs depend on current input and output sizes, refresh on every change
+    UpdateCosts();
+    SortItems(TVI_ROOT);
+
+    auto selected = TreeView_GetSelection(m_treeControl);
+    if(selected != nullptr)
+        TreeView_EnsureVisible(m_treeControl, selected);
+}
+
 LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
     switch(message)
@@ -353,6 +461,10 @@ LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam,
         }
         break;
     }
+    case WM_CONTEXTMENU: {
+        ShowContextMenu(static_cast<short>(LOWORD(lParam)), static_cast<short>(HIWORD(lParam)));
+        return 0;
+    }
     case WM_CLOSE: {
         ShowWindow(hWnd, SW_HIDE);
         return 0;
@@ -394,6 +506,21 @@ LRESULT CALLBACK BrowserWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam,
 
             return 0;
         }
+        case IDM_UPDATE_PRESETS: {
+            // presets loaded at runtime, rebuild the tree
+            DestroyWindow(m_treeControl);
+            m_items.clear();
+            m_favorites.clear();
+            m_costs.clear();
+            m_folders = 0;
+            Build();
+            if(m_showCost || m_sortByCost)
+            {
+                UpdateCosts();
+                SortItems(TVI_ROOT);
+            }
+            return 0;
+        }
         }
     }
     }
@@ -31,9 +31,19 @@ private:
     int                       g_nDocument;
     std::map<UINT, HTREEITEM> m_items;
     std::map<UINT, HTREEITEM> m_favorites;
-
-    void Resize();
-    void Build();
+    std::map<UINT, double>    m_costs;
+    int                       m_folders {0};
+    bool                      m_showCost {false};
+    bool                      m_sortByCost {false};
+
+    void   Resize();
+    void   Build();
+    LPARAM NextFolder() { return --m_folders; } // negative, in insertion order
+    void   UpdateCosts();
+    void   SortItems(HTREEITEM parent);
+    void   ShowContextMenu(int x, int y);
+
+    static int CALLBACK CompareItems(LPARAM lParam1, LPARAM lParam2, LPARAM lParamSort);
 
     static LRESULT CALLBACK WndProcProxy(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
     ATOM                    MyRegisterClass(HINSTANCE hInstance);
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "CaptureManager.h"
 #include "ShaderList.h"
+#include "PresetLoader.h"
 
 #include "Util/capture.desktop.interop.h"
 #include "Util/direct3d11.interop.h"
@@ -14,7 +15,7 @@ using namespace std;
 using namespace util;
 using namespace util::uwp;
 
-CaptureManager::CaptureManager() : m_options(), m_lastPreset(-1) { }
+CaptureManager::CaptureManager() : m_options(), m_presetCache(m_options.presetCacheBudget), m_lastPreset(-1) { }
 
 bool CaptureManager::Initialize()
 {
@@ -136,13 +137,17 @@ bool CaptureManager::StartSession()
     }
 
     m_shaderGlass = make_unique<ShaderGlass>();
-    m_shaderGlass->Initialize(m_options.outputWindow, m_options.captureWindow, m_options.monitor, m_options.clone, !m_options.imageFile.empty(), m_d3dDevice, m_context);
+    m_shaderGlass->Initialize(m_options.outputWindow, m_options.captureWindow, m_options.monitor, m_options.clone, !m_options.imageFile.empty(), m_d3dDevice, m_context, &m_presetCache);
     UpdatePixelSize();
     UpdateOutputSize();
     UpdateOutputFlip();
     UpdateShaderPreset();
     UpdateFrameSkip();
     UpdateLockedArea();
+    m_shaderGlass->SetProfiling(m_profiling);
+    m_shaderGlass->SetMetricsLog(m_metricsLog);
+    UpdateTextureBudget();
+    UpdateGovernor();
 
     if(m_options.imageFile.size())
     {
@@ -213,6 +218,111 @@ float CaptureManager::FPS()
     return 0.f;
 }
 
+void CaptureManager::SetProfiling(bool profiling)
+{
+    m_profiling = profiling;
+    if(m_shaderGlass)
+    {
+        m_shaderGlass->SetProfiling(profiling);
+    }
+}
+
+bool CaptureManager::ExportTrace(LPWSTR fileName)
+{
+    if(m_shaderGlass)
+    {
+        return m_shaderGlass->ExportTrace(fileName);
+    }
+    return false;
+}
+
+std::vector<SectionTiming> CaptureManager::PassTimings()
+{
+    if(m_shaderGlass)
+    {
+        return m_shaderGlass->PassTimings();
+    }
+    return std::vector<SectionTiming>();
+}
+
+FrameStats CaptureManager::Metrics()
+{
+    if(m_shaderGlass)
+    {
+        return m_shaderGlass->Metrics();
+    }
+    return FrameStats();
+}
+
+TextureMemory CaptureManager::TextureUsage(bool& reduced)
+{
+    reduced = false;
+    if(m_shaderGlass)
+    {
+        return m_shaderGlass->TextureUsage(reduced);
+    }
+    return TextureMemory();
+}
+
+void CaptureManager::UpdateGovernor()
+{
+    if(m_shaderGlass)
+    {
+        GovernorSettings settings;
+        settings.targetMs     = m_options.targetFrameTime;
+        settings.minScale     = m_options.governorMinScale;
+        settings.maxFrameSkip = m_options.governorMaxFrameSkip;
+        m_shaderGlass->SetGovernor(settings);
+    }
+}
+
+float CaptureManager::GovernorScale(int& frameSkip)
+{
+    frameSkip = 0;
+    if(m_shaderGlass)
+    {
+        return m_shaderGlass->GovernorScale(frameSkip);
+    }
+    return 1.0f;
+}
+
+PresetCost CaptureManager::EstimateCost(unsigned presetNo)
+{
+    UINT originalWidth, originalHeight, outputWidth, outputHeight;
+    if(!m_shaderGlass || !m_shaderGlass->ChainSize(originalWidth, originalHeight, outputWidth, outputHeight))
+    {
+        // not processing yet, assume the primary display at current pixel size and scale
+        outputWidth    = static_cast<UINT>(GetSystemMetrics(SM_CXSCREEN) * m_options.outputScale);
+        outputHeight   = static_cast<UINT>(GetSystemMetrics(SM_CYSCREEN) * m_options.outputScale);
+        originalWidth  = static_cast<UINT>(GetSystemMetrics(SM_CXSCREEN) / m_options.pixelWidth);
+        originalHeight = static_cast<UINT>(GetSystemMetrics(SM_CYSCREEN) / m_options.pixelHeight);
+    }
+    std::unique_lock defsLock(PresetDef::ShaderDefsMutex);
+    return ShaderCost::Estimate(*m_presetList.at(presetNo), originalWidth, originalHeight, outputWidth, outputHeight);
+}
+
+void CaptureManager::UpdateTextureBudget()
+{
+    if(m_shaderGlass)
+    {
+        m_shaderGlass->SetTextureBudget(m_options.textureBudget);
+    }
+}
+
+void CaptureManager::SetMetricsLog(const std::wstring& fileName)
+{
+    m_metricsLog = fileName;
+    if(m_shaderGlass)
+    {
+        m_shaderGlass->SetMetricsLog(fileName);
+    }
+}
+
+void CaptureManager::UpdatePresetCache()
+{
+    m_presetCache.SetBudget(m_options.presetCacheBudget);
+}
+
 void CaptureManager::ProcessFrame()
 {
     if(m_session.get())
@@ -242,6 +352,11 @@ void CaptureManager::Exit()
         m_session->Stop();
         delete m_session.release();
 
+        if(m_presetWatcher)
+            m_presetWatcher->Watch(nullptr);
+        if(m_presetSpecializer)
+            m_presetSpecializer->Specialize(nullptr, {});
+
         m_shaderGlass->Stop();
         delete m_shaderGlass.release();
 
@@ -289,8 +404,190 @@ void CaptureManager::UpdateShaderPreset()
         }
         m_shaderGlass->SetShaderPreset(m_presetList.at(m_options.presetNo).get(), m_queuedParams);
         m_queuedParams.clear();
-        m_lastPreset = m_options.presetNo;
+        m_lastPreset   = m_options.presetNo;
+        m_reloaded     = false;
+        m_reloadFailed = false;
+        WatchPreset();
+        UpdateSpecialization(); // requested again once the chain runs
+    }
+}
+
+void CaptureManager::WatchPreset()
+{
+    // only presets loaded from .slangp files have sources to watch
+    auto preset = m_shaderGlass ? dynamic_cast<LoadedPresetDef*>(m_presetList.at(m_options.presetNo).get()) : nullptr;
+    if(preset && !m_presetWatcher)
+        m_presetWatcher = make_unique<PresetWatcher>(m_options.outputWindow);
+    if(m_presetWatcher)
+        m_presetWatcher->Watch(preset);
+}
+
+bool CaptureManager::ApplyPresetChange(std::string& error)
+{
+    PresetChange change;
+    if(!m_presetWatcher || !m_presetWatcher->TakeChange(change))
+        return true;
+
+    const auto preset = std::find_if(m_presetList.begin(), m_presetList.end(), [&](const auto& p) { return p.get() == change.preset; });
+    if(preset == m_presetList.end() || !m_shaderGlass)
+        return true;
+
+    // variants compiled from the previous sources must not follow the change in
+    if(m_presetSpecializer)
+        m_presetSpecializer->Specialize(nullptr, {});
+
+    if(!change.error.empty())
+    {
+        m_reloadFailed = true;
+        error          = change.error;
+        return false;
+    }
+
+    if(change.reload)
+    {
+        // passes, textures or overrides may all differ, so the preset is loaded again in its place
+        std::unique_ptr<LoadedPresetDef> reloaded;
+        try
+        {
+            PresetLoader loader(PresetLoader::DefaultCachePath(), PresetLoader::DefaultToolsPath());
+            reloaded = loader.Load(change.preset->m_path);
+        }
+        catch(std::exception& e)
+        {
+            m_reloadFailed = true;
+            error          = e.what();
+            return false;
+        }
+
+        RememberLastPreset();
+        m_retiredPresets.push_back(std::move(*preset));
+        *preset = std::move(reloaded);
+        m_shaderGlass->SetShaderPreset(preset->get(), m_lastParams, change.detected);
+    }
+    else
+    {
+        // copies keep the pass settings from the .slangp, compiled code is kept by the preset
+        std::vector<std::pair<size_t, ShaderDef>> passes;
+        auto                                      shader = change.shaders.begin();
+        for(const auto pass : change.passes)
+        {
+            auto def = change.preset->m_shaderDefs[pass];
+            PresetLoader::Define(*shader, def);
+            change.preset->m_shaderDefs[pass] = def;
+            change.preset->m_passFiles[pass]  = shader->sources;
+            passes.emplace_back(pass, def);
+            shader++;
+        }
+        change.preset->m_shaders.splice(change.preset->m_shaders.end(), change.shaders);
+        m_shaderGlass->ReplacePasses(change.preset, std::move(passes), change.detected);
+    }
+
+    m_reloaded     = true;
+    m_reloadFailed = false;
+    WatchPreset(); // includes may have changed
+    return true;
+}
+
+float CaptureManager::ReloadLatency(bool& failed)
+{
+    failed = m_reloadFailed;
+    return m_reloaded && m_shaderGlass ? m_shaderGlass->SwitchLatency() : 0.0f;
+}
+
+void CaptureManager::UpdateSpecialization()
+{
+    // only presets loaded from .slangp files can be specialized, once their chain is running
+    auto preset = m_shaderGlass ? dynamic_cast<LoadedPresetDef*>(m_presetList.at(m_options.presetNo).get()) : nullptr;
+    if(preset && !m_shaderGlass->IsRunning(preset))
+        preset = nullptr;
+    if(preset && m_options.specialize && !m_presetSpecializer)
+        m_presetSpecializer = make_unique<PresetSpecializer>(m_options.outputWindow);
+    if(!m_presetSpecializer)
+        return;
+    if(!preset)
+    {
+        m_presetSpecializer->Specialize(nullptr, {});
+        return;
+    }
+
+    std::map<std::pair<int, std::string>, float> values;
+    for(const auto& param : Params())
+        values[std::make_pair(std::get<0>(param), std::get<1>(param)->name)] = std::get<1>(param)->currentValue;
+    const auto isCurrent = [&](size_t pass, const std::pair<const std::string, float>& constant) {
+        const auto value = values.find(std::make_pair(static_cast<int>(pass), constant.first));
+        return value != values.end() && value->second == constant.second;
+    };
+
+    std::vector<std::pair<size_t, std::shared_ptr<const CompiledShader>>> generic;
+    std::vector<std::pair<size_t, std::map<std::string, float>>>          passes;
+    for(size_t pass = 0; pass < preset->m_shaderDefs.size() && pass < preset->ShaderDefs.size(); pass++)
+    {
+        // declared parameters at their defaults, uniforms set by the chain have no range
+        std::map<std::string, float> constants;
+        if(m_options.specialize)
+        {
+            for(const auto& param : preset->m_shaderDefs[pass].Params)
+            {
+                if(param.minValue == param.maxValue)
+                    continue;
+                auto defaultValue = param.defaultValue;
+                for(const auto& o : preset->Overrides)
+                {
+                    if(o.name == param.name)
+                        defaultValue = o.value;
+                }
+                const std::pair<const std::string, float> constant(param.name, defaultValue);
+                if(isCurrent(pass, constant))
+                    constants.insert(constant);
+            }
+        }
+
+        // a moved slider takes effect with the generic code straight away, a new variant follows once it settles
+        const auto variant = m_shaderGlass->PassVariant(preset, pass);
+        auto       baked   = variant ? &variant->constants : nullptr;
+        if(baked && (!m_options.specialize || !std::all_of(baked->begin(), baked->end(), [&](const auto& constant) { return isCurrent(pass, constant); })))
+        {
+            generic.emplace_back(pass, nullptr);
+            baked = nullptr;
+        }
+        if(!constants.empty() && (!baked || *baked != constants))
+            passes.emplace_back(pass, std::move(constants));
     }
+
+    if(!generic.empty())
+        m_shaderGlass->ReplacePrograms(preset, std::move(generic));
+    m_presetSpecializer->Specialize(preset, passes);
+}
+
+void CaptureManager::ApplyVariants()
+{
+    auto preset = m_shaderGlass ? dynamic_cast<LoadedPresetDef*>(m_presetList.at(m_options.presetNo).get()) : nullptr;
+    if(!m_presetSpecializer || !m_options.specialize || !preset || !m_shaderGlass->IsRunning(preset))
+        return;
+
+    std::map<std::pair<int, std::string>, float> values;
+    for(const auto& param : Params())
+        values[std::make_pair(std::get<0>(param), std::get<1>(param)->name)] = std::get<1>(param)->currentValue;
+
+    // parameters may have moved while the variant compiled, then it's left for the next request
+    std::vector<std::pair<size_t, std::shared_ptr<const CompiledShader>>> programs;
+    PresetVariant                                                         variant;
+    while(m_presetSpecializer->TakeVariant(variant))
+    {
+        if(variant.preset != preset || variant.pass >= preset->m_shaderDefs.size())
+            continue;
+        const auto current = std::all_of(variant.shader.constants.begin(), variant.shader.constants.end(), [&](const auto& constant) {
+            const auto value = values.find(std::make_pair(static_cast<int>(variant.pass), constant.first));
+            return value != values.end() && value->second == constant.second;
+        });
+        if(!current)
+            continue;
+
+        // kept only by the shader running it, and the chain's entry in the preset cache
+        programs.emplace_back(variant.pass, std::make_shared<const CompiledShader>(std::move(variant.shader)));
+    }
+    if(!programs.empty())
+        m_shaderGlass->ReplacePrograms(preset, std::move(programs));
 }
 
 void CaptureManager::UpdateFrameSkip()
@@ -331,6 +628,7 @@ void CaptureManager::UpdateParams()
     if(m_shaderGlass)
     {
         m_shaderGlass->UpdateParams();
+        UpdateSpecialization();
     }
 }
 
@@ -339,6 +637,7 @@ void CaptureManager::ResetParams()
     if(m_shaderGlass)
     {
         m_shaderGlass->ResetParams();
+        UpdateSpecialization();
     }
 }
 
@@ -377,6 +676,21 @@ void CaptureManager::ForgetLastPreset()
     m_lastPreset = -1;
 }
 
+unsigned CaptureManager::LoadPreset(const std::wstring& fileName)
+{
+    PresetLoader loader(PresetLoader::DefaultCachePath(), PresetLoader::DefaultToolsPath());
+    auto         preset = loader.Load(fileName);
+
+    // passthrough stays last, it's the quick toggle target
+    const auto presetNo = static_cast<unsigned>(m_presetList.size() - 1);
+    m_presetList.insert(m_presetList.begin() + presetNo, std::move(preset));
+    if(m_options.presetNo >= presetNo)
+        m_options.presetNo++;
+    if(m_lastPreset >= presetNo)
+        ForgetLastPreset();
+    return presetNo;
+}
+
 int CaptureManager::FindByName(const char* presetName)
 {
     int p = 0;
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "CaptureSession.h"
+#include "ShaderCost.h"
+#include "PresetWatcher.h"
+#include "PresetSpecializer.h"
 
 struct CaptureOptions
 {
@@ -25,6 +28,12 @@ struct CaptureOptions
     RECT         inputArea {0, 0, 0, 0};
     float        dpiScale {1.0f};
     bool         freeScale {false};
+    size_t       presetCacheBudget {256 * 1024 * 1024};
+    size_t       textureBudget {0}; // intermediate textures, 0 for unlimited
+    float        targetFrameTime {0}; // ms for the resolution governor, 0 to disable
+    float        governorMinScale {0.5f};
+    int          governorMaxFrameSkip {0};
+    bool         specialize {false}; // fold parameters at their defaults into loaded presets
 };
 
 class CaptureManager
@@ -62,11 +71,32 @@ public:
     void ThreadFunc();
     void Exit();
     float FPS();
+    void  SetProfiling(bool profiling);
+    bool  ExportTrace(LPWSTR fileName);
+    std::vector<SectionTiming> PassTimings();
+    FrameStats                 Metrics();
+    TextureMemory              TextureUsage(bool& reduced);
+    void                       UpdateTextureBudget();
+    void                       UpdateGovernor();
+    float                      GovernorScale(int& frameSkip);
+    PresetCost                 EstimateCost(unsigned presetNo);
+    unsigned                   LoadPreset(const std::wstring& fileName); // throws std::runtime_error
+    bool                       ApplyPresetChange(std::string& error); // false with compiler output if an edit doesn't build
+    float                      ReloadLatency(bool& failed);           // ms from the last edit to its first frame
+    void                       UpdateSpecialization();
+    void                       ApplyVariants();
+    void                       SetMetricsLog(const std::wstring& fileName);
+    void  UpdatePresetCache();
+    PresetCache& Cache() { return m_presetCache; }
     int FindByName(const char* presetName);
     bool IsInitialized() const { return m_initialized; }
 
 private:
+    void WatchPreset();
+
     volatile bool                                     m_active {false};
+    bool                                              m_profiling {false};
+    std::wstring                                      m_metricsLog {};
     winrt::com_ptr<ID3D11Device>                      m_d3dDevice {nullptr};
     winrt::com_ptr<ID3D11DeviceContext>               m_context {nullptr};
     winrt::com_ptr<ID3D11Debug>                       m_debug {nullptr};
@@ -74,6 +104,12 @@ private:
     std::unique_ptr<CaptureSession>                   m_session {nullptr};
     std::unique_ptr<ShaderGlass>                      m_shaderGlass {nullptr};
     std::vector<std::unique_ptr<PresetDef>>           m_presetList;
+    std::vector<std::unique_ptr<PresetDef>>           m_retiredPresets; // reloaded, may still be running or cached
+    std::unique_ptr<PresetWatcher>                    m_presetWatcher {nullptr};
+    std::unique_ptr<PresetSpecializer>                m_presetSpecializer {nullptr};
+    bool                                              m_reloaded {false};
+    bool                                              m_reloadFailed {false};
+    PresetCache                                       m_presetCache;
     std::vector<std::tuple<int, std::string, double>> m_queuedParams;
     std::vector<std::tuple<int, std::string, double>> m_lastParams;
     unsigned int                                      m_lastPreset;
@@ -54,7 +54,14 @@ void CaptureSession::UpdateCursor(bool captureCursor)
 void CaptureSession::OnFrameArrived(winrt::Direct3D11CaptureFramePool const& sender, winrt::IInspectable const&)
 {
     auto frame   = sender.TryGetNextFrame();
-    m_inputFrame = GetDXGIInterfaceFromObject<ID3D11Texture2D>(frame.Surface());
+    auto texture = GetDXGIInterfaceFromObject<ID3D11Texture2D>(frame.Surface());
+    auto time    = FrameMetrics::FromSystemRelativeTime(frame.SystemRelativeTime().count());
+
+    // arrives on a pool thread
+    std::unique_lock lock(m_inputMutex);
+    m_inputFrame = texture;
+    m_inputTime  = time;
+    m_inputSequence++;
 }
 
 void CaptureSession::ProcessInput()
@@ -65,7 +72,16 @@ void CaptureSession::ProcessInput()
     }
     else
     {
-        m_shaderGlass.Process(m_inputFrame);
+        winrt::com_ptr<ID3D11Texture2D> frame;
+        uint64_t                        sequence;
+        int64_t                         time;
+        {
+            std::unique_lock lock(m_inputMutex);
+            frame    = m_inputFrame;
+            sequence = m_inputSequence;
+            time     = m_inputTime;
+        }
+        m_shaderGlass.Process(frame, sequence, time);
     }
 }
 
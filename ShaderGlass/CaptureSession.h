@@ -31,6 +31,9 @@ private:
     winrt::Windows::Graphics::DirectX::Direct3D11::IDirect3DDevice m_device {nullptr};
     winrt::com_ptr<ID3D11Texture2D>                                m_inputImage {nullptr};
     winrt::com_ptr<ID3D11Texture2D>                                m_inputFrame {nullptr};
+    uint64_t                                                       m_inputSequence {0};
+    int64_t                                                        m_inputTime {0};
+    std::mutex                                                     m_inputMutex {};
 
     ShaderGlass& m_shaderGlass;
 };
@@ -0,0 +1,444 @@
+#include "pch.h"
+
+#include "ChainGroup.h"
+
+static const float background_colour[4] = {0, 0, 0, 1.0f};
+
+static bool sameByteCode(const BYTE* code1, SIZE_T length1, const BYTE* code2, SIZE_T length2)
+{
+    // headers included from different shards have their own copies of the bytecode
+    return length1 == length2 && (code1 == code2 || (code1 && code2 && memcmp(code1, code2, length1) == 0));
+}
+
+ChainGroup::ChainGroup(std::shared_ptr<RenderBackend> backend) :
+    m_backend {backend}, m_preprocessPreset(m_preprocessPresetDef), m_preprocessShader(m_preprocessShaderDef),
+    m_preprocessPass(m_preprocessShader, m_preprocessPreset, true)
+{
+    m_preprocessShader.Create(*m_backend);
+    m_preprocessPass.Initialize(m_backend);
+}
+
+ChainGroup::~ChainGroup()
+{
+    m_chains.clear();
+    m_history.clear();
+    m_preprocessResources.clear();
+}
+
+size_t ChainGroup::AddChain(PresetDef& presetDef)
+{
+    auto chain    = std::make_unique<Chain>();
+    chain->preset = std::make_unique<Preset>(presetDef);
+    chain->preset->Create(*m_backend);
+    chain->passes.reserve(chain->preset->m_shaders.size());
+    for(auto& shader : chain->preset->m_shaders)
+    {
+        chain->passes.emplace_back(shader, *chain->preset, m_backend);
+    }
+    m_chains.push_back(std::move(chain));
+    return m_chains.size() - 1;
+}
+
+bool ChainGroup::SetParam(size_t chain, const std::string& name, float value)
+{
+    bool found = false;
+    for(auto& s : m_chains[chain]->preset->m_shaders)
+        for(const auto& p : s.m_shaderDef.Params)
+            found |= p.size == 4 && p.name == name;
+    if(found)
+        m_chains[chain]->params[name] = value;
+    return found;
+}
+
+float ChainGroup::ParamValue(const Chain& chain, const ShaderParam& param)
+{
+    const auto set = chain.params.find(param.name);
+    if(set != chain.params.end())
+        return set->second;
+    for(const auto& o : chain.preset->m_presetDef.Overrides)
+    {
+        if(o.name == param.name)
+            return o.value;
+    }
+    return param.defaultValue;
+}
+
+void ChainGroup::ApplyParams(Chain& chain)
+{
+    // chains of the same preset share definitions, so every chain sets all of its values
+    for(auto& s : chain.preset->m_shaders)
+        for(auto& p : s.Params())
+        {
+            if(p->size == 4 && p->name != "FrameCount")
+            {
+                auto value = ParamValue(chain, *p);
+                s.SetParam(p, &value);
+            }
+        }
+}
+
+size_t ChainGroup::Passes() const
+{
+    size_t passes = 0;
+    for(const auto& chain : m_chains)
+        passes += chain->passes.size();
+    return passes;
+}
+
+size_t ChainGroup::RenderedPasses() const
+{
+    size_t passes = 0;
+    for(const auto& chain : m_chains)
+        passes += chain->passes.size() - chain->shared;
+    return passes;
+}
+
+RenderTexture* ChainGroup::Output(size_t chain) const
+{
+    return m_chains[chain]->output.get();
+}
+
+void ChainGroup::Resize(uint32_t inputWidth, uint32_t inputHeight, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight, TextureFormat inputFormat)
+{
+    m_history.clear();
+    m_preprocessResources.clear();
+
+    m_original = m_backend->CreateTexture({originalWidth, originalHeight, inputFormat, true});
+    m_preprocessResources.insert(std::make_pair("Original", m_original));
+
+    std::map<std::string, float4> textureSizes;
+    textureSizes.insert(std::make_pair("Original", float4 {(float)originalWidth, (float)originalHeight, 1.0f / originalWidth, 1.0f / originalHeight}));
+    textureSizes.insert(std::make_pair("FinalViewport", float4 {(float)outputWidth, (float)outputHeight, 1.0f / outputWidth, 1.0f / outputHeight}));
+
+    std::vector<std::array<UINT, 4>> preprocessSizes;
+    m_preprocessPass.Resize(inputWidth, inputHeight, originalWidth, originalHeight, textureSizes, preprocessSizes);
+    m_preprocessPass.UpdateMVP(1.0f, 1.0f, 0.0001f, 0.0001f);
+    m_preprocessPass.m_target = m_original.get();
+
+    // history is shared, as deep as the deepest chain needs
+    int requiresHistory = 0;
+    for(auto& chain : m_chains)
+    {
+        ApplyParams(*chain);
+        SizePasses(*chain, originalWidth, originalHeight, outputWidth, outputHeight);
+
+        chain->requiresFeedback = false;
+        for(const auto& pass : chain->passes)
+        {
+            chain->requiresFeedback |= pass.RequiresFeedback();
+            requiresHistory = max(requiresHistory, pass.RequiresHistory());
+        }
+    }
+    for(int h = 0; h < requiresHistory; h++)
+    {
+        m_history.push_back(m_backend->CreateTexture({originalWidth, originalHeight, inputFormat, false}));
+    }
+
+    for(size_t c = 0; c < m_chains.size(); c++)
+    {
+        // longest run of leading passes any earlier chain already renders
+        auto&  chain  = *m_chains[c];
+        Chain* owner  = nullptr;
+        size_t shared = 0;
+        for(size_t o = 0; o < c; o++)
+        {
+            const auto prefix = SharedPrefix(chain, *m_chains[o]);
+            if(prefix > shared)
+            {
+                shared = prefix;
+                owner  = m_chains[o].get();
+            }
+        }
+        chain.shared = shared;
+        CreateTargets(chain, owner, outputWidth, outputHeight);
+    }
+}
+
+void ChainGroup::SizePasses(Chain& chain, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight)
+{
+    // pass sizes, same rules as the interactive chain
+    std::map<std::string, float4> textureSizes;
+    textureSizes.insert(std::make_pair("Original", float4 {(float)originalWidth, (float)originalHeight, 1.0f / originalWidth, 1.0f / originalHeight}));
+    textureSizes.insert(std::make_pair("FinalViewport", float4 {(float)outputWidth, (float)outputHeight, 1.0f / outputWidth, 1.0f / outputHeight}));
+
+    auto& passSizes = chain.passSizes;
+    passSizes.clear();
+
+    UINT sourceWidth  = originalWidth;
+    UINT sourceHeight = originalHeight;
+    for(size_t p = 0; p < chain.passes.size(); p++)
+    {
+        const auto& shader = chain.passes[p].m_shader;
+        if(p == chain.passes.size() - 1)
+        {
+            passSizes.push_back({sourceWidth, sourceHeight, outputWidth, outputHeight});
+            break;
+        }
+
+        UINT passWidth, passHeight;
+        if(shader.m_scaleViewportX)
+            passWidth = static_cast<UINT>(outputWidth * shader.m_scaleX);
+        else if(shader.m_scaleAbsoluteX)
+            passWidth = static_cast<UINT>(shader.m_scaleX);
+        else
+            passWidth = static_cast<UINT>(sourceWidth * shader.m_scaleX);
+        if(shader.m_scaleViewportY)
+            passHeight = static_cast<UINT>(outputHeight * shader.m_scaleY);
+        else if(shader.m_scaleAbsoluteY)
+            passHeight = static_cast<UINT>(shader.m_scaleY);
+        else
+            passHeight = static_cast<UINT>(sourceHeight * shader.m_scaleY);
+        passSizes.push_back({sourceWidth, sourceHeight, passWidth, passHeight});
+        if(!shader.m_alias.empty())
+        {
+            textureSizes.insert(std::make_pair(shader.m_alias, float4 {(float)passWidth, (float)passHeight, 1.0f / passWidth, 1.0f / passHeight}));
+        }
+        sourceWidth  = passWidth;
+        sourceHeight = passHeight;
+    }
+    for(size_t p = 0; p < chain.passes.size(); p++)
+    {
+        chain.passes[p].Resize(passSizes[p][0], passSizes[p][1], passSizes[p][2], passSizes[p][3], textureSizes, passSizes);
+    }
+}
+
+void ChainGroup::CreateTargets(Chain& chain, const Chain* owner, uint32_t outputWidth, uint32_t outputHeight)
+{
+    chain.resources.clear();
+    chain.textures.clear();
+    chain.output = nullptr;
+    if(chain.passes.empty())
+        return;
+
+    for(auto& texture : chain.preset->m_textures)
+    {
+        chain.resources.insert(std::make_pair(texture.second.m_name, texture.second.m_texture));
+    }
+    chain.resources.insert(std::make_pair("Original", m_original));
+    for(size_t h = 0; h < m_history.size(); h++)
+    {
+        chain.resources.insert(std::make_pair(std::string("OriginalHistory") + std::to_string(h + 1), m_history[h]));
+    }
+
+    const auto last = chain.passes.size() - 1;
+    for(size_t p = 0; p <= last; p++)
+    {
+        const auto& shader       = chain.passes[p].m_shader;
+        const auto  outputName   = std::string("PassOutput") + std::to_string(p);
+        const auto  feedbackName = std::string("PassFeedback") + std::to_string(p);
+
+        std::shared_ptr<RenderTexture> target   = nullptr;
+        std::shared_ptr<RenderTexture> feedback = nullptr;
+        if(p < chain.shared)
+        {
+            // rendered by the owner, feedback too where this chain needs it
+            target = p == last ? owner->output : owner->resources.at(outputName);
+            if(chain.requiresFeedback)
+                feedback = owner->resources.at(feedbackName);
+        }
+        else
+        {
+            TextureDesc passDesc;
+            passDesc.width        = chain.passSizes[p][2];
+            passDesc.height       = chain.passSizes[p][3];
+            passDesc.renderTarget = true;
+            if(p == last)
+            {
+                passDesc.width  = outputWidth;
+                passDesc.height = outputHeight;
+            }
+            else if(shader.m_formatFloat)
+                passDesc.format = TextureFormat::RGBA16F;
+            else if(shader.m_formatSRGB)
+                passDesc.format = TextureFormat::BGRA8_SRGB;
+
+            target = m_backend->CreateTexture(passDesc);
+            chain.textures.push_back(target);
+            if(chain.requiresFeedback)
+            {
+                passDesc.renderTarget = false;
+                feedback              = m_backend->CreateTexture(passDesc);
+                chain.textures.push_back(feedback);
+            }
+            if(p == last)
+                m_backend->Clear(*target, background_colour);
+        }
+
+        if(p == last)
+            chain.output = target;
+        else
+            chain.resources.insert(std::make_pair(outputName, target));
+        if(feedback)
+            chain.resources.insert(std::make_pair(feedbackName, feedback));
+        if(!shader.m_alias.empty())
+        {
+            if(p != last)
+                chain.resources.insert(std::make_pair(shader.m_alias, target));
+            if(feedback)
+                chain.resources.insert(std::make_pair(shader.m_alias + "Feedback", feedback));
+        }
+
+        chain.passes[p].m_target = target.get();
+        if(p < last)
+            chain.passes[p + 1].m_source = target.get();
+    }
+}
+
+size_t ChainGroup::SharedPrefix(const Chain& chain, const Chain& owner) const
+{
+    // the owner copies feedback of the passes it renders only if it needs feedback itself
+    if(chain.requiresFeedback && !owner.requiresFeedback)
+        return 0;
+
+    size_t prefix = 0;
+    while(prefix < chain.passes.size() && prefix < owner.passes.size() && SamePass(chain, owner, prefix))
+        prefix++;
+
+    // shared passes render once, so they may not read from the passes which differ
+    while(prefix > 0 && ReadsBeyond(chain, owner, prefix))
+        prefix--;
+
+    return prefix;
+}
+
+bool ChainGroup::SamePass(const Chain& chain, const Chain& owner, size_t p) const
+{
+    // a last pass renders at output size in its own format
+    if((p == chain.passes.size() - 1) != (p == owner.passes.size() - 1))
+        return false;
+    if(chain.passSizes[p] != owner.passSizes[p])
+        return false;
+
+    const auto& shader1 = chain.passes[p].m_shader;
+    const auto& shader2 = owner.passes[p].m_shader;
+    const auto& def1    = shader1.m_shaderDef;
+    const auto& def2    = shader2.m_shaderDef;
+    if(!sameByteCode(def1.VertexByteCode, def1.VertexLength, def2.VertexByteCode, def2.VertexLength) ||
+       !sameByteCode(def1.FragmentByteCode, def1.FragmentLength, def2.FragmentByteCode, def2.FragmentLength))
+        return false;
+    if(def1.PresetParams != def2.PresetParams)
+        return false;
+
+    // same bytecode means same parameter layout
+    for(const auto& param : def1.Params)
+    {
+        if(param.size == 4 && param.name != "FrameCount" && ParamValue(chain, param) != ParamValue(owner, param))
+            return false;
+    }
+
+    // static textures of the same name may come from different files
+    for(const auto& sampler : def1.Samplers)
+    {
+        const auto texture1 = chain.preset->m_textures.find(sampler.name);
+        const auto texture2 = owner.preset->m_textures.find(sampler.name);
+        const bool static1  = texture1 != chain.preset->m_textures.end();
+        const bool static2  = texture2 != owner.preset->m_textures.end();
+        if(static1 != static2)
+            return false;
+        if(static1)
+        {
+            const auto& textureDef1 = texture1->second.m_textureDef;
+            const auto& textureDef2 = texture2->second.m_textureDef;
+            if(!sameByteCode(textureDef1.Data, textureDef1.DataLength, textureDef2.Data, textureDef2.DataLength) ||
+               textureDef1.PresetParams != textureDef2.PresetParams)
+                return false;
+        }
+    }
+    return true;
+}
+
+int ChainGroup::ReferencedPass(const std::string& name, const Chain& chain)
+{
+    // PassOutputN, PassFeedbackN and their sizes
+    for(const auto& prefix : {"PassOutputSize", "PassFeedbackSize", "PassOutput", "PassFeedback"})
+    {
+        const auto length = strlen(prefix);
+        if(name.size() > length && name.starts_with(prefix) && std::all_of(name.begin() + length, name.end(), ::isdigit))
+            return atoi(name.c_str() + length);
+    }
+
+    // aliases, their feedback and sizes
+    for(size_t p = 0; p < chain.passes.size(); p++)
+    {
+        const auto& alias = chain.passes[p].m_shader.m_alias;
+        if(!alias.empty() && (name == alias || name == alias + "Size" || name == alias + "Feedback" || name == alias + "FeedbackSize"))
+            return static_cast<int>(p);
+    }
+    return -1;
+}
+
+bool ChainGroup::ReadsBeyond(const Chain& chain, const Chain& owner, size_t prefix) const
+{
+    for(size_t p = 0; p < prefix; p++)
+    {
+        const auto& def = chain.passes[p].m_shader.m_shaderDef;
+        for(const auto* c : {&chain, &owner})
+        {
+            for(const auto& sampler : def.Samplers)
+            {
+                if(ReferencedPass(sampler.name, *c) >= static_cast<int>(prefix))
+                    return true;
+            }
+            for(const auto& param : def.Params)
+            {
+                if(ReferencedPass(param.name, *c) >= static_cast<int>(prefix))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ChainGroup::Render(RenderTexture* input, int frameCount)
+{
+    if(!m_original)
+        return;
+
+    m_preprocessPass.Render(input, m_preprocessResources, frameCount, 0, 0);
+
+    for(auto& chain : m_chains)
+    {
+        for(size_t p = chain->shared; p < chain->passes.size(); p++)
+        {
+            if(p == 0)
+                chain->passes[p].Render(m_original.get(), chain->resources, frameCount, 0, 0);
+            else
+                chain->passes[p].Render(chain->resources, frameCount, 0, 0);
+        }
+    }
+
+    // feedback once every chain has rendered, shared passes may be read by later chains
+    for(auto& chain : m_chains)
+    {
+        if(!chain->requiresFeedback)
+            continue;
+
+        const auto last = chain->passes.size() - 1;
+        for(size_t q = chain->shared; q <= last; q++)
+        {
+            auto& passFeedback = *chain->resources.find(std::string("PassFeedback") + std::to_string(q))->second;
+            if(q == last)
+                m_backend->Copy(passFeedback, *chain->output);
+            else
+                m_backend->Copy(passFeedback, *chain->resources.find(std::string("PassOutput") + std::to_string(q))->second);
+        }
+    }
+
+    if(!m_history.empty())
+    {
+        // oldest history is reused for the current original
+        auto lastHistory = m_history.back();
+        for(size_t h = m_history.size() - 1; h > 0; h--)
+        {
+            m_history[h] = m_history[h - 1];
+        }
+        m_backend->Copy(*lastHistory, *m_original);
+        m_history[0] = lastHistory;
+
+        for(auto& chain : m_chains)
+            for(size_t h = 0; h < m_history.size(); h++)
+            {
+                chain->resources[std::string("OriginalHistory") + std::to_string(h + 1)] = m_history[h];
+            }
+    }
+}
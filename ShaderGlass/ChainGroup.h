@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Preset.h"
+#include "ShaderPass.h"
+#include "Shaders\PreprocessShaderDef.h"
+
+// several preset chains rendering offscreen from one preprocessed Original and its history;
+// leading passes identical across chains (shader, parameters, textures, sizes) render only once
+class ChainGroup
+{
+public:
+    ChainGroup(std::shared_ptr<RenderBackend> backend);
+    ~ChainGroup();
+
+    size_t AddChain(PresetDef& presetDef);
+
+    // over the preset's own overrides, applies from the next Resize
+    bool SetParam(size_t chain, const std::string& name, float value);
+
+    // original is the preprocessed input, i.e. input divided by pixel size; every chain gets the same output size
+    void Resize(uint32_t inputWidth, uint32_t inputHeight, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight, TextureFormat inputFormat);
+
+    void           Render(RenderTexture* input, int frameCount = 1);
+    RenderTexture* Output(size_t chain) const;
+    size_t         Chains() const { return m_chains.size(); }
+    size_t         Passes() const;         // of all chains
+    size_t         RenderedPasses() const; // once shared passes are rendered only once
+
+private:
+    struct Chain
+    {
+        std::unique_ptr<Preset>                               preset {nullptr};
+        std::vector<ShaderPass>                               passes;
+        std::map<std::string, float>                          params;
+        std::vector<std::array<UINT, 4>>                      passSizes;
+        std::map<std::string, std::shared_ptr<RenderTexture>> resources;
+        std::vector<std::shared_ptr<RenderTexture>>           textures; // created for this chain, not borrowed
+        std::shared_ptr<RenderTexture>                        output {nullptr};
+        size_t                                                shared {0}; // leading passes rendered by an earlier chain
+        bool                                                  requiresFeedback {false};
+    };
+
+    void   ApplyParams(Chain& chain);
+    void   SizePasses(Chain& chain, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight);
+    void   CreateTargets(Chain& chain, const Chain* owner, uint32_t outputWidth, uint32_t outputHeight);
+    size_t SharedPrefix(const Chain& chain, const Chain& owner) const;
+    bool   SamePass(const Chain& chain, const Chain& owner, size_t p) const;
+    bool   ReadsBeyond(const Chain& chain, const Chain& owner, size_t prefix) const;
+
+    static float ParamValue(const Chain& chain, const ShaderParam& param);
+    static int   ReferencedPass(const std::string& name, const Chain& chain);
+
+    std::shared_ptr<RenderBackend> m_backend;
+    PreprocessShaderDef            m_preprocessShaderDef;
+    PresetDef                      m_preprocessPresetDef;
+    Preset                         m_preprocessPreset;
+    Shader                         m_preprocessShader;
+    ShaderPass                     m_preprocessPass;
+
+    std::vector<std::unique_ptr<Chain>>                   m_chains;
+    std::shared_ptr<RenderTexture>                        m_original {nullptr};
+    std::vector<std::shared_ptr<RenderTexture>>           m_history; // OriginalHistory1 first
+    std::map<std::string, std::shared_ptr<RenderTexture>> m_preprocessResources;
+};
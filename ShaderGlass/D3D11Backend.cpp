@@ -0,0 +1,439 @@
+#include "pch.h"
+
+#include "D3D11Backend.h"
+#include "ShaderDef.h"
+
+D3D11Backend::D3D11Backend(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context) : m_device(device), m_context(context)
+{
+    D3D11_RASTERIZER_DESC desc = {};
+    desc.CullMode              = D3D11_CULL_NONE;
+    desc.FillMode              = D3D11_FILL_SOLID;
+    desc.DepthClipEnable       = FALSE;
+    desc.MultisampleEnable     = FALSE;
+    HRESULT hr                 = m_device->CreateRasterizerState(&desc, m_rasterizerState.put());
+    assert(SUCCEEDED(hr));
+
+    m_context->RSSetState(m_rasterizerState.get());
+}
+
+DXGI_FORMAT D3D11Backend::ToDXGI(TextureFormat format)
+{
+    switch(format)
+    {
+    case TextureFormat::BGRA8_SRGB:
+        return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+    case TextureFormat::RGBA8:
+        return DXGI_FORMAT_R8G8B8A8_UNORM;
+    case TextureFormat::RGBA16F:
+        return DXGI_FORMAT_R16G16B16A16_FLOAT;
+    case TextureFormat::BC1:
+        return DXGI_FORMAT_BC1_UNORM;
+    case TextureFormat::BC3:
+        return DXGI_FORMAT_BC3_UNORM;
+    default:
+        return DXGI_FORMAT_B8G8R8A8_UNORM;
+    }
+}
+
+TextureFormat D3D11Backend::FromDXGI(DXGI_FORMAT format)
+{
+    switch(format)
+    {
+    case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+        return TextureFormat::BGRA8_SRGB;
+    case DXGI_FORMAT_R8G8B8A8_UNORM:
+        return TextureFormat::RGBA8;
+    case DXGI_FORMAT_R16G16B16A16_FLOAT:
+        return TextureFormat::RGBA16F;
+    case DXGI_FORMAT_BC1_UNORM:
+        return TextureFormat::BC1;
+    case DXGI_FORMAT_BC3_UNORM:
+        return TextureFormat::BC3;
+    default:
+        return TextureFormat::BGRA8;
+    }
+}
+
+std::shared_ptr<RenderTexture> D3D11Backend::Wrap(winrt::com_ptr<ID3D11Texture2D> texture, bool renderTarget)
+{
+    D3D11_TEXTURE2D_DESC desc = {};
+    texture->GetDesc(&desc);
+
+    auto wrapped          = std::make_shared<D3D11Texture>();
+    wrapped->width        = desc.Width;
+    wrapped->height       = desc.Height;
+    wrapped->mipLevels    = desc.MipLevels;
+    wrapped->format       = FromDXGI(desc.Format);
+    wrapped->renderTarget = renderTarget;
+    wrapped->resource     = texture.as<ID3D11Resource>();
+    if(desc.BindFlags & D3D11_BIND_SHADER_RESOURCE)
+    {
+        HRESULT hr = m_device->CreateShaderResourceView(texture.get(), nullptr, wrapped->view.put());
+        assert(SUCCEEDED(hr));
+    }
+    if(renderTarget)
+    {
+        HRESULT hr = m_device->CreateRenderTargetView(texture.get(), nullptr, wrapped->target.put());
+        assert(SUCCEEDED(hr));
+    }
+    return wrapped;
+}
+
+std::shared_ptr<RenderTexture> D3D11Backend::CreateTexture(const TextureDesc& desc)
+{
+    D3D11_TEXTURE2D_DESC desc2 = {};
+    desc2.Width                = desc.width;
+    desc2.Height               = desc.height;
+    desc2.MipLevels            = 1;
+    desc2.ArraySize            = 1;
+    desc2.Format               = ToDXGI(desc.format);
+    desc2.SampleDesc.Count     = 1;
+    desc2.SampleDesc.Quality   = 0;
+    desc2.Usage                = D3D11_USAGE_DEFAULT;
+    desc2.BindFlags            = D3D11_BIND_SHADER_RESOURCE | (desc.renderTarget ? D3D11_BIND_RENDER_TARGET : 0);
+    desc2.CPUAccessFlags       = 0;
+    desc2.MiscFlags            = 0;
+
+    winrt::com_ptr<ID3D11Texture2D> texture;
+    HRESULT hr = m_device->CreateTexture2D(&desc2, nullptr, texture.put());
+    assert(SUCCEEDED(hr));
+
+    return Wrap(texture, desc.renderTarget);
+}
+
+std::shared_ptr<RenderTexture> D3D11Backend::LoadTexture(const TextureDef& textureDef)
+{
+    auto decoded = TextureCache::Get(m_device, textureDef);
+    if(!decoded)
+        return nullptr;
+
+    auto texture      = std::make_shared<D3D11Texture>();
+    texture->decoded  = decoded;
+    texture->resource = decoded->resource;
+    texture->view     = decoded->view;
+
+    winrt::com_ptr<ID3D11Texture2D> texture2D;
+    if(SUCCEEDED(decoded->resource->QueryInterface(__uuidof(ID3D11Texture2D), texture2D.put_void())))
+    {
+        D3D11_TEXTURE2D_DESC desc = {};
+        texture2D->GetDesc(&desc);
+        texture->width     = desc.Width;
+        texture->height    = desc.Height;
+        texture->mipLevels = desc.MipLevels;
+        texture->format    = FromDXGI(desc.Format);
+    }
+    return texture;
+}
+
+std::shared_ptr<RenderBuffer> D3D11Backend::CreateVertexBuffer(const void* data, size_t size)
+{
+    D3D11_BUFFER_DESC vertex_buff_descr = {};
+    vertex_buff_descr.ByteWidth         = static_cast<UINT>(size);
+    vertex_buff_descr.Usage             = D3D11_USAGE_DEFAULT;
+    vertex_buff_descr.BindFlags         = D3D11_BIND_VERTEX_BUFFER;
+    D3D11_SUBRESOURCE_DATA sr_data      = {0};
+    sr_data.pSysMem                     = data;
+
+    auto buffer  = std::make_shared<D3D11Buffer>();
+    buffer->size = size;
+    HRESULT hr   = m_device->CreateBuffer(&vertex_buff_descr, &sr_data, buffer->buffer.put());
+    assert(SUCCEEDED(hr));
+    return buffer;
+}
+
+std::shared_ptr<RenderBuffer> D3D11Backend::CreateConstantBuffer(size_t size)
+{
+    D3D11_BUFFER_DESC constantBufferDesc = {};
+    constantBufferDesc.ByteWidth         = (static_cast<UINT>(size) + 0xf) & 0xfffffff0;
+    constantBufferDesc.Usage             = D3D11_USAGE_DYNAMIC;
+    constantBufferDesc.BindFlags         = D3D11_BIND_CONSTANT_BUFFER;
+    constantBufferDesc.CPUAccessFlags    = D3D11_CPU_ACCESS_WRITE;
+
+    auto buffer  = std::make_shared<D3D11Buffer>();
+    buffer->size = size;
+    HRESULT hr   = m_device->CreateBuffer(&constantBufferDesc, nullptr, buffer->buffer.put());
+    assert(SUCCEEDED(hr));
+    return buffer;
+}
+
+std::shared_ptr<RenderProgram> D3D11Backend::CreateProgram(const ShaderDef& shaderDef)
+{
+    auto program = std::make_shared<D3D11Program>();
+
+    HRESULT hr = m_device->CreateVertexShader(shaderDef.VertexByteCode, shaderDef.VertexLength, NULL, program->vertexShader.put());
+    assert(SUCCEEDED(hr));
+
+    hr = m_device->CreatePixelShader(shaderDef.FragmentByteCode, shaderDef.FragmentLength, NULL, program->pixelShader.put());
+    assert(SUCCEEDED(hr));
+
+    D3D11_INPUT_ELEMENT_DESC inputElementDesc[] = {
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 1, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0}};
+
+    hr = m_device->CreateInputLayout(inputElementDesc, ARRAYSIZE(inputElementDesc), shaderDef.VertexByteCode, shaderDef.VertexLength, program->inputLayout.put());
+    assert(SUCCEEDED(hr));
+
+    return program;
+}
+
+std::shared_ptr<RenderSampler> D3D11Backend::CreateSampler(const SamplerDesc& desc)
+{
+    D3D11_SAMPLER_DESC samplerDesc = {};
+    samplerDesc.Filter             = desc.linear ? D3D11_FILTER_MIN_MAG_MIP_LINEAR : D3D11_FILTER_MIN_MAG_MIP_POINT;
+    switch(desc.address)
+    {
+    case TextureAddress::Clamp:
+        samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+        break;
+    case TextureAddress::Wrap:
+        samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+        break;
+    case TextureAddress::Mirror:
+        samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_MIRROR;
+        break;
+    default:
+        samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_BORDER;
+        break;
+    }
+    samplerDesc.AddressV       = samplerDesc.AddressU;
+    samplerDesc.AddressW       = samplerDesc.AddressU;
+    samplerDesc.BorderColor[0] = 0.0f;
+    samplerDesc.BorderColor[1] = 0.0f;
+    samplerDesc.BorderColor[2] = 0.0f;
+    samplerDesc.BorderColor[3] = 0.0f;
+    samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+
+    auto sampler  = std::make_shared<D3D11Sampler>();
+    sampler->desc = desc;
+    m_device->CreateSamplerState(&samplerDesc, sampler->sampler.put());
+    return sampler;
+}
+
+void* D3D11Backend::Map(RenderBuffer& buffer)
+{
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    HRESULT                  hr = m_context->Map(static_cast<D3D11Buffer&>(buffer).buffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource);
+    assert(SUCCEEDED(hr));
+    return mappedSubresource.pData;
+}
+
+void D3D11Backend::Unmap(RenderBuffer& buffer)
+{
+    m_context->Unmap(static_cast<D3D11Buffer&>(buffer).buffer.get(), 0);
+}
+
+void D3D11Backend::SetViewport(float x, float y, float width, float height)
+{
+    D3D11_VIEWPORT viewport = {x, y, width, height, 0.0f, 1.0f};
+    m_context->RSSetViewports(1, &viewport);
+}
+
+void D3D11Backend::SetRenderTarget(RenderTexture* target)
+{
+    ID3D11RenderTargetView* targets[1] = {target ? static_cast<D3D11Texture*>(target)->target.get() : nullptr};
+    m_context->OMSetRenderTargets(1, targets, NULL);
+}
+
+void D3D11Backend::SetProgram(RenderProgram& program)
+{
+    auto& d3dProgram = static_cast<D3D11Program&>(program);
+    m_context->IASetInputLayout(d3dProgram.inputLayout.get());
+    m_context->VSSetShader(d3dProgram.vertexShader.get(), NULL, 0);
+    m_context->PSSetShader(d3dProgram.pixelShader.get(), NULL, 0);
+}
+
+void D3D11Backend::SetVertexBuffer(RenderBuffer& buffer, uint32_t stride)
+{
+    const UINT    offset          = 0;
+    ID3D11Buffer* vertexBuffer[1] = {static_cast<D3D11Buffer&>(buffer).buffer.get()};
+    m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+    m_context->IASetVertexBuffers(0, 1, vertexBuffer, &stride, &offset);
+}
+
+void D3D11Backend::SetTexture(int slot, RenderTexture* texture)
+{
+    ID3D11ShaderResourceView* views[1] = {texture ? static_cast<D3D11Texture*>(texture)->view.get() : nullptr};
+    m_context->PSSetShaderResources(slot, 1, views);
+}
+
+void D3D11Backend::SetSampler(int slot, RenderSampler& sampler)
+{
+    ID3D11SamplerState* samplers[1] = {static_cast<D3D11Sampler&>(sampler).sampler.get()};
+    m_context->PSSetSamplers(slot, 1, samplers);
+}
+
+void D3D11Backend::SetConstantBuffer(int slot, RenderBuffer& buffer)
+{
+    ID3D11Buffer* buffers[1] = {static_cast<D3D11Buffer&>(buffer).buffer.get()};
+    m_context->VSSetConstantBuffers(slot, 1, buffers);
+    m_context->PSSetConstantBuffers(slot, 1, buffers);
+}
+
+void D3D11Backend::Draw(uint32_t vertexCount, uint32_t startVertex)
+{
+    m_context->Draw(vertexCount, startVertex);
+}
+
+void D3D11Backend::Clear(RenderTexture& target, const float color[4])
+{
+    m_context->ClearRenderTargetView(static_cast<D3D11Texture&>(target).target.get(), color);
+}
+
+void D3D11Backend::Copy(RenderTexture& dest, RenderTexture& source)
+{
+    m_context->CopyResource(static_cast<D3D11Texture&>(dest).resource.get(), static_cast<D3D11Texture&>(source).resource.get());
+}
+
+void D3D11Backend::CopyRegion(RenderTexture& dest, RenderTexture& source, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom)
+{
+    D3D11_BOX srcBox;
+    srcBox.left   = left;
+    srcBox.right  = right;
+    srcBox.top    = top;
+    srcBox.bottom = bottom;
+    srcBox.front  = 0;
+    srcBox.back   = 1;
+    m_context->CopySubresourceRegion(static_cast<D3D11Texture&>(dest).resource.get(), 0, 0, 0, 0, static_cast<D3D11Texture&>(source).resource.get(), 0, &srcBox);
+}
+
+void D3D11Backend::Upload(RenderTexture& texture, const uint8_t* data, uint32_t pitch)
+{
+    m_context->UpdateSubresource(static_cast<D3D11Texture&>(texture).resource.get(), 0, nullptr, data, pitch, 0);
+}
+
+void D3D11Backend::Download(RenderTexture& texture, uint8_t* data, uint32_t pitch)
+{
+    D3D11_TEXTURE2D_DESC desc = {};
+    if(m_staging)
+        m_staging->GetDesc(&desc);
+
+    if(!m_staging || desc.Width != texture.width || desc.Height != texture.height || desc.Format != ToDXGI(texture.format))
+    {
+        desc                  = {};
+        desc.Width            = texture.width;
+        desc.Height           = texture.height;
+        desc.MipLevels        = 1;
+        desc.ArraySize        = 1;
+        desc.Format           = ToDXGI(texture.format);
+        desc.SampleDesc.Count = 1;
+        desc.Usage            = D3D11_USAGE_STAGING;
+        desc.CPUAccessFlags   = D3D11_CPU_ACCESS_READ;
+
+        m_staging  = nullptr;
+        HRESULT hr = m_device->CreateTexture2D(&desc, nullptr, m_staging.put());
+        assert(SUCCEEDED(hr));
+    }
+
+    m_context->CopyResource(m_staging.get(), static_cast<D3D11Texture&>(texture).resource.get());
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    HRESULT                  hr = m_context->Map(m_staging.get(), 0, D3D11_MAP_READ, 0, &mapped);
+    assert(SUCCEEDED(hr));
+    if(SUCCEEDED(hr))
+    {
+        for(UINT y = 0; y < texture.height; y++)
+            memcpy(data + static_cast<size_t>(y) * pitch, static_cast<const uint8_t*>(mapped.pData) + static_cast<size_t>(y) * mapped.RowPitch, static_cast<size_t>(texture.width) * 4);
+        m_context->Unmap(m_staging.get(), 0);
+    }
+}
+
+void D3D11Backend::Finish()
+{
+    if(!m_finishQuery)
+    {
+        D3D11_QUERY_DESC desc = {};
+        desc.Query            = D3D11_QUERY_EVENT;
+        HRESULT hr            = m_device->CreateQuery(&desc, m_finishQuery.put());
+        assert(SUCCEEDED(hr));
+    }
+
+    m_context->End(m_finishQuery.get());
+    BOOL done = FALSE;
+    while(m_context->GetData(m_finishQuery.get(), &done, sizeof(done), 0) == S_FALSE)
+        YieldProcessor();
+}
+
+std::unique_ptr<RenderTimer> D3D11Backend::CreateTimer()
+{
+    return std::make_unique<D3D11Timer>(m_device, m_context);
+}
+
+D3D11Timer::D3D11Timer(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context) : m_device {device}, m_context {context}
+{
+    D3D11_QUERY_DESC desc = {};
+    desc.Query            = D3D11_QUERY_TIMESTAMP_DISJOINT;
+    for(auto& frame : m_frames)
+    {
+        HRESULT hr = m_device->CreateQuery(&desc, frame.disjoint.put());
+        assert(SUCCEEDED(hr));
+    }
+}
+
+void D3D11Timer::BeginFrame(uint64_t frame)
+{
+    auto& current = m_frames[m_write];
+    if(current.pending)
+    {
+        // GPU is too far behind, drop the oldest frame
+        current.pending = false;
+        m_read          = (m_write + 1) % FRAMES_IN_FLIGHT;
+    }
+
+    current.frame = frame;
+    current.used  = 0;
+    m_context->Begin(current.disjoint.get());
+    Mark();
+}
+
+void D3D11Timer::Mark()
+{
+    auto& current = m_frames[m_write];
+    if(current.used == current.timestamps.size())
+    {
+        D3D11_QUERY_DESC desc = {};
+        desc.Query            = D3D11_QUERY_TIMESTAMP;
+        HRESULT hr            = m_device->CreateQuery(&desc, current.timestamps.emplace_back().put());
+        assert(SUCCEEDED(hr));
+    }
+    m_context->End(current.timestamps[current.used++].get());
+}
+
+void D3D11Timer::EndFrame()
+{
+    auto& current = m_frames[m_write];
+    Mark();
+    m_context->End(current.disjoint.get());
+    current.pending = true;
+    m_write         = (m_write + 1) % FRAMES_IN_FLIGHT;
+}
+
+bool D3D11Timer::Resolve(uint64_t& frame, std::vector<double>& marks)
+{
+    auto& oldest = m_frames[m_read];
+    if(!oldest.pending)
+        return false;
+
+    D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+    if(m_context->GetData(oldest.disjoint.get(), &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+        return false;
+
+    oldest.pending = false;
+    m_read         = (m_read + 1) % FRAMES_IN_FLIGHT;
+    if(disjoint.Disjoint || !disjoint.Frequency)
+        return false;
+
+    // timestamps precede the disjoint query so are available too
+    marks.resize(oldest.used);
+    UINT64 start = 0;
+    for(size_t m = 0; m < oldest.used; m++)
+    {
+        UINT64 timestamp = 0;
+        if(m_context->GetData(oldest.timestamps[m].get(), &timestamp, sizeof(timestamp), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+            return false;
+        if(m == 0)
+            start = timestamp;
+        marks[m] = (timestamp - start) * 1000000.0 / disjoint.Frequency;
+    }
+    frame = oldest.frame;
+    return true;
+}
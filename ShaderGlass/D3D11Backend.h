@@ -0,0 +1,104 @@
+#pragma once
+
+#include "RenderBackend.h"
+#include "TextureCache.h"
+
+struct D3D11Texture : RenderTexture
+{
+    winrt::com_ptr<ID3D11Resource>           resource;
+    winrt::com_ptr<ID3D11ShaderResourceView> view;
+    winrt::com_ptr<ID3D11RenderTargetView>   target;
+    std::shared_ptr<DecodedTexture>          decoded; // keeps shared preset textures cached
+};
+
+struct D3D11Buffer : RenderBuffer
+{
+    winrt::com_ptr<ID3D11Buffer> buffer;
+};
+
+struct D3D11Program : RenderProgram
+{
+    winrt::com_ptr<ID3D11VertexShader> vertexShader;
+    winrt::com_ptr<ID3D11PixelShader>  pixelShader;
+    winrt::com_ptr<ID3D11InputLayout>  inputLayout;
+};
+
+struct D3D11Sampler : RenderSampler
+{
+    winrt::com_ptr<ID3D11SamplerState> sampler;
+};
+
+// timestamp queries, a few frames in flight so reading them back never stalls
+class D3D11Timer : public RenderTimer
+{
+public:
+    D3D11Timer(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context);
+
+    void BeginFrame(uint64_t frame) override;
+    void Mark() override;
+    void EndFrame() override;
+    bool Resolve(uint64_t& frame, std::vector<double>& marks) override;
+
+private:
+    static constexpr int FRAMES_IN_FLIGHT = 4;
+
+    struct Frame
+    {
+        winrt::com_ptr<ID3D11Query>              disjoint {nullptr};
+        std::vector<winrt::com_ptr<ID3D11Query>> timestamps;
+        size_t                                   used {0};
+        uint64_t                                 frame {0};
+        bool                                     pending {false};
+    };
+
+    winrt::com_ptr<ID3D11Device>        m_device {nullptr};
+    winrt::com_ptr<ID3D11DeviceContext> m_context {nullptr};
+    Frame                               m_frames[FRAMES_IN_FLIGHT];
+    int                                 m_write {0};
+    int                                 m_read {0};
+};
+
+class D3D11Backend : public RenderBackend
+{
+public:
+    D3D11Backend(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context);
+
+    // use textures created outside of the backend, i.e. captured frames and swapchain buffers
+    std::shared_ptr<RenderTexture> Wrap(winrt::com_ptr<ID3D11Texture2D> texture, bool renderTarget);
+
+    std::shared_ptr<RenderTexture> CreateTexture(const TextureDesc& desc) override;
+    std::shared_ptr<RenderTexture> LoadTexture(const TextureDef& textureDef) override;
+    std::shared_ptr<RenderBuffer>  CreateVertexBuffer(const void* data, size_t size) override;
+    std::shared_ptr<RenderBuffer>  CreateConstantBuffer(size_t size) override;
+    std::shared_ptr<RenderProgram> CreateProgram(const ShaderDef& shaderDef) override;
+    std::shared_ptr<RenderSampler> CreateSampler(const SamplerDesc& desc) override;
+
+    void* Map(RenderBuffer& buffer) override;
+    void  Unmap(RenderBuffer& buffer) override;
+    void  SetViewport(float x, float y, float width, float height) override;
+    void  SetRenderTarget(RenderTexture* target) override;
+    void  SetProgram(RenderProgram& program) override;
+    void  SetVertexBuffer(RenderBuffer& buffer, uint32_t stride) override;
+    void  SetTexture(int slot, RenderTexture* texture) override;
+    void  SetSampler(int slot, RenderSampler& sampler) override;
+    void  SetConstantBuffer(int slot, RenderBuffer& buffer) override;
+    void  Draw(uint32_t vertexCount, uint32_t startVertex) override;
+    void  Clear(RenderTexture& target, const float color[4]) override;
+    void  Copy(RenderTexture& dest, RenderTexture& source) override;
+    void  CopyRegion(RenderTexture& dest, RenderTexture& source, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) override;
+    void  Upload(RenderTexture& texture, const uint8_t* data, uint32_t pitch) override;
+    void  Download(RenderTexture& texture, uint8_t* data, uint32_t pitch) override;
+    void  Finish() override;
+
+    std::unique_ptr<RenderTimer> CreateTimer() override;
+
+    static DXGI_FORMAT   ToDXGI(TextureFormat format);
+    static TextureFormat FromDXGI(DXGI_FORMAT format);
+
+private:
+    winrt::com_ptr<ID3D11Device>          m_device {nullptr};
+    winrt::com_ptr<ID3D11DeviceContext>   m_context {nullptr};
+    winrt::com_ptr<ID3D11RasterizerState> m_rasterizerState {nullptr};
+    winrt::com_ptr<ID3D11Texture2D>       m_staging {nullptr}; // reused for downloads of the same size
+    winrt::com_ptr<ID3D11Query>           m_finishQuery {nullptr};
+};
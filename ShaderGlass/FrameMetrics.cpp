@@ -0,0 +1,153 @@
+#include "pch.h"
+
+#include "FrameMetrics.h"
+
+void FrameHistogram::Add(float ms)
+{
+    const auto bucket = static_cast<int>(ms / BUCKET_MS);
+    m_buckets[bucket < 0 ? 0 : (bucket >= BUCKETS ? BUCKETS - 1 : bucket)]++;
+    m_count++;
+    m_sum += ms;
+    m_max = max(m_max, ms);
+}
+
+void FrameHistogram::Reset()
+{
+    m_buckets.fill(0);
+    m_count = 0;
+    m_sum   = 0;
+    m_max   = 0;
+}
+
+float FrameHistogram::Percentile(float p) const
+{
+    if(m_count == 0)
+        return 0.0f;
+
+    // upper edge of the bucket holding the nearest-rank sample
+    const auto rank = max(1, static_cast<int>(ceilf(p * m_count)));
+    int        seen = 0;
+    for(int b = 0; b < BUCKETS; b++)
+    {
+        seen += m_buckets[b];
+        if(seen >= rank)
+            return min((b + 1) * BUCKET_MS, m_max);
+    }
+    return m_max;
+}
+
+FrameMetrics::FrameMetrics()
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    m_frequency     = frequency.QuadPart;
+    m_intervalStart = Now();
+}
+
+int64_t FrameMetrics::Now()
+{
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+int64_t FrameMetrics::FromSystemRelativeTime(int64_t hundredNanoseconds)
+{
+    // SystemRelativeTime is QPC converted to 100 ns units
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<int64_t>(hundredNanoseconds * (frequency.QuadPart / 10000000.0));
+}
+
+void FrameMetrics::SetLog(const std::wstring& fileName)
+{
+    std::unique_lock lock(m_mutex);
+    if(m_log.is_open())
+        m_log.close();
+    if(!fileName.empty())
+        m_log.open(fileName, std::ios::out | std::ios::app);
+}
+
+void FrameMetrics::Rendered(uint64_t sequence, int64_t captured, int64_t renderStart, int64_t renderEnd, int64_t presented)
+{
+    m_rendered++;
+    const bool duplicate = sequence && sequence == m_lastSequence;
+    const auto skipped   = m_skippedSinceRendered.exchange(0);
+    if(sequence)
+    {
+        if(duplicate)
+            m_duplicated++;
+        else if(m_lastSequence && sequence > m_lastSequence + 1)
+        {
+            // frames skipped on purpose are already counted as skipped
+            const auto gap = sequence - m_lastSequence - 1;
+            m_dropped += gap - min(gap, skipped);
+        }
+        m_lastSequence = sequence;
+    }
+
+    if(m_lastPresented)
+        m_frameTimes.Add(ToMs(presented - m_lastPresented));
+    m_lastPresented = presented;
+    m_renderTimes.Add(ToMs(renderEnd - renderStart));
+
+    // a repeated capture is no newer than before, only new ones count towards latency
+    if(captured && !duplicate)
+    {
+        const auto latency = ToMs(presented - captured);
+        m_latencies.Add(latency);
+        if(latency > m_latencyBudgetMs)
+            m_late++;
+    }
+
+    m_intervalFrames++;
+    if(ToMs(presented - m_intervalStart) >= INTERVAL_MS)
+        CloseInterval(presented);
+}
+
+void FrameMetrics::CloseInterval(int64_t now)
+{
+    FrameStats stats;
+    stats.rendered      = m_rendered;
+    stats.dropped       = m_dropped;
+    stats.skipped       = m_skipped;
+    stats.duplicated    = m_duplicated;
+    stats.late          = m_late;
+    stats.fps           = m_intervalFrames * 1000.0f / max(ToMs(now - m_intervalStart), 1.0f);
+    stats.frameTimeMean = m_frameTimes.Mean();
+    stats.frameTimeP50  = m_frameTimes.Percentile(0.50f);
+    stats.frameTimeP95  = m_frameTimes.Percentile(0.95f);
+    stats.frameTimeP99  = m_frameTimes.Percentile(0.99f);
+    stats.frameTimeMax  = m_frameTimes.Max();
+    stats.latencyMean   = m_latencies.Mean();
+    stats.latencyP50    = m_latencies.Percentile(0.50f);
+    stats.latencyP95    = m_latencies.Percentile(0.95f);
+    stats.latencyP99    = m_latencies.Percentile(0.99f);
+    stats.latencyMax    = m_latencies.Max();
+    stats.renderMean    = m_renderTimes.Mean();
+    stats.renderP99     = m_renderTimes.Percentile(0.99f);
+
+    m_frameTimes.Reset();
+    m_latencies.Reset();
+    m_renderTimes.Reset();
+    m_intervalFrames = 0;
+    m_intervalStart  = now;
+
+    std::unique_lock lock(m_mutex);
+    m_stats = stats;
+    if(m_log.is_open())
+    {
+        m_log << std::fixed << std::setprecision(3) << "{\"time\":" << ToMs(now) / 1000.0f << ",\"fps\":" << stats.fps << ",\"rendered\":" << stats.rendered
+              << ",\"dropped\":" << stats.dropped << ",\"skipped\":" << stats.skipped << ",\"duplicated\":" << stats.duplicated << ",\"late\":" << stats.late
+              << ",\"frameTimeMs\":{\"mean\":" << stats.frameTimeMean << ",\"p50\":" << stats.frameTimeP50 << ",\"p95\":" << stats.frameTimeP95
+              << ",\"p99\":" << stats.frameTimeP99 << ",\"max\":" << stats.frameTimeMax << "},\"latencyMs\":{\"mean\":" << stats.latencyMean
+              << ",\"p50\":" << stats.latencyP50 << ",\"p95\":" << stats.latencyP95 << ",\"p99\":" << stats.latencyP99 << ",\"max\":" << stats.latencyMax
+              << "},\"renderMs\":{\"mean\":" << stats.renderMean << ",\"p99\":" << stats.renderP99 << "}}" << std::endl;
+    }
+}
+
+FrameStats FrameMetrics::Stats() const
+{
+    std::unique_lock lock(m_mutex);
+    return m_stats;
+}
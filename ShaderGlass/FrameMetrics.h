@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+// fixed-width buckets, cheap enough to fill every frame
+class FrameHistogram
+{
+public:
+    static constexpr float BUCKET_MS = 0.25f;
+    static constexpr int   BUCKETS   = 400; // up to 100 ms, beyond goes to the last bucket
+
+    void  Add(float ms);
+    void  Reset();
+    float Percentile(float p) const;
+    float Mean() const { return m_count ? static_cast<float>(m_sum / m_count) : 0.0f; }
+    float Max() const { return m_max; }
+    int   Count() const { return m_count; }
+
+private:
+    std::array<int, BUCKETS> m_buckets {};
+    int                      m_count {0};
+    double                   m_sum {0};
+    float                    m_max {0};
+};
+
+struct FrameStats
+{
+    // counters since start
+    uint64_t rendered {0};
+    uint64_t dropped {0};    // captured frames never rendered, or arriving while still rendering
+    uint64_t skipped {0};    // left out on purpose by the FPS divider
+    uint64_t duplicated {0}; // rendered again with no new capture
+    uint64_t late {0};       // capture-to-present latency over the budget
+
+    // over the last completed interval
+    float fps {0};
+    float frameTimeMean {0}, frameTimeP50 {0}, frameTimeP95 {0}, frameTimeP99 {0}, frameTimeMax {0}; // present to present
+    float latencyMean {0}, latencyP50 {0}, latencyP95 {0}, latencyP99 {0}, latencyMax {0};           // capture to present
+    float renderMean {0}, renderP99 {0};                                                             // render start to end
+};
+
+// frame pacing and latency from QueryPerformanceCounter timestamps; capture times use the same clock
+// (SystemRelativeTime of captured frames) so latency is end-to-end
+class FrameMetrics
+{
+public:
+    FrameMetrics();
+
+    static int64_t Now(); // QPC ticks
+    static int64_t FromSystemRelativeTime(int64_t hundredNanoseconds);
+
+    void SetLatencyBudget(float ms) { m_latencyBudgetMs = ms; }
+    void SetLog(const std::wstring& fileName); // one JSON line per interval, empty to stop
+
+    // captured is 0 when unknown (image input), arrival sequence detects drops and duplicates
+    void Rendered(uint64_t sequence, int64_t captured, int64_t renderStart, int64_t renderEnd, int64_t presented);
+    void Dropped() { m_dropped++; }
+    void Skipped(uint64_t sequence)
+    {
+        m_skipped++;
+        if(sequence)
+            m_skippedSinceRendered++;
+    }
+
+    FrameStats Stats() const;
+
+private:
+    void CloseInterval(int64_t now);
+    float ToMs(int64_t ticks) const { return static_cast<float>(ticks * 1000.0 / m_frequency); }
+
+    static constexpr int INTERVAL_MS = 1000;
+
+    int64_t  m_frequency {1};
+    float    m_latencyBudgetMs {1000.0f / 60.0f};
+    uint64_t m_lastSequence {0};
+    int64_t  m_lastPresented {0};
+    int64_t  m_intervalStart {0};
+    int      m_intervalFrames {0};
+
+    std::atomic<uint64_t> m_dropped {0};
+    std::atomic<uint64_t> m_skipped {0};
+    std::atomic<uint64_t> m_skippedSinceRendered {0}; // part of the next sequence gap which is not a drop
+    uint64_t              m_rendered {0};
+    uint64_t              m_duplicated {0};
+    uint64_t              m_late {0};
+
+    FrameHistogram m_frameTimes;
+    FrameHistogram m_latencies;
+    FrameHistogram m_renderTimes;
+
+    mutable std::mutex m_mutex {};
+    FrameStats         m_stats; // last completed interval
+    std::ofstream      m_log;
+};
@@ -0,0 +1,264 @@
+#include "pch.h"
+
+#include "HeadlessChain.h"
+#include "RecordingBackend.h"
+
+static const float background_colour[4] = {0, 0, 0, 1.0f};
+
+HeadlessChain::HeadlessChain(std::shared_ptr<RenderBackend> backend, PresetDef& presetDef) :
+    m_backend {backend}, m_preset(presetDef), m_preprocessPreset(m_preprocessPresetDef), m_preprocessShader(m_preprocessShaderDef),
+    m_preprocessPass(m_preprocessShader, m_preprocessPreset, true)
+{
+    m_preprocessShader.Create(*m_backend);
+    m_preprocessPass.Initialize(m_backend);
+
+    m_preset.Create(*m_backend);
+    m_passes.reserve(m_preset.m_shaders.size());
+    for(auto& shader : m_preset.m_shaders)
+    {
+        m_passes.emplace_back(shader, m_preset, m_backend);
+    }
+
+    // defaults and preset overrides, as in ShaderGlass::ResetParams
+    for(auto& s : m_preset.m_shaders)
+        for(auto& p : s.Params())
+        {
+            if(p->size == 4 && p->name != "FrameCount")
+            {
+                auto value = &p->defaultValue;
+                for(auto& o : m_preset.m_presetDef.Overrides)
+                {
+                    if(o.name == p->name)
+                    {
+                        value = &o.value;
+                        break;
+                    }
+                }
+                s.SetParam(p, value);
+            }
+        }
+}
+
+HeadlessChain::~HeadlessChain()
+{
+    m_passes.clear();
+    m_passResources.clear();
+    m_passTextures.clear();
+}
+
+bool HeadlessChain::SetParam(const std::string& name, float value)
+{
+    bool found = false;
+    for(auto& s : m_preset.m_shaders)
+        for(auto& p : s.Params())
+        {
+            if(p->size == 4 && p->name == name)
+            {
+                p->currentValue = value;
+                s.SetParam(p, &p->currentValue);
+                found = true;
+            }
+        }
+    return found;
+}
+
+size_t HeadlessChain::TextureBytes() const
+{
+    size_t bytes = 0;
+    for(const auto& texture : m_passTextures)
+        bytes += RecordingBackend::TextureSize(*texture);
+    if(m_original)
+        bytes += RecordingBackend::TextureSize(*m_original);
+    if(m_output)
+        bytes += RecordingBackend::TextureSize(*m_output);
+    return bytes;
+}
+
+size_t HeadlessChain::PresetTextureBytes() const
+{
+    size_t bytes = 0;
+    for(const auto& texture : m_preset.m_textures)
+    {
+        if(texture.second.m_texture)
+            bytes += RecordingBackend::TextureSize(*texture.second.m_texture);
+    }
+    return bytes;
+}
+
+void HeadlessChain::Resize(uint32_t inputWidth, uint32_t inputHeight, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight, TextureFormat inputFormat)
+{
+    m_passTextures.clear();
+    m_passResources.clear();
+    m_requiresFeedback = false;
+    m_requiresHistory  = 0;
+    if(m_passes.empty())
+        return;
+
+    m_original = m_backend->CreateTexture({originalWidth, originalHeight, inputFormat, true});
+    m_output   = m_backend->CreateTexture({outputWidth, outputHeight, TextureFormat::BGRA8, true});
+
+    // pass sizes, same rules as the interactive chain
+    std::map<std::string, float4> textureSizes;
+    textureSizes.insert(std::make_pair("Original", float4 {(float)originalWidth, (float)originalHeight, 1.0f / originalWidth, 1.0f / originalHeight}));
+    textureSizes.insert(std::make_pair("FinalViewport", float4 {(float)outputWidth, (float)outputHeight, 1.0f / outputWidth, 1.0f / outputHeight}));
+
+    std::vector<std::array<UINT, 4>> passSizes;
+    m_preprocessPass.Resize(inputWidth, inputHeight, originalWidth, originalHeight, textureSizes, passSizes);
+    m_preprocessPass.UpdateMVP(1.0f, 1.0f, 0.0001f, 0.0001f);
+
+    UINT sourceWidth  = originalWidth;
+    UINT sourceHeight = originalHeight;
+    for(size_t p = 0; p < m_passes.size(); p++)
+    {
+        const auto& shader = m_passes[p].m_shader;
+        if(p == m_passes.size() - 1)
+        {
+            passSizes.push_back({sourceWidth, sourceHeight, outputWidth, outputHeight});
+            break;
+        }
+
+        UINT passWidth, passHeight;
+        if(shader.m_scaleViewportX)
+            passWidth = static_cast<UINT>(outputWidth * shader.m_scaleX);
+        else if(shader.m_scaleAbsoluteX)
+            passWidth = static_cast<UINT>(shader.m_scaleX);
+        else
+            passWidth = static_cast<UINT>(sourceWidth * shader.m_scaleX);
+        if(shader.m_scaleViewportY)
+            passHeight = static_cast<UINT>(outputHeight * shader.m_scaleY);
+        else if(shader.m_scaleAbsoluteY)
+            passHeight = static_cast<UINT>(shader.m_scaleY);
+        else
+            passHeight = static_cast<UINT>(sourceHeight * shader.m_scaleY);
+        passSizes.push_back({sourceWidth, sourceHeight, passWidth, passHeight});
+        if(!shader.m_alias.empty())
+        {
+            textureSizes.insert(std::make_pair(shader.m_alias, float4 {(float)passWidth, (float)passHeight, 1.0f / passWidth, 1.0f / passHeight}));
+        }
+        sourceWidth  = passWidth;
+        sourceHeight = passHeight;
+    }
+    for(size_t p = 0; p < m_passes.size(); p++)
+    {
+        m_passes[p].Resize(passSizes[p][0], passSizes[p][1], passSizes[p][2], passSizes[p][3], textureSizes, passSizes);
+    }
+
+    // intermediate targets
+    for(auto& texture : m_preset.m_textures)
+    {
+        m_passResources.insert(std::make_pair(texture.second.m_name, texture.second.m_texture));
+    }
+    m_passResources.insert(std::make_pair("Original", m_original));
+    m_preprocessPass.m_target = m_original.get();
+
+    for(const auto& pass : m_passes)
+    {
+        m_requiresFeedback |= pass.RequiresFeedback();
+        m_requiresHistory = max(m_requiresHistory, pass.RequiresHistory());
+    }
+
+    for(size_t p = 1; p < m_passes.size(); p++)
+    {
+        const auto& pass = m_passes[p - 1];
+
+        TextureDesc passDesc;
+        passDesc.width        = pass.m_destWidth;
+        passDesc.height       = pass.m_destHeight;
+        passDesc.renderTarget = true;
+        if(pass.m_shader.m_formatFloat)
+            passDesc.format = TextureFormat::RGBA16F;
+        else if(pass.m_shader.m_formatSRGB)
+            passDesc.format = TextureFormat::BGRA8_SRGB;
+        else
+            passDesc.format = TextureFormat::BGRA8;
+
+        auto passResource = m_backend->CreateTexture(passDesc);
+        m_passTextures.push_back(passResource);
+        m_passResources.insert(std::make_pair(std::string("PassOutput") + std::to_string(p - 1), passResource));
+        if(!pass.m_shader.m_alias.empty())
+        {
+            m_passResources.insert(std::make_pair(pass.m_shader.m_alias, passResource));
+        }
+
+        if(m_requiresFeedback)
+        {
+            passDesc.renderTarget = false;
+
+            auto feedbackResource = m_backend->CreateTexture(passDesc);
+            m_passTextures.push_back(feedbackResource);
+            m_passResources.insert(std::make_pair(std::string("PassFeedback") + std::to_string(p - 1), feedbackResource));
+            if(!pass.m_shader.m_alias.empty())
+            {
+                m_passResources.insert(std::make_pair(pass.m_shader.m_alias + "Feedback", feedbackResource));
+            }
+        }
+
+        m_passes[p - 1].m_target = passResource.get();
+        m_passes[p].m_source     = passResource.get();
+    }
+
+    for(int h = 0; h < m_requiresHistory; h++)
+    {
+        auto historyResource = m_backend->CreateTexture({originalWidth, originalHeight, inputFormat, false});
+        m_passTextures.push_back(historyResource);
+        m_passResources.insert(std::make_pair(std::string("OriginalHistory") + std::to_string(h + 1), historyResource));
+    }
+
+    m_passes[m_passes.size() - 1].m_target = m_output.get();
+    if(m_requiresFeedback)
+    {
+        const int p                = static_cast<int>(m_passes.size()) - 1;
+        auto      feedbackResource = m_backend->CreateTexture({outputWidth, outputHeight, TextureFormat::BGRA8, false});
+        m_passTextures.push_back(feedbackResource);
+        m_passResources.insert(std::make_pair(std::string("PassFeedback") + std::to_string(p), feedbackResource));
+        if(!m_passes[p].m_shader.m_alias.empty())
+        {
+            m_passResources.insert(std::make_pair(m_passes[p].m_shader.m_alias + "Feedback", feedbackResource));
+        }
+    }
+
+    m_backend->Clear(*m_output, background_colour);
+}
+
+RenderTexture* HeadlessChain::Render(RenderTexture* input, int frameCount)
+{
+    if(!m_output || m_passes.empty())
+        return nullptr;
+
+    m_preprocessPass.Render(input, m_passResources, frameCount, 0, 0);
+    for(size_t p = 0; p < m_passes.size(); p++)
+    {
+        if(p == 0)
+            m_passes[p].Render(m_original.get(), m_passResources, frameCount, 0, 0);
+        else
+            m_passes[p].Render(m_passResources, frameCount, 0, 0);
+    }
+
+    if(m_requiresFeedback)
+    {
+        for(size_t q = 0; q < m_passes.size(); q++)
+        {
+            auto passFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(q));
+            if(q == m_passes.size() - 1)
+                m_backend->Copy(*passFeedback->second, *m_output);
+            else
+                m_backend->Copy(*passFeedback->second, *m_passResources.find(std::string("PassOutput") + std::to_string(q))->second);
+        }
+    }
+
+    if(m_requiresHistory)
+    {
+        auto lastHistory = m_passResources.find(std::string("OriginalHistory" + std::to_string(m_requiresHistory)))->second;
+        for(int h = m_requiresHistory; h > 1; h--)
+        {
+            m_passResources[std::string("OriginalHistory" + std::to_string(h))] = m_passResources[std::string("OriginalHistory" + std::to_string(h - 1))];
+        }
+        m_backend->Copy(*lastHistory, *m_original);
+        if(m_requiresHistory > 1)
+        {
+            m_passResources["OriginalHistory1"] = lastHistory;
+        }
+    }
+
+    return m_output.get();
+}
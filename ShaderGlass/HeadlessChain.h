@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Preset.h"
+#include "ShaderPass.h"
+#include "Shaders\PreprocessShaderDef.h"
+
+// preset chain rendering into an offscreen target, without window or swapchain
+class HeadlessChain
+{
+public:
+    HeadlessChain(std::shared_ptr<RenderBackend> backend, PresetDef& presetDef);
+    ~HeadlessChain();
+
+    // applies to every pass declaring the parameter
+    bool SetParam(const std::string& name, float value);
+
+    // original is the preprocessed input, i.e. input divided by pixel size
+    void Resize(uint32_t inputWidth, uint32_t inputHeight, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight, TextureFormat inputFormat);
+
+    RenderTexture* Render(RenderTexture* input, int frameCount = 1);
+    size_t         Passes() const { return m_passes.size(); }
+    uint32_t       OutputWidth() const { return m_output ? m_output->width : 0; }
+    uint32_t       OutputHeight() const { return m_output ? m_output->height : 0; }
+
+    // memory of intermediate targets (incl. original, history and feedback) and of static preset textures
+    size_t TextureBytes() const;
+    size_t PresetTextureBytes() const;
+
+private:
+    std::shared_ptr<RenderBackend> m_backend;
+    Preset                         m_preset;
+    std::vector<ShaderPass>        m_passes;
+    PreprocessShaderDef            m_preprocessShaderDef;
+    PresetDef                      m_preprocessPresetDef;
+    Preset                         m_preprocessPreset;
+    Shader                         m_preprocessShader;
+    ShaderPass                     m_preprocessPass;
+
+    std::shared_ptr<RenderTexture>                        m_original {nullptr};
+    std::shared_ptr<RenderTexture>                        m_output {nullptr};
+    std::vector<std::shared_ptr<RenderTexture>>           m_passTextures;
+    std::map<std::string, std::shared_ptr<RenderTexture>> m_passResources;
+    bool                                                  m_requiresFeedback {false};
+    int                                                   m_requiresHistory {0};
+};
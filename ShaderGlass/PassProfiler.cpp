@@ -0,0 +1,201 @@
+#include "pch.h"
+
+#include "PassProfiler.h"
+
+// frames awaiting GPU timestamps before they are given up on
+static const size_t MAX_PENDING_FRAMES = 16;
+
+PassProfiler::PassProfiler(size_t capacity, size_t window) : m_epoch {std::chrono::steady_clock::now()}, m_window {max(window, (size_t)1)}, m_events(max(capacity, (size_t)1)) { }
+
+double PassProfiler::Now() const
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+void PassProfiler::SetTimer(std::unique_ptr<RenderTimer> timer)
+{
+    m_timer = std::move(timer);
+    m_pending.clear();
+
+    std::unique_lock lock(m_mutex);
+    m_gpu = m_timer != nullptr;
+}
+
+uint32_t PassProfiler::Register(const std::string& name)
+{
+    std::unique_lock lock(m_mutex);
+    const auto       existing = m_sectionIds.find(name);
+    if(existing != m_sectionIds.end())
+        return existing->second;
+
+    const auto id = static_cast<uint32_t>(m_sectionNames.size());
+    m_sectionIds.insert(std::make_pair(name, id));
+    m_sectionNames.push_back(name);
+    m_stats.emplace_back().samples.resize(m_window);
+    return id;
+}
+
+void PassProfiler::BeginFrame()
+{
+    m_current.frame = m_frame++;
+    m_current.start = Now();
+    m_current.sections.clear();
+    m_marks.clear();
+    if(m_timer)
+        m_timer->BeginFrame(m_current.frame);
+    else
+        m_marks.push_back(0);
+}
+
+void PassProfiler::Section(uint32_t section)
+{
+    if(!m_current.sections.empty())
+    {
+        if(m_timer)
+            m_timer->Mark();
+        else
+            m_marks.push_back(Now() - m_current.start);
+    }
+    m_current.sections.push_back(section);
+}
+
+void PassProfiler::EndFrame()
+{
+    if(!m_timer)
+    {
+        m_marks.push_back(Now() - m_current.start);
+        Record(m_current.frame, m_current.start, m_current.sections, m_marks);
+        return;
+    }
+
+    m_timer->EndFrame();
+    m_pending.push_back(std::move(m_current));
+    m_current = PendingFrame();
+    if(m_pending.size() > MAX_PENDING_FRAMES)
+        m_pending.pop_front();
+
+    uint64_t frame;
+    while(m_timer->Resolve(frame, m_marks))
+    {
+        // frames the timer dropped have no timestamps
+        while(!m_pending.empty() && m_pending.front().frame < frame)
+            m_pending.pop_front();
+        if(!m_pending.empty() && m_pending.front().frame == frame)
+        {
+            Record(frame, m_pending.front().start, m_pending.front().sections, m_marks);
+            m_pending.pop_front();
+        }
+    }
+}
+
+void PassProfiler::Record(uint64_t frame, double frameStart, const std::vector<uint32_t>& sections, const std::vector<double>& marks)
+{
+    std::unique_lock lock(m_mutex);
+    for(size_t s = 0; s < sections.size() && s + 1 < marks.size(); s++)
+    {
+        if(sections[s] >= m_stats.size())
+            continue;
+
+        ProfileEvent& event = m_events[m_nextEvent];
+        event.frame         = frame;
+        event.section       = sections[s];
+        event.start         = frameStart + marks[s];
+        event.duration      = static_cast<float>(marks[s + 1] - marks[s]);
+        m_nextEvent         = (m_nextEvent + 1) % m_events.size();
+        m_eventCount        = min(m_eventCount + 1, m_events.size());
+
+        // rolling window, the running sum drops the sample being replaced
+        auto& stats = m_stats[sections[s]];
+        if(stats.count == m_window)
+            stats.sum -= stats.samples[stats.next];
+        else
+            stats.count++;
+        stats.samples[stats.next] = event.duration;
+        stats.sum += event.duration;
+        stats.next = (stats.next + 1) % m_window;
+        stats.last = event.duration;
+    }
+    if(marks.size() > 1)
+    {
+        m_recorded++;
+        m_lastFrameMs = static_cast<float>(marks.back() - marks.front()) / 1000.0f;
+    }
+}
+
+uint64_t PassProfiler::Recorded(float& lastFrameMs) const
+{
+    std::unique_lock lock(m_mutex);
+    lastFrameMs = m_lastFrameMs;
+    return m_recorded;
+}
+
+std::vector<SectionTiming> PassProfiler::Averages() const
+{
+    std::unique_lock           lock(m_mutex);
+    std::vector<SectionTiming> timings;
+    for(size_t s = 0; s < m_stats.size(); s++)
+    {
+        const auto& stats = m_stats[s];
+        if(stats.count == 0)
+            continue;
+
+        SectionTiming timing;
+        timing.name      = m_sectionNames[s];
+        timing.averageMs = static_cast<float>(stats.sum / stats.count / 1000.0);
+        timing.lastMs    = stats.last / 1000.0f;
+        timings.push_back(timing);
+    }
+    return timings;
+}
+
+static std::string jsonString(const std::string& s)
+{
+    std::string escaped = "\"";
+    for(auto c : s)
+    {
+        if(c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+std::string PassProfiler::ChromeTrace() const
+{
+    std::unique_lock   lock(m_mutex);
+    std::ostringstream trace;
+    trace << std::fixed << std::setprecision(3);
+    trace << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    trace << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":" << (m_gpu ? "\"GPU\"" : "\"CPU\"") << "}}";
+    const auto first = (m_nextEvent + m_events.size() - m_eventCount) % m_events.size();
+    for(size_t e = 0; e < m_eventCount; e++)
+    {
+        const auto& event = m_events[(first + e) % m_events.size()];
+        trace << ",\n{\"name\":" << jsonString(m_sectionNames[event.section]) << ",\"cat\":\"pass\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << event.start
+              << ",\"dur\":" << event.duration << ",\"args\":{\"frame\":" << event.frame << "}}";
+    }
+    trace << "\n]}\n";
+    return trace.str();
+}
+
+bool PassProfiler::ExportChromeTrace(const std::wstring& fileName) const
+{
+    const auto    trace = ChromeTrace();
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc | std::ios::binary);
+    file << trace;
+    return file.good();
+}
+
+void PassProfiler::Clear()
+{
+    std::unique_lock lock(m_mutex);
+    for(auto& stats : m_stats)
+    {
+        stats.next  = 0;
+        stats.count = 0;
+        stats.sum   = 0;
+        stats.last  = 0;
+    }
+    m_nextEvent  = 0;
+    m_eventCount = 0;
+}
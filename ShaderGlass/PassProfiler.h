@@ -0,0 +1,87 @@
+#pragma once
+
+#include "RenderBackend.h"
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct ProfileEvent
+{
+    uint64_t frame {0};
+    uint32_t section {0};
+    double   start {0};    // microseconds since the profiler was created
+    float    duration {0}; // microseconds
+};
+
+struct SectionTiming
+{
+    std::string name;
+    float       averageMs {0}; // over the last frames in the window
+    float       lastMs {0};
+};
+
+// per-section frame timings, from backend timestamps where available or wall-clock otherwise;
+// sections are consecutive (passes, copies) so each one ends where the next begins
+class PassProfiler
+{
+public:
+    PassProfiler(size_t capacity = 16384, size_t window = 60);
+
+    void SetTimer(std::unique_ptr<RenderTimer> timer); // nullptr for wall-clock
+
+    // section names are interned once, ids are stable for the lifetime of the profiler
+    uint32_t Register(const std::string& name);
+
+    void BeginFrame();
+    void Section(uint32_t section);
+    void EndFrame();
+
+    std::vector<SectionTiming> Averages() const;
+    uint64_t                   Recorded(float& lastFrameMs) const; // frames recorded so far, duration of the latest
+    std::string                ChromeTrace() const; // trace event format JSON, for chrome://tracing or Perfetto
+    bool                       ExportChromeTrace(const std::wstring& fileName) const;
+    void                       Clear();
+
+    // for aggregation without a renderer: sections in order and marks[n + 1] from the frame start in microseconds
+    void Record(uint64_t frame, double frameStart, const std::vector<uint32_t>& sections, const std::vector<double>& marks);
+
+private:
+    struct PendingFrame
+    {
+        uint64_t              frame {0};
+        double                start {0};
+        std::vector<uint32_t> sections;
+    };
+
+    struct SectionStats
+    {
+        std::vector<float> samples; // window of durations in microseconds
+        size_t             next {0};
+        size_t             count {0};
+        double             sum {0};
+        float              last {0};
+    };
+
+    double Now() const;
+
+    std::unique_ptr<RenderTimer>          m_timer {nullptr};
+    std::chrono::steady_clock::time_point m_epoch;
+    size_t                                m_window;
+    uint64_t                              m_frame {0};
+    PendingFrame                          m_current;
+    std::vector<double>                   m_marks; // wall-clock, or scratch for resolving
+    std::deque<PendingFrame>              m_pending;
+
+    mutable std::mutex                        m_mutex {};
+    bool                                      m_gpu {false};
+    std::unordered_map<std::string, uint32_t> m_sectionIds;
+    std::vector<std::string>                  m_sectionNames;
+    std::vector<SectionStats>                 m_stats;
+    std::vector<ProfileEvent>                 m_events; // ring buffer, oldest overwritten
+    size_t                                    m_nextEvent {0};
+    size_t                                    m_eventCount {0};
+    uint64_t                                  m_recorded {0};
+    float                                     m_lastFrameMs {0};
+};
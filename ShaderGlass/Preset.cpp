@@ -1,14 +1,24 @@
 #include "pch.h"
 
 #include "Preset.h"
+#include <mutex>
+
+// definitions are built on first use, from the build thread as well as the UI
+static std::mutex s_buildMutex;
 
 Preset::Preset(PresetDef& presetDef) : m_presetDef(presetDef), m_shaders {}
 {
+    Build(presetDef);
+}
+
+void Preset::Build(PresetDef& presetDef)
+{
+    std::scoped_lock lock(s_buildMutex);
     if(presetDef.ShaderDefs.empty())
         presetDef.Build();
 }
 
-void Preset::Create(winrt::com_ptr<ID3D11Device> d3dDevice)
+void Preset::Create(RenderBackend& backend)
 {
     m_shaders.reserve(m_presetDef.ShaderDefs.size());
     for(auto& sd : m_presetDef.ShaderDefs)
@@ -17,15 +27,17 @@ void Preset::Create(winrt::com_ptr<ID3D11Device> d3dDevice)
     }
     for(auto& td : m_presetDef.TextureDefs)
     {
-        m_textures.emplace(td.PresetParams["name"], td);
+        // definitions are shared with other threads, so look up without inserting
+        const auto name = td.PresetParams.find("name");
+        m_textures.emplace(name != td.PresetParams.end() ? name->second : std::string(), td);
     }
     for(auto& s : m_shaders)
     {
-        s.Create(d3dDevice);
+        s.Create(backend);
     }
     for(auto& t : m_textures)
     {
-        t.second.Create(d3dDevice);
+        t.second.Create(backend);
     }
 }
 
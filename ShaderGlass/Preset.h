@@ -8,7 +8,9 @@ class Preset
 {
 public:
     Preset(PresetDef& presetDef);
-    void Create(winrt::com_ptr<ID3D11Device> d3dDevice);
+    void Create(RenderBackend& backend);
+
+    static void Build(PresetDef& presetDef); // definitions are built on first use, from any thread
 
     PresetDef&                     m_presetDef;
     std::vector<Shader>            m_shaders;
@@ -0,0 +1,175 @@
+#include "pch.h"
+
+#include "PresetCache.h"
+#include "TextureMemory.h"
+
+PresetCache::PresetCache(size_t budget) : m_budget(budget) { }
+
+std::unique_ptr<PresetBuild> PresetCache::Take(const PresetDef* presetDef)
+{
+    std::unique_lock lock(m_mutex);
+    for(auto it = m_builds.begin(); it != m_builds.end(); it++)
+    {
+        if(&(*it)->preset->m_presetDef == presetDef)
+        {
+            auto build = std::move(*it);
+            m_builds.erase(it);
+            Remove(*build);
+            m_hits++;
+            return build;
+        }
+    }
+    m_misses++;
+    return nullptr;
+}
+
+void PresetCache::Store(std::unique_ptr<PresetBuild> build)
+{
+    if(!build || !build->preset)
+        return;
+
+    std::unique_lock lock(m_mutex);
+
+    // replace any older copy of the same preset
+    for(auto it = m_builds.begin(); it != m_builds.end(); it++)
+    {
+        if(&(*it)->preset->m_presetDef == &build->preset->m_presetDef)
+        {
+            Remove(**it);
+            m_builds.erase(it);
+            break;
+        }
+    }
+
+    build->params.clear();
+    Add(*build);
+    m_builds.push_front(std::move(build));
+    Evict();
+}
+
+void PresetCache::Drop(const PresetDef* presetDef)
+{
+    std::unique_lock lock(m_mutex);
+    for(auto it = m_builds.begin(); it != m_builds.end();)
+    {
+        if(&(*it)->preset->m_presetDef == presetDef)
+        {
+            Remove(**it);
+            it = m_builds.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void PresetCache::SetBudget(size_t budget)
+{
+    std::unique_lock lock(m_mutex);
+    m_budget = budget;
+    Evict();
+}
+
+void PresetCache::Clear()
+{
+    std::unique_lock lock(m_mutex);
+    m_builds.clear();
+    m_textures.clear();
+    m_size = 0;
+}
+
+void PresetCache::Add(const PresetBuild& build)
+{
+    m_size += build.size;
+    for(const auto& texture : build.textures)
+    {
+        auto& holders = m_textures[texture.first];
+        if(holders.first++ == 0)
+        {
+            holders.second = texture.second;
+            m_size += texture.second;
+        }
+    }
+}
+
+void PresetCache::Remove(const PresetBuild& build)
+{
+    m_size -= build.size;
+    for(const auto& texture : build.textures)
+    {
+        auto holders = m_textures.find(texture.first);
+        if(holders != m_textures.end() && --holders->second.first == 0)
+        {
+            m_size -= holders->second.second;
+            m_textures.erase(holders);
+        }
+    }
+}
+
+void PresetCache::Evict()
+{
+    while(m_size > m_budget && !m_builds.empty())
+    {
+        Remove(*m_builds.back());
+        m_builds.pop_back();
+        m_evictions++;
+    }
+}
+
+size_t PresetCache::Size()
+{
+    std::unique_lock lock(m_mutex);
+    return m_size;
+}
+
+size_t PresetCache::Budget()
+{
+    std::unique_lock lock(m_mutex);
+    return m_budget;
+}
+
+int PresetCache::Hits()
+{
+    return m_hits;
+}
+
+int PresetCache::Misses()
+{
+    return m_misses;
+}
+
+int PresetCache::Evictions()
+{
+    return m_evictions;
+}
+
+float PresetCache::HitRate()
+{
+    std::unique_lock lock(m_mutex);
+    const auto lookups = m_hits + m_misses;
+    return lookups ? (float)m_hits / lookups : 0.0f;
+}
+
+void PresetCache::EstimateSize(PresetBuild& build)
+{
+    size_t size = 0;
+    for(auto& shader : build.preset->m_shaders)
+    {
+        size += shader.m_shaderDef.VertexLength + shader.m_shaderDef.FragmentLength;
+    }
+    for(const auto& pass : build.passes)
+    {
+        size += pass.m_shader.BufferSize(UBO_BUFFER) + pass.m_shader.BufferSize(PUSH_BUFFER);
+    }
+    build.size = size;
+
+    // decoded once per embedded data, in their real (possibly block-compressed) format
+    build.textures.clear();
+    for(auto& texture : build.preset->m_textures)
+    {
+        const auto& renderTexture = texture.second.m_texture;
+        if(renderTexture)
+            build.textures.emplace_back(texture.second.m_textureDef.Data, TextureMemory::Bytes(*renderTexture));
+    }
+}
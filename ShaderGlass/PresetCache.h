@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Preset.h"
+#include "ShaderPass.h"
+#include <mutex>
+#include <list>
+#include <atomic>
+#include <chrono>
+
+// shader objects, textures and passes of a preset prepared off the render thread
+struct PresetBuild
+{
+    std::unique_ptr<Preset>                           preset {nullptr};
+    std::vector<ShaderPass>                           passes;
+    std::vector<std::tuple<int, std::string, double>> params;
+    std::chrono::steady_clock::time_point             requested {};
+    float                                             buildTime {0};
+    size_t                                            size {0}; // shaders and buffers
+    std::vector<std::pair<const void*, size_t>>       textures; // preset textures by embedded data, which presets share
+};
+
+// bounded LRU of built presets which are not currently rendered
+class PresetCache
+{
+public:
+    PresetCache(size_t budget);
+
+    std::unique_ptr<PresetBuild> Take(const PresetDef* presetDef);
+    void                         Store(std::unique_ptr<PresetBuild> build);
+    void                         Drop(const PresetDef* presetDef);
+    void                         SetBudget(size_t budget);
+    void                         Clear();
+
+    size_t Size();
+    size_t Budget();
+    int    Hits();
+    int    Misses();
+    int    Evictions();
+    float  HitRate();
+
+    static void EstimateSize(PresetBuild& build);
+
+private:
+    void Add(const PresetBuild& build);
+    void Remove(const PresetBuild& build);
+    void Evict();
+
+    std::mutex                                    m_mutex {};
+    std::list<std::unique_ptr<PresetBuild>>       m_builds;   // most recently used first
+    std::map<const void*, std::pair<int, size_t>> m_textures; // builds holding each shared texture and its size, counted once
+    size_t                                        m_budget {0};
+    size_t                                        m_size {0};
+    std::atomic<int>                              m_hits {0};
+    std::atomic<int>                              m_misses {0};
+    std::atomic<int>                              m_evictions {0};
+};
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <mutex>
+
 class PresetDef
 {
 public:
     PresetDef() : ShaderDefs {}, TextureDefs {}, Overrides {}, Name {}, Category {} { }
+    virtual ~PresetDef() = default;
 
     virtual void Build() { }
 
@@ -17,4 +20,7 @@ public:
     std::vector<ParamOverride> Overrides;
     const char*                Name;
     const char*                Category;
+
+    // edited passes are swapped into ShaderDefs in place, anything reading or building them holds this
+    static inline std::mutex ShaderDefsMutex {};
 };
\ No newline at end of file
@@ -0,0 +1,692 @@
+#include "pch.h"
+
+#include "PresetLoader.h"
+#include "SpirvSpecializer.h"
+#include <algorithm>
+#include <shlobj.h>
+#include <unordered_set>
+
+constexpr int MAX_DEPTH = 32; // #include and #reference nesting
+
+// per pass keys understood by Shader, in ShaderGen order
+static const char* passKeys[] = {"filter_linear",
+                                 "float_framebuffer",
+                                 "srgb_framebuffer",
+                                 "scale_type",
+                                 "scale",
+                                 "scale_type_x",
+                                 "scale_x",
+                                 "scale_type_y",
+                                 "scale_y",
+                                 "alias",
+                                 "mipmap_input",
+                                 "frame_count_mod",
+                                 "wrap_mode"};
+
+static const char* textureKeys[] = {"linear", "wrap_mode", "mipmap"};
+
+static const char* formats[] = {"R8G8B8A8_UNORM", "R8G8B8A8_SRGB", "R32G32B32A32_SFLOAT", "R16G16B16A16_SFLOAT"};
+
+// compiled passes on disk, followed by both bytecodes and the fragment reflection
+struct CacheHeader
+{
+    char     magic[4]; // SGSC
+    uint32_t version;
+    uint32_t vertexLength;
+    uint32_t fragmentLength;
+    uint32_t reflectionLength;
+};
+
+static std::string trim(const std::string& s)
+{
+    // as ShaderGen, quotes are trimmed as well
+    const auto isTrimmed = [](unsigned char c) { return std::isspace(c) || c == '\"'; };
+    size_t     first     = 0;
+    size_t     last      = s.size();
+    while(first < last && isTrimmed(s[first]))
+        first++;
+    while(last > first && isTrimmed(s[last - 1]))
+        last--;
+    return s.substr(first, last - first);
+}
+
+static std::string lookup(const std::map<std::string, std::string>& keyValues, const std::string& key, std::unordered_set<std::string>& seenKeys)
+{
+    auto it = keyValues.find(key);
+    if(it == keyValues.end())
+        return std::string();
+    seenKeys.insert(key);
+    return it->second;
+}
+
+static std::filesystem::path lookupPath(const std::map<std::string, std::string>& keyValues,
+                                        const std::map<std::string, std::filesystem::path>& keyPaths,
+                                        const std::string&                                   key,
+                                        std::unordered_set<std::string>&                     seenKeys)
+{
+    // relative to the preset which set the value, not the one being loaded
+    auto value = lookup(keyValues, key, seenKeys);
+    auto path  = keyPaths.find(key);
+    return ((path != keyPaths.end() ? path->second : std::filesystem::path()) / value).lexically_normal();
+}
+
+static std::vector<BYTE> readFile(const std::filesystem::path& path)
+{
+    std::ifstream infile(path, std::ios::binary);
+    return std::vector<BYTE>(std::istreambuf_iterator<char>(infile), std::istreambuf_iterator<char>());
+}
+
+// just enough JSON for SPIRV-Cross reflection
+struct JsonValue
+{
+    std::string                                    text; // strings, numbers and literals
+    std::vector<JsonValue>                         items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* Find(const std::string& name) const
+    {
+        for(const auto& m : members)
+        {
+            if(m.first == name)
+                return &m.second;
+        }
+        return nullptr;
+    }
+};
+
+static void skipSpace(const char*& p)
+{
+    while(*p && std::isspace(static_cast<unsigned char>(*p)))
+        p++;
+}
+
+static bool parseJson(const char*& p, JsonValue& value)
+{
+    skipSpace(p);
+    if(*p == '{' || *p == '[')
+    {
+        const bool object = *p++ == '{';
+        skipSpace(p);
+        if(*p == (object ? '}' : ']'))
+        {
+            p++;
+            return true;
+        }
+        while(true)
+        {
+            JsonValue* element;
+            if(object)
+            {
+                JsonValue key;
+                if(*p != '\"' || !parseJson(p, key))
+                    return false;
+                skipSpace(p);
+                if(*p++ != ':')
+                    return false;
+                element = &value.members.emplace_back(key.text, JsonValue()).second;
+            }
+            else
+                element = &value.items.emplace_back();
+            if(!parseJson(p, *element))
+                return false;
+            skipSpace(p);
+            if(*p == ',')
+            {
+                p++;
+                skipSpace(p);
+                continue;
+            }
+            return *p++ == (object ? '}' : ']');
+        }
+    }
+    if(*p == '\"')
+    {
+        p++;
+        while(*p && *p != '\"')
+        {
+            if(*p == '\\' && p[1])
+                p++;
+            value.text += *p++;
+        }
+        return *p++ == '\"';
+    }
+    while(*p && *p != ',' && *p != '}' && *p != ']' && !std::isspace(static_cast<unsigned char>(*p)))
+        value.text += *p++;
+    return !value.text.empty();
+}
+
+static int memberSize(const std::string& type)
+{
+    if(type == "float" || type == "uint" || type == "int")
+        return 4;
+    if(type == "vec2")
+        return 8;
+    if(type == "vec3")
+        return 12;
+    if(type == "vec4")
+        return 16;
+    if(type == "mat4")
+        return 64;
+    throw std::runtime_error("Unknown uniform type " + type);
+}
+
+LoadedPresetDef::LoadedPresetDef(const std::filesystem::path& path) :
+    PresetDef {}, m_path {path}, m_name {path.stem().string()}, m_category {"custom"}
+{
+    Name     = m_name.c_str();
+    Category = m_category.c_str();
+}
+
+void LoadedPresetDef::Build()
+{
+    ShaderDefs  = m_shaderDefs;
+    TextureDefs = m_textureDefs;
+}
+
+PresetLoader::PresetLoader(const std::filesystem::path& cachePath, const std::filesystem::path& toolsPath) :
+    m_cachePath {cachePath}, m_toolsPath {toolsPath}
+{ }
+
+std::filesystem::path PresetLoader::DefaultCachePath()
+{
+    PWSTR                 localAppData = nullptr;
+    std::filesystem::path cachePath;
+    if(SUCCEEDED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &localAppData)))
+        cachePath = std::filesystem::path(localAppData) / L"ShaderGlass" / L"Cache";
+    else
+        cachePath = std::filesystem::temp_directory_path() / L"ShaderGlass" / L"Cache";
+    CoTaskMemFree(localAppData);
+    return cachePath;
+}
+
+std::filesystem::path PresetLoader::DefaultToolsPath()
+{
+    wchar_t modulePath[MAX_PATH];
+    GetModuleFileNameW(nullptr, modulePath, MAX_PATH);
+    return std::filesystem::path(modulePath).parent_path() / L"Tools";
+}
+
+std::unique_ptr<LoadedPresetDef> PresetLoader::Load(const std::filesystem::path& presetPath)
+{
+    if(!std::filesystem::exists(presetPath))
+        throw std::runtime_error("Unable to open " + presetPath.string());
+
+    std::map<std::string, std::string>           keyValues;
+    std::map<std::string, std::filesystem::path> keyPaths;
+    std::unordered_set<std::string>              seenKeys;
+    auto                                         preset = std::make_unique<LoadedPresetDef>(presetPath);
+    ParsePreset(presetPath, keyValues, keyPaths, preset->m_presetFiles, 0);
+
+    const auto numShaders = atoi(lookup(keyValues, "shaders", seenKeys).c_str());
+    if(numShaders <= 0)
+        throw std::runtime_error("No shaders in " + presetPath.string());
+
+    for(int i = 0; i < numShaders; i++)
+    {
+        const auto shaderPath = lookupPath(keyValues, keyPaths, "shader" + std::to_string(i), seenKeys);
+        auto&      shader     = preset->m_shaders.emplace_back();
+        CompileShader(shaderPath, shader);
+        preset->m_passPaths.push_back(shaderPath);
+        preset->m_passFiles.push_back(shader.sources);
+
+        ShaderDef def;
+        Define(shader, def);
+        for(const auto& key : passKeys)
+        {
+            const auto& value = lookup(keyValues, key + std::to_string(i), seenKeys);
+            if(!value.empty())
+                def.Param(key, value);
+        }
+        preset->m_shaderDefs.push_back(def);
+    }
+
+    auto textureList = lookup(keyValues, "textures", seenKeys) + ";";
+    for(size_t start = 0, end; (end = textureList.find(';', start)) != std::string::npos; start = end + 1)
+    {
+        const auto textureName = trim(textureList.substr(start, end - start));
+        if(textureName.empty())
+            continue;
+
+        const auto texturePath = lookupPath(keyValues, keyPaths, textureName, seenKeys);
+        auto&      data        = preset->m_textureData.emplace_back(readFile(texturePath));
+        if(data.empty())
+            throw std::runtime_error("Unable to read texture " + texturePath.string());
+        preset->m_presetFiles.push_back(texturePath);
+
+        TextureDef def;
+        def.Name       = preset->m_strings.emplace_back(texturePath.filename().string()).c_str();
+        def.Data       = data.data();
+        def.DataLength = static_cast<int>(data.size());
+        def.Param("name", textureName);
+        for(const auto& key : textureKeys)
+        {
+            const auto& value = lookup(keyValues, textureName + "_" + key, seenKeys);
+            if(!value.empty())
+                def.Param(key, value);
+        }
+        preset->m_textureDefs.push_back(def);
+    }
+
+    // anything else numeric overrides a parameter default
+    for(const auto& kv : keyValues)
+    {
+        if(seenKeys.contains(kv.first) || kv.first.empty() || kv.second.empty())
+            continue;
+        try
+        {
+            preset->OverrideParam(kv.first.c_str(), std::stof(kv.second));
+        }
+        catch(std::exception&)
+        { }
+    }
+
+    return preset;
+}
+
+void PresetLoader::Define(const CompiledShader& shader, ShaderDef& def)
+{
+    def.Name             = shader.name.c_str();
+    def.Format           = shader.format.c_str();
+    def.VertexByteCode   = shader.vertexByteCode.data();
+    def.VertexLength     = shader.vertexByteCode.size();
+    def.FragmentByteCode = shader.fragmentByteCode.data();
+    def.FragmentLength   = shader.fragmentByteCode.size();
+    def.Params           = shader.params;
+    def.Samplers         = shader.samplers;
+}
+
+void PresetLoader::ParsePreset(const std::filesystem::path&                  input,
+                               std::map<std::string, std::string>&           keyValues,
+                               std::map<std::string, std::filesystem::path>& keyPaths,
+                               std::vector<std::filesystem::path>&           files,
+                               int                                           depth)
+{
+    if(depth > MAX_DEPTH)
+        throw std::runtime_error("Too many nested references in " + input.string());
+    files.push_back(input);
+
+    std::ifstream infile(input);
+    if(!infile)
+        throw std::runtime_error("Unable to open " + input.string());
+
+    std::string line;
+    while(std::getline(infile, line))
+    {
+        if(line.starts_with("#reference"))
+        {
+            // referenced presets are read in place, later keys override earlier ones
+            std::istringstream iss(line);
+            std::string        directive, reference;
+            iss >> directive >> std::quoted(reference);
+            ParsePreset((input.parent_path() / reference).lexically_normal(), keyValues, keyPaths, files, depth + 1);
+        }
+        else if(!line.starts_with("#"))
+        {
+            const auto equals = line.find('=');
+            if(equals == std::string::npos)
+                continue;
+
+            const auto key   = trim(line.substr(0, equals));
+            auto       value = trim(line.substr(equals + 1));
+            if(value.find('\"') != std::string::npos)
+                value = value.substr(0, value.find('\"')); // strip comment past the quote
+            keyValues[key] = value;
+            keyPaths[key]  = input.parent_path();
+        }
+    }
+}
+
+void PresetLoader::LoadSource(const std::filesystem::path& input, std::vector<std::string>& lines, std::vector<std::filesystem::path>& files, int depth)
+{
+    if(depth > MAX_DEPTH)
+        throw std::runtime_error("Too many nested includes in " + input.string());
+    files.push_back(input);
+
+    std::ifstream infile(input);
+    if(!infile)
+        throw std::runtime_error("Unable to open " + input.string());
+
+    std::string line;
+    while(std::getline(infile, line))
+    {
+        if(line.starts_with("#include"))
+        {
+            std::istringstream iss(line);
+            std::string        directive, include;
+            iss >> directive >> std::quoted(include);
+            LoadSource((input.parent_path() / include).lexically_normal(), lines, files, depth + 1);
+        }
+        else
+            lines.push_back(line);
+    }
+}
+
+PresetLoader::Source PresetLoader::LoadShader(const std::filesystem::path& input)
+{
+    // same stage split and pragmas as ShaderGen, comments are left for glslang
+    Source                   source;
+    std::vector<std::string> lines;
+    LoadSource(input, lines, source.files, 0);
+
+    bool   isVertex = true, isFragment = true;
+    for(const auto& line : lines)
+    {
+        const auto trimLine = trim(line);
+        if(line.starts_with("#pragma parameter"))
+        {
+            std::istringstream iss(line);
+            std::string        directive, name, description;
+            float              defaultValue = 0, minValue = 0, maxValue = 0, stepValue = 0;
+            iss >> directive >> directive >> name >> std::quoted(description) >> defaultValue >> minValue >> maxValue;
+            if(!iss.eof())
+                iss >> stepValue;
+
+            // repeated includes declare the same parameters again
+            const auto dupe = std::find_if(source.params.begin(), source.params.end(), [&](const ShaderParam& p) { return p.name == name; });
+            if(dupe == source.params.end())
+                source.params.emplace_back(name.c_str(), 0, 0, 0, minValue, maxValue, defaultValue, stepValue, trim(description).c_str());
+        }
+        else if(line.starts_with("#pragma stage vertex"))
+        {
+            isVertex   = true;
+            isFragment = false;
+        }
+        else if(line.starts_with("#pragma stage fragment"))
+        {
+            isVertex   = false;
+            isFragment = true;
+        }
+        else if(trimLine.starts_with("#pragma format"))
+        {
+            const auto format = std::find_if(std::begin(formats), std::end(formats), [&](const char* f) { return trimLine.ends_with(f); });
+            if(format == std::end(formats))
+                throw std::runtime_error("Unsupported shader format in " + input.string());
+            source.format = *format;
+        }
+        else
+        {
+            if(isVertex)
+                source.vertex += line + "\n";
+            if(isFragment)
+                source.fragment += line + "\n";
+        }
+    }
+    return source;
+}
+
+uint64_t PresetLoader::CacheKey(const Source& source, const std::map<std::string, float>& constants) const
+{
+    // FNV-1a over both stages, the format and declared parameters are read from source on every load
+    uint64_t   hash   = 14695981039346656037ull;
+    const auto append = [&hash](const void* data, size_t size) {
+        for(size_t i = 0; i < size; i++)
+        {
+            hash ^= static_cast<const uint8_t*>(data)[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    append(&CACHE_VERSION, sizeof(CACHE_VERSION));
+    append(source.vertex.data(), source.vertex.size() + 1);
+    append(source.fragment.data(), source.fragment.size() + 1);
+    for(const auto& constant : constants)
+    {
+        append(constant.first.data(), constant.first.size() + 1);
+        append(&constant.second, sizeof(constant.second));
+    }
+    return hash;
+}
+
+static std::filesystem::path cacheFile(const std::filesystem::path& cachePath, uint64_t key, const wchar_t* extension)
+{
+    wchar_t name[32];
+    swprintf_s(name, L"%016llx%s", key, extension);
+    return cachePath / name;
+}
+
+bool PresetLoader::ReadCache(uint64_t key, CompiledShader& shader, std::string& reflection)
+{
+    const auto data = readFile(cacheFile(m_cachePath, key, L".sgc"));
+
+    CacheHeader header;
+    if(data.size() < sizeof(header))
+        return false;
+    memcpy(&header, data.data(), sizeof(header));
+    if(memcmp(header.magic, "SGSC", 4) != 0 || header.version != CACHE_VERSION ||
+       sizeof(header) + static_cast<size_t>(header.vertexLength) + header.fragmentLength + header.reflectionLength != data.size())
+        return false;
+
+    auto p = data.begin() + sizeof(header);
+    shader.vertexByteCode.assign(p, p + header.vertexLength);
+    p += header.vertexLength;
+    shader.fragmentByteCode.assign(p, p + header.fragmentLength);
+    p += header.fragmentLength;
+    reflection.assign(p, p + header.reflectionLength);
+    return true;
+}
+
+void PresetLoader::WriteCache(uint64_t key, const CompiledShader& shader, const std::string& reflection)
+{
+    CacheHeader header;
+    memcpy(header.magic, "SGSC", 4);
+    header.version          = CACHE_VERSION;
+    header.vertexLength     = static_cast<uint32_t>(shader.vertexByteCode.size());
+    header.fragmentLength   = static_cast<uint32_t>(shader.fragmentByteCode.size());
+    header.reflectionLength = static_cast<uint32_t>(reflection.size());
+
+    // written aside and moved in place, a concurrent or interrupted write never leaves a torn entry
+    std::error_code error;
+    std::filesystem::create_directories(m_cachePath, error);
+    const auto tempPath = cacheFile(m_cachePath, key, (L"." + std::to_wstring(GetCurrentProcessId()) + L".tmp").c_str());
+    {
+        std::ofstream outfile(tempPath, std::ios::binary);
+        outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        outfile.write(reinterpret_cast<const char*>(shader.vertexByteCode.data()), shader.vertexByteCode.size());
+        outfile.write(reinterpret_cast<const char*>(shader.fragmentByteCode.data()), shader.fragmentByteCode.size());
+        outfile.write(reflection.data(), reflection.size());
+        if(!outfile)
+            return;
+    }
+    std::filesystem::rename(tempPath, cacheFile(m_cachePath, key, L".sgc"), error);
+    if(error)
+        std::filesystem::remove(tempPath, error);
+}
+
+void PresetLoader::CompileShader(const std::filesystem::path& input, CompiledShader& shader)
+{
+    SpecializeShader(input, {}, shader);
+}
+
+void PresetLoader::SpecializeShader(const std::filesystem::path& input, const std::map<std::string, float>& constants, CompiledShader& shader)
+{
+    const auto source = LoadShader(input);
+    shader.name       = input.stem().string();
+    shader.format     = source.format;
+    shader.sources    = source.files;
+    shader.constants  = constants;
+
+    // variants are cached alongside, with their constants in the key
+    std::string reflection;
+    const auto  key        = CacheKey(source, constants);
+    const auto  specialize = constants.empty() ? nullptr : &constants;
+    if(ReadCache(key, shader, reflection))
+    {
+        m_cacheHits++;
+    }
+    else
+    {
+        m_cacheMisses++;
+        shader.vertexByteCode   = Compile(input, SpirV(input, key, source.vertex, "vert", nullptr, specialize), "vs_5_0");
+        shader.fragmentByteCode = Compile(input, SpirV(input, key, source.fragment, "frag", &reflection, specialize), "ps_5_0");
+        WriteCache(key, shader, reflection);
+    }
+
+    Reflect(reflection, source.params, shader);
+}
+
+std::string PresetLoader::SpirV(const std::filesystem::path& input, uint64_t key, const std::string& source, const std::string& stage, std::string* reflection, const std::map<std::string, float>* constants)
+{
+    const auto tempPath = m_cachePath / L"temp";
+    std::filesystem::create_directories(tempPath);
+    const auto glslPath  = cacheFile(tempPath, key, (L"." + std::wstring(stage.begin(), stage.end()) + L".glsl").c_str());
+    const auto spirvPath = cacheFile(tempPath, key, (L"." + std::wstring(stage.begin(), stage.end()) + L".spv").c_str());
+    {
+        std::ofstream outfile(glslPath, std::ios::binary);
+        outfile << source;
+    }
+
+    DWORD exitCode;
+    auto  output = Run(L"\"" + (m_toolsPath / L"glslangValidator.exe").wstring() + L"\" -V --quiet -S " + std::wstring(stage.begin(), stage.end()) + L" -o \"" +
+                          spirvPath.wstring() + L"\" \"" + glslPath.wstring() + L"\"",
+                      exitCode);
+    if(exitCode != 0 || output.find("ERROR") != std::string::npos)
+        throw std::runtime_error(input.string() + " (" + stage + "):\n" + output);
+
+    // specialized code is cross-compiled from the optimized module, reflection is always of the original
+    auto       codePath = spirvPath;
+    const auto optPath  = cacheFile(tempPath, key, (L"." + std::wstring(stage.begin(), stage.end()) + L".opt.spv").c_str());
+    if(constants)
+    {
+        const auto            bytes = readFile(spirvPath);
+        std::vector<uint32_t> module(bytes.size() / sizeof(uint32_t));
+        memcpy(module.data(), bytes.data(), module.size() * sizeof(uint32_t));
+        if(SpecializeSpirv(module, *constants) > 0)
+        {
+            {
+                std::ofstream outfile(optPath, std::ios::binary);
+                outfile.write(reinterpret_cast<const char*>(module.data()), module.size() * sizeof(uint32_t));
+            }
+            output = Run(L"\"" + (m_toolsPath / L"spirv-opt.exe").wstring() + L"\" -O --preserve-bindings --preserve-spec-constants \"" + optPath.wstring() + L"\" -o \"" +
+                             optPath.wstring() + L"\"",
+                         exitCode);
+            if(exitCode != 0)
+                throw std::runtime_error(input.string() + " (" + stage + "):\n" + output);
+            codePath = optPath;
+        }
+    }
+
+    const auto hlsl = Run(L"\"" + (m_toolsPath / L"spirv-cross.exe").wstring() + L"\" --hlsl --shader-model 50 \"" + codePath.wstring() + L"\"", exitCode);
+    if(exitCode != 0)
+        throw std::runtime_error(input.string() + " (" + stage + "):\n" + hlsl);
+
+    if(reflection)
+    {
+        *reflection = Run(L"\"" + (m_toolsPath / L"spirv-cross.exe").wstring() + L"\" \"" + spirvPath.wstring() + L"\" --reflect", exitCode);
+        if(exitCode != 0)
+            throw std::runtime_error(input.string() + " (" + stage + "):\n" + *reflection);
+    }
+
+    std::error_code error;
+    std::filesystem::remove(glslPath, error);
+    std::filesystem::remove(spirvPath, error);
+    std::filesystem::remove(optPath, error);
+    return hlsl;
+}
+
+std::vector<BYTE> PresetLoader::Compile(const std::filesystem::path& input, const std::string& hlsl, const char* profile)
+{
+    winrt::com_ptr<ID3DBlob> codeBlob;
+    winrt::com_ptr<ID3DBlob> errorBlob;
+
+    const auto hr = D3DCompile(hlsl.data(), hlsl.size(), input.filename().string().c_str(), nullptr, nullptr, "main", profile, D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, codeBlob.put(), errorBlob.put());
+    if(FAILED(hr))
+        throw std::runtime_error(input.string() + " (" + profile + "):\n" + (errorBlob ? std::string(static_cast<const char*>(errorBlob->GetBufferPointer()), errorBlob->GetBufferSize()) : std::string()));
+
+    const auto code = static_cast<const BYTE*>(codeBlob->GetBufferPointer());
+    return std::vector<BYTE>(code, code + codeBlob->GetBufferSize());
+}
+
+std::string PresetLoader::Run(const std::wstring& commandLine, DWORD& exitCode)
+{
+    SECURITY_ATTRIBUTES security {sizeof(security), nullptr, TRUE};
+    HANDLE              readPipe, writePipe;
+    if(!CreatePipe(&readPipe, &writePipe, &security, 0))
+        throw std::runtime_error("Unable to create pipe");
+    SetHandleInformation(readPipe, HANDLE_FLAG_INHERIT, 0);
+
+    STARTUPINFOW startupInfo {};
+    startupInfo.cb         = sizeof(startupInfo);
+    startupInfo.dwFlags    = STARTF_USESTDHANDLES;
+    startupInfo.hStdOutput = writePipe;
+    startupInfo.hStdError  = writePipe;
+
+    PROCESS_INFORMATION processInfo {};
+    std::wstring        command(commandLine); // CreateProcessW may modify it
+    if(!CreateProcessW(nullptr, command.data(), nullptr, nullptr, TRUE, CREATE_NO_WINDOW, nullptr, nullptr, &startupInfo, &processInfo))
+    {
+        CloseHandle(readPipe);
+        CloseHandle(writePipe);
+        throw std::runtime_error("Unable to run shader tools from " + m_toolsPath.string());
+    }
+    CloseHandle(writePipe);
+
+    std::string output;
+    char        buffer[4096];
+    DWORD       read;
+    while(ReadFile(readPipe, buffer, sizeof(buffer), &read, nullptr) && read)
+        output.append(buffer, read);
+    CloseHandle(readPipe);
+
+    WaitForSingleObject(processInfo.hProcess, INFINITE);
+    GetExitCodeProcess(processInfo.hProcess, &exitCode);
+    CloseHandle(processInfo.hProcess);
+    CloseHandle(processInfo.hThread);
+    return output;
+}
+
+void PresetLoader::Reflect(const std::string& reflection, const std::vector<ShaderParam>& declared, CompiledShader& shader)
+{
+    JsonValue   root;
+    const char* p = reflection.c_str();
+    if(!parseJson(p, root))
+        throw std::runtime_error("Invalid reflection for " + shader.name);
+
+    // uniform block members as in ShaderGen, declared parameters keep their ranges
+    const auto types     = root.Find("types");
+    const auto addParams = [&](const JsonValue& block, int buffer) {
+        const auto typeName = block.Find("type");
+        const auto type     = types && typeName ? types->Find(typeName->text) : nullptr;
+        const auto members  = type ? type->Find("members") : nullptr;
+        if(members == nullptr)
+            return;
+        for(const auto& member : members->items)
+        {
+            const auto name   = member.Find("name");
+            const auto offset = member.Find("offset");
+            const auto mtype  = member.Find("type");
+            if(!name || !offset || !mtype)
+                continue;
+
+            const auto size = memberSize(mtype->text);
+            const auto d    = std::find_if(declared.begin(), declared.end(), [&](const ShaderParam& param) { return param.name == name->text; });
+            if(d != declared.end())
+                shader.params.emplace_back(d->name.c_str(), buffer, atoi(offset->text.c_str()), size, d->minValue, d->maxValue, d->defaultValue, d->stepValue, d->description.c_str());
+            else
+                shader.params.emplace_back(name->text.c_str(), buffer, atoi(offset->text.c_str()), size, 0.0f, 0.0f, 0.0f);
+        }
+    };
+
+    if(const auto ubos = root.Find("ubos"))
+    {
+        for(const auto& ubo : ubos->items)
+        {
+            const auto binding = ubo.Find("binding");
+            addParams(ubo, binding ? atoi(binding->text.c_str()) : 0);
+        }
+    }
+    if(const auto pushConstants = root.Find("push_constants"))
+    {
+        int buffer = -1;
+        for(const auto& pushConstant : pushConstants->items)
+            addParams(pushConstant, buffer--);
+    }
+    if(const auto textures = root.Find("textures"))
+    {
+        for(const auto& texture : textures->items)
+        {
+            const auto name    = texture.Find("name");
+            const auto binding = texture.Find("binding");
+            if(name && binding)
+                shader.samplers.emplace_back(name->text.c_str(), atoi(binding->text.c_str()));
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "ShaderList.h"
+#include <filesystem>
+#include <list>
+
+// pass compiled at runtime, owns what generated definitions keep in static data
+struct CompiledShader
+{
+    std::string                name;
+    std::string                format;
+    std::vector<BYTE>          vertexByteCode;
+    std::vector<BYTE>          fragmentByteCode;
+    std::vector<ShaderParam>   params;
+    std::vector<ShaderSampler> samplers;
+    std::vector<std::filesystem::path> sources; // .slang and everything it includes
+    std::map<std::string, float>       constants; // parameters folded in, empty for the generic pass
+};
+
+// preset loaded from a .slangp file rather than compiled in by ShaderGen
+class LoadedPresetDef : public PresetDef
+{
+public:
+    LoadedPresetDef(const std::filesystem::path& path);
+
+    virtual void Build();
+
+    std::filesystem::path m_path;
+    std::string           m_name;
+    std::string           m_category;
+
+    // Build() copies these, as generated presets construct their definitions
+    std::vector<ShaderDef>  m_shaderDefs;
+    std::vector<TextureDef> m_textureDefs;
+
+    // what the preset was loaded from, for watching
+    std::vector<std::filesystem::path>              m_passPaths;   // .slang of each pass
+    std::vector<std::vector<std::filesystem::path>> m_passFiles;   // and everything it includes
+    std::vector<std::filesystem::path>              m_presetFiles; // .slangp, its references and textures
+
+    // storage the definitions point into, never moved
+    std::list<CompiledShader>    m_shaders;
+    std::list<std::vector<BYTE>> m_textureData;
+    std::list<std::string>       m_strings;
+};
+
+// parses .slangp presets the way ShaderGen does and compiles their passes with glslang and
+// SPIRV-Cross (next to the executable) and D3DCompile; compiled passes are kept in a disk cache
+// keyed by a hash of their preprocessed source, so loading a preset again needs no tools at all
+class PresetLoader
+{
+public:
+    PresetLoader(const std::filesystem::path& cachePath, const std::filesystem::path& toolsPath);
+
+    // throws std::runtime_error with the failing pass and compiler output
+    std::unique_ptr<LoadedPresetDef> Load(const std::filesystem::path& presetPath);
+
+    // compiles one pass again, for reloading it after an edit
+    void CompileShader(const std::filesystem::path& input, CompiledShader& shader);
+
+    // compiles a variant of one pass with parameters folded to constants and the code they made dead removed
+    // by spirv-opt (next to the other tools); parameters and samplers are those of the generic pass
+    void SpecializeShader(const std::filesystem::path& input, const std::map<std::string, float>& constants, CompiledShader& shader);
+
+    int CacheHits() const { return m_cacheHits; }
+    int CacheMisses() const { return m_cacheMisses; }
+
+    static std::filesystem::path DefaultCachePath(); // %LOCALAPPDATA%\ShaderGlass\Cache
+    static std::filesystem::path DefaultToolsPath(); // Tools next to ShaderGlass.exe
+
+    // points def at the compiled code and reflection, pass settings are left as they are
+    static void Define(const CompiledShader& shader, ShaderDef& def);
+
+private:
+    static constexpr uint32_t CACHE_VERSION = 1; // bump when compiled output changes
+
+    struct Source
+    {
+        std::string              vertex;
+        std::string              fragment;
+        std::string              format;
+        std::vector<ShaderParam> params; // declared with #pragma parameter
+        std::vector<std::filesystem::path> files;
+    };
+
+    void     ParsePreset(const std::filesystem::path& input, std::map<std::string, std::string>& keyValues, std::map<std::string, std::filesystem::path>& keyPaths, std::vector<std::filesystem::path>& files, int depth);
+    Source   LoadShader(const std::filesystem::path& input);
+    uint64_t CacheKey(const Source& source, const std::map<std::string, float>& constants = {}) const;
+    bool     ReadCache(uint64_t key, CompiledShader& shader, std::string& reflection);
+    void     WriteCache(uint64_t key, const CompiledShader& shader, const std::string& reflection);
+    std::string       SpirV(const std::filesystem::path& input, uint64_t key, const std::string& source, const std::string& stage, std::string* reflection, const std::map<std::string, float>* constants = nullptr);
+    std::vector<BYTE> Compile(const std::filesystem::path& input, const std::string& hlsl, const char* profile);
+    std::string       Run(const std::wstring& commandLine, DWORD& exitCode);
+
+    static void LoadSource(const std::filesystem::path& input, std::vector<std::string>& lines, std::vector<std::filesystem::path>& files, int depth);
+    static void Reflect(const std::string& reflection, const std::vector<ShaderParam>& declared, CompiledShader& shader);
+
+    std::filesystem::path m_cachePath;
+    std::filesystem::path m_toolsPath;
+    int                   m_cacheHits {0};
+    int                   m_cacheMisses {0};
+};
@@ -0,0 +1,105 @@
+#include "pch.h"
+
+#include "PresetSpecializer.h"
+#include "resource.h"
+
+PresetSpecializer::PresetSpecializer(HWND window) :
+    m_window {window}, m_loader {PresetLoader::DefaultCachePath(), PresetLoader::DefaultToolsPath()}
+{
+    m_thread = std::thread(&PresetSpecializer::ThreadFunc, this);
+}
+
+PresetSpecializer::~PresetSpecializer()
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_one();
+    m_thread.join();
+}
+
+void PresetSpecializer::Specialize(LoadedPresetDef* preset, const std::vector<std::pair<size_t, std::map<std::string, float>>>& passes)
+{
+    std::unique_lock lock(m_mutex);
+
+    // anything compiled for an earlier request is dropped
+    m_generation++;
+    m_variants.clear();
+    m_requests.clear();
+    m_preset    = preset;
+    m_requested = std::chrono::steady_clock::now();
+    if(preset)
+    {
+        for(const auto& pass : passes)
+        {
+            if(pass.first < preset->m_passPaths.size() && !pass.second.empty())
+                m_requests.push_back({pass.first, preset->m_passPaths[pass.first], pass.second});
+        }
+    }
+    m_condition.notify_one();
+}
+
+bool PresetSpecializer::TakeVariant(PresetVariant& variant)
+{
+    std::unique_lock lock(m_mutex);
+    if(m_variants.empty())
+        return false;
+
+    variant = std::move(m_variants.front());
+    m_variants.pop_front();
+    return true;
+}
+
+void PresetSpecializer::ThreadFunc()
+{
+    std::unique_lock lock(m_mutex);
+    while(!m_stop)
+    {
+        if(m_requests.empty())
+        {
+            m_condition.wait(lock);
+            continue;
+        }
+
+        // a newer request restarts the wait
+        const auto settled = m_requested + std::chrono::milliseconds(SETTLE_MS);
+        if(std::chrono::steady_clock::now() < settled)
+        {
+            m_condition.wait_until(lock, settled);
+            continue;
+        }
+
+        std::vector<Request> requests;
+        requests.swap(m_requests);
+        const auto generation = m_generation;
+        const auto preset     = m_preset;
+        lock.unlock();
+
+        // a pass failing to specialize keeps running its generic code
+        std::vector<PresetVariant> variants;
+        for(const auto& request : requests)
+        {
+            PresetVariant variant {preset, request.pass};
+            try
+            {
+                m_loader.SpecializeShader(request.path, request.constants, variant.shader);
+                variants.push_back(std::move(variant));
+            }
+            catch(std::exception& e)
+            {
+                OutputDebugStringA(("Specializing " + request.path.string() + " failed: " + e.what() + "\n").c_str());
+            }
+        }
+
+        lock.lock();
+        if(generation != m_generation || variants.empty())
+            continue;
+        for(auto& variant : variants)
+            m_variants.push_back(std::move(variant));
+        lock.unlock();
+
+        PostMessage(m_window, WM_COMMAND, IDM_PRESET_SPECIALIZED, 0);
+        lock.lock();
+    }
+}
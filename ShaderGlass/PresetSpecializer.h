@@ -0,0 +1,52 @@
+#pragma once
+
+#include "PresetLoader.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// pass of a loaded preset compiled with some of its parameters folded to constants
+struct PresetVariant
+{
+    LoadedPresetDef* preset {nullptr};
+    size_t           pass {0};
+    CompiledShader   shader;
+};
+
+// compiles specialized variants of loaded passes in the background once parameters have settled
+// and posts IDM_PRESET_SPECIALIZED to the window when they can be taken
+class PresetSpecializer
+{
+public:
+    PresetSpecializer(HWND window);
+    ~PresetSpecializer();
+
+    // replaces any request not taken yet, nullptr or no passes cancels
+    void Specialize(LoadedPresetDef* preset, const std::vector<std::pair<size_t, std::map<std::string, float>>>& passes);
+    bool TakeVariant(PresetVariant& variant);
+
+private:
+    static constexpr int SETTLE_MS = 500; // sliders send a change for every step
+
+    struct Request
+    {
+        size_t                       pass;
+        std::filesystem::path        path;
+        std::map<std::string, float> constants;
+    };
+
+    void ThreadFunc();
+
+    HWND                                  m_window {0};
+    std::thread                           m_thread;
+    std::mutex                            m_mutex {};
+    std::condition_variable               m_condition;
+    bool                                  m_stop {false};
+    unsigned                              m_generation {0};
+    LoadedPresetDef*                      m_preset {nullptr};
+    std::vector<Request>                  m_requests;
+    std::chrono::steady_clock::time_point m_requested {};
+    std::deque<PresetVariant>             m_variants;
+    PresetLoader                          m_loader; // used on the specializer thread only
+};
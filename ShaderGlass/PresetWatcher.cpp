@@ -0,0 +1,193 @@
+#include "pch.h"
+
+#include "PresetWatcher.h"
+#include "resource.h"
+#include <algorithm>
+#include <set>
+
+PresetWatcher::PresetWatcher(HWND window) :
+    m_window {window}, m_wakeEvent {CreateEvent(nullptr, FALSE, FALSE, nullptr)},
+    m_loader {PresetLoader::DefaultCachePath(), PresetLoader::DefaultToolsPath()}
+{
+    m_thread = std::thread(&PresetWatcher::ThreadFunc, this);
+}
+
+PresetWatcher::~PresetWatcher()
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_stop = true;
+    }
+    SetEvent(m_wakeEvent);
+    m_thread.join();
+    CloseHandle(m_wakeEvent);
+}
+
+void PresetWatcher::Watch(LoadedPresetDef* preset)
+{
+    std::unique_lock lock(m_mutex);
+    if(preset != m_preset)
+    {
+        // anything compiled for the previous preset is dropped
+        m_generation++;
+        m_changes.clear();
+        m_writeTimes.clear();
+        m_preset = preset;
+    }
+
+    m_passPaths.clear();
+    m_passFiles.clear();
+    m_presetFiles.clear();
+    std::map<std::filesystem::path, std::filesystem::file_time_type> writeTimes;
+    if(preset)
+    {
+        m_passPaths   = preset->m_passPaths;
+        m_passFiles   = preset->m_passFiles;
+        m_presetFiles = preset->m_presetFiles;
+
+        // files already watched keep the time last seen, so an edit made while a change was applied isn't lost
+        const auto watch = [&](const std::filesystem::path& file) {
+            const auto seen = m_writeTimes.find(file);
+            if(seen != m_writeTimes.end())
+            {
+                writeTimes.insert(*seen);
+            }
+            else
+            {
+                std::error_code error;
+                writeTimes[file] = std::filesystem::last_write_time(file, error);
+            }
+        };
+        for(const auto& files : m_passFiles)
+            std::for_each(files.begin(), files.end(), watch);
+        std::for_each(m_presetFiles.begin(), m_presetFiles.end(), watch);
+    }
+    m_writeTimes.swap(writeTimes);
+    m_watchChanged = true;
+    SetEvent(m_wakeEvent);
+}
+
+bool PresetWatcher::TakeChange(PresetChange& change)
+{
+    std::unique_lock lock(m_mutex);
+    if(m_changes.empty())
+        return false;
+
+    change = std::move(m_changes.front());
+    m_changes.pop_front();
+    return true;
+}
+
+void PresetWatcher::ThreadFunc()
+{
+    // one notification per directory holding a dependency, first handle is the wake event
+    std::vector<HANDLE> handles {m_wakeEvent};
+    const auto          closeNotifications = [&handles] {
+        for(size_t h = 1; h < handles.size(); h++)
+            FindCloseChangeNotification(handles[h]);
+        handles.resize(1);
+    };
+
+    while(true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            if(m_stop)
+                break;
+
+            if(m_watchChanged)
+            {
+                m_watchChanged = false;
+                closeNotifications();
+
+                std::set<std::filesystem::path> directories;
+                for(const auto& file : m_writeTimes)
+                    directories.insert(file.first.parent_path());
+                for(const auto& directory : directories)
+                {
+                    if(handles.size() == MAXIMUM_WAIT_OBJECTS)
+                        break;
+                    const auto notification = FindFirstChangeNotificationW(directory.wstring().c_str(), FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+                    if(notification != INVALID_HANDLE_VALUE)
+                        handles.push_back(notification);
+                }
+            }
+        }
+
+        const auto result = WaitForMultipleObjects(static_cast<DWORD>(handles.size()), handles.data(), FALSE, INFINITE);
+        if(result == WAIT_OBJECT_0)
+            continue;
+        if(result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + handles.size())
+            break;
+
+        const auto detected = std::chrono::steady_clock::now();
+        FindNextChangeNotification(handles[result - WAIT_OBJECT_0]);
+        Sleep(DEBOUNCE_MS);
+        Check(detected);
+    }
+
+    closeNotifications();
+}
+
+void PresetWatcher::Check(std::chrono::steady_clock::time_point detected)
+{
+    std::unique_lock lock(m_mutex);
+    if(m_preset == nullptr)
+        return;
+
+    // directories are watched, so see which of the files in them actually changed
+    std::vector<size_t> passes;
+    bool                reload = false;
+    for(auto& file : m_writeTimes)
+    {
+        std::error_code error;
+        const auto      written = std::filesystem::last_write_time(file.first, error);
+        if(error || written == file.second)
+            continue; // a file replaced on save may be missing for a moment, it's seen on the next notification
+        file.second = written;
+
+        if(std::find(m_presetFiles.begin(), m_presetFiles.end(), file.first) != m_presetFiles.end())
+            reload = true;
+        for(size_t p = 0; p < m_passFiles.size(); p++)
+        {
+            const auto& files = m_passFiles[p];
+            if(std::find(files.begin(), files.end(), file.first) != files.end() && std::find(passes.begin(), passes.end(), p) == passes.end())
+                passes.push_back(p);
+        }
+    }
+    if(!reload && passes.empty())
+        return;
+
+    PresetChange change;
+    change.preset         = m_preset;
+    change.reload         = reload;
+    change.detected       = detected;
+    const auto generation = m_generation;
+    const auto passPaths  = m_passPaths;
+    lock.unlock();
+
+    // a changed .slangp or texture reloads everything, otherwise only passes using the edited files
+    if(!reload)
+    {
+        std::sort(passes.begin(), passes.end());
+        try
+        {
+            for(const auto p : passes)
+                m_loader.CompileShader(passPaths[p], change.shaders.emplace_back());
+            change.passes = std::move(passes);
+        }
+        catch(std::exception& e)
+        {
+            change.shaders.clear();
+            change.error = e.what();
+        }
+    }
+
+    lock.lock();
+    if(generation != m_generation)
+        return;
+    m_changes.push_back(std::move(change));
+    lock.unlock();
+
+    PostMessage(m_window, WM_COMMAND, IDM_PRESET_CHANGED, 0);
+}
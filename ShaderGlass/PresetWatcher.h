@@ -0,0 +1,51 @@
+#pragma once
+
+#include "PresetLoader.h"
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// edited passes recompiled in the background, or the whole preset when its .slangp or textures changed
+struct PresetChange
+{
+    LoadedPresetDef*                      preset {nullptr};
+    std::vector<size_t>                   passes;
+    std::list<CompiledShader>             shaders; // one for each of passes, in order
+    bool                                  reload {false};
+    std::string                           error;
+    std::chrono::steady_clock::time_point detected {};
+};
+
+// watches the files a loaded preset was built from, recompiles only the passes whose source or includes
+// changed and posts IDM_PRESET_CHANGED to the window once a change can be taken
+class PresetWatcher
+{
+public:
+    PresetWatcher(HWND window);
+    ~PresetWatcher();
+
+    void Watch(LoadedPresetDef* preset); // nullptr stops watching, call again after applying a change
+    bool TakeChange(PresetChange& change);
+
+private:
+    static constexpr DWORD DEBOUNCE_MS = 50; // editors save in more than one write
+
+    void ThreadFunc();
+    void Check(std::chrono::steady_clock::time_point detected);
+
+    HWND                                                             m_window {0};
+    std::thread                                                      m_thread;
+    std::mutex                                                       m_mutex {};
+    HANDLE                                                           m_wakeEvent {0};
+    bool                                                             m_stop {false};
+    bool                                                             m_watchChanged {false};
+    unsigned                                                         m_generation {0};
+    LoadedPresetDef*                                                 m_preset {nullptr};
+    std::vector<std::filesystem::path>                               m_passPaths;
+    std::vector<std::vector<std::filesystem::path>>                  m_passFiles;
+    std::vector<std::filesystem::path>                               m_presetFiles;
+    std::map<std::filesystem::path, std::filesystem::file_time_type> m_writeTimes;
+    std::deque<PresetChange>                                         m_changes;
+    PresetLoader                                                     m_loader; // used on the watcher thread only
+};
@@ -0,0 +1,215 @@
+#include "pch.h"
+
+#include "RecordingBackend.h"
+#include "ShaderDef.h"
+#include "TextureDef.h"
+#include "TextureMemory.h"
+
+struct RecordingBuffer : RenderBuffer
+{
+    std::vector<uint8_t> data;
+};
+
+RecordingStats RecordingBackend::Stats() const
+{
+    RecordingStats stats;
+    stats.calls          = m_calls;
+    stats.draws          = m_draws;
+    stats.maps           = m_maps;
+    stats.bytesMapped    = m_bytesMapped;
+    stats.copies         = m_copies;
+    stats.bytesCopied    = m_bytesCopied;
+    stats.allocations    = m_allocations;
+    stats.bytesAllocated = m_bytesAllocated;
+    return stats;
+}
+
+void RecordingBackend::Reset()
+{
+    m_calls          = 0;
+    m_allocations    = 0;
+    m_bytesAllocated = 0;
+    m_draws          = 0;
+    m_maps           = 0;
+    m_bytesMapped    = 0;
+    m_copies         = 0;
+    m_bytesCopied    = 0;
+}
+
+size_t RecordingBackend::TextureSize(const RenderTexture& texture)
+{
+    return TextureMemory::Bytes(texture);
+}
+
+void RecordingBackend::Allocated(size_t bytes)
+{
+    m_calls++;
+    m_allocations++;
+    m_bytesAllocated += bytes;
+}
+
+std::shared_ptr<RenderTexture> RecordingBackend::CreateTexture(const TextureDesc& desc)
+{
+    auto texture          = std::make_shared<RenderTexture>();
+    texture->width        = desc.width;
+    texture->height       = desc.height;
+    texture->format       = desc.format;
+    texture->renderTarget = desc.renderTarget;
+    Allocated(TextureSize(*texture));
+    return texture;
+}
+
+std::shared_ptr<RenderTexture> RecordingBackend::LoadTexture(const TextureDef& textureDef)
+{
+    auto texture    = std::make_shared<RenderTexture>();
+    texture->format = TextureFormat::RGBA8;
+    if(textureDef.IsRaw())
+    {
+        const auto header  = reinterpret_cast<const RawTextureHeader*>(textureDef.Data);
+        texture->width     = header->width;
+        texture->height    = header->height;
+        texture->mipLevels = header->mipLevels;
+        if(header->format == DXGI_FORMAT_BC1_UNORM)
+            texture->format = TextureFormat::BC1;
+        else if(header->format == DXGI_FORMAT_BC3_UNORM)
+            texture->format = TextureFormat::BC3;
+    }
+    else if(textureDef.DataLength >= 24 && memcmp(textureDef.Data + 1, "PNG", 3) == 0)
+    {
+        // dimensions from IHDR, no need to decode
+        const auto data = textureDef.Data;
+        texture->width  = (data[16] << 24) | (data[17] << 16) | (data[18] << 8) | data[19];
+        texture->height = (data[20] << 24) | (data[21] << 16) | (data[22] << 8) | data[23];
+    }
+    Allocated(TextureSize(*texture));
+    return texture;
+}
+
+std::shared_ptr<RenderBuffer> RecordingBackend::CreateVertexBuffer(const void* data, size_t size)
+{
+    auto buffer  = std::make_shared<RecordingBuffer>();
+    buffer->size = size;
+    Allocated(size);
+    return buffer;
+}
+
+std::shared_ptr<RenderBuffer> RecordingBackend::CreateConstantBuffer(size_t size)
+{
+    auto buffer  = std::make_shared<RecordingBuffer>();
+    buffer->size = size;
+    buffer->data.resize((size + 0xf) & ~static_cast<size_t>(0xf));
+    Allocated(buffer->data.size());
+    return buffer;
+}
+
+std::shared_ptr<RenderProgram> RecordingBackend::CreateProgram(const ShaderDef& shaderDef)
+{
+    Allocated(shaderDef.VertexLength + shaderDef.FragmentLength);
+    return std::make_shared<RenderProgram>();
+}
+
+std::shared_ptr<RenderSampler> RecordingBackend::CreateSampler(const SamplerDesc& desc)
+{
+    auto sampler  = std::make_shared<RenderSampler>();
+    sampler->desc = desc;
+    Allocated(0);
+    return sampler;
+}
+
+void* RecordingBackend::Map(RenderBuffer& buffer)
+{
+    auto& recordingBuffer = static_cast<RecordingBuffer&>(buffer);
+    m_calls++;
+    m_maps++;
+    m_bytesMapped += recordingBuffer.data.size();
+    return recordingBuffer.data.data();
+}
+
+void RecordingBackend::Unmap(RenderBuffer& buffer)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetViewport(float x, float y, float width, float height)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetRenderTarget(RenderTexture* target)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetProgram(RenderProgram& program)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetVertexBuffer(RenderBuffer& buffer, uint32_t stride)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetTexture(int slot, RenderTexture* texture)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetSampler(int slot, RenderSampler& sampler)
+{
+    m_calls++;
+}
+
+void RecordingBackend::SetConstantBuffer(int slot, RenderBuffer& buffer)
+{
+    m_calls++;
+}
+
+void RecordingBackend::Draw(uint32_t vertexCount, uint32_t startVertex)
+{
+    m_calls++;
+    m_draws++;
+}
+
+void RecordingBackend::Clear(RenderTexture& target, const float color[4])
+{
+    m_calls++;
+}
+
+void RecordingBackend::Copy(RenderTexture& dest, RenderTexture& source)
+{
+    m_calls++;
+    m_copies++;
+    m_bytesCopied += TextureSize(source);
+}
+
+void RecordingBackend::CopyRegion(RenderTexture& dest, RenderTexture& source, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom)
+{
+    m_calls++;
+    m_copies++;
+    m_bytesCopied += TextureMemory::Bytes(right - left, bottom - top, source.format);
+}
+
+void RecordingBackend::Upload(RenderTexture& texture, const uint8_t* data, uint32_t pitch)
+{
+    m_calls++;
+    m_copies++;
+    m_bytesCopied += static_cast<uint64_t>(texture.width) * texture.height * 4;
+}
+
+void RecordingBackend::Download(RenderTexture& texture, uint8_t* data, uint32_t pitch)
+{
+    m_calls++;
+    m_copies++;
+    m_bytesCopied += static_cast<uint64_t>(texture.width) * texture.height * 4;
+}
+
+void RecordingBackend::Finish()
+{
+    m_calls++;
+}
+
+std::unique_ptr<RenderTimer> RecordingBackend::CreateTimer()
+{
+    return nullptr;
+}
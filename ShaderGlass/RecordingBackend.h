@@ -0,0 +1,68 @@
+#pragma once
+
+#include "RenderBackend.h"
+#include <atomic>
+#include <vector>
+
+struct RecordingStats
+{
+    uint64_t calls {0};
+    uint64_t draws {0};
+    uint64_t maps {0};
+    uint64_t bytesMapped {0};
+    uint64_t copies {0};
+    uint64_t bytesCopied {0};
+    uint64_t allocations {0};
+    uint64_t bytesAllocated {0};
+};
+
+// headless backend which only counts what a chain would ask of the GPU, for measuring CPU-side frame cost
+class RecordingBackend : public RenderBackend
+{
+public:
+    RecordingBackend() = default;
+
+    RecordingStats Stats() const;
+    void           Reset();
+
+    std::shared_ptr<RenderTexture> CreateTexture(const TextureDesc& desc) override;
+    std::shared_ptr<RenderTexture> LoadTexture(const TextureDef& textureDef) override;
+    std::shared_ptr<RenderBuffer>  CreateVertexBuffer(const void* data, size_t size) override;
+    std::shared_ptr<RenderBuffer>  CreateConstantBuffer(size_t size) override;
+    std::shared_ptr<RenderProgram> CreateProgram(const ShaderDef& shaderDef) override;
+    std::shared_ptr<RenderSampler> CreateSampler(const SamplerDesc& desc) override;
+
+    void* Map(RenderBuffer& buffer) override;
+    void  Unmap(RenderBuffer& buffer) override;
+    void  SetViewport(float x, float y, float width, float height) override;
+    void  SetRenderTarget(RenderTexture* target) override;
+    void  SetProgram(RenderProgram& program) override;
+    void  SetVertexBuffer(RenderBuffer& buffer, uint32_t stride) override;
+    void  SetTexture(int slot, RenderTexture* texture) override;
+    void  SetSampler(int slot, RenderSampler& sampler) override;
+    void  SetConstantBuffer(int slot, RenderBuffer& buffer) override;
+    void  Draw(uint32_t vertexCount, uint32_t startVertex) override;
+    void  Clear(RenderTexture& target, const float color[4]) override;
+    void  Copy(RenderTexture& dest, RenderTexture& source) override;
+    void  CopyRegion(RenderTexture& dest, RenderTexture& source, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) override;
+    void  Upload(RenderTexture& texture, const uint8_t* data, uint32_t pitch) override;
+    void  Download(RenderTexture& texture, uint8_t* data, uint32_t pitch) override;
+    void  Finish() override;
+
+    std::unique_ptr<RenderTimer> CreateTimer() override;
+
+    static size_t TextureSize(const RenderTexture& texture); // in its own format, incl. mip chain
+
+private:
+    void Allocated(size_t bytes);
+
+    // creation may come from the preset build thread, rendering from whichever thread drives the chain
+    std::atomic<uint64_t> m_calls {0};
+    std::atomic<uint64_t> m_allocations {0};
+    std::atomic<uint64_t> m_bytesAllocated {0};
+    std::atomic<uint64_t> m_draws {0};
+    std::atomic<uint64_t> m_maps {0};
+    std::atomic<uint64_t> m_bytesMapped {0};
+    std::atomic<uint64_t> m_copies {0};
+    std::atomic<uint64_t> m_bytesCopied {0};
+};
@@ -0,0 +1,487 @@
+#include "pch.h"
+
+#include "Regression.h"
+#include "BatchProcessor.h"
+#include "D3D11Backend.h"
+#include "ShaderList.h"
+#include "Util/d3dHelpers.h"
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+static constexpr float NOISE_MS = 0.05f; // slowdowns below this are timer noise on passthrough-like presets
+
+static std::string jsonString(const std::string& s)
+{
+    std::string escaped = "\"";
+    for(auto c : s)
+    {
+        if(c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+// preset names are ASCII, characters not allowed in file names are replaced
+static std::wstring safeFileName(const std::string& s)
+{
+    std::wstring name;
+    for(auto c : s)
+        name += wcschr(L"<>:\"/\\|?*", c) && c ? L'_' : static_cast<wchar_t>(static_cast<unsigned char>(c));
+    return name;
+}
+
+Regression::Regression(const RegressionOptions& options) : m_options {options} { }
+
+bool Regression::ParseArgs(int numArgs, LPWSTR* args, RegressionOptions& options)
+{
+    bool regress = false;
+    for(int a = 1; a < numArgs; a++)
+    {
+        const bool hasValue = a + 1 < numArgs;
+        if(wcscmp(args[a], L"-regress") == 0)
+            regress = true;
+        else if(wcscmp(args[a], L"-filter") == 0 && hasValue)
+            options.filter = BatchProcessor::ToUtf8(args[++a]);
+        else if(wcscmp(args[a], L"-golden") == 0 && hasValue)
+            options.golden = args[++a];
+        else if(wcscmp(args[a], L"-json") == 0 && hasValue)
+            options.output = args[++a];
+        else if(wcscmp(args[a], L"-frames") == 0 && hasValue)
+            options.frames = max(1, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-timing") == 0 && hasValue)
+            options.timedFrames = max(0, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-tolerance") == 0 && hasValue)
+            options.tolerance = max(0, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-slowdown") == 0 && hasValue)
+            options.slowdown = max(0.0f, static_cast<float>(_wtof(args[++a])));
+        else if(wcscmp(args[a], L"-threads") == 0 && hasValue)
+            options.threads = max(0, _wtoi(args[++a]));
+        else if(wcscmp(args[a], L"-update") == 0)
+            options.update = true;
+        else if(wcscmp(args[a], L"-resolution") == 0 && hasValue)
+        {
+            // e.g. 840x600
+            const std::wstring item = args[++a];
+            const auto         x    = item.find(L'x');
+            if(x != std::wstring::npos)
+            {
+                const auto width  = _wtoi(item.substr(0, x).c_str());
+                const auto height = _wtoi(item.substr(x + 1).c_str());
+                if(width > 0 && height > 0)
+                {
+                    options.outputWidth  = static_cast<uint32_t>(width);
+                    options.outputHeight = static_cast<uint32_t>(height);
+                }
+            }
+        }
+    }
+    return regress;
+}
+
+std::shared_ptr<RenderBackend> Regression::CreateBackend(std::string* adapter) const
+{
+    winrt::com_ptr<ID3D11DeviceContext> context;
+    auto                                device = util::uwp::CreateD3DDevice();
+    device->GetImmediateContext(context.put());
+
+    winrt::com_ptr<IDXGIAdapter> dxgiAdapter;
+    DXGI_ADAPTER_DESC            adapterDesc;
+    if(adapter && SUCCEEDED(device.as<IDXGIDevice>()->GetAdapter(dxgiAdapter.put())) && SUCCEEDED(dxgiAdapter->GetDesc(&adapterDesc)))
+        *adapter = BatchProcessor::ToUtf8(adapterDesc.Description);
+    return std::make_shared<D3D11Backend>(device, context);
+}
+
+std::wstring Regression::GoldenPath(const PresetDef& presetDef, const Input& input) const
+{
+    // <golden>\<category>\<name> - <input>.png, subcategories as subdirectories
+    std::wstring      path = m_options.golden;
+    std::stringstream category(presetDef.Category ? presetDef.Category : "");
+    std::string       segment;
+    while(std::getline(category, segment, '/'))
+    {
+        if(!segment.empty())
+            path += L"\\" + safeFileName(segment);
+    }
+    return path + L"\\" + safeFileName(presetDef.Name) + L" - " + input.name + L".png";
+}
+
+void Regression::ComparePreset(std::shared_ptr<RenderBackend> backend, IWICImagingFactory* factory, PresetDef& presetDef, RegressionResult& result)
+{
+    for(const auto& input : m_inputs)
+    {
+        auto texture = backend->CreateTexture({input.width, input.height, TextureFormat::BGRA8, false});
+        backend->Upload(*texture, input.pixels.data(), input.width * 4);
+
+        // fresh chain per input so every case sees the same frame counts
+        HeadlessChain  chain(backend, presetDef);
+        const uint32_t originalWidth  = max(1U, static_cast<uint32_t>(input.width / input.pixelSize));
+        const uint32_t originalHeight = max(1U, static_cast<uint32_t>(input.height / input.pixelSize));
+        chain.Resize(input.width, input.height, originalWidth, originalHeight, m_options.outputWidth, m_options.outputHeight, TextureFormat::BGRA8);
+
+        RenderTexture* output = nullptr;
+        for(unsigned f = 1; f <= m_options.frames; f++)
+            output = chain.Render(texture.get(), f);
+        if(output == nullptr)
+        {
+            result.failed = true;
+            return;
+        }
+
+        BatchImage rendered;
+        rendered.outputPath = GoldenPath(presetDef, input);
+        rendered.width      = output->width;
+        rendered.height     = output->height;
+        rendered.pixels.resize(static_cast<size_t>(output->width) * output->height * 4);
+        backend->Download(*output, rendered.pixels.data(), output->width * 4);
+
+        if(m_options.update)
+        {
+            std::error_code error;
+            std::filesystem::create_directories(std::filesystem::path(rendered.outputPath).parent_path(), error);
+            if(!BatchProcessor::Encode(factory, rendered))
+            {
+                result.failed = true;
+                wprintf(L"Unable to write %s\n", rendered.outputPath.c_str());
+            }
+            continue;
+        }
+
+        BatchImage golden;
+        golden.inputPath = rendered.outputPath;
+        if(!BatchProcessor::Decode(factory, golden))
+        {
+            result.missing = true;
+            continue;
+        }
+        if(golden.width != rendered.width || golden.height != rendered.height)
+        {
+            result.maxDiff = 255;
+            result.differingPixels += static_cast<size_t>(rendered.width) * rendered.height;
+            continue;
+        }
+
+        // golden images are 24-bit, so alpha is not compared
+        for(size_t p = 0; p < rendered.pixels.size(); p += 4)
+        {
+            unsigned diff = 0;
+            for(size_t c = 0; c < 3; c++)
+                diff = max(diff, static_cast<unsigned>(abs(rendered.pixels[p + c] - golden.pixels[p + c])));
+            result.maxDiff = max(result.maxDiff, diff);
+            if(diff > m_options.tolerance)
+                result.differingPixels++;
+        }
+    }
+    result.changed = result.differingPixels > 0;
+}
+
+void Regression::CompareThreadFunc(const std::vector<PresetDef*>& presets, std::atomic<size_t>& next)
+{
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    winrt::com_ptr<IWICImagingFactory> factory;
+    CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.put()));
+
+    // own device per worker, the immediate context is not shared between threads
+    auto backend = CreateBackend(nullptr);
+    for(size_t i = next++; i < presets.size(); i = next++)
+    {
+        auto& result = m_results[i];
+        try
+        {
+            ComparePreset(backend, factory.get(), *presets[i], result);
+        }
+        catch(...)
+        {
+            result.failed = true;
+        }
+
+        if(result.failed)
+            printf("%s: failed\n", result.preset.c_str());
+        else if(result.missing)
+            printf("%s: no golden image\n", result.preset.c_str());
+        else if(result.changed)
+            printf("%s: changed, %zu pixels over tolerance, max difference %u\n", result.preset.c_str(), result.differingPixels, result.maxDiff);
+    }
+
+    backend = nullptr;
+    factory = nullptr;
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+}
+
+void Regression::TimePreset(std::shared_ptr<RenderBackend> backend, PresetDef& presetDef, RegressionResult& result)
+{
+    const auto& input   = m_inputs.front();
+    auto        texture = backend->CreateTexture({input.width, input.height, TextureFormat::BGRA8, false});
+    backend->Upload(*texture, input.pixels.data(), input.width * 4);
+
+    HeadlessChain  chain(backend, presetDef);
+    const uint32_t originalWidth  = max(1U, static_cast<uint32_t>(input.width / input.pixelSize));
+    const uint32_t originalHeight = max(1U, static_cast<uint32_t>(input.height / input.pixelSize));
+    chain.Resize(input.width, input.height, originalWidth, originalHeight, m_options.outputWidth, m_options.outputHeight, TextureFormat::BGRA8);
+
+    int frameCount = 1;
+    for(unsigned f = 0; f < m_options.frames; f++)
+        chain.Render(texture.get(), frameCount++);
+    backend->Finish();
+
+    std::vector<float> times;
+    times.reserve(m_options.timedFrames);
+    for(unsigned f = 0; f < m_options.timedFrames; f++)
+    {
+        const auto frameStart = std::chrono::steady_clock::now();
+        chain.Render(texture.get(), frameCount++);
+        backend->Finish();
+        times.push_back(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+    }
+
+    // median, a single stalled frame should not flag a preset
+    std::sort(times.begin(), times.end());
+    result.medianMs = times[times.size() / 2];
+
+    const auto baseline = m_baseline.find(result.preset);
+    if(baseline != m_baseline.end())
+    {
+        result.baselineMs = baseline->second;
+        result.slowed     = !m_options.update && result.medianMs > result.baselineMs * (1.0f + m_options.slowdown / 100.0f) &&
+                        result.medianMs - result.baselineMs > NOISE_MS;
+    }
+    if(result.slowed)
+        printf("%s: slowed, %.3f ms from %.3f ms\n", result.preset.c_str(), result.medianMs, result.baselineMs);
+}
+
+void Regression::ReadBaseline()
+{
+    // one preset per line, as written by WriteBaseline
+    std::ifstream json(m_options.golden + L"\\timings.json");
+    std::string   line;
+    while(std::getline(json, line))
+    {
+        const auto preset = line.find("\"preset\": \"");
+        const auto median = line.find("\"medianMs\": ");
+        if(preset == std::string::npos || median == std::string::npos)
+            continue;
+
+        std::string name;
+        for(auto c = line.begin() + preset + 11; c != line.end() && *c != '"'; c++)
+        {
+            if(*c == '\\' && c + 1 != line.end())
+                c++;
+            name += *c;
+        }
+        m_baseline[name] = static_cast<float>(atof(line.c_str() + median + 12));
+    }
+}
+
+bool Regression::WriteBaseline() const
+{
+    std::ofstream json(m_options.golden + L"\\timings.json", std::ios::out | std::ios::trunc);
+    if(!json.good())
+        return false;
+
+    json << std::fixed << std::setprecision(4);
+    json << "{\n";
+    json << "  \"adapter\": " << jsonString(m_adapter) << ",\n";
+    json << "  \"results\": [";
+    bool first = true;
+    for(const auto& baseline : m_baseline)
+    {
+        json << (first ? "\n" : ",\n") << "    {\"preset\": " << jsonString(baseline.first) << ", \"medianMs\": " << baseline.second << "}";
+        first = false;
+    }
+    json << "\n  ]\n}\n";
+    return json.good();
+}
+
+bool Regression::WriteJson() const
+{
+    std::ofstream json(m_options.output, std::ios::out | std::ios::trunc);
+    if(!json.good())
+        return false;
+
+    // names first so the diff can be read without going through every preset
+    auto names = [&](const char* key, auto selected) {
+        json << "  \"" << key << "\": [";
+        bool first = true;
+        for(const auto& result : m_results)
+        {
+            if(selected(result))
+            {
+                json << (first ? "" : ", ") << jsonString(result.preset);
+                first = false;
+            }
+        }
+        json << "],\n";
+    };
+
+    json << std::fixed << std::setprecision(4);
+    json << "{\n";
+    json << "  \"adapter\": " << jsonString(m_adapter) << ",\n";
+    json << "  \"update\": " << (m_options.update ? "true" : "false") << ",\n";
+    json << "  \"frames\": " << m_options.frames << ",\n";
+    json << "  \"timedFrames\": " << m_options.timedFrames << ",\n";
+    json << "  \"tolerance\": " << m_options.tolerance << ",\n";
+    json << "  \"slowdown\": " << m_options.slowdown << ",\n";
+    names("changed", [](const RegressionResult& r) { return r.changed; });
+    names("slowed", [](const RegressionResult& r) { return r.slowed; });
+    names("missing", [](const RegressionResult& r) { return r.missing; });
+    names("failed", [](const RegressionResult& r) { return r.failed; });
+    json << "  \"results\": [";
+    for(size_t r = 0; r < m_results.size(); r++)
+    {
+        const auto& result = m_results[r];
+        json << (r ? ",\n" : "\n") << "    {";
+        json << "\"preset\": " << jsonString(result.preset);
+        json << ", \"changed\": " << (result.changed ? "true" : "false");
+        json << ", \"slowed\": " << (result.slowed ? "true" : "false");
+        json << ", \"missing\": " << (result.missing ? "true" : "false");
+        json << ", \"failed\": " << (result.failed ? "true" : "false");
+        json << ", \"maxDiff\": " << result.maxDiff;
+        json << ", \"differingPixels\": " << result.differingPixels;
+        json << ", \"medianMs\": " << result.medianMs;
+        json << ", \"baselineMs\": " << result.baselineMs;
+        json << "}";
+    }
+    json << "\n  ]\n}\n";
+    return json.good();
+}
+
+int Regression::Run()
+{
+    // report to the console we were started from, if any
+    if(AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* f;
+        freopen_s(&f, "CONOUT$", "w", stdout);
+    }
+
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    bool decoded = !m_options.cases.empty();
+    {
+        winrt::com_ptr<IWICImagingFactory> factory;
+        CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(factory.put()));
+        for(const auto& c : m_options.cases)
+        {
+            BatchImage image;
+            image.inputPath = c.input;
+            if(!BatchProcessor::Decode(factory.get(), image))
+            {
+                wprintf(L"Unable to read %s\n", c.input.c_str());
+                decoded = false;
+                continue;
+            }
+
+            const auto fileName = c.input.substr(c.input.find_last_of(L"\\/") + 1);
+            m_inputs.push_back({std::move(image.pixels), image.width, image.height, c.pixelSize, fileName.substr(0, fileName.find_last_of(L'.'))});
+        }
+    }
+
+    // bundled presets in list order, so reports are comparable
+    static PassthroughPresetDef passthroughDef;
+    std::vector<PresetDef*>     presets;
+    std::vector<PresetDef*>     candidates(RetroArchPresetList.begin(), RetroArchPresetList.end());
+    candidates.push_back(&passthroughDef);
+    for(auto presetDef : candidates)
+    {
+        const std::string fullName = std::string(presetDef->Category ? presetDef->Category : "") + "/" + presetDef->Name;
+        if(m_options.filter.empty() || fullName.find(m_options.filter) != std::string::npos)
+        {
+            presets.push_back(presetDef);
+            m_results.push_back({fullName});
+        }
+    }
+
+    if(!decoded || presets.empty())
+    {
+        printf("Usage: ShaderGlass -regress [-update] [-filter <text>] [-golden <directory>] [-json <file>] [-frames <n>] [-timing <n>]\n"
+               "       [-tolerance <0-255>] [-slowdown <percent>] [-resolution <width>x<height>] [-threads <n>]\n");
+        if(SUCCEEDED(comInit))
+            CoUninitialize();
+        return 1;
+    }
+
+    // kept on update too, so refreshing part of the presets leaves the other timings alone
+    ReadBaseline();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // presets render at once on their own device; devices share one GPU, so past a few they only queue behind each other
+    const unsigned cores   = max(1U, std::thread::hardware_concurrency());
+    unsigned       threads = m_options.threads ? m_options.threads : min(cores, 4U);
+    threads                = min(threads, static_cast<unsigned>(presets.size()));
+    {
+        std::atomic<size_t>      next {0};
+        std::vector<std::thread> workers;
+        for(unsigned t = 0; t < threads; t++)
+            workers.emplace_back(&Regression::CompareThreadFunc, this, std::cref(presets), std::ref(next));
+        for(auto& w : workers)
+            w.join();
+    }
+
+    // timing one preset at a time on a single backend, concurrent presets would measure each other
+    auto backend = CreateBackend(&m_adapter);
+    if(m_options.timedFrames)
+    {
+        for(size_t p = 0; p < presets.size(); p++)
+        {
+            if(m_results[p].failed)
+                continue;
+            try
+            {
+                TimePreset(backend, *presets[p], m_results[p]);
+            }
+            catch(...)
+            {
+                m_results[p].failed = true;
+            }
+        }
+    }
+    backend = nullptr;
+
+    int changed = 0, slowed = 0, missing = 0, failed = 0;
+    for(const auto& result : m_results)
+    {
+        changed += result.changed;
+        slowed += result.slowed;
+        missing += result.missing;
+        failed += result.failed;
+    }
+    const auto seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    printf("%zu presets on %u threads in %.1f s: %d changed, %d slowed, %d without golden image, %d failed\n",
+           presets.size(),
+           threads,
+           seconds,
+           changed,
+           slowed,
+           missing,
+           failed);
+
+    bool written = true;
+    if(m_options.update && m_options.timedFrames)
+    {
+        for(const auto& result : m_results)
+        {
+            if(!result.failed)
+                m_baseline[result.preset] = result.medianMs;
+        }
+        std::error_code error;
+        std::filesystem::create_directories(m_options.golden, error);
+        written = WriteBaseline();
+        if(!written)
+            wprintf(L"Unable to write %s\\timings.json\n", m_options.golden.c_str());
+    }
+    if(!WriteJson())
+    {
+        wprintf(L"Unable to write %s\n", m_options.output.c_str());
+        written = false;
+    }
+
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+
+    // non-zero for scripts when anything needs looking at
+    return written && failed == 0 && (m_options.update || (changed == 0 && slowed == 0 && missing == 0)) ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "HeadlessChain.h"
+#include <atomic>
+#include <wincodec.h>
+
+struct RegressionCase
+{
+    std::wstring input;           // fixed input image
+    float        pixelSize {1.0f}; // input pixels per original pixel
+};
+
+struct RegressionOptions
+{
+    std::string                 filter {};           // substring of category/name, empty for every preset
+    std::vector<RegressionCase> cases {{L"Misc\\Test Pattern.png", 4.0f}, {L"Misc\\Test Pattern 4.png", 1.0f}};
+    std::wstring                golden {L"Golden"}; // reference images and timings.json
+    std::wstring                output {L"regression.json"};
+    uint32_t                    outputWidth {840};
+    uint32_t                    outputHeight {600};
+    unsigned                    frames {4};         // rendered before the output is read, so history and feedback fill up
+    unsigned                    timedFrames {30};   // 0 skips timing
+    unsigned                    tolerance {2};      // per channel, drivers round differently
+    float                       slowdown {20.0f};   // percent over the baseline median
+    unsigned                    threads {0};        // presets rendered at once, each on its own device, 0 for 4
+    bool                        update {false};     // rewrite golden images and timings instead of comparing
+};
+
+struct RegressionResult
+{
+    std::string preset;
+    bool        failed {false};      // threw while rendering
+    bool        missing {false};     // no golden image for some case
+    bool        changed {false};
+    bool        slowed {false};
+    unsigned    maxDiff {0};         // largest channel difference over all cases
+    size_t      differingPixels {0}; // over the tolerance, over all cases
+    float       medianMs {0};
+    float       baselineMs {0}; // 0 if never timed
+};
+
+// headless "-regress" mode: renders presets over fixed inputs for a fixed number of frames on worker threads,
+// compares the output with golden images and the frame time with the last recorded one, and reports what changed as JSON
+class Regression
+{
+public:
+    Regression(const RegressionOptions& options);
+
+    static bool ParseArgs(int numArgs, LPWSTR* args, RegressionOptions& options);
+    int         Run();
+
+private:
+    struct Input
+    {
+        std::vector<uint8_t> pixels;
+        uint32_t             width {0};
+        uint32_t             height {0};
+        float                pixelSize {1.0f};
+        std::wstring         name; // file name without extension
+    };
+
+    std::shared_ptr<RenderBackend> CreateBackend(std::string* adapter) const;
+    std::wstring                   GoldenPath(const PresetDef& presetDef, const Input& input) const;
+    void                           CompareThreadFunc(const std::vector<PresetDef*>& presets, std::atomic<size_t>& next);
+    void                           ComparePreset(std::shared_ptr<RenderBackend> backend, IWICImagingFactory* factory, PresetDef& presetDef, RegressionResult& result);
+    void                           TimePreset(std::shared_ptr<RenderBackend> backend, PresetDef& presetDef, RegressionResult& result);
+    void                           ReadBaseline();
+    bool                           WriteBaseline() const;
+    bool                           WriteJson() const;
+
+    RegressionOptions             m_options;
+    std::string                   m_adapter {};
+    std::vector<Input>            m_inputs;
+    std::vector<RegressionResult> m_results; // by preset, each written by one worker only
+    std::map<std::string, float>  m_baseline;
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class ShaderDef;
+class TextureDef;
+
+enum class TextureFormat
+{
+    BGRA8,
+    BGRA8_SRGB,
+    RGBA8,
+    RGBA16F,
+    BC1, // block-compressed preset textures, never render targets
+    BC3
+};
+
+enum class TextureAddress
+{
+    Border,
+    Clamp,
+    Wrap,
+    Mirror
+};
+
+struct TextureDesc
+{
+    uint32_t      width {0};
+    uint32_t      height {0};
+    TextureFormat format {TextureFormat::BGRA8};
+    bool          renderTarget {false};
+};
+
+struct SamplerDesc
+{
+    bool           linear {false};
+    TextureAddress address {TextureAddress::Border};
+};
+
+// resources are owned by handles, each backend derives its own
+struct RenderTexture
+{
+    virtual ~RenderTexture() = default;
+
+    uint32_t      width {0};
+    uint32_t      height {0};
+    uint32_t      mipLevels {1};
+    TextureFormat format {TextureFormat::BGRA8};
+    bool          renderTarget {false};
+};
+
+struct RenderBuffer
+{
+    virtual ~RenderBuffer() = default;
+
+    size_t size {0};
+};
+
+struct RenderProgram
+{
+    virtual ~RenderProgram() = default;
+};
+
+struct RenderSampler
+{
+    virtual ~RenderSampler() = default;
+
+    SamplerDesc desc;
+};
+
+// timestamps of a frame's sections, read back once the GPU has passed them
+class RenderTimer
+{
+public:
+    virtual ~RenderTimer() = default;
+
+    virtual void BeginFrame(uint64_t frame)                           = 0;
+    virtual void Mark()                                               = 0; // ends the previous section and starts the next
+    virtual void EndFrame()                                           = 0;
+    virtual bool Resolve(uint64_t& frame, std::vector<double>& marks) = 0; // oldest finished frame, microseconds from its start
+};
+
+// everything a preset chain needs from the graphics API, creation may happen on any thread,
+// state and draw calls on the render thread only
+class RenderBackend
+{
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual std::shared_ptr<RenderTexture> CreateTexture(const TextureDesc& desc)                           = 0;
+    virtual std::shared_ptr<RenderTexture> LoadTexture(const TextureDef& textureDef)                        = 0;
+    virtual std::shared_ptr<RenderBuffer>  CreateVertexBuffer(const void* data, size_t size)                = 0;
+    virtual std::shared_ptr<RenderBuffer>  CreateConstantBuffer(size_t size)                                = 0;
+    virtual std::shared_ptr<RenderProgram> CreateProgram(const ShaderDef& shaderDef)                        = 0;
+    virtual std::shared_ptr<RenderSampler> CreateSampler(const SamplerDesc& desc)                           = 0;
+
+    virtual void* Map(RenderBuffer& buffer)                                                                 = 0;
+    virtual void  Unmap(RenderBuffer& buffer)                                                               = 0;
+    virtual void  SetViewport(float x, float y, float width, float height)                                  = 0;
+    virtual void  SetRenderTarget(RenderTexture* target)                                                    = 0;
+    virtual void  SetProgram(RenderProgram& program)                                                        = 0;
+    virtual void  SetVertexBuffer(RenderBuffer& buffer, uint32_t stride)                                    = 0;
+    virtual void  SetTexture(int slot, RenderTexture* texture)                                              = 0;
+    virtual void  SetSampler(int slot, RenderSampler& sampler)                                              = 0;
+    virtual void  SetConstantBuffer(int slot, RenderBuffer& buffer)                                         = 0;
+    virtual void  Draw(uint32_t vertexCount, uint32_t startVertex)                                          = 0;
+    virtual void  Clear(RenderTexture& target, const float color[4])                                        = 0;
+    virtual void  Copy(RenderTexture& dest, RenderTexture& source)                                          = 0;
+    virtual void  CopyRegion(RenderTexture& dest, RenderTexture& source, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) = 0;
+
+    // 8-bit texels in the texture's channel order, for offline processing
+    virtual void  Upload(RenderTexture& texture, const uint8_t* data, uint32_t pitch)                       = 0;
+    virtual void  Download(RenderTexture& texture, uint8_t* data, uint32_t pitch)                           = 0;
+
+    // blocks until all submitted work has executed, for timing
+    virtual void  Finish()                                                                                  = 0;
+
+    // GPU timestamps, nullptr where the backend has none and wall-clock is as good
+    virtual std::unique_ptr<RenderTimer> CreateTimer()                                                      = 0;
+};
@@ -0,0 +1,113 @@
+#include "pch.h"
+
+#include "ResolutionGovernor.h"
+
+void ResolutionGovernor::Configure(const GovernorSettings& settings)
+{
+    m_settings              = settings;
+    m_settings.minScale     = min(1.0f, max(MIN_SCALE, m_settings.minScale));
+    m_settings.maxFrameSkip = max(0, m_settings.maxFrameSkip);
+    m_scale                 = 1.0f;
+    m_frameSkip             = 0;
+    m_hold                  = 0;
+    m_steppedUp             = false;
+    Restart(0);
+}
+
+void ResolutionGovernor::SetScalable(bool scalable)
+{
+    if(scalable == m_scalable)
+        return;
+
+    m_scalable = scalable;
+    Restart(COOLDOWN);
+}
+
+void ResolutionGovernor::Restart(int cooldown)
+{
+    m_cooldown = cooldown;
+    m_samples  = 0;
+    m_sum      = 0;
+}
+
+bool ResolutionGovernor::Update(float frameMs)
+{
+    if(!Enabled())
+        return false;
+
+    if(m_hold > 0)
+        m_hold--;
+    if(m_cooldown > 0)
+    {
+        m_cooldown--;
+        return false;
+    }
+
+    m_sum += frameMs;
+    if(++m_samples < WINDOW)
+        return false;
+
+    const auto meanMs = static_cast<float>(m_sum / m_samples);
+    Restart(0);
+
+    // every skipped frame adds a target interval to render the next one in
+    bool changed = false;
+    if(meanMs > m_settings.targetMs * (m_frameSkip + 1))
+    {
+        // projection was too optimistic, e.g. only part of the chain scales
+        if(m_steppedUp)
+            m_hold = HOLD;
+        changed     = StepDown();
+        m_steppedUp = false;
+    }
+    else if(m_hold == 0)
+    {
+        changed     = StepUp(meanMs);
+        m_steppedUp = changed;
+    }
+
+    if(changed)
+        Restart(COOLDOWN);
+    return changed;
+}
+
+bool ResolutionGovernor::StepDown()
+{
+    if(m_scalable && m_scale > m_settings.minScale)
+    {
+        m_scale = max(m_settings.minScale, m_scale * STEP);
+        return true;
+    }
+    if(m_frameSkip < m_settings.maxFrameSkip)
+    {
+        m_frameSkip++;
+        return true;
+    }
+    return false;
+}
+
+bool ResolutionGovernor::StepUp(float meanMs)
+{
+    // frames back first, cost of a frame doesn't depend on them
+    if(m_frameSkip > 0)
+    {
+        if(meanMs < m_settings.targetMs * m_frameSkip * HEADROOM)
+        {
+            m_frameSkip--;
+            return true;
+        }
+        return false;
+    }
+
+    if(m_scale < 1.0f)
+    {
+        // cost follows the pixel count
+        const auto next = min(1.0f, m_scale / STEP);
+        if(meanMs * (next * next) / (m_scale * m_scale) < m_settings.targetMs * HEADROOM)
+        {
+            m_scale = next;
+            return true;
+        }
+    }
+    return false;
+}
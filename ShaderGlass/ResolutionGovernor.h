@@ -0,0 +1,48 @@
+#pragma once
+
+struct GovernorSettings
+{
+    float targetMs {0};       // GPU time per rendered frame to hold, 0 disables
+    float minScale {0.5f};    // lowest resolution of viewport-scaled passes
+    int   maxFrameSkip {0};   // extra frames which may be skipped once at lowest resolution
+};
+
+// holds a target frame time by lowering the resolution of viewport-scaled intermediate passes and then
+// skipping frames; steps are judged on a window of frame times and followed by a cooldown, and stepping
+// back up requires the projected time to stay well under target, so the controller settles instead of
+// oscillating; no renderer state, frame times may come from a trace
+class ResolutionGovernor
+{
+public:
+    static constexpr int   WINDOW     = 30;    // frames averaged before a decision
+    static constexpr int   COOLDOWN   = 60;    // frames ignored after a change while new targets settle
+    static constexpr float STEP       = 0.85f; // resolution factor per step
+    static constexpr float HEADROOM   = 0.8f;  // step up only when the projected time is this far under target
+    static constexpr int   HOLD       = 600;   // frames without stepping up after a step up had to be undone
+    static constexpr float MIN_SCALE  = 0.25f; // lowest minScale accepted, as for the texture budget
+
+    void Configure(const GovernorSettings& settings);
+    void SetScalable(bool scalable); // whether the current preset has viewport-scaled passes to shrink
+
+    // returns true when Scale or FrameSkip changed
+    bool Update(float frameMs);
+
+    bool  Enabled() const { return m_settings.targetMs > 0; }
+    float Scale() const { return m_scale; }
+    int   FrameSkip() const { return m_frameSkip; }
+
+private:
+    void Restart(int cooldown);
+    bool StepDown();
+    bool StepUp(float meanMs);
+
+    GovernorSettings m_settings {};
+    bool             m_scalable {true};
+    float            m_scale {1.0f};
+    int              m_frameSkip {0};
+    int              m_cooldown {0};
+    int              m_hold {0};
+    bool             m_steppedUp {false};
+    int              m_samples {0};
+    double           m_sum {0};
+};
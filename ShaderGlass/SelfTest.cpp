@@ -0,0 +1,274 @@
+#include "pch.h"
+
+#include "SelfTest.h"
+#include "PassProfiler.h"
+#include "ResolutionGovernor.h"
+
+static bool approximately(float a, float b)
+{
+    return fabsf(a - b) < 0.0001f;
+}
+
+static size_t countOf(const std::string& text, const std::string& part)
+{
+    size_t count = 0;
+    for(auto p = text.find(part); p != std::string::npos; p = text.find(part, p + part.size()))
+        count++;
+    return count;
+}
+
+// complete events as ChromeTrace writes them
+static std::string traceEvent(const std::string& name, const char* ts, const char* dur, uint64_t frame)
+{
+    return "{\"name\":" + name + ",\"cat\":\"pass\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" + ts + ",\"dur\":" + dur + ",\"args\":{\"frame\":" + std::to_string(frame) + "}}";
+}
+
+// one decision of the governor: cooldown after a change and a full window, at most one change
+static bool settle(ResolutionGovernor& governor, float frameMs)
+{
+    bool changed = false;
+    for(int f = 0; f < ResolutionGovernor::COOLDOWN + ResolutionGovernor::WINDOW; f++)
+        changed |= governor.Update(frameMs);
+    return changed;
+}
+
+static ResolutionGovernor governor(float targetMs, float minScale, int maxFrameSkip)
+{
+    ResolutionGovernor governor;
+    governor.Configure({targetMs, minScale, maxFrameSkip});
+    return governor;
+}
+
+bool SelfTest::ParseArgs(int numArgs, LPWSTR* args)
+{
+    for(int a = 1; a < numArgs; a++)
+    {
+        if(wcscmp(args[a], L"-selftest") == 0)
+            return true;
+    }
+    return false;
+}
+
+void SelfTest::Check(bool passed, const std::string& what)
+{
+    m_checks++;
+    if(!passed)
+    {
+        m_failures++;
+        printf("FAILED: %s\n", what.c_str());
+    }
+}
+
+void SelfTest::ProfilerAverages()
+{
+    PassProfiler profiler(64, 4);
+    const auto   a = profiler.Register("a");
+    const auto   b = profiler.Register("b");
+    Check(profiler.Register("a") == a && a != b, "profiler: section names are interned once");
+
+    profiler.Record(0, 0, {a, b}, {0, 100, 300});
+    auto  averages = profiler.Averages();
+    float lastFrameMs;
+    Check(averages.size() == 2 && averages[0].name == "a" && averages[1].name == "b", "profiler: averages of recorded sections, in order");
+    Check(averages.size() == 2 && approximately(averages[0].averageMs, 0.1f) && approximately(averages[1].averageMs, 0.2f), "profiler: section durations between marks");
+    Check(profiler.Recorded(lastFrameMs) == 1 && approximately(lastFrameMs, 0.3f), "profiler: frame count and last frame duration");
+
+    // sections without an end mark, and ids which were never registered, are left out
+    profiler.Record(1, 1000, {a, b}, {0, 50});
+    profiler.Record(2, 2000, {7, a}, {0, 10, 60});
+    averages = profiler.Averages();
+    Check(averages.size() == 2 && approximately(averages[0].averageMs, (0.1f + 0.05f + 0.05f) / 3) && approximately(averages[1].averageMs, 0.2f),
+          "profiler: incomplete and unknown sections are skipped");
+    Check(profiler.Recorded(lastFrameMs) == 3 && approximately(lastFrameMs, 0.06f), "profiler: frames with marks are counted");
+
+    // a frame without marks does not count
+    profiler.Record(3, 3000, {a}, {0});
+    Check(profiler.Recorded(lastFrameMs) == 3, "profiler: frames without marks are not counted");
+}
+
+void SelfTest::ProfilerWindow()
+{
+    PassProfiler profiler(64, 4);
+    const auto   a = profiler.Register("a");
+    for(int f = 1; f <= 6; f++)
+        profiler.Record(f, 1000.0 * f, {a}, {0, 100.0 * f});
+
+    // only the last four frames, 300-600 us
+    const auto averages = profiler.Averages();
+    Check(averages.size() == 1 && approximately(averages[0].averageMs, 0.45f), "profiler: average over the window only");
+    Check(averages.size() == 1 && approximately(averages[0].lastMs, 0.6f), "profiler: last duration");
+}
+
+void SelfTest::ProfilerWraparound()
+{
+    // room for three events, four are recorded
+    PassProfiler profiler(3, 4);
+    const auto   a = profiler.Register("a");
+    const auto   b = profiler.Register("b");
+    profiler.Record(0, 1000, {a, b}, {0, 100, 300});
+    profiler.Record(1, 2000, {a, b}, {0, 150, 400});
+
+    const auto trace  = profiler.ChromeTrace();
+    const auto first  = trace.find(traceEvent("\"b\"", "1100.000", "200.000", 0));
+    const auto second = trace.find(traceEvent("\"a\"", "2000.000", "150.000", 1));
+    const auto third  = trace.find(traceEvent("\"b\"", "2150.000", "250.000", 1));
+    Check(countOf(trace, "\"ph\":\"X\"") == 3, "profiler: trace keeps as many events as fit");
+    Check(trace.find("\"ts\":1000.000") == std::string::npos, "profiler: oldest event is overwritten");
+    Check(first != std::string::npos && second != std::string::npos && third != std::string::npos && first < second && second < third,
+          "profiler: trace events oldest first across the wraparound");
+
+    // averages are kept apart from the trace
+    const auto averages = profiler.Averages();
+    Check(averages.size() == 2 && approximately(averages[0].averageMs, 0.125f) && approximately(averages[1].averageMs, 0.225f),
+          "profiler: averages unaffected by trace capacity");
+}
+
+void SelfTest::ProfilerTrace()
+{
+    PassProfiler profiler(64, 4);
+    const auto   empty = profiler.ChromeTrace();
+    Check(empty == "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                   "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}}\n"
+                   "]}\n",
+          "profiler: empty trace is a valid document");
+
+    const auto section = profiler.Register("pass \"1\" \\ x");
+    profiler.Record(5, 250.5, {section}, {0, 0.25});
+    const auto trace = profiler.ChromeTrace();
+    Check(trace.find(traceEvent("\"pass \\\"1\\\" \\\\ x\"", "250.500", "0.250", 5)) != std::string::npos, "profiler: names escaped, times in microseconds");
+    Check(trace.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n") && trace.ends_with("}}\n]}\n") && countOf(trace, ",\n{") == 1,
+          "profiler: events separated within the document");
+}
+
+void SelfTest::ProfilerClear()
+{
+    PassProfiler profiler(64, 4);
+    const auto   a = profiler.Register("a");
+    profiler.Record(0, 0, {a}, {0, 500});
+    profiler.Clear();
+    Check(profiler.Averages().empty() && countOf(profiler.ChromeTrace(), "\"ph\":\"X\"") == 0, "profiler: clear drops averages and events");
+    Check(profiler.Register("a") == a, "profiler: section ids survive clear");
+
+    profiler.Record(1, 1000, {a}, {0, 100});
+    const auto averages = profiler.Averages();
+    Check(averages.size() == 1 && approximately(averages[0].averageMs, 0.1f), "profiler: averages start over after clear");
+}
+
+void SelfTest::GovernorWindow()
+{
+    auto g       = governor(10, 0.5f, 0);
+    bool changed = false;
+    for(int f = 1; f < ResolutionGovernor::WINDOW; f++)
+        changed |= g.Update(20);
+    Check(!changed && g.Scale() == 1.0f, "governor: no decision before a full window");
+    Check(g.Update(20) && approximately(g.Scale(), ResolutionGovernor::STEP), "governor: steps down at the end of the window");
+
+    // frames during the cooldown don't count, however slow
+    changed = false;
+    for(int f = 0; f < ResolutionGovernor::COOLDOWN; f++)
+        changed |= g.Update(1000);
+    Check(!changed && approximately(g.Scale(), ResolutionGovernor::STEP), "governor: cooldown after a change");
+
+    // within target, and the window mean rather than single frames decides
+    changed = false;
+    for(int f = 0; f < ResolutionGovernor::WINDOW; f++)
+        changed |= g.Update(f % 2 ? 2.0f : 15.0f);
+    Check(!changed, "governor: holds when the projected time is not far enough under target");
+
+    auto disabled = governor(0, 0.5f, 2);
+    Check(!settle(disabled, 100) && disabled.Scale() == 1.0f && disabled.FrameSkip() == 0, "governor: disabled without a target");
+}
+
+void SelfTest::GovernorStepDown()
+{
+    auto g     = governor(10, 0.5f, 0);
+    int  steps = 0;
+    while(settle(g, 20) && steps < 20)
+        steps++;
+    Check(steps == 5 && g.Scale() == 0.5f && g.FrameSkip() == 0, "governor: steps of 0.85 down to minScale, then stops");
+
+    // at target is not over it
+    auto atTarget = governor(10, 0.5f, 0);
+    Check(!settle(atTarget, 10) && atTarget.Scale() == 1.0f, "governor: no step down at target");
+}
+
+void SelfTest::GovernorStepUp()
+{
+    // one step down to 0.85, then frame times stepping back up would project to
+    auto g = governor(10, 0.5f, 0);
+    settle(g, 20);
+    const auto scale = g.Scale();
+    const auto ratio = (1.0f / scale) * (1.0f / scale); // cost grows with the pixel count
+
+    // projected just over the headroom stays, just under steps up
+    Check(!settle(g, 10 * ResolutionGovernor::HEADROOM / ratio * 1.02f) && g.Scale() == scale, "governor: no step up within the headroom");
+    Check(settle(g, 10 * ResolutionGovernor::HEADROOM / ratio * 0.98f) && g.Scale() == 1.0f, "governor: steps up below the headroom");
+
+    // the step up was too optimistic: back down, and no step up again until the hold runs out
+    Check(settle(g, 20) && g.Scale() == scale, "governor: steps down again when over target");
+    int frames = ResolutionGovernor::COOLDOWN; // already run by settle() after the change
+    do
+        frames++;
+    while(!g.Update(1) && frames < 2 * ResolutionGovernor::HOLD);
+    Check(frames == ResolutionGovernor::HOLD && g.Scale() == 1.0f, "governor: holds after an undone step up, then steps up");
+}
+
+void SelfTest::GovernorFloor()
+{
+    auto g     = governor(10, 0.01f, 0);
+    int  steps = 0;
+    while(settle(g, 100) && steps < 50)
+        steps++;
+    Check(g.Scale() == ResolutionGovernor::MIN_SCALE, "governor: minScale floor of 0.25");
+    Check(steps == 9 && !settle(g, 100), "governor: stops at the floor without frame skip");
+
+    auto high = governor(10, 2.0f, 0);
+    Check(!settle(high, 100) && high.Scale() == 1.0f, "governor: minScale above 1 keeps full resolution");
+}
+
+void SelfTest::GovernorSkip()
+{
+    // after the resolution, frames are skipped
+    auto g = governor(10, 0.85f, 2);
+    Check(settle(g, 40) && g.Scale() == 0.85f && g.FrameSkip() == 0, "governor: resolution first");
+    Check(settle(g, 40) && g.FrameSkip() == 1, "governor: then skips a frame");
+    Check(settle(g, 40) && g.FrameSkip() == 2 && !settle(g, 40), "governor: up to maxFrameSkip");
+
+    // a skipped frame gives the next one another target interval
+    auto skipping = governor(10, 1.0f, 1);
+    settle(skipping, 15);
+    Check(skipping.FrameSkip() == 1 && !settle(skipping, 15), "governor: target scales with skipped frames");
+
+    // frames come back before resolution, once well under the target of one fewer skip
+    Check(!settle(g, 10 * 2 * ResolutionGovernor::HEADROOM * 1.02f) && g.FrameSkip() == 2, "governor: no frame back within the headroom");
+    Check(settle(g, 10 * 2 * ResolutionGovernor::HEADROOM * 0.98f) && g.FrameSkip() == 1 && g.Scale() == 0.85f, "governor: frames back before resolution");
+
+    // presets without viewport-scaled passes go straight to skipping
+    auto fixed = governor(10, 0.5f, 1);
+    fixed.SetScalable(false);
+    Check(settle(fixed, 20) && fixed.Scale() == 1.0f && fixed.FrameSkip() == 1, "governor: skips frames when nothing scales");
+}
+
+int SelfTest::Run()
+{
+    // report to the console we were started from, if any
+    if(AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        FILE* f;
+        freopen_s(&f, "CONOUT$", "w", stdout);
+    }
+
+    ProfilerAverages();
+    ProfilerWindow();
+    ProfilerWraparound();
+    ProfilerTrace();
+    ProfilerClear();
+    GovernorWindow();
+    GovernorStepDown();
+    GovernorStepUp();
+    GovernorFloor();
+    GovernorSkip();
+
+    printf("%d checks, %d failed\n", m_checks, m_failures);
+    return m_failures ? 1 : 0;
+}
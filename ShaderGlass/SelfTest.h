@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+
+// headless "-selftest" mode: feeds synthetic input to components which need neither a device nor capture
+// (pass profiler, resolution governor) and checks what comes out, for a quick run after changing them
+class SelfTest
+{
+public:
+    static bool ParseArgs(int numArgs, LPWSTR* args);
+    int         Run();
+
+private:
+    void Check(bool passed, const std::string& what);
+
+    void ProfilerAverages();
+    void ProfilerWindow();
+    void ProfilerWraparound();
+    void ProfilerTrace();
+    void ProfilerClear();
+
+    void GovernorWindow();
+    void GovernorStepDown();
+    void GovernorStepUp();
+    void GovernorFloor();
+    void GovernorSkip();
+
+    int m_checks {0};
+    int m_failures {0};
+};
@@ -2,10 +2,8 @@
 
 #include "Shader.h"
 
-static HRESULT hr;
-
 Shader::Shader(ShaderDef& shaderDef) :
-    m_shaderDef(shaderDef), m_vertexShader {}, m_pixelShader {}, m_alias {}, m_scaleAbsoluteX {}, m_scaleAbsoluteY {}, m_scaleViewportX {},
+    m_shaderDef(shaderDef), m_program {}, m_alias {}, m_scaleAbsoluteX {}, m_scaleAbsoluteY {}, m_scaleViewportX {},
     m_scaleViewportY {}
 {
     m_pushBuffer = std::make_unique<int[]>(BufferSize(PUSH_BUFFER));
@@ -73,22 +71,26 @@ Shader::Shader(ShaderDef& shaderDef) :
     }
 }
 
-void Shader::Create(winrt::com_ptr<ID3D11Device> d3dDevice)
+void Shader::Create(RenderBackend& backend)
 {
     if(m_shaderDef.VertexLength == 0)
         Compile();
 
-    hr = d3dDevice->CreateVertexShader(m_shaderDef.VertexByteCode, m_shaderDef.VertexLength, NULL, m_vertexShader.put());
-    assert(SUCCEEDED(hr));
+    m_program = backend.CreateProgram(m_shaderDef);
+    m_variant = nullptr;
+}
 
-    hr = d3dDevice->CreatePixelShader(m_shaderDef.FragmentByteCode, m_shaderDef.FragmentLength, NULL, m_pixelShader.put());
-    assert(SUCCEEDED(hr));
+void Shader::Create(RenderBackend& backend, const ShaderDef& program, std::shared_ptr<const CompiledShader> variant)
+{
+    m_program = backend.CreateProgram(program);
+    m_variant = std::move(variant);
 }
 
 void Shader::Compile()
 {
     UINT                     flags = 0; // D3DCOMPILE_ENABLE_STRICTNESS;
     winrt::com_ptr<ID3DBlob> errorBlob;
+    HRESULT                  hr;
 
     hr = D3DCompile(m_shaderDef.VertexSource,
                     strlen(m_shaderDef.VertexSource),
@@ -202,10 +204,18 @@ Shader::Shader(Shader&& shader) : m_shaderDef(shader.m_shaderDef)
     throw new std::runtime_error("This shouldn't happen");
 }
 
+Shader::Shader(ShaderDef& shaderDef, Shader&& created) :
+    m_shaderDef(shaderDef), m_program {std::move(created.m_program)}, m_variant {std::move(created.m_variant)}, m_alias {std::move(created.m_alias)}, m_scaleX {created.m_scaleX},
+    m_scaleY {created.m_scaleY}, m_scaleViewportX {created.m_scaleViewportX}, m_scaleViewportY {created.m_scaleViewportY},
+    m_scaleAbsoluteX {created.m_scaleAbsoluteX}, m_scaleAbsoluteY {created.m_scaleAbsoluteY}, m_formatSRGB {created.m_formatSRGB},
+    m_formatFloat {created.m_formatFloat}, m_filterLinear {created.m_filterLinear}, m_clamp {created.m_clamp}, m_frameCountMod {created.m_frameCountMod},
+    m_pushBuffer {std::move(created.m_pushBuffer)}, m_uboBuffer {std::move(created.m_uboBuffer)}, m_vertexBlob {std::move(created.m_vertexBlob)},
+    m_pixelBlob {std::move(created.m_pixelBlob)}
+{ }
+
 Shader::~Shader()
 {
-    m_pixelShader  = nullptr;
-    m_vertexShader = nullptr;
+    m_program      = nullptr;
     m_vertexBlob   = nullptr;
     m_pixelBlob    = nullptr;
 }
\ No newline at end of file
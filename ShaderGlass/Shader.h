@@ -3,6 +3,9 @@
 #pragma once
 
 #include "ShaderDef.h"
+#include "RenderBackend.h"
+
+struct CompiledShader;
 
 constexpr auto PUSH_BUFFER = -1;
 constexpr auto UBO_BUFFER  = 0;
@@ -28,27 +31,29 @@ union float4x4
 class Shader
 {
 public:
-    ShaderDef&                         m_shaderDef;
-    winrt::com_ptr<ID3D11VertexShader> m_vertexShader;
-    winrt::com_ptr<ID3D11PixelShader>  m_pixelShader;
-    std::string                        m_alias {};
-    float                              m_scaleX {1.0f};
-    float                              m_scaleY {1.0f};
-    bool                               m_scaleViewportX {false};
-    bool                               m_scaleViewportY {false};
-    bool                               m_scaleAbsoluteX {false};
-    bool                               m_scaleAbsoluteY {false};
-    bool                               m_formatSRGB {false};
-    bool                               m_formatFloat {false};
-    bool                               m_filterLinear {false};
-    bool                               m_clamp {false};
-    int                                m_frameCountMod {0};
+    ShaderDef&                            m_shaderDef;
+    std::shared_ptr<RenderProgram>        m_program;
+    std::shared_ptr<const CompiledShader> m_variant {nullptr}; // code the program was created from instead of the definition's
+    std::string                           m_alias {};
+    float                                 m_scaleX {1.0f};
+    float                                 m_scaleY {1.0f};
+    bool                                  m_scaleViewportX {false};
+    bool                                  m_scaleViewportY {false};
+    bool                                  m_scaleAbsoluteX {false};
+    bool                                  m_scaleAbsoluteY {false};
+    bool                                  m_formatSRGB {false};
+    bool                                  m_formatFloat {false};
+    bool                                  m_filterLinear {false};
+    bool                                  m_clamp {false};
+    int                                   m_frameCountMod {0};
 
     Shader(ShaderDef& shaderDef);
     Shader(Shader&& shader);
+    Shader(ShaderDef& shaderDef, Shader&& created); // takes over a shader created from the same definition, creating nothing
     ~Shader();
 
-    void                      Create(winrt::com_ptr<ID3D11Device> d3dDevice);
+    void                      Create(RenderBackend& backend);
+    void                      Create(RenderBackend& backend, const ShaderDef& program, std::shared_ptr<const CompiledShader> variant);
     void                      Compile();
     std::vector<ShaderParam*> Params();
     void                      FillParams(int buffer, void* data);
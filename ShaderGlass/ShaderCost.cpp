@@ -0,0 +1,132 @@
+#include "pch.h"
+
+#include "ShaderCost.h"
+#include "Preset.h"
+
+// DXBC container: magic, checksum, version, size, chunk count and offsets, each chunk a fourcc and size
+constexpr size_t   DXBC_CHUNK_OFFSETS = 32;
+constexpr uint32_t STAT_FOURCC        = 'S' | ('T' << 8) | ('A' << 16) | ('T' << 24);
+
+// D3D11 shader statistics, as reported by shader reflection
+constexpr int STAT_INSTRUCTIONS    = 0;
+constexpr int STAT_DYNAMIC_FLOW    = 8;
+constexpr int STAT_TEXTURE_FIRST   = 14; // normal, load, comparison, bias and gradient sampling
+constexpr int STAT_TEXTURE_LAST    = 18;
+constexpr int STAT_MIN_DWORDS      = STAT_TEXTURE_LAST + 1;
+
+static uint32_t readDword(const BYTE* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+bool ShaderCost::ReadStat(const BYTE* byteCode, SIZE_T length, int& instructions, int& textureFetches, bool& loops)
+{
+    if(byteCode == nullptr || length < DXBC_CHUNK_OFFSETS || memcmp(byteCode, "DXBC", 4) != 0)
+        return false;
+
+    const auto chunkCount = readDword(byteCode + 28);
+    if(DXBC_CHUNK_OFFSETS + chunkCount * 4ull > length)
+        return false;
+
+    for(uint32_t c = 0; c < chunkCount; c++)
+    {
+        const auto offset = readDword(byteCode + DXBC_CHUNK_OFFSETS + c * 4);
+        if(offset + 8ull > length)
+            return false;
+        const auto size = readDword(byteCode + offset + 4);
+        if(readDword(byteCode + offset) != STAT_FOURCC || size < STAT_MIN_DWORDS * 4 || offset + 8ull + size > length)
+            continue;
+
+        const auto stat = byteCode + offset + 8;
+        instructions    = static_cast<int>(readDword(stat + STAT_INSTRUCTIONS * 4));
+        textureFetches  = 0;
+        for(int t = STAT_TEXTURE_FIRST; t <= STAT_TEXTURE_LAST; t++)
+            textureFetches += static_cast<int>(readDword(stat + t * 4));
+        loops = readDword(stat + STAT_DYNAMIC_FLOW * 4) != 0;
+        return true;
+    }
+    return false;
+}
+
+ShaderStats ShaderCost::Stats(const ShaderDef& shaderDef)
+{
+    ShaderStats stats;
+    stats.vertexInstructions   = shaderDef.VertexInstructions;
+    stats.fragmentInstructions = shaderDef.FragmentInstructions;
+    stats.textureFetches       = shaderDef.FragmentTextureFetches;
+    stats.loops                = shaderDef.FragmentLoops;
+
+    int  fetches = 0;
+    bool loops   = false;
+    if(stats.vertexInstructions == 0)
+        ReadStat(shaderDef.VertexByteCode, shaderDef.VertexLength, stats.vertexInstructions, fetches, loops);
+    if(stats.fragmentInstructions == 0)
+        ReadStat(shaderDef.FragmentByteCode, shaderDef.FragmentLength, stats.fragmentInstructions, stats.textureFetches, stats.loops);
+
+    return stats;
+}
+
+PresetCost ShaderCost::Estimate(PresetDef& presetDef, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight)
+{
+    PresetCost cost;
+
+    // builds the definition if needed, shaders only parse their scale parameters
+    Preset preset(presetDef);
+
+    UINT sourceWidth  = originalWidth;
+    UINT sourceHeight = originalHeight;
+    for(size_t p = 0; p < presetDef.ShaderDefs.size(); p++)
+    {
+        Shader shader(presetDef.ShaderDefs[p]);
+
+        // pass sizes, same rules as the interactive chain
+        UINT passWidth, passHeight;
+        if(p == presetDef.ShaderDefs.size() - 1)
+        {
+            passWidth  = outputWidth;
+            passHeight = outputHeight;
+        }
+        else
+        {
+            if(shader.m_scaleViewportX)
+                passWidth = static_cast<UINT>(outputWidth * shader.m_scaleX);
+            else if(shader.m_scaleAbsoluteX)
+                passWidth = static_cast<UINT>(shader.m_scaleX);
+            else
+                passWidth = static_cast<UINT>(sourceWidth * shader.m_scaleX);
+            if(shader.m_scaleViewportY)
+                passHeight = static_cast<UINT>(outputHeight * shader.m_scaleY);
+            else if(shader.m_scaleAbsoluteY)
+                passHeight = static_cast<UINT>(shader.m_scaleY);
+            else
+                passHeight = static_cast<UINT>(sourceHeight * shader.m_scaleY);
+        }
+
+        PassCost pass;
+        pass.width  = passWidth;
+        pass.height = passHeight;
+        pass.stats  = Stats(presetDef.ShaderDefs[p]);
+        pass.ops    = static_cast<double>(passWidth) * passHeight * (pass.stats.fragmentInstructions + FETCH_WEIGHT * pass.stats.textureFetches);
+
+        cost.ops += pass.ops;
+        cost.loops |= pass.stats.loops;
+        cost.passes.push_back(pass);
+
+        sourceWidth  = passWidth;
+        sourceHeight = passHeight;
+    }
+
+    return cost;
+}
+
+std::string PresetCost::Describe() const
+{
+    char description[32];
+    if(ops >= 1e9)
+        snprintf(description, 32, "%.2f Gops%s", ops / 1e9, loops ? "+" : "");
+    else
+        snprintf(description, 32, "%.0f Mops%s", ops / 1e6, loops ? "+" : "");
+    return description;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "PresetDef.h"
+#include <string>
+#include <vector>
+
+// static cost indicators of a compiled pass
+struct ShaderStats
+{
+    int  vertexInstructions {0};
+    int  fragmentInstructions {0};
+    int  textureFetches {0};
+    bool loops {false}; // instruction counts are a lower bound
+};
+
+struct PassCost
+{
+    uint32_t    width {0};
+    uint32_t    height {0};
+    ShaderStats stats {};
+    double      ops {0};
+};
+
+struct PresetCost
+{
+    std::vector<PassCost> passes;
+    double                ops {0}; // per frame
+    bool                  loops {false};
+
+    std::string Describe() const; // e.g. "1.25 Gops", with a + where loops make it a lower bound
+};
+
+// per-frame shading cost estimated from instruction and texture-fetch counts and the pass sizes,
+// for comparing presets rather than predicting frame times
+class ShaderCost
+{
+public:
+    static constexpr double FETCH_WEIGHT = 4.0; // a texture fetch costs a few ALU instructions
+
+    // counts recorded by ShaderGen, or read from the bytecode's STAT chunk for older headers
+    static ShaderStats Stats(const ShaderDef& shaderDef);
+
+    // original is the preprocessed input, i.e. input divided by pixel size
+    static PresetCost Estimate(PresetDef& presetDef, uint32_t originalWidth, uint32_t originalHeight, uint32_t outputWidth, uint32_t outputHeight);
+
+private:
+    static bool ReadStat(const BYTE* byteCode, SIZE_T length, int& instructions, int& textureFetches, bool& loops);
+};
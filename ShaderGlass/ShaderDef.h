@@ -39,7 +39,8 @@ class ShaderDef
 public:
     ShaderDef() :
         Params {}, Samplers {}, VertexSource {}, FragmentSource {}, Name {}, VertexByteCode {}, FragmentByteCode {}, VertexLength {},
-        FragmentLength {}, Format {}
+        FragmentLength {}, Format {}, VertexInstructions {}, FragmentInstructions {}, FragmentTextureFetches {}, FragmentLoops {},
+        VertexSpirv {}, FragmentSpirv {}, VertexSpirvLength {}, FragmentSpirvLength {}, VertexGlsl {}, FragmentGlsl {}
     { }
 
     std::vector<ShaderParam> Params;
@@ -54,6 +55,22 @@ public:
     SIZE_T FragmentLength;
     const char* Format;
 
+    // recorded by ShaderGen, zero in headers generated before it did
+    int  VertexInstructions;
+    int  FragmentInstructions;
+    int  FragmentTextureFetches;
+    bool FragmentLoops;
+
+    // same passes for Vulkan and OpenGL (3.30) backends, from the module the bytecode was cross-compiled from;
+    // bindings and offsets are those of Params and Samplers, null in headers generated before ShaderGen emitted them
+    // or for passes whose SPIR-V or GLSL did not validate
+    const BYTE* VertexSpirv;
+    const BYTE* FragmentSpirv;
+    SIZE_T      VertexSpirvLength;
+    SIZE_T      FragmentSpirvLength;
+    const char* VertexGlsl;
+    const char* FragmentGlsl;
+
     size_t ParamsSize(int buffer)
     {
         int maxLen = 0;
@@ -1,12 +1,12 @@
 #include "pch.h"
 #include "ShaderGlass.h"
 #include "ShaderList.h"
+#include "PresetLoader.h"
 #include "resource.h"
 #include <tuple>
 
 using std::get;
 
-static HRESULT hr;
 static const float background_colour[4] = {0, 0, 0, 1.0f};
 
 ShaderGlass::ShaderGlass() :
@@ -16,6 +16,16 @@ ShaderGlass::ShaderGlass() :
 
 ShaderGlass::~ShaderGlass()
 {
+    if(m_buildThread.joinable())
+    {
+        {
+            std::unique_lock buildLock(m_buildMutex);
+            m_buildStop = true;
+        }
+        m_buildCondition.notify_one();
+        m_buildThread.join();
+    }
+
     std::unique_lock lock(m_mutex);
 
     DestroyShaders();
@@ -26,8 +36,9 @@ ShaderGlass::~ShaderGlass()
 }
 
 void ShaderGlass::Initialize(
-    HWND outputWindow, HWND captureWindow, HMONITOR captureMonitor, bool clone, bool image, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context)
+    HWND outputWindow, HWND captureWindow, HMONITOR captureMonitor, bool clone, bool image, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context, PresetCache* presetCache)
 {
+    m_presetCache   = presetCache;
     m_outputWindow  = outputWindow;
     m_captureWindow = captureWindow;
     m_clone         = clone;
@@ -63,9 +74,14 @@ void ShaderGlass::Initialize(
     m_lastSize.x = clientRect.right;
     m_lastSize.y = clientRect.bottom;
 
-    m_prevTicks = GetTickCount64();
+    // end-to-end latency should stay within one refresh
+    DWM_TIMING_INFO timingInfo = {};
+    timingInfo.cbSize          = sizeof(timingInfo);
+    if(SUCCEEDED(DwmGetCompositionTimingInfo(NULL, &timingInfo)) && timingInfo.rateRefresh.uiNumerator)
+        m_metrics.SetLatencyBudget(1000.0f * timingInfo.rateRefresh.uiDenominator / timingInfo.rateRefresh.uiNumerator);
 
     // create swapchain
+    HRESULT hr;
     {
         winrt::com_ptr<IDXGIFactory2> dxgiFactory;
         {
@@ -112,41 +128,158 @@ void ShaderGlass::Initialize(
     if(!m_displayTexture)
         throw std::exception("Unable to create framebuffer");
 
-    m_device->CreateRenderTargetView(m_displayTexture.get(), 0, m_displayRenderTarget.put());
+    // everything past the swapchain goes through the backend
+    m_backend       = std::make_shared<D3D11Backend>(m_device, m_context);
+    m_displayTarget = m_backend->Wrap(m_displayTexture, true);
 
-    D3D11_RASTERIZER_DESC desc = {};
-    desc.CullMode              = D3D11_CULL_NONE;
-    desc.FillMode              = D3D11_FILL_SOLID;
-    desc.DepthClipEnable       = FALSE;
-    desc.MultisampleEnable     = FALSE;
-    hr                         = m_device->CreateRasterizerState(&desc, m_rasterizerState.put());
-    assert(SUCCEEDED(hr));
+    m_preprocessShader.Create(*m_backend);
+    m_preprocessPass.Initialize(m_backend);
+    RebuildShaders();
 
-    m_context->RSSetState(m_rasterizerState.get());
+    m_profiler.SetTimer(m_backend->CreateTimer());
+    m_preprocessSection = m_profiler.Register("preprocess");
+    m_feedbackSection   = m_profiler.Register("feedback copies");
+    m_historySection    = m_profiler.Register("history copies");
 
-    m_preprocessShader.Create(m_device);
-    m_preprocessPass.Initialize(m_device, m_context);
-    RebuildShaders();
+    m_buildThread = std::thread(&ShaderGlass::BuildThreadFunc, this);
 
     m_running = true;
 }
 
 void ShaderGlass::RebuildShaders()
 {
-    m_shaderPreset->Create(m_device);
+    m_shaderPreset->Create(*m_backend);
     m_shaderPasses.reserve(m_shaderPreset->m_shaders.size());
     for(auto& shader : m_shaderPreset->m_shaders)
     {
-        m_shaderPasses.emplace_back(shader, *m_shaderPreset, m_device, m_context);
+        m_shaderPasses.emplace_back(shader, *m_shaderPreset, m_backend);
     }
 
+    UpdatePresetResources();
+}
+
+void ShaderGlass::UpdatePresetResources()
+{
     m_presetTextures.clear();
     for(auto& texture : m_shaderPreset->m_textures)
     {
-        m_presetTextures.insert(make_pair(texture.second.m_name, texture.second.m_textureView));
+        m_presetTextures.insert(make_pair(texture.second.m_name, texture.second.m_texture));
     }
 
-    ResetParams();
+    ResetChainParams();
+}
+
+void ShaderGlass::BuildPreset(PresetDef& presetDef, PresetBuild& build)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    // shader objects, decoded textures and samplers/buffers of every pass, sizing happens on the render thread
+    build.preset = std::make_unique<Preset>(presetDef);
+    build.preset->Create(*m_backend);
+    build.passes.reserve(build.preset->m_shaders.size());
+    for(auto& shader : build.preset->m_shaders)
+    {
+        build.passes.emplace_back(shader, *build.preset, m_backend);
+    }
+
+    PresetCache::EstimateSize(build);
+    build.buildTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void ShaderGlass::BuildThreadFunc()
+{
+    // WIC texture decoding requires COM on this thread
+    auto comInit = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+    std::unique_lock lock(m_buildMutex);
+    while(true)
+    {
+        m_buildCondition.wait(lock, [this] { return m_buildStop || m_requestedPreset != nullptr; });
+        if(m_buildStop)
+            break;
+
+        auto presetDef    = m_requestedPreset;
+        auto params       = std::move(m_requestedParams);
+        auto requested    = m_requestedTime;
+        m_requestedPreset = nullptr;
+        m_requestedParams.clear();
+
+        lock.unlock();
+
+        // held until published, so a replacement of passes either sees this build or is seen by it
+        std::unique_lock             defsLock(PresetDef::ShaderDefsMutex);
+        std::unique_ptr<PresetBuild> build;
+        if(m_presetCache)
+            build = m_presetCache->Take(presetDef);
+        if(!build)
+        {
+            build = std::make_unique<PresetBuild>();
+            BuildPreset(*presetDef, *build);
+        }
+        build->params    = std::move(params);
+        build->requested = requested;
+        lock.lock();
+
+        // only publish if no newer preset has been requested in the meantime
+        if(m_requestedPreset == nullptr && !m_buildStop)
+        {
+            if(m_readyBuild && m_presetCache)
+                m_presetCache->Store(std::move(m_readyBuild));
+            m_readyBuild = std::move(build);
+        }
+        else if(m_presetCache)
+        {
+            m_presetCache->Store(std::move(build));
+        }
+        defsLock.unlock();
+    }
+    m_readyBuild.reset();
+    lock.unlock();
+
+    if(SUCCEEDED(comInit))
+        CoUninitialize();
+}
+
+void ShaderGlass::SwapPreset(PresetBuild& build)
+{
+    // old chain ends up in build, to be cached or released by the caller
+    m_shaderPreset.swap(build.preset);
+    m_shaderPasses.swap(build.passes);
+    UpdatePresetResources();
+
+    if(build.params.size())
+    {
+        const auto& shaderParams = ChainParams();
+        for(const auto& ip : build.params)
+        {
+            for(const auto& sp : shaderParams)
+            {
+                if(std::get<0>(ip) == std::get<0>(sp) && std::get<1>(ip) == std::get<1>(sp)->name)
+                {
+                    std::get<1>(sp)->currentValue = std::get<2>(ip);
+                    break;
+                }
+            }
+        }
+        UpdateChainParams();
+    }
+
+    m_switchStart   = build.requested;
+    m_switchPending = true;
+
+#ifdef _DEBUG
+    char buildTime[128];
+    if(m_presetCache)
+        snprintf(buildTime,
+                 128,
+                 "Preset built in %.1f ms, cache hit rate %.0f%%, %d evictions\n",
+                 build.buildTime,
+                 m_presetCache->HitRate() * 100.0f,
+                 m_presetCache->Evictions());
+    else
+        snprintf(buildTime, 128, "Preset built in %.1f ms\n", build.buildTime);
+    OutputDebugStringA(buildTime);
+#endif
 }
 
 void ShaderGlass::SetInputScale(float w, float h)
@@ -156,6 +289,41 @@ void ShaderGlass::SetInputScale(float w, float h)
     m_inputRescaled = true;
 }
 
+void ShaderGlass::SetTextureBudget(size_t bytes)
+{
+    m_textureBudget = bytes;
+    m_inputRescaled = true;
+}
+
+TextureMemory ShaderGlass::TextureUsage(bool& reduced)
+{
+    std::unique_lock lock(m_textureMemoryMutex);
+    reduced = m_textureReduced;
+    return m_textureMemory;
+}
+
+bool ShaderGlass::ChainSize(UINT& originalWidth, UINT& originalHeight, UINT& viewportWidth, UINT& viewportHeight)
+{
+    originalWidth  = m_originalWidth;
+    originalHeight = m_originalHeight;
+    viewportWidth  = m_viewportWidth;
+    viewportHeight = m_viewportHeight;
+    return originalWidth && originalHeight && viewportWidth && viewportHeight;
+}
+
+void ShaderGlass::SetGovernor(const GovernorSettings& settings)
+{
+    std::unique_lock lock(m_governorMutex);
+    m_governorSettings = settings;
+    m_governorUpdated  = true;
+}
+
+float ShaderGlass::GovernorScale(int& frameSkip)
+{
+    frameSkip = m_governorSkip;
+    return m_governorScale;
+}
+
 void ShaderGlass::SetOutputScale(float w, float h)
 {
     m_outputScaleW   = w;
@@ -170,10 +338,132 @@ void ShaderGlass::SetOutputFlip(bool h, bool v)
     m_outputRescaled = true;
 }
 
-void ShaderGlass::SetShaderPreset(PresetDef* p, const std::vector<std::tuple<int, std::string, double>>& params)
+void ShaderGlass::SetShaderPreset(PresetDef* p, const std::vector<std::tuple<int, std::string, double>>& params, std::chrono::steady_clock::time_point requested)
 {
-    m_newShaderPreset = std::make_unique<Preset>(*p);
-    m_newParams       = params;
+    {
+        std::unique_lock buildLock(m_buildMutex);
+        m_requestedPreset = p;
+        m_requestedParams = params;
+        m_requestedTime   = requested;
+    }
+    m_buildCondition.notify_one();
+}
+
+void ShaderGlass::ReplacePasses(PresetDef* p, std::vector<std::pair<size_t, ShaderDef>> passes, std::chrono::steady_clock::time_point detected)
+{
+    std::unique_lock buildLock(m_buildMutex);
+    m_replacements.push_back({p, std::move(passes), detected});
+}
+
+void ShaderGlass::ReplacePrograms(PresetDef* p, std::vector<std::pair<size_t, std::shared_ptr<const CompiledShader>>> programs)
+{
+    std::unique_lock buildLock(m_buildMutex);
+    m_replacements.push_back({p, {}, {}, true, std::move(programs)});
+}
+
+std::shared_ptr<const CompiledShader> ShaderGlass::PassVariant(const PresetDef* p, size_t pass)
+{
+    std::unique_lock lock(m_chainMutex);
+    if(!m_shaderPreset || &m_shaderPreset->m_presetDef != p || pass >= m_shaderPreset->m_shaders.size())
+        return nullptr;
+    return m_shaderPreset->m_shaders[pass].m_variant;
+}
+
+bool ShaderGlass::ApplyReplacement(PassReplacement& replacement)
+{
+    // dropped if another preset took over in the meantime
+    if(!m_shaderPreset || &m_shaderPreset->m_presetDef != replacement.preset)
+        return false;
+    for(const auto& pass : replacement.passes)
+    {
+        if(pass.first >= m_shaderPasses.size())
+            return false;
+    }
+    for(const auto& program : replacement.programs)
+    {
+        if(program.first >= m_shaderPasses.size())
+            return false;
+    }
+
+    // same parameters, so shader and pass can stay and only the program is created again; the definition is
+    // shared with cached chains and cost estimates, so it keeps its own code and the shader keeps the variant
+    auto& presetDef = m_shaderPreset->m_presetDef;
+    if(replacement.codeOnly)
+    {
+        for(const auto& program : replacement.programs)
+        {
+            auto& shader = m_shaderPreset->m_shaders[program.first];
+            if(!program.second)
+            {
+                shader.Create(*m_backend);
+                continue;
+            }
+            auto def = presetDef.ShaderDefs[program.first];
+            PresetLoader::Define(*program.second, def);
+            shader.Create(*m_backend, def, program.second);
+        }
+        return true;
+    }
+
+    // current values by pass and name, the edited pass may declare other parameters now
+    std::map<std::pair<int, std::string>, float> values;
+    for(const auto& param : ChainParams())
+        values[std::make_pair(std::get<0>(param), std::get<1>(param)->name)] = std::get<1>(param)->currentValue;
+
+    // everything that can fail is created against the new definitions first, the chain keeps its passes if it does
+    std::vector<std::pair<std::unique_ptr<Shader>, std::unique_ptr<ShaderPass>>> created;
+    try
+    {
+        for(auto& pass : replacement.passes)
+        {
+            auto shader = std::make_unique<Shader>(pass.second);
+            shader->Create(*m_backend);
+            auto shaderPass = std::make_unique<ShaderPass>(*shader, *m_shaderPreset, m_backend);
+            created.emplace_back(std::move(shader), std::move(shaderPass));
+        }
+    }
+    catch(const std::exception& e)
+    {
+        OutputDebugStringA(e.what());
+        return false;
+    }
+
+    // shader and pass refer to the definition, so all three are replaced where they are, taking over what was created;
+    // builds of the old definitions waiting to be switched to would refer to the new ones with old programs
+    std::unique_lock defsLock(PresetDef::ShaderDefsMutex);
+    if(m_presetCache)
+        m_presetCache->Drop(replacement.preset);
+    {
+        std::unique_lock buildLock(m_buildMutex);
+        if(m_readyBuild && &m_readyBuild->preset->m_presetDef == replacement.preset)
+            m_readyBuild.reset();
+    }
+    for(size_t r = 0; r < replacement.passes.size(); r++)
+    {
+        auto& pass   = replacement.passes[r];
+        auto& shader = m_shaderPreset->m_shaders[pass.first];
+        std::destroy_at(&m_shaderPasses[pass.first]);
+        std::destroy_at(&shader);
+        std::swap(presetDef.ShaderDefs[pass.first], pass.second);
+        m_retiredDefs.push_back(std::move(pass.second));
+        std::construct_at(&shader, presetDef.ShaderDefs[pass.first], std::move(*created[r].first));
+        std::construct_at(&m_shaderPasses[pass.first], shader, *m_shaderPreset, std::move(*created[r].second));
+    }
+    defsLock.unlock();
+
+    ResetChainParams();
+    for(const auto& param : ChainParams())
+    {
+        const auto value = values.find(std::make_pair(std::get<0>(param), std::get<1>(param)->name));
+        if(value != values.end())
+            std::get<1>(param)->currentValue = value->second;
+    }
+    UpdateChainParams();
+
+    m_profiledPreset = nullptr;
+    m_switchStart    = replacement.detected;
+    m_switchPending  = true;
+    return true;
 }
 
 void ShaderGlass::SetFrameSkip(int s)
@@ -198,15 +488,34 @@ void ShaderGlass::SetFreeScale(bool freeScale)
 
 void ShaderGlass::DestroyTargets()
 {
-    if(m_preprocessedRenderTarget != nullptr)
-    {
-        m_preprocessedRenderTarget = nullptr;
-        m_originalView             = nullptr;
-        m_preprocessedTexture      = nullptr;
-    }
+    m_preprocessedTexture = nullptr;
+}
+
+bool ShaderGlass::IsRunning(const PresetDef* p)
+{
+    std::unique_lock chainLock(m_chainMutex);
+    return m_shaderPreset && &m_shaderPreset->m_presetDef == p;
 }
 
 void ShaderGlass::UpdateParams()
+{
+    std::unique_lock chainLock(m_chainMutex);
+    UpdateChainParams();
+}
+
+void ShaderGlass::ResetParams()
+{
+    std::unique_lock chainLock(m_chainMutex);
+    ResetChainParams();
+}
+
+std::vector<std::tuple<int, ShaderParam*>> ShaderGlass::Params()
+{
+    std::unique_lock chainLock(m_chainMutex);
+    return ChainParams();
+}
+
+void ShaderGlass::UpdateChainParams()
 {
     for(auto& s : m_shaderPreset->m_shaders)
         for(auto& p : s.Params())
@@ -216,7 +525,7 @@ void ShaderGlass::UpdateParams()
         }
 }
 
-void ShaderGlass::ResetParams()
+void ShaderGlass::ResetChainParams()
 {
     for(auto& s : m_shaderPreset->m_shaders)
         for(auto& p : s.Params())
@@ -242,7 +551,7 @@ void ShaderGlass::ResetParams()
         }
 }
 
-std::vector<std::tuple<int, ShaderParam*>> ShaderGlass::Params()
+std::vector<std::tuple<int, ShaderParam*>> ShaderGlass::ChainParams()
 {
     std::vector<std::tuple<int, ShaderParam*>> params;
     int                                        i = 0;
@@ -267,19 +576,18 @@ bool ShaderGlass::TryResizeSwapChain(const RECT& clientRect, bool force)
         m_lastSize.x = clientRect.right;
         m_lastSize.y = clientRect.bottom;
 
-        m_displayTexture      = nullptr;
-        m_displayRenderTarget = nullptr;
+        m_displayTexture = nullptr;
+        m_displayTarget  = nullptr;
 
         if(clientRect.right > 0 && clientRect.bottom > 0)
         {
-            hr = m_swapChain->ResizeBuffers(0, static_cast<UINT>(clientRect.right), static_cast<UINT>(clientRect.bottom), DXGI_FORMAT_UNKNOWN, 0);
+            HRESULT hr = m_swapChain->ResizeBuffers(0, static_cast<UINT>(clientRect.right), static_cast<UINT>(clientRect.bottom), DXGI_FORMAT_UNKNOWN, 0);
             assert(SUCCEEDED(hr));
 
             hr = m_swapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)m_displayTexture.put());
             assert(SUCCEEDED(hr));
 
-            hr = m_device->CreateRenderTargetView(m_displayTexture.get(), NULL, m_displayRenderTarget.put());
-            assert(SUCCEEDED(hr));
+            m_displayTarget = m_backend->Wrap(m_displayTexture, true);
         }
         return true;
     }
@@ -293,17 +601,6 @@ void ShaderGlass::DestroyShaders()
 
 void ShaderGlass::DestroyPasses()
 {
-    for(auto& rs : m_passResources)
-    {
-        const auto& key = rs.first;
-        // Check string prefixes without using starts_with
-        if(key.size() >= 10 && key.substr(0, 10) == "PassOutput" || 
-           key.size() >= 12 && key.substr(0, 12) == "PassFeedback")
-        {
-            rs.second = nullptr;
-        }
-    }
-    m_passTargets.clear();
     m_passTextures.clear();
     m_passResources.clear();
     m_requiresFeedback = false;
@@ -317,7 +614,7 @@ void ShaderGlass::PresentFrame()
     PostMessage(m_outputWindow, WM_PAINT, 0, 0); // necessary for click-through
 }
 
-void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
+void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture, uint64_t sequence, int64_t captured)
 {
     m_frameCounter++;
 
@@ -330,9 +627,13 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
     }
 #endif
 
-    if(!m_running || !texture || (m_frameSkip != 0 && (m_frameCounter % (m_frameSkip + 1) != 0)))
+    // user choice plus whatever the governor needs to hold its target
+    const int frameSkip = m_frameSkip + m_governorSkip;
+    if(!m_running || !texture || (frameSkip != 0 && (m_frameCounter % (frameSkip + 1) != 0)))
     {
         // skip frame
+        if(texture)
+            m_metrics.Skipped(sequence);
         PresentFrame();
         return;
     }
@@ -340,10 +641,22 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
     std::unique_lock lock(m_mutex, std::try_to_lock);
     if(!lock.owns_lock())
     {
-        // still rendering, drop frame
+        // still rendering, drop frame; counted as a gap in the capture sequence
         return;
     }
 
+    const auto renderStart = FrameMetrics::Now();
+
+    if(m_governorUpdated)
+    {
+        std::unique_lock governorLock(m_governorMutex);
+        m_governor.Configure(m_governorSettings);
+        m_governorUpdated = false;
+        m_governorScale   = m_governor.Scale();
+        m_governorSkip    = m_governor.FrameSkip();
+        m_inputRescaled   = true;
+    }
+
     POINT topLeft;
     topLeft.x = 0;
     topLeft.y = 0;
@@ -471,47 +784,64 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
     // force recreate
     if(inputRescaled)
     {
-        if(m_preprocessedRenderTarget != nullptr)
+        if(m_preprocessedTexture != nullptr)
         {
             DestroyTargets();
         }
-        else
+        else if(m_displayTarget != nullptr)
         {
-            // clear any blanks around captured window            
-            m_context->ClearRenderTargetView(m_displayRenderTarget.get(), background_colour);
+            // clear any blanks around captured window
+            m_backend->Clear(*m_displayTarget, background_colour);
         }
     }
 
     bool rebuildPasses = false;
 
-    if(m_newShaderPreset)
+    // edited passes go into the running chain first, before any preset taking over from it
+    std::vector<PassReplacement> replacements;
+    std::unique_ptr<PresetBuild> readyBuild;
     {
-        DestroyShaders();
-        m_shaderPreset.swap(m_newShaderPreset);
-        m_newShaderPreset.reset();
-        RebuildShaders();
-        if(m_newParams.size())
+        std::unique_lock buildLock(m_buildMutex);
+        replacements.swap(m_replacements);
+        // keep presenting the current chain until the background build is ready
+        readyBuild.swap(m_readyBuild);
+    }
+
+    // the UI reads parameters through the running chain, it waits while that changes
+    std::unique_lock chainLock(m_chainMutex, std::defer_lock);
+    if(replacements.size() || readyBuild)
+        chainLock.lock();
+
+    for(auto& replacement : replacements)
+    {
+        if(ApplyReplacement(replacement) && !replacement.codeOnly)
         {
-            const auto& shaderParams = Params();
-            for(const auto& ip : m_newParams)
-            {
-                for(const auto& sp : shaderParams)
-                {
-                    if(std::get<0>(ip) == std::get<0>(sp) && std::get<1>(ip) == std::get<1>(sp)->name)
-                    {
-                        std::get<1>(sp)->currentValue = std::get<2>(ip);
-                        break;
-                    }
-                }
-            }
-            m_newParams.clear();
-            UpdateParams();
+            if(readyBuild && &readyBuild->preset->m_presetDef == replacement.preset)
+                readyBuild.reset();
+            PostMessage(m_outputWindow, WM_COMMAND, IDM_UPDATE_PARAMS, 0);
+            inputRescaled = true;
+            outputResized = true;
+            rebuildPasses = true;
         }
+    }
+
+    if(readyBuild)
+    {
+        SwapPreset(*readyBuild);
         PostMessage(m_outputWindow, WM_COMMAND, IDM_UPDATE_PARAMS, 0);
+
+        // keep the previous chain around for switching back, unless it's our own passthrough
+        if(m_presetCache && &readyBuild->preset->m_presetDef != &m_passthroughDef)
+        {
+            PresetCache::EstimateSize(*readyBuild);
+            m_presetCache->Store(std::move(readyBuild));
+        }
         inputRescaled = true;
         outputResized = true;
         rebuildPasses = true;
     }
+    if(chainLock.owns_lock())
+        chainLock.unlock();
 
     // size of preprocessed input, which is 'original' for the shader chain
     UINT originalWidth  = static_cast<UINT>(destWidth / m_inputScaleW);
@@ -526,32 +856,12 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
     }
 
     // create preprocessed output texture, scaled down size, inverted etc.
+    const auto inputFormat = D3D11Backend::FromDXGI(capturedTextureDesc.Format);
     if(m_preprocessedTexture == nullptr)
     {
-        D3D11_TEXTURE2D_DESC desc2 = {};
-        texture->GetDesc(&desc2);
-        desc2.Usage          = D3D11_USAGE_DEFAULT;
-        desc2.BindFlags      = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
-        desc2.CPUAccessFlags = 0;
-        desc2.MiscFlags      = 0;
-        desc2.Width          = originalWidth;
-        desc2.Height         = originalHeight;
-
-        hr = m_device->CreateTexture2D(&desc2, nullptr, m_preprocessedTexture.put());
-        assert(SUCCEEDED(hr));
-        outputResized = true;
-        rebuildPasses = true;
-
-        hr = m_device->CreateShaderResourceView(m_preprocessedTexture.get(), nullptr, m_originalView.put());
-        assert(SUCCEEDED(hr));
-    }
-
-    // create texture render target
-    if(m_preprocessedRenderTarget == nullptr)
-    {
-        hr = m_device->CreateRenderTargetView(m_preprocessedTexture.get(), NULL, m_preprocessedRenderTarget.put());
-        assert(SUCCEEDED(hr));
-        rebuildPasses = true;
+        m_preprocessedTexture = m_backend->CreateTexture({originalWidth, originalHeight, inputFormat, true});
+        outputResized         = true;
+        rebuildPasses         = true;
     }
 
     if(inputRescaled || outputResized)
@@ -559,6 +869,10 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
         m_textureSizes.clear();
         m_textureSizes.insert(std::make_pair("Original", float4 {(float)originalWidth, (float)originalHeight, 1.0f / originalWidth, 1.0f / originalHeight}));
         m_textureSizes.insert(std::make_pair("FinalViewport", float4 {(float)viewportWidth, (float)viewportHeight, 1.0f / viewportWidth, 1.0f / viewportHeight}));
+        m_originalWidth  = originalWidth;
+        m_originalHeight = originalHeight;
+        m_viewportWidth  = viewportWidth;
+        m_viewportHeight = viewportHeight;
 
         // preprocess takes original texture full size
         std::vector<std::array<UINT, 4>> passSizes;
@@ -566,6 +880,8 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
 
         UINT                             sourceWidth  = originalWidth;
         UINT                             sourceHeight = originalHeight;        
+        const float                      governorScale = m_governor.Scale();
+        bool                             scalable      = false;
         for(int p = 0; p < m_shaderPasses.size(); p++)
         {
             auto& shaderPass = m_shaderPasses[p];
@@ -575,14 +891,15 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
             {
                 UINT outputWidth  = sourceWidth;
                 UINT outputHeight = sourceHeight;
+                // governor lowers viewport-scaled passes, passes scaled from them follow
                 if(shaderPass.m_shader.m_scaleViewportX)
-                    outputWidth = static_cast<UINT>(viewportWidth * shaderPass.m_shader.m_scaleX);
+                    outputWidth = max(1U, static_cast<UINT>(viewportWidth * shaderPass.m_shader.m_scaleX * governorScale));
                 else if(shaderPass.m_shader.m_scaleAbsoluteX)
                     outputWidth = static_cast<UINT>(shaderPass.m_shader.m_scaleX);
                 else
                     outputWidth = static_cast<UINT>(sourceWidth * shaderPass.m_shader.m_scaleX);
                 if(shaderPass.m_shader.m_scaleViewportY)
-                    outputHeight = static_cast<UINT>(viewportHeight * shaderPass.m_shader.m_scaleY);
+                    outputHeight = max(1U, static_cast<UINT>(viewportHeight * shaderPass.m_shader.m_scaleY * governorScale));
                 else if(shaderPass.m_shader.m_scaleAbsoluteY)
                     outputHeight = static_cast<UINT>(shaderPass.m_shader.m_scaleY);
                 else
@@ -597,6 +914,12 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
             }
         }
 
+        for(int p = 0; p + 1 < m_shaderPasses.size(); p++)
+            scalable |= m_shaderPasses[p].m_shader.m_scaleViewportX || m_shaderPasses[p].m_shader.m_scaleViewportY;
+        m_governor.SetScalable(scalable);
+
+        ApplyTextureBudget(passSizes, originalWidth, originalHeight, inputFormat, viewportWidth, viewportHeight);
+
         // call resize once all textureSizes are determined
         for(int p = 0; p < m_shaderPasses.size(); p++)
         {
@@ -615,18 +938,11 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
             m_passResources.insert(pt);
         }
 
-        m_passResources.insert(std::make_pair("Original", m_originalView));
+        m_passResources.insert(std::make_pair("Original", m_preprocessedTexture));
 
-        m_preprocessPass.m_targetView = m_preprocessedRenderTarget.get();
+        m_preprocessPass.m_target = m_preprocessedTexture.get();
         if(m_shaderPasses.size() > 1)
         {
-            D3D11_TEXTURE2D_DESC desc2 = {};
-            texture->GetDesc(&desc2);
-            desc2.Usage          = D3D11_USAGE_DEFAULT;
-            desc2.BindFlags      = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
-            desc2.CPUAccessFlags = 0;
-            desc2.MiscFlags      = 0;
-
             for(const auto& pass : m_shaderPasses)
             {
                 m_requiresFeedback |= pass.RequiresFeedback();
@@ -637,31 +953,20 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
             {
                 const auto& pass = m_shaderPasses[p - 1];
 
+                // use shader output size
+                TextureDesc passDesc;
+                passDesc.width        = pass.m_destWidth;
+                passDesc.height       = pass.m_destHeight;
+                passDesc.renderTarget = true;
                 if(pass.m_shader.m_formatFloat)
-                    desc2.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+                    passDesc.format = TextureFormat::RGBA16F;
                 else if(pass.m_shader.m_formatSRGB)
-                    desc2.Format = DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+                    passDesc.format = TextureFormat::BGRA8_SRGB;
                 else
-                    desc2.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-
-                // use shader output size
-                desc2.Width  = pass.m_destWidth;
-                desc2.Height = pass.m_destHeight;
-                desc2.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
-
-                winrt::com_ptr<ID3D11Texture2D> passTexture;
-                hr = m_device->CreateTexture2D(&desc2, nullptr, passTexture.put());
-                assert(SUCCEEDED(hr));
-                m_passTextures.push_back(passTexture);
-
-                winrt::com_ptr<ID3D11RenderTargetView> passTarget;
-                hr = m_device->CreateRenderTargetView(passTexture.get(), nullptr, passTarget.put());
-                assert(SUCCEEDED(hr));
-                m_passTargets.push_back(passTarget);
+                    passDesc.format = TextureFormat::BGRA8;
 
-                winrt::com_ptr<ID3D11ShaderResourceView> passResource;
-                hr = m_device->CreateShaderResourceView(passTexture.get(), nullptr, passResource.put());
-                assert(SUCCEEDED(hr));
+                auto passResource = m_backend->CreateTexture(passDesc);
+                m_passTextures.push_back(passResource);
                 m_passResources.insert(std::make_pair(std::string("PassOutput") + std::to_string(p - 1), passResource));
                 if(!pass.m_shader.m_alias.empty())
                 {
@@ -671,15 +976,10 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
                 // create feedback textures if needed
                 if(m_requiresFeedback)
                 {
-                    desc2.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-
-                    winrt::com_ptr<ID3D11Texture2D> feedbackTexture;
-                    hr = m_device->CreateTexture2D(&desc2, nullptr, feedbackTexture.put());
-                    assert(SUCCEEDED(hr));
-                    m_passTextures.push_back(feedbackTexture);
-                    winrt::com_ptr<ID3D11ShaderResourceView> feedbackResource;
-                    hr = m_device->CreateShaderResourceView(feedbackTexture.get(), nullptr, feedbackResource.put());
-                    assert(SUCCEEDED(hr));
+                    passDesc.renderTarget = false;
+
+                    auto feedbackResource = m_backend->CreateTexture(passDesc);
+                    m_passTextures.push_back(feedbackResource);
                     m_passResources.insert(std::make_pair(std::string("PassFeedback") + std::to_string(p - 1), feedbackResource));
                     if(!pass.m_shader.m_alias.empty())
                     {
@@ -687,8 +987,8 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
                     }
                 }
 
-                m_shaderPasses[p - 1].m_targetView = passTarget.get();
-                m_shaderPasses[p].m_sourceView     = passResource.get();
+                m_shaderPasses[p - 1].m_target = passResource.get();
+                m_shaderPasses[p].m_source     = passResource.get();
             }
         }
         else
@@ -698,29 +998,15 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
 
         if(m_requiresHistory)
         {
-            D3D11_TEXTURE2D_DESC desc2 = {};
-            texture->GetDesc(&desc2);
-            desc2.Usage          = D3D11_USAGE_DEFAULT;
-            desc2.BindFlags      = D3D11_BIND_SHADER_RESOURCE;
-            desc2.CPUAccessFlags = 0;
-            desc2.MiscFlags      = 0;
-            desc2.Width          = originalWidth;
-            desc2.Height         = originalHeight;
-
             for(int h = 0; h < m_requiresHistory; h++)
             {
-                winrt::com_ptr<ID3D11Texture2D> historyTexture;
-                hr = m_device->CreateTexture2D(&desc2, nullptr, historyTexture.put());
-                assert(SUCCEEDED(hr));
-                m_passTextures.push_back(historyTexture);
-                winrt::com_ptr<ID3D11ShaderResourceView> historyResource;
-                hr = m_device->CreateShaderResourceView(historyTexture.get(), nullptr, historyResource.put());
-                assert(SUCCEEDED(hr));
+                auto historyResource = m_backend->CreateTexture({originalWidth, originalHeight, inputFormat, false});
+                m_passTextures.push_back(historyResource);
                 m_passResources.insert(std::make_pair(std::string("OriginalHistory") + std::to_string(h + 1), historyResource));
             }
         }
 
-        m_shaderPasses[m_shaderPasses.size() - 1].m_targetView = m_displayRenderTarget.get();
+        m_shaderPasses[m_shaderPasses.size() - 1].m_target = m_displayTarget.get();
 
         if(m_requiresFeedback)
         {
@@ -728,22 +1014,8 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
             int                  p        = m_shaderPasses.size() - 1;
             const auto&          lastPass = m_shaderPasses[p];
 
-            D3D11_TEXTURE2D_DESC desc2    = {};
-            texture->GetDesc(&desc2);
-            desc2.Usage          = D3D11_USAGE_DEFAULT;
-            desc2.BindFlags      = D3D11_BIND_SHADER_RESOURCE;
-            desc2.CPUAccessFlags = 0;
-            desc2.MiscFlags      = 0;
-            desc2.Width          = lastPass.m_destWidth;
-            desc2.Height         = lastPass.m_destHeight;
-
-            winrt::com_ptr<ID3D11Texture2D> feedbackTexture;
-            hr = m_device->CreateTexture2D(&desc2, nullptr, feedbackTexture.put());
-            assert(SUCCEEDED(hr));
-            m_passTextures.push_back(feedbackTexture);
-            winrt::com_ptr<ID3D11ShaderResourceView> feedbackResource;
-            hr = m_device->CreateShaderResourceView(feedbackTexture.get(), nullptr, feedbackResource.put());
-            assert(SUCCEEDED(hr));
+            auto feedbackResource = m_backend->CreateTexture({static_cast<uint32_t>(lastPass.m_destWidth), static_cast<uint32_t>(lastPass.m_destHeight), inputFormat, false});
+            m_passTextures.push_back(feedbackResource);
             m_passResources.insert(std::make_pair(std::string("PassFeedback") + std::to_string(p), feedbackResource));
             if(!lastPass.m_shader.m_alias.empty())
             {
@@ -752,6 +1024,11 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
         }
     }
 
+    if(rebuildPasses || outputResized)
+    {
+        UpdateTextureMemory();
+    }
+
     if(outputMoved || outputResized || (m_lastPos.x != topLeft.x || m_lastPos.y != topLeft.y) || m_lockedAreaUpdated)
     {
         // preprocess captured frame to a texture: crop (via scale & translation), reduce resolution, and whatnot (invert y?)
@@ -834,16 +1111,23 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
         m_lastPos.y = topLeft.y;
     }
 
+    // governor reads frame times from the profiler
+    const bool profiling = m_profiling || m_governor.Enabled();
+    if(profiling)
+    {
+        UpdateProfilerSections();
+        m_profiler.BeginFrame();
+        m_profiler.Section(m_preprocessSection);
+    }
+
     if(m_captureWindow && !m_clone)
     {
         // clear any blanks around captured window
-        m_context->ClearRenderTargetView(m_preprocessedRenderTarget.get(), background_colour);
+        m_backend->Clear(*m_preprocessedTexture, background_colour);
     }
 
-    winrt::com_ptr<ID3D11ShaderResourceView> textureView;
-    hr = m_device->CreateShaderResourceView(texture.get(), nullptr, textureView.put());
-    assert(SUCCEEDED(hr));
-    m_preprocessPass.Render(textureView.get(), m_passResources, m_frameSkip + 1, 0, 0);
+    auto inputTexture = m_backend->Wrap(texture, false);
+    m_preprocessPass.Render(inputTexture.get(), m_passResources, frameSkip + 1, 0, 0);
 
     int p = 0;
     for(auto& shaderPass : m_shaderPasses)
@@ -851,83 +1135,68 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
         auto passBoxX = p == m_shaderPasses.size() - 1 ? m_boxX : 0;
         auto passBoxY = p == m_shaderPasses.size() - 1 ? m_boxY : 0;
 
+        if(profiling)
+            m_profiler.Section(m_passSections[p]);
         if(p == 0)
         {
-            shaderPass.Render(m_originalView.get(), m_passResources, m_frameSkip + 1, passBoxX, passBoxY);
+            shaderPass.Render(m_preprocessedTexture.get(), m_passResources, frameSkip + 1, passBoxX, passBoxY);
         }
         else
         {
-            shaderPass.Render(m_passResources, m_frameSkip + 1, passBoxX, passBoxY);
+            shaderPass.Render(m_passResources, frameSkip + 1, passBoxX, passBoxY);
         }
         p++;
     }
 
     if(m_requiresFeedback)
     {
+        if(profiling)
+            m_profiler.Section(m_feedbackSection);
+
         // copy output to feedback
         for(size_t q = 0; q < m_shaderPasses.size() - 1; q++)
         {
-            auto                           passOutput   = m_passResources.find(std::string("PassOutput") + std::to_string(q));
-            auto                           passFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(q));
-            winrt::com_ptr<ID3D11Resource> outputResource;
-            winrt::com_ptr<ID3D11Resource> feedbackResource;
-            passOutput->second->GetResource(outputResource.put());
-            passFeedback->second->GetResource(feedbackResource.put());
-            m_context->CopyResource(feedbackResource.get(), outputResource.get());
+            auto passOutput   = m_passResources.find(std::string("PassOutput") + std::to_string(q));
+            auto passFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(q));
+            m_backend->Copy(*passFeedback->second, *passOutput->second);
         }
 
         // copy display texture as last pass feedback
-        auto displayTexture = m_displayTexture;
-        if(displayTexture)
+        auto displayTarget = m_displayTarget;
+        if(displayTarget)
         {
-            int p = m_shaderPasses.size() - 1;
-            const auto& lastPass = m_shaderPasses[p];
-            auto lastPassFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(p));
-            winrt::com_ptr<ID3D11Resource> lastPassFeedbackResource;
-            lastPassFeedback->second->GetResource(lastPassFeedbackResource.put());
-            
+            int         p                = m_shaderPasses.size() - 1;
+            const auto& lastPass         = m_shaderPasses[p];
+            auto        lastPassFeedback = m_passResources.find(std::string("PassFeedback") + std::to_string(p));
+
             if(m_boxX != 0 || m_boxY != 0)
             {
                 // Validate box dimensions
-                D3D11_TEXTURE2D_DESC srcDesc;
-                displayTexture->GetDesc(&srcDesc);
-                
-                D3D11_BOX srcBox;
-                srcBox.left = static_cast<UINT>(max(0, m_boxX));
-                srcBox.right = min(srcDesc.Width, static_cast<UINT>(m_boxX + lastPass.m_destWidth));
-                srcBox.top = static_cast<UINT>(max(0, m_boxY)); 
-                srcBox.bottom = min(srcDesc.Height, static_cast<UINT>(m_boxY + lastPass.m_destHeight));
-                srcBox.front = 0;
-                srcBox.back = 1;
+                const auto left   = static_cast<UINT>(max(0, m_boxX));
+                const auto right  = min(displayTarget->width, static_cast<UINT>(m_boxX + lastPass.m_destWidth));
+                const auto top    = static_cast<UINT>(max(0, m_boxY));
+                const auto bottom = min(displayTarget->height, static_cast<UINT>(m_boxY + lastPass.m_destHeight));
 
                 // Only copy if we have valid coordinates and matching formats
-                if(srcBox.right > srcBox.left && srcBox.bottom > srcBox.top)
+                if(right > left && bottom > top && displayTarget->format == lastPassFeedback->second->format)
                 {
-                    D3D11_TEXTURE2D_DESC destDesc;
-                    winrt::com_ptr<ID3D11Texture2D> feedbackTexture;
-                    lastPassFeedbackResource.as(feedbackTexture);
-                    feedbackTexture->GetDesc(&destDesc);
-                    
-                    if(srcDesc.Format == destDesc.Format)
-                    {
-                        m_context->CopySubresourceRegion(lastPassFeedbackResource.get(), 0, 0, 0, 0, displayTexture.get(), 0, &srcBox);
-                    }
+                    m_backend->CopyRegion(*lastPassFeedback->second, *displayTarget, left, top, right, bottom);
                 }
             }
             else
             {
-                m_context->CopyResource(lastPassFeedbackResource.get(), displayTexture.get());
+                m_backend->Copy(*lastPassFeedback->second, *displayTarget);
             }
         }
     }
 
     if(m_requiresHistory)
     {
+        if(profiling)
+            m_profiler.Section(m_historySection);
+
         // lookup oldest History for reuse
-        const auto&                    lastHistory = m_passResources.find(std::string("OriginalHistory" + std::to_string(m_requiresHistory)));
-        auto                           lastHistoryView = lastHistory->second;
-        winrt::com_ptr<ID3D11Resource> lastHistoryResource;
-        lastHistoryView->GetResource(lastHistoryResource.put());
+        auto lastHistory = m_passResources.find(std::string("OriginalHistory" + std::to_string(m_requiresHistory)))->second;
 
         for(int h = m_requiresHistory; h > 1; h--)
         {
@@ -936,29 +1205,170 @@ void ShaderGlass::Process(winrt::com_ptr<ID3D11Texture2D> texture)
         }
 
         // copy current Original to History1 for next pass
-        const auto&                    original = m_passResources.find("Original");
-        winrt::com_ptr<ID3D11Resource> originalResource;
-        original->second->GetResource(originalResource.put());
-
-        m_context->CopyResource(lastHistoryResource.get(), originalResource.get());
+        const auto& original = m_passResources.find("Original");
+        m_backend->Copy(*lastHistory, *original->second);
         if(m_requiresHistory > 1)
         {
-            m_passResources["OriginalHistory1"] = lastHistoryView;
+            m_passResources["OriginalHistory1"] = lastHistory;
         }
     }
 
+    if(profiling)
+        m_profiler.EndFrame();
+
+    const auto renderEnd = FrameMetrics::Now();
     PresentFrame();
+    m_metrics.Rendered(sequence, captured, renderStart, renderEnd, FrameMetrics::Now());
+
+    if(m_governor.Enabled())
+    {
+        float      frameMs;
+        const auto recorded = m_profiler.Recorded(frameMs);
+        if(recorded != m_governedFrames)
+        {
+            m_governedFrames = recorded;
+            if(m_governor.Update(frameMs))
+            {
+                if(m_governor.Scale() != m_governorScale)
+                    m_inputRescaled = true;
+                m_governorScale = m_governor.Scale();
+                m_governorSkip  = m_governor.FrameSkip();
+#ifdef _DEBUG
+                char message[128];
+                snprintf(message, 128, "Governor at %.2f ms, scale %.2f, frame skip +%d\n", frameMs, m_governorScale, m_governorSkip);
+                OutputDebugStringA(message);
+#endif
+            }
+        }
+    }
+
+    if(m_switchPending)
+    {
+        m_switchPending = false;
+        m_switchLatency = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_switchStart).count();
+#ifdef _DEBUG
+        char switchLatency[64];
+        snprintf(switchLatency, 64, "Preset switch latency %.1f ms\n", m_switchLatency);
+        OutputDebugStringA(switchLatency);
+#endif
+    }
+}
+
+void ShaderGlass::ApplyTextureBudget(std::vector<std::array<UINT, 4>>& passSizes, UINT originalWidth, UINT originalHeight, TextureFormat inputFormat, UINT viewportWidth, UINT viewportHeight)
+{
+    bool         reduced = false;
+    const size_t budget  = m_textureBudget;
+    if(budget && m_shaderPasses.size() > 1)
+    {
+        // estimate what the targets will take, same rules as creating them below
+        bool requiresFeedback = false;
+        int  requiresHistory  = 0;
+        for(const auto& pass : m_shaderPasses)
+        {
+            requiresFeedback |= pass.RequiresFeedback();
+            requiresHistory = max(requiresHistory, pass.RequiresHistory());
+        }
+
+        size_t fixed = TextureMemory::Bytes(originalWidth, originalHeight, inputFormat) * (1 + requiresHistory);
+        fixed += TextureMemory::Bytes(viewportWidth, viewportHeight, TextureFormat::BGRA8) * 2; // swapchain buffers
+        if(requiresFeedback)
+            fixed += TextureMemory::Bytes(viewportWidth, viewportHeight, inputFormat); // last pass feedback, created like the input
+        for(const auto& pt : m_presetTextures)
+            fixed += TextureMemory::Bytes(*pt.second);
+
+        size_t scalable = 0;
+        for(size_t p = 0; p < m_shaderPasses.size() - 1; p++)
+        {
+            const auto& shader = m_shaderPasses[p].m_shader;
+            const auto  format = shader.m_formatFloat ? TextureFormat::RGBA16F : TextureFormat::BGRA8;
+            const auto  bytes  = TextureMemory::Bytes(passSizes[p][2], passSizes[p][3], format) * (requiresFeedback ? 2 : 1);
+            if(shader.m_scaleAbsoluteX || shader.m_scaleAbsoluteY)
+                fixed += bytes;
+            else
+                scalable += bytes;
+        }
+
+        if(fixed + scalable > budget && scalable)
+        {
+            // shrink intermediate passes in both dimensions, not below a quarter
+            const float factor = max(0.25f, sqrtf(budget > fixed ? static_cast<float>(budget - fixed) / scalable : 0.0f));
+            for(size_t p = 0; p < m_shaderPasses.size() - 1; p++)
+            {
+                const auto& shader = m_shaderPasses[p].m_shader;
+                if(!shader.m_scaleAbsoluteX && !shader.m_scaleAbsoluteY)
+                {
+                    passSizes[p][2] = max(1U, static_cast<UINT>(passSizes[p][2] * factor));
+                    passSizes[p][3] = max(1U, static_cast<UINT>(passSizes[p][3] * factor));
+                }
+                passSizes[p + 1][0] = passSizes[p][2];
+                passSizes[p + 1][1] = passSizes[p][3];
+                if(!shader.m_alias.empty())
+                {
+                    m_textureSizes[shader.m_alias] = float4 {(float)passSizes[p][2], (float)passSizes[p][3], 1.0f / passSizes[p][2], 1.0f / passSizes[p][3]};
+                }
+            }
+            reduced = true;
+
+#ifdef _DEBUG
+            char message[128];
+            snprintf(message, 128, "Texture budget %.1f MB exceeded, intermediate passes scaled by %.2f\n", budget / (1024.0f * 1024.0f), factor);
+            OutputDebugStringA(message);
+#endif
+        }
+    }
+
+    std::unique_lock lock(m_textureMemoryMutex);
+    m_textureReduced = reduced;
+}
+
+void ShaderGlass::UpdateTextureMemory()
+{
+    TextureMemory memory;
+    for(const auto& resource : m_passResources)
+    {
+        // aliases point to the same textures, only count canonical names
+        const auto& name = resource.first;
+        if(name.starts_with("PassOutput"))
+            memory.Add(TextureCategory::PassOutput, *resource.second);
+        else if(name.starts_with("PassFeedback"))
+            memory.Add(TextureCategory::Feedback, *resource.second);
+        else if(name.starts_with("OriginalHistory"))
+            memory.Add(TextureCategory::History, *resource.second);
+    }
+    if(m_preprocessedTexture)
+        memory.Add(TextureCategory::Original, *m_preprocessedTexture);
+    for(const auto& pt : m_presetTextures)
+    {
+        if(pt.second)
+            memory.Add(TextureCategory::Preset, *pt.second);
+    }
+
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc;
+    if(m_swapChain && SUCCEEDED(m_swapChain->GetDesc1(&swapChainDesc)))
+        memory.Add(TextureCategory::Swapchain, TextureMemory::Bytes(swapChainDesc.Width, swapChainDesc.Height, TextureFormat::BGRA8) * swapChainDesc.BufferCount);
+
+#ifdef _DEBUG
+    OutputDebugStringA(("Texture memory: " + memory.Describe() + "\n").c_str());
+#endif
+
+    std::unique_lock lock(m_textureMemoryMutex);
+    m_textureMemory = memory;
+}
+
+void ShaderGlass::UpdateProfilerSections()
+{
+    if(m_profiledPreset == m_shaderPreset.get() && m_passSections.size() == m_shaderPasses.size())
+        return;
 
-    m_renderCounter++;
-    auto ticks = GetTickCount64();
-    if(ticks - m_prevTicks > 1000)
+    // averages and trace start over with each preset
+    m_profiler.Clear();
+    m_passSections.clear();
+    for(size_t p = 0; p < m_shaderPasses.size(); p++)
     {
-        auto deltaTicks     = ticks - m_prevTicks;
-        auto deltaFrames    = m_renderCounter - m_prevRenderCounter;
-        m_fps               = deltaFrames * 1000.0f / deltaTicks;
-        m_prevRenderCounter = m_renderCounter;
-        m_prevTicks         = ticks;
+        const auto name = m_shaderPasses[p].m_shader.m_shaderDef.Name;
+        m_passSections.push_back(m_profiler.Register(std::to_string(p) + " " + (name ? name : "")));
     }
+    m_profiledPreset = m_shaderPreset.get();
 }
 
 winrt::com_ptr<ID3D11Texture2D> ShaderGlass::GrabOutput()
@@ -988,7 +1398,7 @@ winrt::com_ptr<ID3D11Texture2D> ShaderGlass::GrabOutput()
             {
                 desc2.Width = width;
                 desc2.Height = height;
-                hr = m_device->CreateTexture2D(&desc2, nullptr, outputTexture.put());
+                HRESULT hr = m_device->CreateTexture2D(&desc2, nullptr, outputTexture.put());
                 assert(SUCCEEDED(hr));
 
                 // Validate copy region against source texture bounds
@@ -1010,7 +1420,7 @@ winrt::com_ptr<ID3D11Texture2D> ShaderGlass::GrabOutput()
         else
         {
             // Full texture copy
-            hr = m_device->CreateTexture2D(&desc2, nullptr, outputTexture.put());
+            HRESULT hr = m_device->CreateTexture2D(&desc2, nullptr, outputTexture.put());
             assert(SUCCEEDED(hr));
             m_context->CopyResource(outputTexture.get(), displayTexture.get());
         }
@@ -2,25 +2,54 @@
 
 #include "Preset.h"
 #include "ShaderPass.h"
+#include "PresetCache.h"
+#include "D3D11Backend.h"
+#include "PassProfiler.h"
+#include "FrameMetrics.h"
+#include "TextureMemory.h"
+#include "ResolutionGovernor.h"
 #include "Shaders\PreprocessShaderDef.h"
 #include "Shaders\PassthroughShaderDef.h"
 #include "Shaders\PassthroughPresetDef.h"
 #include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
 
 class ShaderGlass
 {
 public:
     ShaderGlass();
-    void Initialize(HWND outputWindow, HWND captureWindow, HMONITOR captureMonitor, bool clone, bool image, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context);
-    void Process(winrt::com_ptr<ID3D11Texture2D> texture);
+    void Initialize(HWND outputWindow, HWND captureWindow, HMONITOR captureMonitor, bool clone, bool image, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context, PresetCache* presetCache);
+    // sequence counts captured frames (0 if not captured), captured is its QPC timestamp
+    void Process(winrt::com_ptr<ID3D11Texture2D> texture, uint64_t sequence = 0, int64_t captured = 0);
     void SetInputScale(float w, float h);
     void SetOutputScale(float w, float h);
     void SetOutputFlip(bool h, bool v);
-    void SetShaderPreset(PresetDef* p, const std::vector<std::tuple<int, std::string, double>>& params);
+    void SetShaderPreset(PresetDef* p, const std::vector<std::tuple<int, std::string, double>>& params, std::chrono::steady_clock::time_point requested = std::chrono::steady_clock::now());
+    // swaps recompiled passes into the running chain of p, leaving the other passes and textures alone
+    void ReplacePasses(PresetDef* p, std::vector<std::pair<size_t, ShaderDef>> passes, std::chrono::steady_clock::time_point detected);
+    // swaps only the compiled code of passes of p, for variants of the same source (nullptr for the pass's own code);
+    // parameters and targets stay as they are
+    void ReplacePrograms(PresetDef* p, std::vector<std::pair<size_t, std::shared_ptr<const CompiledShader>>> programs);
+    bool IsRunning(const PresetDef* p);
+    // variant a pass of p runs while p is running, nullptr for its own code
+    std::shared_ptr<const CompiledShader> PassVariant(const PresetDef* p, size_t pass);
     void SetFrameSkip(int s);
     void SetLockedArea(RECT area);
     void SetFreeScale(bool freeScale);
-    float FPS() { return m_fps; }
+    float FPS() { return m_metrics.Stats().fps; }
+    FrameStats Metrics() { return m_metrics.Stats(); }
+    void       SetMetricsLog(const std::wstring& fileName) { m_metrics.SetLog(fileName); }
+    void       SetTextureBudget(size_t bytes);
+    TextureMemory TextureUsage(bool& reduced);
+    bool          ChainSize(UINT& originalWidth, UINT& originalHeight, UINT& viewportWidth, UINT& viewportHeight);
+    void          SetGovernor(const GovernorSettings& settings);
+    float         GovernorScale(int& frameSkip); // current resolution of viewport-scaled passes and extra frame skip
+    float SwitchLatency() { return m_switchLatency; }
+    void  SetProfiling(bool profiling) { m_profiling = profiling; }
+    std::vector<SectionTiming>                 PassTimings() { return m_profiling ? m_profiler.Averages() : std::vector<SectionTiming>(); }
+    bool                                       ExportTrace(const std::wstring& fileName) { return m_profiler.ExportChromeTrace(fileName); }
     winrt::com_ptr<ID3D11Texture2D>            GrabOutput();
     std::vector<std::tuple<int, ShaderParam*>> Params();
     void                                       UpdateParams();
@@ -29,32 +58,50 @@ public:
     ~ShaderGlass();
 
 private:
+    struct PassReplacement
+    {
+        PresetDef*                                                            preset;
+        std::vector<std::pair<size_t, ShaderDef>>                             passes;
+        std::chrono::steady_clock::time_point                                 detected;
+        bool                                                                  codeOnly {false};
+        std::vector<std::pair<size_t, std::shared_ptr<const CompiledShader>>> programs; // codeOnly, instead of passes
+    };
+
     bool TryResizeSwapChain(const RECT& clientRect, bool force);
     void DestroyShaders();
     void DestroyPasses();
     void DestroyTargets();
     void RebuildShaders();
+    void UpdatePresetResources();
+    // callers hold m_chainMutex
+    std::vector<std::tuple<int, ShaderParam*>> ChainParams();
+    void                                       UpdateChainParams();
+    void                                       ResetChainParams();
+    void BuildPreset(PresetDef& presetDef, PresetBuild& build);
+    void SwapPreset(PresetBuild& build);
+    bool ApplyReplacement(PassReplacement& replacement);
+    void BuildThreadFunc();
     void PresentFrame();
+    void UpdateProfilerSections();
+    void ApplyTextureBudget(std::vector<std::array<UINT, 4>>& passSizes, UINT originalWidth, UINT originalHeight, TextureFormat inputFormat, UINT viewportWidth, UINT viewportHeight);
+    void UpdateTextureMemory();
 
     POINT                                    m_lastSize;
     POINT                                    m_lastPos;
     POINT                                    m_lastCaptureWindowPos;
     winrt::com_ptr<ID3D11DeviceContext>      m_context {nullptr};
     winrt::com_ptr<ID3D11Device>             m_device {nullptr};
-    winrt::com_ptr<ID3D11ShaderResourceView> m_originalView {nullptr};
     winrt::com_ptr<IDXGISwapChain1>          m_swapChain {nullptr};
-    winrt::com_ptr<ID3D11RasterizerState>    m_rasterizerState {nullptr};
     winrt::com_ptr<ID3D11Texture2D>          m_displayTexture {nullptr};
-    winrt::com_ptr<ID3D11RenderTargetView>   m_displayRenderTarget {nullptr};
-    winrt::com_ptr<ID3D11Texture2D>          m_preprocessedTexture {nullptr};
-    winrt::com_ptr<ID3D11RenderTargetView>   m_preprocessedRenderTarget {nullptr};
+    std::shared_ptr<D3D11Backend>            m_backend {nullptr};
+    std::shared_ptr<RenderTexture>           m_displayTarget {nullptr};
+    std::shared_ptr<RenderTexture>           m_preprocessedTexture {nullptr};
 
-    std::vector<winrt::com_ptr<ID3D11Texture2D>>                    m_passTextures;
-    std::vector<winrt::com_ptr<ID3D11RenderTargetView>>             m_passTargets;
-    std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>> m_passResources;
-    std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>> m_presetTextures;
-    std::map<std::string, float4>                                   m_textureSizes;
-    std::vector<ShaderPass>                                         m_shaderPasses;
+    std::vector<std::shared_ptr<RenderTexture>>           m_passTextures;
+    std::map<std::string, std::shared_ptr<RenderTexture>> m_passResources;
+    std::map<std::string, std::shared_ptr<RenderTexture>> m_presetTextures;
+    std::map<std::string, float4>                         m_textureSizes;
+    std::vector<ShaderPass>                               m_shaderPasses;
 
     POINT      m_monitorOffset {0, 0};
     HWND       m_outputWindow {0};
@@ -62,10 +109,6 @@ private:
     bool       m_clone {false};
     bool       m_image {false};
     int        m_frameCounter {0};
-    int        m_renderCounter {0};
-    int        m_prevRenderCounter {0};
-    ULONGLONG  m_prevTicks {0};
-    float      m_fps {0};
     bool       m_requiresFeedback {false};
     int        m_requiresHistory {0};
     std::mutex m_mutex {};
@@ -79,9 +122,40 @@ private:
     Shader                                            m_preprocessShader;
     ShaderPass                                        m_preprocessPass;
     std::unique_ptr<Preset>                           m_shaderPreset {nullptr};
-    std::unique_ptr<Preset>                           m_newShaderPreset {nullptr};
-    std::vector<std::tuple<int, std::string, double>> m_newParams;
+    std::mutex                                        m_chainMutex {}; // swapping m_shaderPreset and its passes against the UI reading parameters
+    PresetCache*                                      m_presetCache {nullptr};
+
+    std::thread                                       m_buildThread;
+    std::mutex                                        m_buildMutex {};
+    std::condition_variable                           m_buildCondition;
+    bool                                              m_buildStop {false};
+    PresetDef*                                        m_requestedPreset {nullptr};
+    std::vector<std::tuple<int, std::string, double>> m_requestedParams;
+    std::chrono::steady_clock::time_point             m_requestedTime {};
+    std::unique_ptr<PresetBuild>                      m_readyBuild {nullptr};
+    std::chrono::steady_clock::time_point             m_switchStart {};
+    bool                                              m_switchPending {false};
+    float                                             m_switchLatency {0};
+    std::vector<PassReplacement>                      m_replacements;
+    std::vector<ShaderDef>                            m_retiredDefs; // the params window may still point into these, so they stay until the chain goes
+
+    TextureMemory         m_textureMemory;
+    std::mutex            m_textureMemoryMutex {};
+    bool                  m_textureReduced {false};
+    FrameMetrics          m_metrics;
+    PassProfiler          m_profiler;
+    std::vector<uint32_t> m_passSections;
+    const Preset*         m_profiledPreset {nullptr};
+    uint32_t              m_preprocessSection {0};
+    uint32_t              m_feedbackSection {0};
+    uint32_t              m_historySection {0};
+    ResolutionGovernor    m_governor;
+    GovernorSettings      m_governorSettings {};
+    std::mutex            m_governorMutex {};
+    uint64_t              m_governedFrames {0};
 
+    volatile bool   m_profiling {false};
+    volatile size_t m_textureBudget {0};
     volatile int   m_frameSkip {0};
     volatile bool  m_running {false};
     volatile float m_inputScaleW {3.0f};
@@ -95,4 +169,11 @@ private:
     volatile RECT  m_lockedArea {0, 0, 0, 0};
     volatile bool  m_lockedAreaUpdated {false};
     volatile bool  m_freeScale {false};
+    volatile UINT  m_originalWidth {0};
+    volatile UINT  m_originalHeight {0};
+    volatile UINT  m_viewportWidth {0};
+    volatile UINT  m_viewportHeight {0};
+    volatile bool  m_governorUpdated {false};
+    volatile float m_governorScale {1.0f};
+    volatile int   m_governorSkip {0};
 };
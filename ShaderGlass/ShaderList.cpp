@@ -6,4 +6,4 @@
 
 #include "shaders\RetroArch.h"
 
-std::vector<PresetDef*> RetroArchPresetList = RetroArch::PresetList;
+std::vector<PresetDef*> RetroArchPresetList = RetroArch::BuildPresetList();
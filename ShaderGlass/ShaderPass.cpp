@@ -3,16 +3,19 @@
 #include "ShaderPass.h"
 #include "Helpers.h"
 
-static HRESULT hr;
-
 ShaderPass::ShaderPass(Shader& shader, Preset& preset, bool preprocess) : m_shader {shader}, m_preset {preset}, m_preprocess {preprocess} { }
 
-ShaderPass::ShaderPass(Shader& shader, Preset& preset, winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context) :
-    ShaderPass(shader, preset, false)
+ShaderPass::ShaderPass(Shader& shader, Preset& preset, std::shared_ptr<RenderBackend> backend) : ShaderPass(shader, preset, false)
 {
-    Initialize(device, context);
+    Initialize(backend);
 }
 
+ShaderPass::ShaderPass(Shader& shader, Preset& preset, ShaderPass&& initialized) :
+    m_shader {shader}, m_preset {preset}, m_modelViewProj {initialized.m_modelViewProj}, m_backend {std::move(initialized.m_backend)},
+    m_vertexBuffer {std::move(initialized.m_vertexBuffer)}, m_constantBuffer {std::move(initialized.m_constantBuffer)},
+    m_pushBuffer {std::move(initialized.m_pushBuffer)}, m_samplers {std::move(initialized.m_samplers)}, m_preprocess {initialized.m_preprocess}
+{ }
+
 // clang-format off
 static float sVertexBuffer[] = 
 {
@@ -29,122 +32,46 @@ static float sVertexBuffer[] =
 };
 // clang-format on
 
-void ShaderPass::Initialize(winrt::com_ptr<ID3D11Device> device, winrt::com_ptr<ID3D11DeviceContext> context)
+void ShaderPass::Initialize(std::shared_ptr<RenderBackend> backend)
 {
-    m_device  = device;
-    m_context = context;
-
-    D3D11_INPUT_ELEMENT_DESC inputElementDesc[] = {
-        {"TEXCOORD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
-        {"TEXCOORD", 1, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0}};
-
-    hr = m_device->CreateInputLayout(inputElementDesc,
-                                     ARRAYSIZE(inputElementDesc),
-                                     m_shader.m_shaderDef.VertexByteCode,
-                                     m_shader.m_shaderDef.VertexLength,
-                                     m_inputLayout.put());
-    assert(SUCCEEDED(hr));
-    {
-        D3D11_BUFFER_DESC vertex_buff_descr = {};
-        vertex_buff_descr.ByteWidth         = sizeof(sVertexBuffer);
-        vertex_buff_descr.Usage             = D3D11_USAGE_DEFAULT;
-        vertex_buff_descr.BindFlags         = D3D11_BIND_VERTEX_BUFFER;
-        D3D11_SUBRESOURCE_DATA sr_data      = {0};
-        sr_data.pSysMem                     = sVertexBuffer;
-        hr                                  = m_device->CreateBuffer(&vertex_buff_descr, &sr_data, m_vertexBuffer.put());
-        assert(SUCCEEDED(hr));
-    }
+    m_backend      = backend;
+    m_vertexBuffer = m_backend->CreateVertexBuffer(sVertexBuffer, sizeof(sVertexBuffer));
 
     for(const auto& texture : m_shader.m_shaderDef.Samplers)
     {
-        winrt::com_ptr<ID3D11SamplerState> samplerState;
-        D3D11_SAMPLER_DESC                 samplerDesc = {};
-
-        samplerDesc.Filter         = D3D11_FILTER_MIN_MAG_MIP_POINT;
-        samplerDesc.AddressU       = D3D11_TEXTURE_ADDRESS_BORDER;
-        samplerDesc.AddressV       = D3D11_TEXTURE_ADDRESS_BORDER;
-        samplerDesc.AddressW       = D3D11_TEXTURE_ADDRESS_BORDER;
-        samplerDesc.BorderColor[0] = 0.0f;
-        samplerDesc.BorderColor[1] = 0.0f;
-        samplerDesc.BorderColor[2] = 0.0f;
-        samplerDesc.BorderColor[3] = 0.0f;
-        samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+        SamplerDesc samplerDesc;
 
         // is it a static texture?
-        //if(m_preset)
+        auto ti = m_preset.m_textures.find(texture.name);
+        if(ti != m_preset.m_textures.end())
         {
-            auto ti = m_preset.m_textures.find(texture.name);
-            if(ti != m_preset.m_textures.end())
-            {
-                if(ti->second.m_linear)
-                    samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
-                if(ti->second.m_repeat)
-                {
-                    samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
-                    samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
-                    samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
-                }
-                if(ti->second.m_clamp)
-                {
-                    samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
-                    samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
-                    samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
-                }
-                if(ti->second.m_mirror)
-                {
-                    samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_MIRROR;
-                    samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_MIRROR;
-                    samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_MIRROR;
-                }
-            }
-            else
-            {
-                if(m_shader.m_filterLinear)
-                    samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
-                if(m_shader.m_clamp)
-                {
-                    samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
-                    samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
-                    samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
-                }
-            }
+            samplerDesc.linear = ti->second.m_linear;
+            if(ti->second.m_repeat)
+                samplerDesc.address = TextureAddress::Wrap;
+            if(ti->second.m_clamp)
+                samplerDesc.address = TextureAddress::Clamp;
+            if(ti->second.m_mirror)
+                samplerDesc.address = TextureAddress::Mirror;
+        }
+        else
+        {
+            samplerDesc.linear = m_shader.m_filterLinear;
+            if(m_shader.m_clamp)
+                samplerDesc.address = TextureAddress::Clamp;
         }
 
-        m_device->CreateSamplerState(&samplerDesc, samplerState.put());
-        m_samplers.insert(std::make_pair(texture.binding, samplerState));
+        m_samplers.insert(std::make_pair(texture.binding, m_backend->CreateSampler(samplerDesc)));
     }
 
-    if(m_shader.BufferSize(0) > 0)
-    {
-        D3D11_BUFFER_DESC constantBufferDesc = {};
-        constantBufferDesc.ByteWidth         = (m_shader.BufferSize(0) + 0xf) & 0xfffffff0;
-        constantBufferDesc.Usage             = D3D11_USAGE_DYNAMIC;
-        constantBufferDesc.BindFlags         = D3D11_BIND_CONSTANT_BUFFER;
-        constantBufferDesc.CPUAccessFlags    = D3D11_CPU_ACCESS_WRITE;
-
-        hr = m_device->CreateBuffer(&constantBufferDesc, nullptr, m_constantBuffer.put());
-        assert(SUCCEEDED(hr));
-    }
+    if(m_shader.BufferSize(UBO_BUFFER) > 0)
+        m_constantBuffer = m_backend->CreateConstantBuffer(m_shader.BufferSize(UBO_BUFFER));
     else
-    {
         m_constantBuffer = nullptr;
-    }
-
-    if(m_shader.BufferSize(-1) > 0)
-    {
-        D3D11_BUFFER_DESC pushBufferDesc = {};
-        pushBufferDesc.ByteWidth         = (m_shader.BufferSize(-1) + 0xf) & 0xfffffff0;
-        pushBufferDesc.Usage             = D3D11_USAGE_DYNAMIC;
-        pushBufferDesc.BindFlags         = D3D11_BIND_CONSTANT_BUFFER;
-        pushBufferDesc.CPUAccessFlags    = D3D11_CPU_ACCESS_WRITE;
 
-        hr = m_device->CreateBuffer(&pushBufferDesc, nullptr, m_pushBuffer.put());
-        assert(SUCCEEDED(hr));
-    }
+    if(m_shader.BufferSize(PUSH_BUFFER) > 0)
+        m_pushBuffer = m_backend->CreateConstantBuffer(m_shader.BufferSize(PUSH_BUFFER));
     else
-    {
         m_pushBuffer = nullptr;
-    }
 
     // create MVP
     memset(&m_modelViewProj, 0, 16 * sizeof(float));
@@ -166,7 +93,6 @@ void ShaderPass::UpdateMVP(float sx, float sy, float tx, float ty)
 
 ShaderPass::~ShaderPass()
 {
-    m_inputLayout    = nullptr;
     m_vertexBuffer   = nullptr;
     m_constantBuffer = nullptr;
     m_pushBuffer     = nullptr;
@@ -206,12 +132,12 @@ void ShaderPass::Resize(int sourceWidth, int sourceHeight, int destWidth, int de
     }
 }
 
-void ShaderPass::Render(std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>>& resources, int frameCount, int boxX, int boxY)
+void ShaderPass::Render(std::map<std::string, std::shared_ptr<RenderTexture>>& resources, int frameCount, int boxX, int boxY)
 {
-    Render(m_sourceView, resources, frameCount, boxX, boxY);
+    Render(m_source, resources, frameCount, boxX, boxY);
 }
 
-void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::string, winrt::com_ptr<ID3D11ShaderResourceView>>& resources, int frameCount, int boxX, int boxY)
+void ShaderPass::Render(RenderTexture* source, std::map<std::string, std::shared_ptr<RenderTexture>>& resources, int frameCount, int boxX, int boxY)
 {
     params_FrameCount += frameCount;
     if(m_shader.m_frameCountMod > 0)
@@ -225,33 +151,20 @@ void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::stri
 
     if(m_constantBuffer != nullptr)
     {
-        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
-        m_context->Map(m_constantBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource);
-        m_shader.FillParams(0, (char*)mappedSubresource.pData);
-        m_context->Unmap(m_constantBuffer.get(), 0);
+        m_shader.FillParams(UBO_BUFFER, m_backend->Map(*m_constantBuffer));
+        m_backend->Unmap(*m_constantBuffer);
     }
 
     if(m_pushBuffer != nullptr)
     {
-        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
-        m_context->Map(m_pushBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource);
-        m_shader.FillParams(-1, (char*)mappedSubresource.pData);
-        m_context->Unmap(m_pushBuffer.get(), 0);
+        m_shader.FillParams(PUSH_BUFFER, m_backend->Map(*m_pushBuffer));
+        m_backend->Unmap(*m_pushBuffer);
     }
 
-    D3D11_VIEWPORT viewport = {static_cast<float>(boxX), static_cast<float>(boxY), static_cast<float>(m_destWidth), static_cast<float>(m_destHeight), 0.0f, 1.0f};
-    m_context->RSSetViewports(1, &viewport);
-
-    ID3D11RenderTargetView* targets[1] = {m_targetView};
-    m_context->OMSetRenderTargets(1, targets, NULL);
-
-    m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
-    m_context->IASetInputLayout(m_inputLayout.get());
-    ID3D11Buffer* vertexBuffer[1] = {m_vertexBuffer.get()};
-    m_context->IASetVertexBuffers(0, 1, vertexBuffer, &s_vertexStride, &s_vertexOffset);
-
-    m_context->VSSetShader(m_shader.m_vertexShader.get(), NULL, 0);
-    m_context->PSSetShader(m_shader.m_pixelShader.get(), NULL, 0);
+    m_backend->SetViewport(static_cast<float>(boxX), static_cast<float>(boxY), static_cast<float>(m_destWidth), static_cast<float>(m_destHeight));
+    m_backend->SetRenderTarget(m_target);
+    m_backend->SetVertexBuffer(*m_vertexBuffer, s_vertexStride);
+    m_backend->SetProgram(*m_shader.m_program);
 
     std::vector<int> bindings;
     for(const auto& texture : m_shader.m_shaderDef.Samplers)
@@ -259,8 +172,7 @@ void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::stri
         auto& sampler = m_samplers.at(texture.binding);
         if(texture.name == "Source")
         {
-            ID3D11ShaderResourceView* localResources[1] = {sourceView};
-            m_context->PSSetShaderResources(texture.binding, 1, localResources);
+            m_backend->SetTexture(texture.binding, source);
             bindings.push_back(texture.binding);
         }
         else
@@ -272,8 +184,7 @@ void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::stri
             }
             if(it != resources.end())
             {
-                ID3D11ShaderResourceView* localResources[1] = {it->second.get()};
-                m_context->PSSetShaderResources(texture.binding, 1, localResources);
+                m_backend->SetTexture(texture.binding, it->second.get());
                 bindings.push_back(texture.binding);
             }
             else
@@ -284,40 +195,33 @@ void ShaderPass::Render(ID3D11ShaderResourceView* sourceView, std::map<std::stri
 #endif
             }
         }
-        ID3D11SamplerState* samplers[1] = {sampler.get()};
-        m_context->PSSetSamplers(texture.binding, 1, samplers);
+        m_backend->SetSampler(texture.binding, *sampler);
     }
 
     if(m_constantBuffer != nullptr)
     {
-        ID3D11Buffer* buffer[1] = {m_constantBuffer.get()};
-        m_context->VSSetConstantBuffers(0, 1, buffer);
-        m_context->PSSetConstantBuffers(0, 1, buffer);
+        m_backend->SetConstantBuffer(0, *m_constantBuffer);
     }
     if(m_pushBuffer != nullptr)
     {
-        ID3D11Buffer* buffer[1] = {m_pushBuffer.get()};
-        m_context->VSSetConstantBuffers(1, 1, buffer);
-        m_context->PSSetConstantBuffers(1, 1, buffer);
+        m_backend->SetConstantBuffer(1, *m_pushBuffer);
     }
 
     if(strcmp(this->m_shader.m_shaderDef.Name, "preprocess") == 0)
     {
-        m_context->Draw(s_vertexCount, 0);
+        m_backend->Draw(s_vertexCount, 0);
     }
     else
     {
-        m_context->Draw(s_vertexCount, 4);
+        m_backend->Draw(s_vertexCount, 4);
     }
 
     // unbind to allow rebinding as input/output
     for(auto& b : bindings)
     {
-        ID3D11ShaderResourceView* null[] = {nullptr};
-        m_context->PSSetShaderResources(b, 1, null);
+        m_backend->SetTexture(b, nullptr);
     }
-    ID3D11RenderTargetView* null[] = {nullptr};
-    m_context->OMSetRenderTargets(1, null, NULL);
+    m_backend->SetRenderTarget(nullptr);
 }
 
 bool ShaderPass::RequiresFeedback() const
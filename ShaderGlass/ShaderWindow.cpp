@@ -309,6 +309,47 @@ void ShaderWindow::LoadProfile()
     }
 }
 
+bool ShaderWindow::LoadPreset(const std::wstring& fileName)
+{
+    if(m_numPresets >= MAX_SHADERS)
+        return false;
+
+    try
+    {
+        const auto presetNo = m_captureManager.LoadPreset(fileName);
+        m_numPresets        = m_captureManager.Presets().size();
+        SendMessage(m_browserWindow, WM_COMMAND, IDM_UPDATE_PRESETS, 0);
+        SendMessage(m_mainWindow, WM_COMMAND, WM_SHADER(presetNo), 0);
+    }
+    catch(std::exception& e)
+    {
+        MessageBox(NULL, convertCharArrayToLPCWSTR((std::string("Error loading preset: ") + std::string(e.what())).c_str()), L"ShaderGlass", MB_OK | MB_ICONERROR);
+        return false;
+    }
+
+    return true;
+}
+
+void ShaderWindow::LoadPreset()
+{
+    OPENFILENAMEW ofn;
+    wchar_t       szFileName[MAX_PATH] = L"";
+    ZeroMemory(&ofn, sizeof(ofn));
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner   = NULL;
+    ofn.lpstrFilter = (LPCWSTR)L"RetroArch Presets (*.slangp)\0*.slangp\0All Files (*.*)\0*.*\0";
+    ofn.lpstrFile   = (LPWSTR)szFileName;
+    ofn.nMaxFile    = MAX_PATH;
+    ofn.Flags       = OFN_EXPLORER | OFN_FILEMUSTEXIST | OFN_HIDEREADONLY;
+    ofn.lpstrDefExt = (LPCWSTR)L"slangp";
+
+    if(GetOpenFileName(&ofn))
+    {
+        std::wstring ws(ofn.lpstrFile);
+        LoadPreset(ws);
+    }
+}
+
 void ShaderWindow::SetFreeScale()
 {
     CheckMenuRadioItem(m_outputScaleMenu, WM_OUTPUT_SCALE(0), WM_OUTPUT_SCALE(static_cast<UINT>(outputScales.size() - 1)), 0, MF_BYCOMMAND);
@@ -850,10 +891,59 @@ void ShaderWindow::UpdateTitle()
             }
         }
 
-        wchar_t     title[200];
+        wchar_t     title[300];
         const char* scaleString = m_captureOptions.freeScale ? "free" : outputScale.mnemonic;
-        const auto fps = (int)roundf(m_captureManager.FPS());
-        _snwprintf_s(title, 200, _T("ShaderGlass (%s%S, %Spx, %S%%, ~%S, %dfps)"), windowName, shader->Name, pixelSize.mnemonic, scaleString, aspectRatio.mnemonic, fps);
+        const auto metrics = m_captureManager.Metrics();
+        const auto fps     = (int)roundf(metrics.fps);
+        _snwprintf_s(title, 300, _T("ShaderGlass (%s%S, %Spx, %S%%, ~%S, %dfps)"), windowName, shader->Name, pixelSize.mnemonic, scaleString, aspectRatio.mnemonic, fps);
+        if(metrics.latencyP95 > 0)
+        {
+            const auto length = wcslen(title);
+            _snwprintf_s(title + length, 300 - length, _TRUNCATE, _T(" %.1fms latency"), metrics.latencyP95);
+        }
+
+        bool       reduced;
+        const auto memory = m_captureManager.TextureUsage(reduced);
+        if(memory.Total())
+        {
+            const auto length = wcslen(title);
+            _snwprintf_s(title + length, 300 - length, _TRUNCATE, reduced ? _T(" %.0fMB reduced") : _T(" %.0fMB"), memory.Total() / (1024.0f * 1024.0f));
+        }
+
+        int        governorSkip;
+        const auto governorScale = m_captureManager.GovernorScale(governorSkip);
+        if(governorScale < 1.0f || governorSkip)
+        {
+            const auto length = wcslen(title);
+            _snwprintf_s(title + length, 300 - length, _TRUNCATE, _T(" %d%% res +%d skip"), (int)roundf(governorScale * 100.0f), governorSkip);
+        }
+
+        bool       reloadFailed;
+        const auto reloadLatency = m_captureManager.ReloadLatency(reloadFailed);
+        if(reloadFailed || reloadLatency > 0)
+        {
+            const auto length = wcslen(title);
+            if(reloadFailed)
+                _snwprintf_s(title + length, 300 - length, _TRUNCATE, _T(" reload failed"));
+            else
+                _snwprintf_s(title + length, 300 - length, _TRUNCATE, _T(" reloaded in %.0fms"), reloadLatency);
+        }
+
+        // rolling per-pass timings while profiling
+        const auto timings = m_captureManager.PassTimings();
+        if(!timings.empty())
+        {
+            float total   = 0;
+            auto  slowest = timings.begin();
+            for(auto t = timings.begin(); t != timings.end(); t++)
+            {
+                total += t->averageMs;
+                if(t->averageMs > slowest->averageMs)
+                    slowest = t;
+            }
+            const auto length = wcslen(title);
+            _snwprintf_s(title + length, 300 - length, _TRUNCATE, _T(" %.2fms, slowest %S %.2fms"), total, slowest->name.c_str(), slowest->averageMs);
+        }
         SetWindowTextW(m_mainWindow, title);
     }
     else
@@ -888,7 +978,21 @@ LRESULT CALLBACK ShaderWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam, L
             break;
         case IDM_UPDATE_PARAMS:
             PostMessage(m_paramsWindow, WM_COMMAND, IDM_UPDATE_PARAMS, 0);
+            m_captureManager.UpdateSpecialization(); // a new chain is running
+            break;
+        case IDM_PRESET_SPECIALIZED:
+            m_captureManager.ApplyVariants();
+            break;
+        case IDM_PRESET_CHANGED: {
+            // a failed edit keeps the previous passes running
+            std::string error;
+            if(!m_captureManager.ApplyPresetChange(error))
+            {
+                OutputDebugStringA(("Preset reload failed: " + error + "\n").c_str());
+            }
+            UpdateTitle();
             break;
+        }
         case ID_SHADER_BROWSE: {
             if(!m_browserPositioned)
             {
@@ -964,6 +1068,16 @@ LRESULT CALLBACK ShaderWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam, L
                 UpdateWindowState();
             }
             break;
+        case ID_PROCESSING_PROFILEPASSES: {
+            const bool profiling = !(GetMenuState(m_programMenu, ID_PROCESSING_PROFILEPASSES, MF_BYCOMMAND) & MF_CHECKED);
+            CheckMenuItem(m_programMenu, ID_PROCESSING_PROFILEPASSES, profiling ? MF_CHECKED : MF_UNCHECKED);
+            m_captureManager.SetProfiling(profiling);
+            UpdateTitle();
+            break;
+        }
+        case ID_PROCESSING_EXPORTTRACE:
+            ExportTrace();
+            break;
         case ID_PROCESSING_GLOBALHOTKEYS:
             if(GetMenuState(m_programMenu, ID_PROCESSING_GLOBALHOTKEYS, MF_BYCOMMAND) & MF_CHECKED)
             {
@@ -1142,6 +1256,14 @@ LRESULT CALLBACK ShaderWindow::WndProc(HWND hWnd, UINT message, WPARAM wParam, L
         case IDM_PROCESSING_LOADPROFILE:
             LoadProfile();
             break;
+        case ID_SHADER_LOADPRESET:
+            LoadPreset();
+            break;
+        case ID_SHADER_SPECIALIZE:
+            m_captureOptions.specialize = !m_captureOptions.specialize;
+            CheckMenuItem(m_shaderMenu, ID_SHADER_SPECIALIZE, m_captureOptions.specialize ? MF_CHECKED : MF_UNCHECKED);
+            m_captureManager.UpdateSpecialization();
+            break;
         case IDM_PROCESSING_SAVEPROFILEAS:
             SaveProfile();
             break;
@@ -1518,6 +1640,32 @@ void ShaderWindow::Screenshot()
     }
 }
 
+void ShaderWindow::ExportTrace()
+{
+    OPENFILENAME ofn;
+    wchar_t      szFile[MAX_PATH] = L"";
+
+    ZeroMemory(&ofn, sizeof(ofn));
+    ofn.lStructSize     = sizeof(ofn);
+    ofn.hwndOwner       = m_mainWindow;
+    ofn.lpstrFile       = szFile;
+    ofn.nMaxFile        = MAX_PATH;
+    ofn.lpstrFilter     = _T("Chrome Trace\0*.json\0");
+    ofn.lpstrDefExt     = _T("json");
+    ofn.nFilterIndex    = 1;
+    ofn.lpstrFileTitle  = NULL;
+    ofn.nMaxFileTitle   = 0;
+    ofn.lpstrInitialDir = NULL;
+    ofn.Flags           = OFN_PATHMUSTEXIST;
+
+    if(GetSaveFileName(&ofn) == TRUE)
+    {
+        // trace covers the passes profiled so far, enable Processing -> Profile Passes first
+        if(!m_captureManager.ExportTrace(ofn.lpstrFile))
+            MessageBox(m_mainWindow, L"Unable to write trace file.", L"ShaderGlass", MB_OK | MB_ICONERROR);
+    }
+}
+
 void ShaderWindow::ToggleBorderless(HWND hWnd)
 {
     LONG cur_style = GetWindowLong(m_mainWindow, GWL_STYLE);
@@ -1769,8 +1917,9 @@ void ShaderWindow::UnregisterHotkeys()
 
 void ShaderWindow::Start(_In_ LPWSTR lpCmdLine, HWND paramsWindow, HWND browserWindow)
 {
-    bool autoStart  = true;
-    bool fullScreen = false;
+    bool         autoStart  = true;
+    bool         fullScreen = false;
+    std::wstring presetFile;
 
     if(lpCmdLine)
     {
@@ -1784,10 +1933,22 @@ void ShaderWindow::Start(_In_ LPWSTR lpCmdLine, HWND paramsWindow, HWND browserW
                 autoStart = false;
             else if(wcscmp(args[a], L"-fullscreen") == 0 || wcscmp(args[a], L"-f") == 0)
                 fullScreen = true;
+            else if(wcscmp(args[a], L"-budget") == 0 && a + 1 < numArgs)
+                m_captureOptions.textureBudget = static_cast<size_t>(max(0, _wtoi(args[++a]))) * 1024 * 1024;
+            else if(wcscmp(args[a], L"-target") == 0 && a + 1 < numArgs)
+                m_captureOptions.targetFrameTime = max(0.0f, static_cast<float>(_wtof(args[++a])));
+            else if(wcscmp(args[a], L"-minscale") == 0 && a + 1 < numArgs)
+                m_captureOptions.governorMinScale = static_cast<float>(_wtof(args[++a])) / 100.0f;
+            else if(wcscmp(args[a], L"-maxskip") == 0 && a + 1 < numArgs)
+                m_captureOptions.governorMaxFrameSkip = max(0, _wtoi(args[++a]));
+            else if((wcscmp(args[a], L"-metrics") == 0 || wcscmp(args[a], L"-m") == 0) && a + 1 < numArgs)
+                m_captureManager.SetMetricsLog(args[++a]);
             else if(a == numArgs - 1)
             {
                 std::wstring ws(args[a]);
-                if(ws.size())
+                if(ws.ends_with(L".slangp"))
+                    presetFile = ws;
+                else if(ws.size())
                     LoadProfile(ws);
             }
         }
@@ -1796,6 +1957,8 @@ void ShaderWindow::Start(_In_ LPWSTR lpCmdLine, HWND paramsWindow, HWND browserW
     m_paramsWindow  = paramsWindow;
     m_browserWindow = browserWindow;
     m_inputDialog.reset(new InputDialog(m_instance, m_mainWindow));
+    if(presetFile.size())
+        LoadPreset(presetFile);
 
     if(autoStart)
     {
@@ -76,7 +76,10 @@ private:
     void Stop();
     void TryUpdateInput();
     void Screenshot();
+    void ExportTrace();
     void LoadImage();
+    bool LoadPreset(const std::wstring& fileName);
+    void LoadPreset();
     void UpdateTitle();
     void SetFreeScale();
     void RegisterHotkeys();
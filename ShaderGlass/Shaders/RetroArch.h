@@ -1,2775 +1,89 @@
 #pragma once
 
-#include "RetroArch\anamorphic\shaders\AnamorphicShadersAnamorphicShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\aa-shader-4.0-level2\AntiAliasingShadersAaShader40Level2AaShader40Level2Pass1ShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\aa-shader-4.0-level2\AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersAaShader40ShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersAdvancedAaShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicXShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicYShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersFxaaShaderDef.h"
-#include "RetroArch\stock\StockStockShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersReverseAaShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass0ShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass1ShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass2ShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersFastSharpenShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmDrezNoneShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoGlassParamsShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextAdvGlassShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmFetchDrezOutputShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\dedither\BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass1ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass3ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass5ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\dedither\BezelMega_BezelShadersDeditherDeditherGammaPrep2AfterShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\ps1dither\BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\fxaa\BezelMega_BezelShadersFxaaFxaaShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseStockShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass1ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass3ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass4ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseIntroShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\gtu\BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\gtu\BezelMega_BezelShadersGtuHsmGtuPass2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmPreShadersAfterglowShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\dogway\BezelMega_BezelShadersDogwayHsmGradeShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmAvgLumShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmInterlaceAndLinearizeShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeThresholdShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeHalationShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepGlassShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseLinearizeCrtShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBlurOutsideScreenHorizShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBlurOutsideScreenVertShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9x9ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseReflectionGlassShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseDelinearizeShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtDariusgGdvMiniShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\ntsc\BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\ntsc\BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\ntsc\BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCustomFastSharpenNtscShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass1ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmGaussian_horizontalShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmDeconvergenceShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\lcd-cgwg\BezelMega_BezelShadersLcdCgwgHsmLcdGridV2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmInterlaceShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\megatron\BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\megatron\BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\megatron\BezelMega_BezelShadersMegatronCrtSonyMegatronShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseLinearizeCrtHdrShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseReflectionGlassHdrShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoNoReflectParamsShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextAdvNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass2NoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBezelImagesOverCrtShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCombinePassesNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmDeconvergenceNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\megatron\BezelMega_BezelShadersMegatronCrtSonyMegatronNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseOutputSdrShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoAllParamsShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextAdvShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepImageLayersShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseReflectionShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCombinePassesShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass0ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass1ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass2ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass3ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass4ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass0ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass1ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass2ShaderDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLightingCombineShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrSuperXbrPass0ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrSuperXbrPass1ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrSuperXbrPass2ShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicXShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepMinimumNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtDariusgGdvMiniPotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextStdGlassShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseLinearizeShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextStdShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextStdNoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\lcd-cgwg\BezelMega_BezelShadersLcdCgwgHsmLcdGridV2NoReflectShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoPotatoParamsShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass2PotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepPotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedPotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmDeconvergencePotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\lcd-cgwg\BezelMega_BezelShadersLcdCgwgHsmLcdGridV2PotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\megatron\BezelMega_BezelShadersMegatronCrtSonyMegatronPotatoShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepPotatoMegatronShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrLinearizeShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrCrtHyllianSincCurvatureShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrThresholdShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrBlur_horizShaderDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrBlur_vertShaderDef.h"
-#include "RetroArch\bezel\uborder\shaders\support_shaders\BezelUborderShadersSupport_shadersFeedbackShaderDef.h"
-#include "RetroArch\bezel\uborder\shaders\support_shaders\BezelUborderShadersSupport_shadersAmbientLightShaderDef.h"
-#include "RetroArch\bezel\uborder\shaders\support_shaders\BezelUborderShadersSupport_shadersOriginalShaderDef.h"
-#include "RetroArch\bezel\uborder\shaders\content_shaders\BezelUborderShadersContent_shadersCrtNobodyShaderDef.h"
-#include "RetroArch\bezel\uborder\shaders\BezelUborderShadersUborderShaderDef.h"
-#include "RetroArch\bezel\uborder\shaders\content_bezel_shaders\BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseLinearizeShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsampleShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterUpsampleShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseDelinearizeShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsample_bloomShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterNaive_resampleShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterMoving_avgShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blendShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blend_fastShaderDef.h"
-#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blend_fastestShaderDef.h"
-#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussianSharpShaderDef.h"
-#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussianShaderDef.h"
-#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef.h"
-#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_verticalSharpShaderDef.h"
-#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef.h"
-#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_verticalShaderDef.h"
-#include "RetroArch\blurs\shaders\gauss_4tap\BlursShadersGauss_4tapGauss_2tap_hShaderDef.h"
-#include "RetroArch\blurs\shaders\gauss_4tap\BlursShadersGauss_4tapGauss_2tap_vShaderDef.h"
-#include "RetroArch\blurs\shaders\BlursShadersGizmoBlurShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase0ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase1ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase2ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase3ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase4ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase5ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase6ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase7ShaderDef.h"
-#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseScreen_combineShaderDef.h"
-#include "RetroArch\blurs\shaders\BlursShadersSharpsmootherShaderDef.h"
-#include "RetroArch\blurs\shaders\BlursShadersSmartBlurShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersFeedbackShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersAmbientGlowShaderDef.h"
-#include "RetroArch\border\shaders\autocrop-koko\BorderShadersAutocropKokoAutocrop0_precutShaderDef.h"
-#include "RetroArch\border\shaders\autocrop-koko\BorderShadersAutocropKokoAutocrop1_computeShaderDef.h"
-#include "RetroArch\border\shaders\autocrop-koko\BorderShadersAutocropKokoAutocrop2_displayShaderDef.h"
-#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_topShaderDef.h"
-#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_bottomShaderDef.h"
-#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_leftShaderDef.h"
-#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_rightShaderDef.h"
-#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillComposeShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersBigblurShaderDef.h"
-#include "RetroArch\border\shaders\blur_fill\BorderShadersBlur_fillRender_sampling_areasShaderDef.h"
-#include "RetroArch\border\shaders\blur_fill\BorderShadersBlur_fillComposeShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersEffectBorderIqShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersImgborderGbpShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtEasymodeShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtGeomShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastVerticalShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastHorizontalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeVerticalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeHorizontalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBrightpassShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomVerticalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleGeometryAaLastPassShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbaColorShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersTvoutTweaksShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersInterlacingShaderDef.h"
-#include "RetroArch\auto-box\AutoBoxBoxCenterShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersImgborderShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtConsumerShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersDotShaderDef.h"
-#include "RetroArch\handheld\shaders\lcd-cgwg\HandheldShadersLcdCgwgLcdGridV2ShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersLightgunBorderShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersImgborderSgbShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcColorShaderDef.h"
-#include "RetroArch\border\shaders\BorderShadersImgborderSgbaShaderDef.h"
-#include "RetroArch\cel\shaders\CelShadersAdvcartoonShaderDef.h"
-#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_ShaderShaderDef.h"
-#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef.h"
-#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef.h"
-#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef.h"
-#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersAdvanced_CRT_shader_whkrmrgks0ShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilCopyShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilDownsample2xHorzShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilDownsample2xVertShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilTonemapAndDownsampleHorzShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilTonemapAndDownsampleVertShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilGaussianBlurHorzShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilGaussianBlurVertShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroCrtGenerateScreenTextureShaderDef.h"
-#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroCrtRgbToCrt_noSignalShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrt1tapShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersRcasShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtApertureShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtBlurPiShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtCaligariShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtCgwgFastShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtCyclonShaderDef.h"
-#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationBlur_horizShaderDef.h"
-#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationBlur_vertShaderDef.h"
-#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationThresholdShaderDef.h"
-#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtFrutbunnShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtGdvMiniUltraShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtGdvMiniShaderDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxePhosphor_applyShaderDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxePhosphor_updateShaderDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeGaussxShaderDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeGaussyShaderDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef.h"
-#include "RetroArch\crt\shaders\crt-consumer\CrtShadersCrtConsumerLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtGeomMiniShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastStockShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastPreShadersShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastBloom_horizontalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastBloom_verticalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastDeconvergenceFShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastPerfPassShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastPreShadersfShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastLinearizefShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass1fShaderDef.h"
-#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdStockShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdAfterglow0ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdPreShadersAfterglowShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdLinearizeHdShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdGaussian_horizontalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdGaussian_verticalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdBloom_horizontalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdBloom_verticalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdCrtGuestAdvancedHdPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdDeconvergenceHdShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedStockShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedAfterglow0ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedPreShadersAfterglowShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass3ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCustomFastSharpenShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedAvgLumNtscShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedLinearizeNtscShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCrtGuestAdvancedNtscPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedGaussian_verticalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedBloom_verticalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCrtGuestAdvancedNtscPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedDeconvergenceNtscShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedAvgLumShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedGaussian_horizontalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedBloom_horizontalShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCrtGuestAdvancedShaderDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedDeconvergenceShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllian3dShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianFastShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\CrtShadersHyllianSupportMultiLUTModifiedShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\ntsc\shaders\ntsc-adaptive-lite\CrtShadersHyllianSupportNtscShadersNtscAdaptiveLiteNtscLitePass1ShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\ntsc\shaders\ntsc-adaptive-lite\CrtShadersHyllianSupportNtscShadersNtscAdaptiveLiteNtscLitePass2ShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\CrtShadersHyllianSupportLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianSincPass0ShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\CrtShadersHyllianSupportMultiLUTLinearShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianBaseShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\glow\CrtShadersHyllianSupportGlowThresholdShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\glow\CrtShadersHyllianSupportGlowBlur_horizShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\glow\CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef.h"
-#include "RetroArch\crt\shaders\crt-interlaced-halation\CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-interlaced-halation\CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-interlaced-halation\CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtLottesFastShaderDef.h"
-#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassBloompassShaderDef.h"
-#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassScanpassGlowShaderDef.h"
-#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassScanpassShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtLottesShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtMattiasShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcResizeShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcNtsc_pass2ShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtNesMiniShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtNobodyShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtPiShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtPocketShaderDef.h"
-#include "RetroArch\crt\shaders\crt-potato\shader-files\CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef.h"
-#include "RetroArch\crt\shaders\crt-potato\shader-files\CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtResswitchGlitchKokoShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxFakeBloomIntelShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskFakeBloomIntelShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleGeometryAaLastPassIntelShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxFakeBloomShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskFakeBloomShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleMaskResizeVerticalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleMaskResizeHorizontalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBrightpassShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomVerticalShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxIntelShaderDef.h"
-#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskIntelShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtSimpleShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersCrtSinesShaderDef.h"
-#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestCubicShaderDef.h"
-#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestScanlineShaderDef.h"
-#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestSincShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrSuperXbrPass0ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrSuperXbrPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrSuperXbrPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCustomBicubicXShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCustomBicubicYShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCrtCustomShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrThresholdShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrBlur_horizShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrBlur_vertShaderDef.h"
-#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCustomResolveShaderDef.h"
-#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleScanlineInterpolationShaderDef.h"
-#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleScanlineSimpleShaderDef.h"
-#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayBlendoverlayShaderDef.h"
-#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleBrightenShaderDef.h"
-#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleSunsetGaussianVertShaderDef.h"
-#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleSunsetGaussianHorizShaderDef.h"
-#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleCandyBloomShaderDef.h"
-#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef.h"
-#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef.h"
-#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6CrtYo6WarpShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersJinc2ShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowLinearizeShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowGauss_horizShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowGauss_vertShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowThresholdShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowBlur_horizShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowBlur_vertShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowResolveShaderDef.h"
-#include "RetroArch\crt\shaders\glow\CrtShadersGlowLanczos_horizShaderDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimCompositeShaderDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimScreenShaderDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPostDownsampleShaderDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPostUpsampleShaderDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPresentShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersFakeCrtGeomPotatoShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersFakeCrtGeomShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersFakelottesShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersGizmoCrtShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersGizmoSlotmaskCrtShaderDef.h"
-#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsGlowTrails0ShaderDef.h"
-#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsGlowTrails1ShaderDef.h"
-#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesGritsScanlinesShaderDef.h"
-#include "RetroArch\crt\shaders\gtu-v050\CrtShadersGtuV050Pass1ShaderDef.h"
-#include "RetroArch\crt\shaders\gtu-v050\CrtShadersGtuV050Pass2ShaderDef.h"
-#include "RetroArch\crt\shaders\gtu-v050\CrtShadersGtuV050Pass3ShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_ntsc_encodeShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_ntsc_decodeShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_colorShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_prescaleShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_deconvergeShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_scanlineShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_defocusShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_postShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_phosphorShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_chromaShaderDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_distortionShaderDef.h"
-#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtBufCShaderDef.h"
-#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtBufDShaderDef.h"
-#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtImageShaderDef.h"
-#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieAccumulateShaderDef.h"
-#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieBlur_horizShaderDef.h"
-#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieBlur_vertShaderDef.h"
-#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieNewpixieCrtShaderDef.h"
-#include "RetroArch\crt\shaders\newpixie-mini\CrtShadersNewpixieMiniNewpixieMiniShaderDef.h"
-#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutScanlinesInterlaceLinearizeShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastVerticalShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastHorizontalShaderDef.h"
-#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutPhosphorlutPass0ShaderDef.h"
-#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutPhosphorlutPass1ShaderDef.h"
-#include "RetroArch\crt\shaders\rt_curvature\CrtShadersRt_curvatureRt_curvatureShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur43fastVerticalShaderDef.h"
-#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur43fastHorizontalShaderDef.h"
-#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsCombineShaderDef.h"
-#include "RetroArch\crt\shaders\vt220\CrtShadersVt220Vt220ShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersYee64ShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersYeetronShaderDef.h"
-#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_compositeShaderDef.h"
-#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_curvatureShaderDef.h"
-#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_geoShaderDef.h"
-#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_coarsemaskShaderDef.h"
-#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_finemaskShaderDef.h"
-#include "RetroArch\deblur\shaders\DeblurShadersDeblurLumaShaderDef.h"
-#include "RetroArch\deblur\shaders\DeblurShadersDeblurShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersBilateralHorizontalShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersBilateralVerticalShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersBilateralShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersFastBilateralShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass2ShaderDef.h"
-#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass0ShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersMedian_3x3ShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersMedian_5x5ShaderDef.h"
-#include "RetroArch\denoisers\shaders\DenoisersShadersSlowBilateralShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersBayerMatrixDitheringShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersBayer_4x4ShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersBlue_noiseShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersBlue_noise_dynamicShaderDef.h"
-#include "RetroArch\dithering\shaders\cbod-v1\DitheringShadersCbodV1CbodV1Pass1ShaderDef.h"
-#include "RetroArch\dithering\shaders\cbod-v1\DitheringShadersCbodV1CbodV1Pass2ShaderDef.h"
-#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherLinearizeShaderDef.h"
-#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef.h"
-#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherCheckerboardDeditherPass2ShaderDef.h"
-#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersGSharp_resamplerShaderDef.h"
-#include "RetroArch\dithering\shaders\gdapt\DitheringShadersGdaptGdaptPass0ShaderDef.h"
-#include "RetroArch\dithering\shaders\gdapt\DitheringShadersGdaptGdaptPass1ShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersGenditherShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersJinc2DeditherShaderDef.h"
-#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass0ShaderDef.h"
-#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass1ShaderDef.h"
-#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass2ShaderDef.h"
-#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass3ShaderDef.h"
-#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass4ShaderDef.h"
-#include "RetroArch\dithering\shaders\ps1dither\DitheringShadersPs1ditherPS1UnditherBoxBlurShaderDef.h"
-#include "RetroArch\dithering\shaders\ps1dither\DitheringShadersPs1ditherPS1UnditherAntiBayerShaderDef.h"
-#include "RetroArch\dithering\shaders\ps1dither\DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef.h"
-#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixLinearizeShaderDef.h"
-#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass1ShaderDef.h"
-#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass2ShaderDef.h"
-#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass3ShaderDef.h"
-#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass4ShaderDef.h"
-#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass5ShaderDef.h"
-#include "RetroArch\dithering\shaders\DitheringShadersSgenptMixShaderDef.h"
-#include "RetroArch\edge-smoothing\cleanEdge\shaders\EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef.h"
-#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShaders3PointShaderDef.h"
-#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersCutShaderDef.h"
-#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtExtendedShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportLinearizeShaderDef.h"
-#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtJincShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportDelinearizeShaderDef.h"
-#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtXbrLv1ShaderDef.h"
-#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtShaderDef.h"
-#include "RetroArch\edge-smoothing\eagle\shaders\EdgeSmoothingEagleShaders2xsaiShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef.h"
-#include "RetroArch\edge-smoothing\eagle\shaders\EdgeSmoothingEagleShadersSuper2xsaiShaderDef.h"
-#include "RetroArch\edge-smoothing\eagle\shaders\EdgeSmoothingEagleShadersSupereagleShaderDef.h"
-#include "RetroArch\edge-smoothing\fsr\shaders\EdgeSmoothingFsrShadersFsrPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\fsr\shaders\EdgeSmoothingFsrShadersFsrPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq2xHalphonShaderDef.h"
-#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq2xShaderDef.h"
-#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq3xShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBSplineXShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBSplineYShaderDef.h"
-#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq4xShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass2ShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediJincShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersCheapSharpenShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediHybridPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediHybridPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediHybridPass2ShaderDef.h"
-#include "RetroArch\vhs\shaders\VhsShadersVhsShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersNaturalVisionShaderDef.h"
-#include "RetroArch\reshade\shaders\ReshadeShadersVibrancePassSh1nra358ShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersRgbToYuvShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass2LumaShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2CshiftLumaShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2OnPassoutput0ShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersYuvToRgb2xShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass2RgbShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersYuvToRgb4xShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass1RgbShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass2RgbShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass1LumaShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass2LumaShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2OnPassoutput3ShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns64Win8x4Pass1RgbShaderDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns64Win8x4Pass2RgbShaderDef.h"
-#include "RetroArch\edge-smoothing\omniscale\shaders\EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef.h"
-#include "RetroArch\edge-smoothing\omniscale\shaders\EdgeSmoothingOmniscaleShadersOmniscaleShaderDef.h"
-#include "RetroArch\edge-smoothing\sabr\shaders\EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef.h"
-#include "RetroArch\edge-smoothing\sabr\shaders\EdgeSmoothingSabrShadersSabrV30ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass2ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass3ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass4ShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass0ShaderDef.h"
-#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef.h"
-#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef.h"
-#include "RetroArch\edge-smoothing\scalehq\shaders\EdgeSmoothingScalehqShaders2xScaleHQShaderDef.h"
-#include "RetroArch\edge-smoothing\scalehq\shaders\EdgeSmoothingScalehqShaders4xScaleHQShaderDef.h"
-#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersEpxShaderDef.h"
-#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersMmpxShaderDef.h"
-#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale2xShaderDef.h"
-#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale2xplusShaderDef.h"
-#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale2xSFXShaderDef.h"
-#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale3xShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass2ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv2-multipass\EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv2-multipass\EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportBSplineXShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportBSplineYShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass1bShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders2xbrzShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders4xbrzShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders5xbrzShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders6xbrzShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\xbrz-freescale-multipass\EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass0ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\xbrz-freescale-multipass\EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef.h"
-#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef.h"
-#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2ShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersDotmaskShaderDef.h"
-#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersSpline16XShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersSpline16YShaderDef.h"
-#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2Pass2ShaderDef.h"
-#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef.h"
-#include "RetroArch\edge-smoothing\xsoft\shaders\EdgeSmoothingXsoftShaders4xsoftShaderDef.h"
-#include "RetroArch\edge-smoothing\xsoft\shaders\EdgeSmoothingXsoftShaders4xsoftSdBShaderDef.h"
-#include "RetroArch\film\shaders\FilmShadersFilmGrainShaderDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTLUTShaderDef.h"
-#include "RetroArch\film\shaders\FilmShadersFilm_noiseShaderDef.h"
-#include "RetroArch\gpu\shaders\3dfx\GpuShaders3dfx3dfx_pass_0ShaderDef.h"
-#include "RetroArch\gpu\shaders\3dfx\GpuShaders3dfx3dfx_pass_1ShaderDef.h"
-#include "RetroArch\gpu\shaders\3dfx\GpuShaders3dfx3dfx_pass_2ShaderDef.h"
-#include "RetroArch\gpu\shaders\GpuShadersPowervr2ShaderDef.h"
-#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgb001ShaderDef.h"
-#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgs001ShaderDef.h"
-#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgs001LightShaderDef.h"
-#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcTo_linShaderDef.h"
-#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef.h"
-#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcTo_lin_fastShaderDef.h"
-#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcAuthentic_gbc_fastShaderDef.h"
-#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcAuthentic_gbc_single_passShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersBevelShaderDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTMultiLUTShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorDsliteColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBALUTShaderDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBCLUTShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcGambatteColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBMLUTShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbMicroColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorNdsColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorNSOGbaColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorNSOGbcColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorPalmColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorPspColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorSp101ColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorSwitchOLEDColorShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorVbaColorShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass0ShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass1ShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass2ShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass3ShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass4ShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass5ShaderDef.h"
-#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass1ShaderDef.h"
-#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass2ShaderDef.h"
-#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass3ShaderDef.h"
-#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass4ShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersResponseTimeShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\lcd-cgwg\HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef.h"
-#include "RetroArch\handheld\console-border\shader-files\lcd-cgwg\HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersDsHybridViewShaderDef.h"
-#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass0ShaderDef.h"
-#include "RetroArch\handheld\shaders\gb-palette\HandheldShadersGbPaletteGbPaletteShaderDef.h"
-#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcDevShaderDef.h"
-#include "RetroArch\handheld\shaders\lcd-cgwg\HandheldShadersLcdCgwgLcdGridShaderDef.h"
-#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass0ShaderDef.h"
-#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass1ShaderDef.h"
-#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass2ShaderDef.h"
-#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass3ShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersLcd1xShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersLcd1x_ndsShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersLcd1x_pspShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersLcd3xShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersRetroTilesShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersRetroV2ShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersRetroV3ShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersSameboyLcdShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd4kShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pShaderDef.h"
-#include "RetroArch\handheld\shaders\HandheldShadersZfast_lcdShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBSpline4TapsShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersBicubic5TapsShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRom5TapsShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRomXShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRomYShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRomShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersLinearizeShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersCubicGammaCorrectShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersCubicShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersHermiteShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos16ShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos25TapsShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos3XShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos3YShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersQuilezShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersSpline36XShaderDef.h"
-#include "RetroArch\interpolation\shaders\InterpolationShadersSpline36YShaderDef.h"
-#include "RetroArch\linear\LinearLinearizeShaderDef.h"
-#include "RetroArch\linear\LinearLinearGammaCorrectShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersAccessibility_modsShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersAntiFlickerShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersAsciiShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersBeadShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersBobDeinterlacingShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersChromaShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersChromaticityShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersCmykHalftoneDotShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersCocktailCabinetShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersColorManglerShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersColorimetryShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersConvergenceShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersDebandShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersDeinterlaceShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersEdgeDetectShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersEgaShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersGeomShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersGlassShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersGradeNoLUTShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersGradeShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersImg_modShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersNight_modeShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersNtscColorsShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyColorShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscLinearToSrgbShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersReliefShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersRetroPalettesShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersSimple_color_controlsShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersSsGammaRampShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersTonemappingShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersWhite_pointShaderDef.h"
-#include "RetroArch\misc\shaders\MiscShadersYiqHueAdjustmentShaderDef.h"
-#include "RetroArch\motion-interpolation\shaders\motion_interpolation\MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef.h"
-#include "RetroArch\motion-interpolation\shaders\motion_interpolation\MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersBraidRewindShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersMix_framesShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersMix_frames_smartShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersMotionblurBlueShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersMotionblurColorShaderDef.h"
-#include "RetroArch\motionblur\shaders\MotionblurShadersMotionblurSimpleShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomDAC_LUTShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomLowPassShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomScaleXShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomScaleYShaderDef.h"
-#include "RetroArch\nes_raw_palette\shaders\Nes_raw_paletteShadersNesColorDecoderShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite3phaseShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseShaderDef.h"
-#include "RetroArch\pal\shaders\PalShadersPalR57shellShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyNtscEncodeYCShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyNtscNoiseShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyNtscSeparateYCShaderDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyNtscDecodeYRmyBmyShaderDef.h"
-#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors0ShaderDef.h"
-#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors1ShaderDef.h"
-#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors2ShaderDef.h"
-#include "RetroArch\ntsc\shaders\blargg\NtscShadersBlarggBlargg0ShaderDef.h"
-#include "RetroArch\ntsc\shaders\blargg\NtscShadersBlarggBlargg1ShaderDef.h"
-#include "RetroArch\ntsc\shaders\mame-ntsc\NtscShadersMameNtscMameNtscShaderDef.h"
-#include "RetroArch\ntsc\shaders\mame-ntsc\NtscShadersMameNtscMamePostprocShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscGaussPassShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscStockShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseGammaShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Svideo3phaseShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite2phaseShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass22phaseShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass22phaseGammaShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Svideo2phaseShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-adaptive\NtscShadersNtscAdaptiveNtscPass1ShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-adaptive\NtscShadersNtscAdaptiveNtscPass2ShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-adaptive-tate\NtscShadersNtscAdaptiveTateNtscTatePass1ShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-adaptive-tate\NtscShadersNtscAdaptiveTateNtscTatePass2ShaderDef.h"
-#include "RetroArch\ntsc\shaders\NtscShadersNtscBlastemShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleNtscMiniShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleNtscSimple1ShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleNtscSimple2ShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleKaizerLpSmallShaderDef.h"
-#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleTiny_ntscShaderDef.h"
-#include "RetroArch\pal\shaders\PalShadersPalR57shellMoireOnlyShaderDef.h"
-#include "RetroArch\pal\shaders\PalShadersPalSinglepassShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersAannShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersBandlimitPixelShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersBilinearAdjustableShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\box_filter_aa\PixelArtScalingShadersBox_filter_aaBox_filter_aa_xformShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersCleanEdgeRotateShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersControlledSharpnessShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersEdge1pixelShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersEdgeNpixelsShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersGridBlendHybridShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersPixellateShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaTo_linShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aaShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aa_single_passShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aa_xformShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpBilinearScanlinesShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpBilinearSimpleShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpBilinearShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpShimmerlessShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSmootheststepShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSmuberStepShaderDef.h"
-#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersUniformNearestShaderDef.h"
-#include "RetroArch\vhs\shaders\VhsShadersRewindShaderDef.h"
-#include "RetroArch\subframe-bfi\shaders\SubframeBfiShadersCrtBeamSimulatorShaderDef.h"
-#include "RetroArch\hdr\shaders\HdrShadersCrtSonyMegatronSourcePassShaderDef.h"
-#include "RetroArch\hdr\shaders\HdrShadersCrtSonyMegatronHdrPassShaderDef.h"
-#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassBloompassGlowShaderDef.h"
-#include "RetroArch\warp\shaders\WarpShadersSmartMorphShaderDef.h"
-#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseLinearShaderDef.h"
-#include "RetroArch\downsample\shaders\DownsampleShadersDrezGSharp_resamplerShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbaColor4kShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbcColor4kShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbcColorShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pGbaColorShaderDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pGbcColorShaderDef.h"
-#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1bShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlineShaderDef.h"
-#include "RetroArch\reshade\shaders\ReshadeShadersScanlinesShaderDef.h"
-#include "RetroArch\reshade\shaders\ReshadeShadersBloomPassSh1nra358ShaderDef.h"
-#include "RetroArch\blurs\shaders\BlursShadersBlurGaussHShaderDef.h"
-#include "RetroArch\blurs\shaders\BlursShadersBlurGaussVShaderDef.h"
-#include "RetroArch\reshade\shaders\ReshadeShadersBlurHazeSh1nra358ShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersSnesHiresBlendShaderDef.h"
-#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef.h"
-#include "RetroArch\reshade\shaders\ReshadeShadersFilmGrainShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_2ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_3ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_4ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_5ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_6ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_7ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_8ShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_get_small_lumaShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blendShaderDef.h"
-#include "RetroArch\reshade\shaders\NormalsDisplacement\ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersIntegerScalingScanlinesShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersOsscShaderDef.h"
-#include "RetroArch\crt\shaders\CrtShadersSlotmaskShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersResIndependentScanlinesShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlineFractShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlinesRereShaderDef.h"
-#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlinesSineAbsShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenPass1ShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenPass2ShaderDef.h"
-#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kComputeLumShaderDef.h"
-#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kPushShaderDef.h"
-#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kComputeGradientShaderDef.h"
-#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kPushgradWeakShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersDiffShaderDef.h"
-#include "RetroArch\sharpen\shaders\SharpenShadersSuperResExShaderDef.h"
-#include "RetroArch\misc\shaders\deposterize\MiscShadersDeposterizeDeposterizePass0ShaderDef.h"
-#include "RetroArch\misc\shaders\deposterize\MiscShadersDeposterizeDeposterizePass1ShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersAnaglyphToSideBySideShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrVRShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrChromaticShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrFilmicSharpenShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrVR_noseShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersShutterToAnaglyphShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersShutterToSideBySideShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersSideBySideSimpleShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersSbsToInterlacedShaderDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersSbsToShutterShaderDef.h"
-#include "RetroArch\vhs\shaders\gristleVHS\VhsShadersGristleVHSHorizontalSoftenShaderDef.h"
-#include "RetroArch\blurs\shaders\sunset_gaussian\BlursShadersSunset_gaussianSunset_horzShaderDef.h"
-#include "RetroArch\vhs\shaders\gristleVHS\VhsShadersGristleVHSVHSShaderDef.h"
-#include "RetroArch\vhs\shaders\VhsShadersMudlordPalVhsShaderDef.h"
-#include "RetroArch\vhs\shaders\VhsShadersStaticShaderDef.h"
-#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_ThirdShaderDef.h"
-#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_TapeShaderDef.h"
-#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_FirstShaderDef.h"
-#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_SecondShaderDef.h"
-#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_ForthShaderDef.h"
-#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_ClearShaderDef.h"
-#include "RetroArch\vhs\shaders\VhsShadersVhs_and_crt_godotShaderDef.h"
-#include "RetroArch\vhs\shaders\VhsShadersVhs_fontShaderDef.h"
-#include "RetroArch\vhs\shaders\vhs_mpalko\VhsShadersVhs_mpalkoVhs_mpalko_pass0ShaderDef.h"
-#include "RetroArch\vhs\shaders\vhs_mpalko\VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef.h"
-#include "RetroArch\warp\shaders\WarpShadersDilationShaderDef.h"
-// %SHADER_INCLUDE%
-
-#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaAreaTexTextureDef.h"
-#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSearchTexTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutTrinitronLutTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutNecLutTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutNtscLutTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTube_Diffuse_2390x1792TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensDBTextureDef.h"
-#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensSpriteTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesBaked_Frame_Carbonfiber_BackgroundTextureDef.h"
-#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesBaked_Frame_Carbonfiber_Background_VertTextureDef.h"
-#include "RetroArch\bezel\uborder\textures\borders\BezelUborderTexturesBordersDefaultTextureDef.h"
-#include "RetroArch\border\textures\BorderTexturesTex11TextureDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64TextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64TextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingTextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbTextureDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaTextureDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgTextureDef.h"
-#include "RetroArch\border\textures\BorderTexturesPvmTextureDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbTextureDef.h"
-#include "RetroArch\border\sgba\BorderSgbaSgbaTextureDef.h"
-#include "RetroArch\crt\shaders\crt-consumer\CrtShadersCrtConsumerBezelTextureDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef.h"
-#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutTrinitronLutTextureDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutNecLutTextureDef.h"
-#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutNtscLutTextureDef.h"
-#include "RetroArch\crt\shaders\hyllian\support\LUT\CrtShadersHyllianSupportLUTSomeGradeTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeRgbTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeCompositeTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_bgTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1_lights_alphaTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_lights_alphaTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef.h"
-#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef.h"
-#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesMask1TextureDef.h"
-#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef.h"
-#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef.h"
-#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64BGRshiftedTextureDef.h"
-#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayShadowmask4x4TextureDef.h"
-#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef.h"
-#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6KVM1420BTextureDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimArtifactsTextureDef.h"
-#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimMaskTextureDef.h"
-#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesScanlineLUT4pxTextureDef.h"
-#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesTrinitron_colorTextureDef.h"
-#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef.h"
-#include "RetroArch\crt\shaders\mame_hlsl\resources\CrtShadersMame_hlslResourcesApertureGrilleTextureDef.h"
-#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtBasilicaTextureDef.h"
-#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtWoodgrainTextureDef.h"
-#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieCrtframeTextureDef.h"
-#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsShadowmaskTextureDef.h"
-#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsApertureGrilleTextureDef.h"
-#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsSlotmaskTextureDef.h"
-#include "RetroArch\dithering\shaders\blue-noise\DitheringShadersBlueNoiseLDR_RGB1_0TextureDef.h"
-#include "RetroArch\edge-smoothing\hqx\resources\EdgeSmoothingHqxResourcesHq2xTextureDef.h"
-#include "RetroArch\edge-smoothing\hqx\resources\EdgeSmoothingHqxResourcesHq3xTextureDef.h"
-#include "RetroArch\edge-smoothing\hqx\resources\EdgeSmoothingHqxResourcesHq4xTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTCmyk16TextureDef.h"
-#include "RetroArch\film\resources\FilmResourcesFilm_noise1TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT64TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutDsliteGreyTextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbaGrey1TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbaGrey2TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbcGrey1TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbcGrey2TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbamicroGreyTextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutNdsGreyTextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutPspGrey1TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutPspGrey2TextureDef.h"
-#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutSp101GreyTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesDmgPaletteTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesDmgBackgroundTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-bgs\HandheldShadersGameboyResourcesSampleBgsDmgBgTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-bgs\HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPocketPaletteTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPocketBackgroundTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef.h"
-#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPspBorderTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\HandheldShadersGameboyResourcesPaletteTextureDef.h"
-#include "RetroArch\handheld\shaders\gameboy\resources\HandheldShadersGameboyResourcesBackgroundTextureDef.h"
-#include "RetroArch\handheld\shaders\gb-palette\resources\HandheldShadersGbPaletteResourcesPaletteDmgTextureDef.h"
-#include "RetroArch\handheld\shaders\gb-palette\resources\HandheldShadersGbPaletteResourcesPaletteLightTextureDef.h"
-#include "RetroArch\handheld\shaders\gb-palette\resources\HandheldShadersGbPaletteResourcesPalettePocketTextureDef.h"
-#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderBackgroundTextureDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\png\4k\HandheldShadersSimpletex_lcdPng4kTextured_paperTextureDef.h"
-#include "RetroArch\handheld\shaders\simpletex_lcd\png\2k\HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT32TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT16TextureDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_80s_D65TextureDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_90s_D65TextureDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_J_D65TextureDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrinitronP22_D65TextureDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_J_D93TextureDef.h"
-#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrinitronP22_D93TextureDef.h"
-#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomNesTableTextureDef.h"
-#include "RetroArch\pal\resources\PalResourcesNes_lutTextureDef.h"
-#include "RetroArch\vhs\resources\VhsResourcesRewTextureDef.h"
-#include "RetroArch\vhs\resources\VhsResourcesPlayTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTNEC_XM29plus_captureTextureDef.h"
-#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTBsnesTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLite2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLite2020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA2020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBAP3DarkTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBAP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBAP3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA2020DarkTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBASRGBDarkTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBASRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBASRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA_GBC2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA_GBCP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCDevTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBC2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBC2020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCP3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCSRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicro2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDS2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDS2020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSP3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSSRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNSOGBATextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNSOGBCTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSP2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSP2020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPP3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPSRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP1012020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP1012020ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101P3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101P3ColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101SRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101SRGBColdTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDP3TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLED2020TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldVBA1TextureDef.h"
-#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldVBA2TextureDef.h"
-#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicBloom_DirtTextureDef.h"
-#include "RetroArch\reshade\shaders\NormalsDisplacement\ReshadeShadersNormalsDisplacementCurveNormalsTextureDef.h"
-#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrNoseTextureDef.h"
-// %TEXTURE_INCLUDE%
-
-#include "RetroArch\anamorphic\AnamorphicAnamorphicPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingAaShader40Level2PresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingAaShader40PresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingAdvancedAaPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingFxaaLinearPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingFxaaPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingReverseAaPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingSmaaLinearPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingSmaaSharpenPresetDef.h"
-#include "RetroArch\anti-aliasing\AntiAliasingSmaaPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVRESHADEFX__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSRESHADEFX__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYNOTUBEFX__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__EASYMODEPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMININTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMINIPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVNTSCPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__LCDGRIDPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_ADVGLASSPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_ADVNOREFLECTPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_ADVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_POTATOPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_SMOOTHADVGLASSPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_SMOOTHADVPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_STDGLASSPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_STDNOREFLECTPresetDef.h"
-#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_STDPresetDef.h"
-#include "RetroArch\bezel\uborder\BezelUborderAmbientLightCrtPresetDef.h"
-#include "RetroArch\bezel\uborder\BezelUborderUborderBezelReflectionsPresetDef.h"
-#include "RetroArch\stock\StockBilinearPresetDef.h"
-#include "RetroArch\blurs\BlursDual_filter_2_passPresetDef.h"
-#include "RetroArch\blurs\BlursDual_filter_4_passPresetDef.h"
-#include "RetroArch\blurs\BlursDual_filter_6_passPresetDef.h"
-#include "RetroArch\blurs\BlursDual_filter_bloomPresetDef.h"
-#include "RetroArch\blurs\BlursDual_filter_bloom_fastPresetDef.h"
-#include "RetroArch\blurs\BlursDual_filter_bloom_fastestPresetDef.h"
-#include "RetroArch\blurs\BlursGaussian_blurSharpPresetDef.h"
-#include "RetroArch\blurs\BlursGaussian_blurPresetDef.h"
-#include "RetroArch\blurs\BlursGaussian_blur_2_passSharpPresetDef.h"
-#include "RetroArch\blurs\BlursGaussian_blur_2_passPresetDef.h"
-#include "RetroArch\blurs\BlursGauss_4tapPresetDef.h"
-#include "RetroArch\blurs\BlursGizmoCompositeBlurPresetDef.h"
-#include "RetroArch\blurs\BlursKawase_blur_5passPresetDef.h"
-#include "RetroArch\blurs\BlursKawase_blur_9passPresetDef.h"
-#include "RetroArch\blurs\BlursKawase_glowPresetDef.h"
-#include "RetroArch\blurs\BlursSharpsmootherPresetDef.h"
-#include "RetroArch\blurs\BlursSmartBlurPresetDef.h"
-#include "RetroArch\border\BorderAmbientGlowPresetDef.h"
-#include "RetroArch\border\BorderAutocropKokoPresetDef.h"
-#include "RetroArch\border\BorderAverage_fillPresetDef.h"
-#include "RetroArch\border\BorderBigblurPresetDef.h"
-#include "RetroArch\border\BorderBlur_fillPresetDef.h"
-#include "RetroArch\border\BorderBlur_fill_stronger_blurPresetDef.h"
-#include "RetroArch\border\BorderBlur_fill_weaker_blurPresetDef.h"
-#include "RetroArch\border\BorderEffectBorderIqPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerCrtEasymodePresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerCrtGeom1xPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerCrtRoyalePresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerGbaColorCrtEasymodePresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerGbaColorPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutInterlacingPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutGbaColorInterlacingPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutGbaColorPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutPresetDef.h"
-#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbCrtConsumerPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbDotPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbLcdGridV2PresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaCrtConsumerPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaDotPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaLcdGridV2PresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgCrtConsumerPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgDotPresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgLcdGridV2PresetDef.h"
-#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgPresetDef.h"
-#include "RetroArch\border\BorderImgborderPresetDef.h"
-#include "RetroArch\border\BorderLightgunBorderPresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbCrtEasymodePresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbCrtGeom1xPresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbCrtRoyalePresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbGbcColorTvoutInterlacingPresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbGbcColorPresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbTvoutInterlacingPresetDef.h"
-#include "RetroArch\border\sgb\BorderSgbSgbPresetDef.h"
-#include "RetroArch\border\sgba\BorderSgbaSgbaGbaColorPresetDef.h"
-#include "RetroArch\border\sgba\BorderSgbaSgbaTvoutInterlacingPresetDef.h"
-#include "RetroArch\border\sgba\BorderSgbaSgbaTvoutGbaColorInterlacingPresetDef.h"
-#include "RetroArch\border\sgba\BorderSgbaSgbaPresetDef.h"
-#include "RetroArch\cel\CelAdvcartoonPresetDef.h"
-#include "RetroArch\cel\CelMMJ_Cel_ShaderPresetDef.h"
-#include "RetroArch\cel\CelMMJ_Cel_Shader_MPPresetDef.h"
-#include "RetroArch\crt\CrtAdvanced_crt_whkrmrgks0PresetDef.h"
-#include "RetroArch\crt\CrtCathodeRetro_noSignalPresetDef.h"
-#include "RetroArch\crt\CrtCrt1tapBloomPresetDef.h"
-#include "RetroArch\crt\CrtCrt1tapBloom_fastPresetDef.h"
-#include "RetroArch\crt\CrtCrt1tapPresetDef.h"
-#include "RetroArch\crt\CrtCrtAperturePresetDef.h"
-#include "RetroArch\crt\CrtCrtBlurPiSharpPresetDef.h"
-#include "RetroArch\crt\CrtCrtBlurPiSoftPresetDef.h"
-#include "RetroArch\crt\CrtCrtCaligariPresetDef.h"
-#include "RetroArch\crt\CrtCrtCgwgFastPresetDef.h"
-#include "RetroArch\crt\CrtCrtConsumerPresetDef.h"
-#include "RetroArch\crt\CrtCrtCyclonPresetDef.h"
-#include "RetroArch\crt\CrtCrtEasymodeHalationPresetDef.h"
-#include "RetroArch\crt\CrtCrtEasymodePresetDef.h"
-#include "RetroArch\crt\CrtCrtFrutbunnPresetDef.h"
-#include "RetroArch\crt\CrtCrtGdvMiniUltraTrinitronPresetDef.h"
-#include "RetroArch\crt\CrtCrtGdvMiniPresetDef.h"
-#include "RetroArch\crt\CrtCrtGeomDeluxePresetDef.h"
-#include "RetroArch\crt\CrtCrtGeomMiniPresetDef.h"
-#include "RetroArch\crt\CrtCrtGeomTatePresetDef.h"
-#include "RetroArch\crt\CrtCrtGeomPresetDef.h"
-#include "RetroArch\crt\CrtCrtGuestAdvancedFastPresetDef.h"
-#include "RetroArch\crt\CrtCrtGuestAdvancedFastestPresetDef.h"
-#include "RetroArch\crt\CrtCrtGuestAdvancedHdPresetDef.h"
-#include "RetroArch\crt\CrtCrtGuestAdvancedNtscPresetDef.h"
-#include "RetroArch\crt\CrtCrtGuestAdvancedPresetDef.h"
-#include "RetroArch\crt\CrtCrtHyllian3dPresetDef.h"
-#include "RetroArch\crt\CrtCrtHyllianFastPresetDef.h"
-#include "RetroArch\crt\CrtCrtHyllianNtscRainbowPresetDef.h"
-#include "RetroArch\crt\CrtCrtHyllianNtscPresetDef.h"
-#include "RetroArch\crt\CrtCrtHyllianSincCompositePresetDef.h"
-#include "RetroArch\crt\CrtCrtHyllianPresetDef.h"
-#include "RetroArch\crt\CrtCrtInterlacedHalationPresetDef.h"
-#include "RetroArch\crt\CrtCrtLottesFastPresetDef.h"
-#include "RetroArch\crt\CrtCrtLottesMultipassGlowPresetDef.h"
-#include "RetroArch\crt\CrtCrtLottesMultipassPresetDef.h"
-#include "RetroArch\crt\CrtCrtLottesPresetDef.h"
-#include "RetroArch\crt\CrtCrtMattiasPresetDef.h"
-#include "RetroArch\crt\CrtCrtMaximusRoyaleFastModePresetDef.h"
-#include "RetroArch\crt\CrtCrtMaximusRoyaleHalfResModePresetDef.h"
-#include "RetroArch\crt\CrtCrtMaximusRoyalePresetDef.h"
-#include "RetroArch\crt\CrtCrtNesMiniPresetDef.h"
-#include "RetroArch\crt\CrtCrtNobodyPresetDef.h"
-#include "RetroArch\crt\CrtCrtPiPresetDef.h"
-#include "RetroArch\crt\CrtCrtPocketPresetDef.h"
-#include "RetroArch\crt\CrtCrtPotatoBVMPresetDef.h"
-#include "RetroArch\crt\CrtCrtPotatoCoolPresetDef.h"
-#include "RetroArch\crt\CrtCrtPotatoWarmPresetDef.h"
-#include "RetroArch\crt\CrtCrtResswitchGlitchKokoPresetDef.h"
-#include "RetroArch\crt\CrtCrtRoyaleFakeBloomIntelPresetDef.h"
-#include "RetroArch\crt\CrtCrtRoyaleFakeBloomPresetDef.h"
-#include "RetroArch\crt\CrtCrtRoyaleFastPresetDef.h"
-#include "RetroArch\crt\CrtCrtRoyaleIntelPresetDef.h"
-#include "RetroArch\crt\CrtCrtRoyalePresetDef.h"
-#include "RetroArch\crt\CrtCrtSimplePresetDef.h"
-#include "RetroArch\crt\CrtCrtSinesPresetDef.h"
-#include "RetroArch\crt\CrtCrtSlangtestCubicPresetDef.h"
-#include "RetroArch\crt\CrtCrtSlangtestLanczosPresetDef.h"
-#include "RetroArch\crt\CrtCrtSuperXbrPresetDef.h"
-#include "RetroArch\crt\CrtCrtTorridgristlePresetDef.h"
-#include "RetroArch\crt\CrtCrtYo6FlatTrinitronTvPresetDef.h"
-#include "RetroArch\crt\CrtCrtYo6KV21CL10BPresetDef.h"
-#include "RetroArch\crt\CrtCrtYo6KVM1420BSharpPresetDef.h"
-#include "RetroArch\crt\CrtCrtYo6KVM1420BPresetDef.h"
-#include "RetroArch\crt\CrtCrtglow_gaussPresetDef.h"
-#include "RetroArch\crt\CrtCrtglow_lanczosPresetDef.h"
-#include "RetroArch\crt\CrtCrtsimPresetDef.h"
-#include "RetroArch\crt\CrtFakeCrtGeomPotatoPresetDef.h"
-#include "RetroArch\crt\CrtFakeCrtGeomPresetDef.h"
-#include "RetroArch\crt\CrtFakelottesPresetDef.h"
-#include "RetroArch\crt\CrtGizmoCrtPresetDef.h"
-#include "RetroArch\crt\CrtGizmoSlotmaskCrtPresetDef.h"
-#include "RetroArch\crt\CrtGlow_trailsPresetDef.h"
-#include "RetroArch\crt\CrtGritsScanlinesPresetDef.h"
-#include "RetroArch\crt\CrtGtuV050PresetDef.h"
-#include "RetroArch\crt\CrtMame_hlslPresetDef.h"
-#include "RetroArch\crt\CrtMetacrtPresetDef.h"
-#include "RetroArch\crt\CrtNewpixieCrtPresetDef.h"
-#include "RetroArch\crt\CrtNewpixieMiniPresetDef.h"
-#include "RetroArch\crt\CrtPhosphorlutPresetDef.h"
-#include "RetroArch\crt\CrtRay_traced_curvaturePresetDef.h"
-#include "RetroArch\crt\CrtRay_traced_curvature_appendPresetDef.h"
-#include "RetroArch\crt\CrtTvoutTweaksPresetDef.h"
-#include "RetroArch\crt\CrtVectorGlowAltRenderPresetDef.h"
-#include "RetroArch\crt\CrtVectorGlowPresetDef.h"
-#include "RetroArch\crt\CrtVt220PresetDef.h"
-#include "RetroArch\crt\CrtYee64PresetDef.h"
-#include "RetroArch\crt\CrtYeetronPresetDef.h"
-#include "RetroArch\crt\CrtZfastCrtCompositePresetDef.h"
-#include "RetroArch\crt\CrtZfastCrtCurvaturePresetDef.h"
-#include "RetroArch\crt\CrtZfastCrtGeoPresetDef.h"
-#include "RetroArch\crt\CrtZfastCrtHdmaskPresetDef.h"
-#include "RetroArch\crt\CrtZfastCrtPresetDef.h"
-#include "RetroArch\deblur\DeblurDeblurLumaPresetDef.h"
-#include "RetroArch\deblur\DeblurDeblurPresetDef.h"
-#include "RetroArch\denoisers\DenoisersBilateral2pPresetDef.h"
-#include "RetroArch\denoisers\DenoisersBilateralPresetDef.h"
-#include "RetroArch\denoisers\DenoisersCrtFastBilateralSuperXbrPresetDef.h"
-#include "RetroArch\denoisers\DenoisersFastBilateralPresetDef.h"
-#include "RetroArch\denoisers\DenoisersMedian_3x3PresetDef.h"
-#include "RetroArch\denoisers\DenoisersMedian_5x5PresetDef.h"
-#include "RetroArch\denoisers\DenoisersSlowBilateralPresetDef.h"
-#include "RetroArch\dithering\DitheringBayerMatrixDitheringPresetDef.h"
-#include "RetroArch\dithering\DitheringBayer_4x4PresetDef.h"
-#include "RetroArch\dithering\DitheringBlue_noisePresetDef.h"
-#include "RetroArch\dithering\DitheringBlue_noise_dynamic_4BitPresetDef.h"
-#include "RetroArch\dithering\DitheringBlue_noise_dynamic_monochromePresetDef.h"
-#include "RetroArch\dithering\DitheringCbod_v1PresetDef.h"
-#include "RetroArch\dithering\DitheringCheckerboardDeditherPresetDef.h"
-#include "RetroArch\dithering\DitheringGSharp_resamplerPresetDef.h"
-#include "RetroArch\dithering\DitheringGdaptPresetDef.h"
-#include "RetroArch\dithering\DitheringGenditherPresetDef.h"
-#include "RetroArch\dithering\DitheringJinc2DeditherPresetDef.h"
-#include "RetroArch\dithering\DitheringMdaptPresetDef.h"
-#include "RetroArch\dithering\DitheringPs1DeditherBoxblurPresetDef.h"
-#include "RetroArch\dithering\DitheringPs1DeditherComparisonPresetDef.h"
-#include "RetroArch\dithering\DitheringPs1DitherPresetDef.h"
-#include "RetroArch\dithering\DitheringSgenptMixMultipassPresetDef.h"
-#include "RetroArch\dithering\DitheringSgenptMixPresetDef.h"
-#include "RetroArch\edge-smoothing\cleanEdge\EdgeSmoothingCleanEdgeCleanEdgeScalePresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdt3PointPresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtCutPresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtExtendedPresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtJincLinearPresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtJincPresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtXbrLv1PresetDef.h"
-#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtPresetDef.h"
-#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagle2xsaiFixPixelShiftPresetDef.h"
-#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagle2xsaiPresetDef.h"
-#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagleSuper2xsaiFixPixelShiftPresetDef.h"
-#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagleSuper2xsaiPresetDef.h"
-#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagleSupereaglePresetDef.h"
-#include "RetroArch\edge-smoothing\fsr\EdgeSmoothingFsrFsrEasuPresetDef.h"
-#include "RetroArch\edge-smoothing\fsr\EdgeSmoothingFsrFsrPresetDef.h"
-#include "RetroArch\edge-smoothing\fsr\EdgeSmoothingFsrSmaaFsrPresetDef.h"
-#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq2xHalphonPresetDef.h"
-#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq2xPresetDef.h"
-#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq3xPresetDef.h"
-#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq4xPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediFastBilateralNediPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediHybridSharperPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediHybridPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediSharperPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariantPresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant2PresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant3PresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant4PresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant5PresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant6PresetDef.h"
-#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant7PresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns162xLumaPresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns162xRgbPresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns164xLumaPresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns322xRgbNns324xLumaPresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns324xRgbPresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns642xNns324xNns168xRgbPresetDef.h"
-#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns642xNns324xRgbPresetDef.h"
-#include "RetroArch\edge-smoothing\omniscale\EdgeSmoothingOmniscaleOmniscaleLegacyPresetDef.h"
-#include "RetroArch\edge-smoothing\omniscale\EdgeSmoothingOmniscaleOmniscalePresetDef.h"
-#include "RetroArch\edge-smoothing\sabr\EdgeSmoothingSabrSabrHybridDeposterizePresetDef.h"
-#include "RetroArch\edge-smoothing\sabr\EdgeSmoothingSabrSabrPresetDef.h"
-#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefxRAAPresetDef.h"
-#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefx9xPresetDef.h"
-#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefxHybridPresetDef.h"
-#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefxPresetDef.h"
-#include "RetroArch\edge-smoothing\scalehq\EdgeSmoothingScalehq2xScaleHQPresetDef.h"
-#include "RetroArch\edge-smoothing\scalehq\EdgeSmoothingScalehq4xScaleHQPresetDef.h"
-#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxEpxPresetDef.h"
-#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxMmpxPresetDef.h"
-#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale2xPresetDef.h"
-#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale2xplusPresetDef.h"
-#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale2xSFXPresetDef.h"
-#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale3xPresetDef.h"
-#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrSuperXbrFastPresetDef.h"
-#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrSuperXbrPresetDef.h"
-#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv2SharpPresetDef.h"
-#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv2PresetDef.h"
-#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv3SharpPresetDef.h"
-#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv3PresetDef.h"
-#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz2xbrzLinearPresetDef.h"
-#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz4xbrzLinearPresetDef.h"
-#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz5xbrzLinearPresetDef.h"
-#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz6xbrzLinearPresetDef.h"
-#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrzXbrzFreescaleMultipassPresetDef.h"
-#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrzXbrzFreescalePresetDef.h"
-#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal2xsalLevel2CrtPresetDef.h"
-#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal2xsalPresetDef.h"
-#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal4xsalLevel2CrtPresetDef.h"
-#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal4xsalLevel2HqPresetDef.h"
-#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal4xsalLevel2PresetDef.h"
-#include "RetroArch\edge-smoothing\xsoft\EdgeSmoothingXsoft4xsoftPresetDef.h"
-#include "RetroArch\edge-smoothing\xsoft\EdgeSmoothingXsoft4xsoftSdBPresetDef.h"
-#include "RetroArch\film\FilmFilmGrainPresetDef.h"
-#include "RetroArch\film\FilmTechnicolorPresetDef.h"
-#include "RetroArch\gpu\Gpu3dfx_4x1PresetDef.h"
-#include "RetroArch\gpu\GpuPowervr2PresetDef.h"
-#include "RetroArch\handheld\HandheldAgb001PresetDef.h"
-#include "RetroArch\handheld\HandheldAgs001PresetDef.h"
-#include "RetroArch\handheld\HandheldAuthentic_gbcPresetDef.h"
-#include "RetroArch\handheld\HandheldAuthentic_gbc_fastPresetDef.h"
-#include "RetroArch\handheld\HandheldAuthentic_gbc_single_passPresetDef.h"
-#include "RetroArch\handheld\HandheldBevelPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModDsliteColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModGbaColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModGbcColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModGbcGambatteColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModGbMicroColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModNdsColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModNSOGbaColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModNSOGbcColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModPalmColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModPspColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModSp101ColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModSwitchOLEDColorPresetDef.h"
-#include "RetroArch\handheld\color-mod\HandheldColorModVbaColorPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderDmgPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbDmgAltPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbLightAltPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbPocketAltPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbPocketPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaAgb001ColorMotionblurPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaAgs001ColorMotionblurPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaLcdGridV2PresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbcLcdGridV2PresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbcPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderGgPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderNgpcPresetDef.h"
-#include "RetroArch\handheld\console-border\HandheldConsoleBorderPspPresetDef.h"
-#include "RetroArch\handheld\HandheldDotPresetDef.h"
-#include "RetroArch\handheld\HandheldDsHybridSabrPresetDef.h"
-#include "RetroArch\handheld\HandheldDsHybridScalefxPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyAdvanceDotMatrixPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyColorDotMatrixWhiteBgPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyColorDotMatrixPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyDarkModePresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyLightModePresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyLightPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyPocketHighContrastPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyPocketPresetDef.h"
-#include "RetroArch\handheld\HandheldGameboyPresetDef.h"
-#include "RetroArch\handheld\HandheldGbPaletteDmgPresetDef.h"
-#include "RetroArch\handheld\HandheldGbPaletteLightPresetDef.h"
-#include "RetroArch\handheld\HandheldGbPalettePocketPresetDef.h"
-#include "RetroArch\handheld\HandheldGbcDevPresetDef.h"
-#include "RetroArch\handheld\HandheldLcdGridV2PresetDef.h"
-#include "RetroArch\handheld\HandheldLcdGridPresetDef.h"
-#include "RetroArch\handheld\HandheldLcdShaderPresetDef.h"
-#include "RetroArch\handheld\HandheldLcd1xPresetDef.h"
-#include "RetroArch\handheld\HandheldLcd1x_ndsPresetDef.h"
-#include "RetroArch\handheld\HandheldLcd1x_pspPresetDef.h"
-#include "RetroArch\handheld\HandheldLcd3xPresetDef.h"
-#include "RetroArch\handheld\HandheldRetroTilesPresetDef.h"
-#include "RetroArch\handheld\HandheldRetroV2PresetDef.h"
-#include "RetroArch\handheld\HandheldRetroV3PresetDef.h"
-#include "RetroArch\handheld\HandheldSameboyLcdPresetDef.h"
-#include "RetroArch\handheld\HandheldSimpletex_lcd4kPresetDef.h"
-#include "RetroArch\handheld\HandheldSimpletex_lcdPresetDef.h"
-#include "RetroArch\handheld\HandheldSimpletex_lcd_720pPresetDef.h"
-#include "RetroArch\handheld\HandheldZfastLcdPresetDef.h"
-#include "RetroArch\interpolation\InterpolationBSpline4TapsPresetDef.h"
-#include "RetroArch\interpolation\InterpolationBSplineFastPresetDef.h"
-#include "RetroArch\interpolation\InterpolationBicubic5TapsPresetDef.h"
-#include "RetroArch\interpolation\InterpolationBicubicFastPresetDef.h"
-#include "RetroArch\interpolation\InterpolationBicubicPresetDef.h"
-#include "RetroArch\interpolation\InterpolationCatmullRom5TapsPresetDef.h"
-#include "RetroArch\interpolation\InterpolationCatmullRomFastPresetDef.h"
-#include "RetroArch\interpolation\InterpolationCatmullRomPresetDef.h"
-#include "RetroArch\interpolation\InterpolationCubicGammaCorrectPresetDef.h"
-#include "RetroArch\interpolation\InterpolationCubicPresetDef.h"
-#include "RetroArch\interpolation\InterpolationHermitePresetDef.h"
-#include "RetroArch\interpolation\InterpolationJinc2SharpPresetDef.h"
-#include "RetroArch\interpolation\InterpolationJinc2SharperPresetDef.h"
-#include "RetroArch\interpolation\InterpolationJinc2PresetDef.h"
-#include "RetroArch\interpolation\InterpolationLanczos16PresetDef.h"
-#include "RetroArch\interpolation\InterpolationLanczos25TapsPresetDef.h"
-#include "RetroArch\interpolation\InterpolationLanczos3FastPresetDef.h"
-#include "RetroArch\interpolation\InterpolationQuilezPresetDef.h"
-#include "RetroArch\interpolation\InterpolationSpline16FastPresetDef.h"
-#include "RetroArch\interpolation\InterpolationSpline36FastPresetDef.h"
-#include "RetroArch\linear\LinearLinearGammaCorrectPresetDef.h"
-#include "RetroArch\misc\MiscAccessibility_modsPresetDef.h"
-#include "RetroArch\misc\MiscAntiFlickerPresetDef.h"
-#include "RetroArch\misc\MiscAsciiPresetDef.h"
-#include "RetroArch\misc\MiscBeadPresetDef.h"
-#include "RetroArch\misc\MiscBobDeinterlacingPresetDef.h"
-#include "RetroArch\misc\MiscChromaPresetDef.h"
-#include "RetroArch\misc\MiscChromaticityPresetDef.h"
-#include "RetroArch\misc\MiscCmykHalftoneDotPresetDef.h"
-#include "RetroArch\misc\MiscCocktailCabinetPresetDef.h"
-#include "RetroArch\misc\MiscColorManglerPresetDef.h"
-#include "RetroArch\misc\MiscColorimetryPresetDef.h"
-#include "RetroArch\misc\MiscConvergencePresetDef.h"
-#include "RetroArch\misc\MiscDebandPresetDef.h"
-#include "RetroArch\misc\MiscDeinterlacePresetDef.h"
-#include "RetroArch\misc\MiscEdgeDetectPresetDef.h"
-#include "RetroArch\misc\MiscEgaPresetDef.h"
-#include "RetroArch\misc\MiscGeomAppendPresetDef.h"
-#include "RetroArch\misc\MiscGeomPresetDef.h"
-#include "RetroArch\misc\MiscGlassPresetDef.h"
-#include "RetroArch\misc\MiscGradeNoLUTPresetDef.h"
-#include "RetroArch\misc\MiscGradePresetDef.h"
-#include "RetroArch\misc\MiscHalf_resPresetDef.h"
-#include "RetroArch\misc\MiscImageAdjustmentPresetDef.h"
-#include "RetroArch\misc\MiscImg_modPresetDef.h"
-#include "RetroArch\misc\MiscInterlacingPresetDef.h"
-#include "RetroArch\misc\MiscNaturalVisionPresetDef.h"
-#include "RetroArch\misc\MiscNightModePresetDef.h"
-#include "RetroArch\misc\MiscNtscColorsPresetDef.h"
-#include "RetroArch\misc\MiscPatchyColorPresetDef.h"
-#include "RetroArch\misc\MiscReliefPresetDef.h"
-#include "RetroArch\misc\MiscRetroPalettesPresetDef.h"
-#include "RetroArch\misc\MiscSimple_color_controlsPresetDef.h"
-#include "RetroArch\misc\MiscSsGammaRampPresetDef.h"
-#include "RetroArch\misc\MiscTonemappingPresetDef.h"
-#include "RetroArch\misc\MiscWhite_pointPresetDef.h"
-#include "RetroArch\misc\MiscYiqHueAdjustmentPresetDef.h"
-#include "RetroArch\motion-interpolation\MotionInterpolationMotion_interpolationPresetDef.h"
-#include "RetroArch\motionblur\MotionblurBraidRewindPresetDef.h"
-#include "RetroArch\motionblur\MotionblurFeedbackPresetDef.h"
-#include "RetroArch\motionblur\MotionblurMix_framesPresetDef.h"
-#include "RetroArch\motionblur\MotionblurMix_frames_smartPresetDef.h"
-#include "RetroArch\motionblur\MotionblurMotionblurBluePresetDef.h"
-#include "RetroArch\motionblur\MotionblurMotionblurColorPresetDef.h"
-#include "RetroArch\motionblur\MotionblurMotionblurSimplePresetDef.h"
-#include "RetroArch\motionblur\MotionblurResponseTimePresetDef.h"
-#include "RetroArch\stock\StockNearestPresetDef.h"
-#include "RetroArch\nes_raw_palette\Nes_raw_paletteCgwgFamicomGeomPresetDef.h"
-#include "RetroArch\nes_raw_palette\Nes_raw_paletteGtuFamicomPresetDef.h"
-#include "RetroArch\nes_raw_palette\Nes_raw_paletteNtscNesPresetDef.h"
-#include "RetroArch\nes_raw_palette\Nes_raw_palettePalR57shellRawPresetDef.h"
-#include "RetroArch\ntsc\NtscArtifactColorsPresetDef.h"
-#include "RetroArch\ntsc\NtscBlarggPresetDef.h"
-#include "RetroArch\ntsc\NtscMameNtscPresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc256pxCompositeScanlinePresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc256pxCompositePresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc256pxSvideoScanlinePresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc256pxSvideoPresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc320pxCompositeScanlinePresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc320pxCompositePresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc320pxSvideoScanlinePresetDef.h"
-#include "RetroArch\ntsc\NtscNtsc320pxSvideoPresetDef.h"
-#include "RetroArch\ntsc\NtscNtscAdaptive4xPresetDef.h"
-#include "RetroArch\ntsc\NtscNtscAdaptiveOldPresetDef.h"
-#include "RetroArch\ntsc\NtscNtscAdaptiveTatePresetDef.h"
-#include "RetroArch\ntsc\NtscNtscAdaptivePresetDef.h"
-#include "RetroArch\ntsc\NtscNtscBlastemPresetDef.h"
-#include "RetroArch\ntsc\NtscNtscMdRainbowsPresetDef.h"
-#include "RetroArch\ntsc\NtscNtscMiniPresetDef.h"
-#include "RetroArch\ntsc\NtscNtscSimplePresetDef.h"
-#include "RetroArch\ntsc\NtscTiny_ntscPresetDef.h"
-#include "RetroArch\pal\PalPalR57shellMoireOnlyPresetDef.h"
-#include "RetroArch\pal\PalPalR57shellPresetDef.h"
-#include "RetroArch\pal\PalPalSinglepassPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingAannPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingBandlimitPixelPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingBilinearAdjustablePresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingBox_filter_aa_xformPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingCleanEdgeRotatePresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingControlled_sharpnessPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingEdge1pixelPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingEdgeNpixelsPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingGridBlendHybridPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingPixellatePresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aaPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aa_fastPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aa_single_passPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aa_xformPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinear2xPrescalePresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinearScanlinesPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinearSimplePresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinearPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpShimmerlessPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSmootheststepPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingSmuberstepPresetDef.h"
-#include "RetroArch\pixel-art-scaling\PixelArtScalingUniformNearestPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursDualBloomFilterAaLv2FsrGammaRampGlassPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursDualBloomFilterAaLv2FsrGammaRampPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursDualBloomFilterAaLv2FsrPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampGsharpResamplerPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrGsharpResamplerPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursKawaseGlowBspline4tapsFsrGammaRampTonemappingPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursSmartblurBspline4tapsFsrGammaRampVhsPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursSmartblurBspline4tapsFsrGammaRampPresetDef.h"
-#include "RetroArch\presets\blurs\PresetsBlursSmartblurBspline4tapsFsrPresetDef.h"
-#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrColorManglerColorimetryPresetDef.h"
-#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrPresetDef.h"
-#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorCrtroyaleNtscSvideoPresetDef.h"
-#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyaleNtscSvideoPresetDef.h"
-#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyalePresetDef.h"
-#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorNnedi3Nns164xLumaFsrCrtroyalePresetDef.h"
-#include "RetroArch\presets\PresetsCrtGeomSimplePresetDef.h"
-#include "RetroArch\presets\PresetsCrtHyllianSincSmartblurSgenptPresetDef.h"
-#include "RetroArch\presets\PresetsCrtHyllianSmartblurSgenptPresetDef.h"
-#include "RetroArch\presets\PresetsCrtLottesMultipassInterlacedGlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpCompositeGlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpCompositePresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x4GlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x4PresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x5GlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x5PresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x6GlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x6PresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateCompositeGlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateCompositePresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x4GlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x4PresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x5GlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x5PresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x6GlowPresetDef.h"
-#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x6PresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalC64MonitorPresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtGeomDeluxeNtscAdaptivePresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyaleFastNtscCompositePresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyaleNtscCompositePresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyaleNtscSvideoPresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyalePalR57shellPresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtglow_gauss_ntscPresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalMy_old_tvPresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalNtscPhosphorlutPresetDef.h"
-#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalNtsclutPhosphorlutPresetDef.h"
-#include "RetroArch\presets\crt-potato\PresetsCrtPotatoCrtPotatoColorimetryConvergencePresetDef.h"
-#include "RetroArch\presets\PresetsCrtRoyaleDownsamplePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePsxPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureSnesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscRfSlotmaskNesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastRgbAperturePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastRgbSlotPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePsxPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeSnesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmRgbBlendPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmRgbShmupPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmRgbPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePsxPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureSnesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscRfSlotmaskNesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastRgbAperturePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastRgbSlotPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePsxPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeSnesPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmRgbBlendPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmRgbShmupPresetDef.h"
-#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmRgbPresetDef.h"
-#include "RetroArch\presets\PresetsCrtRoyaleKurozumiPresetDef.h"
-#include "RetroArch\presets\PresetsCrtRoyaleSmoothPresetDef.h"
-#include "RetroArch\presets\PresetsCrtRoyaleXm29plusPresetDef.h"
-#include "RetroArch\presets\PresetsCrtsimGrungyPresetDef.h"
-#include "RetroArch\presets\downsample\PresetsDownsampleDrez8xFsrAaLv2Bspline4tapsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Bspline4tapsNtscColorsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Bspline4tapsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2DeblurPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2GlassPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Kawase5blurNtscColorsGlassPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Kawase5blurNtscColorsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3GlassPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3NtscColorsGlassPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3NtscColorsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3PresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2NaturalvisionGlassPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2NaturalvisionVhsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2NaturalvisionPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2SabrHybridDeposterizePresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2VhsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2PresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoBvmVhsPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoBvmPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoColorimetryConvergencePresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoWarmColorimetryConvergencePresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrCrtroyaleXm29plusPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrCrtroyalePresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrLv2AaChromacityGlassPresetDef.h"
-#include "RetroArch\presets\fsr\PresetsFsrFsrSmaaColorimetryConvergencePresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtCurvatorPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtMegadriveCurvatorPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtMegadrivePresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtN64CurvatorPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtN64PresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtPsxCurvatorPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtPsxPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnes4kPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnesCurvator4kPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnesDarkCurvatorPresetDef.h"
-#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnesDarkPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModAgb001GbaColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModAgs001GbaColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModBandlimitPixelGbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2DsliteColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2DsliteColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbaColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbcColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbcColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbMicroColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbMicroColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2NdsColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2NdsColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PalmColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PalmColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PspColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PspColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2Sp101ColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2Sp101ColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2VbaColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2VbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2GbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2GbcColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2ImageAdjustmentPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2NdsColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2PspColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2VbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV3NdsColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSameboyLcdGbcColorMotionblurPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbaColor4kPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbcColor4kPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbcColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcd_720pGbaColorPresetDef.h"
-#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcd_720pGbcColorPresetDef.h"
-#include "RetroArch\presets\PresetsImgborderRoyaleKurozumiPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2FsrGammaRampPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2FsrPowervrPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2FsrPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2PresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsFsrVhsPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationLanczos25tapsFsrGammaRampVhsPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationLanczos25tapsFsrGammaRampPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationLanczos25tapsFsrPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationSpline36FastFsrGammaRampVhsPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationSpline36FastFsrGammaRampPresetDef.h"
-#include "RetroArch\presets\interpolation\PresetsInterpolationSpline36FastFsrPresetDef.h"
-#include "RetroArch\presets\PresetsMdaptFastBilateralSuper4xbrScanlinesPresetDef.h"
-#include "RetroArch\presets\PresetsNediPowervrSharpenPresetDef.h"
-#include "RetroArch\presets\PresetsNesColorDecoderColorimetryPixellatePresetDef.h"
-#include "RetroArch\presets\PresetsNesColorDecoderPixellatePresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxRAAAaFastPresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxRAAAaPresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxAaFastPresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxAaPresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefx9AaBlurHazyNtscSh1nra358PresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefx9AaBlurHazyVibranceSh1nra358PresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaSharpsmootherPresetDef.h"
-#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNesColorDecoderPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc256pxCompositePresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc256pxSvideoPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc2phaseCompositePresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc2phaseSvideoPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc320pxCompositePresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc320pxSvideoPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc3phaseCompositePresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc3phaseSvideoPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtscNesPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutSnesHiresBlendPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutJincSharpenPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutPixelsharpPresetDef.h"
-#include "RetroArch\presets\tvout\PresetsTvoutTvoutPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNesColorDecoderInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc256pxCompositeInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc256pxSvideoInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc2phaseCompositeInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc2phaseSvideoInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc320pxCompositeInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc320pxSvideoInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc3phaseCompositeInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc3phaseSvideoInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtscNesInterlacingPresetDef.h"
-#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutJincSharpenInterlacingPresetDef.h"
-#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv32xsalLv2AaSoftPresetDef.h"
-#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv32xsalLv2AaPresetDef.h"
-#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv3AaFastPresetDef.h"
-#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv3AaSoftFastPresetDef.h"
-#include "RetroArch\reshade\ReshadeBlendoverlayPresetDef.h"
-#include "RetroArch\reshade\ReshadeBloomPresetDef.h"
-#include "RetroArch\reshade\ReshadeBsnesGammaRampPresetDef.h"
-#include "RetroArch\reshade\ReshadeFilmGrainPresetDef.h"
-#include "RetroArch\reshade\ReshadeHalftonePrintPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsDSLite2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsDSLiteP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsDSLiteSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBAP3DarkPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBAP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBARec2020DarkPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBARec2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBASRGBDarkPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBASRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA_GBC2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA_GBCP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA_GBCSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCDevColorspacePresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBC2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCRec2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBMicro2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBMicroP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBMicroSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDS2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDSP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDSRec2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDSSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNSOGBAPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNSOGBCPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSP2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPP3PureGamma22PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPRec2020SRGBGamma22PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPRec2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPSRGBSRGBGamma22PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSP1012020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSP101P3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSP101SRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDP3SRGBGamma22PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDRec2020SRGBGamma22PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDRec2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDSRGBSRGBGamma22PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSWOLED2020PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSWOLEDP3PresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSWOLEDSRGBPresetDef.h"
-#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsVBAColorspacePresetDef.h"
-#include "RetroArch\reshade\ReshadeLutPresetDef.h"
-#include "RetroArch\reshade\ReshadeMagicbloomPresetDef.h"
-#include "RetroArch\reshade\ReshadeNormalsDisplacementPresetDef.h"
-#include "RetroArch\scanlines\ScanlinesIntegerScalingScanlinesPresetDef.h"
-#include "RetroArch\scanlines\ScanlinesOsscPresetDef.h"
-#include "RetroArch\scanlines\ScanlinesOssc_slotPresetDef.h"
-#include "RetroArch\scanlines\ScanlinesResIndependentScanlinesPresetDef.h"
-#include "RetroArch\scanlines\ScanlinesScanlineFractPresetDef.h"
-#include "RetroArch\scanlines\ScanlinesScanlinePresetDef.h"
-#include "RetroArch\scanlines\ScanlinesScanlinesRerePresetDef.h"
-#include "RetroArch\scanlines\ScanlinesScanlinesSineAbsPresetDef.h"
-#include "RetroArch\sharpen\SharpenAdaptiveSharpenMultipassPresetDef.h"
-#include "RetroArch\sharpen\SharpenAdaptiveSharpenPresetDef.h"
-#include "RetroArch\sharpen\SharpenAnime4kPresetDef.h"
-#include "RetroArch\sharpen\SharpenCheapSharpenPresetDef.h"
-#include "RetroArch\sharpen\SharpenRca_sharpenPresetDef.h"
-#include "RetroArch\sharpen\SharpenSuperXbrSuperResPresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dAnaglyphToSideBySidePresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dFubax_vrPresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dShutterToAnaglyphPresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dShutterToSideBySidePresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dSideBySideSimplePresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dSideBySideToInterlacedPresetDef.h"
-#include "RetroArch\stereoscopic-3d\Stereoscopic3dSideBySideToShutterPresetDef.h"
-#include "RetroArch\vhs\VhsGristleVHSPresetDef.h"
-#include "RetroArch\vhs\VhsMudlordPalVhsPresetDef.h"
-#include "RetroArch\vhs\VhsNtscVcrPresetDef.h"
-#include "RetroArch\vhs\VhsVhsPresetDef.h"
-#include "RetroArch\vhs\VhsVHSProPresetDef.h"
-#include "RetroArch\vhs\VhsVhs_and_crt_godotPresetDef.h"
-#include "RetroArch\vhs\VhsVhs_mpalkoPresetDef.h"
-#include "RetroArch\warp\WarpDilationPresetDef.h"
-// %PRESET_INCLUDE%
+#include <algorithm>
 
 namespace RetroArch
 {
-const static std::vector<PresetDef*> PresetList = {
-new AnamorphicAnamorphicPresetDef(),
-new AntiAliasingAaShader40Level2PresetDef(),
-new AntiAliasingAaShader40PresetDef(),
-new AntiAliasingAdvancedAaPresetDef(),
-new AntiAliasingFxaaLinearPresetDef(),
-new AntiAliasingFxaaPresetDef(),
-new AntiAliasingReverseAaPresetDef(),
-new AntiAliasingSmaaLinearPresetDef(),
-new AntiAliasingSmaaSharpenPresetDef(),
-new AntiAliasingSmaaPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVRESHADEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSRESHADEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYNOTUBEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__EASYMODEPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMININTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMINIPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVNTSCPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVPresetDef(),
-new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__LCDGRIDPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_ADVGLASSPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_ADVNOREFLECTPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_ADVPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_POTATOPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_SMOOTHADVGLASSPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_SMOOTHADVPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_STDGLASSPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_STDNOREFLECTPresetDef(),
-new BezelMega_BezelPresetsMegaBezel_STDPresetDef(),
-new BezelUborderAmbientLightCrtPresetDef(),
-new BezelUborderUborderBezelReflectionsPresetDef(),
-new StockBilinearPresetDef(),
-new BlursDual_filter_2_passPresetDef(),
-new BlursDual_filter_4_passPresetDef(),
-new BlursDual_filter_6_passPresetDef(),
-new BlursDual_filter_bloomPresetDef(),
-new BlursDual_filter_bloom_fastPresetDef(),
-new BlursDual_filter_bloom_fastestPresetDef(),
-new BlursGaussian_blurSharpPresetDef(),
-new BlursGaussian_blurPresetDef(),
-new BlursGaussian_blur_2_passSharpPresetDef(),
-new BlursGaussian_blur_2_passPresetDef(),
-new BlursGauss_4tapPresetDef(),
-new BlursGizmoCompositeBlurPresetDef(),
-new BlursKawase_blur_5passPresetDef(),
-new BlursKawase_blur_9passPresetDef(),
-new BlursKawase_glowPresetDef(),
-new BlursSharpsmootherPresetDef(),
-new BlursSmartBlurPresetDef(),
-new BorderAmbientGlowPresetDef(),
-new BorderAutocropKokoPresetDef(),
-new BorderAverage_fillPresetDef(),
-new BorderBigblurPresetDef(),
-new BorderBlur_fillPresetDef(),
-new BorderBlur_fill_stronger_blurPresetDef(),
-new BorderBlur_fill_weaker_blurPresetDef(),
-new BorderEffectBorderIqPresetDef(),
-new BorderGameboyPlayerGameboyPlayerCrtEasymodePresetDef(),
-new BorderGameboyPlayerGameboyPlayerCrtGeom1xPresetDef(),
-new BorderGameboyPlayerGameboyPlayerCrtRoyalePresetDef(),
-new BorderGameboyPlayerGameboyPlayerGbaColorCrtEasymodePresetDef(),
-new BorderGameboyPlayerGameboyPlayerGbaColorPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutInterlacingPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutGbaColorInterlacingPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutGbaColorPresetDef(),
-new BorderGameboyPlayerGameboyPlayerTvoutPresetDef(),
-new BorderGameboyPlayerGameboyPlayerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbCrtConsumerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbDotPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbLcdGridV2PresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaCrtConsumerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaDotPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaLcdGridV2PresetDef(),
-new BorderHandheldNebulaHandheldNebulaGbaPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgCrtConsumerPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgDotPresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgLcdGridV2PresetDef(),
-new BorderHandheldNebulaHandheldNebulaGgPresetDef(),
-new BorderImgborderPresetDef(),
-new BorderLightgunBorderPresetDef(),
-new BorderSgbSgbCrtEasymodePresetDef(),
-new BorderSgbSgbCrtGeom1xPresetDef(),
-new BorderSgbSgbCrtRoyalePresetDef(),
-new BorderSgbSgbGbcColorTvoutInterlacingPresetDef(),
-new BorderSgbSgbGbcColorPresetDef(),
-new BorderSgbSgbTvoutInterlacingPresetDef(),
-new BorderSgbSgbPresetDef(),
-new BorderSgbaSgbaGbaColorPresetDef(),
-new BorderSgbaSgbaTvoutInterlacingPresetDef(),
-new BorderSgbaSgbaTvoutGbaColorInterlacingPresetDef(),
-new BorderSgbaSgbaPresetDef(),
-new CelAdvcartoonPresetDef(),
-new CelMMJ_Cel_ShaderPresetDef(),
-new CelMMJ_Cel_Shader_MPPresetDef(),
-new CrtAdvanced_crt_whkrmrgks0PresetDef(),
-new CrtCathodeRetro_noSignalPresetDef(),
-new CrtCrt1tapBloomPresetDef(),
-new CrtCrt1tapBloom_fastPresetDef(),
-new CrtCrt1tapPresetDef(),
-new CrtCrtAperturePresetDef(),
-new CrtCrtBlurPiSharpPresetDef(),
-new CrtCrtBlurPiSoftPresetDef(),
-new CrtCrtCaligariPresetDef(),
-new CrtCrtCgwgFastPresetDef(),
-new CrtCrtConsumerPresetDef(),
-new CrtCrtCyclonPresetDef(),
-new CrtCrtEasymodeHalationPresetDef(),
-new CrtCrtEasymodePresetDef(),
-new CrtCrtFrutbunnPresetDef(),
-new CrtCrtGdvMiniUltraTrinitronPresetDef(),
-new CrtCrtGdvMiniPresetDef(),
-new CrtCrtGeomDeluxePresetDef(),
-new CrtCrtGeomMiniPresetDef(),
-new CrtCrtGeomTatePresetDef(),
-new CrtCrtGeomPresetDef(),
-new CrtCrtGuestAdvancedFastPresetDef(),
-new CrtCrtGuestAdvancedFastestPresetDef(),
-new CrtCrtGuestAdvancedHdPresetDef(),
-new CrtCrtGuestAdvancedNtscPresetDef(),
-new CrtCrtGuestAdvancedPresetDef(),
-new CrtCrtHyllian3dPresetDef(),
-new CrtCrtHyllianFastPresetDef(),
-new CrtCrtHyllianNtscRainbowPresetDef(),
-new CrtCrtHyllianNtscPresetDef(),
-new CrtCrtHyllianSincCompositePresetDef(),
-new CrtCrtHyllianPresetDef(),
-new CrtCrtInterlacedHalationPresetDef(),
-new CrtCrtLottesFastPresetDef(),
-new CrtCrtLottesMultipassGlowPresetDef(),
-new CrtCrtLottesMultipassPresetDef(),
-new CrtCrtLottesPresetDef(),
-new CrtCrtMattiasPresetDef(),
-new CrtCrtMaximusRoyaleFastModePresetDef(),
-new CrtCrtMaximusRoyaleHalfResModePresetDef(),
-new CrtCrtMaximusRoyalePresetDef(),
-new CrtCrtNesMiniPresetDef(),
-new CrtCrtNobodyPresetDef(),
-new CrtCrtPiPresetDef(),
-new CrtCrtPocketPresetDef(),
-new CrtCrtPotatoBVMPresetDef(),
-new CrtCrtPotatoCoolPresetDef(),
-new CrtCrtPotatoWarmPresetDef(),
-new CrtCrtResswitchGlitchKokoPresetDef(),
-new CrtCrtRoyaleFakeBloomIntelPresetDef(),
-new CrtCrtRoyaleFakeBloomPresetDef(),
-new CrtCrtRoyaleFastPresetDef(),
-new CrtCrtRoyaleIntelPresetDef(),
-new CrtCrtRoyalePresetDef(),
-new CrtCrtSimplePresetDef(),
-new CrtCrtSinesPresetDef(),
-new CrtCrtSlangtestCubicPresetDef(),
-new CrtCrtSlangtestLanczosPresetDef(),
-new CrtCrtSuperXbrPresetDef(),
-new CrtCrtTorridgristlePresetDef(),
-new CrtCrtYo6FlatTrinitronTvPresetDef(),
-new CrtCrtYo6KV21CL10BPresetDef(),
-new CrtCrtYo6KVM1420BSharpPresetDef(),
-new CrtCrtYo6KVM1420BPresetDef(),
-new CrtCrtglow_gaussPresetDef(),
-new CrtCrtglow_lanczosPresetDef(),
-new CrtCrtsimPresetDef(),
-new CrtFakeCrtGeomPotatoPresetDef(),
-new CrtFakeCrtGeomPresetDef(),
-new CrtFakelottesPresetDef(),
-new CrtGizmoCrtPresetDef(),
-new CrtGizmoSlotmaskCrtPresetDef(),
-new CrtGlow_trailsPresetDef(),
-new CrtGritsScanlinesPresetDef(),
-new CrtGtuV050PresetDef(),
-new CrtMame_hlslPresetDef(),
-new CrtMetacrtPresetDef(),
-new CrtNewpixieCrtPresetDef(),
-new CrtNewpixieMiniPresetDef(),
-new CrtPhosphorlutPresetDef(),
-new CrtRay_traced_curvaturePresetDef(),
-new CrtRay_traced_curvature_appendPresetDef(),
-new CrtTvoutTweaksPresetDef(),
-new CrtVectorGlowAltRenderPresetDef(),
-new CrtVectorGlowPresetDef(),
-new CrtVt220PresetDef(),
-new CrtYee64PresetDef(),
-new CrtYeetronPresetDef(),
-new CrtZfastCrtCompositePresetDef(),
-new CrtZfastCrtCurvaturePresetDef(),
-new CrtZfastCrtGeoPresetDef(),
-new CrtZfastCrtHdmaskPresetDef(),
-new CrtZfastCrtPresetDef(),
-new DeblurDeblurLumaPresetDef(),
-new DeblurDeblurPresetDef(),
-new DenoisersBilateral2pPresetDef(),
-new DenoisersBilateralPresetDef(),
-new DenoisersCrtFastBilateralSuperXbrPresetDef(),
-new DenoisersFastBilateralPresetDef(),
-new DenoisersMedian_3x3PresetDef(),
-new DenoisersMedian_5x5PresetDef(),
-new DenoisersSlowBilateralPresetDef(),
-new DitheringBayerMatrixDitheringPresetDef(),
-new DitheringBayer_4x4PresetDef(),
-new DitheringBlue_noisePresetDef(),
-new DitheringBlue_noise_dynamic_4BitPresetDef(),
-new DitheringBlue_noise_dynamic_monochromePresetDef(),
-new DitheringCbod_v1PresetDef(),
-new DitheringCheckerboardDeditherPresetDef(),
-new DitheringGSharp_resamplerPresetDef(),
-new DitheringGdaptPresetDef(),
-new DitheringGenditherPresetDef(),
-new DitheringJinc2DeditherPresetDef(),
-new DitheringMdaptPresetDef(),
-new DitheringPs1DeditherBoxblurPresetDef(),
-new DitheringPs1DeditherComparisonPresetDef(),
-new DitheringPs1DitherPresetDef(),
-new DitheringSgenptMixMultipassPresetDef(),
-new DitheringSgenptMixPresetDef(),
-new EdgeSmoothingCleanEdgeCleanEdgeScalePresetDef(),
-new EdgeSmoothingDdt3PointPresetDef(),
-new EdgeSmoothingDdtCutPresetDef(),
-new EdgeSmoothingDdtDdtExtendedPresetDef(),
-new EdgeSmoothingDdtDdtJincLinearPresetDef(),
-new EdgeSmoothingDdtDdtJincPresetDef(),
-new EdgeSmoothingDdtDdtXbrLv1PresetDef(),
-new EdgeSmoothingDdtDdtPresetDef(),
-new EdgeSmoothingEagle2xsaiFixPixelShiftPresetDef(),
-new EdgeSmoothingEagle2xsaiPresetDef(),
-new EdgeSmoothingEagleSuper2xsaiFixPixelShiftPresetDef(),
-new EdgeSmoothingEagleSuper2xsaiPresetDef(),
-new EdgeSmoothingEagleSupereaglePresetDef(),
-new EdgeSmoothingFsrFsrEasuPresetDef(),
-new EdgeSmoothingFsrFsrPresetDef(),
-new EdgeSmoothingFsrSmaaFsrPresetDef(),
-new EdgeSmoothingHqxHq2xHalphonPresetDef(),
-new EdgeSmoothingHqxHq2xPresetDef(),
-new EdgeSmoothingHqxHq3xPresetDef(),
-new EdgeSmoothingHqxHq4xPresetDef(),
-new EdgeSmoothingNediFastBilateralNediPresetDef(),
-new EdgeSmoothingNediNediHybridSharperPresetDef(),
-new EdgeSmoothingNediNediHybridPresetDef(),
-new EdgeSmoothingNediNediSharperPresetDef(),
-new EdgeSmoothingNediNediPresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariantPresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant2PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant3PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant4PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant5PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant6PresetDef(),
-new EdgeSmoothingNediPresetsBilateralVariant7PresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns162xLumaPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns162xRgbPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns164xLumaPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns322xRgbNns324xLumaPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns324xRgbPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns642xNns324xNns168xRgbPresetDef(),
-new EdgeSmoothingNnedi3Nnedi3Nns642xNns324xRgbPresetDef(),
-new EdgeSmoothingOmniscaleOmniscaleLegacyPresetDef(),
-new EdgeSmoothingOmniscaleOmniscalePresetDef(),
-new EdgeSmoothingSabrSabrHybridDeposterizePresetDef(),
-new EdgeSmoothingSabrSabrPresetDef(),
-new EdgeSmoothingScalefxScalefxRAAPresetDef(),
-new EdgeSmoothingScalefxScalefx9xPresetDef(),
-new EdgeSmoothingScalefxScalefxHybridPresetDef(),
-new EdgeSmoothingScalefxScalefxPresetDef(),
-new EdgeSmoothingScalehq2xScaleHQPresetDef(),
-new EdgeSmoothingScalehq4xScaleHQPresetDef(),
-new EdgeSmoothingScalenxEpxPresetDef(),
-new EdgeSmoothingScalenxMmpxPresetDef(),
-new EdgeSmoothingScalenxScale2xPresetDef(),
-new EdgeSmoothingScalenxScale2xplusPresetDef(),
-new EdgeSmoothingScalenxScale2xSFXPresetDef(),
-new EdgeSmoothingScalenxScale3xPresetDef(),
-new EdgeSmoothingXbrSuperXbrFastPresetDef(),
-new EdgeSmoothingXbrSuperXbrPresetDef(),
-new EdgeSmoothingXbrXbrLv2SharpPresetDef(),
-new EdgeSmoothingXbrXbrLv2PresetDef(),
-new EdgeSmoothingXbrXbrLv3SharpPresetDef(),
-new EdgeSmoothingXbrXbrLv3PresetDef(),
-new EdgeSmoothingXbrz2xbrzLinearPresetDef(),
-new EdgeSmoothingXbrz4xbrzLinearPresetDef(),
-new EdgeSmoothingXbrz5xbrzLinearPresetDef(),
-new EdgeSmoothingXbrz6xbrzLinearPresetDef(),
-new EdgeSmoothingXbrzXbrzFreescaleMultipassPresetDef(),
-new EdgeSmoothingXbrzXbrzFreescalePresetDef(),
-new EdgeSmoothingXsal2xsalLevel2CrtPresetDef(),
-new EdgeSmoothingXsal2xsalPresetDef(),
-new EdgeSmoothingXsal4xsalLevel2CrtPresetDef(),
-new EdgeSmoothingXsal4xsalLevel2HqPresetDef(),
-new EdgeSmoothingXsal4xsalLevel2PresetDef(),
-new EdgeSmoothingXsoft4xsoftPresetDef(),
-new EdgeSmoothingXsoft4xsoftSdBPresetDef(),
-new FilmFilmGrainPresetDef(),
-new FilmTechnicolorPresetDef(),
-new Gpu3dfx_4x1PresetDef(),
-new GpuPowervr2PresetDef(),
-new HandheldAgb001PresetDef(),
-new HandheldAgs001PresetDef(),
-new HandheldAuthentic_gbcPresetDef(),
-new HandheldAuthentic_gbc_fastPresetDef(),
-new HandheldAuthentic_gbc_single_passPresetDef(),
-new HandheldBevelPresetDef(),
-new HandheldColorModDsliteColorPresetDef(),
-new HandheldColorModGbaColorPresetDef(),
-new HandheldColorModGbcColorPresetDef(),
-new HandheldColorModGbcGambatteColorPresetDef(),
-new HandheldColorModGbMicroColorPresetDef(),
-new HandheldColorModNdsColorPresetDef(),
-new HandheldColorModNSOGbaColorPresetDef(),
-new HandheldColorModNSOGbcColorPresetDef(),
-new HandheldColorModPalmColorPresetDef(),
-new HandheldColorModPspColorPresetDef(),
-new HandheldColorModSp101ColorPresetDef(),
-new HandheldColorModSwitchOLEDColorPresetDef(),
-new HandheldColorModVbaColorPresetDef(),
-new HandheldConsoleBorderDmgPresetDef(),
-new HandheldConsoleBorderGbDmgAltPresetDef(),
-new HandheldConsoleBorderGbLightAltPresetDef(),
-new HandheldConsoleBorderGbPocketAltPresetDef(),
-new HandheldConsoleBorderGbPocketPresetDef(),
-new HandheldConsoleBorderGbaAgb001ColorMotionblurPresetDef(),
-new HandheldConsoleBorderGbaAgs001ColorMotionblurPresetDef(),
-new HandheldConsoleBorderGbaLcdGridV2PresetDef(),
-new HandheldConsoleBorderGbaPresetDef(),
-new HandheldConsoleBorderGbcLcdGridV2PresetDef(),
-new HandheldConsoleBorderGbcPresetDef(),
-new HandheldConsoleBorderGgPresetDef(),
-new HandheldConsoleBorderNgpcPresetDef(),
-new HandheldConsoleBorderPspPresetDef(),
-new HandheldDotPresetDef(),
-new HandheldDsHybridSabrPresetDef(),
-new HandheldDsHybridScalefxPresetDef(),
-new HandheldGameboyAdvanceDotMatrixPresetDef(),
-new HandheldGameboyColorDotMatrixWhiteBgPresetDef(),
-new HandheldGameboyColorDotMatrixPresetDef(),
-new HandheldGameboyDarkModePresetDef(),
-new HandheldGameboyLightModePresetDef(),
-new HandheldGameboyLightPresetDef(),
-new HandheldGameboyPocketHighContrastPresetDef(),
-new HandheldGameboyPocketPresetDef(),
-new HandheldGameboyPresetDef(),
-new HandheldGbPaletteDmgPresetDef(),
-new HandheldGbPaletteLightPresetDef(),
-new HandheldGbPalettePocketPresetDef(),
-new HandheldGbcDevPresetDef(),
-new HandheldLcdGridV2PresetDef(),
-new HandheldLcdGridPresetDef(),
-new HandheldLcdShaderPresetDef(),
-new HandheldLcd1xPresetDef(),
-new HandheldLcd1x_ndsPresetDef(),
-new HandheldLcd1x_pspPresetDef(),
-new HandheldLcd3xPresetDef(),
-new HandheldRetroTilesPresetDef(),
-new HandheldRetroV2PresetDef(),
-new HandheldRetroV3PresetDef(),
-new HandheldSameboyLcdPresetDef(),
-new HandheldSimpletex_lcd4kPresetDef(),
-new HandheldSimpletex_lcdPresetDef(),
-new HandheldSimpletex_lcd_720pPresetDef(),
-new HandheldZfastLcdPresetDef(),
-new InterpolationBSpline4TapsPresetDef(),
-new InterpolationBSplineFastPresetDef(),
-new InterpolationBicubic5TapsPresetDef(),
-new InterpolationBicubicFastPresetDef(),
-new InterpolationBicubicPresetDef(),
-new InterpolationCatmullRom5TapsPresetDef(),
-new InterpolationCatmullRomFastPresetDef(),
-new InterpolationCatmullRomPresetDef(),
-new InterpolationCubicGammaCorrectPresetDef(),
-new InterpolationCubicPresetDef(),
-new InterpolationHermitePresetDef(),
-new InterpolationJinc2SharpPresetDef(),
-new InterpolationJinc2SharperPresetDef(),
-new InterpolationJinc2PresetDef(),
-new InterpolationLanczos16PresetDef(),
-new InterpolationLanczos25TapsPresetDef(),
-new InterpolationLanczos3FastPresetDef(),
-new InterpolationQuilezPresetDef(),
-new InterpolationSpline16FastPresetDef(),
-new InterpolationSpline36FastPresetDef(),
-new LinearLinearGammaCorrectPresetDef(),
-new MiscAccessibility_modsPresetDef(),
-new MiscAntiFlickerPresetDef(),
-new MiscAsciiPresetDef(),
-new MiscBeadPresetDef(),
-new MiscBobDeinterlacingPresetDef(),
-new MiscChromaPresetDef(),
-new MiscChromaticityPresetDef(),
-new MiscCmykHalftoneDotPresetDef(),
-new MiscCocktailCabinetPresetDef(),
-new MiscColorManglerPresetDef(),
-new MiscColorimetryPresetDef(),
-new MiscConvergencePresetDef(),
-new MiscDebandPresetDef(),
-new MiscDeinterlacePresetDef(),
-new MiscEdgeDetectPresetDef(),
-new MiscEgaPresetDef(),
-new MiscGeomAppendPresetDef(),
-new MiscGeomPresetDef(),
-new MiscGlassPresetDef(),
-new MiscGradeNoLUTPresetDef(),
-new MiscGradePresetDef(),
-new MiscHalf_resPresetDef(),
-new MiscImageAdjustmentPresetDef(),
-new MiscImg_modPresetDef(),
-new MiscInterlacingPresetDef(),
-new MiscNaturalVisionPresetDef(),
-new MiscNightModePresetDef(),
-new MiscNtscColorsPresetDef(),
-new MiscPatchyColorPresetDef(),
-new MiscReliefPresetDef(),
-new MiscRetroPalettesPresetDef(),
-new MiscSimple_color_controlsPresetDef(),
-new MiscSsGammaRampPresetDef(),
-new MiscTonemappingPresetDef(),
-new MiscWhite_pointPresetDef(),
-new MiscYiqHueAdjustmentPresetDef(),
-new MotionInterpolationMotion_interpolationPresetDef(),
-new MotionblurBraidRewindPresetDef(),
-new MotionblurFeedbackPresetDef(),
-new MotionblurMix_framesPresetDef(),
-new MotionblurMix_frames_smartPresetDef(),
-new MotionblurMotionblurBluePresetDef(),
-new MotionblurMotionblurColorPresetDef(),
-new MotionblurMotionblurSimplePresetDef(),
-new MotionblurResponseTimePresetDef(),
-new StockNearestPresetDef(),
-new Nes_raw_paletteCgwgFamicomGeomPresetDef(),
-new Nes_raw_paletteGtuFamicomPresetDef(),
-new Nes_raw_paletteNtscNesPresetDef(),
-new Nes_raw_palettePalR57shellRawPresetDef(),
-new NtscArtifactColorsPresetDef(),
-new NtscBlarggPresetDef(),
-new NtscMameNtscPresetDef(),
-new NtscNtsc256pxCompositeScanlinePresetDef(),
-new NtscNtsc256pxCompositePresetDef(),
-new NtscNtsc256pxSvideoScanlinePresetDef(),
-new NtscNtsc256pxSvideoPresetDef(),
-new NtscNtsc320pxCompositeScanlinePresetDef(),
-new NtscNtsc320pxCompositePresetDef(),
-new NtscNtsc320pxSvideoScanlinePresetDef(),
-new NtscNtsc320pxSvideoPresetDef(),
-new NtscNtscAdaptive4xPresetDef(),
-new NtscNtscAdaptiveOldPresetDef(),
-new NtscNtscAdaptiveTatePresetDef(),
-new NtscNtscAdaptivePresetDef(),
-new NtscNtscBlastemPresetDef(),
-new NtscNtscMdRainbowsPresetDef(),
-new NtscNtscMiniPresetDef(),
-new NtscNtscSimplePresetDef(),
-new NtscTiny_ntscPresetDef(),
-new PalPalR57shellMoireOnlyPresetDef(),
-new PalPalR57shellPresetDef(),
-new PalPalSinglepassPresetDef(),
-new PixelArtScalingAannPresetDef(),
-new PixelArtScalingBandlimitPixelPresetDef(),
-new PixelArtScalingBilinearAdjustablePresetDef(),
-new PixelArtScalingBox_filter_aa_xformPresetDef(),
-new PixelArtScalingCleanEdgeRotatePresetDef(),
-new PixelArtScalingControlled_sharpnessPresetDef(),
-new PixelArtScalingEdge1pixelPresetDef(),
-new PixelArtScalingEdgeNpixelsPresetDef(),
-new PixelArtScalingGridBlendHybridPresetDef(),
-new PixelArtScalingPixellatePresetDef(),
-new PixelArtScalingPixel_aaPresetDef(),
-new PixelArtScalingPixel_aa_fastPresetDef(),
-new PixelArtScalingPixel_aa_single_passPresetDef(),
-new PixelArtScalingPixel_aa_xformPresetDef(),
-new PixelArtScalingSharpBilinear2xPrescalePresetDef(),
-new PixelArtScalingSharpBilinearScanlinesPresetDef(),
-new PixelArtScalingSharpBilinearSimplePresetDef(),
-new PixelArtScalingSharpBilinearPresetDef(),
-new PixelArtScalingSharpShimmerlessPresetDef(),
-new PixelArtScalingSmootheststepPresetDef(),
-new PixelArtScalingSmuberstepPresetDef(),
-new PixelArtScalingUniformNearestPresetDef(),
-new PresetsBlursDualBloomFilterAaLv2FsrGammaRampGlassPresetDef(),
-new PresetsBlursDualBloomFilterAaLv2FsrGammaRampPresetDef(),
-new PresetsBlursDualBloomFilterAaLv2FsrPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampGsharpResamplerPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrGsharpResamplerPresetDef(),
-new PresetsBlursGizmoCompositeBlurAaLv2FsrPresetDef(),
-new PresetsBlursKawaseGlowBspline4tapsFsrGammaRampTonemappingPresetDef(),
-new PresetsBlursSmartblurBspline4tapsFsrGammaRampVhsPresetDef(),
-new PresetsBlursSmartblurBspline4tapsFsrGammaRampPresetDef(),
-new PresetsBlursSmartblurBspline4tapsFsrPresetDef(),
-new PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrColorManglerColorimetryPresetDef(),
-new PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrPresetDef(),
-new PresetsCrtBeamSimulatorCrtBeamSimulatorCrtroyaleNtscSvideoPresetDef(),
-new PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyaleNtscSvideoPresetDef(),
-new PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyalePresetDef(),
-new PresetsCrtBeamSimulatorCrtBeamSimulatorNnedi3Nns164xLumaFsrCrtroyalePresetDef(),
-new PresetsCrtGeomSimplePresetDef(),
-new PresetsCrtHyllianSincSmartblurSgenptPresetDef(),
-new PresetsCrtHyllianSmartblurSgenptPresetDef(),
-new PresetsCrtLottesMultipassInterlacedGlowPresetDef(),
-new PresetsCrtNtscSharpCompositeGlowPresetDef(),
-new PresetsCrtNtscSharpCompositePresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x4GlowPresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x4PresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x5GlowPresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x5PresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x6GlowPresetDef(),
-new PresetsCrtNtscSharpSvideoNtsc_x6PresetDef(),
-new PresetsCrtNtscSharpTateCompositeGlowPresetDef(),
-new PresetsCrtNtscSharpTateCompositePresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x4GlowPresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x4PresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x5GlowPresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x5PresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x6GlowPresetDef(),
-new PresetsCrtNtscSharpTateSvideoNtsc_x6PresetDef(),
-new PresetsCrtPlusSignalC64MonitorPresetDef(),
-new PresetsCrtPlusSignalCrtGeomDeluxeNtscAdaptivePresetDef(),
-new PresetsCrtPlusSignalCrtRoyaleFastNtscCompositePresetDef(),
-new PresetsCrtPlusSignalCrtRoyaleNtscCompositePresetDef(),
-new PresetsCrtPlusSignalCrtRoyaleNtscSvideoPresetDef(),
-new PresetsCrtPlusSignalCrtRoyalePalR57shellPresetDef(),
-new PresetsCrtPlusSignalCrtglow_gauss_ntscPresetDef(),
-new PresetsCrtPlusSignalMy_old_tvPresetDef(),
-new PresetsCrtPlusSignalNtscPhosphorlutPresetDef(),
-new PresetsCrtPlusSignalNtsclutPhosphorlutPresetDef(),
-new PresetsCrtPotatoCrtPotatoColorimetryConvergencePresetDef(),
-new PresetsCrtRoyaleDownsamplePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePsxPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureSnesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscRfSlotmaskNesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastRgbAperturePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyaleFastRgbSlotPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePsxPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeSnesPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbBlendPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbShmupPresetDef(),
-new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePsxPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureSnesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastNtscRfSlotmaskNesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastRgbAperturePresetDef(),
-new PresetsCrtRoyaleFastCrtRoyaleFastRgbSlotPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePsxPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeSnesPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmRgbBlendPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmRgbShmupPresetDef(),
-new PresetsCrtRoyaleFastCrtRoyalePvmRgbPresetDef(),
-new PresetsCrtRoyaleKurozumiPresetDef(),
-new PresetsCrtRoyaleSmoothPresetDef(),
-new PresetsCrtRoyaleXm29plusPresetDef(),
-new PresetsCrtsimGrungyPresetDef(),
-new PresetsDownsampleDrez8xFsrAaLv2Bspline4tapsPresetDef(),
-new PresetsFsrFsrAaLv2Bspline4tapsNtscColorsPresetDef(),
-new PresetsFsrFsrAaLv2Bspline4tapsPresetDef(),
-new PresetsFsrFsrAaLv2DeblurPresetDef(),
-new PresetsFsrFsrAaLv2GlassPresetDef(),
-new PresetsFsrFsrAaLv2Kawase5blurNtscColorsGlassPresetDef(),
-new PresetsFsrFsrAaLv2Kawase5blurNtscColorsPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3GlassPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3NtscColorsGlassPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3NtscColorsPresetDef(),
-new PresetsFsrFsrAaLv2Median3x3PresetDef(),
-new PresetsFsrFsrAaLv2NaturalvisionGlassPresetDef(),
-new PresetsFsrFsrAaLv2NaturalvisionVhsPresetDef(),
-new PresetsFsrFsrAaLv2NaturalvisionPresetDef(),
-new PresetsFsrFsrAaLv2SabrHybridDeposterizePresetDef(),
-new PresetsFsrFsrAaLv2VhsPresetDef(),
-new PresetsFsrFsrAaLv2PresetDef(),
-new PresetsFsrFsrCrtPotatoBvmVhsPresetDef(),
-new PresetsFsrFsrCrtPotatoBvmPresetDef(),
-new PresetsFsrFsrCrtPotatoColorimetryConvergencePresetDef(),
-new PresetsFsrFsrCrtPotatoWarmColorimetryConvergencePresetDef(),
-new PresetsFsrFsrCrtroyaleXm29plusPresetDef(),
-new PresetsFsrFsrCrtroyalePresetDef(),
-new PresetsFsrFsrLv2AaChromacityGlassPresetDef(),
-new PresetsFsrFsrSmaaColorimetryConvergencePresetDef(),
-new PresetsGizmoCrtGizmoCrtCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtMegadriveCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtMegadrivePresetDef(),
-new PresetsGizmoCrtGizmoCrtN64CurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtN64PresetDef(),
-new PresetsGizmoCrtGizmoCrtPsxCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtPsxPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnes4kPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnesCurvator4kPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnesDarkCurvatorPresetDef(),
-new PresetsGizmoCrtGizmoCrtSnesDarkPresetDef(),
-new PresetsHandheldPlusColorModAgb001GbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModAgs001GbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModBandlimitPixelGbaColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2DsliteColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2DsliteColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbaColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbcColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbcColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbMicroColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2GbMicroColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2NdsColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2NdsColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PalmColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PalmColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PspColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2PspColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2Sp101ColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2Sp101ColorPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2VbaColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModLcdGridV2VbaColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2GbaColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2GbcColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2ImageAdjustmentPresetDef(),
-new PresetsHandheldPlusColorModRetroV2NdsColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2PspColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV2VbaColorPresetDef(),
-new PresetsHandheldPlusColorModRetroV3NdsColorPresetDef(),
-new PresetsHandheldPlusColorModSameboyLcdGbcColorMotionblurPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbaColor4kPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbaColorPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbcColor4kPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcdGbcColorPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcd_720pGbaColorPresetDef(),
-new PresetsHandheldPlusColorModSimpletex_lcd_720pGbcColorPresetDef(),
-new PresetsImgborderRoyaleKurozumiPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2FsrGammaRampPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2FsrPowervrPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2FsrPresetDef(),
-new PresetsInterpolationBspline4tapsAaLv2PresetDef(),
-new PresetsInterpolationBspline4tapsFsrVhsPresetDef(),
-new PresetsInterpolationLanczos25tapsFsrGammaRampVhsPresetDef(),
-new PresetsInterpolationLanczos25tapsFsrGammaRampPresetDef(),
-new PresetsInterpolationLanczos25tapsFsrPresetDef(),
-new PresetsInterpolationSpline36FastFsrGammaRampVhsPresetDef(),
-new PresetsInterpolationSpline36FastFsrGammaRampPresetDef(),
-new PresetsInterpolationSpline36FastFsrPresetDef(),
-new PresetsMdaptFastBilateralSuper4xbrScanlinesPresetDef(),
-new PresetsNediPowervrSharpenPresetDef(),
-new PresetsNesColorDecoderColorimetryPixellatePresetDef(),
-new PresetsNesColorDecoderPixellatePresetDef(),
-new PresetsScalefxPlusSmoothingScalefxRAAAaFastPresetDef(),
-new PresetsScalefxPlusSmoothingScalefxRAAAaPresetDef(),
-new PresetsScalefxPlusSmoothingScalefxAaFastPresetDef(),
-new PresetsScalefxPlusSmoothingScalefxAaPresetDef(),
-new PresetsScalefxPlusSmoothingScalefx9AaBlurHazyNtscSh1nra358PresetDef(),
-new PresetsScalefxPlusSmoothingScalefx9AaBlurHazyVibranceSh1nra358PresetDef(),
-new PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaSharpsmootherPresetDef(),
-new PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaPresetDef(),
-new PresetsTvoutTvoutNesColorDecoderPresetDef(),
-new PresetsTvoutTvoutNtsc256pxCompositePresetDef(),
-new PresetsTvoutTvoutNtsc256pxSvideoPresetDef(),
-new PresetsTvoutTvoutNtsc2phaseCompositePresetDef(),
-new PresetsTvoutTvoutNtsc2phaseSvideoPresetDef(),
-new PresetsTvoutTvoutNtsc320pxCompositePresetDef(),
-new PresetsTvoutTvoutNtsc320pxSvideoPresetDef(),
-new PresetsTvoutTvoutNtsc3phaseCompositePresetDef(),
-new PresetsTvoutTvoutNtsc3phaseSvideoPresetDef(),
-new PresetsTvoutTvoutNtscNesPresetDef(),
-new PresetsTvoutTvoutSnesHiresBlendPresetDef(),
-new PresetsTvoutTvoutJincSharpenPresetDef(),
-new PresetsTvoutTvoutPixelsharpPresetDef(),
-new PresetsTvoutTvoutPresetDef(),
-new PresetsTvoutInterlacingTvoutInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNesColorDecoderInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc256pxCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc256pxSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc2phaseCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc2phaseSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc320pxCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc320pxSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc3phaseCompositeInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtsc3phaseSvideoInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutNtscNesInterlacingPresetDef(),
-new PresetsTvoutInterlacingTvoutJincSharpenInterlacingPresetDef(),
-new PresetsXbrXsalXbrLv32xsalLv2AaSoftPresetDef(),
-new PresetsXbrXsalXbrLv32xsalLv2AaPresetDef(),
-new PresetsXbrXsalXbrLv3AaFastPresetDef(),
-new PresetsXbrXsalXbrLv3AaSoftFastPresetDef(),
-new ReshadeBlendoverlayPresetDef(),
-new ReshadeBloomPresetDef(),
-new ReshadeBsnesGammaRampPresetDef(),
-new ReshadeFilmGrainPresetDef(),
-new ReshadeHalftonePrintPresetDef(),
-new ReshadeHandheldColorLUTsDSLite2020PresetDef(),
-new ReshadeHandheldColorLUTsDSLiteP3PresetDef(),
-new ReshadeHandheldColorLUTsDSLiteSRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBA2020PresetDef(),
-new ReshadeHandheldColorLUTsGBAP3DarkPresetDef(),
-new ReshadeHandheldColorLUTsGBAP3PresetDef(),
-new ReshadeHandheldColorLUTsGBARec2020DarkPresetDef(),
-new ReshadeHandheldColorLUTsGBARec2020PresetDef(),
-new ReshadeHandheldColorLUTsGBASRGBDarkPresetDef(),
-new ReshadeHandheldColorLUTsGBASRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBA_GBC2020PresetDef(),
-new ReshadeHandheldColorLUTsGBA_GBCP3PresetDef(),
-new ReshadeHandheldColorLUTsGBA_GBCSRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBCDevColorspacePresetDef(),
-new ReshadeHandheldColorLUTsGBC2020PresetDef(),
-new ReshadeHandheldColorLUTsGBCP3PresetDef(),
-new ReshadeHandheldColorLUTsGBCRec2020PresetDef(),
-new ReshadeHandheldColorLUTsGBCSRGBPresetDef(),
-new ReshadeHandheldColorLUTsGBMicro2020PresetDef(),
-new ReshadeHandheldColorLUTsGBMicroP3PresetDef(),
-new ReshadeHandheldColorLUTsGBMicroSRGBPresetDef(),
-new ReshadeHandheldColorLUTsNDS2020PresetDef(),
-new ReshadeHandheldColorLUTsNDSP3PresetDef(),
-new ReshadeHandheldColorLUTsNDSRec2020PresetDef(),
-new ReshadeHandheldColorLUTsNDSSRGBPresetDef(),
-new ReshadeHandheldColorLUTsNSOGBAPresetDef(),
-new ReshadeHandheldColorLUTsNSOGBCPresetDef(),
-new ReshadeHandheldColorLUTsPSP2020PresetDef(),
-new ReshadeHandheldColorLUTsPSPP3PureGamma22PresetDef(),
-new ReshadeHandheldColorLUTsPSPP3PresetDef(),
-new ReshadeHandheldColorLUTsPSPRec2020SRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsPSPRec2020PresetDef(),
-new ReshadeHandheldColorLUTsPSPSRGBSRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsPSPSRGBPresetDef(),
-new ReshadeHandheldColorLUTsSP1012020PresetDef(),
-new ReshadeHandheldColorLUTsSP101P3PresetDef(),
-new ReshadeHandheldColorLUTsSP101SRGBPresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDP3SRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDP3PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDRec2020SRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDRec2020PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDSRGBSRGBGamma22PresetDef(),
-new ReshadeHandheldColorLUTsSwitchOLEDSRGBPresetDef(),
-new ReshadeHandheldColorLUTsSWOLED2020PresetDef(),
-new ReshadeHandheldColorLUTsSWOLEDP3PresetDef(),
-new ReshadeHandheldColorLUTsSWOLEDSRGBPresetDef(),
-new ReshadeHandheldColorLUTsVBAColorspacePresetDef(),
-new ReshadeLutPresetDef(),
-new ReshadeMagicbloomPresetDef(),
-new ReshadeNormalsDisplacementPresetDef(),
-new ScanlinesIntegerScalingScanlinesPresetDef(),
-new ScanlinesOsscPresetDef(),
-new ScanlinesOssc_slotPresetDef(),
-new ScanlinesResIndependentScanlinesPresetDef(),
-new ScanlinesScanlineFractPresetDef(),
-new ScanlinesScanlinePresetDef(),
-new ScanlinesScanlinesRerePresetDef(),
-new ScanlinesScanlinesSineAbsPresetDef(),
-new SharpenAdaptiveSharpenMultipassPresetDef(),
-new SharpenAdaptiveSharpenPresetDef(),
-new SharpenAnime4kPresetDef(),
-new SharpenCheapSharpenPresetDef(),
-new SharpenRca_sharpenPresetDef(),
-new SharpenSuperXbrSuperResPresetDef(),
-new Stereoscopic3dAnaglyphToSideBySidePresetDef(),
-new Stereoscopic3dFubax_vrPresetDef(),
-new Stereoscopic3dShutterToAnaglyphPresetDef(),
-new Stereoscopic3dShutterToSideBySidePresetDef(),
-new Stereoscopic3dSideBySideSimplePresetDef(),
-new Stereoscopic3dSideBySideToInterlacedPresetDef(),
-new Stereoscopic3dSideBySideToShutterPresetDef(),
-new VhsGristleVHSPresetDef(),
-new VhsMudlordPalVhsPresetDef(),
-new VhsNtscVcrPresetDef(),
-new VhsVhsPresetDef(),
-new VhsVHSProPresetDef(),
-new VhsVhs_and_crt_godotPresetDef(),
-new VhsVhs_mpalkoPresetDef(),
-new WarpDilationPresetDef(),
-// %PRESET_CLASS%
-};
+// presets are split into one translation unit per top-level category, and numbered in the order they were added
+void AddAnamorphicPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddAntiAliasingPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddBezelPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddStockPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddBlursPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddBorderPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddCelPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddCrtPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddDeblurPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddDenoisersPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddDitheringPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddEdgeSmoothingPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddFilmPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddGpuPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddHandheldPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddInterpolationPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddLinearPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddMiscPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddMotionInterpolationPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddMotionblurPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddNes_raw_palettePresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddNtscPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddPalPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddPixelArtScalingPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddPresetsPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddReshadePresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddScanlinesPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddSharpenPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddStereoscopic3dPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddVhsPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddWarpPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddAutoBoxPresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddDownsamplePresets(std::vector<std::pair<int, PresetDef*>>& list);
+void AddSubframeBfiPresets(std::vector<std::pair<int, PresetDef*>>& list);
+// %SHARD_DECLARATION%
+
+inline std::vector<PresetDef*> BuildPresetList()
+{
+    std::vector<std::pair<int, PresetDef*>> presets;
+    AddAnamorphicPresets(presets);
+    AddAntiAliasingPresets(presets);
+    AddBezelPresets(presets);
+    AddStockPresets(presets);
+    AddBlursPresets(presets);
+    AddBorderPresets(presets);
+    AddCelPresets(presets);
+    AddCrtPresets(presets);
+    AddDeblurPresets(presets);
+    AddDenoisersPresets(presets);
+    AddDitheringPresets(presets);
+    AddEdgeSmoothingPresets(presets);
+    AddFilmPresets(presets);
+    AddGpuPresets(presets);
+    AddHandheldPresets(presets);
+    AddInterpolationPresets(presets);
+    AddLinearPresets(presets);
+    AddMiscPresets(presets);
+    AddMotionInterpolationPresets(presets);
+    AddMotionblurPresets(presets);
+    AddNes_raw_palettePresets(presets);
+    AddNtscPresets(presets);
+    AddPalPresets(presets);
+    AddPixelArtScalingPresets(presets);
+    AddPresetsPresets(presets);
+    AddReshadePresets(presets);
+    AddScanlinesPresets(presets);
+    AddSharpenPresets(presets);
+    AddStereoscopic3dPresets(presets);
+    AddVhsPresets(presets);
+    AddWarpPresets(presets);
+    AddAutoBoxPresets(presets);
+    AddDownsamplePresets(presets);
+    AddSubframeBfiPresets(presets);
+// %SHARD_CALL%
+    std::sort(presets.begin(), presets.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<PresetDef*> list;
+    for(const auto& preset : presets)
+        list.push_back(preset.second);
+    return list;
+}
 }
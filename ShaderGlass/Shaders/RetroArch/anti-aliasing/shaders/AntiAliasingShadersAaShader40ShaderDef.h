@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersAaShader40ShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersAaShader40ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersAaShader40ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1750,32 +1761,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersAaShader40ShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersAaShader40ShaderDef::AntiAliasingShadersAaShader40ShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersAaShader40ShaderDef() : ShaderDef{}
-	{
-		Name = "aa-shader-4.0";
-		VertexByteCode = RetroArchAntiAliasingShadersAaShader40ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersAaShader40ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersAaShader40ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersAaShader40ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("INTERNAL_RES", -1, 52, 4, 1.000000f, 8.000000f, 1.000000f, 1.000000f, "Internal Resolution"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "aa-shader-4.0";
+	VertexByteCode = RetroArchAntiAliasingShadersAaShader40ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersAaShader40ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersAaShader40ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersAaShader40ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("INTERNAL_RES", -1, 52, 4, 1.000000f, 8.000000f, 1.000000f, 1.000000f, "Internal Resolution"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
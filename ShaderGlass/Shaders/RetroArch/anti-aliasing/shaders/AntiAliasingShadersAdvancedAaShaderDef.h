@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersAdvancedAaShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersAdvancedAaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersAdvancedAaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -762,33 +773,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersAdvancedAaShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersAdvancedAaShaderDef::AntiAliasingShadersAdvancedAaShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersAdvancedAaShaderDef() : ShaderDef{}
-	{
-		Name = "advanced-aa";
-		VertexByteCode = RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AA_RESOLUTION_X", -1, 52, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "AA Input Res X"));
-		Params.push_back(ShaderParam("AA_RESOLUTION_Y", -1, 56, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "AA Input Res Y"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "advanced-aa";
+	VertexByteCode = RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersAdvancedAaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AA_RESOLUTION_X", -1, 52, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "AA Input Res X"));
+	Params.push_back(ShaderParam("AA_RESOLUTION_Y", -1, 56, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "AA Input Res Y"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
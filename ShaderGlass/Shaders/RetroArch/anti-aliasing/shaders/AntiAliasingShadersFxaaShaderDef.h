@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersFxaaShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersFxaaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersFxaaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -4221,31 +4232,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersFxaaShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersFxaaShaderDef::AntiAliasingShadersFxaaShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersFxaaShaderDef() : ShaderDef{}
-	{
-		Name = "fxaa";
-		VertexByteCode = RetroArchAntiAliasingShadersFxaaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersFxaaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersFxaaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersFxaaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "fxaa";
+	VertexByteCode = RetroArchAntiAliasingShadersFxaaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersFxaaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersFxaaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersFxaaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
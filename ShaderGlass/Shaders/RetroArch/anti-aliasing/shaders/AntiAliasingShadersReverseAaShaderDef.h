@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersReverseAaShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersReverseAaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersReverseAaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -647,30 +658,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersReverseAaShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersReverseAaShaderDef::AntiAliasingShadersReverseAaShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersReverseAaShaderDef() : ShaderDef{}
-	{
-		Name = "reverse-aa";
-		VertexByteCode = RetroArchAntiAliasingShadersReverseAaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersReverseAaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersReverseAaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersReverseAaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("REVERSEAA_SHARPNESS", -1, 32, 4, 0.000000f, 10.000000f, 2.000000f, 0.010000f, "ReverseAA Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "reverse-aa";
+	VertexByteCode = RetroArchAntiAliasingShadersReverseAaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersReverseAaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersReverseAaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersReverseAaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("REVERSEAA_SHARPNESS", -1, 32, 4, 0.000000f, 10.000000f, 2.000000f, 0.010000f, "ReverseAA Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
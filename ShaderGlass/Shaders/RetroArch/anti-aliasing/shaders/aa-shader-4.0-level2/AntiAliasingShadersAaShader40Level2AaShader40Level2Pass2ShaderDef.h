@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -495,32 +506,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef::AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef() : ShaderDef{}
-	{
-		Name = "aa-shader-4.0-level2-pass2";
-		VertexByteCode = RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AAOFFSET2", -1, 52, 4, 0.250000f, 2.000000f, 0.500000f, 0.050000f, "AA offset second pass"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "aa-shader-4.0-level2-pass2";
+	VertexByteCode = RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AAOFFSET2", -1, 52, 4, 0.250000f, 2.000000f, 0.500000f, 0.050000f, "AA offset second pass"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
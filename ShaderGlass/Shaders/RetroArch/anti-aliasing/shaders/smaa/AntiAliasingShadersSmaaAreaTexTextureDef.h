@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class AntiAliasingShadersSmaaAreaTexTextureDef : public TextureDef
+{
+public:
+	AntiAliasingShadersSmaaAreaTexTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace AntiAliasingShadersSmaaAreaTexTextureDefs
 {
 const BYTE sData[] =
@@ -771,13 +779,10 @@ const BYTE sData[] =
 ,152,229,239,111,252,27,253,238,23,78,39,195,200,158,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class AntiAliasingShadersSmaaAreaTexTextureDef : public TextureDef
+AntiAliasingShadersSmaaAreaTexTextureDef::AntiAliasingShadersSmaaAreaTexTextureDef() : TextureDef{}
 {
-public:
-	AntiAliasingShadersSmaaAreaTexTextureDef() : TextureDef{}
-	{
-		Name = "AreaTex.png";
-		Data = AntiAliasingShadersSmaaAreaTexTextureDefs::sData;
-		DataLength = sizeof(AntiAliasingShadersSmaaAreaTexTextureDefs::sData);
-	}
-};
+	Name = "AreaTex.png";
+	Data = AntiAliasingShadersSmaaAreaTexTextureDefs::sData;
+	DataLength = sizeof(AntiAliasingShadersSmaaAreaTexTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class AntiAliasingShadersSmaaSearchTexTextureDef : public TextureDef
+{
+public:
+	AntiAliasingShadersSmaaSearchTexTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace AntiAliasingShadersSmaaSearchTexTextureDefs
 {
 const BYTE sData[] =
@@ -16,13 +24,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class AntiAliasingShadersSmaaSearchTexTextureDef : public TextureDef
+AntiAliasingShadersSmaaSearchTexTextureDef::AntiAliasingShadersSmaaSearchTexTextureDef() : TextureDef{}
 {
-public:
-	AntiAliasingShadersSmaaSearchTexTextureDef() : TextureDef{}
-	{
-		Name = "SearchTex.png";
-		Data = AntiAliasingShadersSmaaSearchTexTextureDefs::sData;
-		DataLength = sizeof(AntiAliasingShadersSmaaSearchTexTextureDefs::sData);
-	}
-};
+	Name = "SearchTex.png";
+	Data = AntiAliasingShadersSmaaSearchTexTextureDefs::sData;
+	DataLength = sizeof(AntiAliasingShadersSmaaSearchTexTextureDefs::sData);
+}
+#endif
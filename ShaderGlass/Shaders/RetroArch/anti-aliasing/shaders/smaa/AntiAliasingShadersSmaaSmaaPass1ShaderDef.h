@@ -312,6 +312,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersSmaaSmaaPass1ShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersSmaaSmaaPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2368,37 +2379,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersSmaaSmaaPass1ShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersSmaaSmaaPass1ShaderDef::AntiAliasingShadersSmaaSmaaPass1ShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersSmaaSmaaPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "smaa-pass1";
-		VertexByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SMAA_THRESHOLD", -1, 52, 4, 0.010000f, 0.500000f, 0.050000f, 0.010000f, "SMAA Threshold"));
-		Params.push_back(ShaderParam("SMAA_MAX_SEARCH_STEPS", -1, 56, 4, 4.000000f, 112.000000f, 32.000000f, 1.000000f, "SMAA Max Search Steps"));
-		Params.push_back(ShaderParam("SMAA_MAX_SEARCH_STEPS_DIAG", -1, 60, 4, 4.000000f, 20.000000f, 16.000000f, 1.000000f, "SMAA Max Search Steps Diagonal"));
-		Params.push_back(ShaderParam("SMAA_CORNER_ROUNDING", -1, 64, 4, 0.000000f, 100.000000f, 25.000000f, 1.000000f, "SMAA Corner Rounding"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("areaTex", 3));
-		Samplers.push_back(ShaderSampler("searchTex", 4));
+	Name = "smaa-pass1";
+	VertexByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SMAA_THRESHOLD", -1, 52, 4, 0.010000f, 0.500000f, 0.050000f, 0.010000f, "SMAA Threshold"));
+	Params.push_back(ShaderParam("SMAA_MAX_SEARCH_STEPS", -1, 56, 4, 4.000000f, 112.000000f, 32.000000f, 1.000000f, "SMAA Max Search Steps"));
+	Params.push_back(ShaderParam("SMAA_MAX_SEARCH_STEPS_DIAG", -1, 60, 4, 4.000000f, 20.000000f, 16.000000f, 1.000000f, "SMAA Max Search Steps Diagonal"));
+	Params.push_back(ShaderParam("SMAA_CORNER_ROUNDING", -1, 64, 4, 0.000000f, 100.000000f, 25.000000f, 1.000000f, "SMAA Corner Rounding"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("areaTex", 3));
+	Samplers.push_back(ShaderSampler("searchTex", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -312,6 +312,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AntiAliasingShadersSmaaSmaaPass2ShaderDef : public ShaderDef
+{
+public:
+	AntiAliasingShadersSmaaSmaaPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -883,32 +894,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AntiAliasingShadersSmaaSmaaPass2ShaderDef : public ShaderDef
+RetroArch::AntiAliasingShadersSmaaSmaaPass2ShaderDef::AntiAliasingShadersSmaaSmaaPass2ShaderDef() : ShaderDef{}
 {
-public:
-	AntiAliasingShadersSmaaSmaaPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "smaa-pass2";
-		VertexByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("SMAA_Input", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "smaa-pass2";
+	VertexByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAntiAliasingShadersSmaaSmaaPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("SMAA_Input", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class AutoBoxBoxCenterShaderDef : public ShaderDef
+{
+public:
+	AutoBoxBoxCenterShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchAutoBoxBoxCenterShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -357,31 +368,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class AutoBoxBoxCenterShaderDef : public ShaderDef
+RetroArch::AutoBoxBoxCenterShaderDef::AutoBoxBoxCenterShaderDef() : ShaderDef{}
 {
-public:
-	AutoBoxBoxCenterShaderDef() : ShaderDef{}
-	{
-		Name = "box-center";
-		VertexByteCode = RetroArchAutoBoxBoxCenterShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchAutoBoxBoxCenterShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchAutoBoxBoxCenterShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchAutoBoxBoxCenterShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("SourceSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MVP", 0, 64, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "box-center";
+	VertexByteCode = RetroArchAutoBoxBoxCenterShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchAutoBoxBoxCenterShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchAutoBoxBoxCenterShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchAutoBoxBoxCenterShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("SourceSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MVP", 0, 64, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
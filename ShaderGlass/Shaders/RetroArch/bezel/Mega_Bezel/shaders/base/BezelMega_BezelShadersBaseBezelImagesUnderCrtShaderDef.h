@@ -950,6 +950,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -53789,721 +53800,715 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef::BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef() : ShaderDef{}
-	{
-		Name = "bezel-images-under-crt";
-		VertexByteCode = RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalFeedbackSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 112, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", 0, 128, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DerezedPassSize", 0, 144, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", 0, 160, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 164, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_RESOLUTION_DEBUG_ON", 0, 168, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show Resolution Info"));
-		Params.push_back(ShaderParam("HSM_SINDEN_BORDER_ON", 0, 172, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show Border"));
-		Params.push_back(ShaderParam("HSM_SINDEN_BORDER_OPACITY", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_SINDEN_BORDER_BRIGHTNESS", 0, 180, 4, 0.000000f, 200.000000f, 60.000000f, 5.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_SINDEN_AMBIENT_LIGHTING", 0, 184, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_SINDEN_BORDER_THICKNESS", 0, 188, 4, 0.000000f, 30.000000f, 2.000000f, 0.500000f, "Thickness"));
-		Params.push_back(ShaderParam("HSM_SINDEN_BORDER_EMPTY_TUBE_COMPENSATION", 0, 192, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Compensate Empty Tube"));
-		Params.push_back(ShaderParam("HSM_CACHE_GRAPHICS_ON", 0, 196, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Cache Graphics: OFF | ON"));
-		Params.push_back(ShaderParam("HSM_CACHE_UPDATE_INDICATOR_MODE", 0, 200, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Cache Update Indicator: OFF | ON | ONLY IF CACHE IS OFF"));
-		Params.push_back(ShaderParam("HSM_GLOBAL_GRAPHICS_BRIGHTNESS", 0, 204, 4, 0.000000f, 500.000000f, 100.000000f, 1.000000f, "Graphics Brightness"));
-		Params.push_back(ShaderParam("HSM_STATIC_LAYERS_GAMMA", 0, 208, 4, 0.010000f, 5.000000f, 1.000000f, 0.010000f, "Graphics Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_AMBIENT_LIGHTING_OPACITY", 0, 212, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient Global Opacity Multiplier"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_OPACITY", 0, 216, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient 1st Image Opacity"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_OPACITY", 0, 220, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient 2nd Image Opacity (Used for BG by Default)"));
-		Params.push_back(ShaderParam("HSM_AMBIENT_LIGHTING_SWAP_IMAGE_MODE", 0, 224, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Which Images to Use: BOTH | 1 ONLY | 2 ONLY | SWAP"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_HUE", 0, 228, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "Hue"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_SATURATION", 0, 232, 4, 0.000000f, 300.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_VALUE", 0, 236, 4, 0.000000f, 400.000000f, 120.000000f, 1.000000f, "Value"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_CONTRAST", 0, 240, 4, 0.000000f, 200.000000f, 100.000000f, 0.500000f, "Contrast"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE_KEEP_ASPECT", 0, 244, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scale Aspect - MATCH VIEWPORT | USE TEXURE ASPECT"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE_INHERIT_MODE", 0, 248, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Scale Inheritance - OFF | ZOOM | TUBE"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE", 0, 252, 4, 10.000000f, 1000.000000f, 250.000000f, 1.000000f, "Scale Offset"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE_X", 0, 256, 4, 10.000000f, 1000.000000f, 100.000000f, 0.500000f, "Scale Offset X"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_ROTATE", 0, 260, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Rotate"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_MIRROR_HORZ", 0, 264, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mirror Horizontal"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_POS_INHERIT_MODE", 0, 268, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Position Inheritance - OFF | ON"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_POSITION_X", 0, 272, 4, -1500.000000f, 1500.000000f, 0.000000f, 1.000000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_POSITION_Y", 0, 276, 4, -1500.000000f, 1500.000000f, 0.000000f, 1.000000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_AMBIENT1_DITHERING_SAMPLES", 0, 280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_HUE", 0, 284, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "Hue"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_SATURATION", 0, 288, 4, 0.000000f, 300.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_VALUE", 0, 292, 4, 0.000000f, 400.000000f, 100.000000f, 1.000000f, "Value"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_CONTRAST", 0, 296, 4, 0.000000f, 200.000000f, 100.000000f, 0.500000f, "Contrast"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE_KEEP_ASPECT", 0, 300, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scale Aspect - MATCH VIEWPORT | USE TEXURE ASPECT"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE_INHERIT_MODE", 0, 304, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Scale Inheritance - OFF | ZOOM | TUBE"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE", 0, 308, 4, 10.000000f, 1000.000000f, 100.000000f, 0.500000f, "Scale Offset"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE_X", 0, 312, 4, 10.000000f, 1000.000000f, 100.000000f, 0.500000f, "Scale Offset X"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_ROTATE", 0, 316, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Rotate"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_MIRROR_HORZ", 0, 320, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mirror Horizontal"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_POS_INHERIT_MODE", 0, 324, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Position Inheritance - OFF | ON"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_POSITION_X", 0, 328, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_AMBIENT2_POSITION_Y", 0, 332, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_ZOOM", 0, 336, 4, 10.000000f, 500.000000f, 100.000000f, 0.200000f, "Viewport Zoom"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_POSITION_X", 0, 340, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Viewport Position X"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_POSITION_Y", 0, 344, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Viewport Position Y"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_ZOOM_MASK", 0, 348, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Zoom CRT Mask"));
-		Params.push_back(ShaderParam("HSM_FLIP_VIEWPORT_VERTICAL", 0, 352, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Viewport Vertical"));
-		Params.push_back(ShaderParam("HSM_FLIP_VIEWPORT_HORIZONTAL", 0, 356, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Viewport Horizontal"));
-		Params.push_back(ShaderParam("HSM_FLIP_CORE_VERTICAL", 0, 360, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Core Image Vertical"));
-		Params.push_back(ShaderParam("HSM_FLIP_CORE_HORIZONTAL", 0, 364, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Core Image Horizontal"));
-		Params.push_back(ShaderParam("HSM_ROTATE_CORE_IMAGE", 0, 368, 4, -1.000000f, 1.000000f, 0.000000f, 1.000000f, "Rotate CRT Tube --  -1:270 | 0 | 1:90"));
-		Params.push_back(ShaderParam("HSM_ASPECT_RATIO_ORIENTATION", 0, 372, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Orientation - Auto | Horizontal | Vertical"));
-		Params.push_back(ShaderParam("HSM_ASPECT_RATIO_MODE", 0, 376, 4, 0.000000f, 6.000000f, 5.000000f, 1.000000f, "Type - Auto | Explicit | 4:3 | 3:2 | 16:9 | PAR | Full"));
-		Params.push_back(ShaderParam("HSM_ASPECT_RATIO_EXPLICIT", 0, 380, 4, 0.000000f, 8.000000f, 1.333300f, 0.002000f, "Explicit Aspect Ratio (Also Auto Ratio Fallback)"));
-		Params.push_back(ShaderParam("HSM_INT_SCALE_MODE", 0, 384, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Integer Scale Mode - OFF | ShortAxis | BothAxes"));
-		Params.push_back(ShaderParam("HSM_INT_SCALE_MULTIPLE_OFFSET", 0, 388, 4, -20.000000f, 20.000000f, 0.000000f, 1.000000f, "Integer Scale Multiple Offset"));
-		Params.push_back(ShaderParam("HSM_INT_SCALE_MULTIPLE_OFFSET_LONG", 0, 392, 4, -20.000000f, 20.000000f, 0.000000f, 1.000000f, "Integer Scale Multiple Offset on Long Axis"));
-		Params.push_back(ShaderParam("HSM_INT_SCALE_MAX_HEIGHT", 0, 396, 4, 60.000000f, 140.000000f, 89.000000f, 0.500000f, "Base Integer Scale Max Height %"));
-		Params.push_back(ShaderParam("HSM_VERTICAL_PRESET", 0, 400, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Preset is for Monitor Portrait Mode (Smaller CRT Screen)"));
-		Params.push_back(ShaderParam("HSM_NON_INTEGER_SCALE", 0, 404, 4, 1.000000f, 200.000000f, 82.970001f, 0.200000f, "Non-Integer Scale %"));
-		Params.push_back(ShaderParam("HSM_USE_PHYSICAL_SIZE_FOR_NON_INTEGER", 0, 408, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Physical Monitor and Tube Sizes for Non-Integer"));
-		Params.push_back(ShaderParam("HSM_PHYSICAL_MONITOR_ASPECT_RATIO", 0, 412, 4, 0.250000f, 5.000000f, 1.770000f, 0.010000f, "Your Monitor's Aspect Ratio"));
-		Params.push_back(ShaderParam("HSM_PHYSICAL_MONITOR_DIAGONAL_SIZE", 0, 416, 4, 1.000000f, 100.000000f, 27.000000f, 0.100000f, "Your Monitor's Size (Diagonal)"));
-		Params.push_back(ShaderParam("HSM_PHYSICAL_SIM_TUBE_DIAGONAL_SIZE", 0, 420, 4, 1.000000f, 100.000000f, 18.100000f, 0.100000f, "Simulated Tube Size (Diagonal)"));
-		Params.push_back(ShaderParam("HSM_USE_IMAGE_FOR_PLACEMENT", 0, 424, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Image For Automatic Placement (Scale and Y Pos)"));
-		Params.push_back(ShaderParam("HSM_PLACEMENT_IMAGE_USE_HORIZONTAL", 0, 428, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Auto Place Horizontal (X Pos)"));
-		Params.push_back(ShaderParam("HSM_PLACEMENT_IMAGE_MODE", 0, 432, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Placement Image Mode: TRANSPARENCY : WHITE ON BLACK"));
-		Params.push_back(ShaderParam("HSM_NON_INTEGER_SCALE_OFFSET", 0, 436, 4, 5.000000f, 400.000000f, 100.000000f, 0.100000f, "Non-Integer Scale Offset"));
-		Params.push_back(ShaderParam("HSM_USE_SNAP_TO_CLOSEST_INT_SCALE", 0, 440, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Snap to Closest Integer Scale: OFF | ON"));
-		Params.push_back(ShaderParam("HSM_SNAP_TO_CLOSEST_INT_SCALE_TOLERANCE", 0, 444, 4, 0.000000f, 300.000000f, 20.000000f, 1.000000f, "Snap To Closest Integer Scale Tolerance"));
-		Params.push_back(ShaderParam("HSM_SCREEN_POSITION_X", 0, 448, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_SCREEN_POSITION_Y", 0, 452, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_CROP_MODE", 0, 456, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Crop Mode  -  OFF | CROP BLACK ONLY | CROP ANY"));
-		Params.push_back(ShaderParam("HSM_CROP_PERCENT_ZOOM", 0, 460, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Zoom %"));
-		Params.push_back(ShaderParam("HSM_CROP_PERCENT_TOP", 0, 464, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Top %"));
-		Params.push_back(ShaderParam("HSM_CROP_PERCENT_BOTTOM", 0, 468, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Bottom %"));
-		Params.push_back(ShaderParam("HSM_CROP_PERCENT_LEFT", 0, 472, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Left %"));
-		Params.push_back(ShaderParam("HSM_CROP_PERCENT_RIGHT", 0, 476, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Right %"));
-		Params.push_back(ShaderParam("HSM_CROP_BLACK_THRESHOLD", 0, 480, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Black Threshold for 'CROP BLACK ONLY'"));
-		Params.push_back(ShaderParam("HSM_SCANLINE_DIRECTION", 0, 484, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Scanline Direction - Auto | Horiz | Vert"));
-		Params.push_back(ShaderParam("HSM_CORE_RES_SAMPLING_MULT_SCANLINE_DIR", 0, 488, 4, 25.000000f, 1600.000000f, 100.000000f, 25.000000f, "Scanline Dir Multiplier"));
-		Params.push_back(ShaderParam("HSM_DOWNSAMPLE_BLUR_SCANLINE_DIR", 0, 492, 4, 0.000000f, 200.000000f, 0.000000f, 1.000000f, "Scanline Dir Downsample Blur"));
-		Params.push_back(ShaderParam("HSM_CORE_RES_SAMPLING_MULT_OPPOSITE_DIR", 0, 496, 4, 25.000000f, 1600.000000f, 100.000000f, 25.000000f, "Opposite Dir Multiplier"));
-		Params.push_back(ShaderParam("HSM_DOWNSAMPLE_BLUR_OPPOSITE_DIR", 0, 500, 4, 0.000000f, 200.000000f, 0.000000f, 1.000000f, "Opposite Dir Downsample Blur"));
-		Params.push_back(ShaderParam("HSM_CORE_RES_SAMPLING_SHIFT_OPPOSITE_DIR", 0, 504, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTERLACE_TRIGGER_RES", 0, 508, 4, 100.000000f, 2000.000000f, 375.000000f, 25.000000f, "Trigger Res for Interlace, Fake Scanlines & VGA"));
-		Params.push_back(ShaderParam("HSM_INTERLACE_MODE", 0, 512, 4, -1.000000f, 5.000000f, 4.000000f, 1.000000f, "Interlace Mode:"));
-		Params.push_back(ShaderParam("HSM_INTERLACE_EFFECT_SMOOTHNESS_INTERS", 0, 516, 4, 0.000000f, 100.000000f, 0.000000f, 10.000000f, "Interlace Effect Smoothness"));
-		Params.push_back(ShaderParam("HSM_INTERLACE_SCANLINE_EFFECT", 0, 520, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Interlace Scanline Effect ('Laced brightness)"));
-		Params.push_back(ShaderParam("iscans", 0, 524, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Interlace (Scanline) Saturation"));
-		Params.push_back(ShaderParam("vga_mode", 0, 528, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VGA Single/Double Scan mode"));
-		Params.push_back(ShaderParam("hiscan", 0, 532, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "High Resolution Scanlines (ScaleFx or XBR Only)"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_MODE", 0, 536, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Show Fake Scanlines - OFF | ON | USE TRIGGER RES"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_OPACITY", 0, 540, 4, 0.000000f, 100.000000f, 0.000000f, 5.000000f, "Opacity - Def 70"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_RES_MODE", 0, 544, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scan Resolution Mode: AUTO (CORE RES) : EXPLICIT"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_RES", 0, 548, 4, 0.000000f, 480.000000f, 240.000000f, 8.000000f, "Explicit Scan Resolution"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_INT_SCALE", 0, 552, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Int Scale Scanlines"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_ROLL", 0, 556, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Rolling Scanline"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_CURVATURE", 0, 560, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Scanline Curvature"));
-		Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_BRIGHTNESS_CUTOFF", 0, 564, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_MODE", 0, 568, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Mode - OFF | VERTICAL | HORIZONTAL"));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_CORE_IMAGE_SPLIT_MODE", 0, 572, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Core Image Split Mode  - AUTO | VERTICAL | HORIZONTAL"));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_CORE_IMAGE_SWAP_SCREENS", 0, 576, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Core Image Swap Screen Content"));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_CORE_IMAGE_SPLIT_OFFSET", 0, 580, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Core Image Split Offset"));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_VIEWPORT_SPLIT_LOCATION", 0, 584, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Viewport Split Offset"));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_SHIFT_POSITION_WITH_SCALE", 0, 588, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scale Screens from Center of Split"));
-		Params.push_back(ShaderParam("HSM_DUALSCREEN_POSITION_OFFSET_BETWEEN_SCREENS", 0, 592, 4, -250.000000f, 250.000000f, 0.000000f, 0.200000f, "Position Offset Between Screens"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_ASPECT_RATIO_MODE", 0, 596, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "2nd Screen Aspect Ratio Mode - Same as 1st Screen | PAR"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_INDEPENDENT_SCALE", 0, 600, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "2nd Screen Use Independent Scale"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_SCALE_OFFSET", 0, 604, 4, 1.000000f, 500.000000f, 100.000000f, 0.500000f, "2nd Screen Scale Offset"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_POS_X", 0, 608, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "2nd Screen Pos X"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_POS_Y", 0, 612, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "2nd Screen Pos Y"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_ZOOM", 0, 616, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Zoom %"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_TOP", 0, 620, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Top %"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_BOTTOM", 0, 624, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Bottom %"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_LEFT", 0, 628, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Left %"));
-		Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_RIGHT", 0, 632, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Right %"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_MODE", 0, 636, 4, 0.000000f, 5.000000f, 1.000000f, 1.000000f, "Curvature Mode  OFF | 2D | 2D-CYL | 3D-1 | 3D-2 | 3D CYL"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_2D_SCALE_LONG_AXIS", 0, 640, 4, 5.000000f, 400.000000f, 100.000000f, 5.000000f, "2D Curvature on Long Axis"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_2D_SCALE_SHORT_AXIS", 0, 644, 4, 5.000000f, 400.000000f, 100.000000f, 5.000000f, "2D Curvature on Short Axis"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_3D_RADIUS", 0, 648, 4, 16.000000f, 102400.000000f, 200.000000f, 1.000000f, "3D Radius"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_3D_VIEW_DIST", 0, 652, 4, 50.000000f, 102400.000000f, 150.000000f, 5.000000f, "3D View Distance - Def 150"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_3D_TILT_ANGLE_X", 0, 656, 4, -120.000000f, 120.000000f, 0.000000f, 1.000000f, "3D Tilt Angle X"));
-		Params.push_back(ShaderParam("HSM_CURVATURE_3D_TILT_ANGLE_Y", 0, 660, 4, -120.000000f, 120.000000f, 0.000000f, 1.000000f, "3D Tilt Angle Y"));
-		Params.push_back(ShaderParam("HSM_CRT_CURVATURE_SCALE", 0, 664, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "CRT Curvature Scale Multiplier: 0 = Less Moire Artifacts"));
-		Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_ON", 0, 668, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Signal Noise ON"));
-		Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_AMOUNT", 0, 672, 4, -1.000000f, 1.000000f, 0.200000f, 0.020000f, "Amount"));
-		Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_BLACK_LEVEL", 0, 676, 4, 0.000000f, 300.000000f, 100.000000f, 5.000000f, "Contrast"));
-		Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_SIZE_MODE", 0, 680, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Noise Resolution Mode:  SCANLINE | CORE | SMOOTHED"));
-		Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_SIZE_MULT", 0, 684, 4, 0.500000f, 4.000000f, 0.500000f, 0.500000f, "Size Mult"));
-		Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_TYPE", 0, 688, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Noise Type:  LUMA ADD | COLORED"));
-		Params.push_back(ShaderParam("HSM_ANTI_FLICKER_ON", 0, 692, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Anti-Flicker ON"));
-		Params.push_back(ShaderParam("HSM_ANTI_FLICKER_THRESHOLD", 0, 696, 4, 0.000000f, 100.000000f, 25.000000f, 5.000000f, "Luma Difference Threshold"));
-		Params.push_back(ShaderParam("HSM_AB_COMPARE_SHOW_MODE", 0, 700, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show:  CRT SHADER | ORIGINAL"));
-		Params.push_back(ShaderParam("HSM_AB_COMPARE_AREA", 0, 704, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Compare Area:  LEFT | RIGHT | TOP | BOTTOM"));
-		Params.push_back(ShaderParam("HSM_AB_COMPARE_FREEZE_CRT_TUBE", 0, 708, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Freeze CRT Tube (Freeze Left, New changes on Right)"));
-		Params.push_back(ShaderParam("HSM_AB_COMPARE_FREEZE_GRAPHICS", 0, 712, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Freeze Graphics (Freeze Left, New changes on Right)"));
-		Params.push_back(ShaderParam("HSM_AB_COMPARE_SPLIT_AREA", 0, 716, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_AB_COMPARE_SPLIT_POSITION", 0, 720, 4, 0.000000f, 100.000000f, 50.000000f, 0.200000f, "Splitscreen Position"));
-		Params.push_back(ShaderParam("HSM_SHOW_PASS_INDEX", 0, 724, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Show Pass Index"));
-		Params.push_back(ShaderParam("HSM_SHOW_PASS_ALPHA", 0, 728, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show Alpha Channel"));
-		Params.push_back(ShaderParam("HSM_SHOW_PASS_APPLY_SCREEN_COORD", 0, 732, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Screen Scale & Curvature to Unscaled Passes"));
-		Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_ON", 0, 736, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Use Vignette"));
-		Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_DUALSCREEN_VIS_MODE", 0, 740, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_STRENGTH", 0, 744, 4, 0.000000f, 98.000000f, 40.000000f, 2.000000f, "Amount (Strength)"));
-		Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_POWER", 0, 748, 4, 0.000000f, 200.000000f, 26.000000f, 2.000000f, "Corner Amount (Power)"));
-		Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_IN_REFLECTION", 0, 752, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Amount of Vignette in Reflection"));
-		Params.push_back(ShaderParam("HSM_MONOCHROME_MODE", 0, 756, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Monochrome Color: OFF | BW | AMBER | GREEN"));
-		Params.push_back(ShaderParam("HSM_MONOCHROME_BRIGHTNESS", 0, 760, 4, 1.000000f, 500.000000f, 100.000000f, 1.000000f, "Monochrome Brightness"));
-		Params.push_back(ShaderParam("HSM_MONOCHROME_GAMMA", 0, 764, 4, 0.100000f, 5.000000f, 1.000000f, 0.100000f, "Monochrome Gamma"));
-		Params.push_back(ShaderParam("HSM_MONOCHROME_HUE_OFFSET", 0, 768, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "Monochrome Hue Offset"));
-		Params.push_back(ShaderParam("HSM_MONOCHROME_SATURATION", 0, 772, 4, -100.000000f, 200.000000f, 100.000000f, 1.000000f, "Monochrome Saturation"));
-		Params.push_back(ShaderParam("HSM_MONOCHROME_DUALSCREEN_VIS_MODE", 0, 776, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_SCREEN_REFLECTION_SCALE", 0, 780, 4, 1.000000f, 300.000000f, 100.000000f, 1.000000f, "Screen Reflection Scale"));
-		Params.push_back(ShaderParam("HSM_SCREEN_REFLECTION_POS_X", 0, 784, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Screen Reflection Pos X"));
-		Params.push_back(ShaderParam("HSM_SCREEN_REFLECTION_POS_Y", 0, 788, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Screen Reflection Pos Y"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_MODE", 0, 792, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Tube Diffuse Color - BLACK | IMAGE | TRANSPARENT"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_DUALSCREEN_VIS_MODE", 0, 796, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_TUBE_OPACITY", 0, 800, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Tube Opacity"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_AMOUNT", 0, 804, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Amount"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_HUE", 0, 808, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_COLORIZE_ON", 0, 812, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize On"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_SATURATION", 0, 816, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_BRIGHTNESS", 0, 820, 4, 0.000000f, 500.000000f, 15.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_GAMMA", 0, 824, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_AMBIENT_LIGHTING", 0, 828, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_AMBIENT2_LIGHTING", 0, 832, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_SCALE", 0, 836, 4, 0.000000f, 1000.000000f, 140.000000f, 1.000000f, "Image Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_SCALE_X", 0, 840, 4, 0.000000f, 1000.000000f, 100.000000f, 1.000000f, "Image Scale X"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_ROTATION", 0, 844, 4, -1.000000f, 1.000000f, 0.000000f, 1.000000f, "Image Rotation: -1: 270 | 0 | 1: 90"));
-		Params.push_back(ShaderParam("HSM_TUBE_EMPTY_THICKNESS", 0, 848, 4, 0.000000f, 6000.000000f, 0.000000f, 10.000000f, "Empty Tube Thickness"));
-		Params.push_back(ShaderParam("HSM_TUBE_EMPTY_THICKNESS_X_SCALE", 0, 852, 4, 0.000000f, 3000.000000f, 100.000000f, 1.000000f, "Empty Tube Thicknes X Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_FORCE_ASPECT", 0, 856, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Tube Aspect - EVEN | SCREEN | Explicit"));
-		Params.push_back(ShaderParam("HSM_TUBE_EXPLICIT_ASPECT", 0, 860, 4, 0.500000f, 3.000000f, 1.333300f, 0.010000f, "Explicit Tube Aspect"));
-		Params.push_back(ShaderParam("HSM_SCREEN_CORNER_RADIUS_SCALE", 0, 864, 4, 5.000000f, 3000.000000f, 100.000000f, 1.000000f, "Screen (Game Image) Corner Radius Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_ON", 0, 868, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Tube Colored Gel - OFF | ON"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_DUALSCREEN_VIS_MODE", 0, 872, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_MULTIPLY_AMOUNT", 0, 876, 4, 0.000000f, 100.000000f, 90.000000f, 1.000000f, "Multiply Blend Amount"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_NORMAL_AMOUNT", 0, 880, 4, 0.000000f, 100.000000f, 15.000000f, 1.000000f, "Blend Amount"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_NORMAL_BRIGHTNESS", 0, 884, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_NORMAL_VIGNETTE", 0, 888, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Vignette Amount"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_TRANSPARENCY_THRESHOLD", 0, 892, 4, 0.000000f, 100.000000f, 23.000000f, 1.000000f, "Transparency Threshold"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_ADDITIVE_AMOUNT", 0, 896, 4, 0.000000f, 100.000000f, 0.000000f, 0.050000f, "Additive Blend Amount"));
-		Params.push_back(ShaderParam("HSM_SHOW_CRT_ON_TOP_OF_COLORED_GEL", 0, 900, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_ON", 0, 904, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Tube Shadow Image - OFF | ON"));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_OPACITY", 0, 908, 4, 0.000000f, 100.000000f, 60.000000f, 2.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_SCALE_X", 0, 912, 4, 0.000000f, 1000.000000f, 122.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_SCALE_Y", 0, 916, 4, 0.000000f, 1000.000000f, 130.000000f, 0.100000f, "Scale Y"));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_POS_X", 0, 920, 4, -500.000000f, 500.000000f, 0.000000f, 0.100000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_POS_Y", 0, 924, 4, -500.000000f, 500.000000f, 9.000000f, 0.100000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_TUBE_SHADOW_CURVATURE_SCALE", 0, 928, 4, 0.000000f, 2000.000000f, 300.000000f, 1.000000f, "Curvature Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_AMBIENT_LIGHTING", 0, 932, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_AMBIENT2_LIGHTING", 0, 936, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_FAKE_SCANLINE_AMOUNT", 0, 940, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Fake Scanline Amount"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_SCALE", 0, 944, 4, 0.000000f, 1000.000000f, 100.000000f, 1.000000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_FLIP_HORIZONTAL", 0, 948, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Horizontal"));
-		Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_FLIP_VERTICAL", 0, 952, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Vertical"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_REFLECTION_IMAGE_ON", 0, 956, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Tube Static Reflection Image - OFF | ON"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_REFLECTION_IMAGE_DUALSCREEN_VIS_MODE", 0, 960, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_REFLECTION_IMAGE_OPACITY", 0, 964, 4, 0.000000f, 100.000000f, 14.000000f, 0.100000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_OPACITY_DIFFUSE_MULTIPLY", 0, 968, 4, 0.000000f, 100.000000f, 25.000000f, 5.000000f, "Multiply Opacity by Diffuse Amount"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_BLACK_LEVEL", 0, 972, 4, -100.000000f, 100.000000f, 25.000000f, 0.500000f, "Black Level"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_AMBIENT_LIGHTING", 0, 976, 4, 0.000000f, 100.000000f, 60.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_AMBIENT2_LIGHTING", 0, 980, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_SCALE", 0, 984, 4, 0.000000f, 1000.000000f, 120.000000f, 1.000000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_SCALE_X", 0, 988, 4, 0.000000f, 1000.000000f, 100.000000f, 1.000000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_POS_X", 0, 992, 4, -500.000000f, 500.000000f, 10.000000f, 1.000000f, "Pos X"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_POS_Y", 0, 996, 4, -500.000000f, 500.000000f, 10.000000f, 1.000000f, "Pos Y"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_SHADOW_OPACITY", 0, 1000, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Shadow Opacity"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_DITHER_SAMPLES", 0, 1004, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Noise Samples (Reduces Banding)"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_DITHER_DISTANCE", 0, 1008, 4, 0.000000f, 10.000000f, 5.000000f, 0.500000f, "Noise Distance"));
-		Params.push_back(ShaderParam("HSM_TUBE_STATIC_DITHER_AMOUNT", 0, 1012, 4, 0.000000f, 10.000000f, 0.600000f, 0.100000f, "Noise Amount"));
-		Params.push_back(ShaderParam("HSM_CRT_BLEND_MODE", 0, 1016, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "CRT Blend Mode: OFF | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_CRT_BLEND_AMOUNT", 0, 1020, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "CRT Blend Amount"));
-		Params.push_back(ShaderParam("HSM_CRT_SCREEN_BLEND_MODE", 0, 1024, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_GLOBAL_CORNER_RADIUS", 0, 1028, 4, 4.000000f, 500.000000f, 10.000000f, 2.000000f, "Global Corner Radius - Def 10"));
-		Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_CORNER_RADIUS_SCALE", 0, 1032, 4, 10.000000f, 8000.000000f, 100.000000f, 10.000000f, "Black Edge Corner Radius Scale"));
-		Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_SHARPNESS", 0, 1036, 4, 0.000000f, 90.000000f, 70.000000f, 1.000000f, "Black Edge Sharpness - Def 70"));
-		Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_CURVATURE_SCALE", 0, 1040, 4, 20.000000f, 8000.000000f, 100.000000f, 10.000000f, "Black Edge Curvature Scale Multiplier"));
-		Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_THICKNESS", 0, 1044, 4, -800.000000f, 6000.000000f, 100.000000f, 5.000000f, "Black Edge Thickness"));
-		Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_THICKNESS_X_SCALE", 0, 1048, 4, 0.000000f, 3000.000000f, 100.000000f, 10.000000f, "Black Edge Thickness X Scale"));
-		Params.push_back(ShaderParam("HSM_BZL_USE_INDEPENDENT_SCALE", 0, 1052, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Independent Scale"));
-		Params.push_back(ShaderParam("HSM_BZL_INDEPENDENT_SCALE", 0, 1056, 4, 1.000000f, 200.000000f, 82.970001f, 0.100000f, "Independent Scale (When scale from image is not used)"));
-		Params.push_back(ShaderParam("HSM_BZL_USE_INDEPENDENT_CURVATURE", 0, 1060, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Independent Curvature"));
-		Params.push_back(ShaderParam("HSM_BZL_INDEPENDENT_CURVATURE_SCALE_LONG_AXIS", 0, 1064, 4, 0.000000f, 400.000000f, 100.000000f, 5.000000f, "Independent Curvature X"));
-		Params.push_back(ShaderParam("HSM_BZL_INDEPENDENT_CURVATURE_SCALE_SHORT_AXIS", 0, 1068, 4, 0.000000f, 400.000000f, 100.000000f, 5.000000f, "Independent Curvature Y"));
-		Params.push_back(ShaderParam("HSM_BZL_OPACITY", 0, 1072, 4, 0.000000f, 100.000000f, 100.000000f, 5.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_BZL_BLEND_MODE", 0, 1076, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - Off | Normal | Add | Mult"));
-		Params.push_back(ShaderParam("HSM_BZL_WIDTH", 0, 1080, 4, -250.000000f, 5000.000000f, 125.000000f, 1.000000f, "Width - Def 125"));
-		Params.push_back(ShaderParam("HSM_BZL_HEIGHT", 0, 1084, 4, -250.000000f, 5000.000000f, 100.000000f, 1.000000f, "Height"));
-		Params.push_back(ShaderParam("HSM_BZL_SCALE_OFFSET", 0, 1088, 4, 1.000000f, 200.000000f, 100.000000f, 0.100000f, "Scale Offset"));
-		Params.push_back(ShaderParam("HSM_BZL_INNER_CURVATURE_SCALE", 0, 1092, 4, 0.000000f, 8000.000000f, 100.000000f, 10.000000f, "Inner Curvature Scale Multiplier"));
-		Params.push_back(ShaderParam("HSM_BZL_INNER_CORNER_RADIUS_SCALE", 0, 1096, 4, 0.000000f, 8000.000000f, 80.000000f, 1.000000f, "Inner Corner Radius Scale - Def 80"));
-		Params.push_back(ShaderParam("HSM_BZL_OUTER_CURVATURE_SCALE", 0, 1100, 4, 0.000000f, 500.000000f, 0.000000f, 5.000000f, "Outer Curvature Scale"));
-		Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_THICKNESS", 0, 1104, 4, 0.000000f, 700.000000f, 110.000000f, 10.000000f, "Inner Edge Thickness"));
-		Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_SHARPNESS", 0, 1108, 4, 0.000000f, 90.000000f, 95.000000f, 5.000000f, "Inner Edge Sharpness - Def 95"));
-		Params.push_back(ShaderParam("HSM_BZL_OUTER_CORNER_RADIUS_SCALE", 0, 1112, 4, 0.000000f, 4000.000000f, 60.000000f, 1.000000f, "Outer Corner Radius Scale - Def 60"));
-		Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_SHADOW", 0, 1116, 4, 0.000000f, 200.000000f, 70.000000f, 5.000000f, "Opacity of Shadow from Bezel on Tube"));
-		Params.push_back(ShaderParam("HSM_BZL_COLOR_HUE", 0, 1120, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
-		Params.push_back(ShaderParam("HSM_BZL_COLOR_SATURATION", 0, 1124, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_BZL_COLOR_VALUE", 0, 1128, 4, 0.000000f, 100.000000f, 10.000000f, 0.200000f, "Value/Brightness - Def 10"));
-		Params.push_back(ShaderParam("HSM_BZL_NOISE", 0, 1132, 4, 0.000000f, 100.000000f, 30.000000f, 1.000000f, "Noise - Def 30"));
-		Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS", 0, 1136, 4, 0.000000f, 600.000000f, 30.000000f, 2.000000f, "Base Brightness - Def 30"));
-		Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_TOP", 0, 1140, 4, 0.000000f, 1000.000000f, 50.000000f, 2.000000f, "Top Multiplier - Def 50"));
-		Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_BOTTOM", 0, 1144, 4, 0.000000f, 1000.000000f, 200.000000f, 2.000000f, "Bottom Multiplier - Def 200"));
-		Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_SIDES", 0, 1148, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Sides Multiplier"));
-		Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_SIDE_LEFT", 0, 1152, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Left Side Multiplier"));
-		Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_SIDE_RIGHT", 0, 1156, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Right Side Multiplier"));
-		Params.push_back(ShaderParam("HSM_BZL_HIGHLIGHT", 0, 1160, 4, 0.000000f, 100.000000f, 1.000000f, 0.200000f, "Main Highlight"));
-		Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_HIGHLIGHT", 0, 1164, 4, 0.000000f, 100.000000f, 100.000000f, 5.000000f, "Inner Edge Highlight"));
-		Params.push_back(ShaderParam("HSM_BZL_AMBIENT_LIGHTING_MULTIPLIER", 0, 1168, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Bezel Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_BZL_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1172, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_FRM_USE_INDEPENDENT_COLOR", 0, 1176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Independent Frame Color"));
-		Params.push_back(ShaderParam("HSM_FRM_COLOR_HUE", 0, 1180, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
-		Params.push_back(ShaderParam("HSM_FRM_COLOR_SATURATION", 0, 1184, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_FRM_COLOR_VALUE", 0, 1188, 4, 0.000000f, 100.000000f, 10.000000f, 0.200000f, "Value/Brightness - Def 10"));
-		Params.push_back(ShaderParam("HSM_FRM_NOISE", 0, 1192, 4, 0.000000f, 100.000000f, 30.000000f, 1.000000f, "Noise - Def 30"));
-		Params.push_back(ShaderParam("HSM_FRM_OUTER_CURVATURE_SCALE", 0, 1196, 4, 0.000000f, 500.000000f, 0.000000f, 5.000000f, "Frame Outer Curvature Scale"));
-		Params.push_back(ShaderParam("HSM_FRM_THICKNESS", 0, 1200, 4, 0.000000f, 2000.000000f, 100.000000f, 5.000000f, "Frame Thickness"));
-		Params.push_back(ShaderParam("HSM_FRM_THICKNESS_SCALE_X", 0, 1204, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Frame Thickness Scale X"));
-		Params.push_back(ShaderParam("HSM_FRM_OUTER_POS_Y", 0, 1208, 4, -100.000000f, 100.000000f, 0.000000f, 0.050000f, "Frame Outer Pos Y"));
-		Params.push_back(ShaderParam("HSM_FRM_INNER_EDGE_THICKNESS", 0, 1212, 4, 0.000000f, 5000.000000f, 100.000000f, 5.000000f, "Inner Edge Thickness"));
-		Params.push_back(ShaderParam("HSM_FRM_INNER_EDGE_HIGHLIGHT", 0, 1216, 4, 0.000000f, 100.000000f, 14.000000f, 1.000000f, "Inner Edge Highlight"));
-		Params.push_back(ShaderParam("HSM_FRM_OUTER_EDGE_THICKNESS", 0, 1220, 4, 0.000000f, 1000.000000f, 100.000000f, 10.000000f, "Outer Edge Thickness"));
-		Params.push_back(ShaderParam("HSM_FRM_OUTER_EDGE_SHADING", 0, 1224, 4, 0.000000f, 100.000000f, 50.000000f, 5.000000f, "Outer Edge Shading"));
-		Params.push_back(ShaderParam("HSM_FRM_OUTER_CORNER_RADIUS", 0, 1228, 4, 0.000000f, 70.000000f, 5.000000f, 0.050000f, "Outer Corner Radius"));
-		Params.push_back(ShaderParam("HSM_BZL_OUTER_POSITION_Y", 0, 1232, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Outer Edge Position Y"));
-		Params.push_back(ShaderParam("HSM_FRM_SHADOW_OPACITY", 0, 1236, 4, 0.000000f, 300.000000f, 100.000000f, 1.000000f, "Shadow Opacity"));
-		Params.push_back(ShaderParam("HSM_FRM_SHADOW_WIDTH", 0, 1240, 4, 0.000000f, 500.000000f, 100.000000f, 1.000000f, "Shadow Width"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_FADE", 0, 1244, 4, 1.000000f, 100.000000f, 10.000000f, 0.500000f, "Corner Fade"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_INNER_SPREAD", 0, 1248, 4, 0.000000f, 1000.000000f, 500.000000f, 10.000000f, "Corner Inner Spread"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_OUTER_SPREAD", 0, 1252, 4, 0.000000f, 1000.000000f, 160.000000f, 10.000000f, "Corner Outer Spread"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_ROTATION_OFFSET_TOP", 0, 1256, 4, -90.000000f, 90.000000f, 0.000000f, 0.500000f, "Corner Rotation Offset Top"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_ROTATION_OFFSET_BOTTOM", 0, 1260, 4, -90.000000f, 90.000000f, 0.000000f, 0.500000f, "Corner Rotation Offset Bottom"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_SPREAD_FALLOFF", 0, 1264, 4, 1.000000f, 200.000000f, 100.000000f, 1.000000f, "Corner Spread Falloff"));
-		Params.push_back(ShaderParam("HSM_REFLECT_CORNER_FADE_DISTANCE", 0, 1268, 4, 1.000000f, 100.000000f, 100.000000f, 1.000000f, "Corner Fade Distance"));
-		Params.push_back(ShaderParam("HSM_REFLECT_GLOBAL_AMOUNT", 0, 1272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_GLOBAL_GAMMA_ADJUST", 0, 1276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_BEZEL_INNER_EDGE_AMOUNT", 0, 1280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_BEZEL_INNER_EDGE_FULLSCREEN_GLOW", 0, 1284, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_FRAME_INNER_EDGE_AMOUNT", 0, 1288, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_FRAME_INNER_EDGE_SHARPNESS", 0, 1292, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_SHOW_TUBE_FX_AMOUNT", 0, 1296, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_DIRECT_AMOUNT", 0, 1300, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_DIFFUSED_AMOUNT", 0, 1304, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_FULLSCREEN_GLOW", 0, 1308, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_FULLSCREEN_GLOW_GAMMA", 0, 1312, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_FADE_AMOUNT", 0, 1316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_RADIAL_FADE_WIDTH", 0, 1320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_RADIAL_FADE_HEIGHT", 0, 1324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_LATERAL_OUTER_FADE_POSITION", 0, 1328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_LATERAL_OUTER_FADE_DISTANCE", 0, 1332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_NOISE_AMOUNT", 0, 1336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_NOISE_SAMPLES", 0, 1340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_NOISE_SAMPLE_DISTANCE", 0, 1344, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_BLUR_NUM_SAMPLES", 0, 1348, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_BLUR_FALLOFF_DISTANCE", 0, 1352, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_BLUR_MIN", 0, 1356, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_BLUR_MAX", 0, 1360, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_MASK_IMAGE_AMOUNT", 0, 1364, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Reflection Image Mask Amount"));
-		Params.push_back(ShaderParam("HSM_REFLECT_MASK_FOLLOW_LAYER", 0, 1368, 4, 0.000000f, 7.000000f, 4.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL |BG|DEVICE|DECAL|CAB|TOP"));
-		Params.push_back(ShaderParam("HSM_REFLECT_MASK_FOLLOW_MODE", 0, 1372, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_REFLECT_MASK_BRIGHTNESS", 0, 1376, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Mask Brightness"));
-		Params.push_back(ShaderParam("HSM_REFLECT_MASK_BLACK_LEVEL", 0, 1380, 4, -100.000000f, 100.000000f, 0.000000f, 0.500000f, "Mask Black Level"));
-		Params.push_back(ShaderParam("HSM_REFLECT_MASK_MIPMAPPING_BLEND_BIAS", 0, 1384, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_GLASS_BORDER_ON", 0, 1388, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_VIGNETTE_AMOUNT", 0, 1392, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_REFLECT_VIGNETTE_SIZE", 0, 1396, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_POTATO_SHOW_BG_OVER_SCREEN", 0, 1400, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_POTATO_COLORIZE_CRT_WITH_BG", 0, 1404, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_POTATO_COLORIZE_BRIGHTNESS", 0, 1408, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_STANDARD_DECAL_SCALE_WITH_FRAME", 0, 1412, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_STANDARD_TOP_SCALE_WITH_FRAME", 0, 1416, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_BG_LAYER_ORDER", 0, 1420, 4, 0.000000f, 12.000000f, 0.000000f, 1.000000f, "Background Layer"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_LAYER_ORDER", 0, 1424, 4, 0.000000f, 12.000000f, 1.000000f, 1.000000f, "Viewport Vignette"));
-		Params.push_back(ShaderParam("HSM_CRT_LAYER_ORDER", 0, 1428, 4, 0.000000f, 12.000000f, 5.000000f, 1.000000f, "CRT Screen Bezel & Frame"));
-		Params.push_back(ShaderParam("HSM_DEVICE_LAYER_ORDER", 0, 1432, 4, 0.000000f, 12.000000f, 3.000000f, 1.000000f, "Device Layer"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_LAYER_ORDER", 0, 1436, 4, 0.000000f, 12.000000f, 4.000000f, 1.000000f, "Device LED Layer"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_LAYER_ORDER", 0, 1440, 4, 0.000000f, 12.000000f, 9.000000f, 1.000000f, "Cabinet Glass Layer"));
-		Params.push_back(ShaderParam("HSM_DECAL_LAYER_ORDER", 0, 1444, 4, 0.000000f, 12.000000f, 7.000000f, 1.000000f, "Decal Layer"));
-		Params.push_back(ShaderParam("HSM_LED_LAYER_ORDER", 0, 1448, 4, 0.000000f, 12.000000f, 2.000000f, 1.000000f, "LED Layer"));
-		Params.push_back(ShaderParam("HSM_TOP_LAYER_ORDER", 0, 1452, 4, 0.000000f, 12.000000f, 12.000000f, 1.000000f, "Top Layer"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_ASPECT_MODE", 0, 1456, 4, 0.000000f, 5.000000f, 4.000000f, 1.000000f, "Cutout Aspect- FULL | EXPL. | 4:3 | 3:4 | 16:9 | 9:16"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_EXPLICIT_ASPECT", 0, 1460, 4, 0.010000f, 3.000000f, 1.333330f, 0.010000f, "Explicit Aspect"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_FOLLOW_LAYER", 0, 1464, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BZL | BG | DEVICE | DECAL"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_FOLLOW_FULL_USES_ZOOM", 0, 1468, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_SCALE", 0, 1472, 4, -100.000000f, 200.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_SCALE_X", 0, 1476, 4, -100.000000f, 200.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_CORNER_RADIUS", 0, 1480, 4, 0.000000f, 70.000000f, 0.000000f, 1.000000f, "Corner Radius - Def 0"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_POS_X", 0, 1484, 4, -100.000000f, 200.000000f, 0.000000f, 0.050000f, "Position XY"));
-		Params.push_back(ShaderParam("HSM_CUTOUT_POS_Y", 0, 1488, 4, -100.000000f, 200.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_BG_OPACITY", 0, 1492, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_BG_HUE", 0, 1496, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_BG_COLORIZE_ON", 0, 1500, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize On"));
-		Params.push_back(ShaderParam("HSM_BG_SATURATION", 0, 1504, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_BG_BRIGHTNESS", 0, 1508, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_BG_GAMMA", 0, 1512, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_BG_AMBIENT_LIGHTING_MULTIPLIER", 0, 1516, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_BG_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1520, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_BG_APPLY_AMBIENT_IN_ADD_MODE", 0, 1524, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_BG_BLEND_MODE", 0, 1528, 4, -1.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_BG_SOURCE_MATTE_TYPE", 0, 1532, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_BG_MASK_MODE", 0, 1536, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_BG_CUTOUT_MODE", 0, 1540, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_BG_DUALSCREEN_VIS_MODE", 0, 1544, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_BG_FOLLOW_LAYER", 0, 1548, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL"));
-		Params.push_back(ShaderParam("HSM_BG_FOLLOW_MODE", 0, 1552, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_BG_FOLLOW_FULL_USES_ZOOM", 0, 1556, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_BG_FILL_MODE", 0, 1560, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_BG_SPLIT_PRESERVE_CENTER", 0, 1564, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_BG_SPLIT_REPEAT_WIDTH", 0, 1568, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_BG_SCALE", 0, 1572, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_BG_SCALE_X", 0, 1576, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_BG_POS_X", 0, 1580, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_BG_POS_Y", 0, 1584, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_BG_WRAP_MODE", 0, 1588, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Wrap Mode: NONE | TILED | MIRRORED"));
-		Params.push_back(ShaderParam("HSM_BG_MIPMAPPING_BLEND_BIAS", 0, 1592, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_OPACITY", 0, 1596, 4, 0.000000f, 100.000000f, 0.000000f, 2.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_MASK_MODE", 0, 1600, 4, 0.000000f, 8.000000f, 5.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_CUTOUT_MODE", 0, 1604, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_FOLLOW_LAYER", 0, 1608, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer- FULL | BG | TUBE | BZL"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_SCALE", 0, 1612, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_SCALE_X", 0, 1616, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_POS_X", 0, 1620, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_POS_Y", 0, 1624, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_LED_OPACITY", 0, 1628, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_LED_HUE", 0, 1632, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_LED_COLORIZE_ON", 0, 1636, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
-		Params.push_back(ShaderParam("HSM_LED_SATURATION", 0, 1640, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_LED_BRIGHTNESS", 0, 1644, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_LED_GAMMA", 0, 1648, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_LED_AMBIENT_LIGHTING_MULTIPLIER", 0, 1652, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_LED_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1656, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_LED_APPLY_AMBIENT_IN_ADD_MODE", 0, 1660, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_LED_BLEND_MODE", 0, 1664, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_LED_SOURCE_MATTE_TYPE", 0, 1668, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_LED_MASK_MODE", 0, 1672, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_LED_CUTOUT_MODE", 0, 1676, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_LED_DUALSCREEN_VIS_MODE", 0, 1680, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_LED_FOLLOW_LAYER", 0, 1684, 4, 0.000000f, 4.000000f, 3.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE"));
-		Params.push_back(ShaderParam("HSM_LED_FOLLOW_MODE", 0, 1688, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_LED_FOLLOW_FULL_USES_ZOOM", 0, 1692, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_LED_FILL_MODE", 0, 1696, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_LED_SPLIT_PRESERVE_CENTER", 0, 1700, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_LED_SPLIT_REPEAT_WIDTH", 0, 1704, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_LED_SCALE", 0, 1708, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_LED_SCALE_X", 0, 1712, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_LED_POS_X", 0, 1716, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_LED_POS_Y", 0, 1720, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_LED_MIPMAPPING_BLEND_BIAS", 0, 1724, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_DEVICE_OPACITY", 0, 1728, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_DEVICE_HUE", 0, 1732, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_DEVICE_COLORIZE_ON", 0, 1736, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
-		Params.push_back(ShaderParam("HSM_DEVICE_SATURATION", 0, 1740, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_DEVICE_BRIGHTNESS", 0, 1744, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_DEVICE_GAMMA", 0, 1748, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_DEVICE_AMBIENT_LIGHTING_MULTIPLIER", 0, 1752, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_DEVICE_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1756, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_DEVICE_APPLY_AMBIENT_IN_ADD_MODE", 0, 1760, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_DEVICE_BLEND_MODE", 0, 1764, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_DEVICE_SOURCE_MATTE_TYPE", 0, 1768, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_DEVICE_MASK_MODE", 0, 1772, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_DEVICE_CUTOUT_MODE", 0, 1776, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_DEVICE_DUALSCREEN_VIS_MODE", 0, 1780, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_DEVICE_FOLLOW_LAYER", 0, 1784, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG"));
-		Params.push_back(ShaderParam("HSM_DEVICE_FOLLOW_MODE", 0, 1788, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_DEVICE_FOLLOW_FULL_USES_ZOOM", 0, 1792, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_DEVICE_FILL_MODE", 0, 1796, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_DEVICE_SPLIT_PRESERVE_CENTER", 0, 1800, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_DEVICE_SPLIT_REPEAT_WIDTH", 0, 1804, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_DEVICE_SCALE", 0, 1808, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_DEVICE_SCALE_X", 0, 1812, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_DEVICE_POS_X", 0, 1816, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_DEVICE_POS_Y", 0, 1820, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_DEVICE_MIPMAPPING_BLEND_BIAS", 0, 1824, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_OPACITY", 0, 1828, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_HUE", 0, 1832, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_COLORIZE_ON", 0, 1836, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_SATURATION", 0, 1840, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_BRIGHTNESS", 0, 1844, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_GAMMA", 0, 1848, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_AMBIENT_LIGHTING_MULTIPLIER", 0, 1852, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1856, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_APPLY_AMBIENT_IN_ADD_MODE", 0, 1860, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_BLEND_MODE", 0, 1864, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_SOURCE_MATTE_TYPE", 0, 1868, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_MASK_MODE", 0, 1872, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_CUTOUT_MODE", 0, 1876, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_DUALSCREEN_VIS_MODE", 0, 1880, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_FOLLOW_LAYER", 0, 1884, 4, 0.000000f, 4.000000f, 4.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_FOLLOW_MODE", 0, 1888, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_FOLLOW_FULL_USES_ZOOM", 0, 1892, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_FILL_MODE", 0, 1896, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_SPLIT_PRESERVE_CENTER", 0, 1900, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_SPLIT_REPEAT_WIDTH", 0, 1904, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_SCALE", 0, 1908, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_SCALE_X", 0, 1912, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_POS_X", 0, 1916, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_POS_Y", 0, 1920, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_DEVICELED_MIPMAPPING_BLEND_BIAS", 0, 1924, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_FRM_OPACITY", 0, 1928, 4, 0.000000f, 100.000000f, 100.000000f, 5.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_FRM_BLEND_MODE", 0, 1932, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_FRM_TEXTURE_OPACITY", 0, 1936, 4, 0.000000f, 100.000000f, 1.500000f, 0.100000f, "Texture Overlay Opacity (Highlight)"));
-		Params.push_back(ShaderParam("HSM_FRM_TEXTURE_BLEND_MODE", 0, 1940, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Texture Overlay Blend Mode - Off | Normal | Add | Mult"));
-		Params.push_back(ShaderParam("HSM_DECAL_OPACITY", 0, 1944, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_DECAL_HUE", 0, 1948, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_DECAL_COLORIZE_ON", 0, 1952, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
-		Params.push_back(ShaderParam("HSM_DECAL_SATURATION", 0, 1956, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_DECAL_BRIGHTNESS", 0, 1960, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_DECAL_GAMMA", 0, 1964, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_DECAL_AMBIENT_LIGHTING_MULTIPLIER", 0, 1968, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_DECAL_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1972, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_DECAL_APPLY_AMBIENT_IN_ADD_MODE", 0, 1976, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_DECAL_BLEND_MODE", 0, 1980, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode -  OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_DECAL_SOURCE_MATTE_TYPE", 0, 1984, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_DECAL_MASK_MODE", 0, 1988, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_DECAL_CUTOUT_MODE", 0, 1992, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_DECAL_DUALSCREEN_VIS_MODE", 0, 1996, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_DECAL_FOLLOW_LAYER", 0, 2000, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE"));
-		Params.push_back(ShaderParam("HSM_DECAL_FOLLOW_MODE", 0, 2004, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_DECAL_FOLLOW_FULL_USES_ZOOM", 0, 2008, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_DECAL_FILL_MODE", 0, 2012, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_DECAL_SPLIT_PRESERVE_CENTER", 0, 2016, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_DECAL_SPLIT_REPEAT_WIDTH", 0, 2020, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_DECAL_SCALE", 0, 2024, 4, 1.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_DECAL_SCALE_X", 0, 2028, 4, 50.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_DECAL_POS_X", 0, 2032, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_DECAL_POS_Y", 0, 2036, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_DECAL_MIPMAPPING_BLEND_BIAS", 0, 2040, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_OPACITY", 0, 2044, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_HUE", 0, 2048, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_COLORIZE_ON", 0, 2052, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_SATURATION", 0, 2056, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_BRIGHTNESS", 0, 2060, 4, 0.000000f, 400.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_GAMMA", 0, 2064, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_AMBIENT_LIGHTING_MULTIPLIER", 0, 2068, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_AMBIENT2_LIGHTING_MULTIPLIER", 0, 2072, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_APPLY_AMBIENT_IN_ADD_MODE", 0, 2076, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_BLEND_MODE", 0, 2080, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_SOURCE_MATTE_TYPE", 0, 2084, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_MASK_MODE", 0, 2088, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_CUTOUT_MODE", 0, 2092, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_DUALSCREEN_VIS_MODE", 0, 2096, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_FOLLOW_LAYER", 0, 2100, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer- FULL | TUBE | BEZEL | BG | DEVICE | DECAL"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_FOLLOW_MODE", 0, 2104, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_FOLLOW_FULL_USES_ZOOM", 0, 2108, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_FILL_MODE", 0, 2112, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_SPLIT_PRESERVE_CENTER", 0, 2116, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_SPLIT_REPEAT_WIDTH", 0, 2120, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_SCALE", 0, 2124, 4, 10.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_SCALE_X", 0, 2128, 4, 0.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_POS_X", 0, 2132, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_POS_Y", 0, 2136, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_CAB_GLASS_MIPMAPPING_BLEND_BIAS", 0, 2140, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_TOP_OPACITY", 0, 2144, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Opacity"));
-		Params.push_back(ShaderParam("HSM_TOP_HUE", 0, 2148, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
-		Params.push_back(ShaderParam("HSM_TOP_COLORIZE_ON", 0, 2152, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
-		Params.push_back(ShaderParam("HSM_TOP_SATURATION", 0, 2156, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("HSM_TOP_BRIGHTNESS", 0, 2160, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
-		Params.push_back(ShaderParam("HSM_TOP_GAMMA", 0, 2164, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
-		Params.push_back(ShaderParam("HSM_TOP_AMBIENT_LIGHTING_MULTIPLIER", 0, 2168, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TOP_AMBIENT2_LIGHTING_MULTIPLIER", 0, 2172, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
-		Params.push_back(ShaderParam("HSM_TOP_APPLY_AMBIENT_IN_ADD_MODE", 0, 2176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
-		Params.push_back(ShaderParam("HSM_TOP_BLEND_MODE", 0, 2180, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
-		Params.push_back(ShaderParam("HSM_TOP_SOURCE_MATTE_TYPE", 0, 2184, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
-		Params.push_back(ShaderParam("HSM_TOP_MASK_MODE", 0, 2188, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_TOP_CUTOUT_MODE", 0, 2192, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
-		Params.push_back(ShaderParam("HSM_TOP_DUALSCREEN_VIS_MODE", 0, 2196, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
-		Params.push_back(ShaderParam("HSM_TOP_FOLLOW_LAYER", 0, 2200, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE | DECAL"));
-		Params.push_back(ShaderParam("HSM_TOP_FOLLOW_MODE", 0, 2204, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
-		Params.push_back(ShaderParam("HSM_TOP_FOLLOW_FULL_USES_ZOOM", 0, 2208, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
-		Params.push_back(ShaderParam("HSM_TOP_FILL_MODE", 0, 2212, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
-		Params.push_back(ShaderParam("HSM_TOP_SPLIT_PRESERVE_CENTER", 0, 2216, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
-		Params.push_back(ShaderParam("HSM_TOP_SPLIT_REPEAT_WIDTH", 0, 2220, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
-		Params.push_back(ShaderParam("HSM_TOP_SCALE", 0, 2224, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
-		Params.push_back(ShaderParam("HSM_TOP_SCALE_X", 0, 2228, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
-		Params.push_back(ShaderParam("HSM_TOP_POS_X", 0, 2232, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
-		Params.push_back(ShaderParam("HSM_TOP_POS_Y", 0, 2236, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
-		Params.push_back(ShaderParam("HSM_TOP_MIRROR_WRAP", 0, 2240, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mirror Wrap"));
-		Params.push_back(ShaderParam("HSM_TOP_MIPMAPPING_BLEND_BIAS", 0, 2244, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
-		Params.push_back(ShaderParam("HSM_RENDER_SIMPLE_MODE", 0, 2248, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Mode:  NORM | BLACK-SCREEN | BLACK-BG | PINK-MASK| BW-MASK"));
-		Params.push_back(ShaderParam("HSM_RENDER_SIMPLE_MASK_TYPE", 0, 2252, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Mask Type:  SCREEN | TUBE | BEZEL & FRAME | BEZEL | FRAME"));
-		Params.push_back(ShaderParam("HSM_LAYERING_DEBUG_MASK_MODE", 0, 2256, 4, -2.000000f, 8.000000f, -1.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_BLEND_MODE", 0, 2260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_FLIP_VERTICAL", 0, 2264, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_NOISE_BLEND_MODE", 0, 2268, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_NOISE_HOLD", 0, 2272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_NOISE_FADE_OUT", 0, 2276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_BLACK_HOLD", 0, 2280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_BLACK_FADE_OUT", 0, 2284, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_BLEND_MODE", 0, 2288, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_OVER_SOLID_COLOR", 0, 2292, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_PLACEMENT", 0, 2296, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_HEIGHT", 0, 2300, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_POS_X", 0, 2304, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_POS_Y", 0, 2308, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_WHEN_TO_SHOW", 0, 2312, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SPEED", 0, 2316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_WAIT", 0, 2320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_FADE_IN", 0, 2324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_HOLD", 0, 2328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_LOGO_FADE_OUT", 0, 2332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_HUE", 0, 2336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_SAT", 0, 2340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_VALUE", 0, 2344, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_HOLD", 0, 2348, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_FADE_OUT", 0, 2352, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GAMMA_INPUT", 0, 2356, 4, 0.100000f, 5.000000f, 2.400000f, 0.050000f, "Gamma In (Game Embedded Gamma) Def 2.4"));
-		Params.push_back(ShaderParam("gamma_out", 0, 2360, 4, 0.100000f, 5.000000f, 2.400000f, 0.050000f, "Gamma Out (Electron Gun Gamma) Def 2.4"));
-		Params.push_back(ShaderParam("post_br", 0, 2364, 4, 0.010000f, 5.000000f, 1.000000f, 0.010000f, "Post CRT Brightness"));
-		Params.push_back(ShaderParam("post_br_affect_black_level", 0, 2368, 4, 0.000000f, 100.000000f, 100.000000f, 10.000000f, "Post CRT Brightness Affects Grade Black Level"));
-		Params.push_back(ShaderParam("m_glow", 0, 2372, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("m_glow_low", 0, 2376, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("m_glow_high", 0, 2380, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("m_glow_dist", 0, 2384, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("m_glow_mask", 0, 2388, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("smask_mit", 0, 2392, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bmask", 0, 2396, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bmask1", 0, 2400, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hmask1", 0, 2404, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("glow", 0, 2408, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bloom", 0, 2412, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_bloom", 0, 2416, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bloom_dist", 0, 2420, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("halation", 0, 2424, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("TATE", 0, 2428, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("IOS", 0, 2432, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_ON", 0, 2436, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Raster Bloom ON -- (Scaling based on average luma)"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_MODE", 0, 2440, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Raster Bloom Overscan Mode"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_AMOUNT", 0, 2444, 4, 0.000000f, 20.000000f, 5.000000f, 1.000000f, "Raster Bloom %"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_NEUTRAL_RANGE", 0, 2448, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Raster Bloom Overscan Neutral Area"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_NEUTRAL_RANGE_CENTER", 0, 2452, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Raster Bloom Overscan Neutral Area Center"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_AMOUNT", 0, 2456, 4, -50.000000f, 100.000000f, 0.000000f, 0.500000f, "Overscan %"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_X", 0, 2460, 4, -50.000000f, 100.000000f, 0.000000f, 0.500000f, "Overscan X %"));
-		Params.push_back(ShaderParam("HSM_OVERSCAN_Y", 0, 2464, 4, -50.000000f, 100.000000f, 0.000000f, 0.500000f, "Overscan Y %"));
-		Params.push_back(ShaderParam("prescalex", 0, 2468, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("c_shape", 0, 2472, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("sborder", 0, 2476, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("csize", 0, 2480, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bsize1", 0, 2484, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpX", 0, 2488, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpY", 0, 2492, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gamma_c", 0, 2496, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("brightboost", 0, 2500, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("brightboost1", 0, 2504, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("clips", 0, 2508, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blendMode", 0, 2512, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gsl", 0, 2516, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scanline1", 0, 2520, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scanline2", 0, 2524, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("beam_min", 0, 2528, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("beam_max", 0, 2532, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("tds", 0, 2536, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("beam_size", 0, 2540, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("vertmask", 0, 2544, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scans", 0, 2548, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scan_falloff", 0, 2552, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("spike", 0, 2556, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ssharp", 0, 2560, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ring", 0, 2564, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("no_scanlines", 0, 2568, 4, 0.000000f, 1.500000f, 0.000000f, 0.050000f, "No-Scanline Mode (Guest Advanced Only)"));
-		Params.push_back(ShaderParam("scangamma", 0, 2572, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("rolling_scan", 0, 2576, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("h_sharp", 0, 2580, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("s_sharp", 0, 2584, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("smart_ei", 0, 2588, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ei_limit", 0, 2592, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("sth", 0, 2596, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("barspeed", 0, 2600, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("barintensity", 0, 2604, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bardir", 0, 2608, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("shadowMask", 0, 2612, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("maskstr", 0, 2616, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mcut", 0, 2620, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("maskboost", 0, 2624, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("masksize", 0, 2628, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_zoom", 0, 2632, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mzoom_sh", 0, 2636, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("masksizeautothreshold", 0, 2640, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("maskDark", 0, 2644, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("maskLight", 0, 2648, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_gamma", 0, 2652, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("slotmask", 0, 2656, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("slotmask1", 0, 2660, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("slotwidth", 0, 2664, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("double_slot", 0, 2668, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("slotms", 0, 2672, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("smoothmask", 0, 2676, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mshift", 0, 2680, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_layout", 0, 2684, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GDV_DECONVERGENCE_ON", 0, 2688, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("decons", 0, 2692, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconrr", 0, 2696, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconrg", 0, 2700, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconrb", 0, 2704, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconrry", 0, 2708, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconrgy", 0, 2712, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconrby", 0, 2716, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("deconsmooth", 0, 2720, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("dctypex", 0, 2724, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("dctypey", 0, 2728, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("dcscalemode", 0, 2732, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GDV_NOISE_ON", 0, 2736, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("addnoised", 0, 2740, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("noisetype", 0, 2744, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("noiseresd", 0, 2748, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("noiseresd4kmult", 0, 2752, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_grade_on", 0, 2756, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_Dark_to_Dim", 0, 2760, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_GCompress", 0, 2764, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("wp_temperature", 0, 2768, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_analog", 0, 2772, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_digital", 0, 2776, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_sfixes", 0, 2780, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_MD_Pal", 0, 2784, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_SMS_bl", 0, 2788, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_CRT_br", 0, 2792, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_CRT_bg", 0, 2796, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_CRT_bb", 0, 2800, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_CRT_rf", 0, 2804, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_CRT_sl", 0, 2808, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_satr", 0, 2812, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_satg", 0, 2816, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_satb", 0, 2820, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AS", 0, 2824, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("asat", 0, 2828, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_h_size", 0, 2832, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_v_size", 0, 2836, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_h_cent", 0, 2840, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_v_cent", 0, 2844, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_pin_phase", 0, 2848, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_pin_amp", 0, 2852, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("BR_LayersUnderCRTPassFeedback", 15));
-		Samplers.push_back(ShaderSampler("InfoCachePass", 1));
-		Samplers.push_back(ShaderSampler("NightLightingImage", 4));
-		Samplers.push_back(ShaderSampler("NightLighting2Image", 5));
-		Samplers.push_back(ShaderSampler("FrameTextureImage", 7));
-		Samplers.push_back(ShaderSampler("BackgroundVertImage", 3));
-		Samplers.push_back(ShaderSampler("BackgroundImage", 2));
-		Samplers.push_back(ShaderSampler("DeviceVertImage", 9));
-		Samplers.push_back(ShaderSampler("DeviceImage", 8));
-		Samplers.push_back(ShaderSampler("DeviceLEDImage", 10));
-		Samplers.push_back(ShaderSampler("LEDImage", 6));
-		Samplers.push_back(ShaderSampler("DecalImage", 11));
-		Samplers.push_back(ShaderSampler("TopLayerImage", 13));
-		Samplers.push_back(ShaderSampler("CabinetGlassImage", 12));
-		Samplers.push_back(ShaderSampler("ReflectionMaskImage", 14));
+	Name = "bezel-images-under-crt";
+	VertexByteCode = RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalFeedbackSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 112, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", 0, 128, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DerezedPassSize", 0, 144, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", 0, 160, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 164, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_RESOLUTION_DEBUG_ON", 0, 168, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show Resolution Info"));
+	Params.push_back(ShaderParam("HSM_SINDEN_BORDER_ON", 0, 172, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show Border"));
+	Params.push_back(ShaderParam("HSM_SINDEN_BORDER_OPACITY", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_SINDEN_BORDER_BRIGHTNESS", 0, 180, 4, 0.000000f, 200.000000f, 60.000000f, 5.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_SINDEN_AMBIENT_LIGHTING", 0, 184, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_SINDEN_BORDER_THICKNESS", 0, 188, 4, 0.000000f, 30.000000f, 2.000000f, 0.500000f, "Thickness"));
+	Params.push_back(ShaderParam("HSM_SINDEN_BORDER_EMPTY_TUBE_COMPENSATION", 0, 192, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Compensate Empty Tube"));
+	Params.push_back(ShaderParam("HSM_CACHE_GRAPHICS_ON", 0, 196, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Cache Graphics: OFF | ON"));
+	Params.push_back(ShaderParam("HSM_CACHE_UPDATE_INDICATOR_MODE", 0, 200, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Cache Update Indicator: OFF | ON | ONLY IF CACHE IS OFF"));
+	Params.push_back(ShaderParam("HSM_GLOBAL_GRAPHICS_BRIGHTNESS", 0, 204, 4, 0.000000f, 500.000000f, 100.000000f, 1.000000f, "Graphics Brightness"));
+	Params.push_back(ShaderParam("HSM_STATIC_LAYERS_GAMMA", 0, 208, 4, 0.010000f, 5.000000f, 1.000000f, 0.010000f, "Graphics Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_AMBIENT_LIGHTING_OPACITY", 0, 212, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient Global Opacity Multiplier"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_OPACITY", 0, 216, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient 1st Image Opacity"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_OPACITY", 0, 220, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient 2nd Image Opacity (Used for BG by Default)"));
+	Params.push_back(ShaderParam("HSM_AMBIENT_LIGHTING_SWAP_IMAGE_MODE", 0, 224, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Which Images to Use: BOTH | 1 ONLY | 2 ONLY | SWAP"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_HUE", 0, 228, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "Hue"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_SATURATION", 0, 232, 4, 0.000000f, 300.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_VALUE", 0, 236, 4, 0.000000f, 400.000000f, 120.000000f, 1.000000f, "Value"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_CONTRAST", 0, 240, 4, 0.000000f, 200.000000f, 100.000000f, 0.500000f, "Contrast"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE_KEEP_ASPECT", 0, 244, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scale Aspect - MATCH VIEWPORT | USE TEXURE ASPECT"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE_INHERIT_MODE", 0, 248, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Scale Inheritance - OFF | ZOOM | TUBE"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE", 0, 252, 4, 10.000000f, 1000.000000f, 250.000000f, 1.000000f, "Scale Offset"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_SCALE_X", 0, 256, 4, 10.000000f, 1000.000000f, 100.000000f, 0.500000f, "Scale Offset X"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_ROTATE", 0, 260, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Rotate"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_MIRROR_HORZ", 0, 264, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mirror Horizontal"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_POS_INHERIT_MODE", 0, 268, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Position Inheritance - OFF | ON"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_POSITION_X", 0, 272, 4, -1500.000000f, 1500.000000f, 0.000000f, 1.000000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_POSITION_Y", 0, 276, 4, -1500.000000f, 1500.000000f, 0.000000f, 1.000000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_AMBIENT1_DITHERING_SAMPLES", 0, 280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_HUE", 0, 284, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "Hue"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_SATURATION", 0, 288, 4, 0.000000f, 300.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_VALUE", 0, 292, 4, 0.000000f, 400.000000f, 100.000000f, 1.000000f, "Value"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_CONTRAST", 0, 296, 4, 0.000000f, 200.000000f, 100.000000f, 0.500000f, "Contrast"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE_KEEP_ASPECT", 0, 300, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scale Aspect - MATCH VIEWPORT | USE TEXURE ASPECT"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE_INHERIT_MODE", 0, 304, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Scale Inheritance - OFF | ZOOM | TUBE"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE", 0, 308, 4, 10.000000f, 1000.000000f, 100.000000f, 0.500000f, "Scale Offset"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_SCALE_X", 0, 312, 4, 10.000000f, 1000.000000f, 100.000000f, 0.500000f, "Scale Offset X"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_ROTATE", 0, 316, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Rotate"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_MIRROR_HORZ", 0, 320, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mirror Horizontal"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_POS_INHERIT_MODE", 0, 324, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Position Inheritance - OFF | ON"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_POSITION_X", 0, 328, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_AMBIENT2_POSITION_Y", 0, 332, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_ZOOM", 0, 336, 4, 10.000000f, 500.000000f, 100.000000f, 0.200000f, "Viewport Zoom"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_POSITION_X", 0, 340, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Viewport Position X"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_POSITION_Y", 0, 344, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Viewport Position Y"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_ZOOM_MASK", 0, 348, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Zoom CRT Mask"));
+	Params.push_back(ShaderParam("HSM_FLIP_VIEWPORT_VERTICAL", 0, 352, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Viewport Vertical"));
+	Params.push_back(ShaderParam("HSM_FLIP_VIEWPORT_HORIZONTAL", 0, 356, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Viewport Horizontal"));
+	Params.push_back(ShaderParam("HSM_FLIP_CORE_VERTICAL", 0, 360, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Core Image Vertical"));
+	Params.push_back(ShaderParam("HSM_FLIP_CORE_HORIZONTAL", 0, 364, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Core Image Horizontal"));
+	Params.push_back(ShaderParam("HSM_ROTATE_CORE_IMAGE", 0, 368, 4, -1.000000f, 1.000000f, 0.000000f, 1.000000f, "Rotate CRT Tube --  -1:270 | 0 | 1:90"));
+	Params.push_back(ShaderParam("HSM_ASPECT_RATIO_ORIENTATION", 0, 372, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Orientation - Auto | Horizontal | Vertical"));
+	Params.push_back(ShaderParam("HSM_ASPECT_RATIO_MODE", 0, 376, 4, 0.000000f, 6.000000f, 5.000000f, 1.000000f, "Type - Auto | Explicit | 4:3 | 3:2 | 16:9 | PAR | Full"));
+	Params.push_back(ShaderParam("HSM_ASPECT_RATIO_EXPLICIT", 0, 380, 4, 0.000000f, 8.000000f, 1.333300f, 0.002000f, "Explicit Aspect Ratio (Also Auto Ratio Fallback)"));
+	Params.push_back(ShaderParam("HSM_INT_SCALE_MODE", 0, 384, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Integer Scale Mode - OFF | ShortAxis | BothAxes"));
+	Params.push_back(ShaderParam("HSM_INT_SCALE_MULTIPLE_OFFSET", 0, 388, 4, -20.000000f, 20.000000f, 0.000000f, 1.000000f, "Integer Scale Multiple Offset"));
+	Params.push_back(ShaderParam("HSM_INT_SCALE_MULTIPLE_OFFSET_LONG", 0, 392, 4, -20.000000f, 20.000000f, 0.000000f, 1.000000f, "Integer Scale Multiple Offset on Long Axis"));
+	Params.push_back(ShaderParam("HSM_INT_SCALE_MAX_HEIGHT", 0, 396, 4, 60.000000f, 140.000000f, 89.000000f, 0.500000f, "Base Integer Scale Max Height %"));
+	Params.push_back(ShaderParam("HSM_VERTICAL_PRESET", 0, 400, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Preset is for Monitor Portrait Mode (Smaller CRT Screen)"));
+	Params.push_back(ShaderParam("HSM_NON_INTEGER_SCALE", 0, 404, 4, 1.000000f, 200.000000f, 82.970001f, 0.200000f, "Non-Integer Scale %"));
+	Params.push_back(ShaderParam("HSM_USE_PHYSICAL_SIZE_FOR_NON_INTEGER", 0, 408, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Physical Monitor and Tube Sizes for Non-Integer"));
+	Params.push_back(ShaderParam("HSM_PHYSICAL_MONITOR_ASPECT_RATIO", 0, 412, 4, 0.250000f, 5.000000f, 1.770000f, 0.010000f, "Your Monitor's Aspect Ratio"));
+	Params.push_back(ShaderParam("HSM_PHYSICAL_MONITOR_DIAGONAL_SIZE", 0, 416, 4, 1.000000f, 100.000000f, 27.000000f, 0.100000f, "Your Monitor's Size (Diagonal)"));
+	Params.push_back(ShaderParam("HSM_PHYSICAL_SIM_TUBE_DIAGONAL_SIZE", 0, 420, 4, 1.000000f, 100.000000f, 18.100000f, 0.100000f, "Simulated Tube Size (Diagonal)"));
+	Params.push_back(ShaderParam("HSM_USE_IMAGE_FOR_PLACEMENT", 0, 424, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Image For Automatic Placement (Scale and Y Pos)"));
+	Params.push_back(ShaderParam("HSM_PLACEMENT_IMAGE_USE_HORIZONTAL", 0, 428, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Auto Place Horizontal (X Pos)"));
+	Params.push_back(ShaderParam("HSM_PLACEMENT_IMAGE_MODE", 0, 432, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Placement Image Mode: TRANSPARENCY : WHITE ON BLACK"));
+	Params.push_back(ShaderParam("HSM_NON_INTEGER_SCALE_OFFSET", 0, 436, 4, 5.000000f, 400.000000f, 100.000000f, 0.100000f, "Non-Integer Scale Offset"));
+	Params.push_back(ShaderParam("HSM_USE_SNAP_TO_CLOSEST_INT_SCALE", 0, 440, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Snap to Closest Integer Scale: OFF | ON"));
+	Params.push_back(ShaderParam("HSM_SNAP_TO_CLOSEST_INT_SCALE_TOLERANCE", 0, 444, 4, 0.000000f, 300.000000f, 20.000000f, 1.000000f, "Snap To Closest Integer Scale Tolerance"));
+	Params.push_back(ShaderParam("HSM_SCREEN_POSITION_X", 0, 448, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_SCREEN_POSITION_Y", 0, 452, 4, -1000.000000f, 1000.000000f, 0.000000f, 1.000000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_CROP_MODE", 0, 456, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Crop Mode  -  OFF | CROP BLACK ONLY | CROP ANY"));
+	Params.push_back(ShaderParam("HSM_CROP_PERCENT_ZOOM", 0, 460, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Zoom %"));
+	Params.push_back(ShaderParam("HSM_CROP_PERCENT_TOP", 0, 464, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Top %"));
+	Params.push_back(ShaderParam("HSM_CROP_PERCENT_BOTTOM", 0, 468, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Bottom %"));
+	Params.push_back(ShaderParam("HSM_CROP_PERCENT_LEFT", 0, 472, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Left %"));
+	Params.push_back(ShaderParam("HSM_CROP_PERCENT_RIGHT", 0, 476, 4, -50.000000f, 100.000000f, 0.000000f, 0.100000f, "Crop Right %"));
+	Params.push_back(ShaderParam("HSM_CROP_BLACK_THRESHOLD", 0, 480, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Black Threshold for 'CROP BLACK ONLY'"));
+	Params.push_back(ShaderParam("HSM_SCANLINE_DIRECTION", 0, 484, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Scanline Direction - Auto | Horiz | Vert"));
+	Params.push_back(ShaderParam("HSM_CORE_RES_SAMPLING_MULT_SCANLINE_DIR", 0, 488, 4, 25.000000f, 1600.000000f, 100.000000f, 25.000000f, "Scanline Dir Multiplier"));
+	Params.push_back(ShaderParam("HSM_DOWNSAMPLE_BLUR_SCANLINE_DIR", 0, 492, 4, 0.000000f, 200.000000f, 0.000000f, 1.000000f, "Scanline Dir Downsample Blur"));
+	Params.push_back(ShaderParam("HSM_CORE_RES_SAMPLING_MULT_OPPOSITE_DIR", 0, 496, 4, 25.000000f, 1600.000000f, 100.000000f, 25.000000f, "Opposite Dir Multiplier"));
+	Params.push_back(ShaderParam("HSM_DOWNSAMPLE_BLUR_OPPOSITE_DIR", 0, 500, 4, 0.000000f, 200.000000f, 0.000000f, 1.000000f, "Opposite Dir Downsample Blur"));
+	Params.push_back(ShaderParam("HSM_CORE_RES_SAMPLING_SHIFT_OPPOSITE_DIR", 0, 504, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTERLACE_TRIGGER_RES", 0, 508, 4, 100.000000f, 2000.000000f, 375.000000f, 25.000000f, "Trigger Res for Interlace, Fake Scanlines & VGA"));
+	Params.push_back(ShaderParam("HSM_INTERLACE_MODE", 0, 512, 4, -1.000000f, 5.000000f, 4.000000f, 1.000000f, "Interlace Mode:"));
+	Params.push_back(ShaderParam("HSM_INTERLACE_EFFECT_SMOOTHNESS_INTERS", 0, 516, 4, 0.000000f, 100.000000f, 0.000000f, 10.000000f, "Interlace Effect Smoothness"));
+	Params.push_back(ShaderParam("HSM_INTERLACE_SCANLINE_EFFECT", 0, 520, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Interlace Scanline Effect ('Laced brightness)"));
+	Params.push_back(ShaderParam("iscans", 0, 524, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Interlace (Scanline) Saturation"));
+	Params.push_back(ShaderParam("vga_mode", 0, 528, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VGA Single/Double Scan mode"));
+	Params.push_back(ShaderParam("hiscan", 0, 532, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "High Resolution Scanlines (ScaleFx or XBR Only)"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_MODE", 0, 536, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Show Fake Scanlines - OFF | ON | USE TRIGGER RES"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_OPACITY", 0, 540, 4, 0.000000f, 100.000000f, 0.000000f, 5.000000f, "Opacity - Def 70"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_RES_MODE", 0, 544, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scan Resolution Mode: AUTO (CORE RES) : EXPLICIT"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_RES", 0, 548, 4, 0.000000f, 480.000000f, 240.000000f, 8.000000f, "Explicit Scan Resolution"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_INT_SCALE", 0, 552, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Int Scale Scanlines"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_ROLL", 0, 556, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Rolling Scanline"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_CURVATURE", 0, 560, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Scanline Curvature"));
+	Params.push_back(ShaderParam("HSM_FAKE_SCANLINE_BRIGHTNESS_CUTOFF", 0, 564, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_MODE", 0, 568, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Mode - OFF | VERTICAL | HORIZONTAL"));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_CORE_IMAGE_SPLIT_MODE", 0, 572, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Core Image Split Mode  - AUTO | VERTICAL | HORIZONTAL"));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_CORE_IMAGE_SWAP_SCREENS", 0, 576, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Core Image Swap Screen Content"));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_CORE_IMAGE_SPLIT_OFFSET", 0, 580, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Core Image Split Offset"));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_VIEWPORT_SPLIT_LOCATION", 0, 584, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Viewport Split Offset"));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_SHIFT_POSITION_WITH_SCALE", 0, 588, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scale Screens from Center of Split"));
+	Params.push_back(ShaderParam("HSM_DUALSCREEN_POSITION_OFFSET_BETWEEN_SCREENS", 0, 592, 4, -250.000000f, 250.000000f, 0.000000f, 0.200000f, "Position Offset Between Screens"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_ASPECT_RATIO_MODE", 0, 596, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "2nd Screen Aspect Ratio Mode - Same as 1st Screen | PAR"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_INDEPENDENT_SCALE", 0, 600, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "2nd Screen Use Independent Scale"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_SCALE_OFFSET", 0, 604, 4, 1.000000f, 500.000000f, 100.000000f, 0.500000f, "2nd Screen Scale Offset"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_POS_X", 0, 608, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "2nd Screen Pos X"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_POS_Y", 0, 612, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "2nd Screen Pos Y"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_ZOOM", 0, 616, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Zoom %"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_TOP", 0, 620, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Top %"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_BOTTOM", 0, 624, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Bottom %"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_LEFT", 0, 628, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Left %"));
+	Params.push_back(ShaderParam("HSM_2ND_SCREEN_CROP_PERCENT_RIGHT", 0, 632, 4, -10.000000f, 100.000000f, 0.000000f, 0.100000f, "2nd Screen Crop Right %"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_MODE", 0, 636, 4, 0.000000f, 5.000000f, 1.000000f, 1.000000f, "Curvature Mode  OFF | 2D | 2D-CYL | 3D-1 | 3D-2 | 3D CYL"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_2D_SCALE_LONG_AXIS", 0, 640, 4, 5.000000f, 400.000000f, 100.000000f, 5.000000f, "2D Curvature on Long Axis"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_2D_SCALE_SHORT_AXIS", 0, 644, 4, 5.000000f, 400.000000f, 100.000000f, 5.000000f, "2D Curvature on Short Axis"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_3D_RADIUS", 0, 648, 4, 16.000000f, 102400.000000f, 200.000000f, 1.000000f, "3D Radius"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_3D_VIEW_DIST", 0, 652, 4, 50.000000f, 102400.000000f, 150.000000f, 5.000000f, "3D View Distance - Def 150"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_3D_TILT_ANGLE_X", 0, 656, 4, -120.000000f, 120.000000f, 0.000000f, 1.000000f, "3D Tilt Angle X"));
+	Params.push_back(ShaderParam("HSM_CURVATURE_3D_TILT_ANGLE_Y", 0, 660, 4, -120.000000f, 120.000000f, 0.000000f, 1.000000f, "3D Tilt Angle Y"));
+	Params.push_back(ShaderParam("HSM_CRT_CURVATURE_SCALE", 0, 664, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "CRT Curvature Scale Multiplier: 0 = Less Moire Artifacts"));
+	Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_ON", 0, 668, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Signal Noise ON"));
+	Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_AMOUNT", 0, 672, 4, -1.000000f, 1.000000f, 0.200000f, 0.020000f, "Amount"));
+	Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_BLACK_LEVEL", 0, 676, 4, 0.000000f, 300.000000f, 100.000000f, 5.000000f, "Contrast"));
+	Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_SIZE_MODE", 0, 680, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Noise Resolution Mode:  SCANLINE | CORE | SMOOTHED"));
+	Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_SIZE_MULT", 0, 684, 4, 0.500000f, 4.000000f, 0.500000f, 0.500000f, "Size Mult"));
+	Params.push_back(ShaderParam("HSM_SIGNAL_NOISE_TYPE", 0, 688, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Noise Type:  LUMA ADD | COLORED"));
+	Params.push_back(ShaderParam("HSM_ANTI_FLICKER_ON", 0, 692, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Anti-Flicker ON"));
+	Params.push_back(ShaderParam("HSM_ANTI_FLICKER_THRESHOLD", 0, 696, 4, 0.000000f, 100.000000f, 25.000000f, 5.000000f, "Luma Difference Threshold"));
+	Params.push_back(ShaderParam("HSM_AB_COMPARE_SHOW_MODE", 0, 700, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show:  CRT SHADER | ORIGINAL"));
+	Params.push_back(ShaderParam("HSM_AB_COMPARE_AREA", 0, 704, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Compare Area:  LEFT | RIGHT | TOP | BOTTOM"));
+	Params.push_back(ShaderParam("HSM_AB_COMPARE_FREEZE_CRT_TUBE", 0, 708, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Freeze CRT Tube (Freeze Left, New changes on Right)"));
+	Params.push_back(ShaderParam("HSM_AB_COMPARE_FREEZE_GRAPHICS", 0, 712, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Freeze Graphics (Freeze Left, New changes on Right)"));
+	Params.push_back(ShaderParam("HSM_AB_COMPARE_SPLIT_AREA", 0, 716, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_AB_COMPARE_SPLIT_POSITION", 0, 720, 4, 0.000000f, 100.000000f, 50.000000f, 0.200000f, "Splitscreen Position"));
+	Params.push_back(ShaderParam("HSM_SHOW_PASS_INDEX", 0, 724, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Show Pass Index"));
+	Params.push_back(ShaderParam("HSM_SHOW_PASS_ALPHA", 0, 728, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Show Alpha Channel"));
+	Params.push_back(ShaderParam("HSM_SHOW_PASS_APPLY_SCREEN_COORD", 0, 732, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Screen Scale & Curvature to Unscaled Passes"));
+	Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_ON", 0, 736, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Use Vignette"));
+	Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_DUALSCREEN_VIS_MODE", 0, 740, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_STRENGTH", 0, 744, 4, 0.000000f, 98.000000f, 40.000000f, 2.000000f, "Amount (Strength)"));
+	Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_POWER", 0, 748, 4, 0.000000f, 200.000000f, 26.000000f, 2.000000f, "Corner Amount (Power)"));
+	Params.push_back(ShaderParam("HSM_SCREEN_VIGNETTE_IN_REFLECTION", 0, 752, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Amount of Vignette in Reflection"));
+	Params.push_back(ShaderParam("HSM_MONOCHROME_MODE", 0, 756, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Monochrome Color: OFF | BW | AMBER | GREEN"));
+	Params.push_back(ShaderParam("HSM_MONOCHROME_BRIGHTNESS", 0, 760, 4, 1.000000f, 500.000000f, 100.000000f, 1.000000f, "Monochrome Brightness"));
+	Params.push_back(ShaderParam("HSM_MONOCHROME_GAMMA", 0, 764, 4, 0.100000f, 5.000000f, 1.000000f, 0.100000f, "Monochrome Gamma"));
+	Params.push_back(ShaderParam("HSM_MONOCHROME_HUE_OFFSET", 0, 768, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "Monochrome Hue Offset"));
+	Params.push_back(ShaderParam("HSM_MONOCHROME_SATURATION", 0, 772, 4, -100.000000f, 200.000000f, 100.000000f, 1.000000f, "Monochrome Saturation"));
+	Params.push_back(ShaderParam("HSM_MONOCHROME_DUALSCREEN_VIS_MODE", 0, 776, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_SCREEN_REFLECTION_SCALE", 0, 780, 4, 1.000000f, 300.000000f, 100.000000f, 1.000000f, "Screen Reflection Scale"));
+	Params.push_back(ShaderParam("HSM_SCREEN_REFLECTION_POS_X", 0, 784, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Screen Reflection Pos X"));
+	Params.push_back(ShaderParam("HSM_SCREEN_REFLECTION_POS_Y", 0, 788, 4, -100.000000f, 100.000000f, 0.000000f, 1.000000f, "Screen Reflection Pos Y"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_MODE", 0, 792, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Tube Diffuse Color - BLACK | IMAGE | TRANSPARENT"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_DUALSCREEN_VIS_MODE", 0, 796, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_TUBE_OPACITY", 0, 800, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Tube Opacity"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_AMOUNT", 0, 804, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Amount"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_HUE", 0, 808, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_COLORIZE_ON", 0, 812, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize On"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_SATURATION", 0, 816, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_BRIGHTNESS", 0, 820, 4, 0.000000f, 500.000000f, 15.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_GAMMA", 0, 824, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_AMBIENT_LIGHTING", 0, 828, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_AMBIENT2_LIGHTING", 0, 832, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_SCALE", 0, 836, 4, 0.000000f, 1000.000000f, 140.000000f, 1.000000f, "Image Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_SCALE_X", 0, 840, 4, 0.000000f, 1000.000000f, 100.000000f, 1.000000f, "Image Scale X"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_IMAGE_ROTATION", 0, 844, 4, -1.000000f, 1.000000f, 0.000000f, 1.000000f, "Image Rotation: -1: 270 | 0 | 1: 90"));
+	Params.push_back(ShaderParam("HSM_TUBE_EMPTY_THICKNESS", 0, 848, 4, 0.000000f, 6000.000000f, 0.000000f, 10.000000f, "Empty Tube Thickness"));
+	Params.push_back(ShaderParam("HSM_TUBE_EMPTY_THICKNESS_X_SCALE", 0, 852, 4, 0.000000f, 3000.000000f, 100.000000f, 1.000000f, "Empty Tube Thicknes X Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_DIFFUSE_FORCE_ASPECT", 0, 856, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Tube Aspect - EVEN | SCREEN | Explicit"));
+	Params.push_back(ShaderParam("HSM_TUBE_EXPLICIT_ASPECT", 0, 860, 4, 0.500000f, 3.000000f, 1.333300f, 0.010000f, "Explicit Tube Aspect"));
+	Params.push_back(ShaderParam("HSM_SCREEN_CORNER_RADIUS_SCALE", 0, 864, 4, 5.000000f, 3000.000000f, 100.000000f, 1.000000f, "Screen (Game Image) Corner Radius Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_ON", 0, 868, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Tube Colored Gel - OFF | ON"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_DUALSCREEN_VIS_MODE", 0, 872, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_MULTIPLY_AMOUNT", 0, 876, 4, 0.000000f, 100.000000f, 90.000000f, 1.000000f, "Multiply Blend Amount"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_NORMAL_AMOUNT", 0, 880, 4, 0.000000f, 100.000000f, 15.000000f, 1.000000f, "Blend Amount"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_NORMAL_BRIGHTNESS", 0, 884, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_NORMAL_VIGNETTE", 0, 888, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Vignette Amount"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_TRANSPARENCY_THRESHOLD", 0, 892, 4, 0.000000f, 100.000000f, 23.000000f, 1.000000f, "Transparency Threshold"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_ADDITIVE_AMOUNT", 0, 896, 4, 0.000000f, 100.000000f, 0.000000f, 0.050000f, "Additive Blend Amount"));
+	Params.push_back(ShaderParam("HSM_SHOW_CRT_ON_TOP_OF_COLORED_GEL", 0, 900, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_ON", 0, 904, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Tube Shadow Image - OFF | ON"));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_OPACITY", 0, 908, 4, 0.000000f, 100.000000f, 60.000000f, 2.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_SCALE_X", 0, 912, 4, 0.000000f, 1000.000000f, 122.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_SCALE_Y", 0, 916, 4, 0.000000f, 1000.000000f, 130.000000f, 0.100000f, "Scale Y"));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_POS_X", 0, 920, 4, -500.000000f, 500.000000f, 0.000000f, 0.100000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_IMAGE_POS_Y", 0, 924, 4, -500.000000f, 500.000000f, 9.000000f, 0.100000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_TUBE_SHADOW_CURVATURE_SCALE", 0, 928, 4, 0.000000f, 2000.000000f, 300.000000f, 1.000000f, "Curvature Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_AMBIENT_LIGHTING", 0, 932, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_AMBIENT2_LIGHTING", 0, 936, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_FAKE_SCANLINE_AMOUNT", 0, 940, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Fake Scanline Amount"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_SCALE", 0, 944, 4, 0.000000f, 1000.000000f, 100.000000f, 1.000000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_FLIP_HORIZONTAL", 0, 948, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Horizontal"));
+	Params.push_back(ShaderParam("HSM_TUBE_COLORED_GEL_IMAGE_FLIP_VERTICAL", 0, 952, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Vertical"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_REFLECTION_IMAGE_ON", 0, 956, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Tube Static Reflection Image - OFF | ON"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_REFLECTION_IMAGE_DUALSCREEN_VIS_MODE", 0, 960, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_REFLECTION_IMAGE_OPACITY", 0, 964, 4, 0.000000f, 100.000000f, 14.000000f, 0.100000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_OPACITY_DIFFUSE_MULTIPLY", 0, 968, 4, 0.000000f, 100.000000f, 25.000000f, 5.000000f, "Multiply Opacity by Diffuse Amount"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_BLACK_LEVEL", 0, 972, 4, -100.000000f, 100.000000f, 25.000000f, 0.500000f, "Black Level"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_AMBIENT_LIGHTING", 0, 976, 4, 0.000000f, 100.000000f, 60.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_AMBIENT2_LIGHTING", 0, 980, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_SCALE", 0, 984, 4, 0.000000f, 1000.000000f, 120.000000f, 1.000000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_SCALE_X", 0, 988, 4, 0.000000f, 1000.000000f, 100.000000f, 1.000000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_POS_X", 0, 992, 4, -500.000000f, 500.000000f, 10.000000f, 1.000000f, "Pos X"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_POS_Y", 0, 996, 4, -500.000000f, 500.000000f, 10.000000f, 1.000000f, "Pos Y"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_SHADOW_OPACITY", 0, 1000, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Shadow Opacity"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_DITHER_SAMPLES", 0, 1004, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Noise Samples (Reduces Banding)"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_DITHER_DISTANCE", 0, 1008, 4, 0.000000f, 10.000000f, 5.000000f, 0.500000f, "Noise Distance"));
+	Params.push_back(ShaderParam("HSM_TUBE_STATIC_DITHER_AMOUNT", 0, 1012, 4, 0.000000f, 10.000000f, 0.600000f, 0.100000f, "Noise Amount"));
+	Params.push_back(ShaderParam("HSM_CRT_BLEND_MODE", 0, 1016, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "CRT Blend Mode: OFF | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_CRT_BLEND_AMOUNT", 0, 1020, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "CRT Blend Amount"));
+	Params.push_back(ShaderParam("HSM_CRT_SCREEN_BLEND_MODE", 0, 1024, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_GLOBAL_CORNER_RADIUS", 0, 1028, 4, 4.000000f, 500.000000f, 10.000000f, 2.000000f, "Global Corner Radius - Def 10"));
+	Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_CORNER_RADIUS_SCALE", 0, 1032, 4, 10.000000f, 8000.000000f, 100.000000f, 10.000000f, "Black Edge Corner Radius Scale"));
+	Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_SHARPNESS", 0, 1036, 4, 0.000000f, 90.000000f, 70.000000f, 1.000000f, "Black Edge Sharpness - Def 70"));
+	Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_CURVATURE_SCALE", 0, 1040, 4, 20.000000f, 8000.000000f, 100.000000f, 10.000000f, "Black Edge Curvature Scale Multiplier"));
+	Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_THICKNESS", 0, 1044, 4, -800.000000f, 6000.000000f, 100.000000f, 5.000000f, "Black Edge Thickness"));
+	Params.push_back(ShaderParam("HSM_TUBE_BLACK_EDGE_THICKNESS_X_SCALE", 0, 1048, 4, 0.000000f, 3000.000000f, 100.000000f, 10.000000f, "Black Edge Thickness X Scale"));
+	Params.push_back(ShaderParam("HSM_BZL_USE_INDEPENDENT_SCALE", 0, 1052, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Independent Scale"));
+	Params.push_back(ShaderParam("HSM_BZL_INDEPENDENT_SCALE", 0, 1056, 4, 1.000000f, 200.000000f, 82.970001f, 0.100000f, "Independent Scale (When scale from image is not used)"));
+	Params.push_back(ShaderParam("HSM_BZL_USE_INDEPENDENT_CURVATURE", 0, 1060, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Independent Curvature"));
+	Params.push_back(ShaderParam("HSM_BZL_INDEPENDENT_CURVATURE_SCALE_LONG_AXIS", 0, 1064, 4, 0.000000f, 400.000000f, 100.000000f, 5.000000f, "Independent Curvature X"));
+	Params.push_back(ShaderParam("HSM_BZL_INDEPENDENT_CURVATURE_SCALE_SHORT_AXIS", 0, 1068, 4, 0.000000f, 400.000000f, 100.000000f, 5.000000f, "Independent Curvature Y"));
+	Params.push_back(ShaderParam("HSM_BZL_OPACITY", 0, 1072, 4, 0.000000f, 100.000000f, 100.000000f, 5.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_BZL_BLEND_MODE", 0, 1076, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - Off | Normal | Add | Mult"));
+	Params.push_back(ShaderParam("HSM_BZL_WIDTH", 0, 1080, 4, -250.000000f, 5000.000000f, 125.000000f, 1.000000f, "Width - Def 125"));
+	Params.push_back(ShaderParam("HSM_BZL_HEIGHT", 0, 1084, 4, -250.000000f, 5000.000000f, 100.000000f, 1.000000f, "Height"));
+	Params.push_back(ShaderParam("HSM_BZL_SCALE_OFFSET", 0, 1088, 4, 1.000000f, 200.000000f, 100.000000f, 0.100000f, "Scale Offset"));
+	Params.push_back(ShaderParam("HSM_BZL_INNER_CURVATURE_SCALE", 0, 1092, 4, 0.000000f, 8000.000000f, 100.000000f, 10.000000f, "Inner Curvature Scale Multiplier"));
+	Params.push_back(ShaderParam("HSM_BZL_INNER_CORNER_RADIUS_SCALE", 0, 1096, 4, 0.000000f, 8000.000000f, 80.000000f, 1.000000f, "Inner Corner Radius Scale - Def 80"));
+	Params.push_back(ShaderParam("HSM_BZL_OUTER_CURVATURE_SCALE", 0, 1100, 4, 0.000000f, 500.000000f, 0.000000f, 5.000000f, "Outer Curvature Scale"));
+	Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_THICKNESS", 0, 1104, 4, 0.000000f, 700.000000f, 110.000000f, 10.000000f, "Inner Edge Thickness"));
+	Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_SHARPNESS", 0, 1108, 4, 0.000000f, 90.000000f, 95.000000f, 5.000000f, "Inner Edge Sharpness - Def 95"));
+	Params.push_back(ShaderParam("HSM_BZL_OUTER_CORNER_RADIUS_SCALE", 0, 1112, 4, 0.000000f, 4000.000000f, 60.000000f, 1.000000f, "Outer Corner Radius Scale - Def 60"));
+	Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_SHADOW", 0, 1116, 4, 0.000000f, 200.000000f, 70.000000f, 5.000000f, "Opacity of Shadow from Bezel on Tube"));
+	Params.push_back(ShaderParam("HSM_BZL_COLOR_HUE", 0, 1120, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
+	Params.push_back(ShaderParam("HSM_BZL_COLOR_SATURATION", 0, 1124, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_BZL_COLOR_VALUE", 0, 1128, 4, 0.000000f, 100.000000f, 10.000000f, 0.200000f, "Value/Brightness - Def 10"));
+	Params.push_back(ShaderParam("HSM_BZL_NOISE", 0, 1132, 4, 0.000000f, 100.000000f, 30.000000f, 1.000000f, "Noise - Def 30"));
+	Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS", 0, 1136, 4, 0.000000f, 600.000000f, 30.000000f, 2.000000f, "Base Brightness - Def 30"));
+	Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_TOP", 0, 1140, 4, 0.000000f, 1000.000000f, 50.000000f, 2.000000f, "Top Multiplier - Def 50"));
+	Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_BOTTOM", 0, 1144, 4, 0.000000f, 1000.000000f, 200.000000f, 2.000000f, "Bottom Multiplier - Def 200"));
+	Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_SIDES", 0, 1148, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Sides Multiplier"));
+	Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_SIDE_LEFT", 0, 1152, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Left Side Multiplier"));
+	Params.push_back(ShaderParam("HSM_BZL_BRIGHTNESS_MULT_SIDE_RIGHT", 0, 1156, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Right Side Multiplier"));
+	Params.push_back(ShaderParam("HSM_BZL_HIGHLIGHT", 0, 1160, 4, 0.000000f, 100.000000f, 1.000000f, 0.200000f, "Main Highlight"));
+	Params.push_back(ShaderParam("HSM_BZL_INNER_EDGE_HIGHLIGHT", 0, 1164, 4, 0.000000f, 100.000000f, 100.000000f, 5.000000f, "Inner Edge Highlight"));
+	Params.push_back(ShaderParam("HSM_BZL_AMBIENT_LIGHTING_MULTIPLIER", 0, 1168, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Bezel Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_BZL_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1172, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_FRM_USE_INDEPENDENT_COLOR", 0, 1176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Independent Frame Color"));
+	Params.push_back(ShaderParam("HSM_FRM_COLOR_HUE", 0, 1180, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
+	Params.push_back(ShaderParam("HSM_FRM_COLOR_SATURATION", 0, 1184, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_FRM_COLOR_VALUE", 0, 1188, 4, 0.000000f, 100.000000f, 10.000000f, 0.200000f, "Value/Brightness - Def 10"));
+	Params.push_back(ShaderParam("HSM_FRM_NOISE", 0, 1192, 4, 0.000000f, 100.000000f, 30.000000f, 1.000000f, "Noise - Def 30"));
+	Params.push_back(ShaderParam("HSM_FRM_OUTER_CURVATURE_SCALE", 0, 1196, 4, 0.000000f, 500.000000f, 0.000000f, 5.000000f, "Frame Outer Curvature Scale"));
+	Params.push_back(ShaderParam("HSM_FRM_THICKNESS", 0, 1200, 4, 0.000000f, 2000.000000f, 100.000000f, 5.000000f, "Frame Thickness"));
+	Params.push_back(ShaderParam("HSM_FRM_THICKNESS_SCALE_X", 0, 1204, 4, 0.000000f, 1000.000000f, 100.000000f, 2.000000f, "Frame Thickness Scale X"));
+	Params.push_back(ShaderParam("HSM_FRM_OUTER_POS_Y", 0, 1208, 4, -100.000000f, 100.000000f, 0.000000f, 0.050000f, "Frame Outer Pos Y"));
+	Params.push_back(ShaderParam("HSM_FRM_INNER_EDGE_THICKNESS", 0, 1212, 4, 0.000000f, 5000.000000f, 100.000000f, 5.000000f, "Inner Edge Thickness"));
+	Params.push_back(ShaderParam("HSM_FRM_INNER_EDGE_HIGHLIGHT", 0, 1216, 4, 0.000000f, 100.000000f, 14.000000f, 1.000000f, "Inner Edge Highlight"));
+	Params.push_back(ShaderParam("HSM_FRM_OUTER_EDGE_THICKNESS", 0, 1220, 4, 0.000000f, 1000.000000f, 100.000000f, 10.000000f, "Outer Edge Thickness"));
+	Params.push_back(ShaderParam("HSM_FRM_OUTER_EDGE_SHADING", 0, 1224, 4, 0.000000f, 100.000000f, 50.000000f, 5.000000f, "Outer Edge Shading"));
+	Params.push_back(ShaderParam("HSM_FRM_OUTER_CORNER_RADIUS", 0, 1228, 4, 0.000000f, 70.000000f, 5.000000f, 0.050000f, "Outer Corner Radius"));
+	Params.push_back(ShaderParam("HSM_BZL_OUTER_POSITION_Y", 0, 1232, 4, -500.000000f, 500.000000f, 0.000000f, 1.000000f, "Outer Edge Position Y"));
+	Params.push_back(ShaderParam("HSM_FRM_SHADOW_OPACITY", 0, 1236, 4, 0.000000f, 300.000000f, 100.000000f, 1.000000f, "Shadow Opacity"));
+	Params.push_back(ShaderParam("HSM_FRM_SHADOW_WIDTH", 0, 1240, 4, 0.000000f, 500.000000f, 100.000000f, 1.000000f, "Shadow Width"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_FADE", 0, 1244, 4, 1.000000f, 100.000000f, 10.000000f, 0.500000f, "Corner Fade"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_INNER_SPREAD", 0, 1248, 4, 0.000000f, 1000.000000f, 500.000000f, 10.000000f, "Corner Inner Spread"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_OUTER_SPREAD", 0, 1252, 4, 0.000000f, 1000.000000f, 160.000000f, 10.000000f, "Corner Outer Spread"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_ROTATION_OFFSET_TOP", 0, 1256, 4, -90.000000f, 90.000000f, 0.000000f, 0.500000f, "Corner Rotation Offset Top"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_ROTATION_OFFSET_BOTTOM", 0, 1260, 4, -90.000000f, 90.000000f, 0.000000f, 0.500000f, "Corner Rotation Offset Bottom"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_SPREAD_FALLOFF", 0, 1264, 4, 1.000000f, 200.000000f, 100.000000f, 1.000000f, "Corner Spread Falloff"));
+	Params.push_back(ShaderParam("HSM_REFLECT_CORNER_FADE_DISTANCE", 0, 1268, 4, 1.000000f, 100.000000f, 100.000000f, 1.000000f, "Corner Fade Distance"));
+	Params.push_back(ShaderParam("HSM_REFLECT_GLOBAL_AMOUNT", 0, 1272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_GLOBAL_GAMMA_ADJUST", 0, 1276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_BEZEL_INNER_EDGE_AMOUNT", 0, 1280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_BEZEL_INNER_EDGE_FULLSCREEN_GLOW", 0, 1284, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_FRAME_INNER_EDGE_AMOUNT", 0, 1288, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_FRAME_INNER_EDGE_SHARPNESS", 0, 1292, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_SHOW_TUBE_FX_AMOUNT", 0, 1296, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_DIRECT_AMOUNT", 0, 1300, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_DIFFUSED_AMOUNT", 0, 1304, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_FULLSCREEN_GLOW", 0, 1308, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_FULLSCREEN_GLOW_GAMMA", 0, 1312, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_FADE_AMOUNT", 0, 1316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_RADIAL_FADE_WIDTH", 0, 1320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_RADIAL_FADE_HEIGHT", 0, 1324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_LATERAL_OUTER_FADE_POSITION", 0, 1328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_LATERAL_OUTER_FADE_DISTANCE", 0, 1332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_NOISE_AMOUNT", 0, 1336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_NOISE_SAMPLES", 0, 1340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_NOISE_SAMPLE_DISTANCE", 0, 1344, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_BLUR_NUM_SAMPLES", 0, 1348, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_BLUR_FALLOFF_DISTANCE", 0, 1352, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_BLUR_MIN", 0, 1356, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_BLUR_MAX", 0, 1360, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_MASK_IMAGE_AMOUNT", 0, 1364, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Reflection Image Mask Amount"));
+	Params.push_back(ShaderParam("HSM_REFLECT_MASK_FOLLOW_LAYER", 0, 1368, 4, 0.000000f, 7.000000f, 4.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL |BG|DEVICE|DECAL|CAB|TOP"));
+	Params.push_back(ShaderParam("HSM_REFLECT_MASK_FOLLOW_MODE", 0, 1372, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_REFLECT_MASK_BRIGHTNESS", 0, 1376, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Mask Brightness"));
+	Params.push_back(ShaderParam("HSM_REFLECT_MASK_BLACK_LEVEL", 0, 1380, 4, -100.000000f, 100.000000f, 0.000000f, 0.500000f, "Mask Black Level"));
+	Params.push_back(ShaderParam("HSM_REFLECT_MASK_MIPMAPPING_BLEND_BIAS", 0, 1384, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_GLASS_BORDER_ON", 0, 1388, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_VIGNETTE_AMOUNT", 0, 1392, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_REFLECT_VIGNETTE_SIZE", 0, 1396, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_POTATO_SHOW_BG_OVER_SCREEN", 0, 1400, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_POTATO_COLORIZE_CRT_WITH_BG", 0, 1404, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_POTATO_COLORIZE_BRIGHTNESS", 0, 1408, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_STANDARD_DECAL_SCALE_WITH_FRAME", 0, 1412, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_STANDARD_TOP_SCALE_WITH_FRAME", 0, 1416, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_BG_LAYER_ORDER", 0, 1420, 4, 0.000000f, 12.000000f, 0.000000f, 1.000000f, "Background Layer"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_LAYER_ORDER", 0, 1424, 4, 0.000000f, 12.000000f, 1.000000f, 1.000000f, "Viewport Vignette"));
+	Params.push_back(ShaderParam("HSM_CRT_LAYER_ORDER", 0, 1428, 4, 0.000000f, 12.000000f, 5.000000f, 1.000000f, "CRT Screen Bezel & Frame"));
+	Params.push_back(ShaderParam("HSM_DEVICE_LAYER_ORDER", 0, 1432, 4, 0.000000f, 12.000000f, 3.000000f, 1.000000f, "Device Layer"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_LAYER_ORDER", 0, 1436, 4, 0.000000f, 12.000000f, 4.000000f, 1.000000f, "Device LED Layer"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_LAYER_ORDER", 0, 1440, 4, 0.000000f, 12.000000f, 9.000000f, 1.000000f, "Cabinet Glass Layer"));
+	Params.push_back(ShaderParam("HSM_DECAL_LAYER_ORDER", 0, 1444, 4, 0.000000f, 12.000000f, 7.000000f, 1.000000f, "Decal Layer"));
+	Params.push_back(ShaderParam("HSM_LED_LAYER_ORDER", 0, 1448, 4, 0.000000f, 12.000000f, 2.000000f, 1.000000f, "LED Layer"));
+	Params.push_back(ShaderParam("HSM_TOP_LAYER_ORDER", 0, 1452, 4, 0.000000f, 12.000000f, 12.000000f, 1.000000f, "Top Layer"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_ASPECT_MODE", 0, 1456, 4, 0.000000f, 5.000000f, 4.000000f, 1.000000f, "Cutout Aspect- FULL | EXPL. | 4:3 | 3:4 | 16:9 | 9:16"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_EXPLICIT_ASPECT", 0, 1460, 4, 0.010000f, 3.000000f, 1.333330f, 0.010000f, "Explicit Aspect"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_FOLLOW_LAYER", 0, 1464, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BZL | BG | DEVICE | DECAL"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_FOLLOW_FULL_USES_ZOOM", 0, 1468, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_SCALE", 0, 1472, 4, -100.000000f, 200.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_SCALE_X", 0, 1476, 4, -100.000000f, 200.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_CORNER_RADIUS", 0, 1480, 4, 0.000000f, 70.000000f, 0.000000f, 1.000000f, "Corner Radius - Def 0"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_POS_X", 0, 1484, 4, -100.000000f, 200.000000f, 0.000000f, 0.050000f, "Position XY"));
+	Params.push_back(ShaderParam("HSM_CUTOUT_POS_Y", 0, 1488, 4, -100.000000f, 200.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_BG_OPACITY", 0, 1492, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_BG_HUE", 0, 1496, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_BG_COLORIZE_ON", 0, 1500, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize On"));
+	Params.push_back(ShaderParam("HSM_BG_SATURATION", 0, 1504, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_BG_BRIGHTNESS", 0, 1508, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_BG_GAMMA", 0, 1512, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_BG_AMBIENT_LIGHTING_MULTIPLIER", 0, 1516, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_BG_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1520, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_BG_APPLY_AMBIENT_IN_ADD_MODE", 0, 1524, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_BG_BLEND_MODE", 0, 1528, 4, -1.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_BG_SOURCE_MATTE_TYPE", 0, 1532, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_BG_MASK_MODE", 0, 1536, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_BG_CUTOUT_MODE", 0, 1540, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_BG_DUALSCREEN_VIS_MODE", 0, 1544, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_BG_FOLLOW_LAYER", 0, 1548, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL"));
+	Params.push_back(ShaderParam("HSM_BG_FOLLOW_MODE", 0, 1552, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_BG_FOLLOW_FULL_USES_ZOOM", 0, 1556, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_BG_FILL_MODE", 0, 1560, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_BG_SPLIT_PRESERVE_CENTER", 0, 1564, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_BG_SPLIT_REPEAT_WIDTH", 0, 1568, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_BG_SCALE", 0, 1572, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_BG_SCALE_X", 0, 1576, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_BG_POS_X", 0, 1580, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_BG_POS_Y", 0, 1584, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_BG_WRAP_MODE", 0, 1588, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Wrap Mode: NONE | TILED | MIRRORED"));
+	Params.push_back(ShaderParam("HSM_BG_MIPMAPPING_BLEND_BIAS", 0, 1592, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_OPACITY", 0, 1596, 4, 0.000000f, 100.000000f, 0.000000f, 2.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_MASK_MODE", 0, 1600, 4, 0.000000f, 8.000000f, 5.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_CUTOUT_MODE", 0, 1604, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_FOLLOW_LAYER", 0, 1608, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer- FULL | BG | TUBE | BZL"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_SCALE", 0, 1612, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_SCALE_X", 0, 1616, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_POS_X", 0, 1620, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_VIEWPORT_VIGNETTE_POS_Y", 0, 1624, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_LED_OPACITY", 0, 1628, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_LED_HUE", 0, 1632, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_LED_COLORIZE_ON", 0, 1636, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
+	Params.push_back(ShaderParam("HSM_LED_SATURATION", 0, 1640, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_LED_BRIGHTNESS", 0, 1644, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_LED_GAMMA", 0, 1648, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_LED_AMBIENT_LIGHTING_MULTIPLIER", 0, 1652, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_LED_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1656, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_LED_APPLY_AMBIENT_IN_ADD_MODE", 0, 1660, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_LED_BLEND_MODE", 0, 1664, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_LED_SOURCE_MATTE_TYPE", 0, 1668, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_LED_MASK_MODE", 0, 1672, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_LED_CUTOUT_MODE", 0, 1676, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_LED_DUALSCREEN_VIS_MODE", 0, 1680, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_LED_FOLLOW_LAYER", 0, 1684, 4, 0.000000f, 4.000000f, 3.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE"));
+	Params.push_back(ShaderParam("HSM_LED_FOLLOW_MODE", 0, 1688, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_LED_FOLLOW_FULL_USES_ZOOM", 0, 1692, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_LED_FILL_MODE", 0, 1696, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_LED_SPLIT_PRESERVE_CENTER", 0, 1700, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_LED_SPLIT_REPEAT_WIDTH", 0, 1704, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_LED_SCALE", 0, 1708, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_LED_SCALE_X", 0, 1712, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_LED_POS_X", 0, 1716, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_LED_POS_Y", 0, 1720, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_LED_MIPMAPPING_BLEND_BIAS", 0, 1724, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_DEVICE_OPACITY", 0, 1728, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_DEVICE_HUE", 0, 1732, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_DEVICE_COLORIZE_ON", 0, 1736, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
+	Params.push_back(ShaderParam("HSM_DEVICE_SATURATION", 0, 1740, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_DEVICE_BRIGHTNESS", 0, 1744, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_DEVICE_GAMMA", 0, 1748, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_DEVICE_AMBIENT_LIGHTING_MULTIPLIER", 0, 1752, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_DEVICE_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1756, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_DEVICE_APPLY_AMBIENT_IN_ADD_MODE", 0, 1760, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_DEVICE_BLEND_MODE", 0, 1764, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_DEVICE_SOURCE_MATTE_TYPE", 0, 1768, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_DEVICE_MASK_MODE", 0, 1772, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_DEVICE_CUTOUT_MODE", 0, 1776, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_DEVICE_DUALSCREEN_VIS_MODE", 0, 1780, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_DEVICE_FOLLOW_LAYER", 0, 1784, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG"));
+	Params.push_back(ShaderParam("HSM_DEVICE_FOLLOW_MODE", 0, 1788, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_DEVICE_FOLLOW_FULL_USES_ZOOM", 0, 1792, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_DEVICE_FILL_MODE", 0, 1796, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_DEVICE_SPLIT_PRESERVE_CENTER", 0, 1800, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_DEVICE_SPLIT_REPEAT_WIDTH", 0, 1804, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_DEVICE_SCALE", 0, 1808, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_DEVICE_SCALE_X", 0, 1812, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_DEVICE_POS_X", 0, 1816, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_DEVICE_POS_Y", 0, 1820, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_DEVICE_MIPMAPPING_BLEND_BIAS", 0, 1824, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_OPACITY", 0, 1828, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_HUE", 0, 1832, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_COLORIZE_ON", 0, 1836, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_SATURATION", 0, 1840, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_BRIGHTNESS", 0, 1844, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_GAMMA", 0, 1848, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_AMBIENT_LIGHTING_MULTIPLIER", 0, 1852, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1856, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_APPLY_AMBIENT_IN_ADD_MODE", 0, 1860, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_BLEND_MODE", 0, 1864, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_SOURCE_MATTE_TYPE", 0, 1868, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_MASK_MODE", 0, 1872, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_CUTOUT_MODE", 0, 1876, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_DUALSCREEN_VIS_MODE", 0, 1880, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_FOLLOW_LAYER", 0, 1884, 4, 0.000000f, 4.000000f, 4.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_FOLLOW_MODE", 0, 1888, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_FOLLOW_FULL_USES_ZOOM", 0, 1892, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_FILL_MODE", 0, 1896, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_SPLIT_PRESERVE_CENTER", 0, 1900, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_SPLIT_REPEAT_WIDTH", 0, 1904, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_SCALE", 0, 1908, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_SCALE_X", 0, 1912, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_POS_X", 0, 1916, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_POS_Y", 0, 1920, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_DEVICELED_MIPMAPPING_BLEND_BIAS", 0, 1924, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_FRM_OPACITY", 0, 1928, 4, 0.000000f, 100.000000f, 100.000000f, 5.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_FRM_BLEND_MODE", 0, 1932, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_FRM_TEXTURE_OPACITY", 0, 1936, 4, 0.000000f, 100.000000f, 1.500000f, 0.100000f, "Texture Overlay Opacity (Highlight)"));
+	Params.push_back(ShaderParam("HSM_FRM_TEXTURE_BLEND_MODE", 0, 1940, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Texture Overlay Blend Mode - Off | Normal | Add | Mult"));
+	Params.push_back(ShaderParam("HSM_DECAL_OPACITY", 0, 1944, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_DECAL_HUE", 0, 1948, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_DECAL_COLORIZE_ON", 0, 1952, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
+	Params.push_back(ShaderParam("HSM_DECAL_SATURATION", 0, 1956, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_DECAL_BRIGHTNESS", 0, 1960, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_DECAL_GAMMA", 0, 1964, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_DECAL_AMBIENT_LIGHTING_MULTIPLIER", 0, 1968, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_DECAL_AMBIENT2_LIGHTING_MULTIPLIER", 0, 1972, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_DECAL_APPLY_AMBIENT_IN_ADD_MODE", 0, 1976, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_DECAL_BLEND_MODE", 0, 1980, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode -  OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_DECAL_SOURCE_MATTE_TYPE", 0, 1984, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_DECAL_MASK_MODE", 0, 1988, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_DECAL_CUTOUT_MODE", 0, 1992, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_DECAL_DUALSCREEN_VIS_MODE", 0, 1996, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_DECAL_FOLLOW_LAYER", 0, 2000, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE"));
+	Params.push_back(ShaderParam("HSM_DECAL_FOLLOW_MODE", 0, 2004, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_DECAL_FOLLOW_FULL_USES_ZOOM", 0, 2008, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_DECAL_FILL_MODE", 0, 2012, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_DECAL_SPLIT_PRESERVE_CENTER", 0, 2016, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_DECAL_SPLIT_REPEAT_WIDTH", 0, 2020, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_DECAL_SCALE", 0, 2024, 4, 1.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_DECAL_SCALE_X", 0, 2028, 4, 50.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_DECAL_POS_X", 0, 2032, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_DECAL_POS_Y", 0, 2036, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_DECAL_MIPMAPPING_BLEND_BIAS", 0, 2040, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_OPACITY", 0, 2044, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_HUE", 0, 2048, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_COLORIZE_ON", 0, 2052, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_SATURATION", 0, 2056, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_BRIGHTNESS", 0, 2060, 4, 0.000000f, 400.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_GAMMA", 0, 2064, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_AMBIENT_LIGHTING_MULTIPLIER", 0, 2068, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_AMBIENT2_LIGHTING_MULTIPLIER", 0, 2072, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_APPLY_AMBIENT_IN_ADD_MODE", 0, 2076, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_BLEND_MODE", 0, 2080, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_SOURCE_MATTE_TYPE", 0, 2084, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_MASK_MODE", 0, 2088, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_CUTOUT_MODE", 0, 2092, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_DUALSCREEN_VIS_MODE", 0, 2096, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_FOLLOW_LAYER", 0, 2100, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer- FULL | TUBE | BEZEL | BG | DEVICE | DECAL"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_FOLLOW_MODE", 0, 2104, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_FOLLOW_FULL_USES_ZOOM", 0, 2108, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_FILL_MODE", 0, 2112, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_SPLIT_PRESERVE_CENTER", 0, 2116, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_SPLIT_REPEAT_WIDTH", 0, 2120, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_SCALE", 0, 2124, 4, 10.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_SCALE_X", 0, 2128, 4, 0.000000f, 500.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_POS_X", 0, 2132, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_POS_Y", 0, 2136, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_CAB_GLASS_MIPMAPPING_BLEND_BIAS", 0, 2140, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_TOP_OPACITY", 0, 2144, 4, 0.000000f, 100.000000f, 100.000000f, 0.100000f, "Opacity"));
+	Params.push_back(ShaderParam("HSM_TOP_HUE", 0, 2148, 4, 0.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue Offset"));
+	Params.push_back(ShaderParam("HSM_TOP_COLORIZE_ON", 0, 2152, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Colorize"));
+	Params.push_back(ShaderParam("HSM_TOP_SATURATION", 0, 2156, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("HSM_TOP_BRIGHTNESS", 0, 2160, 4, 0.000000f, 200.000000f, 100.000000f, 1.000000f, "Brightness"));
+	Params.push_back(ShaderParam("HSM_TOP_GAMMA", 0, 2164, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Gamma Adjust"));
+	Params.push_back(ShaderParam("HSM_TOP_AMBIENT_LIGHTING_MULTIPLIER", 0, 2168, 4, 0.000000f, 100.000000f, 100.000000f, 1.000000f, "Ambient Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TOP_AMBIENT2_LIGHTING_MULTIPLIER", 0, 2172, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Ambient 2nd Image Lighting Multiplier"));
+	Params.push_back(ShaderParam("HSM_TOP_APPLY_AMBIENT_IN_ADD_MODE", 0, 2176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Apply Ambient Lighting in ADD Blend Mode"));
+	Params.push_back(ShaderParam("HSM_TOP_BLEND_MODE", 0, 2180, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Blend Mode - OFF | NORMAL | ADD | MULTIPLY"));
+	Params.push_back(ShaderParam("HSM_TOP_SOURCE_MATTE_TYPE", 0, 2184, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Source Matte Color - BLACK | WHITE | NONE"));
+	Params.push_back(ShaderParam("HSM_TOP_MASK_MODE", 0, 2188, 4, 0.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_TOP_CUTOUT_MODE", 0, 2192, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Cutout Mask - OFF | ON | INVERT"));
+	Params.push_back(ShaderParam("HSM_TOP_DUALSCREEN_VIS_MODE", 0, 2196, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Dual Screen Visibility - BOTH | SCREEN 1 | SCREEN 2"));
+	Params.push_back(ShaderParam("HSM_TOP_FOLLOW_LAYER", 0, 2200, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Follow Layer - FULL | TUBE | BEZEL | BG | DEVICE | DECAL"));
+	Params.push_back(ShaderParam("HSM_TOP_FOLLOW_MODE", 0, 2204, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Follow Mode - FOLLOW SCALE & POS | FOLLOW EXACTLY"));
+	Params.push_back(ShaderParam("HSM_TOP_FOLLOW_FULL_USES_ZOOM", 0, 2208, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Follow Full also follows Zoom"));
+	Params.push_back(ShaderParam("HSM_TOP_FILL_MODE", 0, 2212, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Image Fill Mode - KEEP TEXURE ASPECT | SPLIT | STRETCH"));
+	Params.push_back(ShaderParam("HSM_TOP_SPLIT_PRESERVE_CENTER", 0, 2216, 4, 0.000000f, 500.000000f, 0.000000f, 1.000000f, "Split Mode Preserve Center %"));
+	Params.push_back(ShaderParam("HSM_TOP_SPLIT_REPEAT_WIDTH", 0, 2220, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Split Mode Repeat Width %"));
+	Params.push_back(ShaderParam("HSM_TOP_SCALE", 0, 2224, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale"));
+	Params.push_back(ShaderParam("HSM_TOP_SCALE_X", 0, 2228, 4, 0.000000f, 1000.000000f, 100.000000f, 0.100000f, "Scale X"));
+	Params.push_back(ShaderParam("HSM_TOP_POS_X", 0, 2232, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position X"));
+	Params.push_back(ShaderParam("HSM_TOP_POS_Y", 0, 2236, 4, -1000.000000f, 1000.000000f, 0.000000f, 0.050000f, "Position Y"));
+	Params.push_back(ShaderParam("HSM_TOP_MIRROR_WRAP", 0, 2240, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mirror Wrap"));
+	Params.push_back(ShaderParam("HSM_TOP_MIPMAPPING_BLEND_BIAS", 0, 2244, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Mipmapping Blend Bias (Affects Sharpness)"));
+	Params.push_back(ShaderParam("HSM_RENDER_SIMPLE_MODE", 0, 2248, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Mode:  NORM | BLACK-SCREEN | BLACK-BG | PINK-MASK| BW-MASK"));
+	Params.push_back(ShaderParam("HSM_RENDER_SIMPLE_MASK_TYPE", 0, 2252, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Mask Type:  SCREEN | TUBE | BEZEL & FRAME | BEZEL | FRAME"));
+	Params.push_back(ShaderParam("HSM_LAYERING_DEBUG_MASK_MODE", 0, 2256, 4, -2.000000f, 8.000000f, -1.000000f, 1.000000f, "Mask - ALL | SCRN | TUBE | BZ- | BZ | BZ+ | FRM | FRM+ | BG"));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_BLEND_MODE", 0, 2260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_FLIP_VERTICAL", 0, 2264, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_NOISE_BLEND_MODE", 0, 2268, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_NOISE_HOLD", 0, 2272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_NOISE_FADE_OUT", 0, 2276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_BLACK_HOLD", 0, 2280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_BLACK_FADE_OUT", 0, 2284, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_BLEND_MODE", 0, 2288, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_OVER_SOLID_COLOR", 0, 2292, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_PLACEMENT", 0, 2296, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_HEIGHT", 0, 2300, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_POS_X", 0, 2304, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_POS_Y", 0, 2308, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_WHEN_TO_SHOW", 0, 2312, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SPEED", 0, 2316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_WAIT", 0, 2320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_FADE_IN", 0, 2324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_HOLD", 0, 2328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_LOGO_FADE_OUT", 0, 2332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_HUE", 0, 2336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_SAT", 0, 2340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_VALUE", 0, 2344, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_HOLD", 0, 2348, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_INTRO_SOLID_COLOR_FADE_OUT", 0, 2352, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GAMMA_INPUT", 0, 2356, 4, 0.100000f, 5.000000f, 2.400000f, 0.050000f, "Gamma In (Game Embedded Gamma) Def 2.4"));
+	Params.push_back(ShaderParam("gamma_out", 0, 2360, 4, 0.100000f, 5.000000f, 2.400000f, 0.050000f, "Gamma Out (Electron Gun Gamma) Def 2.4"));
+	Params.push_back(ShaderParam("post_br", 0, 2364, 4, 0.010000f, 5.000000f, 1.000000f, 0.010000f, "Post CRT Brightness"));
+	Params.push_back(ShaderParam("post_br_affect_black_level", 0, 2368, 4, 0.000000f, 100.000000f, 100.000000f, 10.000000f, "Post CRT Brightness Affects Grade Black Level"));
+	Params.push_back(ShaderParam("m_glow", 0, 2372, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("m_glow_low", 0, 2376, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("m_glow_high", 0, 2380, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("m_glow_dist", 0, 2384, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("m_glow_mask", 0, 2388, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("smask_mit", 0, 2392, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bmask", 0, 2396, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bmask1", 0, 2400, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hmask1", 0, 2404, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("glow", 0, 2408, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bloom", 0, 2412, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_bloom", 0, 2416, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bloom_dist", 0, 2420, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("halation", 0, 2424, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("TATE", 0, 2428, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("IOS", 0, 2432, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_ON", 0, 2436, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Raster Bloom ON -- (Scaling based on average luma)"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_MODE", 0, 2440, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Raster Bloom Overscan Mode"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_AMOUNT", 0, 2444, 4, 0.000000f, 20.000000f, 5.000000f, 1.000000f, "Raster Bloom %"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_NEUTRAL_RANGE", 0, 2448, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Raster Bloom Overscan Neutral Area"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_RASTER_BLOOM_NEUTRAL_RANGE_CENTER", 0, 2452, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Raster Bloom Overscan Neutral Area Center"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_AMOUNT", 0, 2456, 4, -50.000000f, 100.000000f, 0.000000f, 0.500000f, "Overscan %"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_X", 0, 2460, 4, -50.000000f, 100.000000f, 0.000000f, 0.500000f, "Overscan X %"));
+	Params.push_back(ShaderParam("HSM_OVERSCAN_Y", 0, 2464, 4, -50.000000f, 100.000000f, 0.000000f, 0.500000f, "Overscan Y %"));
+	Params.push_back(ShaderParam("prescalex", 0, 2468, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("c_shape", 0, 2472, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("sborder", 0, 2476, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("csize", 0, 2480, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bsize1", 0, 2484, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpX", 0, 2488, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpY", 0, 2492, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gamma_c", 0, 2496, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("brightboost", 0, 2500, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("brightboost1", 0, 2504, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("clips", 0, 2508, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blendMode", 0, 2512, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gsl", 0, 2516, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scanline1", 0, 2520, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scanline2", 0, 2524, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("beam_min", 0, 2528, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("beam_max", 0, 2532, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("tds", 0, 2536, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("beam_size", 0, 2540, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("vertmask", 0, 2544, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scans", 0, 2548, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scan_falloff", 0, 2552, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("spike", 0, 2556, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ssharp", 0, 2560, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ring", 0, 2564, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("no_scanlines", 0, 2568, 4, 0.000000f, 1.500000f, 0.000000f, 0.050000f, "No-Scanline Mode (Guest Advanced Only)"));
+	Params.push_back(ShaderParam("scangamma", 0, 2572, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("rolling_scan", 0, 2576, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("h_sharp", 0, 2580, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("s_sharp", 0, 2584, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("smart_ei", 0, 2588, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ei_limit", 0, 2592, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("sth", 0, 2596, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("barspeed", 0, 2600, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("barintensity", 0, 2604, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bardir", 0, 2608, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("shadowMask", 0, 2612, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("maskstr", 0, 2616, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mcut", 0, 2620, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("maskboost", 0, 2624, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("masksize", 0, 2628, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_zoom", 0, 2632, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mzoom_sh", 0, 2636, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("masksizeautothreshold", 0, 2640, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("maskDark", 0, 2644, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("maskLight", 0, 2648, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_gamma", 0, 2652, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("slotmask", 0, 2656, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("slotmask1", 0, 2660, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("slotwidth", 0, 2664, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("double_slot", 0, 2668, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("slotms", 0, 2672, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("smoothmask", 0, 2676, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mshift", 0, 2680, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_layout", 0, 2684, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GDV_DECONVERGENCE_ON", 0, 2688, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("decons", 0, 2692, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconrr", 0, 2696, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconrg", 0, 2700, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconrb", 0, 2704, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconrry", 0, 2708, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconrgy", 0, 2712, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconrby", 0, 2716, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("deconsmooth", 0, 2720, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("dctypex", 0, 2724, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("dctypey", 0, 2728, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("dcscalemode", 0, 2732, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GDV_NOISE_ON", 0, 2736, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("addnoised", 0, 2740, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("noisetype", 0, 2744, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("noiseresd", 0, 2748, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("noiseresd4kmult", 0, 2752, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_grade_on", 0, 2756, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_Dark_to_Dim", 0, 2760, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_GCompress", 0, 2764, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("wp_temperature", 0, 2768, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_analog", 0, 2772, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_digital", 0, 2776, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_sfixes", 0, 2780, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_MD_Pal", 0, 2784, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_SMS_bl", 0, 2788, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_CRT_br", 0, 2792, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_CRT_bg", 0, 2796, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_CRT_bb", 0, 2800, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_CRT_rf", 0, 2804, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_CRT_sl", 0, 2808, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_satr", 0, 2812, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_satg", 0, 2816, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_satb", 0, 2820, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AS", 0, 2824, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("asat", 0, 2828, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_h_size", 0, 2832, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_v_size", 0, 2836, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_h_cent", 0, 2840, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_v_cent", 0, 2844, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_pin_phase", 0, 2848, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_pin_amp", 0, 2852, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("BR_LayersUnderCRTPassFeedback", 15));
+	Samplers.push_back(ShaderSampler("InfoCachePass", 1));
+	Samplers.push_back(ShaderSampler("NightLightingImage", 4));
+	Samplers.push_back(ShaderSampler("NightLighting2Image", 5));
+	Samplers.push_back(ShaderSampler("FrameTextureImage", 7));
+	Samplers.push_back(ShaderSampler("BackgroundVertImage", 3));
+	Samplers.push_back(ShaderSampler("BackgroundImage", 2));
+	Samplers.push_back(ShaderSampler("DeviceVertImage", 9));
+	Samplers.push_back(ShaderSampler("DeviceImage", 8));
+	Samplers.push_back(ShaderSampler("DeviceLEDImage", 10));
+	Samplers.push_back(ShaderSampler("LEDImage", 6));
+	Samplers.push_back(ShaderSampler("DecalImage", 11));
+	Samplers.push_back(ShaderSampler("TopLayerImage", 13));
+	Samplers.push_back(ShaderSampler("CabinetGlassImage", 12));
+	Samplers.push_back(ShaderSampler("ReflectionMaskImage", 14));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
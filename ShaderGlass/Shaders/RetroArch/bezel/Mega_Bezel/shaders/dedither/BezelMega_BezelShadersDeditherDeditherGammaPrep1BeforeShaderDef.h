@@ -27,6 +27,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -424,33 +435,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef::BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef() : ShaderDef{}
-	{
-		Name = "dedither-gamma-prep-1-before";
-		VertexByteCode = RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SGPT_BLEND_OPTION", -1, 52, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Mode: OFF | CHECKERBOARD | VERTICAL LINES | BOTH"));
-		Params.push_back(ShaderParam("HSM_DEDITHER_BRIGHTNESS_BIAS", -1, 56, 4, 10.000000f, 300.000000f, 100.000000f, 5.000000f, "Transparency Brightness Bias"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "dedither-gamma-prep-1-before";
+	VertexByteCode = RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SGPT_BLEND_OPTION", -1, 52, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Mode: OFF | CHECKERBOARD | VERTICAL LINES | BOTH"));
+	Params.push_back(ShaderParam("HSM_DEDITHER_BRIGHTNESS_BIAS", -1, 56, 4, 10.000000f, 300.000000f, 100.000000f, 5.000000f, "Transparency Brightness Bias"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
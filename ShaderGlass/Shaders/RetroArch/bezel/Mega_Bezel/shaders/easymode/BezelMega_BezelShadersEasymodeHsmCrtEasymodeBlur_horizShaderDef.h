@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -416,31 +427,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef::BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-crt-easymode-blur_horiz";
-		VertexByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-crt-easymode-blur_horiz";
+	VertexByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -416,31 +427,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef::BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-crt-easymode-blur_vert";
-		VertexByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-crt-easymode-blur_vert";
+	VertexByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -410,32 +421,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef::BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-gtu-pass1";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GTU_ON", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "GTU ON"));
-		Params.push_back(ShaderParam("compositeConnection", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Composite Connection Enable"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-gtu-pass1";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGtuHsmGtuPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GTU_ON", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "GTU ON"));
+	Params.push_back(ShaderParam("compositeConnection", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Composite Connection Enable"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -526,32 +537,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef::BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-afterglow0";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DerezedPassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PR", -1, 16, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Red -- PR"));
-		Params.push_back(ShaderParam("PG", -1, 20, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Green -- PG"));
-		Params.push_back(ShaderParam("PB", -1, 24, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Blue -- PB"));
-		Samplers.push_back(ShaderSampler("PreCRTPass", 2));
-		Samplers.push_back(ShaderSampler("AfterglowPassFeedback", 3));
+	Name = "hsm-afterglow0";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmAfterglow0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DerezedPassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PR", -1, 16, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Red -- PR"));
+	Params.push_back(ShaderParam("PG", -1, 20, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Green -- PG"));
+	Params.push_back(ShaderParam("PB", -1, 24, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Blue -- PB"));
+	Samplers.push_back(ShaderSampler("PreCRTPass", 2));
+	Samplers.push_back(ShaderSampler("AfterglowPassFeedback", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -612,31 +623,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef::BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-bloom_horizontal";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DerezedPassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEHB", -1, 16, 4, 1.000000f, 50.000000f, 3.000000f, 1.000000f, "Horizontal Bloom/Halation Radius -- SIZEHB"));
-		Params.push_back(ShaderParam("SIGMA_HB", -1, 20, 4, 0.250000f, 15.000000f, 0.750000f, 0.025000f, "Horizontal Bloom/Halation Sigma -- SIGMA_HB"));
-		Params.push_back(ShaderParam("FINE_BLOOM", -1, 24, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Fine Bloom/Halation Sampling"));
-		Samplers.push_back(ShaderSampler("LinearizePass", 2));
+	Name = "hsm-bloom_horizontal";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_horizontalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DerezedPassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEHB", -1, 16, 4, 1.000000f, 50.000000f, 3.000000f, 1.000000f, "Horizontal Bloom/Halation Radius -- SIZEHB"));
+	Params.push_back(ShaderParam("SIGMA_HB", -1, 20, 4, 0.250000f, 15.000000f, 0.750000f, 0.025000f, "Horizontal Bloom/Halation Sigma -- SIGMA_HB"));
+	Params.push_back(ShaderParam("FINE_BLOOM", -1, 24, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Fine Bloom/Halation Sampling"));
+	Samplers.push_back(ShaderSampler("LinearizePass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
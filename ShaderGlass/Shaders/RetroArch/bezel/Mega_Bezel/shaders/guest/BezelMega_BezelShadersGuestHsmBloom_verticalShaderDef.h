@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -594,32 +605,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef::BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-bloom_vertical";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DerezedPassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEVB", -1, 32, 4, 1.000000f, 50.000000f, 3.000000f, 1.000000f, "Vertical Bloom/Halation Radius  -- SIZEVB"));
-		Params.push_back(ShaderParam("SIGMA_VB", -1, 36, 4, 0.250000f, 15.000000f, 0.600000f, 0.025000f, "Vertical Bloom/Halation Sigma -- SIGMA_VB"));
-		Params.push_back(ShaderParam("FINE_BLOOM", -1, 40, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Fine Bloom/Halation Sampling"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-bloom_vertical";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmBloom_verticalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DerezedPassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEVB", -1, 32, 4, 1.000000f, 50.000000f, 3.000000f, 1.000000f, "Vertical Bloom/Halation Radius  -- SIZEVB"));
+	Params.push_back(ShaderParam("SIGMA_VB", -1, 36, 4, 0.250000f, 15.000000f, 0.600000f, 0.025000f, "Vertical Bloom/Halation Sigma -- SIGMA_VB"));
+	Params.push_back(ShaderParam("FINE_BLOOM", -1, 40, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Fine Bloom/Halation Sampling"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
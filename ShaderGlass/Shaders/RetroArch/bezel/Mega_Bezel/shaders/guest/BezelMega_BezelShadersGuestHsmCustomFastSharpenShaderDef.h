@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -578,34 +589,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef::BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-custom-fast-sharpen";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DerezedPassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SHARPEN_ON", -1, 32, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "FSharpen - ON"));
-		Params.push_back(ShaderParam("CSHARPEN", -1, 36, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "FSharpen - Sharpen strength"));
-		Params.push_back(ShaderParam("CCONTR", -1, 40, 4, 0.000000f, 0.250000f, 0.050000f, 0.010000f, "FSharpen - Sharpen Contrast/Ringing"));
-		Params.push_back(ShaderParam("CDETAILS", -1, 44, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "FSharpen - Details sharpened"));
-		Params.push_back(ShaderParam("DEBLUR", -1, 48, 4, 1.000000f, 7.000000f, 1.000000f, 0.250000f, "FSharpen - Deblur Strength (For NTSC Only)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-custom-fast-sharpen";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DerezedPassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SHARPEN_ON", -1, 32, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "FSharpen - ON"));
+	Params.push_back(ShaderParam("CSHARPEN", -1, 36, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "FSharpen - Sharpen strength"));
+	Params.push_back(ShaderParam("CCONTR", -1, 40, 4, 0.000000f, 0.250000f, 0.050000f, 0.010000f, "FSharpen - Sharpen Contrast/Ringing"));
+	Params.push_back(ShaderParam("CDETAILS", -1, 44, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "FSharpen - Details sharpened"));
+	Params.push_back(ShaderParam("DEBLUR", -1, 48, 4, 1.000000f, 7.000000f, 1.000000f, 0.250000f, "FSharpen - Deblur Strength (For NTSC Only)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -567,32 +578,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef::BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-gaussian_vertical";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DerezedPassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEV", -1, 32, 4, 1.000000f, 50.000000f, 6.000000f, 1.000000f, "Vertical Glow Radius (Num Samples) -- SIZEV"));
-		Params.push_back(ShaderParam("SIGMA_V", -1, 36, 4, 0.200000f, 15.000000f, 1.200000f, 0.050000f, "Vertical Glow Sigma ( Spread ) -- SIGMA_V"));
-		Params.push_back(ShaderParam("FINE_GLOW", -1, 40, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Fine Glow/M.Glow Sampling"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-gaussian_vertical";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestHsmGaussian_verticalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DerezedPassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEV", -1, 32, 4, 1.000000f, 50.000000f, 6.000000f, 1.000000f, "Vertical Glow Radius (Num Samples) -- SIZEV"));
+	Params.push_back(ShaderParam("SIGMA_V", -1, 36, 4, 0.200000f, 15.000000f, 1.200000f, 0.050000f, "Vertical Glow Sigma ( Spread ) -- SIGMA_V"));
+	Params.push_back(ShaderParam("FINE_GLOW", -1, 40, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Fine Glow/M.Glow Sampling"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
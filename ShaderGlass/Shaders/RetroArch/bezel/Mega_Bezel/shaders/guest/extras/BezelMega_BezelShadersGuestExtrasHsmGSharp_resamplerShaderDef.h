@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1254,36 +1265,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef::BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-g-sharp_resampler";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GSHARP_ON", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "G-SHARP ON"));
-		Params.push_back(ShaderParam("SIGMA_HV", -1, 56, 4, 0.100000f, 7.000000f, 1.000000f, 0.050000f, "Gaussian Blur Sigma"));
-		Params.push_back(ShaderParam("HSHARP0", -1, 60, 4, 1.000000f, 6.000000f, 1.000000f, 0.100000f, "Filter Range"));
-		Params.push_back(ShaderParam("HAR", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Anti-Ringing"));
-		Params.push_back(ShaderParam("SHAR", -1, 68, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Sharpness Definition"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-g-sharp_resampler";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GSHARP_ON", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "G-SHARP ON"));
+	Params.push_back(ShaderParam("SIGMA_HV", -1, 56, 4, 0.100000f, 7.000000f, 1.000000f, 0.050000f, "Gaussian Blur Sigma"));
+	Params.push_back(ShaderParam("HSHARP0", -1, 60, 4, 1.000000f, 6.000000f, 1.000000f, 0.100000f, "Filter Range"));
+	Params.push_back(ShaderParam("HAR", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Anti-Ringing"));
+	Params.push_back(ShaderParam("SHAR", -1, 68, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Sharpness Definition"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1529,37 +1540,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef::BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-sharpsmoother";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("max_w", -1, 52, 4, 0.000000f, 0.200000f, 0.050000f, 0.010000f, "Max filter weight"));
-		Params.push_back(ShaderParam("min_w", -1, 56, 4, -0.150000f, 0.050000f, 0.000000f, 0.010000f, "Min filter weight"));
-		Params.push_back(ShaderParam("smoot", -1, 60, 4, 0.000000f, 1.500000f, 0.400000f, 0.010000f, "Smoothing strength"));
-		Params.push_back(ShaderParam("lumad", -1, 64, 4, 0.100000f, 5.000000f, 0.500000f, 0.100000f, "Effects smoothing"));
-		Params.push_back(ShaderParam("mtric", -1, 68, 4, 0.100000f, 2.000000f, 0.300000f, 0.100000f, "Metric Used"));
-		Params.push_back(ShaderParam("SHARPSMOOTHER_ON", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SharpSmoother ON"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-sharpsmoother";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("max_w", -1, 52, 4, 0.000000f, 0.200000f, 0.050000f, 0.010000f, "Max filter weight"));
+	Params.push_back(ShaderParam("min_w", -1, 56, 4, -0.150000f, 0.050000f, 0.000000f, 0.010000f, "Min filter weight"));
+	Params.push_back(ShaderParam("smoot", -1, 60, 4, 0.000000f, 1.500000f, 0.400000f, 0.010000f, "Smoothing strength"));
+	Params.push_back(ShaderParam("lumad", -1, 64, 4, 0.100000f, 5.000000f, 0.500000f, 0.100000f, "Effects smoothing"));
+	Params.push_back(ShaderParam("mtric", -1, 68, 4, 0.100000f, 2.000000f, 0.300000f, 0.100000f, "Metric Used"));
+	Params.push_back(ShaderParam("SHARPSMOOTHER_ON", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SharpSmoother ON"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
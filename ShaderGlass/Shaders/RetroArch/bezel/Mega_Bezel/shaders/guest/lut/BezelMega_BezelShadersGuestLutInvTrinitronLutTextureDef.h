@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDefs
 {
 const BYTE sData[] =
@@ -1695,13 +1703,10 @@ const BYTE sData[] =
 ,36,160,112,127,254,39,36,68,174,103,10,143,155,75,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef : public TextureDef
+BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef::BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef() : TextureDef{}
-	{
-		Name = "inv-trinitron-lut.png";
-		Data = BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDefs::sData);
-	}
-};
+	Name = "inv-trinitron-lut.png";
+	Data = BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersGuestLutNecLutTextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersGuestLutNecLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersGuestLutNecLutTextureDefs
 {
 const BYTE sData[] =
@@ -2083,13 +2091,10 @@ const BYTE sData[] =
 ,64,12,25,58,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersGuestLutNecLutTextureDef : public TextureDef
+BezelMega_BezelShadersGuestLutNecLutTextureDef::BezelMega_BezelShadersGuestLutNecLutTextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersGuestLutNecLutTextureDef() : TextureDef{}
-	{
-		Name = "nec-lut.png";
-		Data = BezelMega_BezelShadersGuestLutNecLutTextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersGuestLutNecLutTextureDefs::sData);
-	}
-};
+	Name = "nec-lut.png";
+	Data = BezelMega_BezelShadersGuestLutNecLutTextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersGuestLutNecLutTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersGuestLutNtscLutTextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersGuestLutNtscLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersGuestLutNtscLutTextureDefs
 {
 const BYTE sData[] =
@@ -2130,13 +2138,10 @@ const BYTE sData[] =
 ,207,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersGuestLutNtscLutTextureDef : public TextureDef
+BezelMega_BezelShadersGuestLutNtscLutTextureDef::BezelMega_BezelShadersGuestLutNtscLutTextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersGuestLutNtscLutTextureDef() : TextureDef{}
-	{
-		Name = "ntsc-lut.png";
-		Data = BezelMega_BezelShadersGuestLutNtscLutTextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersGuestLutNtscLutTextureDefs::sData);
-	}
-};
+	Name = "ntsc-lut.png";
+	Data = BezelMega_BezelShadersGuestLutNtscLutTextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersGuestLutNtscLutTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersGuestLutTrinitronLutTextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersGuestLutTrinitronLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersGuestLutTrinitronLutTextureDefs
 {
 const BYTE sData[] =
@@ -2266,13 +2274,10 @@ const BYTE sData[] =
 ,117,128,105,30,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersGuestLutTrinitronLutTextureDef : public TextureDef
+BezelMega_BezelShadersGuestLutTrinitronLutTextureDef::BezelMega_BezelShadersGuestLutTrinitronLutTextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersGuestLutTrinitronLutTextureDef() : TextureDef{}
-	{
-		Name = "trinitron-lut.png";
-		Data = BezelMega_BezelShadersGuestLutTrinitronLutTextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersGuestLutTrinitronLutTextureDefs::sData);
-	}
-};
+	Name = "trinitron-lut.png";
+	Data = BezelMega_BezelShadersGuestLutTrinitronLutTextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersGuestLutTrinitronLutTextureDefs::sData);
+}
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1334,40 +1345,34 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef::BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-ntsc-pass1";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("quality", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 1.000000f, "INFO:  Fringe & Artifact Values: Svideo 0 | Composite 1 | RF 2"));
-		Params.push_back(ShaderParam("ntsc_sat", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Color Saturation"));
-		Params.push_back(ShaderParam("cust_fringing", -1, 60, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Fringing Value"));
-		Params.push_back(ShaderParam("cust_artifacting", -1, 64, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Artifacting Value"));
-		Params.push_back(ShaderParam("ntsc_bright", -1, 68, 4, 0.000000f, 1.500000f, 1.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("ntsc_scale", -1, 72, 4, 0.200000f, 2.500000f, 1.000000f, 0.025000f, "Resolution Scaling"));
-		Params.push_back(ShaderParam("ntsc_fields", -1, 76, 4, -1.000000f, 1.000000f, -1.000000f, 1.000000f, "Merge Fields: Auto | NO | YES"));
-		Params.push_back(ShaderParam("ntsc_phase", -1, 80, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Phase: Auto | 2 phase | 3 phase | Mixed"));
-		Params.push_back(ShaderParam("ntsc_gamma", -1, 84, 4, 0.250000f, 2.000000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-ntsc-pass1";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("quality", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 1.000000f, "INFO:  Fringe & Artifact Values: Svideo 0 | Composite 1 | RF 2"));
+	Params.push_back(ShaderParam("ntsc_sat", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Color Saturation"));
+	Params.push_back(ShaderParam("cust_fringing", -1, 60, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Fringing Value"));
+	Params.push_back(ShaderParam("cust_artifacting", -1, 64, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Artifacting Value"));
+	Params.push_back(ShaderParam("ntsc_bright", -1, 68, 4, 0.000000f, 1.500000f, 1.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("ntsc_scale", -1, 72, 4, 0.200000f, 2.500000f, 1.000000f, 0.025000f, "Resolution Scaling"));
+	Params.push_back(ShaderParam("ntsc_fields", -1, 76, 4, -1.000000f, 1.000000f, -1.000000f, 1.000000f, "Merge Fields: Auto | NO | YES"));
+	Params.push_back(ShaderParam("ntsc_phase", -1, 80, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Phase: Auto | 2 phase | 3 phase | Mixed"));
+	Params.push_back(ShaderParam("ntsc_gamma", -1, 84, 4, 0.250000f, 2.000000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
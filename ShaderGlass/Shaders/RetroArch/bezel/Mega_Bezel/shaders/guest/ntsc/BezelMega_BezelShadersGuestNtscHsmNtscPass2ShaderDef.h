@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -4064,36 +4075,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef::BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-ntsc-pass2";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ntsc_scale", -1, 48, 4, 0.200000f, 2.500000f, 1.000000f, 0.025000f, "Resolution Scaling"));
-		Params.push_back(ShaderParam("ntsc_phase", -1, 52, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Phase: Auto | 2 phase | 3 phase | Mixed"));
-		Params.push_back(ShaderParam("auto_res", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ntsc_ring", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
-		Params.push_back(ShaderParam("ntsc_cscale", -1, 64, 4, 0.200000f, 4.000000f, 1.000000f, 0.050000f, "Chroma Scaling / Bleeding"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PrePass0", 3));
+	Name = "hsm-ntsc-pass2";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ntsc_scale", -1, 48, 4, 0.200000f, 2.500000f, 1.000000f, 0.025000f, "Resolution Scaling"));
+	Params.push_back(ShaderParam("ntsc_phase", -1, 52, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Phase: Auto | 2 phase | 3 phase | Mixed"));
+	Params.push_back(ShaderParam("auto_res", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ntsc_ring", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
+	Params.push_back(ShaderParam("ntsc_cscale", -1, 64, 4, 0.200000f, 4.000000f, 1.000000f, 0.050000f, "Chroma Scaling / Bleeding"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PrePass0", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -984,35 +995,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef::BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-ntsc-pass3";
-		VertexByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("auto_res", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ntsc_sharp", -1, 52, 4, -10.000000f, 10.000000f, 0.000000f, 0.500000f, "Sharpness (Negative: Adaptive)"));
-		Params.push_back(ShaderParam("ntsc_shape", -1, 56, 4, 0.500000f, 1.000000f, 0.750000f, 0.050000f, "Sharpness Shape"));
-		Params.push_back(ShaderParam("ntsc_gamma", -1, 60, 4, 0.250000f, 2.000000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("NPass1", 3));
+	Name = "hsm-ntsc-pass3";
+	VertexByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("auto_res", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ntsc_sharp", -1, 52, 4, -10.000000f, 10.000000f, 0.000000f, 0.500000f, "Sharpness (Negative: Adaptive)"));
+	Params.push_back(ShaderParam("ntsc_shape", -1, 56, 4, 0.500000f, 1.000000f, 0.750000f, 0.050000f, "Sharpness Shape"));
+	Params.push_back(ShaderParam("ntsc_gamma", -1, 60, 4, 0.250000f, 2.000000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("NPass1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -35,6 +35,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -687,33 +698,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef::BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef() : ShaderDef{}
-	{
-		Name = "custom-bicubic-y";
-		VertexByteCode = RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SUPERXBR_ON", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Super-XBR ON"));
-		Samplers.push_back(ShaderSampler("XbrSource", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "custom-bicubic-y";
+	VertexByteCode = RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SUPERXBR_ON", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Super-XBR ON"));
+	Samplers.push_back(ShaderSampler("XbrSource", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
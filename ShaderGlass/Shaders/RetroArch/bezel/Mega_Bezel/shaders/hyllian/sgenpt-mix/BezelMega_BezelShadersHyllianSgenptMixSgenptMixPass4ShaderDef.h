@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -672,33 +683,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef::BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef() : ShaderDef{}
-	{
-		Name = "sgenpt-mix-pass4";
-		VertexByteCode = RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SGPT_BLEND_OPTION", -1, 52, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Mode: OFF | CHECKERBOARD | VERTICAL LINES | BOTH"));
-		Params.push_back(ShaderParam("VL_BLEND_LEVEL", -1, 56, 4, 0.000000f, 1.000000f, 0.800000f, 0.100000f, "Vertical Lines Blend Level"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sgenpt-mix-pass4";
+	VertexByteCode = RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SGPT_BLEND_OPTION", -1, 52, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Mode: OFF | CHECKERBOARD | VERTICAL LINES | BOTH"));
+	Params.push_back(ShaderParam("VL_BLEND_LEVEL", -1, 56, 4, 0.000000f, 1.000000f, 0.800000f, 0.100000f, "Vertical Lines Blend Level"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
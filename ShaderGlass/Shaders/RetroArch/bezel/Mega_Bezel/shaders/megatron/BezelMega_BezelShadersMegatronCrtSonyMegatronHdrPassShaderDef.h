@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -627,36 +638,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef::BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDef() : ShaderDef{}
-	{
-		Name = "crt-sony-megatron-hdr-pass";
-		VertexByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sFragmentByteCode);
-		Format = "R16G16B16A16_SFLOAT";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_hdr", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SDR | HDR"));
-		Params.push_back(ShaderParam("hcrt_max_nits", -1, 4, 4, 0.000000f, 10000.000000f, 1000.000000f, 10.000000f, "HDR: Display's Peak Luminance"));
-		Params.push_back(ShaderParam("hcrt_paper_white_nits", -1, 8, 4, 0.000000f, 10000.000000f, 200.000000f, 10.000000f, "HDR: Display's Paper White Luminance"));
-		Params.push_back(ShaderParam("hcrt_expand_gamut", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HDR: Original/Vivid"));
-		Params.push_back(ShaderParam("hcrt_colour_accurate", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Accurate/Colour Accurate"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-sony-megatron-hdr-pass";
+	VertexByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronHdrPassShaderDefs::sFragmentByteCode);
+	Format = "R16G16B16A16_SFLOAT";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_hdr", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SDR | HDR"));
+	Params.push_back(ShaderParam("hcrt_max_nits", -1, 4, 4, 0.000000f, 10000.000000f, 1000.000000f, 10.000000f, "HDR: Display's Peak Luminance"));
+	Params.push_back(ShaderParam("hcrt_paper_white_nits", -1, 8, 4, 0.000000f, 10000.000000f, 200.000000f, 10.000000f, "HDR: Display's Paper White Luminance"));
+	Params.push_back(ShaderParam("hcrt_expand_gamut", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HDR: Original/Vivid"));
+	Params.push_back(ShaderParam("hcrt_colour_accurate", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Accurate/Colour Accurate"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
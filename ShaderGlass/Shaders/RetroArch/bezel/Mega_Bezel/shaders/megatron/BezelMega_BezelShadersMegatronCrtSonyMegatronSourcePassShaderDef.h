@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1125,45 +1136,39 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef::BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDef() : ShaderDef{}
-	{
-		Name = "crt-sony-megatron-source-pass";
-		VertexByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode);
-		Format = "R16G16B16A16_SFLOAT";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_hdr", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SDR | HDR"));
-		Params.push_back(ShaderParam("hcrt_colour_space", -1, 4, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Display's Colour Space: r709 | sRGB | DCI-P3"));
-		Params.push_back(ShaderParam("hcrt_max_nits", -1, 8, 4, 0.000000f, 10000.000000f, 1000.000000f, 10.000000f, "HDR: Display's Peak Luminance"));
-		Params.push_back(ShaderParam("hcrt_paper_white_nits", -1, 12, 4, 0.000000f, 10000.000000f, 200.000000f, 10.000000f, "HDR: Display's Paper White Luminance"));
-		Params.push_back(ShaderParam("hcrt_lcd_resolution", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Display's Resolution: 1080p | 4K | 8K"));
-		Params.push_back(ShaderParam("hcrt_lcd_subpixel", -1, 20, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Display's Subpixel Layout: RGB | RWBG (OLED) | BGR"));
-		Params.push_back(ShaderParam("hcrt_colour_system", -1, 24, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Colour System: r709 | PAL | NTSC-U | NTSC-J"));
-		Params.push_back(ShaderParam("hcrt_expand_gamut", -1, 28, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HDR: Original/Vivid"));
-		Params.push_back(ShaderParam("hcrt_white_temperature", -1, 32, 4, -5000.000000f, 12000.000000f, 0.000000f, 100.000000f, "White Temperature Offset (Kelvin)"));
-		Params.push_back(ShaderParam("hcrt_brightness", -1, 36, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("hcrt_contrast", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Contrast"));
-		Params.push_back(ShaderParam("hcrt_saturation", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("hcrt_gamma_in", -1, 48, 4, 1.220000f, 3.220000f, 2.220000f, 0.010000f, "Gamma In"));
-		Params.push_back(ShaderParam("hcrt_colour_accurate", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Accurate/Colour Accurate"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-sony-megatron-source-pass";
+	VertexByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersMegatronCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode);
+	Format = "R16G16B16A16_SFLOAT";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_hdr", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SDR | HDR"));
+	Params.push_back(ShaderParam("hcrt_colour_space", -1, 4, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Display's Colour Space: r709 | sRGB | DCI-P3"));
+	Params.push_back(ShaderParam("hcrt_max_nits", -1, 8, 4, 0.000000f, 10000.000000f, 1000.000000f, 10.000000f, "HDR: Display's Peak Luminance"));
+	Params.push_back(ShaderParam("hcrt_paper_white_nits", -1, 12, 4, 0.000000f, 10000.000000f, 200.000000f, 10.000000f, "HDR: Display's Paper White Luminance"));
+	Params.push_back(ShaderParam("hcrt_lcd_resolution", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Display's Resolution: 1080p | 4K | 8K"));
+	Params.push_back(ShaderParam("hcrt_lcd_subpixel", -1, 20, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Display's Subpixel Layout: RGB | RWBG (OLED) | BGR"));
+	Params.push_back(ShaderParam("hcrt_colour_system", -1, 24, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Colour System: r709 | PAL | NTSC-U | NTSC-J"));
+	Params.push_back(ShaderParam("hcrt_expand_gamut", -1, 28, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HDR: Original/Vivid"));
+	Params.push_back(ShaderParam("hcrt_white_temperature", -1, 32, 4, -5000.000000f, 12000.000000f, 0.000000f, 100.000000f, "White Temperature Offset (Kelvin)"));
+	Params.push_back(ShaderParam("hcrt_brightness", -1, 36, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("hcrt_contrast", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Contrast"));
+	Params.push_back(ShaderParam("hcrt_saturation", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("hcrt_gamma_in", -1, 48, 4, 1.220000f, 3.220000f, 2.220000f, 0.010000f, "Gamma In"));
+	Params.push_back(ShaderParam("hcrt_colour_accurate", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Accurate/Colour Accurate"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -19,6 +19,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -665,33 +676,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef::BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-PS1-Undither-BoxBlur";
-		VertexByteCode = RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PS1_BOX_BLUR_MODE", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Box Blur ON"));
-		Params.push_back(ShaderParam("PS1_BOX_BLUR_BLEND", -1, 52, 4, 0.000000f, 100.000000f, 100.000000f, 10.000000f, "Blend Amount"));
-		Params.push_back(ShaderParam("FrameCount", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hsm-PS1-Undither-BoxBlur";
+	VertexByteCode = RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PS1_BOX_BLUR_MODE", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Box Blur ON"));
+	Params.push_back(ShaderParam("PS1_BOX_BLUR_BLEND", -1, 52, 4, 0.000000f, 100.000000f, 100.000000f, 10.000000f, "Blend Amount"));
+	Params.push_back(ShaderParam("FrameCount", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef : public ShaderDef
+{
+public:
+	BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -641,34 +652,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef : public ShaderDef
+RetroArch::BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef::BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef() : ShaderDef{}
 {
-public:
-	BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "hsm-scalefx-pass0";
-		VertexByteCode = RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scalefx_pass0Size", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HSM_SCALEFX_ON", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ScaleFx ON - Must Increase Core Res Sampling"));
-		Params.push_back(ShaderParam("SFX_CLR", -1, 36, 4, 0.010000f, 1.000000f, 0.430000f, 0.010000f, "ScaleFX Threshold"));
-		Params.push_back(ShaderParam("SFX_SAA", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ScaleFX Filter AA"));
-		Params.push_back(ShaderParam("SFX_SCN", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ScaleFX Filter Corners"));
-		Params.push_back(ShaderParam("SFX_RAA", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "hsm-scalefx-pass0";
+	VertexByteCode = RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scalefx_pass0Size", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HSM_SCALEFX_ON", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ScaleFx ON - Must Increase Core Res Sampling"));
+	Params.push_back(ShaderParam("SFX_CLR", -1, 36, 4, 0.010000f, 1.000000f, 0.430000f, 0.010000f, "ScaleFX Threshold"));
+	Params.push_back(ShaderParam("SFX_SAA", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ScaleFX Filter AA"));
+	Params.push_back(ShaderParam("SFX_SCN", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ScaleFX Filter Corners"));
+	Params.push_back(ShaderParam("SFX_RAA", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
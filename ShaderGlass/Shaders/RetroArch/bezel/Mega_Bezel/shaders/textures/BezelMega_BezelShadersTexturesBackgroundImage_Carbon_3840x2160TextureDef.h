@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDefs
 {
 const BYTE sData[] =
@@ -12273,13 +12281,10 @@ const BYTE sData[] =
 ,166,52,24,39,251,114,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef::BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef() : TextureDef{}
-	{
-		Name = "BackgroundImage_Carbon_3840x2160.png";
-		Data = BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDefs::sData);
-	}
-};
+	Name = "BackgroundImage_Carbon_3840x2160.png";
+	Data = BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDefs
 {
 const BYTE sData[] =
@@ -161,13 +169,10 @@ const BYTE sData[] =
 ,4,0,136,249,31,149,68,209,5,62,27,249,38,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef : public TextureDef
+BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef::BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef() : TextureDef{}
-	{
-		Name = "Colored_Gel_Rainbow.png";
-		Data = BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDefs::sData);
-	}
-};
+	Name = "Colored_Gel_Rainbow.png";
+	Data = BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDefs::sData);
+}
+#endif
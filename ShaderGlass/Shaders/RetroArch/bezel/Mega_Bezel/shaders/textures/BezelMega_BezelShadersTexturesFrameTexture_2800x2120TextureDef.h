@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDefs
 {
 const BYTE sData[] =
@@ -7777,13 +7785,10 @@ const BYTE sData[] =
 ,253,96,66,8,33,132,16,66,8,33,120,248,63,166,90,240,9,87,72,168,204,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef::BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef() : TextureDef{}
-	{
-		Name = "FrameTexture_2800x2120.png";
-		Data = BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDefs::sData);
-	}
-};
+	Name = "FrameTexture_2800x2120.png";
+	Data = BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDefs
 {
 const BYTE sData[] =
@@ -471,13 +479,10 @@ const BYTE sData[] =
 ,165,44,248,205,197,19,135,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef : public TextureDef
+BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef::BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef() : TextureDef{}
-	{
-		Name = "IntroImage_MegaBezelLogo.png";
-		Data = BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDefs::sData);
-	}
-};
+	Name = "IntroImage_MegaBezelLogo.png";
+	Data = BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDefs
 {
 const BYTE sData[] =
@@ -29025,13 +29033,10 @@ const BYTE sData[] =
 ,65,254,31,98,250,151,169,11,40,118,100,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef::BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef() : TextureDef{}
-	{
-		Name = "NightLightingClose_1920x1080.png";
-		Data = BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDefs::sData);
-	}
-};
+	Name = "NightLightingClose_1920x1080.png";
+	Data = BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDefs::sData);
+}
+#endif
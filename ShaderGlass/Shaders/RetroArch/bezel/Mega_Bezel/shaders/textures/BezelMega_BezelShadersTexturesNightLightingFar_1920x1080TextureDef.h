@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDefs
 {
 const BYTE sData[] =
@@ -26685,13 +26693,10 @@ const BYTE sData[] =
 ,255,2,10,211,20,248,100,135,128,218,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef::BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef() : TextureDef{}
-	{
-		Name = "NightLightingFar_1920x1080.png";
-		Data = BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDefs::sData);
-	}
-};
+	Name = "NightLightingFar_1920x1080.png";
+	Data = BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDefs::sData);
+}
+#endif
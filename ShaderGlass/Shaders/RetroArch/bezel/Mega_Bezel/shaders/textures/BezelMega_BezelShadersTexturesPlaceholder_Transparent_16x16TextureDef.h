@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDefs
 {
 const BYTE sData[] =
@@ -55,13 +63,10 @@ const BYTE sData[] =
 ,140,2,8,0,0,4,16,0,1,127,77,120,142,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef::BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef() : TextureDef{}
-	{
-		Name = "Placeholder_Transparent_16x16.png";
-		Data = BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDefs::sData);
-	}
-};
+	Name = "Placeholder_Transparent_16x16.png";
+	Data = BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDefs
 {
 const BYTE sData[] =
@@ -62,13 +70,10 @@ const BYTE sData[] =
 ,213,163,26,70,53,12,41,13,0,85,109,3,29,228,70,90,18,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef::BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef() : TextureDef{}
-	{
-		Name = "Placeholder_White_16x16.png";
-		Data = BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDefs::sData);
-	}
-};
+	Name = "Placeholder_White_16x16.png";
+	Data = BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDefs::sData);
+}
+#endif
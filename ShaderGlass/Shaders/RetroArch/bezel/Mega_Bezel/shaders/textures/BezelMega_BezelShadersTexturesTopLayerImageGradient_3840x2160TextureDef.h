@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDefs
 {
 const BYTE sData[] =
@@ -7146,13 +7154,10 @@ const BYTE sData[] =
 ,219,255,229,232,255,15,153,175,230,232,139,77,50,191,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef::BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef() : TextureDef{}
-	{
-		Name = "TopLayerImageGradient_3840x2160.png";
-		Data = BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDefs::sData);
-	}
-};
+	Name = "TopLayerImageGradient_3840x2160.png";
+	Data = BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDefs
 {
 const BYTE sData[] =
@@ -12595,13 +12603,10 @@ const BYTE sData[] =
 ,122,44,19,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef::BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef() : TextureDef{}
-	{
-		Name = "TubeGlassOverlayImageCropped_1440x1080.png";
-		Data = BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDefs::sData);
-	}
-};
+	Name = "TubeGlassOverlayImageCropped_1440x1080.png";
+	Data = BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDefs::sData);
+}
+#endif
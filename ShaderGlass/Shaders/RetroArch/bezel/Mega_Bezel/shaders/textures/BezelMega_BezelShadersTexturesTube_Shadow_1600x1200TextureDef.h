@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef : public TextureDef
+{
+public:
+	BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDefs
 {
 const BYTE sData[] =
@@ -2873,13 +2881,10 @@ const BYTE sData[] =
 ,0,0,0,0,0,0,0,0,0,0,0,0,240,9,138,192,169,132,251,132,219,137,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef : public TextureDef
+BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef::BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef() : TextureDef{}
 {
-public:
-	BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef() : TextureDef{}
-	{
-		Name = "Tube_Shadow_1600x1200.png";
-		Data = BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDefs::sData;
-		DataLength = sizeof(BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDefs::sData);
-	}
-};
+	Name = "Tube_Shadow_1600x1200.png";
+	Data = BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDefs::sData;
+	DataLength = sizeof(BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDefs::sData);
+}
+#endif
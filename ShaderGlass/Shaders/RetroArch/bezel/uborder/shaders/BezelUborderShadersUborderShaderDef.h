@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelUborderShadersUborderShaderDef : public ShaderDef
+{
+public:
+	BezelUborderShadersUborderShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelUborderShadersUborderShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -425,33 +436,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelUborderShadersUborderShaderDef : public ShaderDef
+RetroArch::BezelUborderShadersUborderShaderDef::BezelUborderShadersUborderShaderDef() : ShaderDef{}
 {
-public:
-	BezelUborderShadersUborderShaderDef() : ShaderDef{}
-	{
-		Name = "uborder";
-		VertexByteCode = RetroArchBezelUborderShadersUborderShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelUborderShadersUborderShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelUborderShadersUborderShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelUborderShadersUborderShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ub_border_top", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "On top: [ Frame | Border ]"));
-		Samplers.push_back(ShaderSampler("BORDER", 3));
-		Samplers.push_back(ShaderSampler("CRTPass", 2));
+	Name = "uborder";
+	VertexByteCode = RetroArchBezelUborderShadersUborderShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelUborderShadersUborderShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelUborderShadersUborderShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelUborderShadersUborderShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ub_border_top", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "On top: [ Frame | Border ]"));
+	Samplers.push_back(ShaderSampler("BORDER", 3));
+	Samplers.push_back(ShaderSampler("CRTPass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -59,6 +59,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef : public ShaderDef
+{
+public:
+	BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -5899,94 +5910,88 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef : public ShaderDef
+RetroArch::BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef::BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef() : ShaderDef{}
 {
-public:
-	BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef() : ShaderDef{}
-	{
-		Name = "crt-nobody-bezel-reflections";
-		VertexByteCode = RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", 0, 116, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("all_zoom", 0, 120, 4, 20.000000f, 200.000000f, 100.000000f, 1.000000f, "Zoom %"));
-		Params.push_back(ShaderParam("fr_zoom", 0, 124, 4, 2.000000f, 200.000000f, 50.000000f, 0.200000f, "Zoom %"));
-		Params.push_back(ShaderParam("fr_aspect_x", 0, 128, 4, 1.000000f, 32.000000f, 8.000000f, 0.020000f, "Set Aspect Ratio Numerator"));
-		Params.push_back(ShaderParam("fr_aspect_y", 0, 132, 4, 1.000000f, 32.000000f, 6.000000f, 0.020000f, "Set Aspect Ratio Denominator"));
-		Params.push_back(ShaderParam("fr_center_x", 0, 136, 4, -200.000000f, 200.000000f, 0.000000f, 0.100000f, "Center X"));
-		Params.push_back(ShaderParam("fr_center_y", 0, 140, 4, -200.000000f, 200.000000f, 0.000000f, 0.100000f, "Center Y"));
-		Params.push_back(ShaderParam("fr_i_scaling", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Integer Scaling for Y"));
-		Params.push_back(ShaderParam("fr_i_scaling_fac", 0, 148, 4, -20.000000f, 1.000000f, 0.000000f, 1.000000f, "Integer Scaling Factor [ - / + ]"));
-		Params.push_back(ShaderParam("h_shape", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Shape [ Sphere | Cylinder ]"));
-		Params.push_back(ShaderParam("h_radius", 0, 156, 4, 1.500000f, 10.000000f, 4.000000f, 0.100000f, "Curvature Radius"));
-		Params.push_back(ShaderParam("h_cornersize", 0, 160, 4, 0.010000f, 1.000000f, 0.050000f, 0.010000f, "Corner Size"));
-		Params.push_back(ShaderParam("h_cornersmooth", 0, 164, 4, 0.100000f, 1.000000f, 0.500000f, 0.100000f, "Corner Smoothness"));
-		Params.push_back(ShaderParam("h_overscan_x", 0, 168, 4, 20.000000f, 200.000000f, 100.000000f, 0.200000f, "Overscan X%"));
-		Params.push_back(ShaderParam("h_overscan_y", 0, 172, 4, 20.000000f, 200.000000f, 100.000000f, 0.200000f, "Overscan Y%"));
-		Params.push_back(ShaderParam("h_angle_x", 0, 176, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Position X"));
-		Params.push_back(ShaderParam("h_angle_y", 0, 180, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Position Y"));
-		Params.push_back(ShaderParam("h_curvature", 0, 184, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature Toggle"));
-		Params.push_back(ShaderParam("bz_shine_enable", 0, 188, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Shine   [ OFF | ON ]"));
-		Params.push_back(ShaderParam("bz_shine", 0, 192, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Shine Intensity"));
-		Params.push_back(ShaderParam("bz_shine_size", 0, 196, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Shine Size"));
-		Params.push_back(ShaderParam("bz_ambient_enable", 0, 200, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Ambient [ OFF | ON ]"));
-		Params.push_back(ShaderParam("bz_ambient", 0, 204, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Ambient Intensity"));
-		Params.push_back(ShaderParam("bz_ambient_size", 0, 208, 4, 0.000000f, 1.000000f, 0.850000f, 0.010000f, "Ambient Size"));
-		Params.push_back(ShaderParam("bz_ref_str", 0, 212, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Reflection Strength"));
-		Params.push_back(ShaderParam("bz_lights", 0, 216, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Lights  [ OUT | ON ]"));
-		Params.push_back(ShaderParam("bz_transparent", 0, 220, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Bezel Transparent [ OFF | ON ]"));
-		Params.push_back(ShaderParam("bz_inner_bezel_x", 0, 224, 4, 0.000000f, 1.000000f, 0.100000f, 0.001000f, "Bezel Inner Width"));
-		Params.push_back(ShaderParam("bz_inner_bezel_y", 0, 228, 4, 0.000000f, 1.000000f, 0.100000f, 0.001000f, "Bezel Inner Height"));
-		Params.push_back(ShaderParam("bz_middle_bezel_x", 0, 232, 4, 0.000000f, 1.000000f, 0.200000f, 0.001000f, "Bezel Middle Width"));
-		Params.push_back(ShaderParam("bz_middle_bezel_y", 0, 236, 4, 0.000000f, 1.000000f, 0.200000f, 0.001000f, "Bezel Middle Height"));
-		Params.push_back(ShaderParam("bz_outer_bezel_x", 0, 240, 4, 0.000000f, 1.000000f, 0.300000f, 0.001000f, "Bezel Outer Width"));
-		Params.push_back(ShaderParam("bz_outer_bezel_y", 0, 244, 4, 0.000000f, 1.000000f, 0.300000f, 0.001000f, "Bezel Outer Height"));
-		Params.push_back(ShaderParam("bz_outer_curve", 0, 248, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Bezel Curvature   [ OFF | ON ]"));
-		Params.push_back(ShaderParam("bz_ref_dist", 0, 252, 4, -0.600000f, 0.600000f, 0.000000f, 0.010000f, "Reflection Distance"));
-		Params.push_back(ShaderParam("bz_radius", 0, 256, 4, 0.005000f, 1.000000f, 0.050000f, 0.010000f, "Bezel Corner Radius"));
-		Params.push_back(ShaderParam("bz_red", 0, 260, 4, 0.000000f, 255.000000f, 128.000000f, 1.000000f, "Bezel Color - Red"));
-		Params.push_back(ShaderParam("bz_green", 0, 264, 4, 0.000000f, 255.000000f, 128.000000f, 1.000000f, "Bezel Color - Green"));
-		Params.push_back(ShaderParam("bz_blue", 0, 268, 4, 0.000000f, 255.000000f, 128.000000f, 1.000000f, "Bezel Color - Blue"));
-		Params.push_back(ShaderParam("bz_ang", 0, 272, 4, 0.000000f, 20.000000f, 1.000000f, 0.010000f, "Inflec. Point Angle"));
-		Params.push_back(ShaderParam("bz_pos", 0, 276, 4, -20.000000f, 20.000000f, 0.000000f, 0.002000f, "Inflec. Point Position"));
-		Params.push_back(ShaderParam("border_scale", 0, 280, 4, 0.500000f, 5.000000f, 1.000000f, 0.002000f, "Border Scale"));
-		Params.push_back(ShaderParam("border_center_x", 0, 284, 4, -0.500000f, 0.500000f, 0.000000f, 0.001000f, "Border Center X"));
-		Params.push_back(ShaderParam("border_center_y", 0, 288, 4, -0.500000f, 0.500000f, 0.000000f, 0.001000f, "Border Center Y"));
-		Params.push_back(ShaderParam("border_mirror_y", 0, 292, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Border Mirrored"));
-		Params.push_back(ShaderParam("border_allow_rot", 0, 296, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Border Rotation [ 0 <--> 270 ]"));
-		Params.push_back(ShaderParam("ub_border_top", 0, 300, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "On top: [ Frame | Border ]"));
-		Params.push_back(ShaderParam("border_alpha", 0, 304, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Border Alpha Over Content (BAOC)"));
-		Params.push_back(ShaderParam("black_baoc", 0, 308, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(BAOC) Only On Black Content"));
-		Params.push_back(ShaderParam("CN_VSCANLINES", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Scanlines"));
-		Params.push_back(ShaderParam("CN_BEAM_MIN_WIDTH", -1, 4, 4, 0.000000f, 1.000000f, 0.800000f, 0.010000f, "Min Beam Width"));
-		Params.push_back(ShaderParam("CN_BEAM_MAX_WIDTH", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Max Beam Width"));
-		Params.push_back(ShaderParam("CN_SCAN_SIZE", -1, 12, 4, 0.000000f, 1.000000f, 0.860000f, 0.010000f, "Scanlines Thickness"));
-		Params.push_back(ShaderParam("CN_BRIGHTBOOST", -1, 16, 4, 0.500000f, 1.500000f, 1.200000f, 0.010000f, "Brightness Boost"));
-		Params.push_back(ShaderParam("CN_VIG_TOGGLE", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vignette Toggle"));
-		Params.push_back(ShaderParam("CN_VIG_BASE", -1, 24, 4, 2.000000f, 100.000000f, 16.000000f, 2.000000f, "Vignette Range"));
-		Params.push_back(ShaderParam("CN_VIG_EXP", -1, 28, 4, 0.000000f, 2.000000f, 0.160000f, 0.020000f, "Vignette Strength"));
-		Params.push_back(ShaderParam("CN_PHOSPHOR_LAYOUT", -1, 32, 4, 0.000000f, 15.000000f, 1.000000f, 1.000000f, "Mask [1..6 Aperture, 7..10 Shadow, 11..14 Slot]"));
-		Params.push_back(ShaderParam("CN_MASK_STRENGTH", -1, 36, 4, 0.000000f, 1.000000f, 0.640000f, 0.020000f, "Mask Strength"));
-		Params.push_back(ShaderParam("CN_MONITOR_SUBPIXELS", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Monitor Subpixels Layout [ RGB | BGR ]"));
-		Params.push_back(ShaderParam("CN_InputGamma", -1, 44, 4, 0.000000f, 4.000000f, 2.400000f, 0.100000f, "Input Gamma"));
-		Params.push_back(ShaderParam("CN_OutputGamma", -1, 48, 4, 0.000000f, 3.000000f, 2.200000f, 0.100000f, "Output Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("BORDER", 3));
+	Name = "crt-nobody-bezel-reflections";
+	VertexByteCode = RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", 0, 116, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("all_zoom", 0, 120, 4, 20.000000f, 200.000000f, 100.000000f, 1.000000f, "Zoom %"));
+	Params.push_back(ShaderParam("fr_zoom", 0, 124, 4, 2.000000f, 200.000000f, 50.000000f, 0.200000f, "Zoom %"));
+	Params.push_back(ShaderParam("fr_aspect_x", 0, 128, 4, 1.000000f, 32.000000f, 8.000000f, 0.020000f, "Set Aspect Ratio Numerator"));
+	Params.push_back(ShaderParam("fr_aspect_y", 0, 132, 4, 1.000000f, 32.000000f, 6.000000f, 0.020000f, "Set Aspect Ratio Denominator"));
+	Params.push_back(ShaderParam("fr_center_x", 0, 136, 4, -200.000000f, 200.000000f, 0.000000f, 0.100000f, "Center X"));
+	Params.push_back(ShaderParam("fr_center_y", 0, 140, 4, -200.000000f, 200.000000f, 0.000000f, 0.100000f, "Center Y"));
+	Params.push_back(ShaderParam("fr_i_scaling", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Integer Scaling for Y"));
+	Params.push_back(ShaderParam("fr_i_scaling_fac", 0, 148, 4, -20.000000f, 1.000000f, 0.000000f, 1.000000f, "Integer Scaling Factor [ - / + ]"));
+	Params.push_back(ShaderParam("h_shape", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Shape [ Sphere | Cylinder ]"));
+	Params.push_back(ShaderParam("h_radius", 0, 156, 4, 1.500000f, 10.000000f, 4.000000f, 0.100000f, "Curvature Radius"));
+	Params.push_back(ShaderParam("h_cornersize", 0, 160, 4, 0.010000f, 1.000000f, 0.050000f, 0.010000f, "Corner Size"));
+	Params.push_back(ShaderParam("h_cornersmooth", 0, 164, 4, 0.100000f, 1.000000f, 0.500000f, 0.100000f, "Corner Smoothness"));
+	Params.push_back(ShaderParam("h_overscan_x", 0, 168, 4, 20.000000f, 200.000000f, 100.000000f, 0.200000f, "Overscan X%"));
+	Params.push_back(ShaderParam("h_overscan_y", 0, 172, 4, 20.000000f, 200.000000f, 100.000000f, 0.200000f, "Overscan Y%"));
+	Params.push_back(ShaderParam("h_angle_x", 0, 176, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Position X"));
+	Params.push_back(ShaderParam("h_angle_y", 0, 180, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Position Y"));
+	Params.push_back(ShaderParam("h_curvature", 0, 184, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature Toggle"));
+	Params.push_back(ShaderParam("bz_shine_enable", 0, 188, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Shine   [ OFF | ON ]"));
+	Params.push_back(ShaderParam("bz_shine", 0, 192, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Shine Intensity"));
+	Params.push_back(ShaderParam("bz_shine_size", 0, 196, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Shine Size"));
+	Params.push_back(ShaderParam("bz_ambient_enable", 0, 200, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Ambient [ OFF | ON ]"));
+	Params.push_back(ShaderParam("bz_ambient", 0, 204, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Ambient Intensity"));
+	Params.push_back(ShaderParam("bz_ambient_size", 0, 208, 4, 0.000000f, 1.000000f, 0.850000f, 0.010000f, "Ambient Size"));
+	Params.push_back(ShaderParam("bz_ref_str", 0, 212, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Reflection Strength"));
+	Params.push_back(ShaderParam("bz_lights", 0, 216, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Lights  [ OUT | ON ]"));
+	Params.push_back(ShaderParam("bz_transparent", 0, 220, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Bezel Transparent [ OFF | ON ]"));
+	Params.push_back(ShaderParam("bz_inner_bezel_x", 0, 224, 4, 0.000000f, 1.000000f, 0.100000f, 0.001000f, "Bezel Inner Width"));
+	Params.push_back(ShaderParam("bz_inner_bezel_y", 0, 228, 4, 0.000000f, 1.000000f, 0.100000f, 0.001000f, "Bezel Inner Height"));
+	Params.push_back(ShaderParam("bz_middle_bezel_x", 0, 232, 4, 0.000000f, 1.000000f, 0.200000f, 0.001000f, "Bezel Middle Width"));
+	Params.push_back(ShaderParam("bz_middle_bezel_y", 0, 236, 4, 0.000000f, 1.000000f, 0.200000f, 0.001000f, "Bezel Middle Height"));
+	Params.push_back(ShaderParam("bz_outer_bezel_x", 0, 240, 4, 0.000000f, 1.000000f, 0.300000f, 0.001000f, "Bezel Outer Width"));
+	Params.push_back(ShaderParam("bz_outer_bezel_y", 0, 244, 4, 0.000000f, 1.000000f, 0.300000f, 0.001000f, "Bezel Outer Height"));
+	Params.push_back(ShaderParam("bz_outer_curve", 0, 248, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Bezel Curvature   [ OFF | ON ]"));
+	Params.push_back(ShaderParam("bz_ref_dist", 0, 252, 4, -0.600000f, 0.600000f, 0.000000f, 0.010000f, "Reflection Distance"));
+	Params.push_back(ShaderParam("bz_radius", 0, 256, 4, 0.005000f, 1.000000f, 0.050000f, 0.010000f, "Bezel Corner Radius"));
+	Params.push_back(ShaderParam("bz_red", 0, 260, 4, 0.000000f, 255.000000f, 128.000000f, 1.000000f, "Bezel Color - Red"));
+	Params.push_back(ShaderParam("bz_green", 0, 264, 4, 0.000000f, 255.000000f, 128.000000f, 1.000000f, "Bezel Color - Green"));
+	Params.push_back(ShaderParam("bz_blue", 0, 268, 4, 0.000000f, 255.000000f, 128.000000f, 1.000000f, "Bezel Color - Blue"));
+	Params.push_back(ShaderParam("bz_ang", 0, 272, 4, 0.000000f, 20.000000f, 1.000000f, 0.010000f, "Inflec. Point Angle"));
+	Params.push_back(ShaderParam("bz_pos", 0, 276, 4, -20.000000f, 20.000000f, 0.000000f, 0.002000f, "Inflec. Point Position"));
+	Params.push_back(ShaderParam("border_scale", 0, 280, 4, 0.500000f, 5.000000f, 1.000000f, 0.002000f, "Border Scale"));
+	Params.push_back(ShaderParam("border_center_x", 0, 284, 4, -0.500000f, 0.500000f, 0.000000f, 0.001000f, "Border Center X"));
+	Params.push_back(ShaderParam("border_center_y", 0, 288, 4, -0.500000f, 0.500000f, 0.000000f, 0.001000f, "Border Center Y"));
+	Params.push_back(ShaderParam("border_mirror_y", 0, 292, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Border Mirrored"));
+	Params.push_back(ShaderParam("border_allow_rot", 0, 296, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Border Rotation [ 0 <--> 270 ]"));
+	Params.push_back(ShaderParam("ub_border_top", 0, 300, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "On top: [ Frame | Border ]"));
+	Params.push_back(ShaderParam("border_alpha", 0, 304, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Border Alpha Over Content (BAOC)"));
+	Params.push_back(ShaderParam("black_baoc", 0, 308, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(BAOC) Only On Black Content"));
+	Params.push_back(ShaderParam("CN_VSCANLINES", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Scanlines"));
+	Params.push_back(ShaderParam("CN_BEAM_MIN_WIDTH", -1, 4, 4, 0.000000f, 1.000000f, 0.800000f, 0.010000f, "Min Beam Width"));
+	Params.push_back(ShaderParam("CN_BEAM_MAX_WIDTH", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Max Beam Width"));
+	Params.push_back(ShaderParam("CN_SCAN_SIZE", -1, 12, 4, 0.000000f, 1.000000f, 0.860000f, 0.010000f, "Scanlines Thickness"));
+	Params.push_back(ShaderParam("CN_BRIGHTBOOST", -1, 16, 4, 0.500000f, 1.500000f, 1.200000f, 0.010000f, "Brightness Boost"));
+	Params.push_back(ShaderParam("CN_VIG_TOGGLE", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vignette Toggle"));
+	Params.push_back(ShaderParam("CN_VIG_BASE", -1, 24, 4, 2.000000f, 100.000000f, 16.000000f, 2.000000f, "Vignette Range"));
+	Params.push_back(ShaderParam("CN_VIG_EXP", -1, 28, 4, 0.000000f, 2.000000f, 0.160000f, 0.020000f, "Vignette Strength"));
+	Params.push_back(ShaderParam("CN_PHOSPHOR_LAYOUT", -1, 32, 4, 0.000000f, 15.000000f, 1.000000f, 1.000000f, "Mask [1..6 Aperture, 7..10 Shadow, 11..14 Slot]"));
+	Params.push_back(ShaderParam("CN_MASK_STRENGTH", -1, 36, 4, 0.000000f, 1.000000f, 0.640000f, 0.020000f, "Mask Strength"));
+	Params.push_back(ShaderParam("CN_MONITOR_SUBPIXELS", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Monitor Subpixels Layout [ RGB | BGR ]"));
+	Params.push_back(ShaderParam("CN_InputGamma", -1, 44, 4, 0.000000f, 4.000000f, 2.400000f, 0.100000f, "Input Gamma"));
+	Params.push_back(ShaderParam("CN_OutputGamma", -1, 48, 4, 0.000000f, 3.000000f, 2.200000f, 0.100000f, "Output Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("BORDER", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
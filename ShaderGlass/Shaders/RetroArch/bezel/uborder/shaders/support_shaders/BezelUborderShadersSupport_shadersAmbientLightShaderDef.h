@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelUborderShadersSupport_shadersAmbientLightShaderDef : public ShaderDef
+{
+public:
+	BezelUborderShadersSupport_shadersAmbientLightShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -384,32 +395,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelUborderShadersSupport_shadersAmbientLightShaderDef : public ShaderDef
+RetroArch::BezelUborderShadersSupport_shadersAmbientLightShaderDef::BezelUborderShadersSupport_shadersAmbientLightShaderDef() : ShaderDef{}
 {
-public:
-	BezelUborderShadersSupport_shadersAmbientLightShaderDef() : ShaderDef{}
-	{
-		Name = "ambient-light";
-		VertexByteCode = RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AG_effect", -1, 52, 4, 0.100000f, 3.000000f, 1.000000f, 0.100000f, "Glow Brightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ambient-light";
+	VertexByteCode = RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelUborderShadersSupport_shadersAmbientLightShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AG_effect", -1, 52, 4, 0.100000f, 3.000000f, 1.000000f, 0.100000f, "Glow Brightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelUborderShadersSupport_shadersFeedbackShaderDef : public ShaderDef
+{
+public:
+	BezelUborderShadersSupport_shadersFeedbackShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -390,32 +401,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelUborderShadersSupport_shadersFeedbackShaderDef : public ShaderDef
+RetroArch::BezelUborderShadersSupport_shadersFeedbackShaderDef::BezelUborderShadersSupport_shadersFeedbackShaderDef() : ShaderDef{}
 {
-public:
-	BezelUborderShadersSupport_shadersFeedbackShaderDef() : ShaderDef{}
-	{
-		Name = "feedback";
-		VertexByteCode = RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mixfactor", -1, 0, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Motionblur Fadeout"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PassFeedback0", 3));
+	Name = "feedback";
+	VertexByteCode = RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelUborderShadersSupport_shadersFeedbackShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mixfactor", -1, 0, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Motionblur Fadeout"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PassFeedback0", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BezelUborderShadersSupport_shadersOriginalShaderDef : public ShaderDef
+{
+public:
+	BezelUborderShadersSupport_shadersOriginalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -287,31 +298,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BezelUborderShadersSupport_shadersOriginalShaderDef : public ShaderDef
+RetroArch::BezelUborderShadersSupport_shadersOriginalShaderDef::BezelUborderShadersSupport_shadersOriginalShaderDef() : ShaderDef{}
 {
-public:
-	BezelUborderShadersSupport_shadersOriginalShaderDef() : ShaderDef{}
-	{
-		Name = "original";
-		VertexByteCode = RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Original", 2));
+	Name = "original";
+	VertexByteCode = RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBezelUborderShadersSupport_shadersOriginalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Original", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BezelUborderTexturesBordersDefaultTextureDef : public TextureDef
+{
+public:
+	BezelUborderTexturesBordersDefaultTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BezelUborderTexturesBordersDefaultTextureDefs
 {
 const BYTE sData[] =
@@ -9151,13 +9159,10 @@ const BYTE sData[] =
 ,12,176,252,235,18,236,6,20,81,69,84,54,102,124,112,127,117,99,230,182,61,126,180,81,85,95,255,217};
 }
 
-class BezelUborderTexturesBordersDefaultTextureDef : public TextureDef
+BezelUborderTexturesBordersDefaultTextureDef::BezelUborderTexturesBordersDefaultTextureDef() : TextureDef{}
 {
-public:
-	BezelUborderTexturesBordersDefaultTextureDef() : TextureDef{}
-	{
-		Name = "default.jpg";
-		Data = BezelUborderTexturesBordersDefaultTextureDefs::sData;
-		DataLength = sizeof(BezelUborderTexturesBordersDefaultTextureDefs::sData);
-	}
-};
+	Name = "default.jpg";
+	Data = BezelUborderTexturesBordersDefaultTextureDefs::sData;
+	DataLength = sizeof(BezelUborderTexturesBordersDefaultTextureDefs::sData);
+}
+#endif
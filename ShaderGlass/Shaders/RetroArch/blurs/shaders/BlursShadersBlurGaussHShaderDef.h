@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersBlurGaussHShaderDef : public ShaderDef
+{
+public:
+	BlursShadersBlurGaussHShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersBlurGaussHShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -440,31 +451,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersBlurGaussHShaderDef : public ShaderDef
+RetroArch::BlursShadersBlurGaussHShaderDef::BlursShadersBlurGaussHShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersBlurGaussHShaderDef() : ShaderDef{}
-	{
-		Name = "blur-gauss-h";
-		VertexByteCode = RetroArchBlursShadersBlurGaussHShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersBlurGaussHShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersBlurGaussHShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersBlurGaussHShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur-gauss-h";
+	VertexByteCode = RetroArchBlursShadersBlurGaussHShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersBlurGaussHShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersBlurGaussHShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersBlurGaussHShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGizmoBlurShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGizmoBlurShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGizmoBlurShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1167,37 +1178,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGizmoBlurShaderDef : public ShaderDef
+RetroArch::BlursShadersGizmoBlurShaderDef::BlursShadersGizmoBlurShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGizmoBlurShaderDef() : ShaderDef{}
-	{
-		Name = "gizmo-blur";
-		VertexByteCode = RetroArchBlursShadersGizmoBlurShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGizmoBlurShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGizmoBlurShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGizmoBlurShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HORIZONTAL_BLUR", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Horizontal Blur"));
-		Params.push_back(ShaderParam("VERTICAL_BLUR", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Blur"));
-		Params.push_back(ShaderParam("BLUR_OFFSET", -1, 60, 4, -1.000000f, 1.000000f, 0.500000f, 0.050000f, "Blur Intensity"));
-		Params.push_back(ShaderParam("SUBPIXEL_SCALING", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Subpixel scaling"));
-		Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
-		Params.push_back(ShaderParam("COLOUR_BLEEDING", -1, 72, 4, 0.000000f, 3.000000f, 0.000000f, 0.100000f, "Colour bleeding intensity"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gizmo-blur";
+	VertexByteCode = RetroArchBlursShadersGizmoBlurShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGizmoBlurShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGizmoBlurShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGizmoBlurShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HORIZONTAL_BLUR", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Horizontal Blur"));
+	Params.push_back(ShaderParam("VERTICAL_BLUR", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Blur"));
+	Params.push_back(ShaderParam("BLUR_OFFSET", -1, 60, 4, -1.000000f, 1.000000f, 0.500000f, 0.050000f, "Blur Intensity"));
+	Params.push_back(ShaderParam("SUBPIXEL_SCALING", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Subpixel scaling"));
+	Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
+	Params.push_back(ShaderParam("COLOUR_BLEEDING", -1, 72, 4, 0.000000f, 3.000000f, 0.000000f, 0.100000f, "Colour bleeding intensity"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersSmartBlurShaderDef : public ShaderDef
+{
+public:
+	BlursShadersSmartBlurShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersSmartBlurShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -947,35 +958,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersSmartBlurShaderDef : public ShaderDef
+RetroArch::BlursShadersSmartBlurShaderDef::BlursShadersSmartBlurShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersSmartBlurShaderDef() : ShaderDef{}
-	{
-		Name = "smart-blur";
-		VertexByteCode = RetroArchBlursShadersSmartBlurShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersSmartBlurShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersSmartBlurShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersSmartBlurShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SB_BLUR_LEVEL", -1, 52, 4, 0.000000f, 1.000000f, 0.660000f, 0.020000f, "Smart Blur Level"));
-		Params.push_back(ShaderParam("SB_RED_THRESHOLD", -1, 56, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Smart Blur Red Threshold"));
-		Params.push_back(ShaderParam("SB_GREEN_THRESHOLD", -1, 60, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Smart Blur Green Threshold"));
-		Params.push_back(ShaderParam("SB_BLUE_THRESHOLD", -1, 64, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Smart Blur Blue Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "smart-blur";
+	VertexByteCode = RetroArchBlursShadersSmartBlurShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersSmartBlurShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersSmartBlurShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersSmartBlurShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SB_BLUR_LEVEL", -1, 52, 4, 0.000000f, 1.000000f, 0.660000f, 0.020000f, "Smart Blur Level"));
+	Params.push_back(ShaderParam("SB_RED_THRESHOLD", -1, 56, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Smart Blur Red Threshold"));
+	Params.push_back(ShaderParam("SB_GREEN_THRESHOLD", -1, 60, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Smart Blur Green Threshold"));
+	Params.push_back(ShaderParam("SB_BLUE_THRESHOLD", -1, 64, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Smart Blur Blue Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -38,6 +38,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterBloom_blendShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterBloom_blendShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterBloom_blendShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1185,47 +1196,41 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterBloom_blendShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterBloom_blendShaderDef::BlursShadersDual_filterBloom_blendShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterBloom_blendShaderDef() : ShaderDef{}
-	{
-		Name = "bloom_blend";
-		VertexByteCode = RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("InputSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MIN_EXP_INTENSITY", -1, 68, 4, 0.000000f, 2.000000f, 0.600000f, 0.050000f, "Bloom intensity"));
-		Params.push_back(ShaderParam("EYE_ADAPTION", -1, 72, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Eye adaptation strength: Reduce bloom on bright screens"));
-		Params.push_back(ShaderParam("MIN_EXP", -1, 76, 4, 0.000000f, 0.950000f, 0.100000f, 0.010000f, "Minimum exposure value (where bloom is strongest)"));
-		Params.push_back(ShaderParam("MAX_EXP", -1, 80, 4, 0.050000f, 1.000000f, 0.550000f, 0.010000f, "Maximum exposure value (where bloom is weakest)"));
-		Params.push_back(ShaderParam("SCALE_EMPH", -1, 84, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Bloom scale emphasis"));
-		Params.push_back(ShaderParam("SCALE_SPREAD", -1, 88, 4, 0.500000f, 15.000000f, 5.000000f, 0.500000f, "Bloom scale spread"));
-		Params.push_back(ShaderParam("DEBUG_EXPOSURE_GRAPH", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Debug overlay: Exposure graph"));
-		Samplers.push_back(ShaderSampler("Scale1", 5));
-		Samplers.push_back(ShaderSampler("Scale2", 6));
-		Samplers.push_back(ShaderSampler("Scale3", 7));
-		Samplers.push_back(ShaderSampler("Scale4", 8));
-		Samplers.push_back(ShaderSampler("Scale5", 9));
-		Samplers.push_back(ShaderSampler("Scale6", 10));
-		Samplers.push_back(ShaderSampler("MovingAverage", 4));
-		Samplers.push_back(ShaderSampler("Input", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bloom_blend";
+	VertexByteCode = RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterBloom_blendShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("InputSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MIN_EXP_INTENSITY", -1, 68, 4, 0.000000f, 2.000000f, 0.600000f, 0.050000f, "Bloom intensity"));
+	Params.push_back(ShaderParam("EYE_ADAPTION", -1, 72, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Eye adaptation strength: Reduce bloom on bright screens"));
+	Params.push_back(ShaderParam("MIN_EXP", -1, 76, 4, 0.000000f, 0.950000f, 0.100000f, 0.010000f, "Minimum exposure value (where bloom is strongest)"));
+	Params.push_back(ShaderParam("MAX_EXP", -1, 80, 4, 0.050000f, 1.000000f, 0.550000f, 0.010000f, "Maximum exposure value (where bloom is weakest)"));
+	Params.push_back(ShaderParam("SCALE_EMPH", -1, 84, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Bloom scale emphasis"));
+	Params.push_back(ShaderParam("SCALE_SPREAD", -1, 88, 4, 0.500000f, 15.000000f, 5.000000f, 0.500000f, "Bloom scale spread"));
+	Params.push_back(ShaderParam("DEBUG_EXPOSURE_GRAPH", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Debug overlay: Exposure graph"));
+	Samplers.push_back(ShaderSampler("Scale1", 5));
+	Samplers.push_back(ShaderSampler("Scale2", 6));
+	Samplers.push_back(ShaderSampler("Scale3", 7));
+	Samplers.push_back(ShaderSampler("Scale4", 8));
+	Samplers.push_back(ShaderSampler("Scale5", 9));
+	Samplers.push_back(ShaderSampler("Scale6", 10));
+	Samplers.push_back(ShaderSampler("MovingAverage", 4));
+	Samplers.push_back(ShaderSampler("Input", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -36,6 +36,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterBloom_blend_fastShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterBloom_blend_fastShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -973,44 +984,38 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterBloom_blend_fastShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterBloom_blend_fastShaderDef::BlursShadersDual_filterBloom_blend_fastShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterBloom_blend_fastShaderDef() : ShaderDef{}
-	{
-		Name = "bloom_blend_fast";
-		VertexByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("InputSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MIN_EXP_INTENSITY", -1, 68, 4, 0.000000f, 2.000000f, 0.600000f, 0.050000f, "Bloom intensity"));
-		Params.push_back(ShaderParam("EYE_ADAPTION", -1, 72, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Eye adaptation strength: Reduce bloom on bright screens"));
-		Params.push_back(ShaderParam("MIN_EXP", -1, 76, 4, 0.000000f, 0.950000f, 0.100000f, 0.010000f, "Minimum exposure value (where bloom is strongest)"));
-		Params.push_back(ShaderParam("MAX_EXP", -1, 80, 4, 0.050000f, 1.000000f, 0.550000f, 0.010000f, "Maximum exposure value (where bloom is weakest)"));
-		Params.push_back(ShaderParam("SCALE_EMPH", -1, 84, 4, 0.000000f, 3.000000f, 0.000000f, 0.100000f, "Bloom scale emphasis"));
-		Params.push_back(ShaderParam("SCALE_SPREAD", -1, 88, 4, 0.500000f, 10.000000f, 4.000000f, 0.500000f, "Bloom scale spread"));
-		Samplers.push_back(ShaderSampler("Scale1", 5));
-		Samplers.push_back(ShaderSampler("Scale2", 6));
-		Samplers.push_back(ShaderSampler("Scale3", 7));
-		Samplers.push_back(ShaderSampler("Scale4", 8));
-		Samplers.push_back(ShaderSampler("MovingAverage", 4));
-		Samplers.push_back(ShaderSampler("Input", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bloom_blend_fast";
+	VertexByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("InputSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MIN_EXP_INTENSITY", -1, 68, 4, 0.000000f, 2.000000f, 0.600000f, 0.050000f, "Bloom intensity"));
+	Params.push_back(ShaderParam("EYE_ADAPTION", -1, 72, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Eye adaptation strength: Reduce bloom on bright screens"));
+	Params.push_back(ShaderParam("MIN_EXP", -1, 76, 4, 0.000000f, 0.950000f, 0.100000f, 0.010000f, "Minimum exposure value (where bloom is strongest)"));
+	Params.push_back(ShaderParam("MAX_EXP", -1, 80, 4, 0.050000f, 1.000000f, 0.550000f, 0.010000f, "Maximum exposure value (where bloom is weakest)"));
+	Params.push_back(ShaderParam("SCALE_EMPH", -1, 84, 4, 0.000000f, 3.000000f, 0.000000f, 0.100000f, "Bloom scale emphasis"));
+	Params.push_back(ShaderParam("SCALE_SPREAD", -1, 88, 4, 0.500000f, 10.000000f, 4.000000f, 0.500000f, "Bloom scale spread"));
+	Samplers.push_back(ShaderSampler("Scale1", 5));
+	Samplers.push_back(ShaderSampler("Scale2", 6));
+	Samplers.push_back(ShaderSampler("Scale3", 7));
+	Samplers.push_back(ShaderSampler("Scale4", 8));
+	Samplers.push_back(ShaderSampler("MovingAverage", 4));
+	Samplers.push_back(ShaderSampler("Input", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -36,6 +36,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterBloom_blend_fastestShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterBloom_blend_fastestShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1296,41 +1307,35 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterBloom_blend_fastestShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterBloom_blend_fastestShaderDef::BlursShadersDual_filterBloom_blend_fastestShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterBloom_blend_fastestShaderDef() : ShaderDef{}
-	{
-		Name = "bloom_blend_fastest";
-		VertexByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Downsample1Size", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Downsample2Size", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("UpsampleSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BLUR_RADIUS", -1, 64, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
-		Params.push_back(ShaderParam("MIN_EXP_INTENSITY", -1, 68, 4, 0.000000f, 2.000000f, 0.600000f, 0.050000f, "Bloom intensity"));
-		Params.push_back(ShaderParam("EYE_ADAPTION", -1, 72, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Eye adaptation strength: Reduce bloom on bright screens"));
-		Params.push_back(ShaderParam("MIN_EXP", -1, 76, 4, 0.000000f, 0.950000f, 0.100000f, 0.010000f, "Minimum exposure value (where bloom is strongest)"));
-		Params.push_back(ShaderParam("MAX_EXP", -1, 80, 4, 0.050000f, 1.000000f, 0.550000f, 0.010000f, "Maximum exposure value (where bloom is weakest)"));
-		Samplers.push_back(ShaderSampler("MovingAverage", 7));
-		Samplers.push_back(ShaderSampler("Downsample1", 4));
-		Samplers.push_back(ShaderSampler("Downsample2", 5));
-		Samplers.push_back(ShaderSampler("Upsample", 6));
-		Samplers.push_back(ShaderSampler("Input", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bloom_blend_fastest";
+	VertexByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterBloom_blend_fastestShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Downsample1Size", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Downsample2Size", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("UpsampleSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BLUR_RADIUS", -1, 64, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
+	Params.push_back(ShaderParam("MIN_EXP_INTENSITY", -1, 68, 4, 0.000000f, 2.000000f, 0.600000f, 0.050000f, "Bloom intensity"));
+	Params.push_back(ShaderParam("EYE_ADAPTION", -1, 72, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Eye adaptation strength: Reduce bloom on bright screens"));
+	Params.push_back(ShaderParam("MIN_EXP", -1, 76, 4, 0.000000f, 0.950000f, 0.100000f, 0.010000f, "Minimum exposure value (where bloom is strongest)"));
+	Params.push_back(ShaderParam("MAX_EXP", -1, 80, 4, 0.050000f, 1.000000f, 0.550000f, 0.010000f, "Maximum exposure value (where bloom is weakest)"));
+	Samplers.push_back(ShaderSampler("MovingAverage", 7));
+	Samplers.push_back(ShaderSampler("Downsample1", 4));
+	Samplers.push_back(ShaderSampler("Downsample2", 5));
+	Samplers.push_back(ShaderSampler("Upsample", 6));
+	Samplers.push_back(ShaderSampler("Input", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterDownsampleShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterDownsampleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterDownsampleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -460,32 +471,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterDownsampleShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterDownsampleShaderDef::BlursShadersDual_filterDownsampleShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterDownsampleShaderDef() : ShaderDef{}
-	{
-		Name = "downsample";
-		VertexByteCode = RetroArchBlursShadersDual_filterDownsampleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterDownsampleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterDownsampleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterDownsampleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BLUR_RADIUS", -1, 52, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "downsample";
+	VertexByteCode = RetroArchBlursShadersDual_filterDownsampleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterDownsampleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterDownsampleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterDownsampleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BLUR_RADIUS", -1, 52, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
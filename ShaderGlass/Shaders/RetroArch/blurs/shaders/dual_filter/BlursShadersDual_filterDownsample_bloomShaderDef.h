@@ -21,6 +21,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterDownsample_bloomShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterDownsample_bloomShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -494,33 +505,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterDownsample_bloomShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterDownsample_bloomShaderDef::BlursShadersDual_filterDownsample_bloomShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterDownsample_bloomShaderDef() : ShaderDef{}
-	{
-		Name = "downsample_bloom";
-		VertexByteCode = RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BLUR_RADIUS", -1, 52, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
-		Params.push_back(ShaderParam("BLOOM_THRESHOLD", -1, 56, 4, 1.000000f, 10.000000f, 3.500000f, 0.100000f, "Bloom threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "downsample_bloom";
+	VertexByteCode = RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterDownsample_bloomShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BLUR_RADIUS", -1, 52, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
+	Params.push_back(ShaderParam("BLOOM_THRESHOLD", -1, 56, 4, 1.000000f, 10.000000f, 3.500000f, 0.100000f, "Bloom threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
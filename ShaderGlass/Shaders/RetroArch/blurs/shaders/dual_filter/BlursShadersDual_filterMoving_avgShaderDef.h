@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterMoving_avgShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterMoving_avgShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterMoving_avgShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -417,33 +428,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterMoving_avgShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterMoving_avgShaderDef::BlursShadersDual_filterMoving_avgShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterMoving_avgShaderDef() : ShaderDef{}
-	{
-		Name = "moving_avg";
-		VertexByteCode = RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ADAPT_SPEED", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Eye adaptation speed"));
-		Samplers.push_back(ShaderSampler("MovingAverageFeedback", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "moving_avg";
+	VertexByteCode = RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterMoving_avgShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ADAPT_SPEED", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Eye adaptation speed"));
+	Samplers.push_back(ShaderSampler("MovingAverageFeedback", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
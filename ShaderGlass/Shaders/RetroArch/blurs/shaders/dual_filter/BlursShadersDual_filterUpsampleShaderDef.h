@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersDual_filterUpsampleShaderDef : public ShaderDef
+{
+public:
+	BlursShadersDual_filterUpsampleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersDual_filterUpsampleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -529,32 +540,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersDual_filterUpsampleShaderDef : public ShaderDef
+RetroArch::BlursShadersDual_filterUpsampleShaderDef::BlursShadersDual_filterUpsampleShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersDual_filterUpsampleShaderDef() : ShaderDef{}
-	{
-		Name = "upsample";
-		VertexByteCode = RetroArchBlursShadersDual_filterUpsampleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersDual_filterUpsampleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersDual_filterUpsampleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersDual_filterUpsampleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BLUR_RADIUS", -1, 52, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "upsample";
+	VertexByteCode = RetroArchBlursShadersDual_filterUpsampleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersDual_filterUpsampleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersDual_filterUpsampleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersDual_filterUpsampleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BLUR_RADIUS", -1, 52, 4, 0.000000f, 7.500000f, 1.000000f, 0.100000f, "Blur radius"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGauss_4tapGauss_2tap_hShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGauss_4tapGauss_2tap_hShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -405,29 +416,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGauss_4tapGauss_2tap_hShaderDef : public ShaderDef
+RetroArch::BlursShadersGauss_4tapGauss_2tap_hShaderDef::BlursShadersGauss_4tapGauss_2tap_hShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGauss_4tapGauss_2tap_hShaderDef() : ShaderDef{}
-	{
-		Name = "gauss_2tap_h";
-		VertexByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIGMA", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Gaussian filtering sigma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gauss_2tap_h";
+	VertexByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_hShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIGMA", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Gaussian filtering sigma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGauss_4tapGauss_2tap_vShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGauss_4tapGauss_2tap_vShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -405,29 +416,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGauss_4tapGauss_2tap_vShaderDef : public ShaderDef
+RetroArch::BlursShadersGauss_4tapGauss_2tap_vShaderDef::BlursShadersGauss_4tapGauss_2tap_vShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGauss_4tapGauss_2tap_vShaderDef() : ShaderDef{}
-	{
-		Name = "gauss_2tap_v";
-		VertexByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIGMA", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Gaussian filtering sigma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gauss_2tap_v";
+	VertexByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGauss_4tapGauss_2tap_vShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIGMA", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Gaussian filtering sigma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGaussian_blur_filteringGaussianShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGaussian_blur_filteringGaussianShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -771,35 +782,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGaussian_blur_filteringGaussianShaderDef : public ShaderDef
+RetroArch::BlursShadersGaussian_blur_filteringGaussianShaderDef::BlursShadersGaussian_blur_filteringGaussianShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGaussian_blur_filteringGaussianShaderDef() : ShaderDef{}
-	{
-		Name = "gaussian";
-		VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 25.000000f, 6.000000f, 1.000000f, "Horizontal Blur Radius"));
-		Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 12.000000f, 1.500000f, 0.050000f, "Horizontal Blur Sigma"));
-		Params.push_back(ShaderParam("SIZEV", -1, 60, 4, 0.000000f, 25.000000f, 6.000000f, 1.000000f, "Vertical Blur Radius"));
-		Params.push_back(ShaderParam("SIGMA_V", -1, 64, 4, 0.100000f, 12.000000f, 1.500000f, 0.050000f, "Vertical Blur Sigma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gaussian";
+	VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 25.000000f, 6.000000f, 1.000000f, "Horizontal Blur Radius"));
+	Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 12.000000f, 1.500000f, 0.050000f, "Horizontal Blur Sigma"));
+	Params.push_back(ShaderParam("SIZEV", -1, 60, 4, 0.000000f, 25.000000f, 6.000000f, 1.000000f, "Vertical Blur Radius"));
+	Params.push_back(ShaderParam("SIGMA_V", -1, 64, 4, 0.100000f, 12.000000f, 1.500000f, 0.050000f, "Vertical Blur Sigma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGaussian_blur_filteringGaussianSharpShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGaussian_blur_filteringGaussianSharpShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1661,36 +1672,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGaussian_blur_filteringGaussianSharpShaderDef : public ShaderDef
+RetroArch::BlursShadersGaussian_blur_filteringGaussianSharpShaderDef::BlursShadersGaussian_blur_filteringGaussianSharpShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGaussian_blur_filteringGaussianSharpShaderDef() : ShaderDef{}
-	{
-		Name = "gaussian-sharp";
-		VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 25.000000f, 6.000000f, 1.000000f, "Gaussian Blur Radius"));
-		Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 12.000000f, 1.500000f, 0.050000f, "Gaussian Blur Sigma"));
-		Params.push_back(ShaderParam("HSHARP0", -1, 60, 4, 0.800000f, 20.000000f, 0.800000f, 0.200000f, "Sharpness Filter 'Range'"));
-		Params.push_back(ShaderParam("HAR", -1, 64, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
-		Params.push_back(ShaderParam("SHAR", -1, 68, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gaussian-sharp";
+	VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussianSharpShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 25.000000f, 6.000000f, 1.000000f, "Gaussian Blur Radius"));
+	Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 12.000000f, 1.500000f, 0.050000f, "Gaussian Blur Sigma"));
+	Params.push_back(ShaderParam("HSHARP0", -1, 60, 4, 0.800000f, 20.000000f, 0.800000f, 0.200000f, "Sharpness Filter 'Range'"));
+	Params.push_back(ShaderParam("HAR", -1, 64, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
+	Params.push_back(ShaderParam("SHAR", -1, 68, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -543,33 +554,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef : public ShaderDef
+RetroArch::BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef::BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef() : ShaderDef{}
-	{
-		Name = "gaussian_horizontal";
-		VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 40.000000f, 5.000000f, 1.000000f, "Horizontal Blur Radius"));
-		Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 15.000000f, 1.000000f, 0.050000f, "Horizontal Blur Sigma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gaussian_horizontal";
+	VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 40.000000f, 5.000000f, 1.000000f, "Horizontal Blur Radius"));
+	Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 15.000000f, 1.000000f, 0.050000f, "Horizontal Blur Sigma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
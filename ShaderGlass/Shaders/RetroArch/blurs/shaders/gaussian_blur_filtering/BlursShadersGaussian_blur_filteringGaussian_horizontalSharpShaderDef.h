@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef : public ShaderDef
+{
+public:
+	BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -962,36 +973,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef : public ShaderDef
+RetroArch::BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef::BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef() : ShaderDef{}
-	{
-		Name = "gaussian_horizontal-sharp";
-		VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 40.000000f, 5.000000f, 1.000000f, "Horizontal Blur Radius"));
-		Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 15.000000f, 0.700000f, 0.050000f, "Horizontal Blur Sigma"));
-		Params.push_back(ShaderParam("HSHARP0", -1, 60, 4, 0.800000f, 20.000000f, 0.800000f, 0.200000f, "Horizontal Sharpness Filter 'Range'"));
-		Params.push_back(ShaderParam("HAR", -1, 64, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Horizontal Anti-Ringing"));
-		Params.push_back(ShaderParam("HSHAR", -1, 68, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition - Horizontal"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gaussian_horizontal-sharp";
+	VertexByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEH", -1, 52, 4, 0.000000f, 40.000000f, 5.000000f, 1.000000f, "Horizontal Blur Radius"));
+	Params.push_back(ShaderParam("SIGMA_H", -1, 56, 4, 0.100000f, 15.000000f, 0.700000f, 0.050000f, "Horizontal Blur Sigma"));
+	Params.push_back(ShaderParam("HSHARP0", -1, 60, 4, 0.800000f, 20.000000f, 0.800000f, 0.200000f, "Horizontal Sharpness Filter 'Range'"));
+	Params.push_back(ShaderParam("HAR", -1, 64, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Horizontal Anti-Ringing"));
+	Params.push_back(ShaderParam("HSHAR", -1, 68, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition - Horizontal"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
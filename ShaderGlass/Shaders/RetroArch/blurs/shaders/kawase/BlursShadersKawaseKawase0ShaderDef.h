@@ -46,6 +46,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersKawaseKawase0ShaderDef : public ShaderDef
+{
+public:
+	BlursShadersKawaseKawase0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersKawaseKawase0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -553,32 +564,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersKawaseKawase0ShaderDef : public ShaderDef
+RetroArch::BlursShadersKawaseKawase0ShaderDef::BlursShadersKawaseKawase0ShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersKawaseKawase0ShaderDef() : ShaderDef{}
-	{
-		Name = "kawase0";
-		VertexByteCode = RetroArchBlursShadersKawaseKawase0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersKawaseKawase0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersKawaseKawase0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersKawaseKawase0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bloom_threshold", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Glow Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "kawase0";
+	VertexByteCode = RetroArchBlursShadersKawaseKawase0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersKawaseKawase0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersKawaseKawase0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersKawaseKawase0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bloom_threshold", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Glow Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
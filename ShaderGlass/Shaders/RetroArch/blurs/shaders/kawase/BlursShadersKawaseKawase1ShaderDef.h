@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersKawaseKawase1ShaderDef : public ShaderDef
+{
+public:
+	BlursShadersKawaseKawase1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersKawaseKawase1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -443,31 +454,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersKawaseKawase1ShaderDef : public ShaderDef
+RetroArch::BlursShadersKawaseKawase1ShaderDef::BlursShadersKawaseKawase1ShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersKawaseKawase1ShaderDef() : ShaderDef{}
-	{
-		Name = "kawase1";
-		VertexByteCode = RetroArchBlursShadersKawaseKawase1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersKawaseKawase1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersKawaseKawase1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersKawaseKawase1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "kawase1";
+	VertexByteCode = RetroArchBlursShadersKawaseKawase1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersKawaseKawase1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersKawaseKawase1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersKawaseKawase1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersKawaseKawase3ShaderDef : public ShaderDef
+{
+public:
+	BlursShadersKawaseKawase3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersKawaseKawase3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -443,31 +454,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersKawaseKawase3ShaderDef : public ShaderDef
+RetroArch::BlursShadersKawaseKawase3ShaderDef::BlursShadersKawaseKawase3ShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersKawaseKawase3ShaderDef() : ShaderDef{}
-	{
-		Name = "kawase3";
-		VertexByteCode = RetroArchBlursShadersKawaseKawase3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersKawaseKawase3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersKawaseKawase3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersKawaseKawase3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "kawase3";
+	VertexByteCode = RetroArchBlursShadersKawaseKawase3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersKawaseKawase3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersKawaseKawase3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersKawaseKawase3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
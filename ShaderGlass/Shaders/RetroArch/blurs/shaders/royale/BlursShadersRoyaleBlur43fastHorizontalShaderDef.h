@@ -1475,6 +1475,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersRoyaleBlur43fastHorizontalShaderDef : public ShaderDef
+{
+public:
+	BlursShadersRoyaleBlur43fastHorizontalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2279,31 +2290,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersRoyaleBlur43fastHorizontalShaderDef : public ShaderDef
+RetroArch::BlursShadersRoyaleBlur43fastHorizontalShaderDef::BlursShadersRoyaleBlur43fastHorizontalShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersRoyaleBlur43fastHorizontalShaderDef() : ShaderDef{}
-	{
-		Name = "blur43fast-horizontal";
-		VertexByteCode = RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur43fast-horizontal";
+	VertexByteCode = RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastHorizontalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -1472,6 +1472,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersRoyaleBlur43fastVerticalShaderDef : public ShaderDef
+{
+public:
+	BlursShadersRoyaleBlur43fastVerticalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2276,31 +2287,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersRoyaleBlur43fastVerticalShaderDef : public ShaderDef
+RetroArch::BlursShadersRoyaleBlur43fastVerticalShaderDef::BlursShadersRoyaleBlur43fastVerticalShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersRoyaleBlur43fastVerticalShaderDef() : ShaderDef{}
-	{
-		Name = "blur43fast-vertical";
-		VertexByteCode = RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur43fast-vertical";
+	VertexByteCode = RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur43fastVerticalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -1475,6 +1475,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersRoyaleBlur5fastHorizontalShaderDef : public ShaderDef
+{
+public:
+	BlursShadersRoyaleBlur5fastHorizontalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1898,31 +1909,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersRoyaleBlur5fastHorizontalShaderDef : public ShaderDef
+RetroArch::BlursShadersRoyaleBlur5fastHorizontalShaderDef::BlursShadersRoyaleBlur5fastHorizontalShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersRoyaleBlur5fastHorizontalShaderDef() : ShaderDef{}
-	{
-		Name = "blur5fast-horizontal";
-		VertexByteCode = RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur5fast-horizontal";
+	VertexByteCode = RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastHorizontalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -1472,6 +1472,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersRoyaleBlur5fastVerticalShaderDef : public ShaderDef
+{
+public:
+	BlursShadersRoyaleBlur5fastVerticalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1895,31 +1906,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersRoyaleBlur5fastVerticalShaderDef : public ShaderDef
+RetroArch::BlursShadersRoyaleBlur5fastVerticalShaderDef::BlursShadersRoyaleBlur5fastVerticalShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersRoyaleBlur5fastVerticalShaderDef() : ShaderDef{}
-	{
-		Name = "blur5fast-vertical";
-		VertexByteCode = RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur5fast-vertical";
+	VertexByteCode = RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur5fastVerticalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
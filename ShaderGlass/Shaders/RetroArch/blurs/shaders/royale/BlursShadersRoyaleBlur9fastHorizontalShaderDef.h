@@ -1475,6 +1475,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersRoyaleBlur9fastHorizontalShaderDef : public ShaderDef
+{
+public:
+	BlursShadersRoyaleBlur9fastHorizontalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1932,31 +1943,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersRoyaleBlur9fastHorizontalShaderDef : public ShaderDef
+RetroArch::BlursShadersRoyaleBlur9fastHorizontalShaderDef::BlursShadersRoyaleBlur9fastHorizontalShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersRoyaleBlur9fastHorizontalShaderDef() : ShaderDef{}
-	{
-		Name = "blur9fast-horizontal";
-		VertexByteCode = RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur9fast-horizontal";
+	VertexByteCode = RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersRoyaleBlur9fastHorizontalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BlursShadersSunset_gaussianSunset_horzShaderDef : public ShaderDef
+{
+public:
+	BlursShadersSunset_gaussianSunset_horzShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -511,31 +522,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BlursShadersSunset_gaussianSunset_horzShaderDef : public ShaderDef
+RetroArch::BlursShadersSunset_gaussianSunset_horzShaderDef::BlursShadersSunset_gaussianSunset_horzShaderDef() : ShaderDef{}
 {
-public:
-	BlursShadersSunset_gaussianSunset_horzShaderDef() : ShaderDef{}
-	{
-		Name = "sunset_horz";
-		VertexByteCode = RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sunset_horz";
+	VertexByteCode = RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBlursShadersSunset_gaussianSunset_horzShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderGameboyPlayerGameboyPlayerTextureDef : public TextureDef
+{
+public:
+	BorderGameboyPlayerGameboyPlayerTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderGameboyPlayerGameboyPlayerTextureDefs
 {
 const BYTE sData[] =
@@ -124,13 +132,10 @@ const BYTE sData[] =
 ,107,108,233,206,240,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderGameboyPlayerGameboyPlayerTextureDef : public TextureDef
+BorderGameboyPlayerGameboyPlayerTextureDef::BorderGameboyPlayerGameboyPlayerTextureDef() : TextureDef{}
 {
-public:
-	BorderGameboyPlayerGameboyPlayerTextureDef() : TextureDef{}
-	{
-		Name = "gameboy-player.png";
-		Data = BorderGameboyPlayerGameboyPlayerTextureDefs::sData;
-		DataLength = sizeof(BorderGameboyPlayerGameboyPlayerTextureDefs::sData);
-	}
-};
+	Name = "gameboy-player.png";
+	Data = BorderGameboyPlayerGameboyPlayerTextureDefs::sData;
+	DataLength = sizeof(BorderGameboyPlayerGameboyPlayerTextureDefs::sData);
+}
+#endif
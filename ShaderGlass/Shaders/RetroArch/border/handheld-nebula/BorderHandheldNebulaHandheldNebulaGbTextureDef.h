@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderHandheldNebulaHandheldNebulaGbTextureDef : public TextureDef
+{
+public:
+	BorderHandheldNebulaHandheldNebulaGbTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderHandheldNebulaHandheldNebulaGbTextureDefs
 {
 const BYTE sData[] =
@@ -673,13 +681,10 @@ const BYTE sData[] =
 ,191,125,8,68,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderHandheldNebulaHandheldNebulaGbTextureDef : public TextureDef
+BorderHandheldNebulaHandheldNebulaGbTextureDef::BorderHandheldNebulaHandheldNebulaGbTextureDef() : TextureDef{}
 {
-public:
-	BorderHandheldNebulaHandheldNebulaGbTextureDef() : TextureDef{}
-	{
-		Name = "handheld-nebula-gb.png";
-		Data = BorderHandheldNebulaHandheldNebulaGbTextureDefs::sData;
-		DataLength = sizeof(BorderHandheldNebulaHandheldNebulaGbTextureDefs::sData);
-	}
-};
+	Name = "handheld-nebula-gb.png";
+	Data = BorderHandheldNebulaHandheldNebulaGbTextureDefs::sData;
+	DataLength = sizeof(BorderHandheldNebulaHandheldNebulaGbTextureDefs::sData);
+}
+#endif
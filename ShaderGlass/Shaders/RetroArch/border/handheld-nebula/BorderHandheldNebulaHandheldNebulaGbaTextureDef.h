@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderHandheldNebulaHandheldNebulaGbaTextureDef : public TextureDef
+{
+public:
+	BorderHandheldNebulaHandheldNebulaGbaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderHandheldNebulaHandheldNebulaGbaTextureDefs
 {
 const BYTE sData[] =
@@ -410,13 +418,10 @@ const BYTE sData[] =
 ,71,214,51,153,70,136,1,198,198,116,91,21,101,48,33,35,12,253,63,69,5,86,33,18,191,247,64,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderHandheldNebulaHandheldNebulaGbaTextureDef : public TextureDef
+BorderHandheldNebulaHandheldNebulaGbaTextureDef::BorderHandheldNebulaHandheldNebulaGbaTextureDef() : TextureDef{}
 {
-public:
-	BorderHandheldNebulaHandheldNebulaGbaTextureDef() : TextureDef{}
-	{
-		Name = "handheld-nebula-gba.png";
-		Data = BorderHandheldNebulaHandheldNebulaGbaTextureDefs::sData;
-		DataLength = sizeof(BorderHandheldNebulaHandheldNebulaGbaTextureDefs::sData);
-	}
-};
+	Name = "handheld-nebula-gba.png";
+	Data = BorderHandheldNebulaHandheldNebulaGbaTextureDefs::sData;
+	DataLength = sizeof(BorderHandheldNebulaHandheldNebulaGbaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderHandheldNebulaHandheldNebulaGgTextureDef : public TextureDef
+{
+public:
+	BorderHandheldNebulaHandheldNebulaGgTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderHandheldNebulaHandheldNebulaGgTextureDefs
 {
 const BYTE sData[] =
@@ -571,13 +579,10 @@ const BYTE sData[] =
 ,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderHandheldNebulaHandheldNebulaGgTextureDef : public TextureDef
+BorderHandheldNebulaHandheldNebulaGgTextureDef::BorderHandheldNebulaHandheldNebulaGgTextureDef() : TextureDef{}
 {
-public:
-	BorderHandheldNebulaHandheldNebulaGgTextureDef() : TextureDef{}
-	{
-		Name = "handheld-nebula-gg.png";
-		Data = BorderHandheldNebulaHandheldNebulaGgTextureDefs::sData;
-		DataLength = sizeof(BorderHandheldNebulaHandheldNebulaGgTextureDefs::sData);
-	}
-};
+	Name = "handheld-nebula-gg.png";
+	Data = BorderHandheldNebulaHandheldNebulaGgTextureDefs::sData;
+	DataLength = sizeof(BorderHandheldNebulaHandheldNebulaGgTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderSgbSgbTextureDef : public TextureDef
+{
+public:
+	BorderSgbSgbTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderSgbSgbTextureDefs
 {
 const BYTE sData[] =
@@ -50,13 +58,10 @@ const BYTE sData[] =
 ,128,203,174,7,4,224,19,0,13,118,200,96,61,250,63,34,192,103,222,219,152,157,201,89,100,148,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderSgbSgbTextureDef : public TextureDef
+BorderSgbSgbTextureDef::BorderSgbSgbTextureDef() : TextureDef{}
 {
-public:
-	BorderSgbSgbTextureDef() : TextureDef{}
-	{
-		Name = "sgb.png";
-		Data = BorderSgbSgbTextureDefs::sData;
-		DataLength = sizeof(BorderSgbSgbTextureDefs::sData);
-	}
-};
+	Name = "sgb.png";
+	Data = BorderSgbSgbTextureDefs::sData;
+	DataLength = sizeof(BorderSgbSgbTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderSgbaSgbaTextureDef : public TextureDef
+{
+public:
+	BorderSgbaSgbaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderSgbaSgbaTextureDefs
 {
 const BYTE sData[] =
@@ -49,13 +57,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class BorderSgbaSgbaTextureDef : public TextureDef
+BorderSgbaSgbaTextureDef::BorderSgbaSgbaTextureDef() : TextureDef{}
 {
-public:
-	BorderSgbaSgbaTextureDef() : TextureDef{}
-	{
-		Name = "sgba.png";
-		Data = BorderSgbaSgbaTextureDefs::sData;
-		DataLength = sizeof(BorderSgbaSgbaTextureDefs::sData);
-	}
-};
+	Name = "sgba.png";
+	Data = BorderSgbaSgbaTextureDefs::sData;
+	DataLength = sizeof(BorderSgbaSgbaTextureDefs::sData);
+}
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersAmbientGlowShaderDef : public ShaderDef
+{
+public:
+	BorderShadersAmbientGlowShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersAmbientGlowShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1044,46 +1055,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersAmbientGlowShaderDef : public ShaderDef
+RetroArch::BorderShadersAmbientGlowShaderDef::BorderShadersAmbientGlowShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersAmbientGlowShaderDef() : ShaderDef{}
-	{
-		Name = "ambient-glow";
-		VertexByteCode = RetroArchBorderShadersAmbientGlowShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersAmbientGlowShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersAmbientGlowShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersAmbientGlowShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("integer_scale", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force Integer Scaling"));
-		Params.push_back(ShaderParam("overscale", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Integer Overscale"));
-		Params.push_back(ShaderParam("effect", -1, 60, 4, 0.100000f, 3.000000f, 1.000000f, 0.100000f, "Glow Brightness"));
-		Params.push_back(ShaderParam("scanline_toggle", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Toggle"));
-		Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", -1, 68, 4, 0.000000f, 1.000000f, 0.950000f, 0.010000f, "Scanline Base Brightness"));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", -1, 72, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Scanline Sine Comp A"));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", -1, 76, 4, 0.000000f, 1.000000f, 0.150000f, 0.050000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("interp_toggle", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharpen Linear Scaling"));
-		Params.push_back(ShaderParam("OS_MASK_TOP", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Top"));
-		Params.push_back(ShaderParam("OS_MASK_BOTTOM", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Bottom"));
-		Params.push_back(ShaderParam("OS_MASK_LEFT", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Left"));
-		Params.push_back(ShaderParam("OS_MASK_RIGHT", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Right"));
-		Params.push_back(ShaderParam("aspect_x", -1, 100, 4, 1.000000f, 256.000000f, 64.000000f, 1.000000f, "Aspect Ratio Numerator"));
-		Params.push_back(ShaderParam("aspect_y", -1, 104, 4, 1.000000f, 256.000000f, 49.000000f, 1.000000f, "Aspect Ratio Denominator"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("Original", 3));
+	Name = "ambient-glow";
+	VertexByteCode = RetroArchBorderShadersAmbientGlowShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersAmbientGlowShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersAmbientGlowShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersAmbientGlowShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("integer_scale", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force Integer Scaling"));
+	Params.push_back(ShaderParam("overscale", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Integer Overscale"));
+	Params.push_back(ShaderParam("effect", -1, 60, 4, 0.100000f, 3.000000f, 1.000000f, 0.100000f, "Glow Brightness"));
+	Params.push_back(ShaderParam("scanline_toggle", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Toggle"));
+	Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", -1, 68, 4, 0.000000f, 1.000000f, 0.950000f, 0.010000f, "Scanline Base Brightness"));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", -1, 72, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Scanline Sine Comp A"));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", -1, 76, 4, 0.000000f, 1.000000f, 0.150000f, 0.050000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("interp_toggle", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharpen Linear Scaling"));
+	Params.push_back(ShaderParam("OS_MASK_TOP", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Top"));
+	Params.push_back(ShaderParam("OS_MASK_BOTTOM", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Bottom"));
+	Params.push_back(ShaderParam("OS_MASK_LEFT", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Left"));
+	Params.push_back(ShaderParam("OS_MASK_RIGHT", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Overscan Mask Right"));
+	Params.push_back(ShaderParam("aspect_x", -1, 100, 4, 1.000000f, 256.000000f, 64.000000f, 1.000000f, "Aspect Ratio Numerator"));
+	Params.push_back(ShaderParam("aspect_y", -1, 104, 4, 1.000000f, 256.000000f, 49.000000f, 1.000000f, "Aspect Ratio Denominator"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("Original", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersBigblurShaderDef : public ShaderDef
+{
+public:
+	BorderShadersBigblurShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersBigblurShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1061,46 +1072,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersBigblurShaderDef : public ShaderDef
+RetroArch::BorderShadersBigblurShaderDef::BorderShadersBigblurShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersBigblurShaderDef() : ShaderDef{}
-	{
-		Name = "bigblur";
-		VertexByteCode = RetroArchBorderShadersBigblurShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersBigblurShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersBigblurShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersBigblurShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("aspect_x", -1, 52, 4, 1.000000f, 256.000000f, 64.000000f, 1.000000f, "Aspect Ratio Numerator"));
-		Params.push_back(ShaderParam("aspect_y", -1, 56, 4, 1.000000f, 256.000000f, 49.000000f, 1.000000f, "Aspect Ratio Denominator"));
-		Params.push_back(ShaderParam("border_zoom", -1, 60, 4, 0.500000f, 10.000000f, 1.500000f, 0.500000f, "Border Zoom"));
-		Params.push_back(ShaderParam("BRIGHTNESS", -1, 64, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Border Brightness Mod"));
-		Params.push_back(ShaderParam("integer_scale", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force Integer Scaling"));
-		Params.push_back(ShaderParam("overscale", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Integer Overscale"));
-		Params.push_back(ShaderParam("scanline_toggle", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Toggle"));
-		Params.push_back(ShaderParam("interp_toggle", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharpen Linear Scaling"));
-		Params.push_back(ShaderParam("THICKNESS", -1, 84, 4, 1.000000f, 12.000000f, 2.000000f, 1.000000f, "Scanline Thickness"));
-		Params.push_back(ShaderParam("DARKNESS", -1, 88, 4, 0.000000f, 1.000000f, 0.350000f, 0.050000f, "Scanline Darkness"));
-		Params.push_back(ShaderParam("OS_MASK_TOP", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Top"));
-		Params.push_back(ShaderParam("OS_MASK_BOTTOM", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Bottom"));
-		Params.push_back(ShaderParam("OS_MASK_LEFT", -1, 100, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Left"));
-		Params.push_back(ShaderParam("OS_MASK_RIGHT", -1, 104, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Right"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("Reference", 3));
+	Name = "bigblur";
+	VertexByteCode = RetroArchBorderShadersBigblurShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersBigblurShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersBigblurShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersBigblurShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("aspect_x", -1, 52, 4, 1.000000f, 256.000000f, 64.000000f, 1.000000f, "Aspect Ratio Numerator"));
+	Params.push_back(ShaderParam("aspect_y", -1, 56, 4, 1.000000f, 256.000000f, 49.000000f, 1.000000f, "Aspect Ratio Denominator"));
+	Params.push_back(ShaderParam("border_zoom", -1, 60, 4, 0.500000f, 10.000000f, 1.500000f, 0.500000f, "Border Zoom"));
+	Params.push_back(ShaderParam("BRIGHTNESS", -1, 64, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Border Brightness Mod"));
+	Params.push_back(ShaderParam("integer_scale", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force Integer Scaling"));
+	Params.push_back(ShaderParam("overscale", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Integer Overscale"));
+	Params.push_back(ShaderParam("scanline_toggle", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Toggle"));
+	Params.push_back(ShaderParam("interp_toggle", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharpen Linear Scaling"));
+	Params.push_back(ShaderParam("THICKNESS", -1, 84, 4, 1.000000f, 12.000000f, 2.000000f, 1.000000f, "Scanline Thickness"));
+	Params.push_back(ShaderParam("DARKNESS", -1, 88, 4, 0.000000f, 1.000000f, 0.350000f, 0.050000f, "Scanline Darkness"));
+	Params.push_back(ShaderParam("OS_MASK_TOP", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Top"));
+	Params.push_back(ShaderParam("OS_MASK_BOTTOM", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Bottom"));
+	Params.push_back(ShaderParam("OS_MASK_LEFT", -1, 100, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Left"));
+	Params.push_back(ShaderParam("OS_MASK_RIGHT", -1, 104, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "OS Mask Right"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("Reference", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
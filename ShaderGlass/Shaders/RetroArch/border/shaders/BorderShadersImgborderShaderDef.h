@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersImgborderShaderDef : public ShaderDef
+{
+public:
+	BorderShadersImgborderShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersImgborderShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -819,45 +830,39 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersImgborderShaderDef : public ShaderDef
+RetroArch::BorderShadersImgborderShaderDef::BorderShadersImgborderShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersImgborderShaderDef() : ShaderDef{}
-	{
-		Name = "imgborder";
-		VertexByteCode = RetroArchBorderShadersImgborderShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersImgborderShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersImgborderShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersImgborderShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("box_scale", -1, 52, 4, 1.000000f, 10.000000f, 4.000000f, 1.000000f, "Image Scale"));
-		Params.push_back(ShaderParam("location_x", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Viewport X Pos."));
-		Params.push_back(ShaderParam("location_y", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Viewport Y Pos."));
-		Params.push_back(ShaderParam("in_res_x", -1, 64, 4, 100.000000f, 600.000000f, 320.000000f, 1.000000f, "Viewport Size X"));
-		Params.push_back(ShaderParam("in_res_y", -1, 68, 4, 64.000000f, 512.000000f, 240.000000f, 1.000000f, "Viewport Size Y"));
-		Params.push_back(ShaderParam("border_on_top", -1, 72, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Show Viewport"));
-		Params.push_back(ShaderParam("border_zoom_x", -1, 76, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Border Zoom X"));
-		Params.push_back(ShaderParam("border_zoom_y", -1, 80, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Border Zoom Y"));
-		Params.push_back(ShaderParam("OS_MASK_TOP", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Top"));
-		Params.push_back(ShaderParam("OS_MASK_BOTTOM", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Bottom"));
-		Params.push_back(ShaderParam("OS_MASK_LEFT", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Left"));
-		Params.push_back(ShaderParam("OS_MASK_RIGHT", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Right"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("BORDER", 4));
-		Samplers.push_back(ShaderSampler("Original", 3));
+	Name = "imgborder";
+	VertexByteCode = RetroArchBorderShadersImgborderShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersImgborderShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersImgborderShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersImgborderShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("box_scale", -1, 52, 4, 1.000000f, 10.000000f, 4.000000f, 1.000000f, "Image Scale"));
+	Params.push_back(ShaderParam("location_x", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Viewport X Pos."));
+	Params.push_back(ShaderParam("location_y", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Viewport Y Pos."));
+	Params.push_back(ShaderParam("in_res_x", -1, 64, 4, 100.000000f, 600.000000f, 320.000000f, 1.000000f, "Viewport Size X"));
+	Params.push_back(ShaderParam("in_res_y", -1, 68, 4, 64.000000f, 512.000000f, 240.000000f, 1.000000f, "Viewport Size Y"));
+	Params.push_back(ShaderParam("border_on_top", -1, 72, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Show Viewport"));
+	Params.push_back(ShaderParam("border_zoom_x", -1, 76, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Border Zoom X"));
+	Params.push_back(ShaderParam("border_zoom_y", -1, 80, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Border Zoom Y"));
+	Params.push_back(ShaderParam("OS_MASK_TOP", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Top"));
+	Params.push_back(ShaderParam("OS_MASK_BOTTOM", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Bottom"));
+	Params.push_back(ShaderParam("OS_MASK_LEFT", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Left"));
+	Params.push_back(ShaderParam("OS_MASK_RIGHT", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "OS Mask Right"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("BORDER", 4));
+	Samplers.push_back(ShaderSampler("Original", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
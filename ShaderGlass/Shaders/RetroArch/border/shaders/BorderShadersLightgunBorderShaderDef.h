@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersLightgunBorderShaderDef : public ShaderDef
+{
+public:
+	BorderShadersLightgunBorderShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersLightgunBorderShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -561,36 +572,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersLightgunBorderShaderDef : public ShaderDef
+RetroArch::BorderShadersLightgunBorderShaderDef::BorderShadersLightgunBorderShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersLightgunBorderShaderDef() : ShaderDef{}
-	{
-		Name = "lightgun-border";
-		VertexByteCode = RetroArchBorderShadersLightgunBorderShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersLightgunBorderShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersLightgunBorderShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersLightgunBorderShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("TotalSubFrames", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CurrentSubFrame", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bordersize", -1, 80, 4, 0.000000f, 1.000000f, 0.020000f, 0.010000f, "Border Thickness"));
-		Params.push_back(ShaderParam("bordercolor", -1, 84, 4, 1.000000f, 6.000000f, 1.000000f, 1.000000f, "Border Color"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lightgun-border";
+	VertexByteCode = RetroArchBorderShadersLightgunBorderShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersLightgunBorderShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersLightgunBorderShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersLightgunBorderShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("TotalSubFrames", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CurrentSubFrame", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bordersize", -1, 80, 4, 0.000000f, 1.000000f, 0.020000f, 0.010000f, "Border Thickness"));
+	Params.push_back(ShaderParam("bordercolor", -1, 84, 4, 1.000000f, 6.000000f, 1.000000f, 1.000000f, "Border Color"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
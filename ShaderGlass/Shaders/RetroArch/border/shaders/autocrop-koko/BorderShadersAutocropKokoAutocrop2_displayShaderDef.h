@@ -31,6 +31,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersAutocropKokoAutocrop2_displayShaderDef : public ShaderDef
+{
+public:
+	BorderShadersAutocropKokoAutocrop2_displayShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -547,38 +558,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersAutocropKokoAutocrop2_displayShaderDef : public ShaderDef
+RetroArch::BorderShadersAutocropKokoAutocrop2_displayShaderDef::BorderShadersAutocropKokoAutocrop2_displayShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersAutocropKokoAutocrop2_displayShaderDef() : ShaderDef{}
-	{
-		Name = "autocrop2_display";
-		VertexByteCode = RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AUTOCROP_MAX", 0, 64, 4, 0.000000f, 0.500000f, 25.000000f, 0.010000f, "★ Autocrop: maximum amount"));
-		Params.push_back(ShaderParam("AUTOCROP_MIN", 0, 68, 4, 0.000000f, 10.000000f, 1.000000f, 1.000000f, "Number of mandatory lines to crop"));
-		Params.push_back(ShaderParam("AUTOCROP_SAMPLES", 0, 72, 4, 0.000000f, 300.000000f, 20.000000f, 1.000000f, "Samples per frame (faster response, higher gpu use)"));
-		Params.push_back(ShaderParam("AUTOCROP_SAMPLE_SIZE", 0, 76, 4, 0.000000f, 5.000000f, 2.000000f, 1.000000f, "Sample size (big speedup, less accurate)"));
-		Params.push_back(ShaderParam("AUTOCROP_TRANSITION_SPEED", 0, 80, 4, 0.050000f, 1.000000f, 0.100000f, 0.050000f, "Transition speed"));
-		Params.push_back(ShaderParam("AUTOCROP_STEADINESS", 0, 84, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Scene change treshold (0 = continuous cropping)"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("autocrop_compute", 3));
-		Samplers.push_back(ShaderSampler("autocrop_precut", 2));
+	Name = "autocrop2_display";
+	VertexByteCode = RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersAutocropKokoAutocrop2_displayShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AUTOCROP_MAX", 0, 64, 4, 0.000000f, 0.500000f, 25.000000f, 0.010000f, "★ Autocrop: maximum amount"));
+	Params.push_back(ShaderParam("AUTOCROP_MIN", 0, 68, 4, 0.000000f, 10.000000f, 1.000000f, 1.000000f, "Number of mandatory lines to crop"));
+	Params.push_back(ShaderParam("AUTOCROP_SAMPLES", 0, 72, 4, 0.000000f, 300.000000f, 20.000000f, 1.000000f, "Samples per frame (faster response, higher gpu use)"));
+	Params.push_back(ShaderParam("AUTOCROP_SAMPLE_SIZE", 0, 76, 4, 0.000000f, 5.000000f, 2.000000f, 1.000000f, "Sample size (big speedup, less accurate)"));
+	Params.push_back(ShaderParam("AUTOCROP_TRANSITION_SPEED", 0, 80, 4, 0.050000f, 1.000000f, 0.100000f, 0.050000f, "Transition speed"));
+	Params.push_back(ShaderParam("AUTOCROP_STEADINESS", 0, 84, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Scene change treshold (0 = continuous cropping)"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("autocrop_compute", 3));
+	Samplers.push_back(ShaderSampler("autocrop_precut", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -95,6 +95,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersAverage_fillComposeShaderDef : public ShaderDef
+{
+public:
+	BorderShadersAverage_fillComposeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersAverage_fillComposeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3504,55 +3515,49 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersAverage_fillComposeShaderDef : public ShaderDef
+RetroArch::BorderShadersAverage_fillComposeShaderDef::BorderShadersAverage_fillComposeShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersAverage_fillComposeShaderDef() : ShaderDef{}
-	{
-		Name = "compose";
-		VertexByteCode = RetroArchBorderShadersAverage_fillComposeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersAverage_fillComposeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersAverage_fillComposeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersAverage_fillComposeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("EXTEND_H", -1, 36, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Extend the fill horizontally"));
-		Params.push_back(ShaderParam("EXTEND_V", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Extend the fill vertically"));
-		Params.push_back(ShaderParam("CORNER_BLEND_MODE", -1, 44, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Cropped corner blend mode"));
-		Params.push_back(ShaderParam("FILL_GAMMA", -1, 48, 4, 0.500000f, 2.000000f, 1.000000f, 0.100000f, "Background fill gamma adjustment"));
-		Params.push_back(ShaderParam("SAMPLE_SIZE", -1, 52, 4, 1.000000f, 64.000000f, 8.000000f, 1.000000f, "No. of lines for calculating the average"));
-		Params.push_back(ShaderParam("FORCE_ASPECT_RATIO", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force aspect ratio"));
-		Params.push_back(ShaderParam("ASPECT_H", -1, 60, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Horizontal aspect ratio before crop (0 = unchanged)"));
-		Params.push_back(ShaderParam("ASPECT_V", -1, 64, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Vertical aspect ratio before crop (0 = unchanged)"));
-		Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_H", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling horizontally"));
-		Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_V", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling vertically"));
-		Params.push_back(ShaderParam("OVERSCALE", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Overscale (0 = full image, 1 = full screen)"));
-		Params.push_back(ShaderParam("OS_CROP_TOP", -1, 80, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop top"));
-		Params.push_back(ShaderParam("OS_CROP_BOTTOM", -1, 84, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop bottom"));
-		Params.push_back(ShaderParam("OS_CROP_LEFT", -1, 88, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop left"));
-		Params.push_back(ShaderParam("OS_CROP_RIGHT", -1, 92, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop right"));
-		Params.push_back(ShaderParam("SHIFT_H", -1, 96, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Horizontal shift"));
-		Params.push_back(ShaderParam("SHIFT_V", -1, 100, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Vertical shift"));
-		Params.push_back(ShaderParam("CENTER_AFTER_CROPPING", -1, 104, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Center cropped area"));
-		Params.push_back(ShaderParam("PIX_AA_SHARP", -1, 108, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Pixel AA sharpening amount"));
-		Params.push_back(ShaderParam("PIX_AA_SUBPX", -1, 112, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable subpixel AA"));
-		Params.push_back(ShaderParam("PIX_AA_SUBPX_ORIENTATION", -1, 116, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Subpixel layout (0=RGB, 1=RGB vert., 2=BGR, 3=BGR vert.)"));
-		Samplers.push_back(ShaderSampler("Left", 5));
-		Samplers.push_back(ShaderSampler("Top", 3));
-		Samplers.push_back(ShaderSampler("Bottom", 4));
-		Samplers.push_back(ShaderSampler("Input", 2));
-		Samplers.push_back(ShaderSampler("Right", 6));
+	Name = "compose";
+	VertexByteCode = RetroArchBorderShadersAverage_fillComposeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersAverage_fillComposeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersAverage_fillComposeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersAverage_fillComposeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("EXTEND_H", -1, 36, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Extend the fill horizontally"));
+	Params.push_back(ShaderParam("EXTEND_V", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Extend the fill vertically"));
+	Params.push_back(ShaderParam("CORNER_BLEND_MODE", -1, 44, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Cropped corner blend mode"));
+	Params.push_back(ShaderParam("FILL_GAMMA", -1, 48, 4, 0.500000f, 2.000000f, 1.000000f, 0.100000f, "Background fill gamma adjustment"));
+	Params.push_back(ShaderParam("SAMPLE_SIZE", -1, 52, 4, 1.000000f, 64.000000f, 8.000000f, 1.000000f, "No. of lines for calculating the average"));
+	Params.push_back(ShaderParam("FORCE_ASPECT_RATIO", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force aspect ratio"));
+	Params.push_back(ShaderParam("ASPECT_H", -1, 60, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Horizontal aspect ratio before crop (0 = unchanged)"));
+	Params.push_back(ShaderParam("ASPECT_V", -1, 64, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Vertical aspect ratio before crop (0 = unchanged)"));
+	Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_H", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling horizontally"));
+	Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_V", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling vertically"));
+	Params.push_back(ShaderParam("OVERSCALE", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Overscale (0 = full image, 1 = full screen)"));
+	Params.push_back(ShaderParam("OS_CROP_TOP", -1, 80, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop top"));
+	Params.push_back(ShaderParam("OS_CROP_BOTTOM", -1, 84, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop bottom"));
+	Params.push_back(ShaderParam("OS_CROP_LEFT", -1, 88, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop left"));
+	Params.push_back(ShaderParam("OS_CROP_RIGHT", -1, 92, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop right"));
+	Params.push_back(ShaderParam("SHIFT_H", -1, 96, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Horizontal shift"));
+	Params.push_back(ShaderParam("SHIFT_V", -1, 100, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Vertical shift"));
+	Params.push_back(ShaderParam("CENTER_AFTER_CROPPING", -1, 104, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Center cropped area"));
+	Params.push_back(ShaderParam("PIX_AA_SHARP", -1, 108, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Pixel AA sharpening amount"));
+	Params.push_back(ShaderParam("PIX_AA_SUBPX", -1, 112, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable subpixel AA"));
+	Params.push_back(ShaderParam("PIX_AA_SUBPX_ORIENTATION", -1, 116, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Subpixel layout (0=RGB, 1=RGB vert., 2=BGR, 3=BGR vert.)"));
+	Samplers.push_back(ShaderSampler("Left", 5));
+	Samplers.push_back(ShaderSampler("Top", 3));
+	Samplers.push_back(ShaderSampler("Bottom", 4));
+	Samplers.push_back(ShaderSampler("Input", 2));
+	Samplers.push_back(ShaderSampler("Right", 6));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
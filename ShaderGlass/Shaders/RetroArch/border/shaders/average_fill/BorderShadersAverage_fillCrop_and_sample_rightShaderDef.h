@@ -37,6 +37,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersAverage_fillCrop_and_sample_rightShaderDef : public ShaderDef
+{
+public:
+	BorderShadersAverage_fillCrop_and_sample_rightShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -490,34 +501,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersAverage_fillCrop_and_sample_rightShaderDef : public ShaderDef
+RetroArch::BorderShadersAverage_fillCrop_and_sample_rightShaderDef::BorderShadersAverage_fillCrop_and_sample_rightShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersAverage_fillCrop_and_sample_rightShaderDef() : ShaderDef{}
-	{
-		Name = "crop_and_sample_right";
-		VertexByteCode = RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SAMPLE_SIZE", -1, 20, 4, 1.000000f, 64.000000f, 8.000000f, 1.000000f, "No. of lines for calculating the average"));
-		Params.push_back(ShaderParam("OS_CROP_TOP", -1, 24, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop top"));
-		Params.push_back(ShaderParam("OS_CROP_BOTTOM", -1, 28, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop bottom"));
-		Params.push_back(ShaderParam("OS_CROP_LEFT", -1, 32, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop left"));
-		Params.push_back(ShaderParam("OS_CROP_RIGHT", -1, 36, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop right"));
-		Samplers.push_back(ShaderSampler("Input", 2));
+	Name = "crop_and_sample_right";
+	VertexByteCode = RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersAverage_fillCrop_and_sample_rightShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SAMPLE_SIZE", -1, 20, 4, 1.000000f, 64.000000f, 8.000000f, 1.000000f, "No. of lines for calculating the average"));
+	Params.push_back(ShaderParam("OS_CROP_TOP", -1, 24, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop top"));
+	Params.push_back(ShaderParam("OS_CROP_BOTTOM", -1, 28, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop bottom"));
+	Params.push_back(ShaderParam("OS_CROP_LEFT", -1, 32, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop left"));
+	Params.push_back(ShaderParam("OS_CROP_RIGHT", -1, 36, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop right"));
+	Samplers.push_back(ShaderSampler("Input", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
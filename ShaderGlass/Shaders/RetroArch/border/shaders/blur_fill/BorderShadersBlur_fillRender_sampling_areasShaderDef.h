@@ -68,6 +68,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class BorderShadersBlur_fillRender_sampling_areasShaderDef : public ShaderDef
+{
+public:
+	BorderShadersBlur_fillRender_sampling_areasShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3174,47 +3185,41 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class BorderShadersBlur_fillRender_sampling_areasShaderDef : public ShaderDef
+RetroArch::BorderShadersBlur_fillRender_sampling_areasShaderDef::BorderShadersBlur_fillRender_sampling_areasShaderDef() : ShaderDef{}
 {
-public:
-	BorderShadersBlur_fillRender_sampling_areasShaderDef() : ShaderDef{}
-	{
-		Name = "render_sampling_areas";
-		VertexByteCode = RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("EXTEND_H", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Extend the fill horizontally"));
-		Params.push_back(ShaderParam("EXTEND_V", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Extend the fill vertically"));
-		Params.push_back(ShaderParam("MIRROR_BLUR", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mirror the blur"));
-		Params.push_back(ShaderParam("SAMPLE_SIZE", -1, 48, 4, 1.000000f, 1024.000000f, 16.000000f, 1.000000f, "No. of lines for rendering the blur"));
-		Params.push_back(ShaderParam("FORCE_ASPECT_RATIO", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force aspect ratio"));
-		Params.push_back(ShaderParam("ASPECT_H", -1, 56, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Horizontal aspect ratio before crop (0 = unchanged)"));
-		Params.push_back(ShaderParam("ASPECT_V", -1, 60, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Vertical aspect ratio before crop (0 = unchanged)"));
-		Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_H", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling horizontally"));
-		Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_V", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling vertically"));
-		Params.push_back(ShaderParam("OVERSCALE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Overscale (0 = full image, 1 = full screen)"));
-		Params.push_back(ShaderParam("OS_CROP_TOP", -1, 76, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop top"));
-		Params.push_back(ShaderParam("OS_CROP_BOTTOM", -1, 80, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop bottom"));
-		Params.push_back(ShaderParam("OS_CROP_LEFT", -1, 84, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop left"));
-		Params.push_back(ShaderParam("OS_CROP_RIGHT", -1, 88, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop right"));
-		Params.push_back(ShaderParam("SHIFT_H", -1, 92, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Horizontal shift"));
-		Params.push_back(ShaderParam("SHIFT_V", -1, 96, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Vertical shift"));
-		Params.push_back(ShaderParam("CENTER_AFTER_CROPPING", -1, 100, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Center cropped area"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "render_sampling_areas";
+	VertexByteCode = RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchBorderShadersBlur_fillRender_sampling_areasShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("InputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("EXTEND_H", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Extend the fill horizontally"));
+	Params.push_back(ShaderParam("EXTEND_V", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Extend the fill vertically"));
+	Params.push_back(ShaderParam("MIRROR_BLUR", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mirror the blur"));
+	Params.push_back(ShaderParam("SAMPLE_SIZE", -1, 48, 4, 1.000000f, 1024.000000f, 16.000000f, 1.000000f, "No. of lines for rendering the blur"));
+	Params.push_back(ShaderParam("FORCE_ASPECT_RATIO", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Force aspect ratio"));
+	Params.push_back(ShaderParam("ASPECT_H", -1, 56, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Horizontal aspect ratio before crop (0 = unchanged)"));
+	Params.push_back(ShaderParam("ASPECT_V", -1, 60, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Vertical aspect ratio before crop (0 = unchanged)"));
+	Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_H", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling horizontally"));
+	Params.push_back(ShaderParam("FORCE_INTEGER_SCALING_V", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force integer scaling vertically"));
+	Params.push_back(ShaderParam("OVERSCALE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Overscale (0 = full image, 1 = full screen)"));
+	Params.push_back(ShaderParam("OS_CROP_TOP", -1, 76, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop top"));
+	Params.push_back(ShaderParam("OS_CROP_BOTTOM", -1, 80, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop bottom"));
+	Params.push_back(ShaderParam("OS_CROP_LEFT", -1, 84, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop left"));
+	Params.push_back(ShaderParam("OS_CROP_RIGHT", -1, 88, 4, 0.000000f, 1024.000000f, 0.000000f, 1.000000f, "Overscan crop right"));
+	Params.push_back(ShaderParam("SHIFT_H", -1, 92, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Horizontal shift"));
+	Params.push_back(ShaderParam("SHIFT_V", -1, 96, 4, -2048.000000f, 2048.000000f, 0.000000f, 1.000000f, "Vertical shift"));
+	Params.push_back(ShaderParam("CENTER_AFTER_CROPPING", -1, 100, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Center cropped area"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
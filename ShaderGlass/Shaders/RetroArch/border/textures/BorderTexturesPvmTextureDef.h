@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderTexturesPvmTextureDef : public TextureDef
+{
+public:
+	BorderTexturesPvmTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderTexturesPvmTextureDefs
 {
 const BYTE sData[] =
@@ -10676,13 +10684,10 @@ const BYTE sData[] =
 ,203,108,254,1,10,204,5,219,58,235,167,115,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderTexturesPvmTextureDef : public TextureDef
+BorderTexturesPvmTextureDef::BorderTexturesPvmTextureDef() : TextureDef{}
 {
-public:
-	BorderTexturesPvmTextureDef() : TextureDef{}
-	{
-		Name = "pvm.png";
-		Data = BorderTexturesPvmTextureDefs::sData;
-		DataLength = sizeof(BorderTexturesPvmTextureDefs::sData);
-	}
-};
+	Name = "pvm.png";
+	Data = BorderTexturesPvmTextureDefs::sData;
+	DataLength = sizeof(BorderTexturesPvmTextureDefs::sData);
+}
+#endif
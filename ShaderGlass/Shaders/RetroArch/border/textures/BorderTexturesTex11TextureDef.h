@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class BorderTexturesTex11TextureDef : public TextureDef
+{
+public:
+	BorderTexturesTex11TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace BorderTexturesTex11TextureDefs
 {
 const BYTE sData[] =
@@ -142,13 +150,10 @@ const BYTE sData[] =
 ,199,79,24,1,42,231,127,9,208,191,125,186,237,100,81,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class BorderTexturesTex11TextureDef : public TextureDef
+BorderTexturesTex11TextureDef::BorderTexturesTex11TextureDef() : TextureDef{}
 {
-public:
-	BorderTexturesTex11TextureDef() : TextureDef{}
-	{
-		Name = "tex11.png";
-		Data = BorderTexturesTex11TextureDefs::sData;
-		DataLength = sizeof(BorderTexturesTex11TextureDefs::sData);
-	}
-};
+	Name = "tex11.png";
+	Data = BorderTexturesTex11TextureDefs::sData;
+	DataLength = sizeof(BorderTexturesTex11TextureDefs::sData);
+}
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CelShadersAdvcartoonShaderDef : public ShaderDef
+{
+public:
+	CelShadersAdvcartoonShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCelShadersAdvcartoonShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1009,33 +1020,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CelShadersAdvcartoonShaderDef : public ShaderDef
+RetroArch::CelShadersAdvcartoonShaderDef::CelShadersAdvcartoonShaderDef() : ShaderDef{}
 {
-public:
-	CelShadersAdvcartoonShaderDef() : ShaderDef{}
-	{
-		Name = "advcartoon";
-		VertexByteCode = RetroArchCelShadersAdvcartoonShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCelShadersAdvcartoonShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCelShadersAdvcartoonShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCelShadersAdvcartoonShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("border", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 0.500000f, "Toon Border Thickness"));
-		Params.push_back(ShaderParam("mute_colors", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toon Mute Colors"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "advcartoon";
+	VertexByteCode = RetroArchCelShadersAdvcartoonShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCelShadersAdvcartoonShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCelShadersAdvcartoonShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCelShadersAdvcartoonShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("border", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 0.500000f, "Toon Border Thickness"));
+	Params.push_back(ShaderParam("mute_colors", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toon Mute Colors"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
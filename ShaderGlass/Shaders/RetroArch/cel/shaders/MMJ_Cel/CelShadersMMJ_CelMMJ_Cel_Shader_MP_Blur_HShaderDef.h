@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef : public ShaderDef
+{
+public:
+	CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -423,29 +434,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef : public ShaderDef
+RetroArch::CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef::CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef() : ShaderDef{}
 {
-public:
-	CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef() : ShaderDef{}
-	{
-		Name = "MMJ_Cel_Shader_MP_Blur_H";
-		VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BlurWeightH", -1, 16, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Blur Weight - Horizontal"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "MMJ_Cel_Shader_MP_Blur_H";
+	VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BlurWeightH", -1, 16, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Blur Weight - Horizontal"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
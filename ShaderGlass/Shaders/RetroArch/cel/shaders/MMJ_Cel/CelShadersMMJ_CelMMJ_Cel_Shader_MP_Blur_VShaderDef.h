@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef : public ShaderDef
+{
+public:
+	CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -437,30 +448,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef : public ShaderDef
+RetroArch::CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef::CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef() : ShaderDef{}
 {
-public:
-	CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef() : ShaderDef{}
-	{
-		Name = "MMJ_Cel_Shader_MP_Blur_V";
-		VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MMJ_BlurPass_HSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BlurWeightV", -1, 32, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Blur Weight - Vertical"));
-		Samplers.push_back(ShaderSampler("MMJ_BlurPass_H", 2));
+	Name = "MMJ_Cel_Shader_MP_Blur_V";
+	VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MMJ_BlurPass_HSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BlurWeightV", -1, 32, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Blur Weight - Vertical"));
+	Samplers.push_back(ShaderSampler("MMJ_BlurPass_H", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
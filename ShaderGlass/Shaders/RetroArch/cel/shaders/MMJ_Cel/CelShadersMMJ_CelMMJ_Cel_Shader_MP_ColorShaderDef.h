@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef : public ShaderDef
+{
+public:
+	CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -932,33 +943,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef : public ShaderDef
+RetroArch::CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef::CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef() : ShaderDef{}
 {
-public:
-	CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef() : ShaderDef{}
-	{
-		Name = "MMJ_Cel_Shader_MP_Color";
-		VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MMJ_OutlineSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ColorLevels", -1, 32, 4, 1.000000f, 32.000000f, 12.000000f, 1.000000f, "Color Levels"));
-		Params.push_back(ShaderParam("ColorSaturation", -1, 36, 4, 0.000000f, 2.000000f, 1.150000f, 0.050000f, "Color Saturation"));
-		Params.push_back(ShaderParam("ColorWeight", -1, 40, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Color Weight"));
-		Samplers.push_back(ShaderSampler("MMJ_MP_refpass", 2));
-		Samplers.push_back(ShaderSampler("MMJ_OutlinePass", 3));
+	Name = "MMJ_Cel_Shader_MP_Color";
+	VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MMJ_OutlineSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ColorLevels", -1, 32, 4, 1.000000f, 32.000000f, 12.000000f, 1.000000f, "Color Levels"));
+	Params.push_back(ShaderParam("ColorSaturation", -1, 36, 4, 0.000000f, 2.000000f, 1.150000f, 0.050000f, "Color Saturation"));
+	Params.push_back(ShaderParam("ColorWeight", -1, 40, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Color Weight"));
+	Samplers.push_back(ShaderSampler("MMJ_MP_refpass", 2));
+	Samplers.push_back(ShaderSampler("MMJ_OutlinePass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
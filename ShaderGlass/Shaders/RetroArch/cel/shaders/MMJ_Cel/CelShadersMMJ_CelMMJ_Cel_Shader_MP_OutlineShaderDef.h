@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef : public ShaderDef
+{
+public:
+	CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1267,29 +1278,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef : public ShaderDef
+RetroArch::CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef::CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef() : ShaderDef{}
 {
-public:
-	CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef() : ShaderDef{}
-	{
-		Name = "MMJ_Cel_Shader_MP_Outline";
-		VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MMJ_BlurPass_VSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutlineWeight", -1, 16, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Outline Weight"));
-		Samplers.push_back(ShaderSampler("MMJ_BlurPass_V", 2));
+	Name = "MMJ_Cel_Shader_MP_Outline";
+	VertexByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MMJ_BlurPass_VSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutlineWeight", -1, 16, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Outline Weight"));
+	Samplers.push_back(ShaderSampler("MMJ_BlurPass_V", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtApertureShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtApertureShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtApertureShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1522,46 +1533,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtApertureShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtApertureShaderDef::CrtShadersCrtApertureShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtApertureShaderDef() : ShaderDef{}
-	{
-		Name = "crt-aperture";
-		VertexByteCode = RetroArchCrtShadersCrtApertureShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtApertureShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtApertureShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtApertureShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SHARPNESS_IMAGE", -1, 36, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Sharpness Image"));
-		Params.push_back(ShaderParam("SHARPNESS_EDGES", -1, 40, 4, 1.000000f, 5.000000f, 3.000000f, 1.000000f, "Sharpness Edges"));
-		Params.push_back(ShaderParam("GLOW_WIDTH", -1, 44, 4, 0.050000f, 0.650000f, 0.500000f, 0.050000f, "Glow Width"));
-		Params.push_back(ShaderParam("GLOW_HEIGHT", -1, 48, 4, 0.050000f, 0.650000f, 0.500000f, 0.050000f, "Glow Height"));
-		Params.push_back(ShaderParam("GLOW_HALATION", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Glow Halation"));
-		Params.push_back(ShaderParam("GLOW_DIFFUSION", -1, 56, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Glow Diffusion"));
-		Params.push_back(ShaderParam("MASK_COLORS", -1, 60, 4, 2.000000f, 3.000000f, 2.000000f, 1.000000f, "Mask Colors"));
-		Params.push_back(ShaderParam("MASK_STRENGTH", -1, 64, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Strength"));
-		Params.push_back(ShaderParam("MASK_SIZE", -1, 68, 4, 1.000000f, 9.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("SCANLINE_SIZE_MIN", -1, 72, 4, 0.500000f, 1.500000f, 0.500000f, 0.050000f, "Scanline Size Min."));
-		Params.push_back(ShaderParam("SCANLINE_SIZE_MAX", -1, 76, 4, 0.500000f, 1.500000f, 1.500000f, 0.050000f, "Scanline Size Max."));
-		Params.push_back(ShaderParam("SCANLINE_SHAPE", -1, 80, 4, 1.000000f, 100.000000f, 2.500000f, 0.100000f, "Scanline Shape"));
-		Params.push_back(ShaderParam("SCANLINE_OFFSET", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Offset"));
-		Params.push_back(ShaderParam("GAMMA_INPUT", -1, 88, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "Gamma Input"));
-		Params.push_back(ShaderParam("GAMMA_OUTPUT", -1, 92, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "Gamma Output"));
-		Params.push_back(ShaderParam("BRIGHTNESS", -1, 96, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Brightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-aperture";
+	VertexByteCode = RetroArchCrtShadersCrtApertureShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtApertureShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtApertureShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtApertureShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SHARPNESS_IMAGE", -1, 36, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Sharpness Image"));
+	Params.push_back(ShaderParam("SHARPNESS_EDGES", -1, 40, 4, 1.000000f, 5.000000f, 3.000000f, 1.000000f, "Sharpness Edges"));
+	Params.push_back(ShaderParam("GLOW_WIDTH", -1, 44, 4, 0.050000f, 0.650000f, 0.500000f, 0.050000f, "Glow Width"));
+	Params.push_back(ShaderParam("GLOW_HEIGHT", -1, 48, 4, 0.050000f, 0.650000f, 0.500000f, 0.050000f, "Glow Height"));
+	Params.push_back(ShaderParam("GLOW_HALATION", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Glow Halation"));
+	Params.push_back(ShaderParam("GLOW_DIFFUSION", -1, 56, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Glow Diffusion"));
+	Params.push_back(ShaderParam("MASK_COLORS", -1, 60, 4, 2.000000f, 3.000000f, 2.000000f, 1.000000f, "Mask Colors"));
+	Params.push_back(ShaderParam("MASK_STRENGTH", -1, 64, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Strength"));
+	Params.push_back(ShaderParam("MASK_SIZE", -1, 68, 4, 1.000000f, 9.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("SCANLINE_SIZE_MIN", -1, 72, 4, 0.500000f, 1.500000f, 0.500000f, 0.050000f, "Scanline Size Min."));
+	Params.push_back(ShaderParam("SCANLINE_SIZE_MAX", -1, 76, 4, 0.500000f, 1.500000f, 1.500000f, 0.050000f, "Scanline Size Max."));
+	Params.push_back(ShaderParam("SCANLINE_SHAPE", -1, 80, 4, 1.000000f, 100.000000f, 2.500000f, 0.100000f, "Scanline Shape"));
+	Params.push_back(ShaderParam("SCANLINE_OFFSET", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Offset"));
+	Params.push_back(ShaderParam("GAMMA_INPUT", -1, 88, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "Gamma Input"));
+	Params.push_back(ShaderParam("GAMMA_OUTPUT", -1, 92, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "Gamma Output"));
+	Params.push_back(ShaderParam("BRIGHTNESS", -1, 96, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Brightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtCgwgFastShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtCgwgFastShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtCgwgFastShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -944,32 +955,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtCgwgFastShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtCgwgFastShaderDef::CrtShadersCrtCgwgFastShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtCgwgFastShaderDef() : ShaderDef{}
-	{
-		Name = "crt-cgwg-fast";
-		VertexByteCode = RetroArchCrtShadersCrtCgwgFastShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtCgwgFastShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtCgwgFastShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtCgwgFastShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CRTCGWG_GAMMA", -1, 0, 4, 0.000000f, 10.000000f, 2.700000f, 0.010000f, "CRTcgwg Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-cgwg-fast";
+	VertexByteCode = RetroArchCrtShadersCrtCgwgFastShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtCgwgFastShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtCgwgFastShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtCgwgFastShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CRTCGWG_GAMMA", -1, 0, 4, 0.000000f, 10.000000f, 2.700000f, 0.010000f, "CRTcgwg Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtConsumerShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtConsumerShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtConsumerShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3029,74 +3040,68 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtConsumerShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtConsumerShaderDef::CrtShadersCrtConsumerShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtConsumerShaderDef() : ShaderDef{}
-	{
-		Name = "crt-consumer";
-		VertexByteCode = RetroArchCrtShadersCrtConsumerShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtConsumerShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtConsumerShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtConsumerShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blurx", 0, 64, 4, -4.000000f, 4.000000f, 0.250000f, 0.050000f, "Convergence X"));
-		Params.push_back(ShaderParam("blury", 0, 68, 4, -4.000000f, 4.000000f, -0.100000f, 0.050000f, "Convergence Y"));
-		Params.push_back(ShaderParam("warpx", 0, 72, 4, 0.000000f, 0.120000f, 0.030000f, 0.010000f, "Curvature X"));
-		Params.push_back(ShaderParam("warpy", 0, 76, 4, 0.000000f, 0.120000f, 0.040000f, 0.010000f, "Curvature Y"));
-		Params.push_back(ShaderParam("corner", 0, 80, 4, 0.000000f, 0.100000f, 0.030000f, 0.010000f, "Corner size"));
-		Params.push_back(ShaderParam("smoothness", 0, 84, 4, 100.000000f, 600.000000f, 400.000000f, 5.000000f, "Border Smoothness"));
-		Params.push_back(ShaderParam("scanlow", 0, 88, 4, 1.000000f, 15.000000f, 6.000000f, 1.000000f, "Beam low"));
-		Params.push_back(ShaderParam("scanhigh", 0, 92, 4, 1.000000f, 15.000000f, 8.000000f, 1.000000f, "Beam high"));
-		Params.push_back(ShaderParam("beamlow", 0, 96, 4, 0.500000f, 2.500000f, 1.450000f, 0.050000f, "Scanlines dark"));
-		Params.push_back(ShaderParam("beamhigh", 0, 100, 4, 0.500000f, 2.500000f, 1.050000f, 0.050000f, "Scanlines bright"));
-		Params.push_back(ShaderParam("brightboost1", 0, 104, 4, 0.000000f, 3.000000f, 1.250000f, 0.050000f, "Bright boost dark pixels"));
-		Params.push_back(ShaderParam("brightboost2", 0, 108, 4, 0.000000f, 3.000000f, 1.000000f, 0.050000f, "Bright boost bright pixels"));
-		Params.push_back(ShaderParam("Shadowmask", 0, 112, 4, -1.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask Type"));
-		Params.push_back(ShaderParam("masksize", 0, 116, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("MaskDark", 0, 120, 4, 0.000000f, 2.000000f, 0.200000f, 0.100000f, "Mask dark"));
-		Params.push_back(ShaderParam("MaskLight", 0, 124, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Mask light"));
-		Params.push_back(ShaderParam("slotmask", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength"));
-		Params.push_back(ShaderParam("slotwidth", 0, 132, 4, 1.000000f, 6.000000f, 2.000000f, 0.500000f, "Slot Mask Width"));
-		Params.push_back(ShaderParam("double_slot", 0, 136, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Slot Mask Height: 2x1 or 4x1"));
-		Params.push_back(ShaderParam("slotms", 0, 140, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Slot Mask Size"));
-		Params.push_back(ShaderParam("GAMMA_OUT", 0, 144, 4, 0.000000f, 4.000000f, 2.250000f, 0.050000f, "Gamma Out"));
-		Params.push_back(ShaderParam("glow", 0, 148, 4, 1.000000f, 6.000000f, 3.000000f, 1.000000f, "Glow pixels per axis"));
-		Params.push_back(ShaderParam("glow_str", 0, 152, 4, 0.000100f, 2.000000f, 0.300000f, 0.050000f, "Glow intensity"));
-		Params.push_back(ShaderParam("sat", 0, 156, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("contrast", 0, 160, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Contrast, 1.0:Off"));
-		Params.push_back(ShaderParam("nois", 0, 164, 4, 0.000000f, 32.000000f, 0.000000f, 1.000000f, "Add Noise"));
-		Params.push_back(ShaderParam("WP", 0, 168, 4, -100.000000f, 100.000000f, 0.000000f, 5.000000f, "Color Temperature %"));
-		Params.push_back(ShaderParam("inter", 0, 172, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing Toggle"));
-		Params.push_back(ShaderParam("vignette", 0, 176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vignette On/Off"));
-		Params.push_back(ShaderParam("vpower", 0, 180, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Vignette Power"));
-		Params.push_back(ShaderParam("vstr", 0, 184, 4, 0.000000f, 50.000000f, 40.000000f, 1.000000f, "Vignette strength"));
-		Params.push_back(ShaderParam("alloff", 0, 188, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Switch off shader"));
-		Params.push_back(ShaderParam("postbr", 0, 192, 4, 0.000000f, 2.500000f, 1.000000f, 0.020000f, "Post Brightness"));
-		Params.push_back(ShaderParam("PRE_SCALE", 0, 196, 4, 1.000000f, 4.000000f, 1.500000f, 0.100000f, "Pre-Scale Sharpening"));
-		Params.push_back(ShaderParam("preserve", 0, 200, 4, 0.000000f, 1.000000f, 0.980000f, 0.010000f, "Protect White On Masks"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("rg", -1, 36, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Green Tint"));
-		Params.push_back(ShaderParam("rb", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Blue Tint"));
-		Params.push_back(ShaderParam("gr", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Red Tint"));
-		Params.push_back(ShaderParam("gb", -1, 48, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Blue Tint"));
-		Params.push_back(ShaderParam("br", -1, 52, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Red Tint"));
-		Params.push_back(ShaderParam("bg", -1, 56, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Green Tint"));
-		Params.push_back(ShaderParam("Downscale", -1, 60, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "Interlacing Downscale Scanlines"));
-		Params.push_back(ShaderParam("quality", -1, 64, 4, 0.250000f, 4.000000f, 1.000000f, 0.050000f, "Glow quality"));
-		Params.push_back(ShaderParam("palette_fix", -1, 68, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Palette Fixes. Sega, PUAE Atari ST dark colors"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-consumer";
+	VertexByteCode = RetroArchCrtShadersCrtConsumerShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtConsumerShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtConsumerShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtConsumerShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blurx", 0, 64, 4, -4.000000f, 4.000000f, 0.250000f, 0.050000f, "Convergence X"));
+	Params.push_back(ShaderParam("blury", 0, 68, 4, -4.000000f, 4.000000f, -0.100000f, 0.050000f, "Convergence Y"));
+	Params.push_back(ShaderParam("warpx", 0, 72, 4, 0.000000f, 0.120000f, 0.030000f, 0.010000f, "Curvature X"));
+	Params.push_back(ShaderParam("warpy", 0, 76, 4, 0.000000f, 0.120000f, 0.040000f, 0.010000f, "Curvature Y"));
+	Params.push_back(ShaderParam("corner", 0, 80, 4, 0.000000f, 0.100000f, 0.030000f, 0.010000f, "Corner size"));
+	Params.push_back(ShaderParam("smoothness", 0, 84, 4, 100.000000f, 600.000000f, 400.000000f, 5.000000f, "Border Smoothness"));
+	Params.push_back(ShaderParam("scanlow", 0, 88, 4, 1.000000f, 15.000000f, 6.000000f, 1.000000f, "Beam low"));
+	Params.push_back(ShaderParam("scanhigh", 0, 92, 4, 1.000000f, 15.000000f, 8.000000f, 1.000000f, "Beam high"));
+	Params.push_back(ShaderParam("beamlow", 0, 96, 4, 0.500000f, 2.500000f, 1.450000f, 0.050000f, "Scanlines dark"));
+	Params.push_back(ShaderParam("beamhigh", 0, 100, 4, 0.500000f, 2.500000f, 1.050000f, 0.050000f, "Scanlines bright"));
+	Params.push_back(ShaderParam("brightboost1", 0, 104, 4, 0.000000f, 3.000000f, 1.250000f, 0.050000f, "Bright boost dark pixels"));
+	Params.push_back(ShaderParam("brightboost2", 0, 108, 4, 0.000000f, 3.000000f, 1.000000f, 0.050000f, "Bright boost bright pixels"));
+	Params.push_back(ShaderParam("Shadowmask", 0, 112, 4, -1.000000f, 8.000000f, 0.000000f, 1.000000f, "Mask Type"));
+	Params.push_back(ShaderParam("masksize", 0, 116, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("MaskDark", 0, 120, 4, 0.000000f, 2.000000f, 0.200000f, 0.100000f, "Mask dark"));
+	Params.push_back(ShaderParam("MaskLight", 0, 124, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Mask light"));
+	Params.push_back(ShaderParam("slotmask", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength"));
+	Params.push_back(ShaderParam("slotwidth", 0, 132, 4, 1.000000f, 6.000000f, 2.000000f, 0.500000f, "Slot Mask Width"));
+	Params.push_back(ShaderParam("double_slot", 0, 136, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Slot Mask Height: 2x1 or 4x1"));
+	Params.push_back(ShaderParam("slotms", 0, 140, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Slot Mask Size"));
+	Params.push_back(ShaderParam("GAMMA_OUT", 0, 144, 4, 0.000000f, 4.000000f, 2.250000f, 0.050000f, "Gamma Out"));
+	Params.push_back(ShaderParam("glow", 0, 148, 4, 1.000000f, 6.000000f, 3.000000f, 1.000000f, "Glow pixels per axis"));
+	Params.push_back(ShaderParam("glow_str", 0, 152, 4, 0.000100f, 2.000000f, 0.300000f, 0.050000f, "Glow intensity"));
+	Params.push_back(ShaderParam("sat", 0, 156, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("contrast", 0, 160, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Contrast, 1.0:Off"));
+	Params.push_back(ShaderParam("nois", 0, 164, 4, 0.000000f, 32.000000f, 0.000000f, 1.000000f, "Add Noise"));
+	Params.push_back(ShaderParam("WP", 0, 168, 4, -100.000000f, 100.000000f, 0.000000f, 5.000000f, "Color Temperature %"));
+	Params.push_back(ShaderParam("inter", 0, 172, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing Toggle"));
+	Params.push_back(ShaderParam("vignette", 0, 176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vignette On/Off"));
+	Params.push_back(ShaderParam("vpower", 0, 180, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Vignette Power"));
+	Params.push_back(ShaderParam("vstr", 0, 184, 4, 0.000000f, 50.000000f, 40.000000f, 1.000000f, "Vignette strength"));
+	Params.push_back(ShaderParam("alloff", 0, 188, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Switch off shader"));
+	Params.push_back(ShaderParam("postbr", 0, 192, 4, 0.000000f, 2.500000f, 1.000000f, 0.020000f, "Post Brightness"));
+	Params.push_back(ShaderParam("PRE_SCALE", 0, 196, 4, 1.000000f, 4.000000f, 1.500000f, 0.100000f, "Pre-Scale Sharpening"));
+	Params.push_back(ShaderParam("preserve", 0, 200, 4, 0.000000f, 1.000000f, 0.980000f, 0.010000f, "Protect White On Masks"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("rg", -1, 36, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Green Tint"));
+	Params.push_back(ShaderParam("rb", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Blue Tint"));
+	Params.push_back(ShaderParam("gr", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Red Tint"));
+	Params.push_back(ShaderParam("gb", -1, 48, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Blue Tint"));
+	Params.push_back(ShaderParam("br", -1, 52, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Red Tint"));
+	Params.push_back(ShaderParam("bg", -1, 56, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Green Tint"));
+	Params.push_back(ShaderParam("Downscale", -1, 60, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "Interlacing Downscale Scanlines"));
+	Params.push_back(ShaderParam("quality", -1, 64, 4, 0.250000f, 4.000000f, 1.000000f, 0.050000f, "Glow quality"));
+	Params.push_back(ShaderParam("palette_fix", -1, 68, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Palette Fixes. Sega, PUAE Atari ST dark colors"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -39,6 +39,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtCyclonShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtCyclonShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtCyclonShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1912,64 +1923,58 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtCyclonShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtCyclonShaderDef::CrtShadersCrtCyclonShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtCyclonShaderDef() : ShaderDef{}
-	{
-		Name = "crt-Cyclon";
-		VertexByteCode = RetroArchCrtShadersCrtCyclonShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtCyclonShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtCyclonShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtCyclonShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BLACK", 0, 64, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "Black Level"));
-		Params.push_back(ShaderParam("RG", 0, 68, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Green <-to-> Red Hue"));
-		Params.push_back(ShaderParam("RB", 0, 72, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Red Hue"));
-		Params.push_back(ShaderParam("GB", 0, 76, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Green Hue"));
-		Params.push_back(ShaderParam("POTATO", 0, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Potato Boost(Simple Gamma, adjust Mask)"));
-		Params.push_back(ShaderParam("SATURATION", 0, 84, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("BRIGHTNESS_", 0, 88, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness, Sega fix:1.06"));
-		Params.push_back(ShaderParam("bzl", 0, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Bezel On/Off"));
-		Params.push_back(ShaderParam("zoomx", 0, 96, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Zoom Image X"));
-		Params.push_back(ShaderParam("zoomy", 0, 100, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Zoom Image Y"));
-		Params.push_back(ShaderParam("centerx", 0, 104, 4, -5.000000f, 5.000000f, 0.000000f, 0.050000f, "Image Center X"));
-		Params.push_back(ShaderParam("centery", 0, 108, 4, -5.000000f, 5.000000f, 0.000000f, 0.050000f, "Image Center Y"));
-		Params.push_back(ShaderParam("vig", 0, 112, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette On/Off"));
-		Params.push_back(ShaderParam("ambient", 0, 116, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Ambient Light"));
-		Params.push_back(ShaderParam("SourceSize", 0, 128, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 144, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 160, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE", -1, 0, 4, 0.200000f, 0.600000f, 0.300000f, 0.050000f, "Scanline Weight"));
-		Params.push_back(ShaderParam("INTERLACE", -1, 4, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing On/Off"));
-		Params.push_back(ShaderParam("M_TYPE", -1, 8, 4, -1.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Type: -1:None, 0:CGWG, 1:RGB"));
-		Params.push_back(ShaderParam("MSIZE", -1, 12, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("SLOT", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Slot Mask On/Off"));
-		Params.push_back(ShaderParam("SLOTW", -1, 20, 4, 2.000000f, 3.000000f, 3.000000f, 1.000000f, "Slot Mask Width"));
-		Params.push_back(ShaderParam("BGR", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Subpixels BGR/RGB"));
-		Params.push_back(ShaderParam("Maskl", -1, 28, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Brightness Dark"));
-		Params.push_back(ShaderParam("Maskh", -1, 32, 4, 0.000000f, 1.000000f, 0.750000f, 0.050000f, "Mask Brightness Bright"));
-		Params.push_back(ShaderParam("C_STR", -1, 36, 4, 0.000000f, 0.500000f, 0.000000f, 0.050000f, "Convergence Overall Strength"));
-		Params.push_back(ShaderParam("CONV_R", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Convergence Red X-Axis"));
-		Params.push_back(ShaderParam("CONV_G", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Convergence Green X-axis"));
-		Params.push_back(ShaderParam("CONV_B", -1, 48, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Convergence Blue X-Axis"));
-		Params.push_back(ShaderParam("WARPX", -1, 52, 4, 0.000000f, 0.250000f, 0.020000f, 0.010000f, "Curvature Horizontal"));
-		Params.push_back(ShaderParam("WARPY", -1, 56, 4, 0.000000f, 0.250000f, 0.010000f, 0.010000f, "Curvature Vertical"));
-		Params.push_back(ShaderParam("BR_DEP", -1, 60, 4, 0.000000f, 0.333000f, 0.200000f, 0.010000f, "Scan/Mask Brightness Dependence"));
-		Params.push_back(ShaderParam("c_space", -1, 64, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Color Space: sRGB,PAL,NTSC-U,NTSC-J"));
-		Params.push_back(ShaderParam("EXT_GAMMA", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "External Gamma In (Glow etc)"));
-		Samplers.push_back(ShaderSampler("bezel", 2));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-Cyclon";
+	VertexByteCode = RetroArchCrtShadersCrtCyclonShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtCyclonShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtCyclonShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtCyclonShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BLACK", 0, 64, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "Black Level"));
+	Params.push_back(ShaderParam("RG", 0, 68, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Green <-to-> Red Hue"));
+	Params.push_back(ShaderParam("RB", 0, 72, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Red Hue"));
+	Params.push_back(ShaderParam("GB", 0, 76, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Green Hue"));
+	Params.push_back(ShaderParam("POTATO", 0, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Potato Boost(Simple Gamma, adjust Mask)"));
+	Params.push_back(ShaderParam("SATURATION", 0, 84, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("BRIGHTNESS_", 0, 88, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness, Sega fix:1.06"));
+	Params.push_back(ShaderParam("bzl", 0, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Bezel On/Off"));
+	Params.push_back(ShaderParam("zoomx", 0, 96, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Zoom Image X"));
+	Params.push_back(ShaderParam("zoomy", 0, 100, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Zoom Image Y"));
+	Params.push_back(ShaderParam("centerx", 0, 104, 4, -5.000000f, 5.000000f, 0.000000f, 0.050000f, "Image Center X"));
+	Params.push_back(ShaderParam("centery", 0, 108, 4, -5.000000f, 5.000000f, 0.000000f, 0.050000f, "Image Center Y"));
+	Params.push_back(ShaderParam("vig", 0, 112, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette On/Off"));
+	Params.push_back(ShaderParam("ambient", 0, 116, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Ambient Light"));
+	Params.push_back(ShaderParam("SourceSize", 0, 128, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 144, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 160, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE", -1, 0, 4, 0.200000f, 0.600000f, 0.300000f, 0.050000f, "Scanline Weight"));
+	Params.push_back(ShaderParam("INTERLACE", -1, 4, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing On/Off"));
+	Params.push_back(ShaderParam("M_TYPE", -1, 8, 4, -1.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Type: -1:None, 0:CGWG, 1:RGB"));
+	Params.push_back(ShaderParam("MSIZE", -1, 12, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("SLOT", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Slot Mask On/Off"));
+	Params.push_back(ShaderParam("SLOTW", -1, 20, 4, 2.000000f, 3.000000f, 3.000000f, 1.000000f, "Slot Mask Width"));
+	Params.push_back(ShaderParam("BGR", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Subpixels BGR/RGB"));
+	Params.push_back(ShaderParam("Maskl", -1, 28, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Brightness Dark"));
+	Params.push_back(ShaderParam("Maskh", -1, 32, 4, 0.000000f, 1.000000f, 0.750000f, 0.050000f, "Mask Brightness Bright"));
+	Params.push_back(ShaderParam("C_STR", -1, 36, 4, 0.000000f, 0.500000f, 0.000000f, 0.050000f, "Convergence Overall Strength"));
+	Params.push_back(ShaderParam("CONV_R", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Convergence Red X-Axis"));
+	Params.push_back(ShaderParam("CONV_G", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Convergence Green X-axis"));
+	Params.push_back(ShaderParam("CONV_B", -1, 48, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Convergence Blue X-Axis"));
+	Params.push_back(ShaderParam("WARPX", -1, 52, 4, 0.000000f, 0.250000f, 0.020000f, 0.010000f, "Curvature Horizontal"));
+	Params.push_back(ShaderParam("WARPY", -1, 56, 4, 0.000000f, 0.250000f, 0.010000f, 0.010000f, "Curvature Vertical"));
+	Params.push_back(ShaderParam("BR_DEP", -1, 60, 4, 0.000000f, 0.333000f, 0.200000f, 0.010000f, "Scan/Mask Brightness Dependence"));
+	Params.push_back(ShaderParam("c_space", -1, 64, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Color Space: sRGB,PAL,NTSC-U,NTSC-J"));
+	Params.push_back(ShaderParam("EXT_GAMMA", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "External Gamma In (Glow etc)"));
+	Samplers.push_back(ShaderSampler("bezel", 2));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtEasymodeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtEasymodeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtEasymodeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1419,47 +1430,41 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtEasymodeShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtEasymodeShaderDef::CrtShadersCrtEasymodeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtEasymodeShaderDef() : ShaderDef{}
-	{
-		Name = "crt-easymode";
-		VertexByteCode = RetroArchCrtShadersCrtEasymodeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtEasymodeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BRIGHT_BOOST", -1, 0, 4, 1.000000f, 2.000000f, 1.200000f, 0.010000f, "Brightness Boost"));
-		Params.push_back(ShaderParam("DILATION", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Dilation"));
-		Params.push_back(ShaderParam("GAMMA_INPUT", -1, 8, 4, 0.100000f, 5.000000f, 2.000000f, 0.100000f, "Gamma Input"));
-		Params.push_back(ShaderParam("GAMMA_OUTPUT", -1, 12, 4, 0.100000f, 5.000000f, 1.800000f, 0.100000f, "Gamma Output"));
-		Params.push_back(ShaderParam("MASK_SIZE", -1, 16, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("MASK_STAGGER", -1, 20, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Mask Stagger"));
-		Params.push_back(ShaderParam("MASK_STRENGTH", -1, 24, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Mask Strength"));
-		Params.push_back(ShaderParam("MASK_DOT_HEIGHT", -1, 28, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Dot Height"));
-		Params.push_back(ShaderParam("MASK_DOT_WIDTH", -1, 32, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Dot Width"));
-		Params.push_back(ShaderParam("SCANLINE_CUTOFF", -1, 36, 4, 1.000000f, 1000.000000f, 400.000000f, 1.000000f, "Scanline Cutoff"));
-		Params.push_back(ShaderParam("SCANLINE_BEAM_WIDTH_MAX", -1, 40, 4, 0.500000f, 5.000000f, 1.500000f, 0.500000f, "Scanline Beam Width Max."));
-		Params.push_back(ShaderParam("SCANLINE_BEAM_WIDTH_MIN", -1, 44, 4, 0.500000f, 5.000000f, 1.500000f, 0.500000f, "Scanline Beam Width Min."));
-		Params.push_back(ShaderParam("SCANLINE_BRIGHT_MAX", -1, 48, 4, 0.000000f, 1.000000f, 0.650000f, 0.050000f, "Scanline Brightness Max."));
-		Params.push_back(ShaderParam("SCANLINE_BRIGHT_MIN", -1, 52, 4, 0.000000f, 1.000000f, 0.350000f, 0.050000f, "Scanline Brightness Min."));
-		Params.push_back(ShaderParam("SCANLINE_STRENGTH", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Scanline Strength"));
-		Params.push_back(ShaderParam("SHARPNESS_H", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Sharpness Horizontal"));
-		Params.push_back(ShaderParam("SHARPNESS_V", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Sharpness Vertical"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-easymode";
+	VertexByteCode = RetroArchCrtShadersCrtEasymodeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtEasymodeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BRIGHT_BOOST", -1, 0, 4, 1.000000f, 2.000000f, 1.200000f, 0.010000f, "Brightness Boost"));
+	Params.push_back(ShaderParam("DILATION", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Dilation"));
+	Params.push_back(ShaderParam("GAMMA_INPUT", -1, 8, 4, 0.100000f, 5.000000f, 2.000000f, 0.100000f, "Gamma Input"));
+	Params.push_back(ShaderParam("GAMMA_OUTPUT", -1, 12, 4, 0.100000f, 5.000000f, 1.800000f, 0.100000f, "Gamma Output"));
+	Params.push_back(ShaderParam("MASK_SIZE", -1, 16, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("MASK_STAGGER", -1, 20, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Mask Stagger"));
+	Params.push_back(ShaderParam("MASK_STRENGTH", -1, 24, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Mask Strength"));
+	Params.push_back(ShaderParam("MASK_DOT_HEIGHT", -1, 28, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Dot Height"));
+	Params.push_back(ShaderParam("MASK_DOT_WIDTH", -1, 32, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Dot Width"));
+	Params.push_back(ShaderParam("SCANLINE_CUTOFF", -1, 36, 4, 1.000000f, 1000.000000f, 400.000000f, 1.000000f, "Scanline Cutoff"));
+	Params.push_back(ShaderParam("SCANLINE_BEAM_WIDTH_MAX", -1, 40, 4, 0.500000f, 5.000000f, 1.500000f, 0.500000f, "Scanline Beam Width Max."));
+	Params.push_back(ShaderParam("SCANLINE_BEAM_WIDTH_MIN", -1, 44, 4, 0.500000f, 5.000000f, 1.500000f, 0.500000f, "Scanline Beam Width Min."));
+	Params.push_back(ShaderParam("SCANLINE_BRIGHT_MAX", -1, 48, 4, 0.000000f, 1.000000f, 0.650000f, 0.050000f, "Scanline Brightness Max."));
+	Params.push_back(ShaderParam("SCANLINE_BRIGHT_MIN", -1, 52, 4, 0.000000f, 1.000000f, 0.350000f, 0.050000f, "Scanline Brightness Min."));
+	Params.push_back(ShaderParam("SCANLINE_STRENGTH", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Scanline Strength"));
+	Params.push_back(ShaderParam("SHARPNESS_H", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Sharpness Horizontal"));
+	Params.push_back(ShaderParam("SHARPNESS_V", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Sharpness Vertical"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtFrutbunnShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtFrutbunnShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtFrutbunnShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -766,37 +777,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtFrutbunnShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtFrutbunnShaderDef::CrtShadersCrtFrutbunnShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtFrutbunnShaderDef() : ShaderDef{}
-	{
-		Name = "crt-frutbunn";
-		VertexByteCode = RetroArchCrtShadersCrtFrutbunnShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtFrutbunnShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtFrutbunnShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtFrutbunnShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVATURE", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature Toggle"));
-		Params.push_back(ShaderParam("SCANLINES", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanlines Toggle"));
-		Params.push_back(ShaderParam("CURVED_SCANLINES", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Curve Toggle"));
-		Params.push_back(ShaderParam("LIGHT", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignetting Toggle"));
-		Params.push_back(ShaderParam("light", -1, 68, 4, 0.000000f, 20.000000f, 9.000000f, 1.000000f, "Vignetting Strength"));
-		Params.push_back(ShaderParam("blur", -1, 72, 4, 0.000000f, 8.000000f, 1.000000f, 0.050000f, "Blur Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-frutbunn";
+	VertexByteCode = RetroArchCrtShadersCrtFrutbunnShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtFrutbunnShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtFrutbunnShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtFrutbunnShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVATURE", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature Toggle"));
+	Params.push_back(ShaderParam("SCANLINES", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanlines Toggle"));
+	Params.push_back(ShaderParam("CURVED_SCANLINES", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Curve Toggle"));
+	Params.push_back(ShaderParam("LIGHT", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignetting Toggle"));
+	Params.push_back(ShaderParam("light", -1, 68, 4, 0.000000f, 20.000000f, 9.000000f, 1.000000f, "Vignetting Strength"));
+	Params.push_back(ShaderParam("blur", -1, 72, 4, 0.000000f, 8.000000f, 1.000000f, 0.050000f, "Blur Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -24,6 +24,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtGdvMiniShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtGdvMiniShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtGdvMiniShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1840,49 +1851,43 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtGdvMiniShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtGdvMiniShaderDef::CrtShadersCrtGdvMiniShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtGdvMiniShaderDef() : ShaderDef{}
-	{
-		Name = "crt-gdv-mini";
-		VertexByteCode = RetroArchCrtShadersCrtGdvMiniShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtGdvMiniShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtGdvMiniShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtGdvMiniShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("brightboost", -1, 48, 4, 0.500000f, 2.000000f, 1.000000f, 0.050000f, "Bright boost"));
-		Params.push_back(ShaderParam("sat", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation adjustment"));
-		Params.push_back(ShaderParam("scanline", -1, 56, 4, 1.000000f, 12.000000f, 8.000000f, 1.000000f, "Scanline Adjust"));
-		Params.push_back(ShaderParam("beam_min", -1, 60, 4, 0.500000f, 3.000000f, 1.350000f, 0.050000f, "Scanline Dark"));
-		Params.push_back(ShaderParam("beam_max", -1, 64, 4, 0.500000f, 3.000000f, 1.050000f, 0.050000f, "Scanline Bright"));
-		Params.push_back(ShaderParam("h_sharp", -1, 68, 4, 1.000000f, 5.000000f, 2.000000f, 0.050000f, "Horizontal Sharpness"));
-		Params.push_back(ShaderParam("shadowMask", -1, 72, 4, -1.000000f, 10.000000f, 0.000000f, 1.000000f, "CRT Mask: 0:CGWG, 1-4:Lottes, 5-6:Trinitron"));
-		Params.push_back(ShaderParam("masksize", -1, 76, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "CRT Mask Size (2.0 is nice in 4k)"));
-		Params.push_back(ShaderParam("mcut", -1, 80, 4, 0.000000f, 0.500000f, 0.200000f, 0.050000f, "Mask 5-7-10 cutoff"));
-		Params.push_back(ShaderParam("maskDark", -1, 84, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "Lottes maskDark"));
-		Params.push_back(ShaderParam("maskLight", -1, 88, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Lottes maskLight"));
-		Params.push_back(ShaderParam("CGWG", -1, 92, 4, 0.000000f, 1.000000f, 0.300000f, 0.100000f, "CGWG Mask Str."));
-		Params.push_back(ShaderParam("csize", -1, 96, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpX", -1, 100, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureX (default 0.03)"));
-		Params.push_back(ShaderParam("warpY", -1, 104, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureY (default 0.04)"));
-		Params.push_back(ShaderParam("gamma_out", -1, 108, 4, 0.200000f, 0.600000f, 0.500000f, 0.010000f, "Gamma out"));
-		Params.push_back(ShaderParam("vignette", -1, 112, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vignette On/Off"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-gdv-mini";
+	VertexByteCode = RetroArchCrtShadersCrtGdvMiniShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtGdvMiniShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtGdvMiniShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtGdvMiniShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("brightboost", -1, 48, 4, 0.500000f, 2.000000f, 1.000000f, 0.050000f, "Bright boost"));
+	Params.push_back(ShaderParam("sat", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation adjustment"));
+	Params.push_back(ShaderParam("scanline", -1, 56, 4, 1.000000f, 12.000000f, 8.000000f, 1.000000f, "Scanline Adjust"));
+	Params.push_back(ShaderParam("beam_min", -1, 60, 4, 0.500000f, 3.000000f, 1.350000f, 0.050000f, "Scanline Dark"));
+	Params.push_back(ShaderParam("beam_max", -1, 64, 4, 0.500000f, 3.000000f, 1.050000f, 0.050000f, "Scanline Bright"));
+	Params.push_back(ShaderParam("h_sharp", -1, 68, 4, 1.000000f, 5.000000f, 2.000000f, 0.050000f, "Horizontal Sharpness"));
+	Params.push_back(ShaderParam("shadowMask", -1, 72, 4, -1.000000f, 10.000000f, 0.000000f, 1.000000f, "CRT Mask: 0:CGWG, 1-4:Lottes, 5-6:Trinitron"));
+	Params.push_back(ShaderParam("masksize", -1, 76, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "CRT Mask Size (2.0 is nice in 4k)"));
+	Params.push_back(ShaderParam("mcut", -1, 80, 4, 0.000000f, 0.500000f, 0.200000f, 0.050000f, "Mask 5-7-10 cutoff"));
+	Params.push_back(ShaderParam("maskDark", -1, 84, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "Lottes maskDark"));
+	Params.push_back(ShaderParam("maskLight", -1, 88, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Lottes maskLight"));
+	Params.push_back(ShaderParam("CGWG", -1, 92, 4, 0.000000f, 1.000000f, 0.300000f, 0.100000f, "CGWG Mask Str."));
+	Params.push_back(ShaderParam("csize", -1, 96, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpX", -1, 100, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureX (default 0.03)"));
+	Params.push_back(ShaderParam("warpY", -1, 104, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureY (default 0.04)"));
+	Params.push_back(ShaderParam("gamma_out", -1, 108, 4, 0.200000f, 0.600000f, 0.500000f, 0.010000f, "Gamma out"));
+	Params.push_back(ShaderParam("vignette", -1, 112, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vignette On/Off"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
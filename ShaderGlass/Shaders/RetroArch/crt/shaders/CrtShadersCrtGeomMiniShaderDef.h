@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtGeomMiniShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtGeomMiniShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtGeomMiniShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -974,36 +985,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtGeomMiniShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtGeomMiniShaderDef::CrtShadersCrtGeomMiniShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtGeomMiniShaderDef() : ShaderDef{}
-	{
-		Name = "crt-geom-mini";
-		VertexByteCode = RetroArchCrtShadersCrtGeomMiniShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtGeomMiniShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtGeomMiniShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtGeomMiniShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURV", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT-Geom Curvature"));
-		Params.push_back(ShaderParam("scanlines", -1, 56, 4, 0.000000f, 0.500000f, 0.500000f, 0.050000f, "CRT-Geom Scanline Weight"));
-		Params.push_back(ShaderParam("MASK", -1, 60, 4, 0.000000f, 0.500000f, 0.200000f, 0.050000f, "CRT-Geom Dotmask Strength"));
-		Params.push_back(ShaderParam("INTERL", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT-Geom Interlacing Simulation"));
-		Params.push_back(ShaderParam("SAT", -1, 68, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "CRT-Geom Saturation"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-geom-mini";
+	VertexByteCode = RetroArchCrtShadersCrtGeomMiniShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtGeomMiniShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtGeomMiniShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtGeomMiniShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURV", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT-Geom Curvature"));
+	Params.push_back(ShaderParam("scanlines", -1, 56, 4, 0.000000f, 0.500000f, 0.500000f, 0.050000f, "CRT-Geom Scanline Weight"));
+	Params.push_back(ShaderParam("MASK", -1, 60, 4, 0.000000f, 0.500000f, 0.200000f, 0.050000f, "CRT-Geom Dotmask Strength"));
+	Params.push_back(ShaderParam("INTERL", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT-Geom Interlacing Simulation"));
+	Params.push_back(ShaderParam("SAT", -1, 68, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "CRT-Geom Saturation"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -361,6 +361,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtLottesFastShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtLottesFastShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtLottesFastShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1848,39 +1859,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtLottesFastShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtLottesFastShaderDef::CrtShadersCrtLottesFastShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtLottesFastShaderDef() : ShaderDef{}
-	{
-		Name = "crt-lottes-fast";
-		VertexByteCode = RetroArchCrtShadersCrtLottesFastShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtLottesFastShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtLottesFastShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtLottesFastShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MASK", -1, 52, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Mask Type"));
-		Params.push_back(ShaderParam("MASK_INTENSITY", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Intensity"));
-		Params.push_back(ShaderParam("SCANLINE_THINNESS", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("SCAN_BLUR", -1, 64, 4, 1.000000f, 3.000000f, 2.500000f, 0.100000f, "Sharpness"));
-		Params.push_back(ShaderParam("CURVATURE", -1, 68, 4, 0.000000f, 0.250000f, 0.020000f, 0.010000f, "Curvature"));
-		Params.push_back(ShaderParam("TRINITRON_CURVE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Trinitron-style Curve"));
-		Params.push_back(ShaderParam("CORNER", -1, 76, 4, 0.000000f, 11.000000f, 3.000000f, 1.000000f, "Corner Round"));
-		Params.push_back(ShaderParam("CRT_GAMMA", -1, 80, 4, 0.000000f, 51.000000f, 2.400000f, 0.100000f, "CRT Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-lottes-fast";
+	VertexByteCode = RetroArchCrtShadersCrtLottesFastShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtLottesFastShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtLottesFastShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtLottesFastShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MASK", -1, 52, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Mask Type"));
+	Params.push_back(ShaderParam("MASK_INTENSITY", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Intensity"));
+	Params.push_back(ShaderParam("SCANLINE_THINNESS", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("SCAN_BLUR", -1, 64, 4, 1.000000f, 3.000000f, 2.500000f, 0.100000f, "Sharpness"));
+	Params.push_back(ShaderParam("CURVATURE", -1, 68, 4, 0.000000f, 0.250000f, 0.020000f, 0.010000f, "Curvature"));
+	Params.push_back(ShaderParam("TRINITRON_CURVE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Trinitron-style Curve"));
+	Params.push_back(ShaderParam("CORNER", -1, 76, 4, 0.000000f, 11.000000f, 3.000000f, 1.000000f, "Corner Round"));
+	Params.push_back(ShaderParam("CRT_GAMMA", -1, 80, 4, 0.000000f, 51.000000f, 2.400000f, 0.100000f, "CRT Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
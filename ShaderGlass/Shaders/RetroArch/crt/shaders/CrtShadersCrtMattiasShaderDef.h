@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMattiasShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMattiasShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMattiasShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -7809,33 +7820,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMattiasShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMattiasShaderDef::CrtShadersCrtMattiasShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMattiasShaderDef() : ShaderDef{}
-	{
-		Name = "crt-mattias";
-		VertexByteCode = RetroArchCrtShadersCrtMattiasShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMattiasShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMattiasShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMattiasShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVATURE", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Curvature"));
-		Params.push_back(ShaderParam("SCANSPEED", -1, 56, 4, 0.000000f, 10.000000f, 1.000000f, 0.500000f, "Scanline Crawl Speed"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-mattias";
+	VertexByteCode = RetroArchCrtShadersCrtMattiasShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMattiasShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMattiasShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMattiasShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVATURE", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Curvature"));
+	Params.push_back(ShaderParam("SCANSPEED", -1, 56, 4, 0.000000f, 10.000000f, 1.000000f, 0.500000f, "Scanline Crawl Speed"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtPiShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtPiShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtPiShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -807,38 +818,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtPiShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtPiShaderDef::CrtShadersCrtPiShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtPiShaderDef() : ShaderDef{}
-	{
-		Name = "crt-pi";
-		VertexByteCode = RetroArchCrtShadersCrtPiShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtPiShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtPiShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtPiShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVATURE_X", -1, 0, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Screen curvature - horizontal"));
-		Params.push_back(ShaderParam("CURVATURE_Y", -1, 4, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Screen curvature - vertical"));
-		Params.push_back(ShaderParam("MASK_BRIGHTNESS", -1, 8, 4, 0.000000f, 1.000000f, 0.700000f, 0.010000f, "Mask brightness"));
-		Params.push_back(ShaderParam("SCANLINE_WEIGHT", -1, 12, 4, 0.000000f, 15.000000f, 6.000000f, 0.100000f, "Scanline weight"));
-		Params.push_back(ShaderParam("SCANLINE_GAP_BRIGHTNESS", -1, 16, 4, 0.000000f, 1.000000f, 0.120000f, 0.010000f, "Scanline gap brightness"));
-		Params.push_back(ShaderParam("BLOOM_FACTOR", -1, 20, 4, 0.000000f, 5.000000f, 1.500000f, 0.010000f, "Bloom factor"));
-		Params.push_back(ShaderParam("INPUT_GAMMA", -1, 24, 4, 0.000000f, 5.000000f, 2.400000f, 0.010000f, "Input gamma"));
-		Params.push_back(ShaderParam("OUTPUT_GAMMA", -1, 28, 4, 0.000000f, 5.000000f, 2.200000f, 0.010000f, "Output gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-pi";
+	VertexByteCode = RetroArchCrtShadersCrtPiShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtPiShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtPiShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtPiShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVATURE_X", -1, 0, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Screen curvature - horizontal"));
+	Params.push_back(ShaderParam("CURVATURE_Y", -1, 4, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Screen curvature - vertical"));
+	Params.push_back(ShaderParam("MASK_BRIGHTNESS", -1, 8, 4, 0.000000f, 1.000000f, 0.700000f, 0.010000f, "Mask brightness"));
+	Params.push_back(ShaderParam("SCANLINE_WEIGHT", -1, 12, 4, 0.000000f, 15.000000f, 6.000000f, 0.100000f, "Scanline weight"));
+	Params.push_back(ShaderParam("SCANLINE_GAP_BRIGHTNESS", -1, 16, 4, 0.000000f, 1.000000f, 0.120000f, 0.010000f, "Scanline gap brightness"));
+	Params.push_back(ShaderParam("BLOOM_FACTOR", -1, 20, 4, 0.000000f, 5.000000f, 1.500000f, 0.010000f, "Bloom factor"));
+	Params.push_back(ShaderParam("INPUT_GAMMA", -1, 24, 4, 0.000000f, 5.000000f, 2.400000f, 0.010000f, "Input gamma"));
+	Params.push_back(ShaderParam("OUTPUT_GAMMA", -1, 28, 4, 0.000000f, 5.000000f, 2.200000f, 0.010000f, "Output gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -20,6 +20,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtPocketShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtPocketShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtPocketShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2512,59 +2523,53 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtPocketShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtPocketShaderDef::CrtShadersCrtPocketShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtPocketShaderDef() : ShaderDef{}
-	{
-		Name = "crt-pocket";
-		VertexByteCode = RetroArchCrtShadersCrtPocketShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtPocketShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtPocketShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtPocketShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DOTMASK_STRENGTH", 0, 64, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "CGWG Dot Mask Strength"));
-		Params.push_back(ShaderParam("maskDark", 0, 68, 4, 0.000000f, 2.000000f, 0.300000f, 0.100000f, "Lottes maskDark"));
-		Params.push_back(ShaderParam("maskLight", 0, 72, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Lottes maskLight"));
-		Params.push_back(ShaderParam("shadowMask", 0, 76, 4, 0.000000f, 5.000000f, 1.000000f, 1.000000f, "Mask Style 0:cgwg,1-4:Lottes,5:Sin"));
-		Params.push_back(ShaderParam("bgr", 0, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "RGB/BGR subpixels"));
-		Params.push_back(ShaderParam("maskl", 0, 84, 4, 0.000000f, 1.000000f, 0.900000f, 0.050000f, "Mask Low"));
-		Params.push_back(ShaderParam("maskh", 0, 88, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Mask High"));
-		Params.push_back(ShaderParam("gl", 0, 92, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Glow Strength"));
-		Params.push_back(ShaderParam("ntsc", 0, 96, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NTSC Colors"));
-		Params.push_back(ShaderParam("TEMP", 0, 100, 4, 1031.000000f, 12047.000000f, 8591.000000f, 72.000000f, "Color Temperature in Kelvins"));
-		Params.push_back(ShaderParam("size", 0, 104, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gammain", -1, 52, 4, 1.000000f, 4.000000f, 2.450000f, 0.050000f, "Gamma In"));
-		Params.push_back(ShaderParam("gammaout", -1, 56, 4, 1.000000f, 4.000000f, 2.250000f, 0.050000f, "Gamma Out"));
-		Params.push_back(ShaderParam("warpX", -1, 60, 4, 0.000000f, 0.200000f, 0.030000f, 0.010000f, "Curvature X"));
-		Params.push_back(ShaderParam("warpY", -1, 64, 4, 0.000000f, 0.200000f, 0.050000f, 0.010000f, "Curvature Y"));
-		Params.push_back(ShaderParam("vignette", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette On/Off"));
-		Params.push_back(ShaderParam("vign", -1, 72, 4, 0.000000f, 0.500000f, 0.100000f, 0.010000f, "Vignette Strength"));
-		Params.push_back(ShaderParam("corners", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Corners cut On/Off"));
-		Params.push_back(ShaderParam("beam1", -1, 80, 4, 1.000000f, 15.000000f, 6.000000f, 0.500000f, "Scanline Beam Low"));
-		Params.push_back(ShaderParam("beam2", -1, 84, 4, 1.000000f, 15.000000f, 8.000000f, 0.500000f, "Scanline Beam High"));
-		Params.push_back(ShaderParam("scanline1", -1, 88, 4, 0.500000f, 3.000000f, 1.350000f, 0.050000f, "Scanline Low"));
-		Params.push_back(ShaderParam("scanline2", -1, 92, 4, 0.500000f, 3.000000f, 1.050000f, 0.050000f, "Scanline High"));
-		Params.push_back(ShaderParam("interlace", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlace On/Off"));
-		Params.push_back(ShaderParam("progress", -1, 100, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force 240p"));
-		Params.push_back(ShaderParam("boost1", -1, 104, 4, 1.000000f, 2.000000f, 1.450000f, 0.050000f, "Boost Dark Colors"));
-		Params.push_back(ShaderParam("boost2", -1, 108, 4, 1.000000f, 2.000000f, 1.250000f, 0.050000f, "Boost Bright Colors"));
-		Params.push_back(ShaderParam("sat", -1, 112, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("flick", -1, 116, 4, 0.000000f, 10.000000f, 4.000000f, 0.100000f, "Flicker Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-pocket";
+	VertexByteCode = RetroArchCrtShadersCrtPocketShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtPocketShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtPocketShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtPocketShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DOTMASK_STRENGTH", 0, 64, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "CGWG Dot Mask Strength"));
+	Params.push_back(ShaderParam("maskDark", 0, 68, 4, 0.000000f, 2.000000f, 0.300000f, 0.100000f, "Lottes maskDark"));
+	Params.push_back(ShaderParam("maskLight", 0, 72, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Lottes maskLight"));
+	Params.push_back(ShaderParam("shadowMask", 0, 76, 4, 0.000000f, 5.000000f, 1.000000f, 1.000000f, "Mask Style 0:cgwg,1-4:Lottes,5:Sin"));
+	Params.push_back(ShaderParam("bgr", 0, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "RGB/BGR subpixels"));
+	Params.push_back(ShaderParam("maskl", 0, 84, 4, 0.000000f, 1.000000f, 0.900000f, 0.050000f, "Mask Low"));
+	Params.push_back(ShaderParam("maskh", 0, 88, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Mask High"));
+	Params.push_back(ShaderParam("gl", 0, 92, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Glow Strength"));
+	Params.push_back(ShaderParam("ntsc", 0, 96, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NTSC Colors"));
+	Params.push_back(ShaderParam("TEMP", 0, 100, 4, 1031.000000f, 12047.000000f, 8591.000000f, 72.000000f, "Color Temperature in Kelvins"));
+	Params.push_back(ShaderParam("size", 0, 104, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gammain", -1, 52, 4, 1.000000f, 4.000000f, 2.450000f, 0.050000f, "Gamma In"));
+	Params.push_back(ShaderParam("gammaout", -1, 56, 4, 1.000000f, 4.000000f, 2.250000f, 0.050000f, "Gamma Out"));
+	Params.push_back(ShaderParam("warpX", -1, 60, 4, 0.000000f, 0.200000f, 0.030000f, 0.010000f, "Curvature X"));
+	Params.push_back(ShaderParam("warpY", -1, 64, 4, 0.000000f, 0.200000f, 0.050000f, 0.010000f, "Curvature Y"));
+	Params.push_back(ShaderParam("vignette", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette On/Off"));
+	Params.push_back(ShaderParam("vign", -1, 72, 4, 0.000000f, 0.500000f, 0.100000f, 0.010000f, "Vignette Strength"));
+	Params.push_back(ShaderParam("corners", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Corners cut On/Off"));
+	Params.push_back(ShaderParam("beam1", -1, 80, 4, 1.000000f, 15.000000f, 6.000000f, 0.500000f, "Scanline Beam Low"));
+	Params.push_back(ShaderParam("beam2", -1, 84, 4, 1.000000f, 15.000000f, 8.000000f, 0.500000f, "Scanline Beam High"));
+	Params.push_back(ShaderParam("scanline1", -1, 88, 4, 0.500000f, 3.000000f, 1.350000f, 0.050000f, "Scanline Low"));
+	Params.push_back(ShaderParam("scanline2", -1, 92, 4, 0.500000f, 3.000000f, 1.050000f, 0.050000f, "Scanline High"));
+	Params.push_back(ShaderParam("interlace", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlace On/Off"));
+	Params.push_back(ShaderParam("progress", -1, 100, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force 240p"));
+	Params.push_back(ShaderParam("boost1", -1, 104, 4, 1.000000f, 2.000000f, 1.450000f, 0.050000f, "Boost Dark Colors"));
+	Params.push_back(ShaderParam("boost2", -1, 108, 4, 1.000000f, 2.000000f, 1.250000f, 0.050000f, "Boost Bright Colors"));
+	Params.push_back(ShaderParam("sat", -1, 112, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("flick", -1, 116, 4, 0.000000f, 10.000000f, 4.000000f, 0.100000f, "Flicker Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
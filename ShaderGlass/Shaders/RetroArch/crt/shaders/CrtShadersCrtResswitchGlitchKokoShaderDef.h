@@ -34,6 +34,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtResswitchGlitchKokoShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtResswitchGlitchKokoShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1332,42 +1343,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtResswitchGlitchKokoShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtResswitchGlitchKokoShaderDef::CrtShadersCrtResswitchGlitchKokoShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtResswitchGlitchKokoShaderDef() : ShaderDef{}
-	{
-		Name = "crt-resswitch-glitch-koko";
-		VertexByteCode = RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalHistorySize1", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalHistorySize2", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalHistorySize3", 0, 112, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalHistorySize4", 0, 128, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalHistorySize5", 0, 144, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RESSWITCH_ENABLE", 0, 160, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "★ Resolution switch glitch enable? (no d3d11) ==>"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_TRESHOLD", 0, 164, 4, 0.010000f, 1.000000f, 0.100000f, 0.010000f, "Glitch if vertical resolution changes at least by"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_BAR_STR", 0, 168, 4, 0.000000f, 1.000000f, 0.600000f, 0.010000f, "Bars strength"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_BAR_SIZE", 0, 172, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Bars size"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_BAR_SMOOTH", 0, 176, 4, 0.010000f, 1.000000f, 1.000000f, 0.010000f, "Bars smoothness"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_SHAKE_MAX", 0, 180, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Shake amplitude"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_ROT_MAX", 0, 184, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Tilt amplitude"));
-		Params.push_back(ShaderParam("RESSWITCH_GLITCH_WOB_MAX", 0, 188, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Wobblying amplitude"));
-		Params.push_back(ShaderParam("FrameCount", 0, 192, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-resswitch-glitch-koko";
+	VertexByteCode = RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtResswitchGlitchKokoShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalHistorySize1", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalHistorySize2", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalHistorySize3", 0, 112, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalHistorySize4", 0, 128, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalHistorySize5", 0, 144, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RESSWITCH_ENABLE", 0, 160, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "★ Resolution switch glitch enable? (no d3d11) ==>"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_TRESHOLD", 0, 164, 4, 0.010000f, 1.000000f, 0.100000f, 0.010000f, "Glitch if vertical resolution changes at least by"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_BAR_STR", 0, 168, 4, 0.000000f, 1.000000f, 0.600000f, 0.010000f, "Bars strength"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_BAR_SIZE", 0, 172, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Bars size"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_BAR_SMOOTH", 0, 176, 4, 0.010000f, 1.000000f, 1.000000f, 0.010000f, "Bars smoothness"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_SHAKE_MAX", 0, 180, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Shake amplitude"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_ROT_MAX", 0, 184, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Tilt amplitude"));
+	Params.push_back(ShaderParam("RESSWITCH_GLITCH_WOB_MAX", 0, 188, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Wobblying amplitude"));
+	Params.push_back(ShaderParam("FrameCount", 0, 192, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
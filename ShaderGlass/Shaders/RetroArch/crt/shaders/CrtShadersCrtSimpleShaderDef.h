@@ -38,6 +38,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSimpleShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSimpleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSimpleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -845,38 +856,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSimpleShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSimpleShaderDef::CrtShadersCrtSimpleShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSimpleShaderDef() : ShaderDef{}
-	{
-		Name = "crt-simple";
-		VertexByteCode = RetroArchCrtShadersCrtSimpleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSimpleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSimpleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSimpleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DISTORTION", -1, 52, 4, 0.000000f, 0.300000f, 0.120000f, 0.010000f, "Distortion"));
-		Params.push_back(ShaderParam("SCANLINE", -1, 56, 4, 0.200000f, 0.600000f, 0.300000f, 0.050000f, "Scanline Weight"));
-		Params.push_back(ShaderParam("INPUTGAMMA", -1, 60, 4, 0.000000f, 4.000000f, 2.400000f, 0.050000f, "Input Gamma"));
-		Params.push_back(ShaderParam("OUTPUTGAMMA", -1, 64, 4, 0.000000f, 4.000000f, 2.200000f, 0.050000f, "Output Gamma"));
-		Params.push_back(ShaderParam("MASK", -1, 68, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "Mask Brightness"));
-		Params.push_back(ShaderParam("SIZE", -1, 72, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("DOWNSCALE", -1, 76, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Scanlines Downscale"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-simple";
+	VertexByteCode = RetroArchCrtShadersCrtSimpleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSimpleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSimpleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSimpleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DISTORTION", -1, 52, 4, 0.000000f, 0.300000f, 0.120000f, 0.010000f, "Distortion"));
+	Params.push_back(ShaderParam("SCANLINE", -1, 56, 4, 0.200000f, 0.600000f, 0.300000f, 0.050000f, "Scanline Weight"));
+	Params.push_back(ShaderParam("INPUTGAMMA", -1, 60, 4, 0.000000f, 4.000000f, 2.400000f, 0.050000f, "Input Gamma"));
+	Params.push_back(ShaderParam("OUTPUTGAMMA", -1, 64, 4, 0.000000f, 4.000000f, 2.200000f, 0.050000f, "Output Gamma"));
+	Params.push_back(ShaderParam("MASK", -1, 68, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "Mask Brightness"));
+	Params.push_back(ShaderParam("SIZE", -1, 72, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("DOWNSCALE", -1, 76, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Scanlines Downscale"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
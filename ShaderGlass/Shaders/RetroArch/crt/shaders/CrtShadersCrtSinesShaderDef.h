@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSinesShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSinesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSinesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1418,52 +1429,46 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSinesShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSinesShaderDef::CrtShadersCrtSinesShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSinesShaderDef() : ShaderDef{}
-	{
-		Name = "crt-sines";
-		VertexByteCode = RetroArchCrtShadersCrtSinesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSinesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSinesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSinesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE1", -1, 4, 4, 0.000000f, 1.000000f, 0.750000f, 0.050000f, "Scanline Strength Dark"));
-		Params.push_back(ShaderParam("SCANLINE2", -1, 8, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Strength Bright"));
-		Params.push_back(ShaderParam("INTERLACE", -1, 12, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Interlace Mode"));
-		Params.push_back(ShaderParam("SCALE", -1, 16, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Scanlines downscale"));
-		Params.push_back(ShaderParam("MSK1", -1, 20, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Brightness Dark"));
-		Params.push_back(ShaderParam("MSK2", -1, 24, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Mask Brightness Bright"));
-		Params.push_back(ShaderParam("MSK_SIZE", -1, 28, 4, 0.500200f, 1.000000f, 0.500200f, 0.166600f, "Mask Size"));
-		Params.push_back(ShaderParam("FADE", -1, 32, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Mask/Scanlines fade"));
-		Params.push_back(ShaderParam("PRESERVE", -1, 36, 4, 0.000000f, 1.000000f, 0.700000f, 0.010000f, "Protect Bright Colors"));
-		Params.push_back(ShaderParam("SAT", -1, 40, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("SIZE", -1, 44, 4, 0.125000f, 4.000000f, 0.500000f, 0.125000f, "Soft Pixel Size"));
-		Params.push_back(ShaderParam("BLUR", -1, 48, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Pixel Softness"));
-		Params.push_back(ShaderParam("NOISE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Add Noise"));
-		Params.push_back(ShaderParam("SEGA", -1, 56, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Brightness Fix 1.0:Sega, 2:Amiga/ST"));
-		Params.push_back(ShaderParam("INGAMMA", -1, 60, 4, 1.000000f, 4.000000f, 2.400000f, 0.050000f, "Gamma In"));
-		Params.push_back(ShaderParam("OUTGAMMA", -1, 64, 4, 1.000000f, 4.000000f, 2.250000f, 0.050000f, "Gamma Out"));
-		Params.push_back(ShaderParam("WPR", -1, 68, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Shift to Red"));
-		Params.push_back(ShaderParam("WPG", -1, 72, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Shift to Green"));
-		Params.push_back(ShaderParam("WPB", -1, 76, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Shift to Blue"));
-		Params.push_back(ShaderParam("BOOST", -1, 80, 4, 1.000000f, 2.000000f, 1.300000f, 0.050000f, "Bright Boost"));
-		Params.push_back(ShaderParam("BOOSTD", -1, 84, 4, 1.000000f, 2.000000f, 1.450000f, 0.050000f, "Dark Boost"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-sines";
+	VertexByteCode = RetroArchCrtShadersCrtSinesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSinesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSinesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSinesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE1", -1, 4, 4, 0.000000f, 1.000000f, 0.750000f, 0.050000f, "Scanline Strength Dark"));
+	Params.push_back(ShaderParam("SCANLINE2", -1, 8, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Strength Bright"));
+	Params.push_back(ShaderParam("INTERLACE", -1, 12, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Interlace Mode"));
+	Params.push_back(ShaderParam("SCALE", -1, 16, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Scanlines downscale"));
+	Params.push_back(ShaderParam("MSK1", -1, 20, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Brightness Dark"));
+	Params.push_back(ShaderParam("MSK2", -1, 24, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Mask Brightness Bright"));
+	Params.push_back(ShaderParam("MSK_SIZE", -1, 28, 4, 0.500200f, 1.000000f, 0.500200f, 0.166600f, "Mask Size"));
+	Params.push_back(ShaderParam("FADE", -1, 32, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Mask/Scanlines fade"));
+	Params.push_back(ShaderParam("PRESERVE", -1, 36, 4, 0.000000f, 1.000000f, 0.700000f, 0.010000f, "Protect Bright Colors"));
+	Params.push_back(ShaderParam("SAT", -1, 40, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("SIZE", -1, 44, 4, 0.125000f, 4.000000f, 0.500000f, 0.125000f, "Soft Pixel Size"));
+	Params.push_back(ShaderParam("BLUR", -1, 48, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Pixel Softness"));
+	Params.push_back(ShaderParam("NOISE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Add Noise"));
+	Params.push_back(ShaderParam("SEGA", -1, 56, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Brightness Fix 1.0:Sega, 2:Amiga/ST"));
+	Params.push_back(ShaderParam("INGAMMA", -1, 60, 4, 1.000000f, 4.000000f, 2.400000f, 0.050000f, "Gamma In"));
+	Params.push_back(ShaderParam("OUTGAMMA", -1, 64, 4, 1.000000f, 4.000000f, 2.250000f, 0.050000f, "Gamma Out"));
+	Params.push_back(ShaderParam("WPR", -1, 68, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Shift to Red"));
+	Params.push_back(ShaderParam("WPG", -1, 72, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Shift to Green"));
+	Params.push_back(ShaderParam("WPB", -1, 76, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Shift to Blue"));
+	Params.push_back(ShaderParam("BOOST", -1, 80, 4, 1.000000f, 2.000000f, 1.300000f, 0.050000f, "Bright Boost"));
+	Params.push_back(ShaderParam("BOOSTD", -1, 84, 4, 1.000000f, 2.000000f, 1.450000f, 0.050000f, "Dark Boost"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -19,6 +19,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersDotmaskShaderDef : public ShaderDef
+{
+public:
+	CrtShadersDotmaskShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersDotmaskShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -937,34 +948,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersDotmaskShaderDef : public ShaderDef
+RetroArch::CrtShadersDotmaskShaderDef::CrtShadersDotmaskShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersDotmaskShaderDef() : ShaderDef{}
-	{
-		Name = "dotmask";
-		VertexByteCode = RetroArchCrtShadersDotmaskShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersDotmaskShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersDotmaskShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersDotmaskShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DOTMASK_STRENGTH", 0, 112, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "CGWG Dot Mask Strength"));
-		Params.push_back(ShaderParam("maskDark", 0, 116, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "Lottes maskDark"));
-		Params.push_back(ShaderParam("maskLight", 0, 120, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Lottes maskLight"));
-		Params.push_back(ShaderParam("shadowMask", 0, 124, 4, 0.000000f, 5.000000f, 3.000000f, 1.000000f, "Mask Style"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "dotmask";
+	VertexByteCode = RetroArchCrtShadersDotmaskShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersDotmaskShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersDotmaskShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersDotmaskShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DOTMASK_STRENGTH", 0, 112, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "CGWG Dot Mask Strength"));
+	Params.push_back(ShaderParam("maskDark", 0, 116, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "Lottes maskDark"));
+	Params.push_back(ShaderParam("maskLight", 0, 120, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "Lottes maskLight"));
+	Params.push_back(ShaderParam("shadowMask", 0, 124, 4, 0.000000f, 5.000000f, 3.000000f, 1.000000f, "Mask Style"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
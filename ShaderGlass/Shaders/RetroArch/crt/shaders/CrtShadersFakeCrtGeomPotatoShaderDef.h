@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersFakeCrtGeomPotatoShaderDef : public ShaderDef
+{
+public:
+	CrtShadersFakeCrtGeomPotatoShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -747,32 +758,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersFakeCrtGeomPotatoShaderDef : public ShaderDef
+RetroArch::CrtShadersFakeCrtGeomPotatoShaderDef::CrtShadersFakeCrtGeomPotatoShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersFakeCrtGeomPotatoShaderDef() : ShaderDef{}
-	{
-		Name = "fake-crt-geom-potato";
-		VertexByteCode = RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZE", -1, 52, 4, 2.000000f, 3.000000f, 2.000000f, 1.000000f, "Mask Type"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "fake-crt-geom-potato";
+	VertexByteCode = RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersFakeCrtGeomPotatoShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZE", -1, 52, 4, 2.000000f, 3.000000f, 2.000000f, 1.000000f, "Mask Type"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
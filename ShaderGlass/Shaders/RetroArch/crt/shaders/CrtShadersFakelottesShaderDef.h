@@ -31,6 +31,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersFakelottesShaderDef : public ShaderDef
+{
+public:
+	CrtShadersFakelottesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersFakelottesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -858,41 +869,35 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersFakelottesShaderDef : public ShaderDef
+RetroArch::CrtShadersFakelottesShaderDef::CrtShadersFakelottesShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersFakelottesShaderDef() : ShaderDef{}
-	{
-		Name = "fakelottes";
-		VertexByteCode = RetroArchCrtShadersFakelottesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersFakelottesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersFakelottesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersFakelottesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("shadowMask", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 1.000000f, "shadowMask"));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", -1, 56, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("warpX", -1, 60, 4, 0.000000f, 0.125000f, 0.031000f, 0.010000f, "warpX"));
-		Params.push_back(ShaderParam("warpY", -1, 64, 4, 0.000000f, 0.125000f, 0.041000f, 0.010000f, "warpY"));
-		Params.push_back(ShaderParam("maskDark", -1, 68, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "maskDark"));
-		Params.push_back(ShaderParam("maskLight", -1, 72, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "maskLight"));
-		Params.push_back(ShaderParam("monitor_gamma", -1, 76, 4, 1.000000f, 4.000000f, 2.200000f, 0.050000f, "Monitor Gamma"));
-		Params.push_back(ShaderParam("crt_gamma", -1, 80, 4, 1.000000f, 4.000000f, 2.500000f, 0.050000f, "CRT Gamma"));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", -1, 84, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Scanline Sine Comp A"));
-		Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", -1, 88, 4, 0.000000f, 1.000000f, 0.950000f, 0.010000f, "Scanline Base Brightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "fakelottes";
+	VertexByteCode = RetroArchCrtShadersFakelottesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersFakelottesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersFakelottesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersFakelottesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("shadowMask", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 1.000000f, "shadowMask"));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", -1, 56, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("warpX", -1, 60, 4, 0.000000f, 0.125000f, 0.031000f, 0.010000f, "warpX"));
+	Params.push_back(ShaderParam("warpY", -1, 64, 4, 0.000000f, 0.125000f, 0.041000f, 0.010000f, "warpY"));
+	Params.push_back(ShaderParam("maskDark", -1, 68, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "maskDark"));
+	Params.push_back(ShaderParam("maskLight", -1, 72, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "maskLight"));
+	Params.push_back(ShaderParam("monitor_gamma", -1, 76, 4, 1.000000f, 4.000000f, 2.200000f, 0.050000f, "Monitor Gamma"));
+	Params.push_back(ShaderParam("crt_gamma", -1, 80, 4, 1.000000f, 4.000000f, 2.500000f, 0.050000f, "CRT Gamma"));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", -1, 84, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Scanline Sine Comp A"));
+	Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", -1, 88, 4, 0.000000f, 1.000000f, 0.950000f, 0.010000f, "Scanline Base Brightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
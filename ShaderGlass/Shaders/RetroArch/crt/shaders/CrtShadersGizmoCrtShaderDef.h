@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGizmoCrtShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGizmoCrtShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGizmoCrtShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1270,39 +1281,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGizmoCrtShaderDef : public ShaderDef
+RetroArch::CrtShadersGizmoCrtShaderDef::CrtShadersGizmoCrtShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGizmoCrtShaderDef() : ShaderDef{}
-	{
-		Name = "gizmo-crt";
-		VertexByteCode = RetroArchCrtShadersGizmoCrtShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGizmoCrtShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGizmoCrtShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGizmoCrtShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVATURE_X", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Screen curvature - horizontal"));
-		Params.push_back(ShaderParam("CURVATURE_Y", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Screen curvature - vertical"));
-		Params.push_back(ShaderParam("BRIGHTNESS", -1, 60, 4, 0.050000f, 1.000000f, 0.500000f, 0.050000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("HORIZONTAL_BLUR", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Horizontal Blur"));
-		Params.push_back(ShaderParam("VERTICAL_BLUR", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Blur"));
-		Params.push_back(ShaderParam("BLUR_OFFSET", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Blur Intensity"));
-		Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
-		Params.push_back(ShaderParam("SHRINK", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Shrink screen"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gizmo-crt";
+	VertexByteCode = RetroArchCrtShadersGizmoCrtShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGizmoCrtShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGizmoCrtShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGizmoCrtShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVATURE_X", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Screen curvature - horizontal"));
+	Params.push_back(ShaderParam("CURVATURE_Y", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Screen curvature - vertical"));
+	Params.push_back(ShaderParam("BRIGHTNESS", -1, 60, 4, 0.050000f, 1.000000f, 0.500000f, 0.050000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("HORIZONTAL_BLUR", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Horizontal Blur"));
+	Params.push_back(ShaderParam("VERTICAL_BLUR", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Blur"));
+	Params.push_back(ShaderParam("BLUR_OFFSET", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Blur Intensity"));
+	Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
+	Params.push_back(ShaderParam("SHRINK", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Shrink screen"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
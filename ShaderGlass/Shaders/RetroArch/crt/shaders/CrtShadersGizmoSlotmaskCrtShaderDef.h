@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGizmoSlotmaskCrtShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGizmoSlotmaskCrtShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1546,43 +1557,37 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGizmoSlotmaskCrtShaderDef : public ShaderDef
+RetroArch::CrtShadersGizmoSlotmaskCrtShaderDef::CrtShadersGizmoSlotmaskCrtShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGizmoSlotmaskCrtShaderDef() : ShaderDef{}
-	{
-		Name = "gizmo-slotmask-crt";
-		VertexByteCode = RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVATURE_X", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Screen curvature - horizontal"));
-		Params.push_back(ShaderParam("CURVATURE_Y", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Screen curvature - vertical"));
-		Params.push_back(ShaderParam("BRIGHTNESS", -1, 60, 4, 0.050000f, 1.000000f, 0.500000f, 0.050000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("HORIZONTAL_BLUR", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Horizontal Blur"));
-		Params.push_back(ShaderParam("VERTICAL_BLUR", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Blur"));
-		Params.push_back(ShaderParam("BLUR_OFFSET", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Blur Intensity"));
-		Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
-		Params.push_back(ShaderParam("SHRINK", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Horizontal scale"));
-		Params.push_back(ShaderParam("SNR", -1, 84, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Noise intensity"));
-		Params.push_back(ShaderParam("COLOUR_BLEEDING", -1, 88, 4, 0.000000f, 3.000000f, 0.000000f, 0.100000f, "Colour bleeding intensity"));
-		Params.push_back(ShaderParam("GRID", -1, 92, 4, 0.000000f, 3.000000f, 0.000000f, 0.050000f, "Grid intensity"));
-		Params.push_back(ShaderParam("SLOTMASK", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use slot mask"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gizmo-slotmask-crt";
+	VertexByteCode = RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGizmoSlotmaskCrtShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVATURE_X", -1, 52, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Screen curvature - horizontal"));
+	Params.push_back(ShaderParam("CURVATURE_Y", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Screen curvature - vertical"));
+	Params.push_back(ShaderParam("BRIGHTNESS", -1, 60, 4, 0.050000f, 1.000000f, 0.500000f, 0.050000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("HORIZONTAL_BLUR", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Horizontal Blur"));
+	Params.push_back(ShaderParam("VERTICAL_BLUR", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Vertical Blur"));
+	Params.push_back(ShaderParam("BLUR_OFFSET", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Blur Intensity"));
+	Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
+	Params.push_back(ShaderParam("SHRINK", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Horizontal scale"));
+	Params.push_back(ShaderParam("SNR", -1, 84, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Noise intensity"));
+	Params.push_back(ShaderParam("COLOUR_BLEEDING", -1, 88, 4, 0.000000f, 3.000000f, 0.000000f, 0.100000f, "Colour bleeding intensity"));
+	Params.push_back(ShaderParam("GRID", -1, 92, 4, 0.000000f, 3.000000f, 0.000000f, 0.050000f, "Grid intensity"));
+	Params.push_back(ShaderParam("SLOTMASK", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use slot mask"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersYeetronShaderDef : public ShaderDef
+{
+public:
+	CrtShadersYeetronShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersYeetronShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -689,36 +700,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersYeetronShaderDef : public ShaderDef
+RetroArch::CrtShadersYeetronShaderDef::CrtShadersYeetronShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersYeetronShaderDef() : ShaderDef{}
-	{
-		Name = "yeetron";
-		VertexByteCode = RetroArchCrtShadersYeetronShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersYeetronShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersYeetronShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersYeetronShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("viewSizeHD", -1, 0, 4, 0.000000f, 2190.000000f, 720.000000f, 1.000000f, "Min Dimming Res"));
-		Params.push_back(ShaderParam("intensityR", -1, 4, 4, 0.000000f, 2.000000f, 1.200000f, 0.100000f, "Red Dimming Intensity"));
-		Params.push_back(ShaderParam("intensityG", -1, 8, 4, 0.000000f, 2.000000f, 0.900000f, 0.100000f, "Green Dimming Intensity"));
-		Params.push_back(ShaderParam("intensityB", -1, 12, 4, 0.000000f, 2.000000f, 0.900000f, 0.100000f, "Blue Dimming Intensity"));
-		Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "yeetron";
+	VertexByteCode = RetroArchCrtShadersYeetronShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersYeetronShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersYeetronShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersYeetronShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("viewSizeHD", -1, 0, 4, 0.000000f, 2190.000000f, 720.000000f, 1.000000f, "Min Dimming Res"));
+	Params.push_back(ShaderParam("intensityR", -1, 4, 4, 0.000000f, 2.000000f, 1.200000f, 0.100000f, "Red Dimming Intensity"));
+	Params.push_back(ShaderParam("intensityG", -1, 8, 4, 0.000000f, 2.000000f, 0.900000f, 0.100000f, "Green Dimming Intensity"));
+	Params.push_back(ShaderParam("intensityB", -1, 12, 4, 0.000000f, 2.000000f, 0.900000f, 0.100000f, "Blue Dimming Intensity"));
+	Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef : public TextureDef
+{
+public:
+	CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGritsScanlinesFakeSelfIlluminationTextureDefs
 {
 const BYTE sData[] =
@@ -56,13 +64,10 @@ const BYTE sData[] =
 ,235,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef : public TextureDef
+CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef::CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef() : TextureDef{}
-	{
-		Name = "Fake-Self-Illumination.png";
-		Data = CrtShadersGritsScanlinesFakeSelfIlluminationTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGritsScanlinesFakeSelfIlluminationTextureDefs::sData);
-	}
-};
+	Name = "Fake-Self-Illumination.png";
+	Data = CrtShadersGritsScanlinesFakeSelfIlluminationTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGritsScanlinesFakeSelfIlluminationTextureDefs::sData);
+}
+#endif
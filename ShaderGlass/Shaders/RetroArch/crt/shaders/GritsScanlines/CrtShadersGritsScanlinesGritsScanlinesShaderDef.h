@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGritsScanlinesGritsScanlinesShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGritsScanlinesGritsScanlinesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -556,36 +567,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGritsScanlinesGritsScanlinesShaderDef : public ShaderDef
+RetroArch::CrtShadersGritsScanlinesGritsScanlinesShaderDef::CrtShadersGritsScanlinesGritsScanlinesShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGritsScanlinesGritsScanlinesShaderDef() : ShaderDef{}
-	{
-		Name = "GritsScanlines";
-		VertexByteCode = RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ScanlinesOpacity", -1, 52, 4, 0.000000f, 1.000000f, 0.900000f, 0.050000f, "Scanline Opacity"));
-		Params.push_back(ShaderParam("GammaCorrection", -1, 56, 4, 0.500000f, 2.000000f, 1.200000f, 0.100000f, "Gamma Correction"));
-		Samplers.push_back(ShaderSampler("luminance_LUT", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("scanlines_LUT", 5));
-		Samplers.push_back(ShaderSampler("color_LUT", 4));
+	Name = "GritsScanlines";
+	VertexByteCode = RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGritsScanlinesGritsScanlinesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ScanlinesOpacity", -1, 52, 4, 0.000000f, 1.000000f, 0.900000f, 0.050000f, "Scanline Opacity"));
+	Params.push_back(ShaderParam("GammaCorrection", -1, 56, 4, 0.500000f, 2.000000f, 1.200000f, 0.100000f, "Gamma Correction"));
+	Samplers.push_back(ShaderSampler("luminance_LUT", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("scanlines_LUT", 5));
+	Samplers.push_back(ShaderSampler("color_LUT", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGritsScanlinesScanlineLUT4pxTextureDef : public TextureDef
+{
+public:
+	CrtShadersGritsScanlinesScanlineLUT4pxTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGritsScanlinesScanlineLUT4pxTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class CrtShadersGritsScanlinesScanlineLUT4pxTextureDef : public TextureDef
+CrtShadersGritsScanlinesScanlineLUT4pxTextureDef::CrtShadersGritsScanlinesScanlineLUT4pxTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGritsScanlinesScanlineLUT4pxTextureDef() : TextureDef{}
-	{
-		Name = "Scanline-LUT-4px.png";
-		Data = CrtShadersGritsScanlinesScanlineLUT4pxTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGritsScanlinesScanlineLUT4pxTextureDefs::sData);
-	}
-};
+	Name = "Scanline-LUT-4px.png";
+	Data = CrtShadersGritsScanlinesScanlineLUT4pxTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGritsScanlinesScanlineLUT4pxTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGritsScanlinesTrinitron_colorTextureDef : public TextureDef
+{
+public:
+	CrtShadersGritsScanlinesTrinitron_colorTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGritsScanlinesTrinitron_colorTextureDefs
 {
 const BYTE sData[] =
@@ -269,13 +277,10 @@ const BYTE sData[] =
 ,30,252,19,131,233,133,185,138,29,26,100,255,6,180,89,243,155,41,192,101,39,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGritsScanlinesTrinitron_colorTextureDef : public TextureDef
+CrtShadersGritsScanlinesTrinitron_colorTextureDef::CrtShadersGritsScanlinesTrinitron_colorTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGritsScanlinesTrinitron_colorTextureDef() : TextureDef{}
-	{
-		Name = "trinitron_color.png";
-		Data = CrtShadersGritsScanlinesTrinitron_colorTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGritsScanlinesTrinitron_colorTextureDefs::sData);
-	}
-};
+	Name = "trinitron_color.png";
+	Data = CrtShadersGritsScanlinesTrinitron_colorTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGritsScanlinesTrinitron_colorTextureDefs::sData);
+}
+#endif
@@ -49,6 +49,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1784,69 +1795,63 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef : public ShaderDef
+RetroArch::CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef::CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef() : ShaderDef{}
-	{
-		Name = "cathode-retro-crt-generate-masks";
-		VertexByteCode = RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("cb_first_start", 0, 80, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Color Burst Phase First Scanline"));
-		Params.push_back(ShaderParam("cb_last_start", 0, 84, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "CB Phase Prev Frame First Scanline"));
-		Params.push_back(ShaderParam("cb_phase_inc", 0, 88, 4, 0.000000f, 3.000000f, 1.666660f, 0.010000f, "Color Burst Phase Increment"));
-		Params.push_back(ShaderParam("cb_samples", 0, 92, 4, 1.000000f, 100.000000f, 2.000000f, 1.000000f, "Samples Per Color Burst Cyle"));
-		Params.push_back(ShaderParam("horz_track_scale", 0, 96, 4, 0.000000f, 3.000000f, 1.000000f, 0.050000f, "Horizontal Tracking Instability Scale"));
-		Params.push_back(ShaderParam("minlum", 0, 100, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Minimum Luminance"));
-		Params.push_back(ShaderParam("colorpower", 0, 104, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Color Power"));
-		Params.push_back(ShaderParam("composite", 0, 108, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Blend Chrome/Luma (aka Composite)"));
-		Params.push_back(ShaderParam("sig_pad", 0, 112, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Signal Padding at Edges"));
-		Params.push_back(ShaderParam("ghost_vis", 0, 116, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Ghost Visibility"));
-		Params.push_back(ShaderParam("ghost_dist", 0, 120, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "Ghost Delay Cycles"));
-		Params.push_back(ShaderParam("ghost_spread", 0, 124, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "Ghost Spread Cycles"));
-		Params.push_back(ShaderParam("noise_strength", 0, 128, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Artifact Noise Strength"));
-		Params.push_back(ShaderParam("tint", 0, 132, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Tint Knob Adjustment"));
-		Params.push_back(ShaderParam("cat_sat", 0, 136, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("cat_bright", 0, 140, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("cat_white_lvl", 0, 144, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White Level"));
-		Params.push_back(ShaderParam("cat_black_lvl", 0, 148, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Black Level"));
-		Params.push_back(ShaderParam("temp_artifact_blend", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Temporal Artifact Blending (Toggle)"));
-		Params.push_back(ShaderParam("blurStrength", 0, 156, 4, -1.000000f, 1.000000f, -0.150000f, 0.010000f, "Sharpness"));
-		Params.push_back(ShaderParam("stepSize", 0, 160, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Texels Between Each Sample"));
-		Params.push_back(ShaderParam("persistence", 0, 164, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Phosphor Persistence"));
-		Params.push_back(ShaderParam("scan_intens", 0, 168, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("diffusion", 0, 172, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Diffusion Strength"));
-		Params.push_back(ShaderParam("mask_intens", 0, 176, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Mask Strength"));
-		Params.push_back(ShaderParam("mask_depth", 0, 180, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Mask Background Darkness"));
-		Params.push_back(ShaderParam("cat_mask_picker", 0, 184, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Mask (0=none, 1=aperture, 2=slot, 3=shadow)"));
-		Params.push_back(ShaderParam("mask_scale", 0, 188, 4, 1.000000f, 200.000000f, 1.000000f, 1.000000f, "Mask Scale (2 or 3 for 4K)"));
-		Params.push_back(ShaderParam("anim_noise", 0, 192, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Animate Anti-Moire Noise"));
-		Params.push_back(ShaderParam("div0", 0, 196, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "--------Screen Settings--------"));
-		Params.push_back(ShaderParam("div1", 0, 200, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "---------TV Knob Settings---------"));
-		Params.push_back(ShaderParam("div2", 0, 204, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "---------Signal Parameters---------"));
-		Params.push_back(ShaderParam("div3", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "-------Artifact Settings-------"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpX", -1, 80, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Barrel Distortion X"));
-		Params.push_back(ShaderParam("warpY", -1, 84, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Barrel Distortion Y"));
-		Params.push_back(ShaderParam("corner", -1, 88, 4, 0.000000f, 1.000000f, 0.030000f, 0.010000f, "Rounded Corner Size"));
-		Params.push_back(ShaderParam("noise_seed", -1, 92, 4, 179.000000f, 313.000000f, 247.000000f, 1.000000f, "Noise Seed"));
+	Name = "cathode-retro-crt-generate-masks";
+	VertexByteCode = RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("cb_first_start", 0, 80, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "Color Burst Phase First Scanline"));
+	Params.push_back(ShaderParam("cb_last_start", 0, 84, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "CB Phase Prev Frame First Scanline"));
+	Params.push_back(ShaderParam("cb_phase_inc", 0, 88, 4, 0.000000f, 3.000000f, 1.666660f, 0.010000f, "Color Burst Phase Increment"));
+	Params.push_back(ShaderParam("cb_samples", 0, 92, 4, 1.000000f, 100.000000f, 2.000000f, 1.000000f, "Samples Per Color Burst Cyle"));
+	Params.push_back(ShaderParam("horz_track_scale", 0, 96, 4, 0.000000f, 3.000000f, 1.000000f, 0.050000f, "Horizontal Tracking Instability Scale"));
+	Params.push_back(ShaderParam("minlum", 0, 100, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Minimum Luminance"));
+	Params.push_back(ShaderParam("colorpower", 0, 104, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Color Power"));
+	Params.push_back(ShaderParam("composite", 0, 108, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Blend Chrome/Luma (aka Composite)"));
+	Params.push_back(ShaderParam("sig_pad", 0, 112, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Signal Padding at Edges"));
+	Params.push_back(ShaderParam("ghost_vis", 0, 116, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Ghost Visibility"));
+	Params.push_back(ShaderParam("ghost_dist", 0, 120, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "Ghost Delay Cycles"));
+	Params.push_back(ShaderParam("ghost_spread", 0, 124, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "Ghost Spread Cycles"));
+	Params.push_back(ShaderParam("noise_strength", 0, 128, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Artifact Noise Strength"));
+	Params.push_back(ShaderParam("tint", 0, 132, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Tint Knob Adjustment"));
+	Params.push_back(ShaderParam("cat_sat", 0, 136, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("cat_bright", 0, 140, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("cat_white_lvl", 0, 144, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White Level"));
+	Params.push_back(ShaderParam("cat_black_lvl", 0, 148, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Black Level"));
+	Params.push_back(ShaderParam("temp_artifact_blend", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Temporal Artifact Blending (Toggle)"));
+	Params.push_back(ShaderParam("blurStrength", 0, 156, 4, -1.000000f, 1.000000f, -0.150000f, 0.010000f, "Sharpness"));
+	Params.push_back(ShaderParam("stepSize", 0, 160, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Texels Between Each Sample"));
+	Params.push_back(ShaderParam("persistence", 0, 164, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Phosphor Persistence"));
+	Params.push_back(ShaderParam("scan_intens", 0, 168, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("diffusion", 0, 172, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Diffusion Strength"));
+	Params.push_back(ShaderParam("mask_intens", 0, 176, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Mask Strength"));
+	Params.push_back(ShaderParam("mask_depth", 0, 180, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Mask Background Darkness"));
+	Params.push_back(ShaderParam("cat_mask_picker", 0, 184, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Mask (0=none, 1=aperture, 2=slot, 3=shadow)"));
+	Params.push_back(ShaderParam("mask_scale", 0, 188, 4, 1.000000f, 200.000000f, 1.000000f, 1.000000f, "Mask Scale (2 or 3 for 4K)"));
+	Params.push_back(ShaderParam("anim_noise", 0, 192, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Animate Anti-Moire Noise"));
+	Params.push_back(ShaderParam("div0", 0, 196, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "--------Screen Settings--------"));
+	Params.push_back(ShaderParam("div1", 0, 200, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "---------TV Knob Settings---------"));
+	Params.push_back(ShaderParam("div2", 0, 204, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "---------Signal Parameters---------"));
+	Params.push_back(ShaderParam("div3", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "-------Artifact Settings-------"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpX", -1, 80, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Barrel Distortion X"));
+	Params.push_back(ShaderParam("warpY", -1, 84, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Barrel Distortion Y"));
+	Params.push_back(ShaderParam("corner", -1, 88, 4, 0.000000f, 1.000000f, 0.030000f, 0.010000f, "Rounded Corner Size"));
+	Params.push_back(ShaderParam("noise_seed", -1, 92, 4, 179.000000f, 313.000000f, 247.000000f, 1.000000f, "Noise Seed"));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtConsumerBezelTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtConsumerBezelTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtConsumerBezelTextureDefs
 {
 const BYTE sData[] =
@@ -204,13 +212,10 @@ const BYTE sData[] =
 ,140,221,159,255,106,78,206,156,56,26,109,117,47,185,151,151,255,15,132,191,109,109,18,44,159,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtConsumerBezelTextureDef : public TextureDef
+CrtShadersCrtConsumerBezelTextureDef::CrtShadersCrtConsumerBezelTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtConsumerBezelTextureDef() : TextureDef{}
-	{
-		Name = "bezel.png";
-		Data = CrtShadersCrtConsumerBezelTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtConsumerBezelTextureDefs::sData);
-	}
-};
+	Name = "bezel.png";
+	Data = CrtShadersCrtConsumerBezelTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtConsumerBezelTextureDefs::sData);
+}
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtEasymodeHalationBlur_vertShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtEasymodeHalationBlur_vertShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -416,31 +427,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtEasymodeHalationBlur_vertShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtEasymodeHalationBlur_vertShaderDef::CrtShadersCrtEasymodeHalationBlur_vertShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtEasymodeHalationBlur_vertShaderDef() : ShaderDef{}
-	{
-		Name = "blur_vert";
-		VertexByteCode = RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_vert";
+	VertexByteCode = RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationBlur_vertShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2211,52 +2222,46 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef::CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef() : ShaderDef{}
-	{
-		Name = "crt-easymode-halation";
-		VertexByteCode = RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ORIG_LINEARIZEDSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GAMMA_OUTPUT", -1, 32, 4, 0.100000f, 5.000000f, 2.200000f, 0.010000f, "Gamma Output"));
-		Params.push_back(ShaderParam("SHARPNESS_H", -1, 36, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Sharpness Horizontal"));
-		Params.push_back(ShaderParam("SHARPNESS_V", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Sharpness Vertical"));
-		Params.push_back(ShaderParam("MASK_TYPE", -1, 44, 4, 0.000000f, 7.000000f, 4.000000f, 1.000000f, "Mask Type"));
-		Params.push_back(ShaderParam("MASK_STRENGTH_MIN", -1, 48, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Mask Strength Min."));
-		Params.push_back(ShaderParam("MASK_STRENGTH_MAX", -1, 52, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Mask Strength Max."));
-		Params.push_back(ShaderParam("MASK_SIZE", -1, 56, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Size"));
-		Params.push_back(ShaderParam("SCANLINE_STRENGTH_MIN", -1, 60, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Scanline Strength Min."));
-		Params.push_back(ShaderParam("SCANLINE_STRENGTH_MAX", -1, 64, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Strength Max."));
-		Params.push_back(ShaderParam("SCANLINE_BEAM_MIN", -1, 68, 4, 0.250000f, 5.000000f, 1.000000f, 0.050000f, "Scanline Beam Min."));
-		Params.push_back(ShaderParam("SCANLINE_BEAM_MAX", -1, 72, 4, 0.250000f, 5.000000f, 1.000000f, 0.050000f, "Scanline Beam Max."));
-		Params.push_back(ShaderParam("GEOM_CURVATURE", -1, 76, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Geom Curvature"));
-		Params.push_back(ShaderParam("GEOM_WARP", -1, 80, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Geom Warp"));
-		Params.push_back(ShaderParam("GEOM_CORNER_SIZE", -1, 84, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Geom Corner Size"));
-		Params.push_back(ShaderParam("GEOM_CORNER_SMOOTH", -1, 88, 4, 50.000000f, 1000.000000f, 150.000000f, 25.000000f, "Geom Corner Smoothness"));
-		Params.push_back(ShaderParam("INTERLACING_TOGGLE", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing Toggle"));
-		Params.push_back(ShaderParam("HALATION", -1, 96, 4, 0.000000f, 1.000000f, 0.030000f, 0.010000f, "Halation"));
-		Params.push_back(ShaderParam("DIFFUSION", -1, 100, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Diffusion"));
-		Params.push_back(ShaderParam("BRIGHTNESS", -1, 104, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Brightness"));
-		Samplers.push_back(ShaderSampler("ORIG_LINEARIZED", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-easymode-halation";
+	VertexByteCode = RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ORIG_LINEARIZEDSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GAMMA_OUTPUT", -1, 32, 4, 0.100000f, 5.000000f, 2.200000f, 0.010000f, "Gamma Output"));
+	Params.push_back(ShaderParam("SHARPNESS_H", -1, 36, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Sharpness Horizontal"));
+	Params.push_back(ShaderParam("SHARPNESS_V", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Sharpness Vertical"));
+	Params.push_back(ShaderParam("MASK_TYPE", -1, 44, 4, 0.000000f, 7.000000f, 4.000000f, 1.000000f, "Mask Type"));
+	Params.push_back(ShaderParam("MASK_STRENGTH_MIN", -1, 48, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Mask Strength Min."));
+	Params.push_back(ShaderParam("MASK_STRENGTH_MAX", -1, 52, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Mask Strength Max."));
+	Params.push_back(ShaderParam("MASK_SIZE", -1, 56, 4, 1.000000f, 100.000000f, 1.000000f, 1.000000f, "Mask Size"));
+	Params.push_back(ShaderParam("SCANLINE_STRENGTH_MIN", -1, 60, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Scanline Strength Min."));
+	Params.push_back(ShaderParam("SCANLINE_STRENGTH_MAX", -1, 64, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Strength Max."));
+	Params.push_back(ShaderParam("SCANLINE_BEAM_MIN", -1, 68, 4, 0.250000f, 5.000000f, 1.000000f, 0.050000f, "Scanline Beam Min."));
+	Params.push_back(ShaderParam("SCANLINE_BEAM_MAX", -1, 72, 4, 0.250000f, 5.000000f, 1.000000f, 0.050000f, "Scanline Beam Max."));
+	Params.push_back(ShaderParam("GEOM_CURVATURE", -1, 76, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Geom Curvature"));
+	Params.push_back(ShaderParam("GEOM_WARP", -1, 80, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Geom Warp"));
+	Params.push_back(ShaderParam("GEOM_CORNER_SIZE", -1, 84, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Geom Corner Size"));
+	Params.push_back(ShaderParam("GEOM_CORNER_SMOOTH", -1, 88, 4, 50.000000f, 1000.000000f, 150.000000f, 25.000000f, "Geom Corner Smoothness"));
+	Params.push_back(ShaderParam("INTERLACING_TOGGLE", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing Toggle"));
+	Params.push_back(ShaderParam("HALATION", -1, 96, 4, 0.000000f, 1.000000f, 0.030000f, 0.010000f, "Halation"));
+	Params.push_back(ShaderParam("DIFFUSION", -1, 100, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Diffusion"));
+	Params.push_back(ShaderParam("BRIGHTNESS", -1, 104, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Brightness"));
+	Samplers.push_back(ShaderSampler("ORIG_LINEARIZED", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
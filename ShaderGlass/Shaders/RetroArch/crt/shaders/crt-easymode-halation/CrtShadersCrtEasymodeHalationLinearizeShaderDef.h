@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtEasymodeHalationLinearizeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtEasymodeHalationLinearizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -375,32 +386,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtEasymodeHalationLinearizeShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtEasymodeHalationLinearizeShaderDef::CrtShadersCrtEasymodeHalationLinearizeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtEasymodeHalationLinearizeShaderDef() : ShaderDef{}
-	{
-		Name = "linearize";
-		VertexByteCode = RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GAMMA_INPUT", -1, 52, 4, 0.100000f, 5.000000f, 2.400000f, 0.010000f, "Gamma Input"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "linearize";
+	VertexByteCode = RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtEasymodeHalationLinearizeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GAMMA_INPUT", -1, 52, 4, 0.100000f, 5.000000f, 2.400000f, 0.010000f, "Gamma Input"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -694,31 +705,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef::CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-interlaced-halation-pass0";
-		VertexByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-interlaced-halation-pass0";
+	VertexByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
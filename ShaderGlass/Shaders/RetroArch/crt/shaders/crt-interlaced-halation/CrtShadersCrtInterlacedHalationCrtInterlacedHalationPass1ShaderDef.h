@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -696,31 +707,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef::CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-interlaced-halation-pass1";
-		VertexByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-interlaced-halation-pass1";
+	VertexByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
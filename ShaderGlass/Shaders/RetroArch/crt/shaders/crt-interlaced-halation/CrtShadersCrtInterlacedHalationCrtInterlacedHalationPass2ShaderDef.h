@@ -99,6 +99,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1594,32 +1605,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef::CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-interlaced-halation-pass2";
-		VertexByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("crt_interlaced_halation_refpassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("crt_interlaced_halation_refpass", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-interlaced-halation-pass2";
+	VertexByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("crt_interlaced_halation_refpassSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("crt_interlaced_halation_refpass", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
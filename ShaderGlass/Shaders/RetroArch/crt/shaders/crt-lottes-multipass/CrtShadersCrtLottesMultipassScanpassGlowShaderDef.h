@@ -52,6 +52,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtLottesMultipassScanpassGlowShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtLottesMultipassScanpassGlowShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1439,47 +1450,41 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtLottesMultipassScanpassGlowShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtLottesMultipassScanpassGlowShaderDef::CrtShadersCrtLottesMultipassScanpassGlowShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtLottesMultipassScanpassGlowShaderDef() : ShaderDef{}
-	{
-		Name = "scanpass-glow";
-		VertexByteCode = RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hardScan", -1, 0, 4, -20.000000f, 0.000000f, -8.000000f, 1.000000f, "hardScan"));
-		Params.push_back(ShaderParam("hardPix", -1, 4, 4, -20.000000f, 0.000000f, -3.000000f, 1.000000f, "hardPix"));
-		Params.push_back(ShaderParam("warpX", -1, 8, 4, 0.000000f, 0.125000f, 0.031000f, 0.010000f, "warpX"));
-		Params.push_back(ShaderParam("warpY", -1, 12, 4, 0.000000f, 0.125000f, 0.041000f, 0.010000f, "warpY"));
-		Params.push_back(ShaderParam("maskDark", -1, 16, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "maskDark"));
-		Params.push_back(ShaderParam("maskLight", -1, 20, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "maskLight"));
-		Params.push_back(ShaderParam("scaleInLinearGamma", -1, 24, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "scaleInLinearGamma"));
-		Params.push_back(ShaderParam("shadowMask", -1, 28, 4, 0.000000f, 4.000000f, 3.000000f, 1.000000f, "shadowMask"));
-		Params.push_back(ShaderParam("brightBoost", -1, 32, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "brightness boost"));
-		Params.push_back(ShaderParam("hardBloomScan", -1, 36, 4, -4.000000f, -1.000000f, -2.000000f, 0.100000f, "bloom-y soft"));
-		Params.push_back(ShaderParam("hardBloomPix", -1, 40, 4, -2.000000f, -0.500000f, -1.500000f, 0.100000f, "bloom-x soft"));
-		Params.push_back(ShaderParam("bloomAmount", -1, 44, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "bloom amount"));
-		Params.push_back(ShaderParam("shape", -1, 48, 4, 0.000000f, 10.000000f, 2.000000f, 0.050000f, "filter kernel shape"));
-		Params.push_back(ShaderParam("DIFFUSION", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Diffusion"));
-		Samplers.push_back(ShaderSampler("ORIG_LINEARIZED", 3));
-		Samplers.push_back(ShaderSampler("GlowPass", 5));
-		Samplers.push_back(ShaderSampler("BloomPass", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scanpass-glow";
+	VertexByteCode = RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtLottesMultipassScanpassGlowShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hardScan", -1, 0, 4, -20.000000f, 0.000000f, -8.000000f, 1.000000f, "hardScan"));
+	Params.push_back(ShaderParam("hardPix", -1, 4, 4, -20.000000f, 0.000000f, -3.000000f, 1.000000f, "hardPix"));
+	Params.push_back(ShaderParam("warpX", -1, 8, 4, 0.000000f, 0.125000f, 0.031000f, 0.010000f, "warpX"));
+	Params.push_back(ShaderParam("warpY", -1, 12, 4, 0.000000f, 0.125000f, 0.041000f, 0.010000f, "warpY"));
+	Params.push_back(ShaderParam("maskDark", -1, 16, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "maskDark"));
+	Params.push_back(ShaderParam("maskLight", -1, 20, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "maskLight"));
+	Params.push_back(ShaderParam("scaleInLinearGamma", -1, 24, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "scaleInLinearGamma"));
+	Params.push_back(ShaderParam("shadowMask", -1, 28, 4, 0.000000f, 4.000000f, 3.000000f, 1.000000f, "shadowMask"));
+	Params.push_back(ShaderParam("brightBoost", -1, 32, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "brightness boost"));
+	Params.push_back(ShaderParam("hardBloomScan", -1, 36, 4, -4.000000f, -1.000000f, -2.000000f, 0.100000f, "bloom-y soft"));
+	Params.push_back(ShaderParam("hardBloomPix", -1, 40, 4, -2.000000f, -0.500000f, -1.500000f, 0.100000f, "bloom-x soft"));
+	Params.push_back(ShaderParam("bloomAmount", -1, 44, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "bloom amount"));
+	Params.push_back(ShaderParam("shape", -1, 48, 4, 0.000000f, 10.000000f, 2.000000f, 0.050000f, "filter kernel shape"));
+	Params.push_back(ShaderParam("DIFFUSION", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Diffusion"));
+	Samplers.push_back(ShaderSampler("ORIG_LINEARIZED", 3));
+	Samplers.push_back(ShaderSampler("GlowPass", 5));
+	Samplers.push_back(ShaderSampler("BloomPass", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
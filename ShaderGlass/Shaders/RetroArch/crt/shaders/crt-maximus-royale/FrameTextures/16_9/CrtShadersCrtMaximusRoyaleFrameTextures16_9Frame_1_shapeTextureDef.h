@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDefs
 {
 const BYTE sData[] =
@@ -1801,13 +1809,10 @@ const BYTE sData[] =
 ,198,41,166,103,119,219,59,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef() : TextureDef{}
-	{
-		Name = "frame_1_shape.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDefs::sData);
-	}
-};
+	Name = "frame_1_shape.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDefs::sData);
+}
+#endif
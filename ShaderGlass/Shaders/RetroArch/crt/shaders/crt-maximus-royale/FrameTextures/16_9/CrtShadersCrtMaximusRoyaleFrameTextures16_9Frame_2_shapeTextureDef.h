@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDefs
 {
 const BYTE sData[] =
@@ -2173,13 +2181,10 @@ const BYTE sData[] =
 ,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef() : TextureDef{}
-	{
-		Name = "frame_2_shape.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDefs::sData);
-	}
-};
+	Name = "frame_2_shape.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDefs
 {
 const BYTE sData[] =
@@ -9986,13 +9994,10 @@ const BYTE sData[] =
 ,186,158,93,172,79,241,62,251,124,249,183,2,45,1,0,195,2,27,60,125,166,73,178,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef() : TextureDef{}
-	{
-		Name = "MONITOR_frame.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDefs::sData);
-	}
-};
+	Name = "MONITOR_frame.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDefs::sData);
+}
+#endif
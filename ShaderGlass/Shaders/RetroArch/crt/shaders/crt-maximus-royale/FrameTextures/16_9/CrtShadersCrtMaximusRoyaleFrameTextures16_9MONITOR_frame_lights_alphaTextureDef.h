@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDefs
 {
 const BYTE sData[] =
@@ -741,13 +749,10 @@ const BYTE sData[] =
 ,144,16,88,96,34,49,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef() : TextureDef{}
-	{
-		Name = "MONITOR_frame_lights_alpha.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDefs::sData);
-	}
-};
+	Name = "MONITOR_frame_lights_alpha.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDefs
 {
 const BYTE sData[] =
@@ -2937,13 +2945,10 @@ const BYTE sData[] =
 ,77,104,197,25,112,58,240,120,49,112,241,2,22,241,254,6,100,69,69,86,46,214,119,2,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef() : TextureDef{}
-	{
-		Name = "TV_frame_1.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDefs::sData);
-	}
-};
+	Name = "TV_frame_1.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDefs
 {
 const BYTE sData[] =
@@ -1544,13 +1552,10 @@ const BYTE sData[] =
 ,226,110,122,9,29,189,240,104,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef() : TextureDef{}
-	{
-		Name = "TV_frame_2.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDefs::sData);
-	}
-};
+	Name = "TV_frame_2.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDefs
 {
 const BYTE sData[] =
@@ -3088,13 +3096,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef() : TextureDef{}
-	{
-		Name = "TV_frame_2_led.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDefs::sData);
-	}
-};
+	Name = "TV_frame_2_led.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDefs
 {
 const BYTE sData[] =
@@ -2141,13 +2149,10 @@ const BYTE sData[] =
 ,206,212,15,230,94,164,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef() : TextureDef{}
-	{
-		Name = "TV_frame_3.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDefs::sData);
-	}
-};
+	Name = "TV_frame_3.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDefs
 {
 const BYTE sData[] =
@@ -2521,13 +2529,10 @@ const BYTE sData[] =
 ,227,174,150,49,252,2,75,167,231,92,160,123,68,7,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef() : TextureDef{}
-	{
-		Name = "TV_frame_3_bg.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDefs::sData);
-	}
-};
+	Name = "TV_frame_3_bg.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDefs::sData);
+}
+#endif
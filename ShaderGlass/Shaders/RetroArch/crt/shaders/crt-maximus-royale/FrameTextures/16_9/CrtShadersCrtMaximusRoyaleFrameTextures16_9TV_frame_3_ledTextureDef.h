@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDefs
 {
 const BYTE sData[] =
@@ -2975,13 +2983,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef::CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef() : TextureDef{}
-	{
-		Name = "TV_frame_3_led.png";
-		Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDefs::sData);
-	}
-};
+	Name = "TV_frame_3_led.png";
+	Data = CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDefs::sData);
+}
+#endif
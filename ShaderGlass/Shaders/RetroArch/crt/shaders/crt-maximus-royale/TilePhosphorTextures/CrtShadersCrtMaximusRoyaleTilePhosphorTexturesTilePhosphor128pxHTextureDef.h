@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDefs
 {
 const BYTE sData[] =
@@ -219,13 +227,10 @@ const BYTE sData[] =
 ,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphor128pxH.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphor128pxH.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDefs
 {
 const BYTE sData[] =
@@ -221,13 +229,10 @@ const BYTE sData[] =
 ,120,76,149,247,234,14,238,152,63,148,66,234,213,4,147,4,255,7,24,119,150,183,63,161,78,75,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphor128px.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphor128px.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDefs
 {
 const BYTE sData[] =
@@ -1685,13 +1693,10 @@ const BYTE sData[] =
 ,243,156,241,242,16,233,226,27,24,41,143,245,27,1,48,2,224,47,19,220,123,7,237,90,179,64,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphor512pxH.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphor512pxH.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDefs
 {
 const BYTE sData[] =
@@ -2901,13 +2909,10 @@ const BYTE sData[] =
 ,66,23,193,221,71,163,107,79,6,253,23,54,243,119,32,164,12,196,165,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphor512px.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphor512px.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDefs::sData);
+}
+#endif
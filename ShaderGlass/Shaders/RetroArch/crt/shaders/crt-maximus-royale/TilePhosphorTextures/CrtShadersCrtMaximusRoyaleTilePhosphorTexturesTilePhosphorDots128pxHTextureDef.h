@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDefs
 {
 const BYTE sData[] =
@@ -214,13 +222,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorDots128pxH.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorDots128pxH.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDefs::sData);
+}
+#endif
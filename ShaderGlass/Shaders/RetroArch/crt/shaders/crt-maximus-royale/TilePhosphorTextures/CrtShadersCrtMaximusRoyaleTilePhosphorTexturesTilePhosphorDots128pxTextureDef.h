@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDefs
 {
 const BYTE sData[] =
@@ -195,13 +203,10 @@ const BYTE sData[] =
 ,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorDots128px.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorDots128px.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDefs::sData);
+}
+#endif
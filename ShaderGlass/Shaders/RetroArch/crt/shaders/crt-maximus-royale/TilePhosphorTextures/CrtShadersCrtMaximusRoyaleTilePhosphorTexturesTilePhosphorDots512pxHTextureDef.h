@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDefs
 {
 const BYTE sData[] =
@@ -2534,13 +2542,10 @@ const BYTE sData[] =
 ,128,11,16,68,105,10,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorDots512pxH.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorDots512pxH.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDefs::sData);
+}
+#endif
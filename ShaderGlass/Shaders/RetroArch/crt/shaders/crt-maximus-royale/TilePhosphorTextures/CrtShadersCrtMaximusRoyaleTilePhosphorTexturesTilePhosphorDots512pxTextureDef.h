@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDefs
 {
 const BYTE sData[] =
@@ -2564,13 +2572,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorDots512px.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorDots512px.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDefs::sData);
+}
+#endif
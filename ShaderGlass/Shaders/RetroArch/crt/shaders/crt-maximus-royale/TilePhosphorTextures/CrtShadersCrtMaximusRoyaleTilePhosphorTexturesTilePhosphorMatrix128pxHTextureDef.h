@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDefs
 {
 const BYTE sData[] =
@@ -287,13 +295,10 @@ const BYTE sData[] =
 ,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorMatrix128pxH.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorMatrix128pxH.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDefs
 {
 const BYTE sData[] =
@@ -2915,13 +2923,10 @@ const BYTE sData[] =
 ,7,0,96,20,37,0,224,250,84,0,48,51,157,0,208,201,0,248,19,30,197,83,76,24,49,97,0,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorMatrix512pxH.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorMatrix512pxH.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDefs
 {
 const BYTE sData[] =
@@ -2953,13 +2961,10 @@ const BYTE sData[] =
 ,21,24,13,196,40,117,163,19,248,39,253,113,157,246,0,204,252,164,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef : public TextureDef
+CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef::CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef() : TextureDef{}
-	{
-		Name = "TilePhosphorMatrix512px.png";
-		Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDefs::sData);
-	}
-};
+	Name = "TilePhosphorMatrix512px.png";
+	Data = CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDefs::sData);
+}
+#endif
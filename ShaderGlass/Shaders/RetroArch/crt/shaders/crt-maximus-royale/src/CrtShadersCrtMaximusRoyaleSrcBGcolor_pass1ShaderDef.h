@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -403,29 +414,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef::CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef() : ShaderDef{}
-	{
-		Name = "BGcolor_pass1";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bgMode", -1, 0, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "BG Mode"));
-		Params.push_back(ShaderParam("ledMode", -1, 4, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Rear TV LED Mode"));
-		Samplers.push_back(ShaderSampler("maximus_refpass", 2));
+	Name = "BGcolor_pass1";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bgMode", -1, 0, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "BG Mode"));
+	Params.push_back(ShaderParam("ledMode", -1, 4, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Rear TV LED Mode"));
+	Samplers.push_back(ShaderSampler("maximus_refpass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
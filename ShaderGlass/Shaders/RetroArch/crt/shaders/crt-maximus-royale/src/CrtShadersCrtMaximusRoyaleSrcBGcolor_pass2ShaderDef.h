@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -399,29 +410,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef::CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef() : ShaderDef{}
-	{
-		Name = "BGcolor_pass2";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bgMode", -1, 0, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "BG Mode"));
-		Params.push_back(ShaderParam("ledMode", -1, 4, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Rear TV LED Mode"));
-		Samplers.push_back(ShaderSampler("BGPASS1", 2));
+	Name = "BGcolor_pass2";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bgMode", -1, 0, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "BG Mode"));
+	Params.push_back(ShaderParam("ledMode", -1, 4, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Rear TV LED Mode"));
+	Samplers.push_back(ShaderSampler("BGPASS1", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
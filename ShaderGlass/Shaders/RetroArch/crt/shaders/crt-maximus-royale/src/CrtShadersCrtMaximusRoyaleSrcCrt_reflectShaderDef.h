@@ -28,6 +28,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -791,31 +802,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef::CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef() : ShaderDef{}
-	{
-		Name = "crt_reflect";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("crtFrame", -1, 0, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
-		Params.push_back(ShaderParam("Xscale", -1, 4, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Horizontal Scale %"));
-		Params.push_back(ShaderParam("Yscale", -1, 8, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Vertical Scale %"));
-		Samplers.push_back(ShaderSampler("maximus_refpass", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt_reflect";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("crtFrame", -1, 0, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
+	Params.push_back(ShaderParam("Xscale", -1, 4, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Horizontal Scale %"));
+	Params.push_back(ShaderParam("Yscale", -1, 8, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Vertical Scale %"));
+	Samplers.push_back(ShaderSampler("maximus_refpass", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
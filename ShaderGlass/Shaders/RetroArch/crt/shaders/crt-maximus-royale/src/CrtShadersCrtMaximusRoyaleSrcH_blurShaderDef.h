@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -397,28 +408,22 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef::CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef() : ShaderDef{}
-	{
-		Name = "H_blur";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Hsharpness", -1, 0, 4, 1.000000f, 20.000000f, 10.000000f, 0.500000f, "Horizontal Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "H_blur";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcH_blurShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Hsharpness", -1, 0, 4, 1.000000f, 20.000000f, 10.000000f, 0.500000f, "Horizontal Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -573,30 +584,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef::CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef() : ShaderDef{}
-	{
-		Name = "horizontal_ringing";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ringAct", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Ringing On"));
-		Params.push_back(ShaderParam("ringDsp", -1, 4, 4, 0.000000f, 3.000000f, 3.000000f, 0.100000f, "Ringing Displace"));
-		Params.push_back(ShaderParam("ringInt", -1, 8, 4, 0.000000f, 10.000000f, 5.000000f, 0.500000f, "Ringing Intensity"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "horizontal_ringing";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ringAct", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Ringing On"));
+	Params.push_back(ShaderParam("ringDsp", -1, 4, 4, 0.000000f, 3.000000f, 3.000000f, 0.100000f, "Ringing Displace"));
+	Params.push_back(ShaderParam("ringInt", -1, 8, 4, 0.000000f, 10.000000f, 5.000000f, 0.500000f, "Ringing Intensity"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -29,6 +29,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1445,51 +1456,45 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef::CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef() : ShaderDef{}
-	{
-		Name = "imgborder";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 80, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("crtFrame", -1, 0, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
-		Params.push_back(ShaderParam("bgMode", -1, 4, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "BG Mode"));
-		Params.push_back(ShaderParam("bgR", -1, 8, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "BG Red"));
-		Params.push_back(ShaderParam("bgG", -1, 12, 4, 0.000000f, 100.000000f, 25.000000f, 1.000000f, "BG Green"));
-		Params.push_back(ShaderParam("bgB", -1, 16, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "BG Blue"));
-		Params.push_back(ShaderParam("ledMode", -1, 20, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Rear TV LED Mode"));
-		Params.push_back(ShaderParam("ledR", -1, 24, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Red"));
-		Params.push_back(ShaderParam("ledG", -1, 28, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Green"));
-		Params.push_back(ShaderParam("ledB", -1, 32, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Blue"));
-		Params.push_back(ShaderParam("ledSpeed", -1, 36, 4, 1.000000f, 20.000000f, 1.000000f, 1.000000f, "LED Speed"));
-		Params.push_back(ShaderParam("ledBrightness", -1, 40, 4, 1.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Brightness"));
-		Samplers.push_back(ShaderSampler("LAST_PASS", 13));
-		Samplers.push_back(ShaderSampler("TVBORDER1", 3));
-		Samplers.push_back(ShaderSampler("BGPASS2", 2));
-		Samplers.push_back(ShaderSampler("TVBORDER2", 4));
-		Samplers.push_back(ShaderSampler("TVBORDER2BG", 6));
-		Samplers.push_back(ShaderSampler("TVBORDER2LED", 8));
-		Samplers.push_back(ShaderSampler("TVBORDER3", 5));
-		Samplers.push_back(ShaderSampler("TVBORDER3BG", 7));
-		Samplers.push_back(ShaderSampler("TVBORDER3LED", 9));
-		Samplers.push_back(ShaderSampler("SHAPE2", 12));
-		Samplers.push_back(ShaderSampler("SHAPE1", 11));
-		Samplers.push_back(ShaderSampler("MONITORBORDER", 10));
+	Name = "imgborder";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcImgborderShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 80, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("crtFrame", -1, 0, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
+	Params.push_back(ShaderParam("bgMode", -1, 4, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "BG Mode"));
+	Params.push_back(ShaderParam("bgR", -1, 8, 4, 0.000000f, 100.000000f, 0.000000f, 1.000000f, "BG Red"));
+	Params.push_back(ShaderParam("bgG", -1, 12, 4, 0.000000f, 100.000000f, 25.000000f, 1.000000f, "BG Green"));
+	Params.push_back(ShaderParam("bgB", -1, 16, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "BG Blue"));
+	Params.push_back(ShaderParam("ledMode", -1, 20, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Rear TV LED Mode"));
+	Params.push_back(ShaderParam("ledR", -1, 24, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Red"));
+	Params.push_back(ShaderParam("ledG", -1, 28, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Green"));
+	Params.push_back(ShaderParam("ledB", -1, 32, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Blue"));
+	Params.push_back(ShaderParam("ledSpeed", -1, 36, 4, 1.000000f, 20.000000f, 1.000000f, 1.000000f, "LED Speed"));
+	Params.push_back(ShaderParam("ledBrightness", -1, 40, 4, 1.000000f, 100.000000f, 50.000000f, 1.000000f, "LED Brightness"));
+	Samplers.push_back(ShaderSampler("LAST_PASS", 13));
+	Samplers.push_back(ShaderSampler("TVBORDER1", 3));
+	Samplers.push_back(ShaderSampler("BGPASS2", 2));
+	Samplers.push_back(ShaderSampler("TVBORDER2", 4));
+	Samplers.push_back(ShaderSampler("TVBORDER2BG", 6));
+	Samplers.push_back(ShaderSampler("TVBORDER2LED", 8));
+	Samplers.push_back(ShaderSampler("TVBORDER3", 5));
+	Samplers.push_back(ShaderSampler("TVBORDER3BG", 7));
+	Samplers.push_back(ShaderSampler("TVBORDER3LED", 9));
+	Samplers.push_back(ShaderSampler("SHAPE2", 12));
+	Samplers.push_back(ShaderSampler("SHAPE1", 11));
+	Samplers.push_back(ShaderSampler("MONITORBORDER", 10));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -812,35 +823,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef::CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc_pass1";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("h2x", -1, 0, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Horizontal Scale"));
-		Params.push_back(ShaderParam("CVBS_SVIDEO_RGB", -1, 4, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "CVBS - SVIDEO - RGB"));
-		Params.push_back(ShaderParam("CVBS_RES", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "CVBS Intensity"));
-		Params.push_back(ShaderParam("CVBS_PHASE", -1, 12, 4, 2.000000f, 4.000000f, 3.000000f, 1.000000f, "CVBS Phase"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc_pass1";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("h2x", -1, 0, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Horizontal Scale"));
+	Params.push_back(ShaderParam("CVBS_SVIDEO_RGB", -1, 4, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "CVBS - SVIDEO - RGB"));
+	Params.push_back(ShaderParam("CVBS_RES", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "CVBS Intensity"));
+	Params.push_back(ShaderParam("CVBS_PHASE", -1, 12, 4, 2.000000f, 4.000000f, 3.000000f, 1.000000f, "CVBS Phase"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
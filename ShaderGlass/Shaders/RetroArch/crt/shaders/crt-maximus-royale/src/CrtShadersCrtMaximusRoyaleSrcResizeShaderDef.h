@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcResizeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcResizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -400,30 +411,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcResizeShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcResizeShaderDef::CrtShadersCrtMaximusRoyaleSrcResizeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcResizeShaderDef() : ShaderDef{}
-	{
-		Name = "resize";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Xscale", -1, 0, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Horizontal Scale %"));
-		Params.push_back(ShaderParam("Yscale", -1, 4, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Vertical Scale %"));
-		Params.push_back(ShaderParam("crtFrame", -1, 8, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "resize";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcResizeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Xscale", -1, 0, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Horizontal Scale %"));
+	Params.push_back(ShaderParam("Yscale", -1, 4, 4, 75.000000f, 150.000000f, 100.000000f, 0.100000f, "Vertical Scale %"));
+	Params.push_back(ShaderParam("crtFrame", -1, 8, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -29,6 +29,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1894,35 +1905,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef::CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef() : ShaderDef{}
-	{
-		Name = "tv_reflection";
-		VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("OutputSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MVP", 0, 16, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("crtFrame", -1, 0, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
-		Params.push_back(ShaderParam("crtReflection", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT Reflection"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("TVLIGHTS1", 4));
-		Samplers.push_back(ShaderSampler("TVLIGHTS3", 5));
-		Samplers.push_back(ShaderSampler("MONITORLIGHTS", 6));
-		Samplers.push_back(ShaderSampler("BORDER_REFLECTION", 7));
-		Samplers.push_back(ShaderSampler("Original", 3));
+	Name = "tv_reflection";
+	VertexByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("OutputSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MVP", 0, 16, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("crtFrame", -1, 0, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Frame"));
+	Params.push_back(ShaderParam("crtReflection", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT Reflection"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("TVLIGHTS1", 4));
+	Samplers.push_back(ShaderSampler("TVLIGHTS3", 5));
+	Samplers.push_back(ShaderSampler("MONITORLIGHTS", 6));
+	Samplers.push_back(ShaderSampler("BORDER_REFLECTION", 7));
+	Samplers.push_back(ShaderSampler("Original", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
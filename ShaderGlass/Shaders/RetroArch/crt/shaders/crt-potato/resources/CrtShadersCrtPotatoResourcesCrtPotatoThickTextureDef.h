@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,87,24,170,30,150,109,75,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef : public TextureDef
+CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef::CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef() : TextureDef{}
-	{
-		Name = "crt-potato-thick.png";
-		Data = CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDefs::sData);
-	}
-};
+	Name = "crt-potato-thick.png";
+	Data = CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,119,2,0,166,143,24,97,79,78,61,146,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef : public TextureDef
+CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef::CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef() : TextureDef{}
-	{
-		Name = "crt-potato-thin.png";
-		Data = CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDefs::sData);
-	}
-};
+	Name = "crt-potato-thin.png";
+	Data = CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDefs::sData);
+}
+#endif
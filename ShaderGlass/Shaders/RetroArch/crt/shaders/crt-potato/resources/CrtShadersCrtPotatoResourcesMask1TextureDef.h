@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtPotatoResourcesMask1TextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtPotatoResourcesMask1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtPotatoResourcesMask1TextureDefs
 {
 const BYTE sData[] =
@@ -35,13 +43,10 @@ const BYTE sData[] =
 ,174,66,96,130};
 }
 
-class CrtShadersCrtPotatoResourcesMask1TextureDef : public TextureDef
+CrtShadersCrtPotatoResourcesMask1TextureDef::CrtShadersCrtPotatoResourcesMask1TextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtPotatoResourcesMask1TextureDef() : TextureDef{}
-	{
-		Name = "mask1.png";
-		Data = CrtShadersCrtPotatoResourcesMask1TextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtPotatoResourcesMask1TextureDefs::sData);
-	}
-};
+	Name = "mask1.png";
+	Data = CrtShadersCrtPotatoResourcesMask1TextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtPotatoResourcesMask1TextureDefs::sData);
+}
+#endif
@@ -31,6 +31,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -542,32 +553,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef::CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef() : ShaderDef{}
-	{
-		Name = "crt-potato";
-		VertexByteCode = RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("MASK", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-potato";
+	VertexByteCode = RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesCrtPotatoShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("MASK", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -555,32 +566,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef::CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef() : ShaderDef{}
-	{
-		Name = "ultra_potato";
-		VertexByteCode = RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("MASK", 3));
+	Name = "ultra_potato";
+	VertexByteCode = RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtPotatoShaderFilesUltra_potatoShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("MASK", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDefs
 {
 const BYTE sData[] =
@@ -143,13 +151,10 @@ const BYTE sData[] =
 ,225,11,202,70,101,32,96,190,114,89,251,56,157,78,255,15,115,224,47,236,136,58,159,154,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef : public TextureDef
+CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef::CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef() : TextureDef{}
-	{
-		Name = "TileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGR.png";
-		Data = CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDefs::sData);
-	}
-};
+	Name = "TileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGR.png";
+	Data = CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDefs
 {
 const BYTE sData[] =
@@ -4505,13 +4513,10 @@ const BYTE sData[] =
 ,205,255,93,115,38,219,190,252,255,31,194,18,151,31,67,123,39,151,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef : public TextureDef
+CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef::CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef() : TextureDef{}
-	{
-		Name = "TileableLinearApertureGrille15Wide8And5d5Spacing.png";
-		Data = CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDefs::sData);
-	}
-};
+	Name = "TileableLinearApertureGrille15Wide8And5d5Spacing.png";
+	Data = CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDefs
 {
 const BYTE sData[] =
@@ -115,13 +123,10 @@ const BYTE sData[] =
 ,16,9,65,61,171,31,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef : public TextureDef
+CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef::CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef() : TextureDef{}
-	{
-		Name = "TileableLinearShadowMaskEDPResizeTo64.png";
-		Data = CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDefs::sData);
-	}
-};
+	Name = "TileableLinearShadowMaskEDPResizeTo64.png";
+	Data = CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDefs::sData);
+}
+#endif
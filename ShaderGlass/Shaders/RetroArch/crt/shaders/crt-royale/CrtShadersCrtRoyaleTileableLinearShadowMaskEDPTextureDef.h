@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDefs
 {
 const BYTE sData[] =
@@ -4571,13 +4579,10 @@ const BYTE sData[] =
 ,198,206,153,156,60,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef : public TextureDef
+CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef::CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef() : TextureDef{}
-	{
-		Name = "TileableLinearShadowMaskEDP.png";
-		Data = CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDefs::sData);
-	}
-};
+	Name = "TileableLinearShadowMaskEDP.png";
+	Data = CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDefs::sData);
+}
+#endif
@@ -317,6 +317,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1888,65 +1899,59 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef::CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef() : ShaderDef{}
-	{
-		Name = "crt-royale-bloom-horizontal-reconstitute";
-		VertexByteCode = RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("crt_gamma", 0, 64, 4, 1.000000f, 5.000000f, 2.400000f, 0.025000f, "Simulated CRT Gamma"));
-		Params.push_back(ShaderParam("lcd_gamma", 0, 68, 4, 1.000000f, 5.000000f, 2.400000f, 0.025000f, "Your Display Gamma"));
-		Params.push_back(ShaderParam("levels_contrast", 0, 72, 4, 0.000000f, 4.000000f, 0.671875f, 0.015625f, "Contrast"));
-		Params.push_back(ShaderParam("bloom_underestimate_levels", 0, 76, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Bloom - Underestimate Levels"));
-		Params.push_back(ShaderParam("bloom_excess", 0, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Bloom - Excess"));
-		Params.push_back(ShaderParam("beam_min_sigma", 0, 84, 4, 0.005000f, 1.000000f, 0.055000f, 0.005000f, "Beam - Min Sigma"));
-		Params.push_back(ShaderParam("beam_max_sigma", 0, 88, 4, 0.005000f, 1.000000f, 0.200000f, 0.005000f, "Beam - Max Sigma"));
-		Params.push_back(ShaderParam("beam_spot_power", 0, 92, 4, 0.010000f, 16.000000f, 0.380000f, 0.010000f, "Beam - Spot Power"));
-		Params.push_back(ShaderParam("beam_min_shape", 0, 96, 4, 2.000000f, 32.000000f, 2.000000f, 0.100000f, "Beam - Min Shape"));
-		Params.push_back(ShaderParam("beam_max_shape", 0, 100, 4, 2.000000f, 32.000000f, 2.000000f, 0.100000f, "Beam - Max Shape"));
-		Params.push_back(ShaderParam("beam_shape_power", 0, 104, 4, 0.010000f, 16.000000f, 0.250000f, 0.010000f, "Beam - Shape Power"));
-		Params.push_back(ShaderParam("beam_horiz_filter", 0, 108, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Beam - Horiz Filter"));
-		Params.push_back(ShaderParam("beam_horiz_sigma", 0, 112, 4, 0.000000f, 0.670000f, 0.350000f, 0.005000f, "Beam - Horiz Sigma"));
-		Params.push_back(ShaderParam("beam_horiz_linear_rgb_weight", 0, 116, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Beam - Horiz Linear RGB Weight"));
-		Params.push_back(ShaderParam("convergence_offset_x_r", 0, 120, 4, -4.000000f, 4.000000f, 0.000000f, 0.050000f, "Convergence - Offset X Red"));
-		Params.push_back(ShaderParam("convergence_offset_x_g", 0, 124, 4, -4.000000f, 4.000000f, 0.000000f, 0.050000f, "Convergence - Offset X Green"));
-		Params.push_back(ShaderParam("convergence_offset_x_b", 0, 128, 4, -4.000000f, 4.000000f, 0.000000f, 0.050000f, "Convergence - Offset X Blue"));
-		Params.push_back(ShaderParam("convergence_offset_y_r", 0, 132, 4, -2.000000f, 2.000000f, 0.050000f, 0.050000f, "Convergence - Offset Y Red"));
-		Params.push_back(ShaderParam("convergence_offset_y_g", 0, 136, 4, -2.000000f, 2.000000f, -0.050000f, 0.050000f, "Convergence - Offset Y Green"));
-		Params.push_back(ShaderParam("convergence_offset_y_b", 0, 140, 4, -2.000000f, 2.000000f, 0.050000f, 0.050000f, "Convergence - Offset Y Blue"));
-		Params.push_back(ShaderParam("mask_type", 0, 144, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Mask - Type"));
-		Params.push_back(ShaderParam("mask_num_triads_desired", 0, 148, 4, 342.000000f, 1920.000000f, 480.000000f, 1.000000f, "Mask - Number of Triads Desired"));
-		Params.push_back(ShaderParam("mask_triad_size_desired", 0, 152, 4, 1.000000f, 18.000000f, 3.000000f, 0.125000f, "Mask - Triad Size Desired"));
-		Params.push_back(ShaderParam("mask_specify_num_triads", 0, 156, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask - Specify Number of Triads"));
-		Params.push_back(ShaderParam("aa_subpixel_r_offset_x_runtime", 0, 160, 4, -0.333333f, 0.333333f, -0.333333f, 0.333333f, "AA - Subpixel R Offset X"));
-		Params.push_back(ShaderParam("aa_subpixel_r_offset_y_runtime", 0, 164, 4, -0.333333f, 0.333333f, 0.000000f, 0.333333f, "AA - Subpixel R Offset Y"));
-		Params.push_back(ShaderParam("aa_cubic_c", 0, 168, 4, 0.000000f, 4.000000f, 0.500000f, 0.015625f, "AA - Cubic Sharpness"));
-		Params.push_back(ShaderParam("aa_gauss_sigma", 0, 172, 4, 0.062500f, 1.000000f, 0.500000f, 0.015625f, "AA - Gaussian Sigma"));
-		Params.push_back(ShaderParam("interlace_bff", 0, 176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing - Bottom Field First"));
-		Params.push_back(ShaderParam("interlace_1080i", 0, 180, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlace - Detect 1080i"));
-		Params.push_back(ShaderParam("interlace_detect_toggle", 0, 184, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing - Toggle"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MASKED_SCANLINESSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BRIGHTPASSSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("MASKED_SCANLINES", 4));
-		Samplers.push_back(ShaderSampler("BRIGHTPASS", 3));
+	Name = "crt-royale-bloom-horizontal-reconstitute";
+	VertexByteCode = RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("crt_gamma", 0, 64, 4, 1.000000f, 5.000000f, 2.400000f, 0.025000f, "Simulated CRT Gamma"));
+	Params.push_back(ShaderParam("lcd_gamma", 0, 68, 4, 1.000000f, 5.000000f, 2.400000f, 0.025000f, "Your Display Gamma"));
+	Params.push_back(ShaderParam("levels_contrast", 0, 72, 4, 0.000000f, 4.000000f, 0.671875f, 0.015625f, "Contrast"));
+	Params.push_back(ShaderParam("bloom_underestimate_levels", 0, 76, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Bloom - Underestimate Levels"));
+	Params.push_back(ShaderParam("bloom_excess", 0, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Bloom - Excess"));
+	Params.push_back(ShaderParam("beam_min_sigma", 0, 84, 4, 0.005000f, 1.000000f, 0.055000f, 0.005000f, "Beam - Min Sigma"));
+	Params.push_back(ShaderParam("beam_max_sigma", 0, 88, 4, 0.005000f, 1.000000f, 0.200000f, 0.005000f, "Beam - Max Sigma"));
+	Params.push_back(ShaderParam("beam_spot_power", 0, 92, 4, 0.010000f, 16.000000f, 0.380000f, 0.010000f, "Beam - Spot Power"));
+	Params.push_back(ShaderParam("beam_min_shape", 0, 96, 4, 2.000000f, 32.000000f, 2.000000f, 0.100000f, "Beam - Min Shape"));
+	Params.push_back(ShaderParam("beam_max_shape", 0, 100, 4, 2.000000f, 32.000000f, 2.000000f, 0.100000f, "Beam - Max Shape"));
+	Params.push_back(ShaderParam("beam_shape_power", 0, 104, 4, 0.010000f, 16.000000f, 0.250000f, 0.010000f, "Beam - Shape Power"));
+	Params.push_back(ShaderParam("beam_horiz_filter", 0, 108, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Beam - Horiz Filter"));
+	Params.push_back(ShaderParam("beam_horiz_sigma", 0, 112, 4, 0.000000f, 0.670000f, 0.350000f, 0.005000f, "Beam - Horiz Sigma"));
+	Params.push_back(ShaderParam("beam_horiz_linear_rgb_weight", 0, 116, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Beam - Horiz Linear RGB Weight"));
+	Params.push_back(ShaderParam("convergence_offset_x_r", 0, 120, 4, -4.000000f, 4.000000f, 0.000000f, 0.050000f, "Convergence - Offset X Red"));
+	Params.push_back(ShaderParam("convergence_offset_x_g", 0, 124, 4, -4.000000f, 4.000000f, 0.000000f, 0.050000f, "Convergence - Offset X Green"));
+	Params.push_back(ShaderParam("convergence_offset_x_b", 0, 128, 4, -4.000000f, 4.000000f, 0.000000f, 0.050000f, "Convergence - Offset X Blue"));
+	Params.push_back(ShaderParam("convergence_offset_y_r", 0, 132, 4, -2.000000f, 2.000000f, 0.050000f, 0.050000f, "Convergence - Offset Y Red"));
+	Params.push_back(ShaderParam("convergence_offset_y_g", 0, 136, 4, -2.000000f, 2.000000f, -0.050000f, 0.050000f, "Convergence - Offset Y Green"));
+	Params.push_back(ShaderParam("convergence_offset_y_b", 0, 140, 4, -2.000000f, 2.000000f, 0.050000f, 0.050000f, "Convergence - Offset Y Blue"));
+	Params.push_back(ShaderParam("mask_type", 0, 144, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Mask - Type"));
+	Params.push_back(ShaderParam("mask_num_triads_desired", 0, 148, 4, 342.000000f, 1920.000000f, 480.000000f, 1.000000f, "Mask - Number of Triads Desired"));
+	Params.push_back(ShaderParam("mask_triad_size_desired", 0, 152, 4, 1.000000f, 18.000000f, 3.000000f, 0.125000f, "Mask - Triad Size Desired"));
+	Params.push_back(ShaderParam("mask_specify_num_triads", 0, 156, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask - Specify Number of Triads"));
+	Params.push_back(ShaderParam("aa_subpixel_r_offset_x_runtime", 0, 160, 4, -0.333333f, 0.333333f, -0.333333f, 0.333333f, "AA - Subpixel R Offset X"));
+	Params.push_back(ShaderParam("aa_subpixel_r_offset_y_runtime", 0, 164, 4, -0.333333f, 0.333333f, 0.000000f, 0.333333f, "AA - Subpixel R Offset Y"));
+	Params.push_back(ShaderParam("aa_cubic_c", 0, 168, 4, 0.000000f, 4.000000f, 0.500000f, 0.015625f, "AA - Cubic Sharpness"));
+	Params.push_back(ShaderParam("aa_gauss_sigma", 0, 172, 4, 0.062500f, 1.000000f, 0.500000f, 0.015625f, "AA - Gaussian Sigma"));
+	Params.push_back(ShaderParam("interlace_bff", 0, 176, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing - Bottom Field First"));
+	Params.push_back(ShaderParam("interlace_1080i", 0, 180, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlace - Detect 1080i"));
+	Params.push_back(ShaderParam("interlace_detect_toggle", 0, 184, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing - Toggle"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MASKED_SCANLINESSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BRIGHTPASSSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("MASKED_SCANLINES", 4));
+	Samplers.push_back(ShaderSampler("BRIGHTPASS", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
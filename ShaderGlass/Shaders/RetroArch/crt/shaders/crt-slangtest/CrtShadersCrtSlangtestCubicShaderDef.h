@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSlangtestCubicShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSlangtestCubicShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSlangtestCubicShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -485,30 +496,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSlangtestCubicShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSlangtestCubicShaderDef::CrtShadersCrtSlangtestCubicShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSlangtestCubicShaderDef() : ShaderDef{}
-	{
-		Name = "cubic";
-		VertexByteCode = RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OUT_GAMMA", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BOOST", -1, 20, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cubic";
+	VertexByteCode = RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSlangtestCubicShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OUT_GAMMA", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BOOST", -1, 20, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
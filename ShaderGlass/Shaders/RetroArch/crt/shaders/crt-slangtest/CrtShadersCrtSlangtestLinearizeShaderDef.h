@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSlangtestLinearizeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSlangtestLinearizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -355,28 +366,22 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSlangtestLinearizeShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSlangtestLinearizeShaderDef::CrtShadersCrtSlangtestLinearizeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSlangtestLinearizeShaderDef() : ShaderDef{}
-	{
-		Name = "linearize";
-		VertexByteCode = RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GAMMA", 0, 64, 4, 2.000000f, 3.000000f, 2.500000f, 0.020000f, "CRT gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "linearize";
+	VertexByteCode = RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSlangtestLinearizeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GAMMA", 0, 64, 4, 2.000000f, 3.000000f, 2.500000f, 0.020000f, "CRT gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
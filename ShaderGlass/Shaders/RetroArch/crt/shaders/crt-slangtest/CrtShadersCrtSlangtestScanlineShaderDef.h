@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSlangtestScanlineShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSlangtestScanlineShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSlangtestScanlineShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -469,30 +480,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSlangtestScanlineShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSlangtestScanlineShaderDef::CrtShadersCrtSlangtestScanlineShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSlangtestScanlineShaderDef() : ShaderDef{}
-	{
-		Name = "scanline";
-		VertexByteCode = RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OUT_GAMMA", -1, 16, 4, 1.800000f, 2.400000f, 2.200000f, 0.000000f, "Monitor Output Gamma"));
-		Params.push_back(ShaderParam("BOOST", -1, 20, 4, 0.200000f, 2.000000f, 1.000000f, 0.020000f, "Color Boost"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scanline";
+	VertexByteCode = RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSlangtestScanlineShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OUT_GAMMA", -1, 16, 4, 1.800000f, 2.400000f, 2.200000f, 0.000000f, "Monitor Output Gamma"));
+	Params.push_back(ShaderParam("BOOST", -1, 20, 4, 0.200000f, 2.000000f, 1.000000f, 0.020000f, "Color Boost"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSuperXbrBlur_vertShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSuperXbrBlur_vertShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -449,30 +460,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSuperXbrBlur_vertShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSuperXbrBlur_vertShaderDef::CrtShadersCrtSuperXbrBlur_vertShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSuperXbrBlur_vertShaderDef() : ShaderDef{}
-	{
-		Name = "blur_vert";
-		VertexByteCode = RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_vert";
+	VertexByteCode = RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSuperXbrBlur_vertShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -77,6 +77,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtSuperXbrCrtCustomShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtSuperXbrCrtCustomShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -4587,46 +4598,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtSuperXbrCrtCustomShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtSuperXbrCrtCustomShaderDef::CrtShadersCrtSuperXbrCrtCustomShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtSuperXbrCrtCustomShaderDef() : ShaderDef{}
-	{
-		Name = "crt-custom";
-		VertexByteCode = RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 0, 4, 0.000000f, 1.000000f, 0.920000f, 0.010000f, "MIN BEAM WIDTH"));
-		Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "MAX BEAM WIDTH"));
-		Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 8, 4, 0.000000f, 1.000000f, 0.720000f, 0.010000f, "SCANLINES STRENGTH"));
-		Params.push_back(ShaderParam("COLOR_BOOST", -1, 12, 4, 1.000000f, 2.000000f, 1.250000f, 0.050000f, "COLOR BOOST"));
-		Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 16, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS_HACK"));
-		Params.push_back(ShaderParam("PHOSPHOR_LAYOUT", -1, 20, 4, 0.000000f, 24.000000f, 4.000000f, 1.000000f, "PHOSPHOR LAYOUT"));
-		Params.push_back(ShaderParam("MASK_INTENSITY", -1, 24, 4, 0.000000f, 1.000000f, 0.700000f, 0.100000f, "MASK INTENSITY"));
-		Params.push_back(ShaderParam("InputGamma", -1, 28, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputGamma", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("VSCANLINES", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SCANLINES DIRECTION"));
-		Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "CRT Anti-Ringing [ OFF | ON ]"));
-		Params.push_back(ShaderParam("CRT_CURVATURE", -1, 44, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT-Curvature"));
-		Params.push_back(ShaderParam("CRT_warpX", -1, 48, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CRT-Curvature X-Axis"));
-		Params.push_back(ShaderParam("CRT_warpY", -1, 52, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CRT-Curvature Y-Axis"));
-		Params.push_back(ShaderParam("CRT_cornersize", -1, 56, 4, 0.001000f, 1.000000f, 0.010000f, 0.005000f, "CRT-Corner Size"));
-		Params.push_back(ShaderParam("CRT_cornersmooth", -1, 60, 4, 80.000000f, 2080.000000f, 380.000000f, 100.000000f, "CRT-Corner Smoothness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-custom";
+	VertexByteCode = RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtSuperXbrCrtCustomShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 0, 4, 0.000000f, 1.000000f, 0.920000f, 0.010000f, "MIN BEAM WIDTH"));
+	Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "MAX BEAM WIDTH"));
+	Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 8, 4, 0.000000f, 1.000000f, 0.720000f, 0.010000f, "SCANLINES STRENGTH"));
+	Params.push_back(ShaderParam("COLOR_BOOST", -1, 12, 4, 1.000000f, 2.000000f, 1.250000f, 0.050000f, "COLOR BOOST"));
+	Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 16, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS_HACK"));
+	Params.push_back(ShaderParam("PHOSPHOR_LAYOUT", -1, 20, 4, 0.000000f, 24.000000f, 4.000000f, 1.000000f, "PHOSPHOR LAYOUT"));
+	Params.push_back(ShaderParam("MASK_INTENSITY", -1, 24, 4, 0.000000f, 1.000000f, 0.700000f, 0.100000f, "MASK INTENSITY"));
+	Params.push_back(ShaderParam("InputGamma", -1, 28, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputGamma", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("VSCANLINES", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SCANLINES DIRECTION"));
+	Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "CRT Anti-Ringing [ OFF | ON ]"));
+	Params.push_back(ShaderParam("CRT_CURVATURE", -1, 44, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT-Curvature"));
+	Params.push_back(ShaderParam("CRT_warpX", -1, 48, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CRT-Curvature X-Axis"));
+	Params.push_back(ShaderParam("CRT_warpY", -1, 52, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CRT-Curvature Y-Axis"));
+	Params.push_back(ShaderParam("CRT_cornersize", -1, 56, 4, 0.001000f, 1.000000f, 0.010000f, 0.005000f, "CRT-Corner Size"));
+	Params.push_back(ShaderParam("CRT_cornersmooth", -1, 60, 4, 80.000000f, 2080.000000f, 380.000000f, 100.000000f, "CRT-Corner Smoothness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
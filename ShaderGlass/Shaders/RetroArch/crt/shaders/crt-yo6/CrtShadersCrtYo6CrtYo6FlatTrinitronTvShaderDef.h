@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1185,38 +1196,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef::CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef() : ShaderDef{}
-	{
-		Name = "crt-yo6-flat-trinitron-tv";
-		VertexByteCode = RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("TVL", -1, 52, 4, 0.000000f, 16384.000000f, 0.000000f, 1.000000f, "TVL (0:Auto)"));
-		Params.push_back(ShaderParam("VSIZE", -1, 56, 4, 0.000000f, 16384.000000f, 0.000000f, 1.000000f, "V-Size (0:Auto)"));
-		Params.push_back(ShaderParam("VZOOM", -1, 60, 4, 2.000000f, 15.000000f, 2.000000f, 1.000000f, "V-Zoom (2:Auto)"));
-		Params.push_back(ShaderParam("VOFF", -1, 64, 4, -16384.000000f, 16384.000000f, 0.000000f, 1.000000f, "V-Offset"));
-		Params.push_back(ShaderParam("VOFFC", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "V-Offset Centered"));
-		Params.push_back(ShaderParam("GAMMA", -1, 72, 4, 0.000000f, 4.000000f, 1.800000f, 0.100000f, "Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("TEX", 3));
+	Name = "crt-yo6-flat-trinitron-tv";
+	VertexByteCode = RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("TVL", -1, 52, 4, 0.000000f, 16384.000000f, 0.000000f, 1.000000f, "TVL (0:Auto)"));
+	Params.push_back(ShaderParam("VSIZE", -1, 56, 4, 0.000000f, 16384.000000f, 0.000000f, 1.000000f, "V-Size (0:Auto)"));
+	Params.push_back(ShaderParam("VZOOM", -1, 60, 4, 2.000000f, 15.000000f, 2.000000f, 1.000000f, "V-Zoom (2:Auto)"));
+	Params.push_back(ShaderParam("VOFF", -1, 64, 4, -16384.000000f, 16384.000000f, 0.000000f, 1.000000f, "V-Offset"));
+	Params.push_back(ShaderParam("VOFFC", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "V-Offset Centered"));
+	Params.push_back(ShaderParam("GAMMA", -1, 72, 4, 0.000000f, 4.000000f, 1.800000f, 0.100000f, "Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("TEX", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
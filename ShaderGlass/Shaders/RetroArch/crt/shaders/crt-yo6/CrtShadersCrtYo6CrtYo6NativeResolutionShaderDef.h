@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -529,31 +540,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef::CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef() : ShaderDef{}
-	{
-		Name = "crt-yo6-native-resolution";
-		VertexByteCode = RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-yo6-native-resolution";
+	VertexByteCode = RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6NativeResolutionShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
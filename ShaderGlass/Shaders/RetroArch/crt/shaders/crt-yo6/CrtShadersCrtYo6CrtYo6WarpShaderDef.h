@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtYo6CrtYo6WarpShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtYo6CrtYo6WarpShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -403,32 +414,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtYo6CrtYo6WarpShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtYo6CrtYo6WarpShaderDef::CrtShadersCrtYo6CrtYo6WarpShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtYo6CrtYo6WarpShaderDef() : ShaderDef{}
-	{
-		Name = "crt-yo6-warp";
-		VertexByteCode = RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("TEX_CRT", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-yo6-warp";
+	VertexByteCode = RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtYo6CrtYo6WarpShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("TEX_CRT", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDefs
 {
 const BYTE sData[] =
@@ -2059,13 +2067,10 @@ const BYTE sData[] =
 ,1,197,71,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef : public TextureDef
+CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef::CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef() : TextureDef{}
-	{
-		Name = "phosphor-flat-trinitron-tv.png";
-		Data = CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDefs::sData);
-	}
-};
+	Name = "phosphor-flat-trinitron-tv.png";
+	Data = CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtsimArtifactsTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtsimArtifactsTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtsimArtifactsTextureDefs
 {
 const BYTE sData[] =
@@ -17,13 +25,10 @@ const BYTE sData[] =
 ,67,182,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtsimArtifactsTextureDef : public TextureDef
+CrtShadersCrtsimArtifactsTextureDef::CrtShadersCrtsimArtifactsTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtsimArtifactsTextureDef() : TextureDef{}
-	{
-		Name = "artifacts.png";
-		Data = CrtShadersCrtsimArtifactsTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtsimArtifactsTextureDefs::sData);
-	}
-};
+	Name = "artifacts.png";
+	Data = CrtShadersCrtsimArtifactsTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtsimArtifactsTextureDefs::sData);
+}
+#endif
@@ -39,6 +39,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtsimCompositeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtsimCompositeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtsimCompositeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -875,42 +886,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtsimCompositeShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtsimCompositeShaderDef::CrtShadersCrtsimCompositeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtsimCompositeShaderDef() : ShaderDef{}
-	{
-		Name = "composite";
-		VertexByteCode = RetroArchCrtShadersCrtsimCompositeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtsimCompositeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtsimCompositeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtsimCompositeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Tuning_Sharp", -1, 52, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Composite Sharp"));
-		Params.push_back(ShaderParam("Tuning_Persistence_R", -1, 56, 4, 0.000000f, 1.000000f, 0.065000f, 0.010000f, "Red Persistence"));
-		Params.push_back(ShaderParam("Tuning_Persistence_G", -1, 60, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Green Persistence"));
-		Params.push_back(ShaderParam("Tuning_Persistence_B", -1, 64, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Blue Persistence"));
-		Params.push_back(ShaderParam("Tuning_Bleed", -1, 68, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Composite Bleed"));
-		Params.push_back(ShaderParam("Tuning_Artifacts", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Composite Artifacts"));
-		Params.push_back(ShaderParam("NTSCLerp", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NTSC Artifacts"));
-		Params.push_back(ShaderParam("NTSCArtifactScale", -1, 80, 4, 0.000000f, 1000.000000f, 255.000000f, 5.000000f, "NTSC Artifact Scale"));
-		Params.push_back(ShaderParam("animate_artifacts", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Animate NTSC Artifacts"));
-		Samplers.push_back(ShaderSampler("NTSCArtifactSampler", 4));
-		Samplers.push_back(ShaderSampler("Source", 3));
-		Samplers.push_back(ShaderSampler("PassFeedback0", 2));
+	Name = "composite";
+	VertexByteCode = RetroArchCrtShadersCrtsimCompositeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtsimCompositeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtsimCompositeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtsimCompositeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Tuning_Sharp", -1, 52, 4, 0.000000f, 1.000000f, 0.200000f, 0.050000f, "Composite Sharp"));
+	Params.push_back(ShaderParam("Tuning_Persistence_R", -1, 56, 4, 0.000000f, 1.000000f, 0.065000f, 0.010000f, "Red Persistence"));
+	Params.push_back(ShaderParam("Tuning_Persistence_G", -1, 60, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Green Persistence"));
+	Params.push_back(ShaderParam("Tuning_Persistence_B", -1, 64, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Blue Persistence"));
+	Params.push_back(ShaderParam("Tuning_Bleed", -1, 68, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Composite Bleed"));
+	Params.push_back(ShaderParam("Tuning_Artifacts", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Composite Artifacts"));
+	Params.push_back(ShaderParam("NTSCLerp", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NTSC Artifacts"));
+	Params.push_back(ShaderParam("NTSCArtifactScale", -1, 80, 4, 0.000000f, 1000.000000f, 255.000000f, 5.000000f, "NTSC Artifact Scale"));
+	Params.push_back(ShaderParam("animate_artifacts", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Animate NTSC Artifacts"));
+	Samplers.push_back(ShaderSampler("NTSCArtifactSampler", 4));
+	Samplers.push_back(ShaderSampler("Source", 3));
+	Samplers.push_back(ShaderSampler("PassFeedback0", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersCrtsimMaskTextureDef : public TextureDef
+{
+public:
+	CrtShadersCrtsimMaskTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersCrtsimMaskTextureDefs
 {
 const BYTE sData[] =
@@ -22,13 +30,10 @@ const BYTE sData[] =
 ,3,104,94,207,213,98,251,128,0,86,105,122,190,160,89,7,39,6,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersCrtsimMaskTextureDef : public TextureDef
+CrtShadersCrtsimMaskTextureDef::CrtShadersCrtsimMaskTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersCrtsimMaskTextureDef() : TextureDef{}
-	{
-		Name = "mask.png";
-		Data = CrtShadersCrtsimMaskTextureDefs::sData;
-		DataLength = sizeof(CrtShadersCrtsimMaskTextureDefs::sData);
-	}
-};
+	Name = "mask.png";
+	Data = CrtShadersCrtsimMaskTextureDefs::sData;
+	DataLength = sizeof(CrtShadersCrtsimMaskTextureDefs::sData);
+}
+#endif
@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtsimPostDownsampleShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtsimPostDownsampleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtsimPostDownsampleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -484,32 +495,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtsimPostDownsampleShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtsimPostDownsampleShaderDef::CrtShadersCrtsimPostDownsampleShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtsimPostDownsampleShaderDef() : ShaderDef{}
-	{
-		Name = "post-downsample";
-		VertexByteCode = RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bloom_scale_down", -1, 52, 4, 0.000000f, 0.030000f, 0.015000f, 0.001000f, "Downsample Bloom Scale"));
-		Samplers.push_back(ShaderSampler("Original", 2));
+	Name = "post-downsample";
+	VertexByteCode = RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtsimPostDownsampleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bloom_scale_down", -1, 52, 4, 0.000000f, 0.030000f, 0.015000f, 0.001000f, "Downsample Bloom Scale"));
+	Samplers.push_back(ShaderSampler("Original", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
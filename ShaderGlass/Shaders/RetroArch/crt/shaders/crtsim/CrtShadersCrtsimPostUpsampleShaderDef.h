@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtsimPostUpsampleShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtsimPostUpsampleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtsimPostUpsampleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -483,32 +494,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtsimPostUpsampleShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtsimPostUpsampleShaderDef::CrtShadersCrtsimPostUpsampleShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtsimPostUpsampleShaderDef() : ShaderDef{}
-	{
-		Name = "post-upsample";
-		VertexByteCode = RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bloom_scale_up", -1, 52, 4, 0.000000f, 0.030000f, 0.020000f, 0.001000f, "Upsample Bloom Scale"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "post-upsample";
+	VertexByteCode = RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtsimPostUpsampleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bloom_scale_up", -1, 52, 4, 0.000000f, 0.030000f, 0.020000f, 0.001000f, "Upsample Bloom Scale"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
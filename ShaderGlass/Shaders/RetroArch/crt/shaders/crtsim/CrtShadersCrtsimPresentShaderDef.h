@@ -60,6 +60,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtsimPresentShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtsimPresentShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtsimPresentShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -865,42 +876,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtsimPresentShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtsimPresentShaderDef::CrtShadersCrtsimPresentShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtsimPresentShaderDef() : ShaderDef{}
-	{
-		Name = "present";
-		VertexByteCode = RetroArchCrtShadersCrtsimPresentShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtsimPresentShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtsimPresentShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtsimPresentShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BloomPower", 0, 116, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Bloom Power"));
-		Params.push_back(ShaderParam("BloomScalar", 0, 120, 4, 0.000000f, 1.000000f, 0.100000f, 0.050000f, "Bloom Scalar"));
-		Params.push_back(ShaderParam("Tuning_Overscan", 0, 124, 4, 0.000000f, 1.000000f, 0.950000f, 0.050000f, "Overscan"));
-		Params.push_back(ShaderParam("Tuning_Barrel", 0, 128, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Barrel Distortion"));
-		Params.push_back(ShaderParam("mask_toggle", 0, 132, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Toggle"));
-		Params.push_back(ShaderParam("CRTMask_Scale", -1, 0, 4, 0.000000f, 10.000000f, 1.000000f, 0.500000f, "CRT Mask Scale"));
-		Params.push_back(ShaderParam("Tuning_Satur", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("Tuning_Mask_Brightness", -1, 8, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Brightness"));
-		Params.push_back(ShaderParam("Tuning_Mask_Opacity", -1, 12, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Opacity"));
-		Samplers.push_back(ShaderSampler("shadowMaskSampler", 4));
-		Samplers.push_back(ShaderSampler("CRTPASS", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "present";
+	VertexByteCode = RetroArchCrtShadersCrtsimPresentShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtsimPresentShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtsimPresentShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtsimPresentShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BloomPower", 0, 116, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Bloom Power"));
+	Params.push_back(ShaderParam("BloomScalar", 0, 120, 4, 0.000000f, 1.000000f, 0.100000f, 0.050000f, "Bloom Scalar"));
+	Params.push_back(ShaderParam("Tuning_Overscan", 0, 124, 4, 0.000000f, 1.000000f, 0.950000f, 0.050000f, "Overscan"));
+	Params.push_back(ShaderParam("Tuning_Barrel", 0, 128, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Barrel Distortion"));
+	Params.push_back(ShaderParam("mask_toggle", 0, 132, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Toggle"));
+	Params.push_back(ShaderParam("CRTMask_Scale", -1, 0, 4, 0.000000f, 10.000000f, 1.000000f, 0.500000f, "CRT Mask Scale"));
+	Params.push_back(ShaderParam("Tuning_Satur", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("Tuning_Mask_Brightness", -1, 8, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Brightness"));
+	Params.push_back(ShaderParam("Tuning_Mask_Opacity", -1, 12, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Opacity"));
+	Samplers.push_back(ShaderSampler("shadowMaskSampler", 4));
+	Samplers.push_back(ShaderSampler("CRTPASS", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -59,6 +59,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersCrtsimScreenShaderDef : public ShaderDef
+{
+public:
+	CrtShadersCrtsimScreenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersCrtsimScreenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -627,36 +638,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersCrtsimScreenShaderDef : public ShaderDef
+RetroArch::CrtShadersCrtsimScreenShaderDef::CrtShadersCrtsimScreenShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersCrtsimScreenShaderDef() : ShaderDef{}
-	{
-		Name = "screen";
-		VertexByteCode = RetroArchCrtShadersCrtsimScreenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersCrtsimScreenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersCrtsimScreenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersCrtsimScreenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CRTMask_Scale", -1, 0, 4, 0.000000f, 10.000000f, 1.000000f, 0.500000f, "CRT Mask Scale"));
-		Params.push_back(ShaderParam("Tuning_Satur", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("Tuning_Mask_Brightness", -1, 8, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Brightness"));
-		Params.push_back(ShaderParam("Tuning_Mask_Opacity", -1, 12, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Opacity"));
-		Samplers.push_back(ShaderSampler("shadowMaskSampler", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "screen";
+	VertexByteCode = RetroArchCrtShadersCrtsimScreenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersCrtsimScreenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersCrtsimScreenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersCrtsimScreenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CRTMask_Scale", -1, 0, 4, 0.000000f, 10.000000f, 1.000000f, 0.500000f, "CRT Mask Scale"));
+	Params.push_back(ShaderParam("Tuning_Satur", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("Tuning_Mask_Brightness", -1, 8, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Brightness"));
+	Params.push_back(ShaderParam("Tuning_Mask_Opacity", -1, 12, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Opacity"));
+	Samplers.push_back(ShaderSampler("shadowMaskSampler", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
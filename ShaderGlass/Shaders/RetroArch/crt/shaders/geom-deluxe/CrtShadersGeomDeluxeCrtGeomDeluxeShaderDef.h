@@ -165,6 +165,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -7460,64 +7471,58 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef : public ShaderDef
+RetroArch::CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef::CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef() : ShaderDef{}
-	{
-		Name = "crt-geom-deluxe";
-		VertexByteCode = RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("SourceSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("internal1Size", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MVP", 0, 96, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("phosphor_power", -1, 0, 4, 0.500000f, 3.000000f, 1.200000f, 0.050000f, "Phosphor decay power"));
-		Params.push_back(ShaderParam("phosphor_amplitude", -1, 4, 4, 0.000000f, 0.200000f, 0.040000f, 0.010000f, "Phosphor persistence amplitude"));
-		Params.push_back(ShaderParam("CRTgamma", -1, 8, 4, 0.700000f, 4.000000f, 2.400000f, 0.050000f, "Gamma of simulated CRT"));
-		Params.push_back(ShaderParam("width", -1, 12, 4, 0.100000f, 4.000000f, 2.000000f, 0.100000f, "Halation blur width"));
-		Params.push_back(ShaderParam("aspect_x", -1, 16, 4, 0.300000f, 1.000000f, 1.000000f, 0.010000f, "Aspect ratio X"));
-		Params.push_back(ShaderParam("aspect_y", -1, 20, 4, 0.300000f, 1.000000f, 0.750000f, 0.010000f, "Aspect ratio Y"));
-		Params.push_back(ShaderParam("d", -1, 24, 4, 0.100000f, 10.000000f, 2.000000f, 0.100000f, "Distance to screen"));
-		Params.push_back(ShaderParam("R", -1, 28, 4, 0.500000f, 10.000000f, 3.500000f, 0.100000f, "Radius of curvature"));
-		Params.push_back(ShaderParam("angle_x", -1, 32, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Tilt X"));
-		Params.push_back(ShaderParam("angle_y", -1, 36, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Tilt Y"));
-		Params.push_back(ShaderParam("aperture_strength", -1, 40, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Shadow mask strength"));
-		Params.push_back(ShaderParam("aperture_brightboost", -1, 44, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Shadow mask brightness boost"));
-		Params.push_back(ShaderParam("halation", -1, 48, 4, 0.000000f, 0.300000f, 0.100000f, 0.010000f, "Halation amplitude"));
-		Params.push_back(ShaderParam("curvature", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Enable Curvature"));
-		Params.push_back(ShaderParam("cornersize", -1, 56, 4, 0.000000f, 0.100000f, 0.010000f, 0.010000f, "Rounded corner size"));
-		Params.push_back(ShaderParam("cornersmooth", -1, 60, 4, 100.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Border smoothness"));
-		Params.push_back(ShaderParam("overscan_x", -1, 64, 4, 0.800000f, 1.200000f, 1.000000f, 0.005000f, "Overscan X"));
-		Params.push_back(ShaderParam("overscan_y", -1, 68, 4, 0.800000f, 1.200000f, 1.000000f, 0.005000f, "Overscan Y"));
-		Params.push_back(ShaderParam("monitorgamma", -1, 72, 4, 0.700000f, 4.000000f, 2.200000f, 0.050000f, "Gamma of output display"));
-		Params.push_back(ShaderParam("mask_type", -1, 76, 4, 1.000000f, 20.000000f, 1.000000f, 1.000000f, "Mask Pattern"));
-		Params.push_back(ShaderParam("SHARPER", -1, 80, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scanline_weight", -1, 84, 4, 0.100000f, 0.500000f, 0.300000f, 0.010000f, "CRTGeom Scanline Weight"));
-		Params.push_back(ShaderParam("geom_lum", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "CRTGeom Luminance"));
-		Params.push_back(ShaderParam("interlace_detect", -1, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRTGeom Interlacing Simulation"));
-		Params.push_back(ShaderParam("rasterbloom_smooth", -1, 96, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("rasterbloom", -1, 100, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Raster bloom amplitude"));
-		Samplers.push_back(ShaderSampler("internal1", 3));
-		Samplers.push_back(ShaderSampler("blur_texture", 2));
-		Samplers.push_back(ShaderSampler("aperture", 4));
-		Samplers.push_back(ShaderSampler("slot", 5));
-		Samplers.push_back(ShaderSampler("delta", 6));
-		Samplers.push_back(ShaderSampler("phosphor", 7));
+	Name = "crt-geom-deluxe";
+	VertexByteCode = RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGeomDeluxeCrtGeomDeluxeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("SourceSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("internal1Size", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MVP", 0, 96, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("phosphor_power", -1, 0, 4, 0.500000f, 3.000000f, 1.200000f, 0.050000f, "Phosphor decay power"));
+	Params.push_back(ShaderParam("phosphor_amplitude", -1, 4, 4, 0.000000f, 0.200000f, 0.040000f, 0.010000f, "Phosphor persistence amplitude"));
+	Params.push_back(ShaderParam("CRTgamma", -1, 8, 4, 0.700000f, 4.000000f, 2.400000f, 0.050000f, "Gamma of simulated CRT"));
+	Params.push_back(ShaderParam("width", -1, 12, 4, 0.100000f, 4.000000f, 2.000000f, 0.100000f, "Halation blur width"));
+	Params.push_back(ShaderParam("aspect_x", -1, 16, 4, 0.300000f, 1.000000f, 1.000000f, 0.010000f, "Aspect ratio X"));
+	Params.push_back(ShaderParam("aspect_y", -1, 20, 4, 0.300000f, 1.000000f, 0.750000f, 0.010000f, "Aspect ratio Y"));
+	Params.push_back(ShaderParam("d", -1, 24, 4, 0.100000f, 10.000000f, 2.000000f, 0.100000f, "Distance to screen"));
+	Params.push_back(ShaderParam("R", -1, 28, 4, 0.500000f, 10.000000f, 3.500000f, 0.100000f, "Radius of curvature"));
+	Params.push_back(ShaderParam("angle_x", -1, 32, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Tilt X"));
+	Params.push_back(ShaderParam("angle_y", -1, 36, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Tilt Y"));
+	Params.push_back(ShaderParam("aperture_strength", -1, 40, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Shadow mask strength"));
+	Params.push_back(ShaderParam("aperture_brightboost", -1, 44, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Shadow mask brightness boost"));
+	Params.push_back(ShaderParam("halation", -1, 48, 4, 0.000000f, 0.300000f, 0.100000f, 0.010000f, "Halation amplitude"));
+	Params.push_back(ShaderParam("curvature", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Enable Curvature"));
+	Params.push_back(ShaderParam("cornersize", -1, 56, 4, 0.000000f, 0.100000f, 0.010000f, 0.010000f, "Rounded corner size"));
+	Params.push_back(ShaderParam("cornersmooth", -1, 60, 4, 100.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Border smoothness"));
+	Params.push_back(ShaderParam("overscan_x", -1, 64, 4, 0.800000f, 1.200000f, 1.000000f, 0.005000f, "Overscan X"));
+	Params.push_back(ShaderParam("overscan_y", -1, 68, 4, 0.800000f, 1.200000f, 1.000000f, 0.005000f, "Overscan Y"));
+	Params.push_back(ShaderParam("monitorgamma", -1, 72, 4, 0.700000f, 4.000000f, 2.200000f, 0.050000f, "Gamma of output display"));
+	Params.push_back(ShaderParam("mask_type", -1, 76, 4, 1.000000f, 20.000000f, 1.000000f, 1.000000f, "Mask Pattern"));
+	Params.push_back(ShaderParam("SHARPER", -1, 80, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scanline_weight", -1, 84, 4, 0.100000f, 0.500000f, 0.300000f, 0.010000f, "CRTGeom Scanline Weight"));
+	Params.push_back(ShaderParam("geom_lum", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "CRTGeom Luminance"));
+	Params.push_back(ShaderParam("interlace_detect", -1, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRTGeom Interlacing Simulation"));
+	Params.push_back(ShaderParam("rasterbloom_smooth", -1, 96, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("rasterbloom", -1, 100, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Raster bloom amplitude"));
+	Samplers.push_back(ShaderSampler("internal1", 3));
+	Samplers.push_back(ShaderSampler("blur_texture", 2));
+	Samplers.push_back(ShaderSampler("aperture", 4));
+	Samplers.push_back(ShaderSampler("slot", 5));
+	Samplers.push_back(ShaderSampler("delta", 6));
+	Samplers.push_back(ShaderSampler("phosphor", 7));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef : public TextureDef
+{
+public:
+	CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDefs
 {
 const BYTE sData[] =
@@ -14,13 +22,10 @@ const BYTE sData[] =
 ,84,120,1,99,252,207,192,240,151,1,72,48,66,8,6,0,45,229,3,254,96,62,58,45,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef : public TextureDef
+CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef::CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef() : TextureDef{}
-	{
-		Name = "aperture_2_4_rgb.png";
-		Data = CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDefs::sData);
-	}
-};
+	Name = "aperture_2_4_rgb.png";
+	Data = CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef : public TextureDef
+{
+public:
+	CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef : public TextureDef
+CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef::CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef() : TextureDef{}
-	{
-		Name = "delta_2_4x1_rgb.png";
-		Data = CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDefs::sData);
-	}
-};
+	Name = "delta_2_4x1_rgb.png";
+	Data = CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDefs::sData);
+}
+#endif
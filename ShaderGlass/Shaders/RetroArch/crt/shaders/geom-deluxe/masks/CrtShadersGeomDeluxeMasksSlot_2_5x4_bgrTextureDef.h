@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef : public TextureDef
+{
+public:
+	CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,224,73,213,85,122,202,221,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef : public TextureDef
+CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef::CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef() : TextureDef{}
-	{
-		Name = "slot_2_5x4_bgr.png";
-		Data = CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDefs::sData);
-	}
-};
+	Name = "slot_2_5x4_bgr.png";
+	Data = CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDefs::sData);
+}
+#endif
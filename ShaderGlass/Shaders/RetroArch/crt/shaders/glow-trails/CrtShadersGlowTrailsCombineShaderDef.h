@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowTrailsCombineShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowTrailsCombineShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowTrailsCombineShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -501,34 +512,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowTrailsCombineShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowTrailsCombineShaderDef::CrtShadersGlowTrailsCombineShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowTrailsCombineShaderDef() : ShaderDef{}
-	{
-		Name = "combine";
-		VertexByteCode = RetroArchCrtShadersGlowTrailsCombineShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowTrailsCombineShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowTrailsCombineShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowTrailsCombineShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("screen_combine", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Screen Combine"));
-		Params.push_back(ShaderParam("haze_strength", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Haze Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PASS1", 3));
+	Name = "combine";
+	VertexByteCode = RetroArchCrtShadersGlowTrailsCombineShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowTrailsCombineShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowTrailsCombineShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowTrailsCombineShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("screen_combine", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Screen Combine"));
+	Params.push_back(ShaderParam("haze_strength", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Haze Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PASS1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowTrailsGlowTrails0ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowTrailsGlowTrails0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -469,34 +480,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowTrailsGlowTrails0ShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowTrailsGlowTrails0ShaderDef::CrtShadersGlowTrailsGlowTrails0ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowTrailsGlowTrails0ShaderDef() : ShaderDef{}
-	{
-		Name = "glow-trails0";
-		VertexByteCode = RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mixfactor", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Motionblur Fadeout"));
-		Params.push_back(ShaderParam("threshold", -1, 56, 4, 0.000000f, 1.000000f, 0.900000f, 0.010000f, "Brightness Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("Trails0Feedback", 3));
+	Name = "glow-trails0";
+	VertexByteCode = RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mixfactor", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Motionblur Fadeout"));
+	Params.push_back(ShaderParam("threshold", -1, 56, 4, 0.000000f, 1.000000f, 0.900000f, 0.010000f, "Brightness Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("Trails0Feedback", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowTrailsGlowTrails1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowTrailsGlowTrails1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -433,33 +444,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowTrailsGlowTrails1ShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowTrailsGlowTrails1ShaderDef::CrtShadersGlowTrailsGlowTrails1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowTrailsGlowTrails1ShaderDef() : ShaderDef{}
-	{
-		Name = "glow-trails1";
-		VertexByteCode = RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("trail_bright", -1, 52, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Phos. Trail Brightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("glow_trails_refpass", 3));
+	Name = "glow-trails1";
+	VertexByteCode = RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowTrailsGlowTrails1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("trail_bright", -1, 52, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Phos. Trail Brightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("glow_trails_refpass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
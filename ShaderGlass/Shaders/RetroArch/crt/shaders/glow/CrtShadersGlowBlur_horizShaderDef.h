@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowBlur_horizShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowBlur_horizShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowBlur_horizShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -457,30 +468,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowBlur_horizShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowBlur_horizShaderDef::CrtShadersGlowBlur_horizShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowBlur_horizShaderDef() : ShaderDef{}
-	{
-		Name = "blur_horiz";
-		VertexByteCode = RetroArchCrtShadersGlowBlur_horizShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowBlur_horizShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowBlur_horizShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowBlur_horizShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_horiz";
+	VertexByteCode = RetroArchCrtShadersGlowBlur_horizShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowBlur_horizShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowBlur_horizShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowBlur_horizShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowBlur_vertShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowBlur_vertShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowBlur_vertShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -452,30 +463,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowBlur_vertShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowBlur_vertShaderDef::CrtShadersGlowBlur_vertShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowBlur_vertShaderDef() : ShaderDef{}
-	{
-		Name = "blur_vert";
-		VertexByteCode = RetroArchCrtShadersGlowBlur_vertShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowBlur_vertShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowBlur_vertShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowBlur_vertShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_vert";
+	VertexByteCode = RetroArchCrtShadersGlowBlur_vertShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowBlur_vertShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowBlur_vertShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowBlur_vertShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowGauss_horizShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowGauss_horizShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowGauss_horizShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -512,30 +523,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowGauss_horizShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowGauss_horizShaderDef::CrtShadersGlowGauss_horizShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowGauss_horizShaderDef() : ShaderDef{}
-	{
-		Name = "gauss_horiz";
-		VertexByteCode = RetroArchCrtShadersGlowGauss_horizShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowGauss_horizShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowGauss_horizShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowGauss_horizShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gauss_horiz";
+	VertexByteCode = RetroArchCrtShadersGlowGauss_horizShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowGauss_horizShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowGauss_horizShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowGauss_horizShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowGauss_vertShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowGauss_vertShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowGauss_vertShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -682,31 +693,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowGauss_vertShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowGauss_vertShaderDef::CrtShadersGlowGauss_vertShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowGauss_vertShaderDef() : ShaderDef{}
-	{
-		Name = "gauss_vert";
-		VertexByteCode = RetroArchCrtShadersGlowGauss_vertShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowGauss_vertShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowGauss_vertShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowGauss_vertShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BOOST", -1, 0, 4, 0.500000f, 1.500000f, 1.000000f, 0.020000f, "Color Boost"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gauss_vert";
+	VertexByteCode = RetroArchCrtShadersGlowGauss_vertShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowGauss_vertShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowGauss_vertShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowGauss_vertShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BOOST", -1, 0, 4, 0.500000f, 1.500000f, 1.000000f, 0.020000f, "Color Boost"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
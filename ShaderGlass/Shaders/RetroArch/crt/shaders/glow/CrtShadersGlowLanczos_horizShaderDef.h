@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowLanczos_horizShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowLanczos_horizShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowLanczos_horizShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -542,30 +553,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowLanczos_horizShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowLanczos_horizShaderDef::CrtShadersGlowLanczos_horizShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowLanczos_horizShaderDef() : ShaderDef{}
-	{
-		Name = "lanczos_horiz";
-		VertexByteCode = RetroArchCrtShadersGlowLanczos_horizShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowLanczos_horizShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowLanczos_horizShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowLanczos_horizShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lanczos_horiz";
+	VertexByteCode = RetroArchCrtShadersGlowLanczos_horizShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowLanczos_horizShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowLanczos_horizShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowLanczos_horizShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowLinearizeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowLinearizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowLinearizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -362,31 +373,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowLinearizeShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowLinearizeShaderDef::CrtShadersGlowLinearizeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowLinearizeShaderDef() : ShaderDef{}
-	{
-		Name = "linearize";
-		VertexByteCode = RetroArchCrtShadersGlowLinearizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowLinearizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowLinearizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowLinearizeShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("INPUT_GAMMA", -1, 0, 4, 2.000000f, 2.600000f, 2.400000f, 0.020000f, "Input Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "linearize";
+	VertexByteCode = RetroArchCrtShadersGlowLinearizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowLinearizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowLinearizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowLinearizeShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("INPUT_GAMMA", -1, 0, 4, 2.000000f, 2.600000f, 2.400000f, 0.020000f, "Input Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
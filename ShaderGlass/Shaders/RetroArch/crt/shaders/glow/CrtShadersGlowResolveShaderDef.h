@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGlowResolveShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGlowResolveShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGlowResolveShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1488,44 +1499,38 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGlowResolveShaderDef : public ShaderDef
+RetroArch::CrtShadersGlowResolveShaderDef::CrtShadersGlowResolveShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGlowResolveShaderDef() : ShaderDef{}
-	{
-		Name = "resolve";
-		VertexByteCode = RetroArchCrtShadersGlowResolveShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGlowResolveShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGlowResolveShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGlowResolveShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CRTPassSize", 0, 112, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 128, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BLOOM_STRENGTH", -1, 0, 4, 0.000000f, 0.800000f, 0.450000f, 0.050000f, "Glow Strength"));
-		Params.push_back(ShaderParam("OUTPUT_GAMMA", -1, 4, 4, 1.800000f, 2.600000f, 2.200000f, 0.020000f, "Monitor Gamma"));
-		Params.push_back(ShaderParam("CURVATURE", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Curvature"));
-		Params.push_back(ShaderParam("warpX", -1, 12, 4, 0.000000f, 0.125000f, 0.031000f, 0.010000f, "Curvature X-Axis"));
-		Params.push_back(ShaderParam("warpY", -1, 16, 4, 0.000000f, 0.125000f, 0.041000f, 0.010000f, "Curvature Y-Axis"));
-		Params.push_back(ShaderParam("shadowMask", -1, 20, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Mask Effect"));
-		Params.push_back(ShaderParam("maskDark", -1, 24, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "maskDark"));
-		Params.push_back(ShaderParam("maskLight", -1, 28, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "maskLight"));
-		Params.push_back(ShaderParam("cornersize", -1, 32, 4, 0.001000f, 1.000000f, 0.010000f, 0.005000f, "Corner Size"));
-		Params.push_back(ShaderParam("cornersmooth", -1, 36, 4, 80.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Corner Smoothness"));
-		Params.push_back(ShaderParam("noise_amt", -1, 40, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Noise Amount"));
-		Samplers.push_back(ShaderSampler("CRTPass", 2));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "resolve";
+	VertexByteCode = RetroArchCrtShadersGlowResolveShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGlowResolveShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGlowResolveShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGlowResolveShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CRTPassSize", 0, 112, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 128, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BLOOM_STRENGTH", -1, 0, 4, 0.000000f, 0.800000f, 0.450000f, 0.050000f, "Glow Strength"));
+	Params.push_back(ShaderParam("OUTPUT_GAMMA", -1, 4, 4, 1.800000f, 2.600000f, 2.200000f, 0.020000f, "Monitor Gamma"));
+	Params.push_back(ShaderParam("CURVATURE", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Curvature"));
+	Params.push_back(ShaderParam("warpX", -1, 12, 4, 0.000000f, 0.125000f, 0.031000f, 0.010000f, "Curvature X-Axis"));
+	Params.push_back(ShaderParam("warpY", -1, 16, 4, 0.000000f, 0.125000f, 0.041000f, 0.010000f, "Curvature Y-Axis"));
+	Params.push_back(ShaderParam("shadowMask", -1, 20, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Mask Effect"));
+	Params.push_back(ShaderParam("maskDark", -1, 24, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "maskDark"));
+	Params.push_back(ShaderParam("maskLight", -1, 28, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "maskLight"));
+	Params.push_back(ShaderParam("cornersize", -1, 32, 4, 0.001000f, 1.000000f, 0.010000f, 0.005000f, "Corner Size"));
+	Params.push_back(ShaderParam("cornersmooth", -1, 36, 4, 80.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Corner Smoothness"));
+	Params.push_back(ShaderParam("noise_amt", -1, 40, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Noise Amount"));
+	Samplers.push_back(ShaderSampler("CRTPass", 2));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGtuV050Pass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGtuV050Pass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGtuV050Pass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -388,31 +399,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGtuV050Pass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersGtuV050Pass1ShaderDef::CrtShadersGtuV050Pass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGtuV050Pass1ShaderDef() : ShaderDef{}
-	{
-		Name = "pass1";
-		VertexByteCode = RetroArchCrtShadersGtuV050Pass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGtuV050Pass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGtuV050Pass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGtuV050Pass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("compositeConnection", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Composite Connection Enable"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pass1";
+	VertexByteCode = RetroArchCrtShadersGtuV050Pass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGtuV050Pass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGtuV050Pass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGtuV050Pass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("compositeConnection", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Composite Connection Enable"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
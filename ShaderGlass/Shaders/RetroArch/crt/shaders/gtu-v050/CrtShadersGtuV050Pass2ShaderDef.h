@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGtuV050Pass2ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGtuV050Pass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGtuV050Pass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -756,34 +767,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGtuV050Pass2ShaderDef : public ShaderDef
+RetroArch::CrtShadersGtuV050Pass2ShaderDef::CrtShadersGtuV050Pass2ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGtuV050Pass2ShaderDef() : ShaderDef{}
-	{
-		Name = "pass2";
-		VertexByteCode = RetroArchCrtShadersGtuV050Pass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGtuV050Pass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGtuV050Pass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGtuV050Pass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("signalResolution", -1, 48, 4, 16.000000f, 1024.000000f, 256.000000f, 16.000000f, "Signal Resolution Y"));
-		Params.push_back(ShaderParam("signalResolutionI", -1, 52, 4, 1.000000f, 350.000000f, 83.000000f, 2.000000f, "Signal Resolution I"));
-		Params.push_back(ShaderParam("signalResolutionQ", -1, 56, 4, 1.000000f, 350.000000f, 25.000000f, 2.000000f, "Signal Resolution Q"));
-		Params.push_back(ShaderParam("compositeConnection", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Composite Connection Enable"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pass2";
+	VertexByteCode = RetroArchCrtShadersGtuV050Pass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGtuV050Pass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGtuV050Pass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGtuV050Pass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("signalResolution", -1, 48, 4, 16.000000f, 1024.000000f, 256.000000f, 16.000000f, "Signal Resolution Y"));
+	Params.push_back(ShaderParam("signalResolutionI", -1, 52, 4, 1.000000f, 350.000000f, 83.000000f, 2.000000f, "Signal Resolution I"));
+	Params.push_back(ShaderParam("signalResolutionQ", -1, 56, 4, 1.000000f, 350.000000f, 25.000000f, 2.000000f, "Signal Resolution Q"));
+	Params.push_back(ShaderParam("compositeConnection", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Composite Connection Enable"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
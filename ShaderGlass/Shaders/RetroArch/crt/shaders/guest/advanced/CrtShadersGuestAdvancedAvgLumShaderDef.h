@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestAdvancedAvgLumShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestAdvancedAvgLumShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -707,32 +718,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestAdvancedAvgLumShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestAdvancedAvgLumShaderDef::CrtShadersGuestAdvancedAvgLumShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestAdvancedAvgLumShaderDef() : ShaderDef{}
-	{
-		Name = "avg-lum";
-		VertexByteCode = RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("lsmooth", -1, 32, 4, 0.500000f, 0.990000f, 0.700000f, 0.010000f, "Raster Bloom Effect Smoothing"));
-		Params.push_back(ShaderParam("sth", -1, 36, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("AvgLumPassFeedback", 3));
+	Name = "avg-lum";
+	VertexByteCode = RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedAvgLumShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("lsmooth", -1, 32, 4, 0.500000f, 0.990000f, 0.700000f, 0.010000f, "Raster Bloom Effect Smoothing"));
+	Params.push_back(ShaderParam("sth", -1, 36, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("AvgLumPassFeedback", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
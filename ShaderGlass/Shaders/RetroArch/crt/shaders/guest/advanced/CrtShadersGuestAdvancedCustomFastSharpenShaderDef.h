@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestAdvancedCustomFastSharpenShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestAdvancedCustomFastSharpenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -829,36 +840,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestAdvancedCustomFastSharpenShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestAdvancedCustomFastSharpenShaderDef::CrtShadersGuestAdvancedCustomFastSharpenShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestAdvancedCustomFastSharpenShaderDef() : ShaderDef{}
-	{
-		Name = "custom-fast-sharpen";
-		VertexByteCode = RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CSHARPEN", -1, 52, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "FSharpen - Sharpen strength"));
-		Params.push_back(ShaderParam("CCONTR", -1, 56, 4, 0.000000f, 0.250000f, 0.050000f, 0.010000f, "FSharpen - Sharpen Contrast/Ringing"));
-		Params.push_back(ShaderParam("CDETAILS", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "FSharpen - Details sharpened"));
-		Params.push_back(ShaderParam("DEBLUR", -1, 64, 4, 1.000000f, 7.000000f, 1.000000f, 0.250000f, "FSharpen - Deblur Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PrePass0", 3));
+	Name = "custom-fast-sharpen";
+	VertexByteCode = RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedCustomFastSharpenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CSHARPEN", -1, 52, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "FSharpen - Sharpen strength"));
+	Params.push_back(ShaderParam("CCONTR", -1, 56, 4, 0.000000f, 0.250000f, 0.050000f, 0.010000f, "FSharpen - Sharpen Contrast/Ringing"));
+	Params.push_back(ShaderParam("CDETAILS", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "FSharpen - Details sharpened"));
+	Params.push_back(ShaderParam("DEBLUR", -1, 64, 4, 1.000000f, 7.000000f, 1.000000f, 0.250000f, "FSharpen - Deblur Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PrePass0", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
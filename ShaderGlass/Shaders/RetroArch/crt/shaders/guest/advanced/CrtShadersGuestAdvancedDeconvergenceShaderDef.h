@@ -35,6 +35,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestAdvancedDeconvergenceShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestAdvancedDeconvergenceShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -8209,105 +8220,99 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestAdvancedDeconvergenceShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestAdvancedDeconvergenceShaderDef::CrtShadersGuestAdvancedDeconvergenceShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestAdvancedDeconvergenceShaderDef() : ShaderDef{}
-	{
-		Name = "deconvergence";
-		VertexByteCode = RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("bloom", 0, 116, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Bloom Strength"));
-		Params.push_back(ShaderParam("halation", 0, 120, 4, -2.000000f, 2.000000f, 0.000000f, 0.025000f, "Halation Strength"));
-		Params.push_back(ShaderParam("slotms", 0, 124, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Slot Mask Thickness"));
-		Params.push_back(ShaderParam("mask_gamma", 0, 128, 4, 1.000000f, 5.000000f, 2.400000f, 0.050000f, "Mask gamma"));
-		Params.push_back(ShaderParam("gamma_out", 0, 132, 4, 1.000000f, 5.000000f, 2.400000f, 0.050000f, "Gamma out"));
-		Params.push_back(ShaderParam("overscanX", 0, 136, 4, -200.000000f, 200.000000f, 0.000000f, 1.000000f, "Overscan X original pixels"));
-		Params.push_back(ShaderParam("overscanY", 0, 140, 4, -200.000000f, 200.000000f, 0.000000f, 1.000000f, "Overscan Y original pixels"));
-		Params.push_back(ShaderParam("intres", 0, 144, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("c_shape", 0, 148, 4, 0.050000f, 0.600000f, 0.250000f, 0.050000f, "Curvature Shape"));
-		Params.push_back(ShaderParam("barspeed", 0, 152, 4, 5.000000f, 200.000000f, 50.000000f, 1.000000f, "Hum Bar Speed"));
-		Params.push_back(ShaderParam("barintensity", 0, 156, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hum Bar Intensity"));
-		Params.push_back(ShaderParam("bardir", 0, 160, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Hum Bar Direction"));
-		Params.push_back(ShaderParam("sborder", 0, 164, 4, 0.250000f, 2.000000f, 0.750000f, 0.050000f, "Border Intensity"));
-		Params.push_back(ShaderParam("bloom_dist", 0, 168, 4, -2.000000f, 3.000000f, 0.000000f, 0.050000f, "Bloom Distribution"));
-		Params.push_back(ShaderParam("deconr", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("decons", 0, 176, 4, 0.000000f, 3.000000f, 1.000000f, 0.100000f, "Deconvergence Strength"));
-		Params.push_back(ShaderParam("addnoised", 0, 180, 4, -1.000000f, 1.000000f, 0.000000f, 0.020000f, "Add Noise"));
-		Params.push_back(ShaderParam("noisetype", 0, 184, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Noise Type: Colored, Luma"));
-		Params.push_back(ShaderParam("noiseresd", 0, 188, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Noise Resolution"));
-		Params.push_back(ShaderParam("deconrr", 0, 192, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Horizontal Deconvergence Red Range"));
-		Params.push_back(ShaderParam("deconrg", 0, 196, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Horizontal Deconvergence Green Range"));
-		Params.push_back(ShaderParam("deconrb", 0, 200, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Horizontal Deconvergence Blue Range"));
-		Params.push_back(ShaderParam("deconrry", 0, 204, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Vertical Deconvergence Red Range"));
-		Params.push_back(ShaderParam("deconrgy", 0, 208, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Vertical Deconvergence Green Range"));
-		Params.push_back(ShaderParam("deconrby", 0, 212, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Vertical Deconvergence Blue Range"));
-		Params.push_back(ShaderParam("dctypex", 0, 216, 4, 0.000000f, 0.750000f, 0.000000f, 0.050000f, "Deconvergence type X : 0.0 - static, other - dynamic"));
-		Params.push_back(ShaderParam("dctypey", 0, 220, 4, 0.000000f, 0.750000f, 0.000000f, 0.050000f, "Deconvergence type Y : 0.0 - static, other - dynamic"));
-		Params.push_back(ShaderParam("post_br", 0, 224, 4, 0.250000f, 5.000000f, 1.000000f, 0.010000f, "Post Brightness"));
-		Params.push_back(ShaderParam("maskboost", 0, 228, 4, 1.000000f, 3.000000f, 1.000000f, 0.050000f, "CRT Mask Boost"));
-		Params.push_back(ShaderParam("smoothmask", 0, 232, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Smooth Masks in bright scanlines"));
-		Params.push_back(ShaderParam("gamma_c", 0, 236, 4, 0.500000f, 2.000000f, 1.000000f, 0.025000f, "Gamma correct"));
-		Params.push_back(ShaderParam("m_glow", 0, 240, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Ordinary Glow / Magic Glow"));
-		Params.push_back(ShaderParam("m_glow_low", 0, 244, 4, 0.000000f, 7.000000f, 0.350000f, 0.050000f, "Magic Glow Low Strength"));
-		Params.push_back(ShaderParam("m_glow_high", 0, 248, 4, 0.000000f, 7.000000f, 5.000000f, 0.100000f, "Magic Glow High Strength"));
-		Params.push_back(ShaderParam("m_glow_dist", 0, 252, 4, 0.200000f, 4.000000f, 1.000000f, 0.050000f, "Magic Glow Distribution"));
-		Params.push_back(ShaderParam("m_glow_mask", 0, 256, 4, 0.000000f, 2.000000f, 1.000000f, 0.025000f, "Magic Glow Mask Strength"));
-		Params.push_back(ShaderParam("smask_mit", 0, 260, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Mitigate Slotmask Interaction"));
-		Params.push_back(ShaderParam("mask_zoom", 0, 264, 4, -5.000000f, 5.000000f, 0.000000f, 1.000000f, "CRT Mask Zoom (+ mask width)"));
-		Params.push_back(ShaderParam("no_scanlines", 0, 268, 4, 0.000000f, 1.500000f, 0.000000f, 0.050000f, "No-scanline mode"));
-		Params.push_back(ShaderParam("bmask", 0, 272, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "Base (black) Mask strength"));
-		Params.push_back(ShaderParam("bmask1", 0, 276, 4, -1.000000f, 1.000000f, 0.000000f, 0.025000f, "Bloom Mask Strength"));
-		Params.push_back(ShaderParam("hmask1", 0, 280, 4, -1.000000f, 1.000000f, 0.500000f, 0.025000f, "Halation Mask Strength"));
-		Params.push_back(ShaderParam("mzoom_sh", 0, 284, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "CRT Mask Zoom Sharpen (needs Mask Zoom)"));
-		Params.push_back(ShaderParam("mclip", 0, 288, 4, 0.000000f, 1.000000f, 0.000000f, 0.025000f, "Preserve Mask Strength"));
-		Params.push_back(ShaderParam("TATE", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "TATE Mode"));
-		Params.push_back(ShaderParam("IOS", -1, 4, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Integer Scaling: Odd:Y, Even:'X'+Y"));
-		Params.push_back(ShaderParam("OS", -1, 8, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "R. Bloom Overscan Mode"));
-		Params.push_back(ShaderParam("BLOOM", -1, 12, 4, 0.000000f, 20.000000f, 0.000000f, 1.000000f, "Raster bloom %"));
-		Params.push_back(ShaderParam("brightboost", -1, 16, 4, 0.250000f, 10.000000f, 1.400000f, 0.050000f, "Bright Boost Dark Pixels"));
-		Params.push_back(ShaderParam("brightboost1", -1, 20, 4, 0.250000f, 3.000000f, 1.100000f, 0.025000f, "Bright Boost Bright Pixels"));
-		Params.push_back(ShaderParam("csize", -1, 24, 4, 0.000000f, 0.350000f, 0.000000f, 0.010000f, "Corner Size"));
-		Params.push_back(ShaderParam("bsize1", -1, 28, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Border Size"));
-		Params.push_back(ShaderParam("warpX", -1, 32, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureX (default 0.03)"));
-		Params.push_back(ShaderParam("warpY", -1, 36, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureY (default 0.04)"));
-		Params.push_back(ShaderParam("glow", -1, 40, 4, -2.000000f, 2.000000f, 0.080000f, 0.010000f, "(Magic) Glow Strength"));
-		Params.push_back(ShaderParam("shadowMask", -1, 44, 4, -1.000000f, 13.000000f, 0.000000f, 1.000000f, "CRT Mask: 0:CGWG, 1-4:Lottes, 5-13:'Trinitron'"));
-		Params.push_back(ShaderParam("masksize", -1, 48, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Mask Size"));
-		Params.push_back(ShaderParam("slotmask", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Bright Pixels"));
-		Params.push_back(ShaderParam("slotmask1", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Dark Pixels"));
-		Params.push_back(ShaderParam("slotwidth", -1, 60, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Slot Mask Width (0:Auto)"));
-		Params.push_back(ShaderParam("double_slot", -1, 64, 4, 1.000000f, 4.000000f, 2.000000f, 1.000000f, "Slot Mask Height: 2x1 or 4x1..."));
-		Params.push_back(ShaderParam("mcut", -1, 68, 4, 0.000000f, 2.000000f, 1.100000f, 0.050000f, "Mask 5-12 Low Strength"));
-		Params.push_back(ShaderParam("maskDark", -1, 72, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Lottes maskDark"));
-		Params.push_back(ShaderParam("maskLight", -1, 76, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Lottes maskLight"));
-		Params.push_back(ShaderParam("maskstr", -1, 80, 4, -0.500000f, 1.000000f, 0.300000f, 0.025000f, "Mask Strength (0, 5-12)"));
-		Params.push_back(ShaderParam("mshift", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.500000f, "(Transform to) Shadow Mask"));
-		Params.push_back(ShaderParam("mask_layout", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask Layout: RGB or BGR (check LCD panel)"));
-		Params.push_back(ShaderParam("mask_bloom", -1, 92, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Mask Bloom"));
-		Params.push_back(ShaderParam("hiscan", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "High Resolution Scanlines (prepend a scaler...)"));
-		Samplers.push_back(ShaderSampler("Source", 7));
-		Samplers.push_back(ShaderSampler("BloomPass", 5));
-		Samplers.push_back(ShaderSampler("GlowPass", 4));
-		Samplers.push_back(ShaderSampler("AvgLumPass", 3));
-		Samplers.push_back(ShaderSampler("LinearizePass", 2));
-		Samplers.push_back(ShaderSampler("PrePass", 6));
+	Name = "deconvergence";
+	VertexByteCode = RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedDeconvergenceShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("bloom", 0, 116, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Bloom Strength"));
+	Params.push_back(ShaderParam("halation", 0, 120, 4, -2.000000f, 2.000000f, 0.000000f, 0.025000f, "Halation Strength"));
+	Params.push_back(ShaderParam("slotms", 0, 124, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Slot Mask Thickness"));
+	Params.push_back(ShaderParam("mask_gamma", 0, 128, 4, 1.000000f, 5.000000f, 2.400000f, 0.050000f, "Mask gamma"));
+	Params.push_back(ShaderParam("gamma_out", 0, 132, 4, 1.000000f, 5.000000f, 2.400000f, 0.050000f, "Gamma out"));
+	Params.push_back(ShaderParam("overscanX", 0, 136, 4, -200.000000f, 200.000000f, 0.000000f, 1.000000f, "Overscan X original pixels"));
+	Params.push_back(ShaderParam("overscanY", 0, 140, 4, -200.000000f, 200.000000f, 0.000000f, 1.000000f, "Overscan Y original pixels"));
+	Params.push_back(ShaderParam("intres", 0, 144, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("c_shape", 0, 148, 4, 0.050000f, 0.600000f, 0.250000f, 0.050000f, "Curvature Shape"));
+	Params.push_back(ShaderParam("barspeed", 0, 152, 4, 5.000000f, 200.000000f, 50.000000f, 1.000000f, "Hum Bar Speed"));
+	Params.push_back(ShaderParam("barintensity", 0, 156, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hum Bar Intensity"));
+	Params.push_back(ShaderParam("bardir", 0, 160, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Hum Bar Direction"));
+	Params.push_back(ShaderParam("sborder", 0, 164, 4, 0.250000f, 2.000000f, 0.750000f, 0.050000f, "Border Intensity"));
+	Params.push_back(ShaderParam("bloom_dist", 0, 168, 4, -2.000000f, 3.000000f, 0.000000f, 0.050000f, "Bloom Distribution"));
+	Params.push_back(ShaderParam("deconr", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("decons", 0, 176, 4, 0.000000f, 3.000000f, 1.000000f, 0.100000f, "Deconvergence Strength"));
+	Params.push_back(ShaderParam("addnoised", 0, 180, 4, -1.000000f, 1.000000f, 0.000000f, 0.020000f, "Add Noise"));
+	Params.push_back(ShaderParam("noisetype", 0, 184, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Noise Type: Colored, Luma"));
+	Params.push_back(ShaderParam("noiseresd", 0, 188, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Noise Resolution"));
+	Params.push_back(ShaderParam("deconrr", 0, 192, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Horizontal Deconvergence Red Range"));
+	Params.push_back(ShaderParam("deconrg", 0, 196, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Horizontal Deconvergence Green Range"));
+	Params.push_back(ShaderParam("deconrb", 0, 200, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Horizontal Deconvergence Blue Range"));
+	Params.push_back(ShaderParam("deconrry", 0, 204, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Vertical Deconvergence Red Range"));
+	Params.push_back(ShaderParam("deconrgy", 0, 208, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Vertical Deconvergence Green Range"));
+	Params.push_back(ShaderParam("deconrby", 0, 212, 4, -15.000000f, 15.000000f, 0.000000f, 0.250000f, "Vertical Deconvergence Blue Range"));
+	Params.push_back(ShaderParam("dctypex", 0, 216, 4, 0.000000f, 0.750000f, 0.000000f, 0.050000f, "Deconvergence type X : 0.0 - static, other - dynamic"));
+	Params.push_back(ShaderParam("dctypey", 0, 220, 4, 0.000000f, 0.750000f, 0.000000f, 0.050000f, "Deconvergence type Y : 0.0 - static, other - dynamic"));
+	Params.push_back(ShaderParam("post_br", 0, 224, 4, 0.250000f, 5.000000f, 1.000000f, 0.010000f, "Post Brightness"));
+	Params.push_back(ShaderParam("maskboost", 0, 228, 4, 1.000000f, 3.000000f, 1.000000f, 0.050000f, "CRT Mask Boost"));
+	Params.push_back(ShaderParam("smoothmask", 0, 232, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Smooth Masks in bright scanlines"));
+	Params.push_back(ShaderParam("gamma_c", 0, 236, 4, 0.500000f, 2.000000f, 1.000000f, 0.025000f, "Gamma correct"));
+	Params.push_back(ShaderParam("m_glow", 0, 240, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Ordinary Glow / Magic Glow"));
+	Params.push_back(ShaderParam("m_glow_low", 0, 244, 4, 0.000000f, 7.000000f, 0.350000f, 0.050000f, "Magic Glow Low Strength"));
+	Params.push_back(ShaderParam("m_glow_high", 0, 248, 4, 0.000000f, 7.000000f, 5.000000f, 0.100000f, "Magic Glow High Strength"));
+	Params.push_back(ShaderParam("m_glow_dist", 0, 252, 4, 0.200000f, 4.000000f, 1.000000f, 0.050000f, "Magic Glow Distribution"));
+	Params.push_back(ShaderParam("m_glow_mask", 0, 256, 4, 0.000000f, 2.000000f, 1.000000f, 0.025000f, "Magic Glow Mask Strength"));
+	Params.push_back(ShaderParam("smask_mit", 0, 260, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Mitigate Slotmask Interaction"));
+	Params.push_back(ShaderParam("mask_zoom", 0, 264, 4, -5.000000f, 5.000000f, 0.000000f, 1.000000f, "CRT Mask Zoom (+ mask width)"));
+	Params.push_back(ShaderParam("no_scanlines", 0, 268, 4, 0.000000f, 1.500000f, 0.000000f, 0.050000f, "No-scanline mode"));
+	Params.push_back(ShaderParam("bmask", 0, 272, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "Base (black) Mask strength"));
+	Params.push_back(ShaderParam("bmask1", 0, 276, 4, -1.000000f, 1.000000f, 0.000000f, 0.025000f, "Bloom Mask Strength"));
+	Params.push_back(ShaderParam("hmask1", 0, 280, 4, -1.000000f, 1.000000f, 0.500000f, 0.025000f, "Halation Mask Strength"));
+	Params.push_back(ShaderParam("mzoom_sh", 0, 284, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "CRT Mask Zoom Sharpen (needs Mask Zoom)"));
+	Params.push_back(ShaderParam("mclip", 0, 288, 4, 0.000000f, 1.000000f, 0.000000f, 0.025000f, "Preserve Mask Strength"));
+	Params.push_back(ShaderParam("TATE", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "TATE Mode"));
+	Params.push_back(ShaderParam("IOS", -1, 4, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Integer Scaling: Odd:Y, Even:'X'+Y"));
+	Params.push_back(ShaderParam("OS", -1, 8, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "R. Bloom Overscan Mode"));
+	Params.push_back(ShaderParam("BLOOM", -1, 12, 4, 0.000000f, 20.000000f, 0.000000f, 1.000000f, "Raster bloom %"));
+	Params.push_back(ShaderParam("brightboost", -1, 16, 4, 0.250000f, 10.000000f, 1.400000f, 0.050000f, "Bright Boost Dark Pixels"));
+	Params.push_back(ShaderParam("brightboost1", -1, 20, 4, 0.250000f, 3.000000f, 1.100000f, 0.025000f, "Bright Boost Bright Pixels"));
+	Params.push_back(ShaderParam("csize", -1, 24, 4, 0.000000f, 0.350000f, 0.000000f, 0.010000f, "Corner Size"));
+	Params.push_back(ShaderParam("bsize1", -1, 28, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Border Size"));
+	Params.push_back(ShaderParam("warpX", -1, 32, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureX (default 0.03)"));
+	Params.push_back(ShaderParam("warpY", -1, 36, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureY (default 0.04)"));
+	Params.push_back(ShaderParam("glow", -1, 40, 4, -2.000000f, 2.000000f, 0.080000f, 0.010000f, "(Magic) Glow Strength"));
+	Params.push_back(ShaderParam("shadowMask", -1, 44, 4, -1.000000f, 13.000000f, 0.000000f, 1.000000f, "CRT Mask: 0:CGWG, 1-4:Lottes, 5-13:'Trinitron'"));
+	Params.push_back(ShaderParam("masksize", -1, 48, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Mask Size"));
+	Params.push_back(ShaderParam("slotmask", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Bright Pixels"));
+	Params.push_back(ShaderParam("slotmask1", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Dark Pixels"));
+	Params.push_back(ShaderParam("slotwidth", -1, 60, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Slot Mask Width (0:Auto)"));
+	Params.push_back(ShaderParam("double_slot", -1, 64, 4, 1.000000f, 4.000000f, 2.000000f, 1.000000f, "Slot Mask Height: 2x1 or 4x1..."));
+	Params.push_back(ShaderParam("mcut", -1, 68, 4, 0.000000f, 2.000000f, 1.100000f, 0.050000f, "Mask 5-12 Low Strength"));
+	Params.push_back(ShaderParam("maskDark", -1, 72, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Lottes maskDark"));
+	Params.push_back(ShaderParam("maskLight", -1, 76, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Lottes maskLight"));
+	Params.push_back(ShaderParam("maskstr", -1, 80, 4, -0.500000f, 1.000000f, 0.300000f, 0.025000f, "Mask Strength (0, 5-12)"));
+	Params.push_back(ShaderParam("mshift", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.500000f, "(Transform to) Shadow Mask"));
+	Params.push_back(ShaderParam("mask_layout", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask Layout: RGB or BGR (check LCD panel)"));
+	Params.push_back(ShaderParam("mask_bloom", -1, 92, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Mask Bloom"));
+	Params.push_back(ShaderParam("hiscan", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "High Resolution Scanlines (prepend a scaler...)"));
+	Samplers.push_back(ShaderSampler("Source", 7));
+	Samplers.push_back(ShaderSampler("BloomPass", 5));
+	Samplers.push_back(ShaderSampler("GlowPass", 4));
+	Samplers.push_back(ShaderSampler("AvgLumPass", 3));
+	Samplers.push_back(ShaderSampler("LinearizePass", 2));
+	Samplers.push_back(ShaderSampler("PrePass", 6));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
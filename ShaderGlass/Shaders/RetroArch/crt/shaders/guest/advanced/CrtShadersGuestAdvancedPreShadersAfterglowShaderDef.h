@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestAdvancedPreShadersAfterglowShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestAdvancedPreShadersAfterglowShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1856,52 +1867,46 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestAdvancedPreShadersAfterglowShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestAdvancedPreShadersAfterglowShaderDef::CrtShadersGuestAdvancedPreShadersAfterglowShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestAdvancedPreShadersAfterglowShaderDef() : ShaderDef{}
-	{
-		Name = "pre-shaders-afterglow";
-		VertexByteCode = RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("TNTC", -1, 52, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "LUT Colors: Trin.1 | Trin.2 | Nec Mult. | NTSC"));
-		Params.push_back(ShaderParam("LS", -1, 56, 4, 16.000000f, 64.000000f, 32.000000f, 16.000000f, "LUT Size"));
-		Params.push_back(ShaderParam("LUTLOW", -1, 60, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUTBR", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CP", -1, 68, 4, -1.000000f, 5.000000f, 0.000000f, 1.000000f, "CRT Profile: EBU | P22 | SMPTE-C | Philips | Trin."));
-		Params.push_back(ShaderParam("CS", -1, 72, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Display Gamut: sRGB, Modern, DCI, Adobe, Rec.2020"));
-		Params.push_back(ShaderParam("WP", -1, 76, 4, -100.000000f, 100.000000f, 0.000000f, 5.000000f, "Color Temperature %"));
-		Params.push_back(ShaderParam("wp_saturation", -1, 80, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation Adjustment"));
-		Params.push_back(ShaderParam("AS", -1, 84, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Afterglow Strength"));
-		Params.push_back(ShaderParam("sat", -1, 88, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Afterglow saturation"));
-		Params.push_back(ShaderParam("BP", -1, 92, 4, -100.000000f, 25.000000f, 0.000000f, 1.000000f, "Raise Black Level"));
-		Params.push_back(ShaderParam("vigstr", -1, 96, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Vignette Strength"));
-		Params.push_back(ShaderParam("vigdef", -1, 100, 4, 0.500000f, 3.000000f, 1.000000f, 0.100000f, "Vignette Size"));
-		Params.push_back(ShaderParam("sega_fix", -1, 104, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sega Brightness Fix"));
-		Params.push_back(ShaderParam("pre_bb", -1, 108, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness Adjustment"));
-		Params.push_back(ShaderParam("contr", -1, 112, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Contrast Adjustment"));
-		Samplers.push_back(ShaderSampler("StockPass", 2));
-		Samplers.push_back(ShaderSampler("AfterglowPass", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 4));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 5));
-		Samplers.push_back(ShaderSampler("SamplerLUT3", 6));
-		Samplers.push_back(ShaderSampler("SamplerLUT4", 7));
+	Name = "pre-shaders-afterglow";
+	VertexByteCode = RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedPreShadersAfterglowShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("TNTC", -1, 52, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "LUT Colors: Trin.1 | Trin.2 | Nec Mult. | NTSC"));
+	Params.push_back(ShaderParam("LS", -1, 56, 4, 16.000000f, 64.000000f, 32.000000f, 16.000000f, "LUT Size"));
+	Params.push_back(ShaderParam("LUTLOW", -1, 60, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUTBR", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CP", -1, 68, 4, -1.000000f, 5.000000f, 0.000000f, 1.000000f, "CRT Profile: EBU | P22 | SMPTE-C | Philips | Trin."));
+	Params.push_back(ShaderParam("CS", -1, 72, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Display Gamut: sRGB, Modern, DCI, Adobe, Rec.2020"));
+	Params.push_back(ShaderParam("WP", -1, 76, 4, -100.000000f, 100.000000f, 0.000000f, 5.000000f, "Color Temperature %"));
+	Params.push_back(ShaderParam("wp_saturation", -1, 80, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation Adjustment"));
+	Params.push_back(ShaderParam("AS", -1, 84, 4, 0.000000f, 0.600000f, 0.200000f, 0.010000f, "Afterglow Strength"));
+	Params.push_back(ShaderParam("sat", -1, 88, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Afterglow saturation"));
+	Params.push_back(ShaderParam("BP", -1, 92, 4, -100.000000f, 25.000000f, 0.000000f, 1.000000f, "Raise Black Level"));
+	Params.push_back(ShaderParam("vigstr", -1, 96, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Vignette Strength"));
+	Params.push_back(ShaderParam("vigdef", -1, 100, 4, 0.500000f, 3.000000f, 1.000000f, 0.100000f, "Vignette Size"));
+	Params.push_back(ShaderParam("sega_fix", -1, 104, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sega Brightness Fix"));
+	Params.push_back(ShaderParam("pre_bb", -1, 108, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness Adjustment"));
+	Params.push_back(ShaderParam("contr", -1, 112, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Contrast Adjustment"));
+	Samplers.push_back(ShaderSampler("StockPass", 2));
+	Samplers.push_back(ShaderSampler("AfterglowPass", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 4));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 5));
+	Samplers.push_back(ShaderSampler("SamplerLUT3", 6));
+	Samplers.push_back(ShaderSampler("SamplerLUT4", 7));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
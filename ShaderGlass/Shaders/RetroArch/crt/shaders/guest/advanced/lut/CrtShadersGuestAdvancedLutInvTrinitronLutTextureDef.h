@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef : public TextureDef
+{
+public:
+	CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGuestAdvancedLutInvTrinitronLutTextureDefs
 {
 const BYTE sData[] =
@@ -403,13 +411,10 @@ const BYTE sData[] =
 ,97,160,169,141,1,253,127,184,120,207,21,124,102,7,129,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef : public TextureDef
+CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef::CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef() : TextureDef{}
-	{
-		Name = "inv-trinitron-lut.png";
-		Data = CrtShadersGuestAdvancedLutInvTrinitronLutTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGuestAdvancedLutInvTrinitronLutTextureDefs::sData);
-	}
-};
+	Name = "inv-trinitron-lut.png";
+	Data = CrtShadersGuestAdvancedLutInvTrinitronLutTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGuestAdvancedLutInvTrinitronLutTextureDefs::sData);
+}
+#endif
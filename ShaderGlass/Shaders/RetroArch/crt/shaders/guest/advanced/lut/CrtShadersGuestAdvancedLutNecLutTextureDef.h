@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGuestAdvancedLutNecLutTextureDef : public TextureDef
+{
+public:
+	CrtShadersGuestAdvancedLutNecLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGuestAdvancedLutNecLutTextureDefs
 {
 const BYTE sData[] =
@@ -394,13 +402,10 @@ const BYTE sData[] =
 ,66,96,130};
 }
 
-class CrtShadersGuestAdvancedLutNecLutTextureDef : public TextureDef
+CrtShadersGuestAdvancedLutNecLutTextureDef::CrtShadersGuestAdvancedLutNecLutTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGuestAdvancedLutNecLutTextureDef() : TextureDef{}
-	{
-		Name = "nec-lut.png";
-		Data = CrtShadersGuestAdvancedLutNecLutTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGuestAdvancedLutNecLutTextureDefs::sData);
-	}
-};
+	Name = "nec-lut.png";
+	Data = CrtShadersGuestAdvancedLutNecLutTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGuestAdvancedLutNecLutTextureDefs::sData);
+}
+#endif
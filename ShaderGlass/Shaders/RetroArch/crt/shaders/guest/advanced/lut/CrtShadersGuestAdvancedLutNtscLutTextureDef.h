@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGuestAdvancedLutNtscLutTextureDef : public TextureDef
+{
+public:
+	CrtShadersGuestAdvancedLutNtscLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGuestAdvancedLutNtscLutTextureDefs
 {
 const BYTE sData[] =
@@ -566,13 +574,10 @@ const BYTE sData[] =
 ,192,13,66,6,131,144,115,193,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGuestAdvancedLutNtscLutTextureDef : public TextureDef
+CrtShadersGuestAdvancedLutNtscLutTextureDef::CrtShadersGuestAdvancedLutNtscLutTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGuestAdvancedLutNtscLutTextureDef() : TextureDef{}
-	{
-		Name = "ntsc-lut.png";
-		Data = CrtShadersGuestAdvancedLutNtscLutTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGuestAdvancedLutNtscLutTextureDefs::sData);
-	}
-};
+	Name = "ntsc-lut.png";
+	Data = CrtShadersGuestAdvancedLutNtscLutTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGuestAdvancedLutNtscLutTextureDefs::sData);
+}
+#endif
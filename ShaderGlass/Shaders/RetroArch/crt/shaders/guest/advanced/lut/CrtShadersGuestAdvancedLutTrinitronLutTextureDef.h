@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersGuestAdvancedLutTrinitronLutTextureDef : public TextureDef
+{
+public:
+	CrtShadersGuestAdvancedLutTrinitronLutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersGuestAdvancedLutTrinitronLutTextureDefs
 {
 const BYTE sData[] =
@@ -384,13 +392,10 @@ const BYTE sData[] =
 ,64,254,94,197,255,15,70,163,51,220,200,215,122,45,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersGuestAdvancedLutTrinitronLutTextureDef : public TextureDef
+CrtShadersGuestAdvancedLutTrinitronLutTextureDef::CrtShadersGuestAdvancedLutTrinitronLutTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersGuestAdvancedLutTrinitronLutTextureDef() : TextureDef{}
-	{
-		Name = "trinitron-lut.png";
-		Data = CrtShadersGuestAdvancedLutTrinitronLutTextureDefs::sData;
-		DataLength = sizeof(CrtShadersGuestAdvancedLutTrinitronLutTextureDefs::sData);
-	}
-};
+	Name = "trinitron-lut.png";
+	Data = CrtShadersGuestAdvancedLutTrinitronLutTextureDefs::sData;
+	DataLength = sizeof(CrtShadersGuestAdvancedLutTrinitronLutTextureDefs::sData);
+}
+#endif
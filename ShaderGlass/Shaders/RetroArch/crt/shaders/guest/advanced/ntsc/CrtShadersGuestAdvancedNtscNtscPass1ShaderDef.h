@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestAdvancedNtscNtscPass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestAdvancedNtscNtscPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1750,43 +1761,37 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestAdvancedNtscNtscPass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestAdvancedNtscNtscPass1ShaderDef::CrtShadersGuestAdvancedNtscNtscPass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestAdvancedNtscNtscPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-pass1";
-		VertexByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("quality", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 1.000000f, "INFO --> A&F Values: Svideo = 0.0 | Composite = 1.0 | RF = 2.0"));
-		Params.push_back(ShaderParam("ntsc_sat", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "NTSC Color Saturation"));
-		Params.push_back(ShaderParam("cust_fringing", -1, 60, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "NTSC Fringing Value"));
-		Params.push_back(ShaderParam("cust_artifacting", -1, 64, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "NTSC Artifacting Value"));
-		Params.push_back(ShaderParam("ntsc_bright", -1, 68, 4, 0.000000f, 1.500000f, 1.000000f, 0.010000f, "NTSC Brightness"));
-		Params.push_back(ShaderParam("ntsc_scale", -1, 72, 4, 0.200000f, 2.500000f, 1.000000f, 0.025000f, "NTSC Resolution Scaling"));
-		Params.push_back(ShaderParam("ntsc_fields", -1, 76, 4, -1.000000f, 1.000000f, -1.000000f, 1.000000f, "NTSC Merge Fields: Auto | NO | YES"));
-		Params.push_back(ShaderParam("ntsc_phase", -1, 80, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "NTSC Phase: Auto | 2 phase | 3 phase | Mixed"));
-		Params.push_back(ShaderParam("ntsc_gamma", -1, 84, 4, 0.250000f, 2.500000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
-		Params.push_back(ShaderParam("ntsc_rainbow1", -1, 88, 4, -1.000000f, 1.000000f, 0.000000f, 0.100000f, "NTSC Coloring/Rainbow Effect"));
-		Params.push_back(ShaderParam("ntsc_taps", -1, 92, 4, 6.000000f, 32.000000f, 32.000000f, 1.000000f, "NTSC # of Taps (Filter Width)"));
-		Params.push_back(ShaderParam("auto_res", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SNES/Amiga Hi-Res Auto Mode"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-pass1";
+	VertexByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("quality", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 1.000000f, "INFO --> A&F Values: Svideo = 0.0 | Composite = 1.0 | RF = 2.0"));
+	Params.push_back(ShaderParam("ntsc_sat", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "NTSC Color Saturation"));
+	Params.push_back(ShaderParam("cust_fringing", -1, 60, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "NTSC Fringing Value"));
+	Params.push_back(ShaderParam("cust_artifacting", -1, 64, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "NTSC Artifacting Value"));
+	Params.push_back(ShaderParam("ntsc_bright", -1, 68, 4, 0.000000f, 1.500000f, 1.000000f, 0.010000f, "NTSC Brightness"));
+	Params.push_back(ShaderParam("ntsc_scale", -1, 72, 4, 0.200000f, 2.500000f, 1.000000f, 0.025000f, "NTSC Resolution Scaling"));
+	Params.push_back(ShaderParam("ntsc_fields", -1, 76, 4, -1.000000f, 1.000000f, -1.000000f, 1.000000f, "NTSC Merge Fields: Auto | NO | YES"));
+	Params.push_back(ShaderParam("ntsc_phase", -1, 80, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "NTSC Phase: Auto | 2 phase | 3 phase | Mixed"));
+	Params.push_back(ShaderParam("ntsc_gamma", -1, 84, 4, 0.250000f, 2.500000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
+	Params.push_back(ShaderParam("ntsc_rainbow1", -1, 88, 4, -1.000000f, 1.000000f, 0.000000f, 0.100000f, "NTSC Coloring/Rainbow Effect"));
+	Params.push_back(ShaderParam("ntsc_taps", -1, 92, 4, 6.000000f, 32.000000f, 32.000000f, 1.000000f, "NTSC # of Taps (Filter Width)"));
+	Params.push_back(ShaderParam("auto_res", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SNES/Amiga Hi-Res Auto Mode"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
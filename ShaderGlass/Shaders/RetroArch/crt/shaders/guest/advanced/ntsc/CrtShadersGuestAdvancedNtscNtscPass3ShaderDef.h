@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestAdvancedNtscNtscPass3ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestAdvancedNtscNtscPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1015,35 +1026,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestAdvancedNtscNtscPass3ShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestAdvancedNtscNtscPass3ShaderDef::CrtShadersGuestAdvancedNtscNtscPass3ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestAdvancedNtscNtscPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-pass3";
-		VertexByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("auto_res", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SNES/Amiga Hi-Res Auto Mode"));
-		Params.push_back(ShaderParam("ntsc_sharp", -1, 52, 4, -10.000000f, 10.000000f, 0.000000f, 0.500000f, "NTSC Sharpness (negative: Adaptive)"));
-		Params.push_back(ShaderParam("ntsc_shape", -1, 56, 4, 0.500000f, 1.000000f, 0.750000f, 0.050000f, "NTSC Sharpness Shape"));
-		Params.push_back(ShaderParam("ntsc_gamma", -1, 60, 4, 0.250000f, 2.500000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("NPass1", 3));
+	Name = "ntsc-pass3";
+	VertexByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestAdvancedNtscNtscPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("auto_res", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SNES/Amiga Hi-Res Auto Mode"));
+	Params.push_back(ShaderParam("ntsc_sharp", -1, 52, 4, -10.000000f, 10.000000f, 0.000000f, 0.500000f, "NTSC Sharpness (negative: Adaptive)"));
+	Params.push_back(ShaderParam("ntsc_shape", -1, 56, 4, 0.500000f, 1.000000f, 0.750000f, 0.050000f, "NTSC Sharpness Shape"));
+	Params.push_back(ShaderParam("ntsc_gamma", -1, 60, 4, 0.250000f, 2.500000f, 1.000000f, 0.025000f, "NTSC Filtering Gamma Correction"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("NPass1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
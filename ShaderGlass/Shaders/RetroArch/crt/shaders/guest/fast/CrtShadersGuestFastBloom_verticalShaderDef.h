@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestFastBloom_verticalShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestFastBloom_verticalShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestFastBloom_verticalShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -620,34 +631,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestFastBloom_verticalShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestFastBloom_verticalShaderDef::CrtShadersGuestFastBloom_verticalShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestFastBloom_verticalShaderDef() : ShaderDef{}
-	{
-		Name = "bloom_vertical";
-		VertexByteCode = RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIZEVB", -1, 52, 4, 1.000000f, 50.000000f, 3.000000f, 1.000000f, "Vertical Bloom/Halation Radius"));
-		Params.push_back(ShaderParam("SIGMA_VB", -1, 56, 4, 0.250000f, 15.000000f, 0.600000f, 0.025000f, "Vertical Bloom/Halation Sigma"));
-		Params.push_back(ShaderParam("FINE_BLOOM", -1, 60, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Fine Bloom/Halation Sampling"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bloom_vertical";
+	VertexByteCode = RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestFastBloom_verticalShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIZEVB", -1, 52, 4, 1.000000f, 50.000000f, 3.000000f, 1.000000f, "Vertical Bloom/Halation Radius"));
+	Params.push_back(ShaderParam("SIGMA_VB", -1, 56, 4, 0.250000f, 15.000000f, 0.600000f, 0.025000f, "Vertical Bloom/Halation Sigma"));
+	Params.push_back(ShaderParam("FINE_BLOOM", -1, 60, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Fine Bloom/Halation Sampling"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1039,36 +1050,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef::CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-guest-advanced-pass1";
-		VertexByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("IOS", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("h_sharp", -1, 56, 4, 0.200000f, 15.000000f, 5.200000f, 0.100000f, "Horizontal sharpness"));
-		Params.push_back(ShaderParam("s_sharp", -1, 60, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "Substractive sharpness (1.0 recommended)"));
-		Params.push_back(ShaderParam("spike", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Scanline Spike Removal"));
-		Params.push_back(ShaderParam("ring", -1, 68, 4, 0.000000f, 3.000000f, 0.000000f, 0.050000f, "Substractive sharpness Ringing"));
-		Samplers.push_back(ShaderSampler("LinearizePass", 2));
+	Name = "crt-guest-advanced-pass1";
+	VertexByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("IOS", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("h_sharp", -1, 56, 4, 0.200000f, 15.000000f, 5.200000f, 0.100000f, "Horizontal sharpness"));
+	Params.push_back(ShaderParam("s_sharp", -1, 60, 4, 0.000000f, 2.000000f, 0.500000f, 0.100000f, "Substractive sharpness (1.0 recommended)"));
+	Params.push_back(ShaderParam("spike", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Scanline Spike Removal"));
+	Params.push_back(ShaderParam("ring", -1, 68, 4, 0.000000f, 3.000000f, 0.000000f, 0.050000f, "Substractive sharpness Ringing"));
+	Samplers.push_back(ShaderSampler("LinearizePass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
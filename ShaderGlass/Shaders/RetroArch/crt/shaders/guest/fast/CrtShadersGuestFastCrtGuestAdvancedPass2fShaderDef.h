@@ -30,6 +30,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -7418,85 +7429,79 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef::CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef() : ShaderDef{}
-	{
-		Name = "crt-guest-advanced-pass2f";
-		VertexByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpX", 0, 116, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureX (default 0.03)"));
-		Params.push_back(ShaderParam("warpY", 0, 120, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureY (default 0.04)"));
-		Params.push_back(ShaderParam("csize", 0, 124, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "Corner Size"));
-		Params.push_back(ShaderParam("bsize", 0, 128, 4, 100.000000f, 700.000000f, 400.000000f, 10.000000f, "Border smoothness"));
-		Params.push_back(ShaderParam("c_shape", 0, 132, 4, 0.050000f, 0.600000f, 0.250000f, 0.050000f, "Curvature Shape"));
-		Params.push_back(ShaderParam("scan_falloff", 0, 136, 4, 0.100000f, 2.000000f, 1.000000f, 0.050000f, "Scanline Falloff"));
-		Params.push_back(ShaderParam("bloom_dist", 0, 140, 4, 0.000000f, 3.000000f, 0.000000f, 0.050000f, "Bloom Distribution"));
-		Params.push_back(ShaderParam("mshift", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.500000f, "(Transform to) Shadow Mask"));
-		Params.push_back(ShaderParam("mask_layout", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask Layout: RGB or BGR (check LCD panel)"));
-		Params.push_back(ShaderParam("maskboost", 0, 152, 4, 1.000000f, 3.000000f, 1.000000f, 0.050000f, "CRT Mask Boost"));
-		Params.push_back(ShaderParam("no_scanlines", 0, 156, 4, 0.000000f, 1.500000f, 0.000000f, 0.050000f, "No-scanline mode"));
-		Params.push_back(ShaderParam("intres", 0, 160, 4, 0.000000f, 3.000000f, 0.000000f, 0.500000f, "Internal Resolution Y: 0.5...y-dowsample"));
-		Params.push_back(ShaderParam("smask_mit", 0, 164, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Mitigate Slotmask Interaction"));
-		Params.push_back(ShaderParam("mask_bloom", 0, 168, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Mask Bloom"));
-		Params.push_back(ShaderParam("mask_zoom", 0, 172, 4, -5.000000f, 5.000000f, 0.000000f, 1.000000f, "CRT Mask Zoom (+ mask width)"));
-		Params.push_back(ShaderParam("mzoom_sh", 0, 176, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "CRT Mask Zoom Sharpen (needs Mask Zoom)"));
-		Params.push_back(ShaderParam("hmask1", 0, 180, 4, -1.000000f, 1.000000f, 0.500000f, 0.025000f, "Halation Mask Strength"));
-		Params.push_back(ShaderParam("bloom_size", 0, 184, 4, 0.000000f, 1.000000f, 0.750000f, 0.050000f, "Bloom/Halation Size"));
-		Params.push_back(ShaderParam("scans", 0, 188, 4, 0.000000f, 6.000000f, 0.500000f, 0.100000f, "Scanline Saturation / Mask Falloff"));
-		Params.push_back(ShaderParam("post_br", 0, 192, 4, 0.250000f, 5.000000f, 1.000000f, 0.010000f, "Post Brightness"));
-		Params.push_back(ShaderParam("brightboost", -1, 0, 4, 0.250000f, 10.000000f, 1.400000f, 0.050000f, "Bright Boost Dark Pixels"));
-		Params.push_back(ShaderParam("brightboost1", -1, 4, 4, 0.250000f, 3.000000f, 1.100000f, 0.025000f, "Bright Boost Bright Pixels"));
-		Params.push_back(ShaderParam("gsl", -1, 8, 4, -1.000000f, 2.000000f, 0.000000f, 1.000000f, "Scanline Type"));
-		Params.push_back(ShaderParam("scanline1", -1, 12, 4, -20.000000f, 40.000000f, 6.000000f, 0.500000f, "Scanline Beam Shape Center"));
-		Params.push_back(ShaderParam("scanline2", -1, 16, 4, 0.000000f, 70.000000f, 8.000000f, 1.000000f, "Scanline Beam Shape Edges"));
-		Params.push_back(ShaderParam("beam_min", -1, 20, 4, 0.250000f, 10.000000f, 1.300000f, 0.050000f, "Scanline Shape Dark Pixels"));
-		Params.push_back(ShaderParam("beam_max", -1, 24, 4, 0.200000f, 3.500000f, 1.000000f, 0.025000f, "Scanline Shape Bright Pixels"));
-		Params.push_back(ShaderParam("beam_size", -1, 28, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Increased Bright Scanline Beam"));
-		Params.push_back(ShaderParam("shadowMask", -1, 32, 4, -1.000000f, 13.000000f, 0.000000f, 1.000000f, "CRT Mask: 0:CGWG, 1-4:Lottes, 5-13:'Trinitron'"));
-		Params.push_back(ShaderParam("masksize", -1, 36, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Mask Size"));
-		Params.push_back(ShaderParam("vertmask", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.100000f, "Scanline Color Deconvergence"));
-		Params.push_back(ShaderParam("slotmask", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Bright Pixels"));
-		Params.push_back(ShaderParam("slotmask1", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Dark Pixels"));
-		Params.push_back(ShaderParam("slotwidth", -1, 52, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Slot Mask Width (0:Auto)"));
-		Params.push_back(ShaderParam("double_slot", -1, 56, 4, 1.000000f, 4.000000f, 2.000000f, 1.000000f, "Slot Mask Height: 2x1 or 4x1..."));
-		Params.push_back(ShaderParam("mcut", -1, 60, 4, 0.000000f, 2.000000f, 1.100000f, 0.050000f, "Mask 5-12 Low Strength"));
-		Params.push_back(ShaderParam("maskDark", -1, 64, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Lottes maskDark"));
-		Params.push_back(ShaderParam("maskLight", -1, 68, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Lottes maskLight"));
-		Params.push_back(ShaderParam("maskstr", -1, 72, 4, -0.500000f, 1.000000f, 0.300000f, 0.025000f, "Mask Strength (0, 5-12)"));
-		Params.push_back(ShaderParam("inters", -1, 76, 4, 0.000000f, 0.500000f, 0.000000f, 0.050000f, "Interlacing Effect Smoothness"));
-		Params.push_back(ShaderParam("bloom", -1, 80, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Bloom Strength"));
-		Params.push_back(ShaderParam("halation", -1, 84, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Halation Strength"));
-		Params.push_back(ShaderParam("slotms", -1, 88, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Slot Mask Thickness"));
-		Params.push_back(ShaderParam("gamma_c", -1, 92, 4, 0.500000f, 2.000000f, 1.000000f, 0.025000f, "Gamma correct"));
-		Params.push_back(ShaderParam("gamma_out", -1, 96, 4, 1.000000f, 5.000000f, 2.400000f, 0.050000f, "Gamma out"));
-		Params.push_back(ShaderParam("DER", -1, 100, 4, -15.000000f, 15.000000f, 0.000000f, 0.050000f, "Deconvergence Red offset"));
-		Params.push_back(ShaderParam("DEG", -1, 104, 4, -15.000000f, 15.000000f, 0.000000f, 0.050000f, "Deconvergence Green offset"));
-		Params.push_back(ShaderParam("DEB", -1, 108, 4, -15.000000f, 15.000000f, 0.000000f, 0.050000f, "Deconvergence Blue offset"));
-		Params.push_back(ShaderParam("DES", -1, 112, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "Deconvergence Strength"));
-		Params.push_back(ShaderParam("IOS", -1, 116, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Integer Scaling: Odd:Y, Even:'X'+Y"));
-		Params.push_back(ShaderParam("clips", -1, 120, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Clip Saturated Color Beams"));
-		Samplers.push_back(ShaderSampler("LinearizePass", 3));
-		Samplers.push_back(ShaderSampler("Pass2Feedback", 5));
-		Samplers.push_back(ShaderSampler("PerfPass", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-guest-advanced-pass2f";
+	VertexByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestFastCrtGuestAdvancedPass2fShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpX", 0, 116, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureX (default 0.03)"));
+	Params.push_back(ShaderParam("warpY", 0, 120, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "CurvatureY (default 0.04)"));
+	Params.push_back(ShaderParam("csize", 0, 124, 4, 0.000000f, 0.250000f, 0.000000f, 0.010000f, "Corner Size"));
+	Params.push_back(ShaderParam("bsize", 0, 128, 4, 100.000000f, 700.000000f, 400.000000f, 10.000000f, "Border smoothness"));
+	Params.push_back(ShaderParam("c_shape", 0, 132, 4, 0.050000f, 0.600000f, 0.250000f, 0.050000f, "Curvature Shape"));
+	Params.push_back(ShaderParam("scan_falloff", 0, 136, 4, 0.100000f, 2.000000f, 1.000000f, 0.050000f, "Scanline Falloff"));
+	Params.push_back(ShaderParam("bloom_dist", 0, 140, 4, 0.000000f, 3.000000f, 0.000000f, 0.050000f, "Bloom Distribution"));
+	Params.push_back(ShaderParam("mshift", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.500000f, "(Transform to) Shadow Mask"));
+	Params.push_back(ShaderParam("mask_layout", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask Layout: RGB or BGR (check LCD panel)"));
+	Params.push_back(ShaderParam("maskboost", 0, 152, 4, 1.000000f, 3.000000f, 1.000000f, 0.050000f, "CRT Mask Boost"));
+	Params.push_back(ShaderParam("no_scanlines", 0, 156, 4, 0.000000f, 1.500000f, 0.000000f, 0.050000f, "No-scanline mode"));
+	Params.push_back(ShaderParam("intres", 0, 160, 4, 0.000000f, 3.000000f, 0.000000f, 0.500000f, "Internal Resolution Y: 0.5...y-dowsample"));
+	Params.push_back(ShaderParam("smask_mit", 0, 164, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Mitigate Slotmask Interaction"));
+	Params.push_back(ShaderParam("mask_bloom", 0, 168, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Mask Bloom"));
+	Params.push_back(ShaderParam("mask_zoom", 0, 172, 4, -5.000000f, 5.000000f, 0.000000f, 1.000000f, "CRT Mask Zoom (+ mask width)"));
+	Params.push_back(ShaderParam("mzoom_sh", 0, 176, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "CRT Mask Zoom Sharpen (needs Mask Zoom)"));
+	Params.push_back(ShaderParam("hmask1", 0, 180, 4, -1.000000f, 1.000000f, 0.500000f, 0.025000f, "Halation Mask Strength"));
+	Params.push_back(ShaderParam("bloom_size", 0, 184, 4, 0.000000f, 1.000000f, 0.750000f, 0.050000f, "Bloom/Halation Size"));
+	Params.push_back(ShaderParam("scans", 0, 188, 4, 0.000000f, 6.000000f, 0.500000f, 0.100000f, "Scanline Saturation / Mask Falloff"));
+	Params.push_back(ShaderParam("post_br", 0, 192, 4, 0.250000f, 5.000000f, 1.000000f, 0.010000f, "Post Brightness"));
+	Params.push_back(ShaderParam("brightboost", -1, 0, 4, 0.250000f, 10.000000f, 1.400000f, 0.050000f, "Bright Boost Dark Pixels"));
+	Params.push_back(ShaderParam("brightboost1", -1, 4, 4, 0.250000f, 3.000000f, 1.100000f, 0.025000f, "Bright Boost Bright Pixels"));
+	Params.push_back(ShaderParam("gsl", -1, 8, 4, -1.000000f, 2.000000f, 0.000000f, 1.000000f, "Scanline Type"));
+	Params.push_back(ShaderParam("scanline1", -1, 12, 4, -20.000000f, 40.000000f, 6.000000f, 0.500000f, "Scanline Beam Shape Center"));
+	Params.push_back(ShaderParam("scanline2", -1, 16, 4, 0.000000f, 70.000000f, 8.000000f, 1.000000f, "Scanline Beam Shape Edges"));
+	Params.push_back(ShaderParam("beam_min", -1, 20, 4, 0.250000f, 10.000000f, 1.300000f, 0.050000f, "Scanline Shape Dark Pixels"));
+	Params.push_back(ShaderParam("beam_max", -1, 24, 4, 0.200000f, 3.500000f, 1.000000f, 0.025000f, "Scanline Shape Bright Pixels"));
+	Params.push_back(ShaderParam("beam_size", -1, 28, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Increased Bright Scanline Beam"));
+	Params.push_back(ShaderParam("shadowMask", -1, 32, 4, -1.000000f, 13.000000f, 0.000000f, 1.000000f, "CRT Mask: 0:CGWG, 1-4:Lottes, 5-13:'Trinitron'"));
+	Params.push_back(ShaderParam("masksize", -1, 36, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "CRT Mask Size"));
+	Params.push_back(ShaderParam("vertmask", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.100000f, "Scanline Color Deconvergence"));
+	Params.push_back(ShaderParam("slotmask", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Bright Pixels"));
+	Params.push_back(ShaderParam("slotmask1", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Slot Mask Strength Dark Pixels"));
+	Params.push_back(ShaderParam("slotwidth", -1, 52, 4, 0.000000f, 16.000000f, 0.000000f, 1.000000f, "Slot Mask Width (0:Auto)"));
+	Params.push_back(ShaderParam("double_slot", -1, 56, 4, 1.000000f, 4.000000f, 2.000000f, 1.000000f, "Slot Mask Height: 2x1 or 4x1..."));
+	Params.push_back(ShaderParam("mcut", -1, 60, 4, 0.000000f, 2.000000f, 1.100000f, 0.050000f, "Mask 5-12 Low Strength"));
+	Params.push_back(ShaderParam("maskDark", -1, 64, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Lottes maskDark"));
+	Params.push_back(ShaderParam("maskLight", -1, 68, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Lottes maskLight"));
+	Params.push_back(ShaderParam("maskstr", -1, 72, 4, -0.500000f, 1.000000f, 0.300000f, 0.025000f, "Mask Strength (0, 5-12)"));
+	Params.push_back(ShaderParam("inters", -1, 76, 4, 0.000000f, 0.500000f, 0.000000f, 0.050000f, "Interlacing Effect Smoothness"));
+	Params.push_back(ShaderParam("bloom", -1, 80, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Bloom Strength"));
+	Params.push_back(ShaderParam("halation", -1, 84, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Halation Strength"));
+	Params.push_back(ShaderParam("slotms", -1, 88, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "Slot Mask Thickness"));
+	Params.push_back(ShaderParam("gamma_c", -1, 92, 4, 0.500000f, 2.000000f, 1.000000f, 0.025000f, "Gamma correct"));
+	Params.push_back(ShaderParam("gamma_out", -1, 96, 4, 1.000000f, 5.000000f, 2.400000f, 0.050000f, "Gamma out"));
+	Params.push_back(ShaderParam("DER", -1, 100, 4, -15.000000f, 15.000000f, 0.000000f, 0.050000f, "Deconvergence Red offset"));
+	Params.push_back(ShaderParam("DEG", -1, 104, 4, -15.000000f, 15.000000f, 0.000000f, 0.050000f, "Deconvergence Green offset"));
+	Params.push_back(ShaderParam("DEB", -1, 108, 4, -15.000000f, 15.000000f, 0.000000f, 0.050000f, "Deconvergence Blue offset"));
+	Params.push_back(ShaderParam("DES", -1, 112, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "Deconvergence Strength"));
+	Params.push_back(ShaderParam("IOS", -1, 116, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "Integer Scaling: Odd:Y, Even:'X'+Y"));
+	Params.push_back(ShaderParam("clips", -1, 120, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Clip Saturated Color Beams"));
+	Samplers.push_back(ShaderSampler("LinearizePass", 3));
+	Samplers.push_back(ShaderSampler("Pass2Feedback", 5));
+	Samplers.push_back(ShaderSampler("PerfPass", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestFastPerfPassShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestFastPerfPassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestFastPerfPassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -973,34 +984,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestFastPerfPassShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestFastPerfPassShaderDef::CrtShadersGuestFastPerfPassShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestFastPerfPassShaderDef() : ShaderDef{}
-	{
-		Name = "perf-pass";
-		VertexByteCode = RetroArchCrtShadersGuestFastPerfPassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestFastPerfPassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestFastPerfPassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestFastPerfPassShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("fcompat", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Compatibility Mode (slower, use if glitchy)"));
-		Params.push_back(ShaderParam("fbenchmode", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("PerfPassFeedback", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "perf-pass";
+	VertexByteCode = RetroArchCrtShadersGuestFastPerfPassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestFastPerfPassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestFastPerfPassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestFastPerfPassShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("fcompat", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Compatibility Mode (slower, use if glitchy)"));
+	Params.push_back(ShaderParam("fbenchmode", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("PerfPassFeedback", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestFastPreShadersfShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestFastPreShadersfShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestFastPreShadersfShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1423,47 +1434,41 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestFastPreShadersfShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestFastPreShadersfShaderDef::CrtShadersGuestFastPreShadersfShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestFastPreShadersfShaderDef() : ShaderDef{}
-	{
-		Name = "pre-shadersf";
-		VertexByteCode = RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("TNTC", -1, 52, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "LUT Colors: Trin.1 | Trin.2 | Nec Mult. | NTSC"));
-		Params.push_back(ShaderParam("LS", -1, 56, 4, 16.000000f, 64.000000f, 32.000000f, 16.000000f, "LUT Size"));
-		Params.push_back(ShaderParam("LUTLOW", -1, 60, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUTBR", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("WP", -1, 68, 4, -100.000000f, 100.000000f, 0.000000f, 5.000000f, "Color Temperature %"));
-		Params.push_back(ShaderParam("wp_saturation", -1, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation Adjustment"));
-		Params.push_back(ShaderParam("BP", -1, 76, 4, -100.000000f, 25.000000f, 0.000000f, 1.000000f, "Raise Black Level"));
-		Params.push_back(ShaderParam("vigstr", -1, 80, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Vignette Strength"));
-		Params.push_back(ShaderParam("vigdef", -1, 84, 4, 0.500000f, 3.000000f, 1.000000f, 0.100000f, "Vignette Size"));
-		Params.push_back(ShaderParam("sega_fix", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sega Brightness Fix"));
-		Params.push_back(ShaderParam("pre_bb", -1, 92, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness Adjustment"));
-		Params.push_back(ShaderParam("contr", -1, 96, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Contrast Adjustment"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
-		Samplers.push_back(ShaderSampler("SamplerLUT3", 5));
-		Samplers.push_back(ShaderSampler("SamplerLUT4", 6));
+	Name = "pre-shadersf";
+	VertexByteCode = RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestFastPreShadersfShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("TNTC", -1, 52, 4, 0.000000f, 4.000000f, 0.000000f, 1.000000f, "LUT Colors: Trin.1 | Trin.2 | Nec Mult. | NTSC"));
+	Params.push_back(ShaderParam("LS", -1, 56, 4, 16.000000f, 64.000000f, 32.000000f, 16.000000f, "LUT Size"));
+	Params.push_back(ShaderParam("LUTLOW", -1, 60, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUTBR", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("WP", -1, 68, 4, -100.000000f, 100.000000f, 0.000000f, 5.000000f, "Color Temperature %"));
+	Params.push_back(ShaderParam("wp_saturation", -1, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Saturation Adjustment"));
+	Params.push_back(ShaderParam("BP", -1, 76, 4, -100.000000f, 25.000000f, 0.000000f, 1.000000f, "Raise Black Level"));
+	Params.push_back(ShaderParam("vigstr", -1, 80, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Vignette Strength"));
+	Params.push_back(ShaderParam("vigdef", -1, 84, 4, 0.500000f, 3.000000f, 1.000000f, 0.100000f, "Vignette Size"));
+	Params.push_back(ShaderParam("sega_fix", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sega Brightness Fix"));
+	Params.push_back(ShaderParam("pre_bb", -1, 92, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness Adjustment"));
+	Params.push_back(ShaderParam("contr", -1, 96, 4, -2.000000f, 2.000000f, 0.000000f, 0.050000f, "Contrast Adjustment"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Samplers.push_back(ShaderSampler("SamplerLUT3", 5));
+	Samplers.push_back(ShaderSampler("SamplerLUT4", 6));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
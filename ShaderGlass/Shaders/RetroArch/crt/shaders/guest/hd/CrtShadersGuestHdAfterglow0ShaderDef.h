@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestHdAfterglow0ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestHdAfterglow0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestHdAfterglow0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -564,35 +575,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestHdAfterglow0ShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestHdAfterglow0ShaderDef::CrtShadersGuestHdAfterglow0ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestHdAfterglow0ShaderDef() : ShaderDef{}
-	{
-		Name = "afterglow0";
-		VertexByteCode = RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PR", -1, 52, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Red"));
-		Params.push_back(ShaderParam("PG", -1, 56, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Green"));
-		Params.push_back(ShaderParam("PB", -1, 60, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Blue"));
-		Samplers.push_back(ShaderSampler("OriginalHistory0", 2));
-		Samplers.push_back(ShaderSampler("AfterglowPassFeedback", 3));
+	Name = "afterglow0";
+	VertexByteCode = RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestHdAfterglow0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PR", -1, 52, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Red"));
+	Params.push_back(ShaderParam("PG", -1, 56, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Green"));
+	Params.push_back(ShaderParam("PB", -1, 60, 4, 0.000000f, 0.500000f, 0.320000f, 0.010000f, "Persistence Blue"));
+	Samplers.push_back(ShaderSampler("OriginalHistory0", 2));
+	Samplers.push_back(ShaderSampler("AfterglowPassFeedback", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1030,42 +1041,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef::CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-guest-advanced-hd-pass1";
-		VertexByteCode = RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIGMA_HOR", -1, 52, 4, 0.100000f, 7.000000f, 0.500000f, 0.025000f, "Horizontal Blur Sigma"));
-		Params.push_back(ShaderParam("HSHARPNESS", -1, 56, 4, 1.000000f, 8.000000f, 1.000000f, 0.050000f, "Horizontal Filter Range"));
-		Params.push_back(ShaderParam("S_SHARP", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Substractive Sharpness"));
-		Params.push_back(ShaderParam("HARNG", -1, 64, 4, 0.000000f, 4.000000f, 0.200000f, 0.100000f, "Substractive Sharpness Ringing"));
-		Params.push_back(ShaderParam("HSHARP", -1, 68, 4, 0.000000f, 2.000000f, 1.200000f, 0.100000f, "Sharpness Definition"));
-		Params.push_back(ShaderParam("spike", -1, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Scanline Spike Removal"));
-		Params.push_back(ShaderParam("SIGMA_VER", -1, 76, 4, 0.100000f, 7.000000f, 0.500000f, 0.025000f, "Vertical Blur Sigma"));
-		Params.push_back(ShaderParam("VSHARPNESS", -1, 80, 4, 1.000000f, 8.000000f, 1.000000f, 0.050000f, "Vertical Filter Range"));
-		Params.push_back(ShaderParam("internal_res", -1, 84, 4, 1.000000f, 8.000000f, 1.000000f, 0.100000f, "Internal Resolution"));
-		Params.push_back(ShaderParam("auto_res", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SNES/Amiga Hi-Res Auto Mode"));
-		Params.push_back(ShaderParam("MAXS", -1, 92, 4, 0.000000f, 0.300000f, 0.150000f, 0.010000f, "Maximum Sharpness"));
-		Samplers.push_back(ShaderSampler("LinearizePass", 2));
+	Name = "crt-guest-advanced-hd-pass1";
+	VertexByteCode = RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIGMA_HOR", -1, 52, 4, 0.100000f, 7.000000f, 0.500000f, 0.025000f, "Horizontal Blur Sigma"));
+	Params.push_back(ShaderParam("HSHARPNESS", -1, 56, 4, 1.000000f, 8.000000f, 1.000000f, 0.050000f, "Horizontal Filter Range"));
+	Params.push_back(ShaderParam("S_SHARP", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Substractive Sharpness"));
+	Params.push_back(ShaderParam("HARNG", -1, 64, 4, 0.000000f, 4.000000f, 0.200000f, 0.100000f, "Substractive Sharpness Ringing"));
+	Params.push_back(ShaderParam("HSHARP", -1, 68, 4, 0.000000f, 2.000000f, 1.200000f, 0.100000f, "Sharpness Definition"));
+	Params.push_back(ShaderParam("spike", -1, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Scanline Spike Removal"));
+	Params.push_back(ShaderParam("SIGMA_VER", -1, 76, 4, 0.100000f, 7.000000f, 0.500000f, 0.025000f, "Vertical Blur Sigma"));
+	Params.push_back(ShaderParam("VSHARPNESS", -1, 80, 4, 1.000000f, 8.000000f, 1.000000f, 0.050000f, "Vertical Filter Range"));
+	Params.push_back(ShaderParam("internal_res", -1, 84, 4, 1.000000f, 8.000000f, 1.000000f, 0.100000f, "Internal Resolution"));
+	Params.push_back(ShaderParam("auto_res", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SNES/Amiga Hi-Res Auto Mode"));
+	Params.push_back(ShaderParam("MAXS", -1, 92, 4, 0.000000f, 0.300000f, 0.150000f, 0.010000f, "Maximum Sharpness"));
+	Samplers.push_back(ShaderSampler("LinearizePass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
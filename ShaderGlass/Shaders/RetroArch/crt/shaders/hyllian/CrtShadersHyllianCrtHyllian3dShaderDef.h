@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianCrtHyllian3dShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianCrtHyllian3dShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1093,45 +1104,39 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianCrtHyllian3dShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianCrtHyllian3dShaderDef::CrtShadersHyllianCrtHyllian3dShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianCrtHyllian3dShaderDef() : ShaderDef{}
-	{
-		Name = "crt-hyllian-3d";
-		VertexByteCode = RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CRT_MULRES_X", -1, 52, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "CRT - Internal X Res Multiplier"));
-		Params.push_back(ShaderParam("CRT_MULRES_Y", -1, 56, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "CRT - Internal Y Res Multiplier"));
-		Params.push_back(ShaderParam("PHOSPHOR", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT - Phosphor ON/OFF"));
-		Params.push_back(ShaderParam("InputGamma", -1, 64, 4, 0.000000f, 5.000000f, 2.400000f, 0.100000f, "CRT - Input gamma"));
-		Params.push_back(ShaderParam("OutputGamma", -1, 68, 4, 0.000000f, 5.000000f, 2.200000f, 0.100000f, "CRT - Output Gamma"));
-		Params.push_back(ShaderParam("SHARPNESS", -1, 72, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "CRT - Sharpness Hack"));
-		Params.push_back(ShaderParam("COLOR_BOOST", -1, 76, 4, 1.000000f, 2.000000f, 1.500000f, 0.050000f, "CRT - Color Boost"));
-		Params.push_back(ShaderParam("RED_BOOST", -1, 80, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT - Red Boost"));
-		Params.push_back(ShaderParam("GREEN_BOOST", -1, 84, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT - Green Boost"));
-		Params.push_back(ShaderParam("BLUE_BOOST", -1, 88, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT - Blue Boost"));
-		Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 92, 4, 0.000000f, 1.000000f, 0.720000f, 0.020000f, "CRT - Scanline Strength"));
-		Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 96, 4, 0.000000f, 1.000000f, 0.860000f, 0.020000f, "CRT - Min Beam Width"));
-		Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 100, 4, 0.000000f, 1.000000f, 1.000000f, 0.020000f, "CRT - Max Beam Width"));
-		Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 104, 4, 0.000000f, 1.000000f, 0.800000f, 0.100000f, "CRT - Anti-Ringing"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-hyllian-3d";
+	VertexByteCode = RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllian3dShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CRT_MULRES_X", -1, 52, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "CRT - Internal X Res Multiplier"));
+	Params.push_back(ShaderParam("CRT_MULRES_Y", -1, 56, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "CRT - Internal Y Res Multiplier"));
+	Params.push_back(ShaderParam("PHOSPHOR", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CRT - Phosphor ON/OFF"));
+	Params.push_back(ShaderParam("InputGamma", -1, 64, 4, 0.000000f, 5.000000f, 2.400000f, 0.100000f, "CRT - Input gamma"));
+	Params.push_back(ShaderParam("OutputGamma", -1, 68, 4, 0.000000f, 5.000000f, 2.200000f, 0.100000f, "CRT - Output Gamma"));
+	Params.push_back(ShaderParam("SHARPNESS", -1, 72, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "CRT - Sharpness Hack"));
+	Params.push_back(ShaderParam("COLOR_BOOST", -1, 76, 4, 1.000000f, 2.000000f, 1.500000f, 0.050000f, "CRT - Color Boost"));
+	Params.push_back(ShaderParam("RED_BOOST", -1, 80, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT - Red Boost"));
+	Params.push_back(ShaderParam("GREEN_BOOST", -1, 84, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT - Green Boost"));
+	Params.push_back(ShaderParam("BLUE_BOOST", -1, 88, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT - Blue Boost"));
+	Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 92, 4, 0.000000f, 1.000000f, 0.720000f, 0.020000f, "CRT - Scanline Strength"));
+	Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 96, 4, 0.000000f, 1.000000f, 0.860000f, 0.020000f, "CRT - Min Beam Width"));
+	Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 100, 4, 0.000000f, 1.000000f, 1.000000f, 0.020000f, "CRT - Max Beam Width"));
+	Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 104, 4, 0.000000f, 1.000000f, 0.800000f, 0.100000f, "CRT - Anti-Ringing"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
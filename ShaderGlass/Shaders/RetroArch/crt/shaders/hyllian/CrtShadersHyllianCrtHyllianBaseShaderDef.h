@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianCrtHyllianBaseShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianCrtHyllianBaseShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1449,41 +1460,35 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianCrtHyllianBaseShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianCrtHyllianBaseShaderDef::CrtShadersHyllianCrtHyllianBaseShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianCrtHyllianBaseShaderDef() : ShaderDef{}
-	{
-		Name = "crt-hyllian-base";
-		VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PRESET_OPTION", -1, 48, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "PRESET [0=Custom, Aperture1, Aperture2, Slot1, Slot2, Shadow]"));
-		Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 52, 4, 0.000000f, 1.000000f, 0.860000f, 0.010000f, "MIN BEAM WIDTH"));
-		Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "MAX BEAM WIDTH"));
-		Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 0.720000f, 0.010000f, "SCANLINES STRENGTH"));
-		Params.push_back(ShaderParam("SCANLINES_SHAPE", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "SCANLINES SHAPE [ Sharp | Soft ]"));
-		Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 68, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS HACK"));
-		Params.push_back(ShaderParam("SCANLINES_CUTOFF", -1, 72, 4, 0.000000f, 1000.000000f, 400.000000f, 2.000000f, "SCANLINES CUTOFF"));
-		Params.push_back(ShaderParam("SCANLINES_HIRES", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HIGH RESOLUTION SCANLINES"));
-		Params.push_back(ShaderParam("IR_SCALE", -1, 80, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "INTERNAL RESOLUTION SCALE (Downsampling)"));
-		Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ANTI RINGING"));
-		Params.push_back(ShaderParam("VSCANLINES", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VERTICAL SCANLINES [ Off | On ]"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-hyllian-base";
+	VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianBaseShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PRESET_OPTION", -1, 48, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "PRESET [0=Custom, Aperture1, Aperture2, Slot1, Slot2, Shadow]"));
+	Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 52, 4, 0.000000f, 1.000000f, 0.860000f, 0.010000f, "MIN BEAM WIDTH"));
+	Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "MAX BEAM WIDTH"));
+	Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 0.720000f, 0.010000f, "SCANLINES STRENGTH"));
+	Params.push_back(ShaderParam("SCANLINES_SHAPE", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "SCANLINES SHAPE [ Sharp | Soft ]"));
+	Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 68, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS HACK"));
+	Params.push_back(ShaderParam("SCANLINES_CUTOFF", -1, 72, 4, 0.000000f, 1000.000000f, 400.000000f, 2.000000f, "SCANLINES CUTOFF"));
+	Params.push_back(ShaderParam("SCANLINES_HIRES", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HIGH RESOLUTION SCANLINES"));
+	Params.push_back(ShaderParam("IR_SCALE", -1, 80, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "INTERNAL RESOLUTION SCALE (Downsampling)"));
+	Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ANTI RINGING"));
+	Params.push_back(ShaderParam("VSCANLINES", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VERTICAL SCANLINES [ Off | On ]"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
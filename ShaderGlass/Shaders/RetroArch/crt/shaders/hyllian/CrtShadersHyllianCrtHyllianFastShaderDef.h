@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianCrtHyllianFastShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianCrtHyllianFastShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -834,37 +845,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianCrtHyllianFastShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianCrtHyllianFastShaderDef::CrtShadersHyllianCrtHyllianFastShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianCrtHyllianFastShaderDef() : ShaderDef{}
-	{
-		Name = "crt-hyllian-fast";
-		VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MASK_INTENSITY", -1, 0, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "MASK INTENSITY"));
-		Params.push_back(ShaderParam("InputGamma", -1, 4, 4, 0.000000f, 5.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
-		Params.push_back(ShaderParam("OutputGamma", -1, 8, 4, 0.000000f, 5.000000f, 2.200000f, 0.100000f, "OUTPUT GAMMA"));
-		Params.push_back(ShaderParam("BRIGHTBOOST", -1, 12, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "BRIGHT BOOST"));
-		Params.push_back(ShaderParam("SCANLINES", -1, 16, 4, 0.000000f, 1.000000f, 0.720000f, 0.020000f, "SCANLINES STRENGTH"));
-		Params.push_back(ShaderParam("SHARPER", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SHARPER"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "crt-hyllian-fast";
+	VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianFastShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MASK_INTENSITY", -1, 0, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "MASK INTENSITY"));
+	Params.push_back(ShaderParam("InputGamma", -1, 4, 4, 0.000000f, 5.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
+	Params.push_back(ShaderParam("OutputGamma", -1, 8, 4, 0.000000f, 5.000000f, 2.200000f, 0.100000f, "OUTPUT GAMMA"));
+	Params.push_back(ShaderParam("BRIGHTBOOST", -1, 12, 4, 0.000000f, 2.000000f, 1.500000f, 0.100000f, "BRIGHT BOOST"));
+	Params.push_back(ShaderParam("SCANLINES", -1, 16, 4, 0.000000f, 1.000000f, 0.720000f, 0.020000f, "SCANLINES STRENGTH"));
+	Params.push_back(ShaderParam("SHARPER", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SHARPER"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
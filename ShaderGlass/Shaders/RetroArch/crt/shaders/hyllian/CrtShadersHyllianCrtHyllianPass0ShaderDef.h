@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianCrtHyllianPass0ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianCrtHyllianPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -867,37 +878,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianCrtHyllianPass0ShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianCrtHyllianPass0ShaderDef::CrtShadersHyllianCrtHyllianPass0ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianCrtHyllianPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-hyllian-pass0";
-		VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HFILTER_PROFILE", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "HORIZONTAL FILTER PROFILE [ SHARP1 | SHARP2 ]"));
-		Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 4, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS_HACK"));
-		Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ANTI RINGING"));
-		Params.push_back(ShaderParam("CRT_InputGamma", -1, 12, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
-		Params.push_back(ShaderParam("CURVATURE", -1, 16, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ENABLE CURVATURE"));
-		Params.push_back(ShaderParam("WARP_X", -1, 20, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-X"));
-		Params.push_back(ShaderParam("WARP_Y", -1, 24, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-Y"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-hyllian-pass0";
+	VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HFILTER_PROFILE", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "HORIZONTAL FILTER PROFILE [ SHARP1 | SHARP2 ]"));
+	Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 4, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS_HACK"));
+	Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ANTI RINGING"));
+	Params.push_back(ShaderParam("CRT_InputGamma", -1, 12, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
+	Params.push_back(ShaderParam("CURVATURE", -1, 16, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ENABLE CURVATURE"));
+	Params.push_back(ShaderParam("WARP_X", -1, 20, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-X"));
+	Params.push_back(ShaderParam("WARP_Y", -1, 24, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-Y"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -34,6 +34,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianCrtHyllianPass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianCrtHyllianPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3010,46 +3021,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianCrtHyllianPass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianCrtHyllianPass1ShaderDef::CrtShadersHyllianCrtHyllianPass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianCrtHyllianPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-hyllian-pass1";
-		VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CRT_OutputGamma", -1, 52, 4, 1.000000f, 5.000000f, 2.200000f, 0.050000f, "OUTPUT GAMMA"));
-		Params.push_back(ShaderParam("PHOSPHOR_LAYOUT", -1, 56, 4, 0.000000f, 15.000000f, 1.000000f, 1.000000f, "PHOSPHOR LAYOUT [1-6 Aperture, 7-10 Shadow, 11-14 Slot]"));
-		Params.push_back(ShaderParam("MASK_INTENSITY", -1, 60, 4, 0.000000f, 1.000000f, 0.650000f, 0.010000f, "MASK INTENSITY"));
-		Params.push_back(ShaderParam("MONITOR_SUBPIXELS", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MONITOR SUBPIXELS LAYOUT [0=RGB, 1=BGR]"));
-		Params.push_back(ShaderParam("BRIGHTBOOST", -1, 68, 4, 1.000000f, 3.000000f, 1.400000f, 0.050000f, "BRIGHTNESS BOOST"));
-		Params.push_back(ShaderParam("SCANLINES_SHAPE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SCANLINES SHAPE (SINC | GAUSSIAN)"));
-		Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 76, 4, 0.000000f, 1.000000f, 0.720000f, 0.010000f, "SCANLINES STRENGTH"));
-		Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 80, 4, 0.000000f, 1.000000f, 0.860000f, 0.020000f, "MIN BEAM WIDTH"));
-		Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 0.020000f, "MAX BEAM WIDTH"));
-		Params.push_back(ShaderParam("POST_BRIGHTNESS", -1, 88, 4, 1.000000f, 3.000000f, 1.000000f, 0.050000f, "POST-BRIGHTNESS"));
-		Params.push_back(ShaderParam("CURVATURE", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ENABLE CURVATURE"));
-		Params.push_back(ShaderParam("WARP_X", -1, 96, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-X"));
-		Params.push_back(ShaderParam("WARP_Y", -1, 100, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-Y"));
-		Params.push_back(ShaderParam("CORNER_SIZE", -1, 104, 4, 0.001000f, 1.000000f, 0.020000f, 0.005000f, "CORNER SIZE"));
-		Params.push_back(ShaderParam("CORNER_SMOOTHNESS", -1, 108, 4, 1.000000f, 2.200000f, 1.100000f, 0.020000f, "CORNER SMOOTHNESS"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-hyllian-pass1";
+	VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CRT_OutputGamma", -1, 52, 4, 1.000000f, 5.000000f, 2.200000f, 0.050000f, "OUTPUT GAMMA"));
+	Params.push_back(ShaderParam("PHOSPHOR_LAYOUT", -1, 56, 4, 0.000000f, 15.000000f, 1.000000f, 1.000000f, "PHOSPHOR LAYOUT [1-6 Aperture, 7-10 Shadow, 11-14 Slot]"));
+	Params.push_back(ShaderParam("MASK_INTENSITY", -1, 60, 4, 0.000000f, 1.000000f, 0.650000f, 0.010000f, "MASK INTENSITY"));
+	Params.push_back(ShaderParam("MONITOR_SUBPIXELS", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MONITOR SUBPIXELS LAYOUT [0=RGB, 1=BGR]"));
+	Params.push_back(ShaderParam("BRIGHTBOOST", -1, 68, 4, 1.000000f, 3.000000f, 1.400000f, 0.050000f, "BRIGHTNESS BOOST"));
+	Params.push_back(ShaderParam("SCANLINES_SHAPE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SCANLINES SHAPE (SINC | GAUSSIAN)"));
+	Params.push_back(ShaderParam("SCANLINES_STRENGTH", -1, 76, 4, 0.000000f, 1.000000f, 0.720000f, 0.010000f, "SCANLINES STRENGTH"));
+	Params.push_back(ShaderParam("BEAM_MIN_WIDTH", -1, 80, 4, 0.000000f, 1.000000f, 0.860000f, 0.020000f, "MIN BEAM WIDTH"));
+	Params.push_back(ShaderParam("BEAM_MAX_WIDTH", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 0.020000f, "MAX BEAM WIDTH"));
+	Params.push_back(ShaderParam("POST_BRIGHTNESS", -1, 88, 4, 1.000000f, 3.000000f, 1.000000f, 0.050000f, "POST-BRIGHTNESS"));
+	Params.push_back(ShaderParam("CURVATURE", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ENABLE CURVATURE"));
+	Params.push_back(ShaderParam("WARP_X", -1, 96, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-X"));
+	Params.push_back(ShaderParam("WARP_Y", -1, 100, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-Y"));
+	Params.push_back(ShaderParam("CORNER_SIZE", -1, 104, 4, 0.001000f, 1.000000f, 0.020000f, 0.005000f, "CORNER SIZE"));
+	Params.push_back(ShaderParam("CORNER_SMOOTHNESS", -1, 108, 4, 1.000000f, 2.200000f, 1.100000f, 0.020000f, "CORNER SMOOTHNESS"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
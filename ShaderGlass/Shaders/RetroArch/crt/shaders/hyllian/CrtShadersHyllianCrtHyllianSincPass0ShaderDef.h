@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianCrtHyllianSincPass0ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianCrtHyllianSincPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1199,39 +1210,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianCrtHyllianSincPass0ShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianCrtHyllianSincPass0ShaderDef::CrtShadersHyllianCrtHyllianSincPass0ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianCrtHyllianSincPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "crt-hyllian-sinc-pass0";
-		VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("HFILTER_PROFILE", -1, 0, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "H-FILTER [ Custom | Composite1 | Composite2 ]"));
-		Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 4, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS HACK"));
-		Params.push_back(ShaderParam("SHP", -1, 8, 4, 0.500000f, 1.000000f, 1.000000f, 0.010000f, "CUSTOM H-FILTER SHARPNESS"));
-		Params.push_back(ShaderParam("RADIUS", -1, 12, 4, 2.000000f, 4.000000f, 4.000000f, 0.100000f, "CUSTOM H-FILTER RADIUS"));
-		Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "ANTI RINGING"));
-		Params.push_back(ShaderParam("CRT_InputGamma", -1, 20, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
-		Params.push_back(ShaderParam("CURVATURE", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ENABLE CURVATURE"));
-		Params.push_back(ShaderParam("WARP_X", -1, 28, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-X"));
-		Params.push_back(ShaderParam("WARP_Y", -1, 32, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-Y"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-hyllian-sinc-pass0";
+	VertexByteCode = RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianCrtHyllianSincPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("HFILTER_PROFILE", -1, 0, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "H-FILTER [ Custom | Composite1 | Composite2 ]"));
+	Params.push_back(ShaderParam("SHARPNESS_HACK", -1, 4, 4, 1.000000f, 4.000000f, 1.000000f, 1.000000f, "SHARPNESS HACK"));
+	Params.push_back(ShaderParam("SHP", -1, 8, 4, 0.500000f, 1.000000f, 1.000000f, 0.010000f, "CUSTOM H-FILTER SHARPNESS"));
+	Params.push_back(ShaderParam("RADIUS", -1, 12, 4, 2.000000f, 4.000000f, 4.000000f, 0.100000f, "CUSTOM H-FILTER RADIUS"));
+	Params.push_back(ShaderParam("CRT_ANTI_RINGING", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "ANTI RINGING"));
+	Params.push_back(ShaderParam("CRT_InputGamma", -1, 20, 4, 1.000000f, 5.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
+	Params.push_back(ShaderParam("CURVATURE", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "ENABLE CURVATURE"));
+	Params.push_back(ShaderParam("WARP_X", -1, 28, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-X"));
+	Params.push_back(ShaderParam("WARP_Y", -1, 32, 4, 0.000000f, 0.125000f, 0.015000f, 0.005000f, "CURVATURE-Y"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
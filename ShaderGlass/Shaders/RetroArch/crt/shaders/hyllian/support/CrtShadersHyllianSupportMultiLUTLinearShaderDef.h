@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianSupportMultiLUTLinearShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianSupportMultiLUTLinearShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -624,35 +635,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianSupportMultiLUTLinearShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianSupportMultiLUTLinearShaderDef::CrtShadersHyllianSupportMultiLUTLinearShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianSupportMultiLUTLinearShaderDef() : ShaderDef{}
-	{
-		Name = "multiLUT-linear";
-		VertexByteCode = RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT [ Off | Grade RGB | Grade Composite ]"));
-		Params.push_back(ShaderParam("H_InputGamma", -1, 56, 4, 1.000000f, 3.000000f, 2.400000f, 0.050000f, "INPUT GAMMA"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Name = "multiLUT-linear";
+	VertexByteCode = RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTLinearShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT [ Off | Grade RGB | Grade Composite ]"));
+	Params.push_back(ShaderParam("H_InputGamma", -1, 56, 4, 1.000000f, 3.000000f, 2.400000f, 0.050000f, "INPUT GAMMA"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
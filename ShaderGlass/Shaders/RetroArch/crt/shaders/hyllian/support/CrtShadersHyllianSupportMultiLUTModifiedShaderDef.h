@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianSupportMultiLUTModifiedShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianSupportMultiLUTModifiedShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -606,34 +617,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianSupportMultiLUTModifiedShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianSupportMultiLUTModifiedShaderDef::CrtShadersHyllianSupportMultiLUTModifiedShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianSupportMultiLUTModifiedShaderDef() : ShaderDef{}
-	{
-		Name = "multiLUT-modified";
-		VertexByteCode = RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT [ Off | NTSC | Grade ]"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Name = "multiLUT-modified";
+	VertexByteCode = RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportMultiLUTModifiedShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT [ Off | NTSC | Grade ]"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
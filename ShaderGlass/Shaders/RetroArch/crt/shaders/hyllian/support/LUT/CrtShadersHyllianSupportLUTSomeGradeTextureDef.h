@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersHyllianSupportLUTSomeGradeTextureDef : public TextureDef
+{
+public:
+	CrtShadersHyllianSupportLUTSomeGradeTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersHyllianSupportLUTSomeGradeTextureDefs
 {
 const BYTE sData[] =
@@ -758,13 +766,10 @@ const BYTE sData[] =
 ,126,217,32,19,32,30,250,140,91,54,248,231,127,229,188,136,232,247,151,23,65,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersHyllianSupportLUTSomeGradeTextureDef : public TextureDef
+CrtShadersHyllianSupportLUTSomeGradeTextureDef::CrtShadersHyllianSupportLUTSomeGradeTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersHyllianSupportLUTSomeGradeTextureDef() : TextureDef{}
-	{
-		Name = "some-grade.png";
-		Data = CrtShadersHyllianSupportLUTSomeGradeTextureDefs::sData;
-		DataLength = sizeof(CrtShadersHyllianSupportLUTSomeGradeTextureDefs::sData);
-	}
-};
+	Name = "some-grade.png";
+	Data = CrtShadersHyllianSupportLUTSomeGradeTextureDefs::sData;
+	DataLength = sizeof(CrtShadersHyllianSupportLUTSomeGradeTextureDefs::sData);
+}
+#endif
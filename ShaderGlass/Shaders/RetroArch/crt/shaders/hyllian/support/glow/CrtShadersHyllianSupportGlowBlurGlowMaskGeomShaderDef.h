@@ -40,6 +40,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3747,55 +3758,49 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef::CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef() : ShaderDef{}
-	{
-		Name = "blur-glow-mask-geom";
-		VertexByteCode = RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GLOW_ENABLE", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Enable Glow"));
-		Params.push_back(ShaderParam("GLOW_RADIUS", -1, 4, 4, 2.000000f, 4.000000f, 4.000000f, 0.100000f, "Glow Radius"));
-		Params.push_back(ShaderParam("GLOW_STRENGTH", -1, 8, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Glow Strength"));
-		Params.push_back(ShaderParam("PRESET_OPTION", -1, 12, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "PRESET [0=Custom, Aperture1, Aperture2, Slot1, Slot2, Shadow]"));
-		Params.push_back(ShaderParam("DISPLAY_RES", -1, 16, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(IF PRESET > 0) TARGET RESOLUTION [ 1080p | 4k ]"));
-		Params.push_back(ShaderParam("PHOSPHOR_LAYOUT", -1, 20, 4, 0.000000f, 15.000000f, 1.000000f, 1.000000f, "MASK [1..6 Aperture, 7..10 Shadow, 11..14 Slot]"));
-		Params.push_back(ShaderParam("MASK_STRENGTH", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 0.020000f, "MASK STRENGTH"));
-		Params.push_back(ShaderParam("BRIGHTBOOST", -1, 28, 4, 0.500000f, 2.000000f, 1.000000f, 0.010000f, "BRIGHTBOOST"));
-		Params.push_back(ShaderParam("MONITOR_SUBPIXELS", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MONITOR SUBPIXELS LAYOUT [ RGB | BGR ]"));
-		Params.push_back(ShaderParam("VSCANLINES", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VERTICAL SCANLINES [ Off | On ]"));
-		Params.push_back(ShaderParam("H_OUTPUT_GAMMA", -1, 40, 4, 1.000000f, 3.000000f, 2.200000f, 0.050000f, "OUTPUT GAMMA"));
-		Params.push_back(ShaderParam("geom_d", -1, 44, 4, 0.100000f, 3.000000f, 1.500000f, 0.100000f, "Geom Distance"));
-		Params.push_back(ShaderParam("geom_R", -1, 48, 4, 0.300000f, 10.000000f, 2.000000f, 0.100000f, "Geom Curvature Radius"));
-		Params.push_back(ShaderParam("geom_cornersize", -1, 52, 4, 0.001000f, 1.000000f, 0.006000f, 0.005000f, "Geom Corner Size"));
-		Params.push_back(ShaderParam("geom_cornersmooth", -1, 56, 4, 80.000000f, 2000.000000f, 400.000000f, 100.000000f, "Geom Corner Smoothness"));
-		Params.push_back(ShaderParam("geom_x_tilt", -1, 60, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Geom Horizontal Tilt"));
-		Params.push_back(ShaderParam("geom_y_tilt", -1, 64, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Geom Vertical Tilt"));
-		Params.push_back(ShaderParam("geom_overscan_x", -1, 68, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Horiz. Overscan %"));
-		Params.push_back(ShaderParam("geom_overscan_y", -1, 72, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Vert. Overscan %"));
-		Params.push_back(ShaderParam("geom_center_x", -1, 76, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Geom Center X"));
-		Params.push_back(ShaderParam("geom_center_y", -1, 80, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Geom Center Y"));
-		Params.push_back(ShaderParam("geom_curvature", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Geom Curvature Toggle"));
-		Params.push_back(ShaderParam("geom_invert_aspect", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Geom Curvature Aspect Inversion"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("CRTPass", 3));
+	Name = "blur-glow-mask-geom";
+	VertexByteCode = RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GLOW_ENABLE", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Enable Glow"));
+	Params.push_back(ShaderParam("GLOW_RADIUS", -1, 4, 4, 2.000000f, 4.000000f, 4.000000f, 0.100000f, "Glow Radius"));
+	Params.push_back(ShaderParam("GLOW_STRENGTH", -1, 8, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Glow Strength"));
+	Params.push_back(ShaderParam("PRESET_OPTION", -1, 12, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "PRESET [0=Custom, Aperture1, Aperture2, Slot1, Slot2, Shadow]"));
+	Params.push_back(ShaderParam("DISPLAY_RES", -1, 16, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(IF PRESET > 0) TARGET RESOLUTION [ 1080p | 4k ]"));
+	Params.push_back(ShaderParam("PHOSPHOR_LAYOUT", -1, 20, 4, 0.000000f, 15.000000f, 1.000000f, 1.000000f, "MASK [1..6 Aperture, 7..10 Shadow, 11..14 Slot]"));
+	Params.push_back(ShaderParam("MASK_STRENGTH", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 0.020000f, "MASK STRENGTH"));
+	Params.push_back(ShaderParam("BRIGHTBOOST", -1, 28, 4, 0.500000f, 2.000000f, 1.000000f, 0.010000f, "BRIGHTBOOST"));
+	Params.push_back(ShaderParam("MONITOR_SUBPIXELS", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MONITOR SUBPIXELS LAYOUT [ RGB | BGR ]"));
+	Params.push_back(ShaderParam("VSCANLINES", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VERTICAL SCANLINES [ Off | On ]"));
+	Params.push_back(ShaderParam("H_OUTPUT_GAMMA", -1, 40, 4, 1.000000f, 3.000000f, 2.200000f, 0.050000f, "OUTPUT GAMMA"));
+	Params.push_back(ShaderParam("geom_d", -1, 44, 4, 0.100000f, 3.000000f, 1.500000f, 0.100000f, "Geom Distance"));
+	Params.push_back(ShaderParam("geom_R", -1, 48, 4, 0.300000f, 10.000000f, 2.000000f, 0.100000f, "Geom Curvature Radius"));
+	Params.push_back(ShaderParam("geom_cornersize", -1, 52, 4, 0.001000f, 1.000000f, 0.006000f, 0.005000f, "Geom Corner Size"));
+	Params.push_back(ShaderParam("geom_cornersmooth", -1, 56, 4, 80.000000f, 2000.000000f, 400.000000f, 100.000000f, "Geom Corner Smoothness"));
+	Params.push_back(ShaderParam("geom_x_tilt", -1, 60, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Geom Horizontal Tilt"));
+	Params.push_back(ShaderParam("geom_y_tilt", -1, 64, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Geom Vertical Tilt"));
+	Params.push_back(ShaderParam("geom_overscan_x", -1, 68, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Horiz. Overscan %"));
+	Params.push_back(ShaderParam("geom_overscan_y", -1, 72, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Vert. Overscan %"));
+	Params.push_back(ShaderParam("geom_center_x", -1, 76, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Geom Center X"));
+	Params.push_back(ShaderParam("geom_center_y", -1, 80, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Geom Center Y"));
+	Params.push_back(ShaderParam("geom_curvature", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Geom Curvature Toggle"));
+	Params.push_back(ShaderParam("geom_invert_aspect", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Geom Curvature Aspect Inversion"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("CRTPass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianSupportGlowBlur_horizShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianSupportGlowBlur_horizShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -593,31 +604,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianSupportGlowBlur_horizShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianSupportGlowBlur_horizShaderDef::CrtShadersHyllianSupportGlowBlur_horizShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianSupportGlowBlur_horizShaderDef() : ShaderDef{}
-	{
-		Name = "blur_horiz";
-		VertexByteCode = RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GLOW_RADIUS", -1, 0, 4, 2.000000f, 4.000000f, 4.000000f, 0.100000f, "Glow Radius"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_horiz";
+	VertexByteCode = RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportGlowBlur_horizShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GLOW_RADIUS", -1, 0, 4, 2.000000f, 4.000000f, 4.000000f, 0.100000f, "Glow Radius"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersHyllianSupportGlowThresholdShaderDef : public ShaderDef
+{
+public:
+	CrtShadersHyllianSupportGlowThresholdShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -378,32 +389,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersHyllianSupportGlowThresholdShaderDef : public ShaderDef
+RetroArch::CrtShadersHyllianSupportGlowThresholdShaderDef::CrtShadersHyllianSupportGlowThresholdShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersHyllianSupportGlowThresholdShaderDef() : ShaderDef{}
-	{
-		Name = "threshold";
-		VertexByteCode = RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sFragmentByteCode);
-		Format = "R8G8B8A8_SRGB";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GLOW_WHITEPOINT", -1, 0, 4, 0.500000f, 1.100000f, 0.900000f, 0.020000f, "Glow Whitepoint"));
-		Params.push_back(ShaderParam("GLOW_ROLLOFF", -1, 4, 4, 1.200000f, 6.000000f, 2.000000f, 0.100000f, "Glow Rolloff"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "threshold";
+	VertexByteCode = RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersHyllianSupportGlowThresholdShaderDefs::sFragmentByteCode);
+	Format = "R8G8B8A8_SRGB";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GLOW_WHITEPOINT", -1, 0, 4, 0.500000f, 1.100000f, 0.900000f, 0.020000f, "Glow Whitepoint"));
+	Params.push_back(ShaderParam("GLOW_ROLLOFF", -1, 4, 4, 1.200000f, 6.000000f, 2.000000f, 0.100000f, "Glow Rolloff"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersMame_hlslResourcesApertureGrilleTextureDef : public TextureDef
+{
+public:
+	CrtShadersMame_hlslResourcesApertureGrilleTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersMame_hlslResourcesApertureGrilleTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,65,103,187,241,240,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersMame_hlslResourcesApertureGrilleTextureDef : public TextureDef
+CrtShadersMame_hlslResourcesApertureGrilleTextureDef::CrtShadersMame_hlslResourcesApertureGrilleTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersMame_hlslResourcesApertureGrilleTextureDef() : TextureDef{}
-	{
-		Name = "aperture-grille.png";
-		Data = CrtShadersMame_hlslResourcesApertureGrilleTextureDefs::sData;
-		DataLength = sizeof(CrtShadersMame_hlslResourcesApertureGrilleTextureDefs::sData);
-	}
-};
+	Name = "aperture-grille.png";
+	Data = CrtShadersMame_hlslResourcesApertureGrilleTextureDefs::sData;
+	DataLength = sizeof(CrtShadersMame_hlslResourcesApertureGrilleTextureDefs::sData);
+}
+#endif
@@ -94,6 +94,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersMame_hlslShadersMame_chromaShaderDef : public ShaderDef
+{
+public:
+	CrtShadersMame_hlslShadersMame_chromaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2772,143 +2783,137 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersMame_hlslShadersMame_chromaShaderDef : public ShaderDef
+RetroArch::CrtShadersMame_hlslShadersMame_chromaShaderDef::CrtShadersMame_hlslShadersMame_chromaShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersMame_hlslShadersMame_chromaShaderDef() : ShaderDef{}
-	{
-		Name = "mame_chroma";
-		VertexByteCode = RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ntscsignal", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.010000f, "NTSC Signal Mode"));
-		Params.push_back(ShaderParam("scanlinetoggle", 0, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Toggle"));
-		Params.push_back(ShaderParam("chromatoggle", 0, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Chromaticity Toggle"));
-		Params.push_back(ShaderParam("distortiontoggle", 0, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Distortion Toggle"));
-		Params.push_back(ShaderParam("screenscale_x", 0, 80, 4, -3.000000f, 3.000000f, 0.000000f, 0.005000f, "Screen Scale X"));
-		Params.push_back(ShaderParam("screenscale_y", 0, 84, 4, -3.000000f, 3.000000f, 0.000000f, 0.005000f, "Screen Scale Y"));
-		Params.push_back(ShaderParam("screenoffset_x", 0, 88, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Screen Offset X"));
-		Params.push_back(ShaderParam("screenoffset_y", 0, 92, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Screen Offset Y"));
-		Params.push_back(ShaderParam("swapxy", 0, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Swap X and Y"));
-		Params.push_back(ShaderParam("bloomblendmode", 0, 100, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_width", 0, 104, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_height", 0, 108, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_offset_x", 0, 112, 4, 0.000000f, 10.000000f, 0.000000f, 0.001000f, "Mask Offset X"));
-		Params.push_back(ShaderParam("mask_offset_y", 0, 116, 4, 0.000000f, 10.000000f, 0.000000f, 0.001000f, "Mask Offset Y"));
-		Params.push_back(ShaderParam("preparebloom", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("shadowtilemode", 0, 124, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Shadow Mask Tile Mode"));
-		Params.push_back(ShaderParam("power_r", 0, 128, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Power R"));
-		Params.push_back(ShaderParam("power_g", 0, 132, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Power G"));
-		Params.push_back(ShaderParam("power_b", 0, 136, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Power B"));
-		Params.push_back(ShaderParam("floor_r", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Color Floor R"));
-		Params.push_back(ShaderParam("floor_g", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Color Floor G"));
-		Params.push_back(ShaderParam("floor_b", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Color Floor B"));
-		Params.push_back(ShaderParam("chromamode", 0, 152, 4, 1.000000f, 3.000000f, 3.000000f, 1.000000f, "Chroma Mode"));
-		Params.push_back(ShaderParam("conversiongain_x", 0, 156, 4, -5.000000f, 5.000000f, 0.000000f, 0.500000f, "Conversion Gain X"));
-		Params.push_back(ShaderParam("conversiongain_y", 0, 160, 4, -5.000000f, 5.000000f, 0.000000f, 0.500000f, "Conversion Gain Y"));
-		Params.push_back(ShaderParam("conversiongain_z", 0, 164, 4, -5.000000f, 5.000000f, 0.000000f, 0.500000f, "Conversion Gain Z"));
-		Params.push_back(ShaderParam("humbaralpha", 0, 168, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Hum Bar Amount"));
-		Params.push_back(ShaderParam("backcolor_r", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("backcolor_g", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("backcolor_b", 0, 180, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("shadowalpha", 0, 184, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Shadow Mask Amount"));
-		Params.push_back(ShaderParam("shadowcount_x", 0, 188, 4, 1.000000f, 128.000000f, 12.000000f, 1.000000f, "Shadow Mask Pixel Count X"));
-		Params.push_back(ShaderParam("shadowcount_y", 0, 192, 4, 1.000000f, 128.000000f, 12.000000f, 1.000000f, "Shadow Mask Pixel Count Y"));
-		Params.push_back(ShaderParam("shadowuv_x", 0, 196, 4, 0.000000f, 1.000000f, 0.500000f, 0.001000f, "Shadow Mask UV Size X"));
-		Params.push_back(ShaderParam("shadowuv_y", 0, 200, 4, 0.000000f, 1.000000f, 0.500000f, 0.001000f, "Shadow Mask UV Size Y"));
-		Params.push_back(ShaderParam("avalue", 0, 204, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "NTSC A Value"));
-		Params.push_back(ShaderParam("bvalue", 0, 208, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "NTSC B Value"));
-		Params.push_back(ShaderParam("ccvalue", 0, 212, 4, 3.479540f, 3.679540f, 3.579545f, 0.000010f, "NTSC Color Carrier (Hz)"));
-		Params.push_back(ShaderParam("ovalue", 0, 216, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "NTSC Outgoing Phase Offset"));
-		Params.push_back(ShaderParam("pvalue", 0, 220, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "NTSC Incoming Phase Pixel Clock Scale"));
-		Params.push_back(ShaderParam("scantime", 0, 224, 4, 1.000000f, 150.000000f, 52.599998f, 0.100000f, "NTSC Scanline Duration (uSec)"));
-		Params.push_back(ShaderParam("notch_width", 0, 228, 4, 1.000000f, 4.000000f, 2.000000f, 0.010000f, "NTSC Color Notch Filter Width"));
-		Params.push_back(ShaderParam("yfreqresponse", 0, 232, 4, 0.000000f, 21.000000f, 6.000000f, 0.050000f, "NTSC Y Signal Bandwidth (Hz)"));
-		Params.push_back(ShaderParam("ifreqresponse", 0, 236, 4, 0.000000f, 21.000000f, 1.200000f, 0.050000f, "NTSC I Signal Bandwidth (Hz)"));
-		Params.push_back(ShaderParam("qfreqresponse", 0, 240, 4, 0.000000f, 21.000000f, 0.600000f, 0.050000f, "NTSC Q Signal Bandwidth (Hz)"));
-		Params.push_back(ShaderParam("jitter_offset", 0, 244, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "NTSC Frame Jitter Offset"));
-		Params.push_back(ShaderParam("col_rr", 0, 248, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Red Shift Red"));
-		Params.push_back(ShaderParam("col_rg", 0, 252, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Red Shift Green"));
-		Params.push_back(ShaderParam("col_rb", 0, 256, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Red Shift Blue"));
-		Params.push_back(ShaderParam("col_gr", 0, 260, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Green Shift Red"));
-		Params.push_back(ShaderParam("col_gg", 0, 264, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Green Shift Green"));
-		Params.push_back(ShaderParam("col_gb", 0, 268, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Green Shift Blue"));
-		Params.push_back(ShaderParam("col_br", 0, 272, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Blue Shift Red"));
-		Params.push_back(ShaderParam("col_bg", 0, 276, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Blue Shift Green"));
-		Params.push_back(ShaderParam("col_bb", 0, 280, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Blue Shift Blue"));
-		Params.push_back(ShaderParam("col_offset_x", 0, 284, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Offset X"));
-		Params.push_back(ShaderParam("col_offset_y", 0, 288, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Offset Y"));
-		Params.push_back(ShaderParam("col_offset_z", 0, 292, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Offset Z"));
-		Params.push_back(ShaderParam("col_scale_x", 0, 296, 4, 0.000000f, 2.000000f, 0.950000f, 0.010000f, "Scale X"));
-		Params.push_back(ShaderParam("col_scale_y", 0, 300, 4, 0.000000f, 2.000000f, 0.950000f, 0.010000f, "Scale Y"));
-		Params.push_back(ShaderParam("col_scale_z", 0, 304, 4, 0.000000f, 2.000000f, 0.950000f, 0.010000f, "Scale Z"));
-		Params.push_back(ShaderParam("col_saturation", 0, 308, 4, 0.000000f, 4.000000f, 1.200000f, 0.010000f, "Color Saturation"));
-		Params.push_back(ShaderParam("converge_x_r", 0, 312, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence X Red"));
-		Params.push_back(ShaderParam("converge_x_g", 0, 316, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence X Green"));
-		Params.push_back(ShaderParam("converge_x_b", 0, 320, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence X Blue"));
-		Params.push_back(ShaderParam("converge_y_r", 0, 324, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence Y Red"));
-		Params.push_back(ShaderParam("converge_y_g", 0, 328, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence Y Green"));
-		Params.push_back(ShaderParam("converge_y_b", 0, 332, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence Y Blue"));
-		Params.push_back(ShaderParam("radial_conv_x_r", 0, 336, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv X Red"));
-		Params.push_back(ShaderParam("radial_conv_x_g", 0, 340, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv X Green"));
-		Params.push_back(ShaderParam("radial_conv_x_b", 0, 344, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv X Blue"));
-		Params.push_back(ShaderParam("radial_conv_y_r", 0, 348, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv Y Red"));
-		Params.push_back(ShaderParam("radial_conv_y_g", 0, 352, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv Y Green"));
-		Params.push_back(ShaderParam("radial_conv_y_b", 0, 356, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv Y Blue"));
-		Params.push_back(ShaderParam("scanlinealpha", 0, 360, 4, 0.000000f, 1.000000f, 0.350000f, 0.010000f, "Scanline Amount"));
-		Params.push_back(ShaderParam("scanlinescale", 0, 364, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Overall Scanline Scale"));
-		Params.push_back(ShaderParam("scanlineheight", 0, 368, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Individual Scanline Scale"));
-		Params.push_back(ShaderParam("scanlinevariation", 0, 372, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Scanline Variation"));
-		Params.push_back(ShaderParam("scanlineoffset", 0, 376, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scanlinebrightscale", 0, 380, 4, 0.000000f, 4.000000f, 2.000000f, 0.010000f, "Scanline Brightness Scale"));
-		Params.push_back(ShaderParam("scanlinebrightoffset", 0, 384, 4, 0.000000f, 4.000000f, 1.500000f, 0.010000f, "Scanline Brightness Offset"));
-		Params.push_back(ShaderParam("scanline_jitter_amount", 0, 388, 4, 0.000000f, 2.000000f, 0.250000f, 0.010000f, "Scanline Jitter Amount"));
-		Params.push_back(ShaderParam("defocus_x", 0, 392, 4, 0.000000f, 10.000000f, 0.000000f, 0.100000f, "Defocus X Axis"));
-		Params.push_back(ShaderParam("defocus_y", 0, 396, 4, 0.000000f, 10.000000f, 0.000000f, 0.100000f, "Defocus Y Axis"));
-		Params.push_back(ShaderParam("time", 0, 400, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("phosphor_r", 0, 404, 4, 0.000000f, 0.990000f, 0.450000f, 0.010000f, "Phosphor Red"));
-		Params.push_back(ShaderParam("phosphor_g", 0, 408, 4, 0.000000f, 0.990000f, 0.450000f, 0.010000f, "Phosphor Green"));
-		Params.push_back(ShaderParam("phosphor_b", 0, 412, 4, 0.000000f, 0.990000f, 0.450000f, 0.010000f, "Phosphor Blue"));
-		Params.push_back(ShaderParam("phosphortoggle", 0, 416, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Phosphor Toggle"));
-		Params.push_back(ShaderParam("ygain_r", 0, 420, 4, 0.000000f, 1.000000f, 0.212600f, 0.010000f, "Y Gain R Channel"));
-		Params.push_back(ShaderParam("ygain_g", 0, 424, 4, 0.000000f, 1.000000f, 0.715200f, 0.010000f, "Y Gain G Channel"));
-		Params.push_back(ShaderParam("ygain_b", 0, 428, 4, 0.000000f, 1.000000f, 0.072200f, 0.010000f, "Y Gain B Channel"));
-		Params.push_back(ShaderParam("chromaa_x", 0, 432, 4, 0.000000f, 1.000000f, 0.630000f, 0.010000f, "Chroma A X"));
-		Params.push_back(ShaderParam("chromaa_y", 0, 436, 4, 0.000000f, 1.000000f, 0.340000f, 0.010000f, "Chroma A Y"));
-		Params.push_back(ShaderParam("chromab_x", 0, 440, 4, 0.000000f, 1.000000f, 0.310000f, 0.010000f, "Chroma B X"));
-		Params.push_back(ShaderParam("chromab_y", 0, 444, 4, 0.000000f, 1.000000f, 0.595000f, 0.010000f, "Chroma B Y"));
-		Params.push_back(ShaderParam("chromac_x", 0, 448, 4, 0.000000f, 1.000000f, 0.155000f, 0.010000f, "Chroma C X"));
-		Params.push_back(ShaderParam("chromac_y", 0, 452, 4, 0.000000f, 1.000000f, 0.070000f, 0.010000f, "Chroma C Y"));
-		Params.push_back(ShaderParam("distortion_amount", 0, 456, 4, -2.000000f, 2.000000f, 0.050000f, 0.010000f, "Quadric Dist. Amt"));
-		Params.push_back(ShaderParam("cubic_distortion_amount", 0, 460, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Cubic Dist. Amt"));
-		Params.push_back(ShaderParam("distort_corner_amount", 0, 464, 4, 0.000000f, 2.000000f, 0.050000f, 0.010000f, "Dist. Corner Amt"));
-		Params.push_back(ShaderParam("round_corner_amount", 0, 468, 4, 0.000000f, 2.000000f, 0.050000f, 0.010000f, "Rounded Corner Amt"));
-		Params.push_back(ShaderParam("smooth_border_amount", 0, 472, 4, 0.000000f, 2.000000f, 0.030000f, 0.010000f, "Smooth Border Amt"));
-		Params.push_back(ShaderParam("vignette_amount", 0, 476, 4, 0.000000f, 2.000000f, 0.080000f, 0.010000f, "Vignetting Amount"));
-		Params.push_back(ShaderParam("reflection_amount", 0, 480, 4, 0.000000f, 2.000000f, 0.050000f, 0.010000f, "Reflection Amount"));
-		Params.push_back(ShaderParam("jitter", 0, 484, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Scanline Jitter (OFF/ON/AUTO)"));
-		Params.push_back(ShaderParam("humbar_hertz_rate", 0, 488, 4, 0.000000f, 1.000000f, 0.001000f, 0.001000f, "Hum Bar Frequency"));
-		Params.push_back(ShaderParam("prescale", 0, 492, 4, 1.000000f, 4.000000f, 2.000000f, 1.000000f, "PreScale Factor"));
-		Params.push_back(ShaderParam("scanline_crawl", 0, 496, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Crawl"));
-		Params.push_back(ShaderParam("noise_amt", 0, 500, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Noise/Grain (reduces moire)"));
-		Params.push_back(ShaderParam("TATE_toggle", 0, 504, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "TATE Mode"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "mame_chroma";
+	VertexByteCode = RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersMame_hlslShadersMame_chromaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ntscsignal", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.010000f, "NTSC Signal Mode"));
+	Params.push_back(ShaderParam("scanlinetoggle", 0, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Toggle"));
+	Params.push_back(ShaderParam("chromatoggle", 0, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Chromaticity Toggle"));
+	Params.push_back(ShaderParam("distortiontoggle", 0, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Distortion Toggle"));
+	Params.push_back(ShaderParam("screenscale_x", 0, 80, 4, -3.000000f, 3.000000f, 0.000000f, 0.005000f, "Screen Scale X"));
+	Params.push_back(ShaderParam("screenscale_y", 0, 84, 4, -3.000000f, 3.000000f, 0.000000f, 0.005000f, "Screen Scale Y"));
+	Params.push_back(ShaderParam("screenoffset_x", 0, 88, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Screen Offset X"));
+	Params.push_back(ShaderParam("screenoffset_y", 0, 92, 4, -1.000000f, 1.000000f, 0.000000f, 0.001000f, "Screen Offset Y"));
+	Params.push_back(ShaderParam("swapxy", 0, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Swap X and Y"));
+	Params.push_back(ShaderParam("bloomblendmode", 0, 100, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_width", 0, 104, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_height", 0, 108, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_offset_x", 0, 112, 4, 0.000000f, 10.000000f, 0.000000f, 0.001000f, "Mask Offset X"));
+	Params.push_back(ShaderParam("mask_offset_y", 0, 116, 4, 0.000000f, 10.000000f, 0.000000f, 0.001000f, "Mask Offset Y"));
+	Params.push_back(ShaderParam("preparebloom", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("shadowtilemode", 0, 124, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Shadow Mask Tile Mode"));
+	Params.push_back(ShaderParam("power_r", 0, 128, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Power R"));
+	Params.push_back(ShaderParam("power_g", 0, 132, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Power G"));
+	Params.push_back(ShaderParam("power_b", 0, 136, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Power B"));
+	Params.push_back(ShaderParam("floor_r", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Color Floor R"));
+	Params.push_back(ShaderParam("floor_g", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Color Floor G"));
+	Params.push_back(ShaderParam("floor_b", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Color Floor B"));
+	Params.push_back(ShaderParam("chromamode", 0, 152, 4, 1.000000f, 3.000000f, 3.000000f, 1.000000f, "Chroma Mode"));
+	Params.push_back(ShaderParam("conversiongain_x", 0, 156, 4, -5.000000f, 5.000000f, 0.000000f, 0.500000f, "Conversion Gain X"));
+	Params.push_back(ShaderParam("conversiongain_y", 0, 160, 4, -5.000000f, 5.000000f, 0.000000f, 0.500000f, "Conversion Gain Y"));
+	Params.push_back(ShaderParam("conversiongain_z", 0, 164, 4, -5.000000f, 5.000000f, 0.000000f, 0.500000f, "Conversion Gain Z"));
+	Params.push_back(ShaderParam("humbaralpha", 0, 168, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Hum Bar Amount"));
+	Params.push_back(ShaderParam("backcolor_r", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("backcolor_g", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("backcolor_b", 0, 180, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("shadowalpha", 0, 184, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Shadow Mask Amount"));
+	Params.push_back(ShaderParam("shadowcount_x", 0, 188, 4, 1.000000f, 128.000000f, 12.000000f, 1.000000f, "Shadow Mask Pixel Count X"));
+	Params.push_back(ShaderParam("shadowcount_y", 0, 192, 4, 1.000000f, 128.000000f, 12.000000f, 1.000000f, "Shadow Mask Pixel Count Y"));
+	Params.push_back(ShaderParam("shadowuv_x", 0, 196, 4, 0.000000f, 1.000000f, 0.500000f, 0.001000f, "Shadow Mask UV Size X"));
+	Params.push_back(ShaderParam("shadowuv_y", 0, 200, 4, 0.000000f, 1.000000f, 0.500000f, 0.001000f, "Shadow Mask UV Size Y"));
+	Params.push_back(ShaderParam("avalue", 0, 204, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "NTSC A Value"));
+	Params.push_back(ShaderParam("bvalue", 0, 208, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "NTSC B Value"));
+	Params.push_back(ShaderParam("ccvalue", 0, 212, 4, 3.479540f, 3.679540f, 3.579545f, 0.000010f, "NTSC Color Carrier (Hz)"));
+	Params.push_back(ShaderParam("ovalue", 0, 216, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "NTSC Outgoing Phase Offset"));
+	Params.push_back(ShaderParam("pvalue", 0, 220, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "NTSC Incoming Phase Pixel Clock Scale"));
+	Params.push_back(ShaderParam("scantime", 0, 224, 4, 1.000000f, 150.000000f, 52.599998f, 0.100000f, "NTSC Scanline Duration (uSec)"));
+	Params.push_back(ShaderParam("notch_width", 0, 228, 4, 1.000000f, 4.000000f, 2.000000f, 0.010000f, "NTSC Color Notch Filter Width"));
+	Params.push_back(ShaderParam("yfreqresponse", 0, 232, 4, 0.000000f, 21.000000f, 6.000000f, 0.050000f, "NTSC Y Signal Bandwidth (Hz)"));
+	Params.push_back(ShaderParam("ifreqresponse", 0, 236, 4, 0.000000f, 21.000000f, 1.200000f, 0.050000f, "NTSC I Signal Bandwidth (Hz)"));
+	Params.push_back(ShaderParam("qfreqresponse", 0, 240, 4, 0.000000f, 21.000000f, 0.600000f, 0.050000f, "NTSC Q Signal Bandwidth (Hz)"));
+	Params.push_back(ShaderParam("jitter_offset", 0, 244, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "NTSC Frame Jitter Offset"));
+	Params.push_back(ShaderParam("col_rr", 0, 248, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Red Shift Red"));
+	Params.push_back(ShaderParam("col_rg", 0, 252, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Red Shift Green"));
+	Params.push_back(ShaderParam("col_rb", 0, 256, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Red Shift Blue"));
+	Params.push_back(ShaderParam("col_gr", 0, 260, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Green Shift Red"));
+	Params.push_back(ShaderParam("col_gg", 0, 264, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Green Shift Green"));
+	Params.push_back(ShaderParam("col_gb", 0, 268, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Green Shift Blue"));
+	Params.push_back(ShaderParam("col_br", 0, 272, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Blue Shift Red"));
+	Params.push_back(ShaderParam("col_bg", 0, 276, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Blue Shift Green"));
+	Params.push_back(ShaderParam("col_bb", 0, 280, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Blue Shift Blue"));
+	Params.push_back(ShaderParam("col_offset_x", 0, 284, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Offset X"));
+	Params.push_back(ShaderParam("col_offset_y", 0, 288, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Offset Y"));
+	Params.push_back(ShaderParam("col_offset_z", 0, 292, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Offset Z"));
+	Params.push_back(ShaderParam("col_scale_x", 0, 296, 4, 0.000000f, 2.000000f, 0.950000f, 0.010000f, "Scale X"));
+	Params.push_back(ShaderParam("col_scale_y", 0, 300, 4, 0.000000f, 2.000000f, 0.950000f, 0.010000f, "Scale Y"));
+	Params.push_back(ShaderParam("col_scale_z", 0, 304, 4, 0.000000f, 2.000000f, 0.950000f, 0.010000f, "Scale Z"));
+	Params.push_back(ShaderParam("col_saturation", 0, 308, 4, 0.000000f, 4.000000f, 1.200000f, 0.010000f, "Color Saturation"));
+	Params.push_back(ShaderParam("converge_x_r", 0, 312, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence X Red"));
+	Params.push_back(ShaderParam("converge_x_g", 0, 316, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence X Green"));
+	Params.push_back(ShaderParam("converge_x_b", 0, 320, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence X Blue"));
+	Params.push_back(ShaderParam("converge_y_r", 0, 324, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence Y Red"));
+	Params.push_back(ShaderParam("converge_y_g", 0, 328, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence Y Green"));
+	Params.push_back(ShaderParam("converge_y_b", 0, 332, 4, -10.000000f, 10.000000f, 0.000000f, 0.050000f, "Convergence Y Blue"));
+	Params.push_back(ShaderParam("radial_conv_x_r", 0, 336, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv X Red"));
+	Params.push_back(ShaderParam("radial_conv_x_g", 0, 340, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv X Green"));
+	Params.push_back(ShaderParam("radial_conv_x_b", 0, 344, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv X Blue"));
+	Params.push_back(ShaderParam("radial_conv_y_r", 0, 348, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv Y Red"));
+	Params.push_back(ShaderParam("radial_conv_y_g", 0, 352, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv Y Green"));
+	Params.push_back(ShaderParam("radial_conv_y_b", 0, 356, 4, -10.000000f, 10.000000f, 0.000000f, 0.010000f, "Radial Conv Y Blue"));
+	Params.push_back(ShaderParam("scanlinealpha", 0, 360, 4, 0.000000f, 1.000000f, 0.350000f, 0.010000f, "Scanline Amount"));
+	Params.push_back(ShaderParam("scanlinescale", 0, 364, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Overall Scanline Scale"));
+	Params.push_back(ShaderParam("scanlineheight", 0, 368, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Individual Scanline Scale"));
+	Params.push_back(ShaderParam("scanlinevariation", 0, 372, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Scanline Variation"));
+	Params.push_back(ShaderParam("scanlineoffset", 0, 376, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scanlinebrightscale", 0, 380, 4, 0.000000f, 4.000000f, 2.000000f, 0.010000f, "Scanline Brightness Scale"));
+	Params.push_back(ShaderParam("scanlinebrightoffset", 0, 384, 4, 0.000000f, 4.000000f, 1.500000f, 0.010000f, "Scanline Brightness Offset"));
+	Params.push_back(ShaderParam("scanline_jitter_amount", 0, 388, 4, 0.000000f, 2.000000f, 0.250000f, 0.010000f, "Scanline Jitter Amount"));
+	Params.push_back(ShaderParam("defocus_x", 0, 392, 4, 0.000000f, 10.000000f, 0.000000f, 0.100000f, "Defocus X Axis"));
+	Params.push_back(ShaderParam("defocus_y", 0, 396, 4, 0.000000f, 10.000000f, 0.000000f, 0.100000f, "Defocus Y Axis"));
+	Params.push_back(ShaderParam("time", 0, 400, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("phosphor_r", 0, 404, 4, 0.000000f, 0.990000f, 0.450000f, 0.010000f, "Phosphor Red"));
+	Params.push_back(ShaderParam("phosphor_g", 0, 408, 4, 0.000000f, 0.990000f, 0.450000f, 0.010000f, "Phosphor Green"));
+	Params.push_back(ShaderParam("phosphor_b", 0, 412, 4, 0.000000f, 0.990000f, 0.450000f, 0.010000f, "Phosphor Blue"));
+	Params.push_back(ShaderParam("phosphortoggle", 0, 416, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Phosphor Toggle"));
+	Params.push_back(ShaderParam("ygain_r", 0, 420, 4, 0.000000f, 1.000000f, 0.212600f, 0.010000f, "Y Gain R Channel"));
+	Params.push_back(ShaderParam("ygain_g", 0, 424, 4, 0.000000f, 1.000000f, 0.715200f, 0.010000f, "Y Gain G Channel"));
+	Params.push_back(ShaderParam("ygain_b", 0, 428, 4, 0.000000f, 1.000000f, 0.072200f, 0.010000f, "Y Gain B Channel"));
+	Params.push_back(ShaderParam("chromaa_x", 0, 432, 4, 0.000000f, 1.000000f, 0.630000f, 0.010000f, "Chroma A X"));
+	Params.push_back(ShaderParam("chromaa_y", 0, 436, 4, 0.000000f, 1.000000f, 0.340000f, 0.010000f, "Chroma A Y"));
+	Params.push_back(ShaderParam("chromab_x", 0, 440, 4, 0.000000f, 1.000000f, 0.310000f, 0.010000f, "Chroma B X"));
+	Params.push_back(ShaderParam("chromab_y", 0, 444, 4, 0.000000f, 1.000000f, 0.595000f, 0.010000f, "Chroma B Y"));
+	Params.push_back(ShaderParam("chromac_x", 0, 448, 4, 0.000000f, 1.000000f, 0.155000f, 0.010000f, "Chroma C X"));
+	Params.push_back(ShaderParam("chromac_y", 0, 452, 4, 0.000000f, 1.000000f, 0.070000f, 0.010000f, "Chroma C Y"));
+	Params.push_back(ShaderParam("distortion_amount", 0, 456, 4, -2.000000f, 2.000000f, 0.050000f, 0.010000f, "Quadric Dist. Amt"));
+	Params.push_back(ShaderParam("cubic_distortion_amount", 0, 460, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Cubic Dist. Amt"));
+	Params.push_back(ShaderParam("distort_corner_amount", 0, 464, 4, 0.000000f, 2.000000f, 0.050000f, 0.010000f, "Dist. Corner Amt"));
+	Params.push_back(ShaderParam("round_corner_amount", 0, 468, 4, 0.000000f, 2.000000f, 0.050000f, 0.010000f, "Rounded Corner Amt"));
+	Params.push_back(ShaderParam("smooth_border_amount", 0, 472, 4, 0.000000f, 2.000000f, 0.030000f, 0.010000f, "Smooth Border Amt"));
+	Params.push_back(ShaderParam("vignette_amount", 0, 476, 4, 0.000000f, 2.000000f, 0.080000f, 0.010000f, "Vignetting Amount"));
+	Params.push_back(ShaderParam("reflection_amount", 0, 480, 4, 0.000000f, 2.000000f, 0.050000f, 0.010000f, "Reflection Amount"));
+	Params.push_back(ShaderParam("jitter", 0, 484, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Scanline Jitter (OFF/ON/AUTO)"));
+	Params.push_back(ShaderParam("humbar_hertz_rate", 0, 488, 4, 0.000000f, 1.000000f, 0.001000f, 0.001000f, "Hum Bar Frequency"));
+	Params.push_back(ShaderParam("prescale", 0, 492, 4, 1.000000f, 4.000000f, 2.000000f, 1.000000f, "PreScale Factor"));
+	Params.push_back(ShaderParam("scanline_crawl", 0, 496, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Crawl"));
+	Params.push_back(ShaderParam("noise_amt", 0, 500, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Noise/Grain (reduces moire)"));
+	Params.push_back(ShaderParam("TATE_toggle", 0, 504, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "TATE Mode"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersMetacrtBasilicaTextureDef : public TextureDef
+{
+public:
+	CrtShadersMetacrtBasilicaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersMetacrtBasilicaTextureDefs
 {
 const BYTE sData[] =
@@ -1284,13 +1292,10 @@ const BYTE sData[] =
 ,169,218,204,37,22,156,35,38,66,187,205,48,87,192,95,142,203,154,253,100,85,236,227,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersMetacrtBasilicaTextureDef : public TextureDef
+CrtShadersMetacrtBasilicaTextureDef::CrtShadersMetacrtBasilicaTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersMetacrtBasilicaTextureDef() : TextureDef{}
-	{
-		Name = "basilica.png";
-		Data = CrtShadersMetacrtBasilicaTextureDefs::sData;
-		DataLength = sizeof(CrtShadersMetacrtBasilicaTextureDefs::sData);
-	}
-};
+	Name = "basilica.png";
+	Data = CrtShadersMetacrtBasilicaTextureDefs::sData;
+	DataLength = sizeof(CrtShadersMetacrtBasilicaTextureDefs::sData);
+}
+#endif
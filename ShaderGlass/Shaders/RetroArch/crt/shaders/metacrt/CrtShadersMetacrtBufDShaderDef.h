@@ -42,6 +42,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersMetacrtBufDShaderDef : public ShaderDef
+{
+public:
+	CrtShadersMetacrtBufDShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersMetacrtBufDShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1170,33 +1181,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersMetacrtBufDShaderDef : public ShaderDef
+RetroArch::CrtShadersMetacrtBufDShaderDef::CrtShadersMetacrtBufDShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersMetacrtBufDShaderDef() : ShaderDef{}
-	{
-		Name = "bufD";
-		VertexByteCode = RetroArchCrtShadersMetacrtBufDShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersMetacrtBufDShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersMetacrtBufDShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersMetacrtBufDShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("cubeMap", 3));
-		Samplers.push_back(ShaderSampler("table", 4));
+	Name = "bufD";
+	VertexByteCode = RetroArchCrtShadersMetacrtBufDShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersMetacrtBufDShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersMetacrtBufDShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersMetacrtBufDShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("cubeMap", 3));
+	Samplers.push_back(ShaderSampler("table", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -47,6 +47,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersMetacrtImageShaderDef : public ShaderDef
+{
+public:
+	CrtShadersMetacrtImageShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersMetacrtImageShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1186,34 +1197,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersMetacrtImageShaderDef : public ShaderDef
+RetroArch::CrtShadersMetacrtImageShaderDef::CrtShadersMetacrtImageShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersMetacrtImageShaderDef() : ShaderDef{}
-	{
-		Name = "Image";
-		VertexByteCode = RetroArchCrtShadersMetacrtImageShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersMetacrtImageShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersMetacrtImageShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersMetacrtImageShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("flip_image", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Image (for hardware-rendered cores)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("cubeMap", 3));
-		Samplers.push_back(ShaderSampler("table", 4));
+	Name = "Image";
+	VertexByteCode = RetroArchCrtShadersMetacrtImageShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersMetacrtImageShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersMetacrtImageShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersMetacrtImageShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("flip_image", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Image (for hardware-rendered cores)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("cubeMap", 3));
+	Samplers.push_back(ShaderSampler("table", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
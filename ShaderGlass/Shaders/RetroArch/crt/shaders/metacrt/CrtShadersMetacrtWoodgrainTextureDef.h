@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersMetacrtWoodgrainTextureDef : public TextureDef
+{
+public:
+	CrtShadersMetacrtWoodgrainTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersMetacrtWoodgrainTextureDefs
 {
 const BYTE sData[] =
@@ -5824,13 +5832,10 @@ const BYTE sData[] =
 ,2,149,255,225,127,56,193,191,50,228,31,57,193,252,141,40,248,23,248,255,15,145,3,44,22,52,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersMetacrtWoodgrainTextureDef : public TextureDef
+CrtShadersMetacrtWoodgrainTextureDef::CrtShadersMetacrtWoodgrainTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersMetacrtWoodgrainTextureDef() : TextureDef{}
-	{
-		Name = "woodgrain.png";
-		Data = CrtShadersMetacrtWoodgrainTextureDefs::sData;
-		DataLength = sizeof(CrtShadersMetacrtWoodgrainTextureDefs::sData);
-	}
-};
+	Name = "woodgrain.png";
+	Data = CrtShadersMetacrtWoodgrainTextureDefs::sData;
+	DataLength = sizeof(CrtShadersMetacrtWoodgrainTextureDefs::sData);
+}
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersNewpixieAccumulateShaderDef : public ShaderDef
+{
+public:
+	CrtShadersNewpixieAccumulateShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersNewpixieAccumulateShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -413,33 +424,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersNewpixieAccumulateShaderDef : public ShaderDef
+RetroArch::CrtShadersNewpixieAccumulateShaderDef::CrtShadersNewpixieAccumulateShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersNewpixieAccumulateShaderDef() : ShaderDef{}
-	{
-		Name = "accumulate";
-		VertexByteCode = RetroArchCrtShadersNewpixieAccumulateShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersNewpixieAccumulateShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersNewpixieAccumulateShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersNewpixieAccumulateShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("acc_modulate", -1, 52, 4, 0.000000f, 1.000000f, 0.650000f, 0.010000f, "Accumulate Modulation"));
-		Samplers.push_back(ShaderSampler("PassFeedback1", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "accumulate";
+	VertexByteCode = RetroArchCrtShadersNewpixieAccumulateShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersNewpixieAccumulateShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersNewpixieAccumulateShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersNewpixieAccumulateShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("acc_modulate", -1, 52, 4, 0.000000f, 1.000000f, 0.650000f, 0.010000f, "Accumulate Modulation"));
+	Samplers.push_back(ShaderSampler("PassFeedback1", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
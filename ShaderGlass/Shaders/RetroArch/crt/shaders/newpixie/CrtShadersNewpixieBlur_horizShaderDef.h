@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersNewpixieBlur_horizShaderDef : public ShaderDef
+{
+public:
+	CrtShadersNewpixieBlur_horizShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersNewpixieBlur_horizShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -559,32 +570,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersNewpixieBlur_horizShaderDef : public ShaderDef
+RetroArch::CrtShadersNewpixieBlur_horizShaderDef::CrtShadersNewpixieBlur_horizShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersNewpixieBlur_horizShaderDef() : ShaderDef{}
-	{
-		Name = "blur_horiz";
-		VertexByteCode = RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blur_x", -1, 52, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Horizontal Blur"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_horiz";
+	VertexByteCode = RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersNewpixieBlur_horizShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blur_x", -1, 52, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Horizontal Blur"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
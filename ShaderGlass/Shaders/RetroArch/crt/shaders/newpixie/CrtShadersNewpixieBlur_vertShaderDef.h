@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersNewpixieBlur_vertShaderDef : public ShaderDef
+{
+public:
+	CrtShadersNewpixieBlur_vertShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersNewpixieBlur_vertShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -559,32 +570,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersNewpixieBlur_vertShaderDef : public ShaderDef
+RetroArch::CrtShadersNewpixieBlur_vertShaderDef::CrtShadersNewpixieBlur_vertShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersNewpixieBlur_vertShaderDef() : ShaderDef{}
-	{
-		Name = "blur_vert";
-		VertexByteCode = RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blur_y", -1, 52, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Vertical Blur"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blur_vert";
+	VertexByteCode = RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersNewpixieBlur_vertShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blur_y", -1, 52, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Vertical Blur"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
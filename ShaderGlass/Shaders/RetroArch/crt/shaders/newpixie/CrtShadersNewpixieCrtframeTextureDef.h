@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersNewpixieCrtframeTextureDef : public TextureDef
+{
+public:
+	CrtShadersNewpixieCrtframeTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersNewpixieCrtframeTextureDefs
 {
 const BYTE sData[] =
@@ -2618,13 +2626,10 @@ const BYTE sData[] =
 ,192,183,113,82,163,92,112,127,219,151,63,252,247,255,15,69,104,141,24,194,211,120,71,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersNewpixieCrtframeTextureDef : public TextureDef
+CrtShadersNewpixieCrtframeTextureDef::CrtShadersNewpixieCrtframeTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersNewpixieCrtframeTextureDef() : TextureDef{}
-	{
-		Name = "crtframe.png";
-		Data = CrtShadersNewpixieCrtframeTextureDefs::sData;
-		DataLength = sizeof(CrtShadersNewpixieCrtframeTextureDefs::sData);
-	}
-};
+	Name = "crtframe.png";
+	Data = CrtShadersNewpixieCrtframeTextureDefs::sData;
+	DataLength = sizeof(CrtShadersNewpixieCrtframeTextureDefs::sData);
+}
+#endif
@@ -33,6 +33,17 @@ vec2 seed = floor(curved_uv*resolution.xy*vec2(0.5))/resolution.xy;
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersNewpixieNewpixieCrtShaderDef : public ShaderDef
+{
+public:
+	CrtShadersNewpixieNewpixieCrtShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1666,39 +1677,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersNewpixieNewpixieCrtShaderDef : public ShaderDef
+RetroArch::CrtShadersNewpixieNewpixieCrtShaderDef::CrtShadersNewpixieNewpixieCrtShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersNewpixieNewpixieCrtShaderDef() : ShaderDef{}
-	{
-		Name = "newpixie-crt";
-		VertexByteCode = RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("use_frame", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Frame Image"));
-		Params.push_back(ShaderParam("curvature", -1, 40, 4, 0.000100f, 4.000000f, 2.000000f, 0.250000f, "Curvature"));
-		Params.push_back(ShaderParam("wiggle_toggle", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interference"));
-		Params.push_back(ShaderParam("scanroll", -1, 48, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Rolling Scanlines"));
-		Params.push_back(ShaderParam("vignette", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Vignette"));
-		Params.push_back(ShaderParam("ghosting", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Ghosting"));
-		Samplers.push_back(ShaderSampler("accum1", 3));
-		Samplers.push_back(ShaderSampler("blur2", 4));
-		Samplers.push_back(ShaderSampler("frametexture", 5));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "newpixie-crt";
+	VertexByteCode = RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersNewpixieNewpixieCrtShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("use_frame", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Frame Image"));
+	Params.push_back(ShaderParam("curvature", -1, 40, 4, 0.000100f, 4.000000f, 2.000000f, 0.250000f, "Curvature"));
+	Params.push_back(ShaderParam("wiggle_toggle", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interference"));
+	Params.push_back(ShaderParam("scanroll", -1, 48, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Rolling Scanlines"));
+	Params.push_back(ShaderParam("vignette", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Vignette"));
+	Params.push_back(ShaderParam("ghosting", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Ghosting"));
+	Samplers.push_back(ShaderSampler("accum1", 3));
+	Samplers.push_back(ShaderSampler("blur2", 4));
+	Samplers.push_back(ShaderSampler("frametexture", 5));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
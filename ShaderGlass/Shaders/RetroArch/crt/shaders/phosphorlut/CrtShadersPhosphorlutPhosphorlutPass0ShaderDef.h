@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersPhosphorlutPhosphorlutPass0ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersPhosphorlutPhosphorlutPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -513,38 +524,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersPhosphorlutPhosphorlutPass0ShaderDef : public ShaderDef
+RetroArch::CrtShadersPhosphorlutPhosphorlutPass0ShaderDef::CrtShadersPhosphorlutPhosphorlutPass0ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersPhosphorlutPhosphorlutPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "phosphorlut-pass0";
-		VertexByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PHOSPHOR_SCALE_X", -1, 52, 4, 1.000000f, 12.000000f, 2.000000f, 1.000000f, "Phosphor Scale X"));
-		Params.push_back(ShaderParam("PHOSPHOR_SCALE_Y", -1, 56, 4, 1.000000f, 12.000000f, 4.000000f, 1.000000f, "Phosphor Scale Y"));
-		Params.push_back(ShaderParam("phosphor_layout", -1, 60, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Phosphor Layout"));
-		Samplers.push_back(ShaderSampler("firstPass", 6));
-		Samplers.push_back(ShaderSampler("shadow", 3));
-		Samplers.push_back(ShaderSampler("aperture", 4));
-		Samplers.push_back(ShaderSampler("slot", 5));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "phosphorlut-pass0";
+	VertexByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PHOSPHOR_SCALE_X", -1, 52, 4, 1.000000f, 12.000000f, 2.000000f, 1.000000f, "Phosphor Scale X"));
+	Params.push_back(ShaderParam("PHOSPHOR_SCALE_Y", -1, 56, 4, 1.000000f, 12.000000f, 4.000000f, 1.000000f, "Phosphor Scale Y"));
+	Params.push_back(ShaderParam("phosphor_layout", -1, 60, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Phosphor Layout"));
+	Samplers.push_back(ShaderSampler("firstPass", 6));
+	Samplers.push_back(ShaderSampler("shadow", 3));
+	Samplers.push_back(ShaderSampler("aperture", 4));
+	Samplers.push_back(ShaderSampler("slot", 5));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
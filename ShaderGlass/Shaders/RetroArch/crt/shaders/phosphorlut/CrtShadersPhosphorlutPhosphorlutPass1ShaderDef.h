@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersPhosphorlutPhosphorlutPass1ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersPhosphorlutPhosphorlutPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -505,35 +516,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersPhosphorlutPhosphorlutPass1ShaderDef : public ShaderDef
+RetroArch::CrtShadersPhosphorlutPhosphorlutPass1ShaderDef::CrtShadersPhosphorlutPhosphorlutPass1ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersPhosphorlutPhosphorlutPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "phosphorlut-pass1";
-		VertexByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("diffusion", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Halation Strength"));
-		Params.push_back(ShaderParam("out_gamma", -1, 56, 4, 1.500000f, 3.000000f, 2.200000f, 0.100000f, "Display Gamma"));
-		Samplers.push_back(ShaderSampler("firstPass", 2));
-		Samplers.push_back(ShaderSampler("blurPass", 3));
-		Samplers.push_back(ShaderSampler("phosphorPass", 4));
+	Name = "phosphorlut-pass1";
+	VertexByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersPhosphorlutPhosphorlutPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("diffusion", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Halation Strength"));
+	Params.push_back(ShaderParam("out_gamma", -1, 56, 4, 1.500000f, 3.000000f, 2.200000f, 0.100000f, "Display Gamma"));
+	Samplers.push_back(ShaderSampler("firstPass", 2));
+	Samplers.push_back(ShaderSampler("blurPass", 3));
+	Samplers.push_back(ShaderSampler("phosphorPass", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
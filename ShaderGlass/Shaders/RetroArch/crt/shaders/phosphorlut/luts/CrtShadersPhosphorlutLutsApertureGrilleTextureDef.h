@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersPhosphorlutLutsApertureGrilleTextureDef : public TextureDef
+{
+public:
+	CrtShadersPhosphorlutLutsApertureGrilleTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersPhosphorlutLutsApertureGrilleTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,66,96,130};
 }
 
-class CrtShadersPhosphorlutLutsApertureGrilleTextureDef : public TextureDef
+CrtShadersPhosphorlutLutsApertureGrilleTextureDef::CrtShadersPhosphorlutLutsApertureGrilleTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersPhosphorlutLutsApertureGrilleTextureDef() : TextureDef{}
-	{
-		Name = "aperture-grille.png";
-		Data = CrtShadersPhosphorlutLutsApertureGrilleTextureDefs::sData;
-		DataLength = sizeof(CrtShadersPhosphorlutLutsApertureGrilleTextureDefs::sData);
-	}
-};
+	Name = "aperture-grille.png";
+	Data = CrtShadersPhosphorlutLutsApertureGrilleTextureDefs::sData;
+	DataLength = sizeof(CrtShadersPhosphorlutLutsApertureGrilleTextureDefs::sData);
+}
+#endif
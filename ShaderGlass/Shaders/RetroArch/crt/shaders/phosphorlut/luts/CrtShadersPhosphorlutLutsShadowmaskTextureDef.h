@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersPhosphorlutLutsShadowmaskTextureDef : public TextureDef
+{
+public:
+	CrtShadersPhosphorlutLutsShadowmaskTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersPhosphorlutLutsShadowmaskTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,131,45,36,71,67,114,52,36,1,124,134,223,153,41,133,74,161,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersPhosphorlutLutsShadowmaskTextureDef : public TextureDef
+CrtShadersPhosphorlutLutsShadowmaskTextureDef::CrtShadersPhosphorlutLutsShadowmaskTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersPhosphorlutLutsShadowmaskTextureDef() : TextureDef{}
-	{
-		Name = "shadowmask.png";
-		Data = CrtShadersPhosphorlutLutsShadowmaskTextureDefs::sData;
-		DataLength = sizeof(CrtShadersPhosphorlutLutsShadowmaskTextureDefs::sData);
-	}
-};
+	Name = "shadowmask.png";
+	Data = CrtShadersPhosphorlutLutsShadowmaskTextureDefs::sData;
+	DataLength = sizeof(CrtShadersPhosphorlutLutsShadowmaskTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class CrtShadersPhosphorlutLutsSlotmaskTextureDef : public TextureDef
+{
+public:
+	CrtShadersPhosphorlutLutsSlotmaskTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace CrtShadersPhosphorlutLutsSlotmaskTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,249,174,192,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class CrtShadersPhosphorlutLutsSlotmaskTextureDef : public TextureDef
+CrtShadersPhosphorlutLutsSlotmaskTextureDef::CrtShadersPhosphorlutLutsSlotmaskTextureDef() : TextureDef{}
 {
-public:
-	CrtShadersPhosphorlutLutsSlotmaskTextureDef() : TextureDef{}
-	{
-		Name = "slotmask.png";
-		Data = CrtShadersPhosphorlutLutsSlotmaskTextureDefs::sData;
-		DataLength = sizeof(CrtShadersPhosphorlutLutsSlotmaskTextureDefs::sData);
-	}
-};
+	Name = "slotmask.png";
+	Data = CrtShadersPhosphorlutLutsSlotmaskTextureDefs::sData;
+	DataLength = sizeof(CrtShadersPhosphorlutLutsSlotmaskTextureDefs::sData);
+}
+#endif
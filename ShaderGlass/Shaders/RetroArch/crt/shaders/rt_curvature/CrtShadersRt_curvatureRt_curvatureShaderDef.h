@@ -81,6 +81,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersRt_curvatureRt_curvatureShaderDef : public ShaderDef
+{
+public:
+	CrtShadersRt_curvatureRt_curvatureShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1988,42 +1999,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersRt_curvatureRt_curvatureShaderDef : public ShaderDef
+RetroArch::CrtShadersRt_curvatureRt_curvatureShaderDef::CrtShadersRt_curvatureRt_curvatureShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersRt_curvatureRt_curvatureShaderDef() : ShaderDef{}
-	{
-		Name = "rt_curvature";
-		VertexByteCode = RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RT_CURV_ASPECT_H", -1, 52, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Horizontal aspect ratio (0 = unchanged)"));
-		Params.push_back(ShaderParam("RT_CURV_ASPECT_V", -1, 56, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Vertical aspect ratio (0 = unchanged)"));
-		Params.push_back(ShaderParam("RT_CURV_SHAPE", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Screen shape (0 = sphere, 1 = cylinder)"));
-		Params.push_back(ShaderParam("RT_CURV_CURVATURE", -1, 64, 4, 0.000000f, 1.500000f, 0.500000f, 0.050000f, "Curvature strength"));
-		Params.push_back(ShaderParam("RT_CURV_ZOOM", -1, 68, 4, 0.800000f, 1.200000f, 0.990000f, 0.010000f, "Zoom"));
-		Params.push_back(ShaderParam("RT_CURV_TILT_ANGLE_H", -1, 72, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Horizontal tilt"));
-		Params.push_back(ShaderParam("RT_CURV_TILT_ANGLE_V", -1, 76, 4, -0.500000f, 0.500000f, -0.080000f, 0.010000f, "Vertical tilt"));
-		Params.push_back(ShaderParam("RT_CURV_F", -1, 80, 4, 0.500000f, 10.000000f, 2.000000f, 0.250000f, "Focal Length (max = ortho)"));
-		Params.push_back(ShaderParam("RT_CURV_ROUNDED_CORNER", -1, 84, 4, 0.000000f, 0.200000f, 0.020000f, 0.010000f, "Rounded corner radius"));
-		Params.push_back(ShaderParam("RT_CURV_LOD_BIAS", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Anti-aliasing boost"));
-		Params.push_back(ShaderParam("RT_CURV_APPEND", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Disable pixel art sampling (for append)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "rt_curvature";
+	VertexByteCode = RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersRt_curvatureRt_curvatureShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RT_CURV_ASPECT_H", -1, 52, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Horizontal aspect ratio (0 = unchanged)"));
+	Params.push_back(ShaderParam("RT_CURV_ASPECT_V", -1, 56, 4, 0.000000f, 256.000000f, 0.000000f, 1.000000f, "Vertical aspect ratio (0 = unchanged)"));
+	Params.push_back(ShaderParam("RT_CURV_SHAPE", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Screen shape (0 = sphere, 1 = cylinder)"));
+	Params.push_back(ShaderParam("RT_CURV_CURVATURE", -1, 64, 4, 0.000000f, 1.500000f, 0.500000f, 0.050000f, "Curvature strength"));
+	Params.push_back(ShaderParam("RT_CURV_ZOOM", -1, 68, 4, 0.800000f, 1.200000f, 0.990000f, 0.010000f, "Zoom"));
+	Params.push_back(ShaderParam("RT_CURV_TILT_ANGLE_H", -1, 72, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Horizontal tilt"));
+	Params.push_back(ShaderParam("RT_CURV_TILT_ANGLE_V", -1, 76, 4, -0.500000f, 0.500000f, -0.080000f, 0.010000f, "Vertical tilt"));
+	Params.push_back(ShaderParam("RT_CURV_F", -1, 80, 4, 0.500000f, 10.000000f, 2.000000f, 0.250000f, "Focal Length (max = ortho)"));
+	Params.push_back(ShaderParam("RT_CURV_ROUNDED_CORNER", -1, 84, 4, 0.000000f, 0.200000f, 0.020000f, 0.010000f, "Rounded corner radius"));
+	Params.push_back(ShaderParam("RT_CURV_LOD_BIAS", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Anti-aliasing boost"));
+	Params.push_back(ShaderParam("RT_CURV_APPEND", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Disable pixel art sampling (for append)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
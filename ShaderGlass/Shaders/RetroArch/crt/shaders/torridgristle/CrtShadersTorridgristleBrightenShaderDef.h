@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersTorridgristleBrightenShaderDef : public ShaderDef
+{
+public:
+	CrtShadersTorridgristleBrightenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersTorridgristleBrightenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -423,33 +434,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersTorridgristleBrightenShaderDef : public ShaderDef
+RetroArch::CrtShadersTorridgristleBrightenShaderDef::CrtShadersTorridgristleBrightenShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersTorridgristleBrightenShaderDef() : ShaderDef{}
-	{
-		Name = "Brighten";
-		VertexByteCode = RetroArchCrtShadersTorridgristleBrightenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersTorridgristleBrightenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersTorridgristleBrightenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersTorridgristleBrightenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BrightenLevel", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Brighten Level"));
-		Params.push_back(ShaderParam("BrightenAmount", -1, 56, 4, 0.000000f, 1.000000f, 0.100000f, 0.100000f, "Brighten Amount"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "Brighten";
+	VertexByteCode = RetroArchCrtShadersTorridgristleBrightenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersTorridgristleBrightenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersTorridgristleBrightenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersTorridgristleBrightenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BrightenLevel", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Brighten Level"));
+	Params.push_back(ShaderParam("BrightenAmount", -1, 56, 4, 0.000000f, 1.000000f, 0.100000f, 0.100000f, "Brighten Amount"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersTorridgristleCandyBloomShaderDef : public ShaderDef
+{
+public:
+	CrtShadersTorridgristleCandyBloomShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersTorridgristleCandyBloomShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -470,34 +481,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersTorridgristleCandyBloomShaderDef : public ShaderDef
+RetroArch::CrtShadersTorridgristleCandyBloomShaderDef::CrtShadersTorridgristleCandyBloomShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersTorridgristleCandyBloomShaderDef() : ShaderDef{}
-	{
-		Name = "Candy-Bloom";
-		VertexByteCode = RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GlowLevel", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Glow Level"));
-		Params.push_back(ShaderParam("GlowTightness", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Glow Tightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("candy_ref", 3));
+	Name = "Candy-Bloom";
+	VertexByteCode = RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersTorridgristleCandyBloomShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GlowLevel", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Glow Level"));
+	Params.push_back(ShaderParam("GlowTightness", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Glow Tightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("candy_ref", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersTorridgristleScanlineSimpleShaderDef : public ShaderDef
+{
+public:
+	CrtShadersTorridgristleScanlineSimpleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -552,33 +563,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersTorridgristleScanlineSimpleShaderDef : public ShaderDef
+RetroArch::CrtShadersTorridgristleScanlineSimpleShaderDef::CrtShadersTorridgristleScanlineSimpleShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersTorridgristleScanlineSimpleShaderDef() : ShaderDef{}
-	{
-		Name = "ScanlineSimple";
-		VertexByteCode = RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ScanlineSize", -1, 52, 4, 2.000000f, 32.000000f, 3.000000f, 1.000000f, "Scanline Size"));
-		Params.push_back(ShaderParam("YIQAmount", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "YIQ Amount"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ScanlineSimple";
+	VertexByteCode = RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersTorridgristleScanlineSimpleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ScanlineSize", -1, 52, 4, 2.000000f, 32.000000f, 3.000000f, 1.000000f, "Scanline Size"));
+	Params.push_back(ShaderParam("YIQAmount", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "YIQ Amount"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -109,6 +109,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersVt220Vt220ShaderDef : public ShaderDef
+{
+public:
+	CrtShadersVt220Vt220ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersVt220Vt220ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -7353,47 +7364,41 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersVt220Vt220ShaderDef : public ShaderDef
+RetroArch::CrtShadersVt220Vt220ShaderDef::CrtShadersVt220Vt220ShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersVt220Vt220ShaderDef() : ShaderDef{}
-	{
-		Name = "vt220";
-		VertexByteCode = RetroArchCrtShadersVt220Vt220ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersVt220Vt220ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersVt220Vt220ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersVt220Vt220ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ntsc_toggle", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NTSC Toggle"));
-		Params.push_back(ShaderParam("curvature", 0, 68, 4, 0.000000f, 10.000000f, 3.000000f, 0.100000f, "Curve Radius"));
-		Params.push_back(ShaderParam("width", 0, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Width"));
-		Params.push_back(ShaderParam("height", 0, 76, 4, 0.000000f, 2.000000f, 1.120000f, 0.010000f, "Height"));
-		Params.push_back(ShaderParam("smoothness", 0, 80, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Border Blur"));
-		Params.push_back(ShaderParam("shine", 0, 84, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Screen Reflection"));
-		Params.push_back(ShaderParam("blur_size", 0, 88, 4, 0.000000f, 5.000000f, 3.000000f, 0.050000f, "Reflection Blur"));
-		Params.push_back(ShaderParam("dimmer", 0, 92, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Ambient Brightness"));
-		Params.push_back(ShaderParam("csize", 0, 96, 4, 0.000000f, 0.070000f, 0.045000f, 0.010000f, "Corner size"));
-		Params.push_back(ShaderParam("mask", 0, 100, 4, 0.000000f, 19.000000f, 2.000000f, 1.000000f, "Mask Type"));
-		Params.push_back(ShaderParam("zoom", 0, 104, 4, 0.000000f, 2.000000f, 0.850000f, 0.010000f, "Viewing Distance"));
-		Params.push_back(ShaderParam("mask_strength", 0, 108, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Strength"));
-		Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", 0, 116, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", 0, 120, 4, 0.000000f, 1.000000f, 0.150000f, 0.050000f, "Scanline Darkness"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("vt220_refpass", 3));
+	Name = "vt220";
+	VertexByteCode = RetroArchCrtShadersVt220Vt220ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersVt220Vt220ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersVt220Vt220ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersVt220Vt220ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ntsc_toggle", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NTSC Toggle"));
+	Params.push_back(ShaderParam("curvature", 0, 68, 4, 0.000000f, 10.000000f, 3.000000f, 0.100000f, "Curve Radius"));
+	Params.push_back(ShaderParam("width", 0, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Width"));
+	Params.push_back(ShaderParam("height", 0, 76, 4, 0.000000f, 2.000000f, 1.120000f, 0.010000f, "Height"));
+	Params.push_back(ShaderParam("smoothness", 0, 80, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Border Blur"));
+	Params.push_back(ShaderParam("shine", 0, 84, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Screen Reflection"));
+	Params.push_back(ShaderParam("blur_size", 0, 88, 4, 0.000000f, 5.000000f, 3.000000f, 0.050000f, "Reflection Blur"));
+	Params.push_back(ShaderParam("dimmer", 0, 92, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Ambient Brightness"));
+	Params.push_back(ShaderParam("csize", 0, 96, 4, 0.000000f, 0.070000f, 0.045000f, 0.010000f, "Corner size"));
+	Params.push_back(ShaderParam("mask", 0, 100, 4, 0.000000f, 19.000000f, 2.000000f, 1.000000f, "Mask Type"));
+	Params.push_back(ShaderParam("zoom", 0, 104, 4, 0.000000f, 2.000000f, 0.850000f, 0.010000f, "Viewing Distance"));
+	Params.push_back(ShaderParam("mask_strength", 0, 108, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Strength"));
+	Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", 0, 116, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", 0, 120, 4, 0.000000f, 1.000000f, 0.150000f, 0.050000f, "Scanline Darkness"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("vt220_refpass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersZfast_crtZfast_crt_compositeShaderDef : public ShaderDef
+{
+public:
+	CrtShadersZfast_crtZfast_crt_compositeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1063,42 +1074,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersZfast_crtZfast_crt_compositeShaderDef : public ShaderDef
+RetroArch::CrtShadersZfast_crtZfast_crt_compositeShaderDef::CrtShadersZfast_crtZfast_crt_compositeShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersZfast_crtZfast_crt_compositeShaderDef() : ShaderDef{}
-	{
-		Name = "zfast_crt_composite";
-		VertexByteCode = RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pi", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blurx", -1, 56, 4, -1.000000f, 2.000000f, 0.850000f, 0.050000f, "Convergence X-Axis"));
-		Params.push_back(ShaderParam("blury", -1, 60, 4, -1.000000f, 1.000000f, -0.100000f, 0.050000f, "Convergence Y-Axis"));
-		Params.push_back(ShaderParam("HIGHSCANAMOUNT1", -1, 64, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Amount (Low)"));
-		Params.push_back(ShaderParam("HIGHSCANAMOUNT2", -1, 68, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Scanline Amount (High)"));
-		Params.push_back(ShaderParam("MASK_DARK", -1, 72, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Effect Amount"));
-		Params.push_back(ShaderParam("MASK_FADE", -1, 76, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "Mask/Scanline Fade"));
-		Params.push_back(ShaderParam("sat", -1, 80, 4, 0.000000f, 3.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("FLICK", -1, 84, 4, 0.000000f, 50.000000f, 10.000000f, 1.000000f, "Flicker"));
-		Params.push_back(ShaderParam("TYPE", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask Type"));
-		Params.push_back(ShaderParam("Curvature", -1, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "zfast_crt_composite";
+	VertexByteCode = RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_compositeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pi", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blurx", -1, 56, 4, -1.000000f, 2.000000f, 0.850000f, 0.050000f, "Convergence X-Axis"));
+	Params.push_back(ShaderParam("blury", -1, 60, 4, -1.000000f, 1.000000f, -0.100000f, 0.050000f, "Convergence Y-Axis"));
+	Params.push_back(ShaderParam("HIGHSCANAMOUNT1", -1, 64, 4, 0.000000f, 1.000000f, 0.400000f, 0.050000f, "Scanline Amount (Low)"));
+	Params.push_back(ShaderParam("HIGHSCANAMOUNT2", -1, 68, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Scanline Amount (High)"));
+	Params.push_back(ShaderParam("MASK_DARK", -1, 72, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Mask Effect Amount"));
+	Params.push_back(ShaderParam("MASK_FADE", -1, 76, 4, 0.000000f, 1.000000f, 0.700000f, 0.050000f, "Mask/Scanline Fade"));
+	Params.push_back(ShaderParam("sat", -1, 80, 4, 0.000000f, 3.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("FLICK", -1, 84, 4, 0.000000f, 50.000000f, 10.000000f, 1.000000f, "Flicker"));
+	Params.push_back(ShaderParam("TYPE", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mask Type"));
+	Params.push_back(ShaderParam("Curvature", -1, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class CrtShadersZfast_crtZfast_crt_geoShaderDef : public ShaderDef
+{
+public:
+	CrtShadersZfast_crtZfast_crt_geoShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -845,33 +856,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class CrtShadersZfast_crtZfast_crt_geoShaderDef : public ShaderDef
+RetroArch::CrtShadersZfast_crtZfast_crt_geoShaderDef::CrtShadersZfast_crtZfast_crt_geoShaderDef() : ShaderDef{}
 {
-public:
-	CrtShadersZfast_crtZfast_crt_geoShaderDef() : ShaderDef{}
-	{
-		Name = "zfast_crt_geo";
-		VertexByteCode = RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE_WEIGHT", -1, 52, 4, 0.000000f, 15.000000f, 7.000000f, 0.500000f, "Scanline Amount"));
-		Params.push_back(ShaderParam("MASK_DARK", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Effect Amount"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "zfast_crt_geo";
+	VertexByteCode = RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchCrtShadersZfast_crtZfast_crt_geoShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE_WEIGHT", -1, 52, 4, 0.000000f, 15.000000f, 7.000000f, 0.500000f, "Scanline Amount"));
+	Params.push_back(ShaderParam("MASK_DARK", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Mask Effect Amount"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
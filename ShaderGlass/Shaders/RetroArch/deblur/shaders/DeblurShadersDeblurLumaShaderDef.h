@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DeblurShadersDeblurLumaShaderDef : public ShaderDef
+{
+public:
+	DeblurShadersDeblurLumaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDeblurShadersDeblurLumaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -998,34 +1009,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DeblurShadersDeblurLumaShaderDef : public ShaderDef
+RetroArch::DeblurShadersDeblurLumaShaderDef::DeblurShadersDeblurLumaShaderDef() : ShaderDef{}
 {
-public:
-	DeblurShadersDeblurLumaShaderDef() : ShaderDef{}
-	{
-		Name = "deblur-luma";
-		VertexByteCode = RetroArchDeblurShadersDeblurLumaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDeblurShadersDeblurLumaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDeblurShadersDeblurLumaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDeblurShadersDeblurLumaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OFFSET", -1, 52, 4, 0.250000f, 4.000000f, 2.000000f, 0.250000f, "Deblur offset"));
-		Params.push_back(ShaderParam("DEBLUR", -1, 56, 4, 1.000000f, 7.000000f, 4.500000f, 0.250000f, "Deblur str."));
-		Params.push_back(ShaderParam("SMART", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Smart deblur"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "deblur-luma";
+	VertexByteCode = RetroArchDeblurShadersDeblurLumaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDeblurShadersDeblurLumaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDeblurShadersDeblurLumaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDeblurShadersDeblurLumaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OFFSET", -1, 52, 4, 0.250000f, 4.000000f, 2.000000f, 0.250000f, "Deblur offset"));
+	Params.push_back(ShaderParam("DEBLUR", -1, 56, 4, 1.000000f, 7.000000f, 4.500000f, 0.250000f, "Deblur str."));
+	Params.push_back(ShaderParam("SMART", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Smart deblur"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
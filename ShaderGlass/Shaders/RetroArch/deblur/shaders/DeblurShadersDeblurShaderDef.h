@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DeblurShadersDeblurShaderDef : public ShaderDef
+{
+public:
+	DeblurShadersDeblurShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDeblurShadersDeblurShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1132,34 +1143,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DeblurShadersDeblurShaderDef : public ShaderDef
+RetroArch::DeblurShadersDeblurShaderDef::DeblurShadersDeblurShaderDef() : ShaderDef{}
 {
-public:
-	DeblurShadersDeblurShaderDef() : ShaderDef{}
-	{
-		Name = "deblur";
-		VertexByteCode = RetroArchDeblurShadersDeblurShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDeblurShadersDeblurShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDeblurShadersDeblurShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDeblurShadersDeblurShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OFFSET", -1, 52, 4, 0.500000f, 4.000000f, 2.000000f, 0.250000f, "Deblur offset"));
-		Params.push_back(ShaderParam("DEBLUR", -1, 56, 4, 1.000000f, 7.000000f, 4.500000f, 0.250000f, "Deblur str."));
-		Params.push_back(ShaderParam("SMART", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Smart deblur"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "deblur";
+	VertexByteCode = RetroArchDeblurShadersDeblurShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDeblurShadersDeblurShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDeblurShadersDeblurShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDeblurShadersDeblurShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OFFSET", -1, 52, 4, 0.500000f, 4.000000f, 2.000000f, 0.250000f, "Deblur offset"));
+	Params.push_back(ShaderParam("DEBLUR", -1, 56, 4, 1.000000f, 7.000000f, 4.500000f, 0.250000f, "Deblur str."));
+	Params.push_back(ShaderParam("SMART", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Smart deblur"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
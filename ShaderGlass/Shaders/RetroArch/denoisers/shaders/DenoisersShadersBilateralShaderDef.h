@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DenoisersShadersBilateralShaderDef : public ShaderDef
+{
+public:
+	DenoisersShadersBilateralShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDenoisersShadersBilateralShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1060,34 +1071,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DenoisersShadersBilateralShaderDef : public ShaderDef
+RetroArch::DenoisersShadersBilateralShaderDef::DenoisersShadersBilateralShaderDef() : ShaderDef{}
 {
-public:
-	DenoisersShadersBilateralShaderDef() : ShaderDef{}
-	{
-		Name = "bilateral";
-		VertexByteCode = RetroArchDenoisersShadersBilateralShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDenoisersShadersBilateralShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDenoisersShadersBilateralShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDenoisersShadersBilateralShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FRANGE", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Filter Range"));
-		Params.push_back(ShaderParam("FBSMOOTH", -1, 56, 4, 0.050000f, 1.000000f, 0.150000f, 0.025000f, "Filter Base Smoothing"));
-		Params.push_back(ShaderParam("FBOOST", -1, 60, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Boost Smoothing w. dist"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bilateral";
+	VertexByteCode = RetroArchDenoisersShadersBilateralShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDenoisersShadersBilateralShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDenoisersShadersBilateralShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDenoisersShadersBilateralShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FRANGE", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Filter Range"));
+	Params.push_back(ShaderParam("FBSMOOTH", -1, 56, 4, 0.050000f, 1.000000f, 0.150000f, 0.025000f, "Filter Base Smoothing"));
+	Params.push_back(ShaderParam("FBOOST", -1, 60, 4, 0.000000f, 5.000000f, 1.000000f, 0.250000f, "Boost Smoothing w. dist"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DenoisersShadersFastBilateralShaderDef : public ShaderDef
+{
+public:
+	DenoisersShadersFastBilateralShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDenoisersShadersFastBilateralShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1787,32 +1798,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DenoisersShadersFastBilateralShaderDef : public ShaderDef
+RetroArch::DenoisersShadersFastBilateralShaderDef::DenoisersShadersFastBilateralShaderDef() : ShaderDef{}
 {
-public:
-	DenoisersShadersFastBilateralShaderDef() : ShaderDef{}
-	{
-		Name = "fast-bilateral";
-		VertexByteCode = RetroArchDenoisersShadersFastBilateralShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDenoisersShadersFastBilateralShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDenoisersShadersFastBilateralShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDenoisersShadersFastBilateralShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIGMA_R", -1, 52, 4, 0.000000f, 1.000000f, 0.400000f, 0.100000f, "Bilateral Blur"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "fast-bilateral";
+	VertexByteCode = RetroArchDenoisersShadersFastBilateralShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDenoisersShadersFastBilateralShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDenoisersShadersFastBilateralShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDenoisersShadersFastBilateralShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIGMA_R", -1, 52, 4, 0.000000f, 1.000000f, 0.400000f, 0.100000f, "Bilateral Blur"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
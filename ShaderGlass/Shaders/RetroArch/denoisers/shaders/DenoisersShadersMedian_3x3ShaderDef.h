@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DenoisersShadersMedian_3x3ShaderDef : public ShaderDef
+{
+public:
+	DenoisersShadersMedian_3x3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDenoisersShadersMedian_3x3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -629,31 +640,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DenoisersShadersMedian_3x3ShaderDef : public ShaderDef
+RetroArch::DenoisersShadersMedian_3x3ShaderDef::DenoisersShadersMedian_3x3ShaderDef() : ShaderDef{}
 {
-public:
-	DenoisersShadersMedian_3x3ShaderDef() : ShaderDef{}
-	{
-		Name = "median_3x3";
-		VertexByteCode = RetroArchDenoisersShadersMedian_3x3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDenoisersShadersMedian_3x3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDenoisersShadersMedian_3x3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDenoisersShadersMedian_3x3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "median_3x3";
+	VertexByteCode = RetroArchDenoisersShadersMedian_3x3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDenoisersShadersMedian_3x3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDenoisersShadersMedian_3x3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDenoisersShadersMedian_3x3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DenoisersShadersMedian_5x5ShaderDef : public ShaderDef
+{
+public:
+	DenoisersShadersMedian_5x5ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDenoisersShadersMedian_5x5ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1582,31 +1593,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DenoisersShadersMedian_5x5ShaderDef : public ShaderDef
+RetroArch::DenoisersShadersMedian_5x5ShaderDef::DenoisersShadersMedian_5x5ShaderDef() : ShaderDef{}
 {
-public:
-	DenoisersShadersMedian_5x5ShaderDef() : ShaderDef{}
-	{
-		Name = "median_5x5";
-		VertexByteCode = RetroArchDenoisersShadersMedian_5x5ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDenoisersShadersMedian_5x5ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDenoisersShadersMedian_5x5ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDenoisersShadersMedian_5x5ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "median_5x5";
+	VertexByteCode = RetroArchDenoisersShadersMedian_5x5ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDenoisersShadersMedian_5x5ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDenoisersShadersMedian_5x5ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDenoisersShadersMedian_5x5ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DenoisersShadersSlowBilateralShaderDef : public ShaderDef
+{
+public:
+	DenoisersShadersSlowBilateralShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDenoisersShadersSlowBilateralShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -689,33 +700,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DenoisersShadersSlowBilateralShaderDef : public ShaderDef
+RetroArch::DenoisersShadersSlowBilateralShaderDef::DenoisersShadersSlowBilateralShaderDef() : ShaderDef{}
 {
-public:
-	DenoisersShadersSlowBilateralShaderDef() : ShaderDef{}
-	{
-		Name = "slow-bilateral";
-		VertexByteCode = RetroArchDenoisersShadersSlowBilateralShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDenoisersShadersSlowBilateralShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDenoisersShadersSlowBilateralShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDenoisersShadersSlowBilateralShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIGMA", -1, 52, 4, 1.000000f, 20.000000f, 10.000000f, 1.000000f, "Sigma"));
-		Params.push_back(ShaderParam("BSIGMA", -1, 56, 4, 0.010000f, 0.500000f, 0.100000f, 0.010000f, "BSigma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "slow-bilateral";
+	VertexByteCode = RetroArchDenoisersShadersSlowBilateralShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDenoisersShadersSlowBilateralShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDenoisersShadersSlowBilateralShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDenoisersShadersSlowBilateralShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIGMA", -1, 52, 4, 1.000000f, 20.000000f, 10.000000f, 1.000000f, "Sigma"));
+	Params.push_back(ShaderParam("BSIGMA", -1, 56, 4, 0.010000f, 0.500000f, 0.100000f, 0.010000f, "BSigma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
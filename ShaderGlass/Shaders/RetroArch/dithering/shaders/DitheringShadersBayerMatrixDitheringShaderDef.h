@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersBayerMatrixDitheringShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersBayerMatrixDitheringShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersBayerMatrixDitheringShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -742,33 +753,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersBayerMatrixDitheringShaderDef : public ShaderDef
+RetroArch::DitheringShadersBayerMatrixDitheringShaderDef::DitheringShadersBayerMatrixDitheringShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersBayerMatrixDitheringShaderDef() : ShaderDef{}
-	{
-		Name = "bayer-matrix-dithering";
-		VertexByteCode = RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("animate", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Dithering Animation"));
-		Params.push_back(ShaderParam("dither_size", -1, 56, 4, 0.000000f, 0.950000f, 0.000000f, 0.050000f, "Dither Size"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bayer-matrix-dithering";
+	VertexByteCode = RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersBayerMatrixDitheringShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("animate", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Dithering Animation"));
+	Params.push_back(ShaderParam("dither_size", -1, 56, 4, 0.000000f, 0.950000f, 0.000000f, 0.050000f, "Dither Size"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
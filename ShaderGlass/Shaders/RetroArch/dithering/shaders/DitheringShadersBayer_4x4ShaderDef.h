@@ -21,6 +21,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersBayer_4x4ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersBayer_4x4ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersBayer_4x4ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1226,34 +1237,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersBayer_4x4ShaderDef : public ShaderDef
+RetroArch::DitheringShadersBayer_4x4ShaderDef::DitheringShadersBayer_4x4ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersBayer_4x4ShaderDef() : ShaderDef{}
-	{
-		Name = "bayer_4x4";
-		VertexByteCode = RetroArchDitheringShadersBayer_4x4ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersBayer_4x4ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersBayer_4x4ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersBayer_4x4ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("COLOR_DEPTH", -1, 52, 4, 1.000000f, 8.000000f, 1.000000f, 1.000000f, "Color depth in Bits"));
-		Params.push_back(ShaderParam("DITHER_TUNE", -1, 56, 4, -64.000000f, 64.000000f, 0.000000f, 1.000000f, "Tune dithering"));
-		Params.push_back(ShaderParam("EGA_PALETTE", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "EGA palette"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bayer_4x4";
+	VertexByteCode = RetroArchDitheringShadersBayer_4x4ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersBayer_4x4ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersBayer_4x4ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersBayer_4x4ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("COLOR_DEPTH", -1, 52, 4, 1.000000f, 8.000000f, 1.000000f, 1.000000f, "Color depth in Bits"));
+	Params.push_back(ShaderParam("DITHER_TUNE", -1, 56, 4, -64.000000f, 64.000000f, 0.000000f, 1.000000f, "Tune dithering"));
+	Params.push_back(ShaderParam("EGA_PALETTE", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "EGA palette"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -21,6 +21,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersBlue_noiseShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersBlue_noiseShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersBlue_noiseShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1174,36 +1185,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersBlue_noiseShaderDef : public ShaderDef
+RetroArch::DitheringShadersBlue_noiseShaderDef::DitheringShadersBlue_noiseShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersBlue_noiseShaderDef() : ShaderDef{}
-	{
-		Name = "blue_noise";
-		VertexByteCode = RetroArchDitheringShadersBlue_noiseShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersBlue_noiseShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersBlue_noiseShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersBlue_noiseShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("COLOR_DEPTH", -1, 52, 4, 1.000000f, 8.000000f, 1.000000f, 1.000000f, "Color depth in Bits"));
-		Params.push_back(ShaderParam("DITHER_TUNE", -1, 56, 4, -64.000000f, 64.000000f, 0.000000f, 1.000000f, "Tune dithering"));
-		Params.push_back(ShaderParam("MONOCHROME", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Monochrome"));
-		Params.push_back(ShaderParam("EGA_PALETTE", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "EGA palette"));
-		Samplers.push_back(ShaderSampler("BlueNoiseTexture", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blue_noise";
+	VertexByteCode = RetroArchDitheringShadersBlue_noiseShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersBlue_noiseShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersBlue_noiseShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersBlue_noiseShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("COLOR_DEPTH", -1, 52, 4, 1.000000f, 8.000000f, 1.000000f, 1.000000f, "Color depth in Bits"));
+	Params.push_back(ShaderParam("DITHER_TUNE", -1, 56, 4, -64.000000f, 64.000000f, 0.000000f, 1.000000f, "Tune dithering"));
+	Params.push_back(ShaderParam("MONOCHROME", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Monochrome"));
+	Params.push_back(ShaderParam("EGA_PALETTE", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "EGA palette"));
+	Samplers.push_back(ShaderSampler("BlueNoiseTexture", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersGSharp_resamplerShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersGSharp_resamplerShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersGSharp_resamplerShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1216,35 +1227,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersGSharp_resamplerShaderDef : public ShaderDef
+RetroArch::DitheringShadersGSharp_resamplerShaderDef::DitheringShadersGSharp_resamplerShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersGSharp_resamplerShaderDef() : ShaderDef{}
-	{
-		Name = "g-sharp_resampler";
-		VertexByteCode = RetroArchDitheringShadersGSharp_resamplerShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersGSharp_resamplerShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersGSharp_resamplerShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersGSharp_resamplerShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SIGMA_HV", -1, 52, 4, 0.100000f, 7.000000f, 0.750000f, 0.050000f, "Gaussian Blur Sigma"));
-		Params.push_back(ShaderParam("HSHARP0", -1, 56, 4, 1.000000f, 6.000000f, 1.200000f, 0.100000f, "Filter Range"));
-		Params.push_back(ShaderParam("HAR", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
-		Params.push_back(ShaderParam("SHAR", -1, 64, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "g-sharp_resampler";
+	VertexByteCode = RetroArchDitheringShadersGSharp_resamplerShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersGSharp_resamplerShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersGSharp_resamplerShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersGSharp_resamplerShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SIGMA_HV", -1, 52, 4, 0.100000f, 7.000000f, 0.750000f, 0.050000f, "Gaussian Blur Sigma"));
+	Params.push_back(ShaderParam("HSHARP0", -1, 56, 4, 1.000000f, 6.000000f, 1.200000f, 0.100000f, "Filter Range"));
+	Params.push_back(ShaderParam("HAR", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
+	Params.push_back(ShaderParam("SHAR", -1, 64, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
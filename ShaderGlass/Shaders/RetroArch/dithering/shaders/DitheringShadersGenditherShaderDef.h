@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersGenditherShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersGenditherShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersGenditherShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -528,31 +539,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersGenditherShaderDef : public ShaderDef
+RetroArch::DitheringShadersGenditherShaderDef::DitheringShadersGenditherShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersGenditherShaderDef() : ShaderDef{}
-	{
-		Name = "gendither";
-		VertexByteCode = RetroArchDitheringShadersGenditherShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersGenditherShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersGenditherShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersGenditherShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gendither";
+	VertexByteCode = RetroArchDitheringShadersGenditherShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersGenditherShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersGenditherShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersGenditherShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersJinc2DeditherShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersJinc2DeditherShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersJinc2DeditherShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1775,32 +1786,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersJinc2DeditherShaderDef : public ShaderDef
+RetroArch::DitheringShadersJinc2DeditherShaderDef::DitheringShadersJinc2DeditherShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersJinc2DeditherShaderDef() : ShaderDef{}
-	{
-		Name = "jinc2-dedither";
-		VertexByteCode = RetroArchDitheringShadersJinc2DeditherShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersJinc2DeditherShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersJinc2DeditherShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersJinc2DeditherShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("JINC_SHARP", -1, 52, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "jinc2-dedither";
+	VertexByteCode = RetroArchDitheringShadersJinc2DeditherShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersJinc2DeditherShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersJinc2DeditherShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersJinc2DeditherShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("JINC_SHARP", -1, 52, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersSgenptMixShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersSgenptMixShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersSgenptMixShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -958,35 +969,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersSgenptMixShaderDef : public ShaderDef
+RetroArch::DitheringShadersSgenptMixShaderDef::DitheringShadersSgenptMixShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersSgenptMixShaderDef() : ShaderDef{}
-	{
-		Name = "sgenpt-mix";
-		VertexByteCode = RetroArchDitheringShadersSgenptMixShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersSgenptMixShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersSgenptMixShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersSgenptMixShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SGPT_BLEND_OPTION", -1, 52, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "0: OFF | 1: VL+CB | 2: VL | 3: CB"));
-		Params.push_back(ShaderParam("SGPT_BLEND_LEVEL", -1, 56, 4, 0.000000f, 1.000000f, 0.850000f, 0.050000f, "Blend Level"));
-		Params.push_back(ShaderParam("SGPT_ADJUST_VIEW", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Adjust View"));
-		Params.push_back(ShaderParam("SGPT_LINEAR_GAMMA", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Use Linear Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sgenpt-mix";
+	VertexByteCode = RetroArchDitheringShadersSgenptMixShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersSgenptMixShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersSgenptMixShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersSgenptMixShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SGPT_BLEND_OPTION", -1, 52, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "0: OFF | 1: VL+CB | 2: VL | 3: CB"));
+	Params.push_back(ShaderParam("SGPT_BLEND_LEVEL", -1, 56, 4, 0.000000f, 1.000000f, 0.850000f, 0.050000f, "Blend Level"));
+	Params.push_back(ShaderParam("SGPT_ADJUST_VIEW", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Adjust View"));
+	Params.push_back(ShaderParam("SGPT_LINEAR_GAMMA", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Use Linear Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class DitheringShadersBlueNoiseLDR_RGB1_0TextureDef : public TextureDef
+{
+public:
+	DitheringShadersBlueNoiseLDR_RGB1_0TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace DitheringShadersBlueNoiseLDR_RGB1_0TextureDefs
 {
 const BYTE sData[] =
@@ -5649,13 +5657,10 @@ const BYTE sData[] =
 ,69,78,68,174,66,96,130};
 }
 
-class DitheringShadersBlueNoiseLDR_RGB1_0TextureDef : public TextureDef
+DitheringShadersBlueNoiseLDR_RGB1_0TextureDef::DitheringShadersBlueNoiseLDR_RGB1_0TextureDef() : TextureDef{}
 {
-public:
-	DitheringShadersBlueNoiseLDR_RGB1_0TextureDef() : TextureDef{}
-	{
-		Name = "LDR_RGB1_0.png";
-		Data = DitheringShadersBlueNoiseLDR_RGB1_0TextureDefs::sData;
-		DataLength = sizeof(DitheringShadersBlueNoiseLDR_RGB1_0TextureDefs::sData);
-	}
-};
+	Name = "LDR_RGB1_0.png";
+	Data = DitheringShadersBlueNoiseLDR_RGB1_0TextureDefs::sData;
+	DataLength = sizeof(DitheringShadersBlueNoiseLDR_RGB1_0TextureDefs::sData);
+}
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersCbodV1CbodV1Pass2ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersCbodV1CbodV1Pass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -496,31 +507,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersCbodV1CbodV1Pass2ShaderDef : public ShaderDef
+RetroArch::DitheringShadersCbodV1CbodV1Pass2ShaderDef::DitheringShadersCbodV1CbodV1Pass2ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersCbodV1CbodV1Pass2ShaderDef() : ShaderDef{}
-	{
-		Name = "cbod-v1-pass2";
-		VertexByteCode = RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cbod-v1-pass2";
+	VertexByteCode = RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersCbodV1CbodV1Pass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
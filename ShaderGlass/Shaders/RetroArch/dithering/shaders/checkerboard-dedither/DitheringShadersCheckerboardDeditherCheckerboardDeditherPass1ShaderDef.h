@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -591,33 +602,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef : public ShaderDef
+RetroArch::DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef::DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "checkerboard-dedither-pass1";
-		VertexByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CD_BLEND_OPTION", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CHECKERBOARD-DEDITHER: [ OFF | ON ]"));
-		Params.push_back(ShaderParam("CD_BLEND_LEVEL", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Blend Level"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "checkerboard-dedither-pass1";
+	VertexByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CD_BLEND_OPTION", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CHECKERBOARD-DEDITHER: [ OFF | ON ]"));
+	Params.push_back(ShaderParam("CD_BLEND_LEVEL", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Blend Level"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
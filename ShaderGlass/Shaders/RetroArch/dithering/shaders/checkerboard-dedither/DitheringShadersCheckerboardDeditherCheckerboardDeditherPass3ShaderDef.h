@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1024,36 +1035,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef : public ShaderDef
+RetroArch::DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef::DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "checkerboard-dedither-pass3";
-		VertexByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CD_MITIG_NEIGHBRS", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 1.000000f, "Mitigate Errors (neighbors)"));
-		Params.push_back(ShaderParam("CD_MITIG_LINES", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mitigate Errors (regions)"));
-		Params.push_back(ShaderParam("CD_ADJUST_VIEW", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Adjust View"));
-		Params.push_back(ShaderParam("UseGamma", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Gamma Slider"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("LinearGamma", 3));
+	Name = "checkerboard-dedither-pass3";
+	VertexByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CD_MITIG_NEIGHBRS", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 1.000000f, "Mitigate Errors (neighbors)"));
+	Params.push_back(ShaderParam("CD_MITIG_LINES", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mitigate Errors (regions)"));
+	Params.push_back(ShaderParam("CD_ADJUST_VIEW", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Adjust View"));
+	Params.push_back(ShaderParam("UseGamma", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Gamma Slider"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("LinearGamma", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
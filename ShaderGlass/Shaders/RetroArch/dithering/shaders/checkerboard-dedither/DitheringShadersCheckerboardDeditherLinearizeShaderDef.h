@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersCheckerboardDeditherLinearizeShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersCheckerboardDeditherLinearizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -393,33 +404,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersCheckerboardDeditherLinearizeShaderDef : public ShaderDef
+RetroArch::DitheringShadersCheckerboardDeditherLinearizeShaderDef::DitheringShadersCheckerboardDeditherLinearizeShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersCheckerboardDeditherLinearizeShaderDef() : ShaderDef{}
-	{
-		Name = "linearize";
-		VertexByteCode = RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CD_BLEND_OPTION", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CHECKERBOARD-DEDITHER: [ OFF | ON ]"));
-		Params.push_back(ShaderParam("UseGamma", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Gamma Slider"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "linearize";
+	VertexByteCode = RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersCheckerboardDeditherLinearizeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CD_BLEND_OPTION", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "CHECKERBOARD-DEDITHER: [ OFF | ON ]"));
+	Params.push_back(ShaderParam("UseGamma", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Gamma Slider"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersGdaptGdaptPass0ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersGdaptGdaptPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -685,33 +696,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersGdaptGdaptPass0ShaderDef : public ShaderDef
+RetroArch::DitheringShadersGdaptGdaptPass0ShaderDef::DitheringShadersGdaptGdaptPass0ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersGdaptGdaptPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "gdapt-pass0";
-		VertexByteCode = RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MODE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "GDAPT Monochrome Analysis"));
-		Params.push_back(ShaderParam("PWR", -1, 56, 4, 0.000000f, 10.000000f, 2.000000f, 0.100000f, "GDAPT Color Metric Exp"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gdapt-pass0";
+	VertexByteCode = RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MODE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "GDAPT Monochrome Analysis"));
+	Params.push_back(ShaderParam("PWR", -1, 56, 4, 0.000000f, 10.000000f, 2.000000f, 0.100000f, "GDAPT Color Metric Exp"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersGdaptGdaptPass1ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersGdaptGdaptPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1118,34 +1129,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersGdaptGdaptPass1ShaderDef : public ShaderDef
+RetroArch::DitheringShadersGdaptGdaptPass1ShaderDef::DitheringShadersGdaptGdaptPass1ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersGdaptGdaptPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "gdapt-pass1";
-		VertexByteCode = RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("STEPS", -1, 52, 4, 0.000000f, 5.000000f, 1.000000f, 1.000000f, "GDAPT Error Prevention LVL"));
-		Params.push_back(ShaderParam("DEBUG", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "GDAPT Adjust View"));
-		Params.push_back(ShaderParam("linear_gamma", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Linear Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gdapt-pass1";
+	VertexByteCode = RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersGdaptGdaptPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("STEPS", -1, 52, 4, 0.000000f, 5.000000f, 1.000000f, 1.000000f, "GDAPT Error Prevention LVL"));
+	Params.push_back(ShaderParam("DEBUG", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "GDAPT Adjust View"));
+	Params.push_back(ShaderParam("linear_gamma", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Use Linear Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersMdaptPassesMdaptPass0ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersMdaptPassesMdaptPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1246,33 +1257,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersMdaptPassesMdaptPass0ShaderDef : public ShaderDef
+RetroArch::DitheringShadersMdaptPassesMdaptPass0ShaderDef::DitheringShadersMdaptPassesMdaptPass0ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersMdaptPassesMdaptPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "mdapt-pass0";
-		VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MDAPTMODE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Monochrome Analysis"));
-		Params.push_back(ShaderParam("MDAPTPWR", -1, 56, 4, 0.000000f, 10.000000f, 2.000000f, 0.100000f, "MDAPT Color Metric Exp"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "mdapt-pass0";
+	VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MDAPTMODE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Monochrome Analysis"));
+	Params.push_back(ShaderParam("MDAPTPWR", -1, 56, 4, 0.000000f, 10.000000f, 2.000000f, 0.100000f, "MDAPT Color Metric Exp"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
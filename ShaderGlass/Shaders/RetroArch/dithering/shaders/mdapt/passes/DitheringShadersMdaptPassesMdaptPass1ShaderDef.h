@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersMdaptPassesMdaptPass1ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersMdaptPassesMdaptPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -527,31 +538,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersMdaptPassesMdaptPass1ShaderDef : public ShaderDef
+RetroArch::DitheringShadersMdaptPassesMdaptPass1ShaderDef::DitheringShadersMdaptPassesMdaptPass1ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersMdaptPassesMdaptPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "mdapt-pass1";
-		VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "mdapt-pass1";
+	VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
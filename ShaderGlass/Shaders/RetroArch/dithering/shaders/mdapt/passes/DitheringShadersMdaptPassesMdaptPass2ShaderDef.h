@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersMdaptPassesMdaptPass2ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersMdaptPassesMdaptPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1012,35 +1023,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersMdaptPassesMdaptPass2ShaderDef : public ShaderDef
+RetroArch::DitheringShadersMdaptPassesMdaptPass2ShaderDef::DitheringShadersMdaptPassesMdaptPass2ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersMdaptPassesMdaptPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "mdapt-pass2";
-		VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("VL_LO", -1, 52, 4, 0.000000f, 10.000000f, 1.250000f, 0.050000f, "MDAPT VL LO Thresh"));
-		Params.push_back(ShaderParam("VL_HI", -1, 56, 4, 0.000000f, 10.000000f, 1.750000f, 0.050000f, "MDAPT VL HI Thresh"));
-		Params.push_back(ShaderParam("CB_LO", -1, 60, 4, 0.000000f, 25.000000f, 5.250000f, 0.050000f, "MDAPT CB LO Thresh"));
-		Params.push_back(ShaderParam("CB_HI", -1, 64, 4, 0.000000f, 25.000000f, 5.750000f, 0.050000f, "MDAPT CB HI Thresh"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "mdapt-pass2";
+	VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("VL_LO", -1, 52, 4, 0.000000f, 10.000000f, 1.250000f, 0.050000f, "MDAPT VL LO Thresh"));
+	Params.push_back(ShaderParam("VL_HI", -1, 56, 4, 0.000000f, 10.000000f, 1.750000f, 0.050000f, "MDAPT VL HI Thresh"));
+	Params.push_back(ShaderParam("CB_LO", -1, 60, 4, 0.000000f, 25.000000f, 5.250000f, 0.050000f, "MDAPT CB LO Thresh"));
+	Params.push_back(ShaderParam("CB_HI", -1, 64, 4, 0.000000f, 25.000000f, 5.750000f, 0.050000f, "MDAPT CB HI Thresh"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersMdaptPassesMdaptPass3ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersMdaptPassesMdaptPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -787,32 +798,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersMdaptPassesMdaptPass3ShaderDef : public ShaderDef
+RetroArch::DitheringShadersMdaptPassesMdaptPass3ShaderDef::DitheringShadersMdaptPassesMdaptPass3ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersMdaptPassesMdaptPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "mdapt-pass3";
-		VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("mdapt_refpass", 3));
+	Name = "mdapt-pass3";
+	VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("mdapt_refpass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersMdaptPassesMdaptPass4ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersMdaptPassesMdaptPass4ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1481,36 +1492,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersMdaptPassesMdaptPass4ShaderDef : public ShaderDef
+RetroArch::DitheringShadersMdaptPassesMdaptPass4ShaderDef::DitheringShadersMdaptPassesMdaptPass4ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersMdaptPassesMdaptPass4ShaderDef() : ShaderDef{}
-	{
-		Name = "mdapt-pass4";
-		VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("VL", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Vertical Lines"));
-		Params.push_back(ShaderParam("CB", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "MDAPT Checkerboard"));
-		Params.push_back(ShaderParam("DEBUG", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Adjust View"));
-		Params.push_back(ShaderParam("linear_gamma", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Linear Gamma Blend"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("mdapt_refpass", 3));
+	Name = "mdapt-pass4";
+	VertexByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersMdaptPassesMdaptPass4ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("VL", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Vertical Lines"));
+	Params.push_back(ShaderParam("CB", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "MDAPT Checkerboard"));
+	Params.push_back(ShaderParam("DEBUG", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Adjust View"));
+	Params.push_back(ShaderParam("linear_gamma", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MDAPT Linear Gamma Blend"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("mdapt_refpass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -579,31 +590,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef : public ShaderDef
+RetroArch::DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef::DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef() : ShaderDef{}
-	{
-		Name = "PS1-Undither-Comparison-MkII";
-		VertexByteCode = RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "PS1-Undither-Comparison-MkII";
+	VertexByteCode = RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
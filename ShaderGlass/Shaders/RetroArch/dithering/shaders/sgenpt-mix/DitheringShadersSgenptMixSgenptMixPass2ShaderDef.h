@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersSgenptMixSgenptMixPass2ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersSgenptMixSgenptMixPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1103,33 +1114,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersSgenptMixSgenptMixPass2ShaderDef : public ShaderDef
+RetroArch::DitheringShadersSgenptMixSgenptMixPass2ShaderDef::DitheringShadersSgenptMixSgenptMixPass2ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersSgenptMixSgenptMixPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "sgenpt-mix-pass2";
-		VertexByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CB_BLEND_LEVEL", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Checkerboard Blend Level"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("LinearGamma", 3));
+	Name = "sgenpt-mix-pass2";
+	VertexByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CB_BLEND_LEVEL", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Checkerboard Blend Level"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("LinearGamma", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
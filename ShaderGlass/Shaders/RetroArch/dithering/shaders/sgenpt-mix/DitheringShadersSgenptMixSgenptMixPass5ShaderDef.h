@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DitheringShadersSgenptMixSgenptMixPass5ShaderDef : public ShaderDef
+{
+public:
+	DitheringShadersSgenptMixSgenptMixPass5ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -888,36 +899,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DitheringShadersSgenptMixSgenptMixPass5ShaderDef : public ShaderDef
+RetroArch::DitheringShadersSgenptMixSgenptMixPass5ShaderDef::DitheringShadersSgenptMixSgenptMixPass5ShaderDef() : ShaderDef{}
 {
-public:
-	DitheringShadersSgenptMixSgenptMixPass5ShaderDef() : ShaderDef{}
-	{
-		Name = "sgenpt-mix-pass5";
-		VertexByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("VL_MITIG_NEIGHBRS", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 1.000000f, "VL - Mitigate Errors (neighbors)"));
-		Params.push_back(ShaderParam("VL_MITIG_LINES", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "VL - Mitigate Errors (regions)"));
-		Params.push_back(ShaderParam("VL_ADJUST_VIEW", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VL - Adjust View"));
-		Params.push_back(ShaderParam("UseGamma", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Gamma Slider"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("CB_Output", 3));
+	Name = "sgenpt-mix-pass5";
+	VertexByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDitheringShadersSgenptMixSgenptMixPass5ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("VL_MITIG_NEIGHBRS", -1, 52, 4, 0.000000f, 4.000000f, 1.000000f, 1.000000f, "VL - Mitigate Errors (neighbors)"));
+	Params.push_back(ShaderParam("VL_MITIG_LINES", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "VL - Mitigate Errors (regions)"));
+	Params.push_back(ShaderParam("VL_ADJUST_VIEW", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "VL - Adjust View"));
+	Params.push_back(ShaderParam("UseGamma", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Gamma Slider"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("CB_Output", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
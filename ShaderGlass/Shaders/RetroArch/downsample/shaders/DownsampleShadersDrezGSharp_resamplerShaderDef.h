@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class DownsampleShadersDrezGSharp_resamplerShaderDef : public ShaderDef
+{
+public:
+	DownsampleShadersDrezGSharp_resamplerShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1427,37 +1438,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class DownsampleShadersDrezGSharp_resamplerShaderDef : public ShaderDef
+RetroArch::DownsampleShadersDrezGSharp_resamplerShaderDef::DownsampleShadersDrezGSharp_resamplerShaderDef() : ShaderDef{}
 {
-public:
-	DownsampleShadersDrezGSharp_resamplerShaderDef() : ShaderDef{}
-	{
-		Name = "drez-g-sharp_resampler";
-		VertexByteCode = RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DREZ_GSHARP_ON", 0, 116, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "G-SHARP ON"));
-		Params.push_back(ShaderParam("DREZ_SIGMA_HV", 0, 120, 4, 0.100000f, 7.000000f, 0.750000f, 0.050000f, "Gaussian Blur Sigma"));
-		Params.push_back(ShaderParam("DREZ_HSHARP0", 0, 124, 4, 1.000000f, 6.000000f, 2.300000f, 0.100000f, "Filter Range"));
-		Params.push_back(ShaderParam("DREZ_HAR", 0, 128, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
-		Params.push_back(ShaderParam("DREZ_SHAR", 0, 132, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition"));
-		Params.push_back(ShaderParam("DREZ_THRESHOLD_RATIO", 0, 136, 4, 1.000000f, 4.000000f, 1.500000f, 0.100000f, "Downsample Threshold (Original Res Vs Downsampled Res)"));
-		Samplers.push_back(ShaderSampler("Original", 2));
+	Name = "drez-g-sharp_resampler";
+	VertexByteCode = RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchDownsampleShadersDrezGSharp_resamplerShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DREZ_GSHARP_ON", 0, 116, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "G-SHARP ON"));
+	Params.push_back(ShaderParam("DREZ_SIGMA_HV", 0, 120, 4, 0.100000f, 7.000000f, 0.750000f, 0.050000f, "Gaussian Blur Sigma"));
+	Params.push_back(ShaderParam("DREZ_HSHARP0", 0, 124, 4, 1.000000f, 6.000000f, 2.300000f, 0.100000f, "Filter Range"));
+	Params.push_back(ShaderParam("DREZ_HAR", 0, 128, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-Ringing"));
+	Params.push_back(ShaderParam("DREZ_SHAR", 0, 132, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Sharpness Definition"));
+	Params.push_back(ShaderParam("DREZ_THRESHOLD_RATIO", 0, 136, 4, 1.000000f, 4.000000f, 1.500000f, 0.100000f, "Downsample Threshold (Original Res Vs Downsampled Res)"));
+	Samplers.push_back(ShaderSampler("Original", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -59,6 +59,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -12390,34 +12401,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef::EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef() : ShaderDef{}
-	{
-		Name = "cleanEdge-scale";
-		VertexByteCode = RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("simthresh", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Similarity Threshold"));
-		Params.push_back(ShaderParam("linewidth", -1, 56, 4, 0.010000f, 2.000000f, 1.000000f, 0.100000f, "Line Width"));
-		Params.push_back(ShaderParam("ce_mode", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "cleanEdge Effect Toggle (debug)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cleanEdge-scale";
+	VertexByteCode = RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("simthresh", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Similarity Threshold"));
+	Params.push_back(ShaderParam("linewidth", -1, 56, 4, 0.010000f, 2.000000f, 1.000000f, 0.100000f, "Line Width"));
+	Params.push_back(ShaderParam("ce_mode", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "cleanEdge Effect Toggle (debug)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
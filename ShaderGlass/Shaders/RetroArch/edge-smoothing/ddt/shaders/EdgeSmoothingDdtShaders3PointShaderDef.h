@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingDdtShaders3PointShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingDdtShaders3PointShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingDdtShaders3PointShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -608,31 +619,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingDdtShaders3PointShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingDdtShaders3PointShaderDef::EdgeSmoothingDdtShaders3PointShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingDdtShaders3PointShaderDef() : ShaderDef{}
-	{
-		Name = "3-point";
-		VertexByteCode = RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "3-point";
+	VertexByteCode = RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShaders3PointShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingDdtShadersCutShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingDdtShadersCutShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingDdtShadersCutShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -942,36 +953,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingDdtShadersCutShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingDdtShadersCutShaderDef::EdgeSmoothingDdtShadersCutShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingDdtShadersCutShaderDef() : ShaderDef{}
-	{
-		Name = "cut";
-		VertexByteCode = RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("USE_DYNAMIC_SHARPNESS", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Dynamic Sharpness [ 0FF | ON ]"));
-		Params.push_back(ShaderParam("USE_SHARPENING_BIAS", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharpness Bias [ 0FF | ON ]"));
-		Params.push_back(ShaderParam("DYNAMIC_SHARPNESS_MIN", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Dynamic Sharpness Min"));
-		Params.push_back(ShaderParam("DYNAMIC_SHARPNESS_MAX", -1, 64, 4, 0.000000f, 1.000000f, 0.800000f, 0.100000f, "Dynamic Sharpness Max"));
-		Params.push_back(ShaderParam("STATIC_SHARPNESS", -1, 68, 4, 0.000000f, 1.000000f, 0.200000f, 0.100000f, "Static Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cut";
+	VertexByteCode = RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersCutShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("USE_DYNAMIC_SHARPNESS", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Dynamic Sharpness [ 0FF | ON ]"));
+	Params.push_back(ShaderParam("USE_SHARPENING_BIAS", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharpness Bias [ 0FF | ON ]"));
+	Params.push_back(ShaderParam("DYNAMIC_SHARPNESS_MIN", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Dynamic Sharpness Min"));
+	Params.push_back(ShaderParam("DYNAMIC_SHARPNESS_MAX", -1, 64, 4, 0.000000f, 1.000000f, 0.800000f, 0.100000f, "Dynamic Sharpness Max"));
+	Params.push_back(ShaderParam("STATIC_SHARPNESS", -1, 68, 4, 0.000000f, 1.000000f, 0.200000f, 0.100000f, "Static Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingDdtShadersDdtExtendedShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingDdtShadersDdtExtendedShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1304,31 +1315,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingDdtShadersDdtExtendedShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingDdtShadersDdtExtendedShaderDef::EdgeSmoothingDdtShadersDdtExtendedShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingDdtShadersDdtExtendedShaderDef() : ShaderDef{}
-	{
-		Name = "ddt-extended";
-		VertexByteCode = RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ddt-extended";
+	VertexByteCode = RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtExtendedShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingDdtShadersDdtJincShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingDdtShadersDdtJincShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2486,35 +2497,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingDdtShadersDdtJincShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingDdtShadersDdtJincShaderDef::EdgeSmoothingDdtShadersDdtJincShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingDdtShadersDdtJincShaderDef() : ShaderDef{}
-	{
-		Name = "ddt-jinc";
-		VertexByteCode = RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("JINC2_WINDOW_SINC", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Window Sinc Param"));
-		Params.push_back(ShaderParam("JINC2_SINC", -1, 56, 4, 0.000000f, 1.000000f, 0.860000f, 0.010000f, "Sinc Param"));
-		Params.push_back(ShaderParam("JINC2_AR_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Anti-ringing Strength"));
-		Params.push_back(ShaderParam("DDT_THRESHOLD", -1, 64, 4, 1.000000f, 6.000000f, 2.600000f, 0.200000f, "DDT Diagonal Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ddt-jinc";
+	VertexByteCode = RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtJincShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("JINC2_WINDOW_SINC", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Window Sinc Param"));
+	Params.push_back(ShaderParam("JINC2_SINC", -1, 56, 4, 0.000000f, 1.000000f, 0.860000f, 0.010000f, "Sinc Param"));
+	Params.push_back(ShaderParam("JINC2_AR_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Anti-ringing Strength"));
+	Params.push_back(ShaderParam("DDT_THRESHOLD", -1, 64, 4, 1.000000f, 6.000000f, 2.600000f, 0.200000f, "DDT Diagonal Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingDdtShadersDdtShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingDdtShadersDdtShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingDdtShadersDdtShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -815,32 +826,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingDdtShadersDdtShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingDdtShadersDdtShaderDef::EdgeSmoothingDdtShadersDdtShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingDdtShadersDdtShaderDef() : ShaderDef{}
-	{
-		Name = "ddt";
-		VertexByteCode = RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BIL_FALLBACK", -1, 52, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Bilinear Fallback Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ddt";
+	VertexByteCode = RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingDdtShadersDdtShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BIL_FALLBACK", -1, 52, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Bilinear Fallback Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
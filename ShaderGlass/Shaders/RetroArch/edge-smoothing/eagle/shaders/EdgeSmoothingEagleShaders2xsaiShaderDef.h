@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingEagleShaders2xsaiShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingEagleShaders2xsaiShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1209,30 +1220,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingEagleShaders2xsaiShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingEagleShaders2xsaiShaderDef::EdgeSmoothingEagleShaders2xsaiShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingEagleShaders2xsaiShaderDef() : ShaderDef{}
-	{
-		Name = "2xsai";
-		VertexByteCode = RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "2xsai";
+	VertexByteCode = RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingEagleShaders2xsaiShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
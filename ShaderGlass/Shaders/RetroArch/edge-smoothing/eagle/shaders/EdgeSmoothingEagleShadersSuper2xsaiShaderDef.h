@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingEagleShadersSuper2xsaiShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingEagleShadersSuper2xsaiShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1387,30 +1398,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingEagleShadersSuper2xsaiShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingEagleShadersSuper2xsaiShaderDef::EdgeSmoothingEagleShadersSuper2xsaiShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingEagleShadersSuper2xsaiShaderDef() : ShaderDef{}
-	{
-		Name = "super-2xsai";
-		VertexByteCode = RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "super-2xsai";
+	VertexByteCode = RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingEagleShadersSuper2xsaiShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
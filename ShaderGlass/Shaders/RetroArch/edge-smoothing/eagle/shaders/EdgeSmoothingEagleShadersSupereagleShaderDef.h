@@ -20,6 +20,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingEagleShadersSupereagleShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingEagleShadersSupereagleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1499,30 +1510,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingEagleShadersSupereagleShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingEagleShadersSupereagleShaderDef::EdgeSmoothingEagleShadersSupereagleShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingEagleShadersSupereagleShaderDef() : ShaderDef{}
-	{
-		Name = "supereagle";
-		VertexByteCode = RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "supereagle";
+	VertexByteCode = RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingEagleShadersSupereagleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
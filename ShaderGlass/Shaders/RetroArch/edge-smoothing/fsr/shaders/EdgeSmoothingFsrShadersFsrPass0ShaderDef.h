@@ -1545,6 +1545,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingFsrShadersFsrPass0ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingFsrShadersFsrPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3508,31 +3519,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingFsrShadersFsrPass0ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingFsrShadersFsrPass0ShaderDef::EdgeSmoothingFsrShadersFsrPass0ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingFsrShadersFsrPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "fsr-pass0";
-		VertexByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "fsr-pass0";
+	VertexByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
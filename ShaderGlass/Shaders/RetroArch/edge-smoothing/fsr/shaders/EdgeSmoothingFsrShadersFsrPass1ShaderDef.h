@@ -1554,6 +1554,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingFsrShadersFsrPass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingFsrShadersFsrPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2563,35 +2574,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingFsrShadersFsrPass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingFsrShadersFsrPass1ShaderDef::EdgeSmoothingFsrShadersFsrPass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingFsrShadersFsrPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "fsr-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FSR_SHARPENING", -1, 52, 4, 0.000000f, 2.000000f, 0.200000f, 0.100000f, "FSR RCAS Sharpening Amount (Lower = Sharper)"));
-		Params.push_back(ShaderParam("FSR_FILMGRAIN", -1, 56, 4, 0.000000f, 2.000000f, 0.300000f, 0.020000f, "FSR LFGA Film Grain Intensity"));
-		Params.push_back(ShaderParam("FSR_GRAINCOLOR", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "FSR LFGA Film Grain Color: Gray | RGB"));
-		Params.push_back(ShaderParam("FSR_GRAINPDF", -1, 64, 4, 0.100000f, 0.500000f, 0.300000f, 0.050000f, "FSR LFGA Grain PDF Curve (0.5 = Triangular, Lower = Gaussian)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "fsr-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingFsrShadersFsrPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FSR_SHARPENING", -1, 52, 4, 0.000000f, 2.000000f, 0.200000f, 0.100000f, "FSR RCAS Sharpening Amount (Lower = Sharper)"));
+	Params.push_back(ShaderParam("FSR_FILMGRAIN", -1, 56, 4, 0.000000f, 2.000000f, 0.300000f, 0.020000f, "FSR LFGA Film Grain Intensity"));
+	Params.push_back(ShaderParam("FSR_GRAINCOLOR", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "FSR LFGA Film Grain Color: Gray | RGB"));
+	Params.push_back(ShaderParam("FSR_GRAINPDF", -1, 64, 4, 0.100000f, 0.500000f, 0.300000f, 0.050000f, "FSR LFGA Grain PDF Curve (0.5 = Triangular, Lower = Gaussian)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
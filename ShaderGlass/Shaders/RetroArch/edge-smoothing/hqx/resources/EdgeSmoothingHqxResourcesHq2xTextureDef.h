@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class EdgeSmoothingHqxResourcesHq2xTextureDef : public TextureDef
+{
+public:
+	EdgeSmoothingHqxResourcesHq2xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace EdgeSmoothingHqxResourcesHq2xTextureDefs
 {
 const BYTE sData[] =
@@ -82,13 +90,10 @@ const BYTE sData[] =
 ,7,16,28,64,112,0,193,1,188,35,7,240,127,86,161,35,198,178,91,28,66,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class EdgeSmoothingHqxResourcesHq2xTextureDef : public TextureDef
+EdgeSmoothingHqxResourcesHq2xTextureDef::EdgeSmoothingHqxResourcesHq2xTextureDef() : TextureDef{}
 {
-public:
-	EdgeSmoothingHqxResourcesHq2xTextureDef() : TextureDef{}
-	{
-		Name = "hq2x.png";
-		Data = EdgeSmoothingHqxResourcesHq2xTextureDefs::sData;
-		DataLength = sizeof(EdgeSmoothingHqxResourcesHq2xTextureDefs::sData);
-	}
-};
+	Name = "hq2x.png";
+	Data = EdgeSmoothingHqxResourcesHq2xTextureDefs::sData;
+	DataLength = sizeof(EdgeSmoothingHqxResourcesHq2xTextureDefs::sData);
+}
+#endif
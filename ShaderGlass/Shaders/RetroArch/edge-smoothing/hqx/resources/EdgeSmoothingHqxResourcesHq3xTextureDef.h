@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class EdgeSmoothingHqxResourcesHq3xTextureDef : public TextureDef
+{
+public:
+	EdgeSmoothingHqxResourcesHq3xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace EdgeSmoothingHqxResourcesHq3xTextureDefs
 {
 const BYTE sData[] =
@@ -129,13 +137,10 @@ const BYTE sData[] =
 ,64,103,226,255,7,109,3,186,252,7,83,122,83,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class EdgeSmoothingHqxResourcesHq3xTextureDef : public TextureDef
+EdgeSmoothingHqxResourcesHq3xTextureDef::EdgeSmoothingHqxResourcesHq3xTextureDef() : TextureDef{}
 {
-public:
-	EdgeSmoothingHqxResourcesHq3xTextureDef() : TextureDef{}
-	{
-		Name = "hq3x.png";
-		Data = EdgeSmoothingHqxResourcesHq3xTextureDefs::sData;
-		DataLength = sizeof(EdgeSmoothingHqxResourcesHq3xTextureDefs::sData);
-	}
-};
+	Name = "hq3x.png";
+	Data = EdgeSmoothingHqxResourcesHq3xTextureDefs::sData;
+	DataLength = sizeof(EdgeSmoothingHqxResourcesHq3xTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class EdgeSmoothingHqxResourcesHq4xTextureDef : public TextureDef
+{
+public:
+	EdgeSmoothingHqxResourcesHq4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace EdgeSmoothingHqxResourcesHq4xTextureDefs
 {
 const BYTE sData[] =
@@ -310,13 +318,10 @@ const BYTE sData[] =
 ,2,16,61,128,179,59,88,209,3,184,17,255,127,4,168,251,118,189,254,169,16,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class EdgeSmoothingHqxResourcesHq4xTextureDef : public TextureDef
+EdgeSmoothingHqxResourcesHq4xTextureDef::EdgeSmoothingHqxResourcesHq4xTextureDef() : TextureDef{}
 {
-public:
-	EdgeSmoothingHqxResourcesHq4xTextureDef() : TextureDef{}
-	{
-		Name = "hq4x.png";
-		Data = EdgeSmoothingHqxResourcesHq4xTextureDefs::sData;
-		DataLength = sizeof(EdgeSmoothingHqxResourcesHq4xTextureDefs::sData);
-	}
-};
+	Name = "hq4x.png";
+	Data = EdgeSmoothingHqxResourcesHq4xTextureDefs::sData;
+	DataLength = sizeof(EdgeSmoothingHqxResourcesHq4xTextureDefs::sData);
+}
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingHqxShadersHq2xHalphonShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingHqxShadersHq2xHalphonShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1926,31 +1937,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingHqxShadersHq2xHalphonShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingHqxShadersHq2xHalphonShaderDef::EdgeSmoothingHqxShadersHq2xHalphonShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingHqxShadersHq2xHalphonShaderDef() : ShaderDef{}
-	{
-		Name = "hq2x-halphon";
-		VertexByteCode = RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "hq2x-halphon";
+	VertexByteCode = RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xHalphonShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingHqxShadersHq2xShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingHqxShadersHq2xShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -533,32 +544,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingHqxShadersHq2xShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingHqxShadersHq2xShaderDef::EdgeSmoothingHqxShadersHq2xShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingHqxShadersHq2xShaderDef() : ShaderDef{}
-	{
-		Name = "hq2x";
-		VertexByteCode = RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("hqx_refpass", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("LUT", 3));
+	Name = "hq2x";
+	VertexByteCode = RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq2xShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("hqx_refpass", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("LUT", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
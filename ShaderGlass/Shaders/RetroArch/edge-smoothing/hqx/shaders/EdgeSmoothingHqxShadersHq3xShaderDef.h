@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingHqxShadersHq3xShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingHqxShadersHq3xShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -535,32 +546,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingHqxShadersHq3xShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingHqxShadersHq3xShaderDef::EdgeSmoothingHqxShadersHq3xShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingHqxShadersHq3xShaderDef() : ShaderDef{}
-	{
-		Name = "hq3x";
-		VertexByteCode = RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("hqx_refpass", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("LUT", 3));
+	Name = "hq3x";
+	VertexByteCode = RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersHq3xShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("hqx_refpass", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("LUT", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -19,6 +19,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingHqxShadersPass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingHqxShadersPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1130,31 +1141,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingHqxShadersPass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingHqxShadersPass1ShaderDef::EdgeSmoothingHqxShadersPass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingHqxShadersPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "pass1";
-		VertexByteCode = RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("trY", -1, 16, 4, 0.000000f, 255.000000f, 48.000000f, 1.000000f, "Y Threshold"));
-		Params.push_back(ShaderParam("trU", -1, 20, 4, 0.000000f, 255.000000f, 7.000000f, 1.000000f, "U Threshold"));
-		Params.push_back(ShaderParam("trV", -1, 24, 4, 0.000000f, 255.000000f, 6.000000f, 1.000000f, "V Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pass1";
+	VertexByteCode = RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingHqxShadersPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("trY", -1, 16, 4, 0.000000f, 255.000000f, 48.000000f, 1.000000f, "Y Threshold"));
+	Params.push_back(ShaderParam("trU", -1, 20, 4, 0.000000f, 255.000000f, 7.000000f, 1.000000f, "U Threshold"));
+	Params.push_back(ShaderParam("trV", -1, 24, 4, 0.000000f, 255.000000f, 6.000000f, 1.000000f, "V Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -40,6 +40,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingNediShadersNediHybridPass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingNediShadersNediHybridPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1812,33 +1823,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingNediShadersNediHybridPass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingNediShadersNediHybridPass1ShaderDef::EdgeSmoothingNediShadersNediHybridPass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingNediShadersNediHybridPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "nedi-hybrid-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("NEDI_E", -1, 52, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "EDGE STRENGTH"));
-		Params.push_back(ShaderParam("FALLBACK_FILTER", -1, 56, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "FALLBACK FILTER (smooth <--> sharp)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "nedi-hybrid-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingNediShadersNediHybridPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("NEDI_E", -1, 52, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "EDGE STRENGTH"));
+	Params.push_back(ShaderParam("FALLBACK_FILTER", -1, 56, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "FALLBACK FILTER (smooth <--> sharp)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -36,6 +36,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingNediShadersNediPass0ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingNediShadersNediPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1474,32 +1485,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingNediShadersNediPass0ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingNediShadersNediPass0ShaderDef::EdgeSmoothingNediShadersNediPass0ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingNediShadersNediPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "nedi-pass0";
-		VertexByteCode = RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("NEDI_E", -1, 52, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "EDGE STRENGTH"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "nedi-pass0";
+	VertexByteCode = RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingNediShadersNediPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("NEDI_E", -1, 52, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "EDGE STRENGTH"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
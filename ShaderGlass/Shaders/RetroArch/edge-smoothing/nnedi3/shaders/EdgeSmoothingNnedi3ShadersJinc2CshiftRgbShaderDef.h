@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1518,34 +1529,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef::EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef() : ShaderDef{}
-	{
-		Name = "jinc2-cshift-rgb";
-		VertexByteCode = RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("JINC2_WINDOW_SINC", -1, 52, 4, 0.000000f, 1.000000f, 0.440000f, 0.010000f, "Window Sinc Param"));
-		Params.push_back(ShaderParam("JINC2_SINC", -1, 56, 4, 0.000000f, 1.000000f, 0.820000f, 0.010000f, "Sinc Param"));
-		Params.push_back(ShaderParam("JINC2_AR_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-ringing Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "jinc2-cshift-rgb";
+	VertexByteCode = RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("JINC2_WINDOW_SINC", -1, 52, 4, 0.000000f, 1.000000f, 0.440000f, 0.010000f, "Window Sinc Param"));
+	Params.push_back(ShaderParam("JINC2_SINC", -1, 56, 4, 0.000000f, 1.000000f, 0.820000f, 0.010000f, "Sinc Param"));
+	Params.push_back(ShaderParam("JINC2_AR_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Anti-ringing Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
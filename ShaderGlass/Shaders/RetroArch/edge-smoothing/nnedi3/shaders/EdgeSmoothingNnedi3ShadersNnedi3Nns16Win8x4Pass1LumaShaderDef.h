@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -4431,31 +4442,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef::EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef() : ShaderDef{}
-	{
-		Name = "nnedi3-nns16-win8x4-pass1-luma";
-		VertexByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "nnedi3-nns16-win8x4-pass1-luma";
+	VertexByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
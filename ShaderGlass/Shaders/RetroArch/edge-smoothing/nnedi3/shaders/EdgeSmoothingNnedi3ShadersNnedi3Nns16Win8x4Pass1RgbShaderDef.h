@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -12510,31 +12521,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef::EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef() : ShaderDef{}
-	{
-		Name = "nnedi3-nns16-win8x4-pass1-rgb";
-		VertexByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "nnedi3-nns16-win8x4-pass1-rgb";
+	VertexByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -5552,31 +5563,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef::EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef() : ShaderDef{}
-	{
-		Name = "omniscale-legacy";
-		VertexByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "omniscale-legacy";
+	VertexByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingOmniscaleShadersOmniscaleShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingOmniscaleShadersOmniscaleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3835,31 +3846,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingOmniscaleShadersOmniscaleShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingOmniscaleShadersOmniscaleShaderDef::EdgeSmoothingOmniscaleShadersOmniscaleShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingOmniscaleShadersOmniscaleShaderDef() : ShaderDef{}
-	{
-		Name = "omniscale";
-		VertexByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "omniscale";
+	VertexByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingOmniscaleShadersOmniscaleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -44,6 +44,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3117,33 +3128,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef::EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef() : ShaderDef{}
-	{
-		Name = "sabr-hybrid-deposterize";
-		VertexByteCode = RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("minimum", -1, 52, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Edge Thresh Min"));
-		Params.push_back(ShaderParam("maximum", -1, 56, 4, 0.000000f, 1.000000f, 0.080000f, 0.010000f, "Edge Thresh Max"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sabr-hybrid-deposterize";
+	VertexByteCode = RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("minimum", -1, 52, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Edge Thresh Min"));
+	Params.push_back(ShaderParam("maximum", -1, 56, 4, 0.000000f, 1.000000f, 0.080000f, 0.010000f, "Edge Thresh Max"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersScalefxPass0ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersScalefxPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -497,28 +508,22 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersScalefxPass0ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersScalefxPass0ShaderDef::EdgeSmoothingScalefxShadersScalefxPass0ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersScalefxPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass0";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "scalefx-pass0";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersScalefxPass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersScalefxPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -773,30 +784,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersScalefxPass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersScalefxPass1ShaderDef::EdgeSmoothingScalefxShadersScalefxPass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersScalefxPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SFX_CLR", -1, 16, 4, 0.010000f, 1.000000f, 0.500000f, 0.010000f, "ScaleFX Threshold"));
-		Params.push_back(ShaderParam("SFX_SAA", -1, 20, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ScaleFX Filter AA"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "scalefx-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SFX_CLR", -1, 16, 4, 0.010000f, 1.000000f, 0.500000f, 0.010000f, "ScaleFX Threshold"));
+	Params.push_back(ShaderParam("SFX_SAA", -1, 20, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ScaleFX Filter AA"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersScalefxPass2ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersScalefxPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1456,29 +1467,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersScalefxPass2ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersScalefxPass2ShaderDef::EdgeSmoothingScalefxShadersScalefxPass2ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersScalefxPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass2";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("scalefx_pass0", 2));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "scalefx-pass2";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("scalefx_pass0", 2));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersScalefxPass3ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersScalefxPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2715,29 +2726,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersScalefxPass3ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersScalefxPass3ShaderDef::EdgeSmoothingScalefxShadersScalefxPass3ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersScalefxPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass3";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SFX_SCN", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ScaleFX Filter Corners"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "scalefx-pass3";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SFX_SCN", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "ScaleFX Filter Corners"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -20,6 +20,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1143,30 +1154,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef::EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass4-hybrid";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SFX_RAA", -1, 16, 4, 0.000000f, 10.000000f, 2.000000f, 0.050000f, "ScaleFX rAA Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 1));
-		Samplers.push_back(ShaderSampler("refpass", 2));
+	Name = "scalefx-pass4-hybrid";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersScalefxPass4HybridShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SFX_RAA", -1, 16, 4, 0.000000f, 10.000000f, 2.000000f, 0.050000f, "ScaleFX rAA Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 1));
+	Samplers.push_back(ShaderSampler("refpass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -521,28 +532,22 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef::EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass0";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "scalefx-pass0";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
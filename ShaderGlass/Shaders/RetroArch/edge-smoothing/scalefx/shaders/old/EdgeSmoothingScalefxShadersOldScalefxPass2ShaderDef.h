@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2591,28 +2602,22 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef::EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass2";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "scalefx-pass2";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
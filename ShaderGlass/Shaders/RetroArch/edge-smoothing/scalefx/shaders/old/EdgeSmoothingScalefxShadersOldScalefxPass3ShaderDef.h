@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -623,29 +634,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef::EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass3";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
-		Samplers.push_back(ShaderSampler("scalefx_old_refpass", 2));
+	Name = "scalefx-pass3";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
+	Samplers.push_back(ShaderSampler("scalefx_old_refpass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
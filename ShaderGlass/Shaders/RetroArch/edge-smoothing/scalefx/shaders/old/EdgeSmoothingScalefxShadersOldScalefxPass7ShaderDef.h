@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -618,29 +629,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef::EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef() : ShaderDef{}
-	{
-		Name = "scalefx-pass7";
-		VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 1));
-		Samplers.push_back(ShaderSampler("sfxp3", 2));
+	Name = "scalefx-pass7";
+	VertexByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalefxShadersOldScalefxPass7ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 1));
+	Samplers.push_back(ShaderSampler("sfxp3", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalehqShaders2xScaleHQShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalehqShaders2xScaleHQShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -878,30 +889,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalehqShaders2xScaleHQShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalehqShaders2xScaleHQShaderDef::EdgeSmoothingScalehqShaders2xScaleHQShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalehqShaders2xScaleHQShaderDef() : ShaderDef{}
-	{
-		Name = "2xScaleHQ";
-		VertexByteCode = RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "2xScaleHQ";
+	VertexByteCode = RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalehqShaders2xScaleHQShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalehqShaders4xScaleHQShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalehqShaders4xScaleHQShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1125,30 +1136,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalehqShaders4xScaleHQShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalehqShaders4xScaleHQShaderDef::EdgeSmoothingScalehqShaders4xScaleHQShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalehqShaders4xScaleHQShaderDef() : ShaderDef{}
-	{
-		Name = "4xScaleHQ";
-		VertexByteCode = RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "4xScaleHQ";
+	VertexByteCode = RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalehqShaders4xScaleHQShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingScalenxShadersScale2xSFXShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingScalenxShadersScale2xSFXShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1669,34 +1680,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingScalenxShadersScale2xSFXShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingScalenxShadersScale2xSFXShaderDef::EdgeSmoothingScalenxShadersScale2xSFXShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingScalenxShadersScale2xSFXShaderDef() : ShaderDef{}
-	{
-		Name = "scale2xSFX";
-		VertexByteCode = RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("YTR", -1, 52, 4, 0.000000f, 255.000000f, 48.000000f, 1.000000f, "SCALE2xSFX Y Threshold"));
-		Params.push_back(ShaderParam("UTR", -1, 56, 4, 0.000000f, 255.000000f, 7.000000f, 1.000000f, "SCALE2xSFX U Threshold"));
-		Params.push_back(ShaderParam("VTR", -1, 60, 4, 0.000000f, 255.000000f, 6.000000f, 1.000000f, "SCALE2xSFX V Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scale2xSFX";
+	VertexByteCode = RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingScalenxShadersScale2xSFXShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("YTR", -1, 52, 4, 0.000000f, 255.000000f, 48.000000f, 1.000000f, "SCALE2xSFX Y Threshold"));
+	Params.push_back(ShaderParam("UTR", -1, 56, 4, 0.000000f, 255.000000f, 7.000000f, 1.000000f, "SCALE2xSFX U Threshold"));
+	Params.push_back(ShaderParam("VTR", -1, 60, 4, 0.000000f, 255.000000f, 6.000000f, 1.000000f, "SCALE2xSFX V Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
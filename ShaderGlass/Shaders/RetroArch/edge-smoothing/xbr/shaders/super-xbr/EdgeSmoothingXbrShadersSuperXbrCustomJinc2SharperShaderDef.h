@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1487,34 +1498,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef::EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef() : ShaderDef{}
-	{
-		Name = "custom-jinc2-sharper";
-		VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("JINC2_WINDOW_SINC", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Window Sinc Param"));
-		Params.push_back(ShaderParam("JINC2_SINC", -1, 56, 4, 0.000000f, 1.000000f, 0.880000f, 0.010000f, "Sinc Param"));
-		Params.push_back(ShaderParam("JINC2_AR_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Anti-ringing Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "custom-jinc2-sharper";
+	VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("JINC2_WINDOW_SINC", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Window Sinc Param"));
+	Params.push_back(ShaderParam("JINC2_SINC", -1, 56, 4, 0.000000f, 1.000000f, 0.880000f, 0.010000f, "Sinc Param"));
+	Params.push_back(ShaderParam("JINC2_AR_STRENGTH", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Anti-ringing Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
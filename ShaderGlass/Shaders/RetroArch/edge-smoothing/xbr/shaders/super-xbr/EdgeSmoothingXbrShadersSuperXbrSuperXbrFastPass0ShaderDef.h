@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1096,33 +1107,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef::EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "super-xbr-fast-pass0";
-		VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("XBR_EDGE_STR_P0", -1, 52, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Jaggies Anti-Aliasing [Rough <--> Smooth]"));
-		Params.push_back(ShaderParam("XBR_WEIGHT", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.500000f, "Color Blending [Rough <--> Smooth]"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "super-xbr-fast-pass0";
+	VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("XBR_EDGE_STR_P0", -1, 52, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Jaggies Anti-Aliasing [Rough <--> Smooth]"));
+	Params.push_back(ShaderParam("XBR_WEIGHT", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.500000f, "Color Blending [Rough <--> Smooth]"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
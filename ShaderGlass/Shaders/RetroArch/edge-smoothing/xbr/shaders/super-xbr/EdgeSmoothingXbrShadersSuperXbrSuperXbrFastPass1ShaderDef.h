@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -979,32 +990,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef::EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "super-xbr-fast-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("XbrSource", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "super-xbr-fast-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("XbrSource", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -19,6 +19,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1627,36 +1638,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef::EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "super-xbr-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MODE", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Mode - Normal, Details, Adaptive"));
-		Params.push_back(ShaderParam("XBR_EDGE_SHP", -1, 56, 4, 0.000000f, 3.000000f, 0.400000f, 0.100000f, "Adaptive Dynamic Edge Sharp"));
-		Params.push_back(ShaderParam("XBR_TEXTURE_SHP", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Adaptive Static Edge Sharp"));
-		Params.push_back(ShaderParam("XBR_EDGE_STR_P1", -1, 64, 4, 0.000000f, 5.000000f, 5.000000f, 0.500000f, "Xbr - Edge Strength p1"));
-		Samplers.push_back(ShaderSampler("XbrSource", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "super-xbr-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MODE", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Mode - Normal, Details, Adaptive"));
+	Params.push_back(ShaderParam("XBR_EDGE_SHP", -1, 56, 4, 0.000000f, 3.000000f, 0.400000f, 0.100000f, "Adaptive Dynamic Edge Sharp"));
+	Params.push_back(ShaderParam("XBR_TEXTURE_SHP", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Adaptive Static Edge Sharp"));
+	Params.push_back(ShaderParam("XBR_EDGE_STR_P1", -1, 64, 4, 0.000000f, 5.000000f, 5.000000f, 0.500000f, "Xbr - Edge Strength p1"));
+	Samplers.push_back(ShaderSampler("XbrSource", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -20,6 +20,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1278,32 +1289,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef::EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef() : ShaderDef{}
-	{
-		Name = "xbr-lv2-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("XBR_BLENDING", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "BLENDING [ NOBLEND | AA ]"));
-		Samplers.push_back(ShaderSampler("XbrSource", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "xbr-lv2-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("XBR_BLENDING", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "BLENDING [ NOBLEND | AA ]"));
+	Samplers.push_back(ShaderSampler("XbrSource", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
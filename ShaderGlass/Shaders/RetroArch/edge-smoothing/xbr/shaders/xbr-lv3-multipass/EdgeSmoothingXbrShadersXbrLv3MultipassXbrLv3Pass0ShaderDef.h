@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2657,35 +2668,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef::EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef() : ShaderDef{}
-	{
-		Name = "xbr-lv3-pass0";
-		VertexByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SMALL_DETAILS", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "XBR - MODE (VANILLA | SMALL DETAILS)"));
-		Params.push_back(ShaderParam("WP4", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.200000f, "XBR - SMOOTHNESS LOCAL WEIGHT"));
-		Params.push_back(ShaderParam("KA", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "XBR - SMOOTHNESS THRESHOLD"));
-		Params.push_back(ShaderParam("XBR_EQ_THRESHOLD", -1, 12, 4, 0.000000f, 1.000000f, 0.260000f, 0.010000f, "XBR - COLOR DISTINCTION THRESHOLD"));
-		Params.push_back(ShaderParam("FD", -1, 16, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "XBR - DITHERING/SMOOTHNESS COMPROMISE (MEDIUM | HIGH)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "xbr-lv3-pass0";
+	VertexByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SMALL_DETAILS", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "XBR - MODE (VANILLA | SMALL DETAILS)"));
+	Params.push_back(ShaderParam("WP4", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.200000f, "XBR - SMOOTHNESS LOCAL WEIGHT"));
+	Params.push_back(ShaderParam("KA", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "XBR - SMOOTHNESS THRESHOLD"));
+	Params.push_back(ShaderParam("XBR_EQ_THRESHOLD", -1, 12, 4, 0.000000f, 1.000000f, 0.260000f, 0.010000f, "XBR - COLOR DISTINCTION THRESHOLD"));
+	Params.push_back(ShaderParam("FD", -1, 16, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "XBR - DITHERING/SMOOTHNESS COMPROMISE (MEDIUM | HIGH)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
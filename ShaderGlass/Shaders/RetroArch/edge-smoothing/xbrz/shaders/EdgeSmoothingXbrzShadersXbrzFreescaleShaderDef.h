@@ -77,6 +77,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -6541,32 +6552,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef::EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef() : ShaderDef{}
-	{
-		Name = "xbrz-freescale";
-		VertexByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blend_none", -1, 32, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Blend None"));
-		Params.push_back(ShaderParam("blend_normal", -1, 36, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Blend Normal"));
-		Params.push_back(ShaderParam("blend_dominant", -1, 40, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Blend Dominant"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "xbrz-freescale";
+	VertexByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blend_none", -1, 32, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Blend None"));
+	Params.push_back(ShaderParam("blend_normal", -1, 36, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Blend Normal"));
+	Params.push_back(ShaderParam("blend_dominant", -1, 40, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Blend Dominant"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
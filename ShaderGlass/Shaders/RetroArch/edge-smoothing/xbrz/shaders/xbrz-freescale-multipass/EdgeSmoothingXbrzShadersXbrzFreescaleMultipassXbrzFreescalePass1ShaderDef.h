@@ -44,6 +44,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1623,33 +1634,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef::EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef() : ShaderDef{}
-	{
-		Name = "xbrz-freescale-pass1";
-		VertexByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("xbrz_fs_refpassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blend_none", -1, 32, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Blend None"));
-		Params.push_back(ShaderParam("blend_normal", -1, 36, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Blend Normal"));
-		Params.push_back(ShaderParam("blend_dominant", -1, 40, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Blend Dominant"));
-		Samplers.push_back(ShaderSampler("xbrz_fs_refpass", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "xbrz-freescale-pass1";
+	VertexByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("xbrz_fs_refpassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blend_none", -1, 32, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Blend None"));
+	Params.push_back(ShaderParam("blend_normal", -1, 36, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Blend Normal"));
+	Params.push_back(ShaderParam("blend_dominant", -1, 40, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Blend Dominant"));
+	Samplers.push_back(ShaderSampler("xbrz_fs_refpass", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
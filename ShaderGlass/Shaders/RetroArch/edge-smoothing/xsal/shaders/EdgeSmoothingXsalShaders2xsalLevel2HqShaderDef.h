@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1248,30 +1259,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef::EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef() : ShaderDef{}
-	{
-		Name = "2xsal-level2-hq";
-		VertexByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "2xsal-level2-hq";
+	VertexByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2HqShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1007,31 +1018,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef::EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef() : ShaderDef{}
-	{
-		Name = "2xsal-level2-xbr";
-		VertexByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AAOFFSET", -1, 48, 4, 0.250000f, 2.000000f, 1.000000f, 0.125000f, "Filter width"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "2xsal-level2-xbr";
+	VertexByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXsalShaders2xsalLevel2XbrShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AAOFFSET", -1, 48, 4, 0.250000f, 2.000000f, 1.000000f, 0.125000f, "Filter width"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
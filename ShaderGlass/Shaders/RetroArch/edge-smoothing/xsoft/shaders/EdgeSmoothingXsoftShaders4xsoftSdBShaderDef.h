@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXsoftShaders4xsoftSdBShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXsoftShaders4xsoftSdBShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1044,34 +1055,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXsoftShaders4xsoftSdBShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXsoftShaders4xsoftSdBShaderDef::EdgeSmoothingXsoftShaders4xsoftSdBShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXsoftShaders4xsoftSdBShaderDef() : ShaderDef{}
-	{
-		Name = "4xsoftSdB";
-		VertexByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RESOLUTION_X", -1, 52, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution X"));
-		Params.push_back(ShaderParam("RESOLUTION_Y", -1, 56, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution Y"));
-		Params.push_back(ShaderParam("CONTRAST", -1, 60, 4, 0.000000f, 10.000000f, 3.000000f, 0.100000f, "4xSoft Contrast"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "4xsoftSdB";
+	VertexByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftSdBShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RESOLUTION_X", -1, 52, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution X"));
+	Params.push_back(ShaderParam("RESOLUTION_Y", -1, 56, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution Y"));
+	Params.push_back(ShaderParam("CONTRAST", -1, 60, 4, 0.000000f, 10.000000f, 3.000000f, 0.100000f, "4xSoft Contrast"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class EdgeSmoothingXsoftShaders4xsoftShaderDef : public ShaderDef
+{
+public:
+	EdgeSmoothingXsoftShaders4xsoftShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -971,34 +982,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class EdgeSmoothingXsoftShaders4xsoftShaderDef : public ShaderDef
+RetroArch::EdgeSmoothingXsoftShaders4xsoftShaderDef::EdgeSmoothingXsoftShaders4xsoftShaderDef() : ShaderDef{}
 {
-public:
-	EdgeSmoothingXsoftShaders4xsoftShaderDef() : ShaderDef{}
-	{
-		Name = "4xsoft";
-		VertexByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RESOLUTION_X", -1, 52, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution X"));
-		Params.push_back(ShaderParam("RESOLUTION_Y", -1, 56, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution Y"));
-		Params.push_back(ShaderParam("CONTRAST", -1, 60, 4, 0.000000f, 10.000000f, 3.000000f, 0.100000f, "4xSoft Contrast"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "4xsoft";
+	VertexByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchEdgeSmoothingXsoftShaders4xsoftShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RESOLUTION_X", -1, 52, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution X"));
+	Params.push_back(ShaderParam("RESOLUTION_Y", -1, 56, 4, 0.000000f, 1920.000000f, 0.000000f, 1.000000f, "4xSoft Input Resolution Y"));
+	Params.push_back(ShaderParam("CONTRAST", -1, 60, 4, 0.000000f, 10.000000f, 3.000000f, 0.100000f, "4xSoft Contrast"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
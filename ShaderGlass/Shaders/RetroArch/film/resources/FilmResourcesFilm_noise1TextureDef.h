@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class FilmResourcesFilm_noise1TextureDef : public TextureDef
+{
+public:
+	FilmResourcesFilm_noise1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace FilmResourcesFilm_noise1TextureDefs
 {
 const BYTE sData[] =
@@ -1068,13 +1076,10 @@ const BYTE sData[] =
 ,96,130};
 }
 
-class FilmResourcesFilm_noise1TextureDef : public TextureDef
+FilmResourcesFilm_noise1TextureDef::FilmResourcesFilm_noise1TextureDef() : TextureDef{}
 {
-public:
-	FilmResourcesFilm_noise1TextureDef() : TextureDef{}
-	{
-		Name = "film_noise1.png";
-		Data = FilmResourcesFilm_noise1TextureDefs::sData;
-		DataLength = sizeof(FilmResourcesFilm_noise1TextureDefs::sData);
-	}
-};
+	Name = "film_noise1.png";
+	Data = FilmResourcesFilm_noise1TextureDefs::sData;
+	DataLength = sizeof(FilmResourcesFilm_noise1TextureDefs::sData);
+}
+#endif
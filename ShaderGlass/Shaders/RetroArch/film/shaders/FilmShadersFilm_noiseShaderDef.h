@@ -27,6 +27,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class FilmShadersFilm_noiseShaderDef : public ShaderDef
+{
+public:
+	FilmShadersFilm_noiseShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchFilmShadersFilm_noiseShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1333,46 +1344,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class FilmShadersFilm_noiseShaderDef : public ShaderDef
+RetroArch::FilmShadersFilm_noiseShaderDef::FilmShadersFilm_noiseShaderDef() : ShaderDef{}
 {
-public:
-	FilmShadersFilm_noiseShaderDef() : ShaderDef{}
-	{
-		Name = "film_noise";
-		VertexByteCode = RetroArchFilmShadersFilm_noiseShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchFilmShadersFilm_noiseShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchFilmShadersFilm_noiseShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchFilmShadersFilm_noiseShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("x_off_r", -1, 52, 4, -1.000000f, 1.000000f, 0.120000f, 0.010000f, "X Offset Red"));
-		Params.push_back(ShaderParam("y_off_r", -1, 56, 4, -1.000000f, 1.000000f, 0.070000f, 0.010000f, "Y Offset Red"));
-		Params.push_back(ShaderParam("x_off_g", -1, 60, 4, -1.000000f, 1.000000f, -0.060000f, 0.010000f, "X Offset Green"));
-		Params.push_back(ShaderParam("y_off_g", -1, 64, 4, -1.000000f, 1.000000f, -0.080000f, 0.010000f, "Y Offset Green"));
-		Params.push_back(ShaderParam("x_off_b", -1, 68, 4, -1.000000f, 1.000000f, -0.110000f, 0.010000f, "X Offset Blue"));
-		Params.push_back(ShaderParam("y_off_b", -1, 72, 4, -1.000000f, 1.000000f, 0.090000f, 0.010000f, "Y Offset Blue"));
-		Params.push_back(ShaderParam("grain_str", -1, 76, 4, 0.000000f, 60.000000f, 24.000000f, 1.000000f, "Grain Strength"));
-		Params.push_back(ShaderParam("hotspot", -1, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Hotspot Toggle"));
-		Params.push_back(ShaderParam("vignette", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette Toggle"));
-		Params.push_back(ShaderParam("noise_toggle", -1, 88, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Film Scratches"));
-		Params.push_back(ShaderParam("jitter", -1, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Jitter Toggle"));
-		Params.push_back(ShaderParam("vig_flicker", -1, 96, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette Flicker Toggle"));
-		Params.push_back(ShaderParam("vig_amt", -1, 100, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Vignette Amount"));
-		Params.push_back(ShaderParam("technicolor", -1, 104, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Color Shift Intensity"));
-		Samplers.push_back(ShaderSampler("noise1", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "film_noise";
+	VertexByteCode = RetroArchFilmShadersFilm_noiseShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchFilmShadersFilm_noiseShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchFilmShadersFilm_noiseShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchFilmShadersFilm_noiseShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("x_off_r", -1, 52, 4, -1.000000f, 1.000000f, 0.120000f, 0.010000f, "X Offset Red"));
+	Params.push_back(ShaderParam("y_off_r", -1, 56, 4, -1.000000f, 1.000000f, 0.070000f, 0.010000f, "Y Offset Red"));
+	Params.push_back(ShaderParam("x_off_g", -1, 60, 4, -1.000000f, 1.000000f, -0.060000f, 0.010000f, "X Offset Green"));
+	Params.push_back(ShaderParam("y_off_g", -1, 64, 4, -1.000000f, 1.000000f, -0.080000f, 0.010000f, "Y Offset Green"));
+	Params.push_back(ShaderParam("x_off_b", -1, 68, 4, -1.000000f, 1.000000f, -0.110000f, 0.010000f, "X Offset Blue"));
+	Params.push_back(ShaderParam("y_off_b", -1, 72, 4, -1.000000f, 1.000000f, 0.090000f, 0.010000f, "Y Offset Blue"));
+	Params.push_back(ShaderParam("grain_str", -1, 76, 4, 0.000000f, 60.000000f, 24.000000f, 1.000000f, "Grain Strength"));
+	Params.push_back(ShaderParam("hotspot", -1, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Hotspot Toggle"));
+	Params.push_back(ShaderParam("vignette", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette Toggle"));
+	Params.push_back(ShaderParam("noise_toggle", -1, 88, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Film Scratches"));
+	Params.push_back(ShaderParam("jitter", -1, 92, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Jitter Toggle"));
+	Params.push_back(ShaderParam("vig_flicker", -1, 96, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette Flicker Toggle"));
+	Params.push_back(ShaderParam("vig_amt", -1, 100, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Vignette Amount"));
+	Params.push_back(ShaderParam("technicolor", -1, 104, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Color Shift Intensity"));
+	Samplers.push_back(ShaderSampler("noise1", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
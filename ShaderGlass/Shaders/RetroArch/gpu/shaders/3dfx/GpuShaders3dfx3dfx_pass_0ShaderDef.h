@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class GpuShaders3dfx3dfx_pass_0ShaderDef : public ShaderDef
+{
+public:
+	GpuShaders3dfx3dfx_pass_0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -666,32 +677,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class GpuShaders3dfx3dfx_pass_0ShaderDef : public ShaderDef
+RetroArch::GpuShaders3dfx3dfx_pass_0ShaderDef::GpuShaders3dfx3dfx_pass_0ShaderDef() : ShaderDef{}
 {
-public:
-	GpuShaders3dfx3dfx_pass_0ShaderDef() : ShaderDef{}
-	{
-		Name = "3dfx_pass_0";
-		VertexByteCode = RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LEIFX_LINES", -1, 52, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "LeiFX Line Intensity"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "3dfx_pass_0";
+	VertexByteCode = RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LEIFX_LINES", -1, 52, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "LeiFX Line Intensity"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
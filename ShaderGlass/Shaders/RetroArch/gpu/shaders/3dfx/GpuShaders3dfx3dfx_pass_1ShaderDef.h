@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class GpuShaders3dfx3dfx_pass_1ShaderDef : public ShaderDef
+{
+public:
+	GpuShaders3dfx3dfx_pass_1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -486,31 +497,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class GpuShaders3dfx3dfx_pass_1ShaderDef : public ShaderDef
+RetroArch::GpuShaders3dfx3dfx_pass_1ShaderDef::GpuShaders3dfx3dfx_pass_1ShaderDef() : ShaderDef{}
 {
-public:
-	GpuShaders3dfx3dfx_pass_1ShaderDef() : ShaderDef{}
-	{
-		Name = "3dfx_pass_1";
-		VertexByteCode = RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "3dfx_pass_1";
+	VertexByteCode = RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
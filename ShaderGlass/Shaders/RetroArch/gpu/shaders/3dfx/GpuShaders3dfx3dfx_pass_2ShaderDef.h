@@ -21,6 +21,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class GpuShaders3dfx3dfx_pass_2ShaderDef : public ShaderDef
+{
+public:
+	GpuShaders3dfx3dfx_pass_2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -398,32 +409,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class GpuShaders3dfx3dfx_pass_2ShaderDef : public ShaderDef
+RetroArch::GpuShaders3dfx3dfx_pass_2ShaderDef::GpuShaders3dfx3dfx_pass_2ShaderDef() : ShaderDef{}
 {
-public:
-	GpuShaders3dfx3dfx_pass_2ShaderDef() : ShaderDef{}
-	{
-		Name = "3dfx_pass_2";
-		VertexByteCode = RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GAMMA_LEVEL", -1, 52, 4, 0.000000f, 2.000000f, 1.300000f, 0.010000f, "LeiFX Gamma Correction"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "3dfx_pass_2";
+	VertexByteCode = RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchGpuShaders3dfx3dfx_pass_2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GAMMA_LEVEL", -1, 52, 4, 0.000000f, 2.000000f, 1.300000f, 0.010000f, "LeiFX Gamma Correction"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
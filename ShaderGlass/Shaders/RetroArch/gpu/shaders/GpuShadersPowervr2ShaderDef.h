@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class GpuShadersPowervr2ShaderDef : public ShaderDef
+{
+public:
+	GpuShadersPowervr2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchGpuShadersPowervr2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -782,33 +793,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class GpuShadersPowervr2ShaderDef : public ShaderDef
+RetroArch::GpuShadersPowervr2ShaderDef::GpuShadersPowervr2ShaderDef() : ShaderDef{}
 {
-public:
-	GpuShadersPowervr2ShaderDef() : ShaderDef{}
-	{
-		Name = "powervr2";
-		VertexByteCode = RetroArchGpuShadersPowervr2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchGpuShadersPowervr2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchGpuShadersPowervr2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchGpuShadersPowervr2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("INTERLACED", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "PVR - Interlace smoothing"));
-		Params.push_back(ShaderParam("VGASIGNAL", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "PVR - VGA signal loss"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "powervr2";
+	VertexByteCode = RetroArchGpuShadersPowervr2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchGpuShadersPowervr2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchGpuShadersPowervr2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchGpuShadersPowervr2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("INTERLACED", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "PVR - Interlace smoothing"));
+	Params.push_back(ShaderParam("VGASIGNAL", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "PVR - VGA signal loss"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
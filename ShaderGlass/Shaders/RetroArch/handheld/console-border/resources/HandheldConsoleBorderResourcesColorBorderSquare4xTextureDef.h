@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesColorBorderSquare4xTextureDefs
 {
 const BYTE sData[] =
@@ -9453,13 +9461,10 @@ const BYTE sData[] =
 ,159,141,30,35,35,166,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef : public TextureDef
+HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef::HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef() : TextureDef{}
-	{
-		Name = "color-border-square-4x.png";
-		Data = HandheldConsoleBorderResourcesColorBorderSquare4xTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesColorBorderSquare4xTextureDefs::sData);
-	}
-};
+	Name = "color-border-square-4x.png";
+	Data = HandheldConsoleBorderResourcesColorBorderSquare4xTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesColorBorderSquare4xTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesDmgBackgroundTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesDmgBackgroundTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesDmgBackgroundTextureDefs
 {
 const BYTE sData[] =
@@ -14,13 +22,10 @@ const BYTE sData[] =
 ,84,120,1,99,104,32,0,70,172,130,81,5,163,10,70,21,0,0,66,0,0,31,96,190,166,104,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesDmgBackgroundTextureDef : public TextureDef
+HandheldConsoleBorderResourcesDmgBackgroundTextureDef::HandheldConsoleBorderResourcesDmgBackgroundTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesDmgBackgroundTextureDef() : TextureDef{}
-	{
-		Name = "dmg-background.png";
-		Data = HandheldConsoleBorderResourcesDmgBackgroundTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesDmgBackgroundTextureDefs::sData);
-	}
-};
+	Name = "dmg-background.png";
+	Data = HandheldConsoleBorderResourcesDmgBackgroundTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesDmgBackgroundTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDefs
 {
 const BYTE sData[] =
@@ -8815,13 +8823,10 @@ const BYTE sData[] =
 ,174,3,237,30,208,178,132,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef : public TextureDef
+HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef::HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef() : TextureDef{}
-	{
-		Name = "dmg-border-square-4x.png";
-		Data = HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDefs::sData);
-	}
-};
+	Name = "dmg-border-square-4x.png";
+	Data = HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDefs::sData);
+}
+#endif
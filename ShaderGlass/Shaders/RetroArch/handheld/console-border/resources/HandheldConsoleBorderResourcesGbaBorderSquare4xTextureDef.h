@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDefs
 {
 const BYTE sData[] =
@@ -9414,13 +9422,10 @@ const BYTE sData[] =
 ,8,0,0,208,37,32,0,0,192,155,3,255,182,145,105,251,87,221,231,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef : public TextureDef
+HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef::HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef() : TextureDef{}
-	{
-		Name = "gba-border-square-4x.png";
-		Data = HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDefs::sData);
-	}
-};
+	Name = "gba-border-square-4x.png";
+	Data = HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDefs::sData);
+}
+#endif
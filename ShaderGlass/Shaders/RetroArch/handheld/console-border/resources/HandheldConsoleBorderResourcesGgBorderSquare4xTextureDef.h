@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesGgBorderSquare4xTextureDefs
 {
 const BYTE sData[] =
@@ -17163,13 +17171,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef : public TextureDef
+HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef::HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef() : TextureDef{}
-	{
-		Name = "gg-border-square-4x.png";
-		Data = HandheldConsoleBorderResourcesGgBorderSquare4xTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesGgBorderSquare4xTextureDefs::sData);
-	}
-};
+	Name = "gg-border-square-4x.png";
+	Data = HandheldConsoleBorderResourcesGgBorderSquare4xTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesGgBorderSquare4xTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDefs
 {
 const BYTE sData[] =
@@ -20731,13 +20739,10 @@ const BYTE sData[] =
 ,34,32,0,0,64,151,128,0,0,0,203,67,64,14,42,3,165,41,183,146,224,206,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef : public TextureDef
+HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef::HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef() : TextureDef{}
-	{
-		Name = "ngpc-border-square-4x.png";
-		Data = HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDefs::sData);
-	}
-};
+	Name = "ngpc-border-square-4x.png";
+	Data = HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDefs::sData);
+}
+#endif
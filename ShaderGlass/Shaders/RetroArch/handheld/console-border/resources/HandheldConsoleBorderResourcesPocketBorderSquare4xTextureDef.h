@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDefs
 {
 const BYTE sData[] =
@@ -11028,13 +11036,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef : public TextureDef
+HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef::HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef() : TextureDef{}
-	{
-		Name = "pocket-border-square-4x.png";
-		Data = HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDefs::sData);
-	}
-};
+	Name = "pocket-border-square-4x.png";
+	Data = HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldConsoleBorderResourcesPspBorderTextureDef : public TextureDef
+{
+public:
+	HandheldConsoleBorderResourcesPspBorderTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldConsoleBorderResourcesPspBorderTextureDefs
 {
 const BYTE sData[] =
@@ -9756,13 +9764,10 @@ const BYTE sData[] =
 ,0,186,4,4,0,0,88,4,4,0,0,232,18,16,0,0,224,205,1,62,125,111,110,82,198,169,25,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldConsoleBorderResourcesPspBorderTextureDef : public TextureDef
+HandheldConsoleBorderResourcesPspBorderTextureDef::HandheldConsoleBorderResourcesPspBorderTextureDef() : TextureDef{}
 {
-public:
-	HandheldConsoleBorderResourcesPspBorderTextureDef() : TextureDef{}
-	{
-		Name = "psp border.png";
-		Data = HandheldConsoleBorderResourcesPspBorderTextureDefs::sData;
-		DataLength = sizeof(HandheldConsoleBorderResourcesPspBorderTextureDefs::sData);
-	}
-};
+	Name = "psp border.png";
+	Data = HandheldConsoleBorderResourcesPspBorderTextureDefs::sData;
+	DataLength = sizeof(HandheldConsoleBorderResourcesPspBorderTextureDefs::sData);
+}
+#endif
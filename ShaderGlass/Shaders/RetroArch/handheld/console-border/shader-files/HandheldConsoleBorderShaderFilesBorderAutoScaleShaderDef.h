@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef : public ShaderDef
+{
+public:
+	HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -543,33 +554,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef : public ShaderDef
+RetroArch::HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef::HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef() : ShaderDef{}
 {
-public:
-	HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef() : ShaderDef{}
-	{
-		Name = "border-auto-scale";
-		VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("border_texture_scale", -1, 48, 4, 1.000000f, 20.000000f, 4.000000f, 0.005000f, "Border Scale"));
-		Params.push_back(ShaderParam("border_brightness", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Border Brightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("BORDER", 3));
+	Name = "border-auto-scale";
+	VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesBorderAutoScaleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("border_texture_scale", -1, 48, 4, 1.000000f, 20.000000f, 4.000000f, 0.005000f, "Border Scale"));
+	Params.push_back(ShaderParam("border_brightness", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Border Brightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("BORDER", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
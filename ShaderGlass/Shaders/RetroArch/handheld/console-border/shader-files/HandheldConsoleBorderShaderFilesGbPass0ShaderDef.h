@@ -65,6 +65,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldConsoleBorderShaderFilesGbPass0ShaderDef : public ShaderDef
+{
+public:
+	HandheldConsoleBorderShaderFilesGbPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1117,43 +1128,37 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldConsoleBorderShaderFilesGbPass0ShaderDef : public ShaderDef
+RetroArch::HandheldConsoleBorderShaderFilesGbPass0ShaderDef::HandheldConsoleBorderShaderFilesGbPass0ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldConsoleBorderShaderFilesGbPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "gb-pass0";
-		VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalHistorySize1", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("baseline_alpha", -1, 64, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Baseline Alpha"));
-		Params.push_back(ShaderParam("grey_balance", -1, 68, 4, 2.000000f, 4.000000f, 2.700000f, 0.100000f, "Grey Balance"));
-		Params.push_back(ShaderParam("response_time", -1, 72, 4, 0.000000f, 0.777000f, 0.200000f, 0.111000f, "LCD Response Time"));
-		Params.push_back(ShaderParam("video_scale", -1, 76, 4, 2.000000f, 20.000000f, 3.000000f, 1.000000f, "Video Scale"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
-		Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
-		Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
-		Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
-		Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
-		Samplers.push_back(ShaderSampler("COLOR_PALETTE", 10));
+	Name = "gb-pass0";
+	VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalHistorySize1", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("baseline_alpha", -1, 64, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Baseline Alpha"));
+	Params.push_back(ShaderParam("grey_balance", -1, 68, 4, 2.000000f, 4.000000f, 2.700000f, 0.100000f, "Grey Balance"));
+	Params.push_back(ShaderParam("response_time", -1, 72, 4, 0.000000f, 0.777000f, 0.200000f, 0.111000f, "LCD Response Time"));
+	Params.push_back(ShaderParam("video_scale", -1, 76, 4, 2.000000f, 20.000000f, 3.000000f, 1.000000f, "Video Scale"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
+	Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
+	Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
+	Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
+	Samplers.push_back(ShaderSampler("COLOR_PALETTE", 10));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -33,6 +33,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldConsoleBorderShaderFilesGbPass2ShaderDef : public ShaderDef
+{
+public:
+	HandheldConsoleBorderShaderFilesGbPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -749,31 +760,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldConsoleBorderShaderFilesGbPass2ShaderDef : public ShaderDef
+RetroArch::HandheldConsoleBorderShaderFilesGbPass2ShaderDef::HandheldConsoleBorderShaderFilesGbPass2ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldConsoleBorderShaderFilesGbPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "gb-pass2";
-		VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("shadow_blur1", -1, 48, 4, 0.000000f, 5.000000f, 2.000000f, 0.100000f, "Shadow Blur 1"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gb-pass2";
+	VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("shadow_blur1", -1, 48, 4, 0.000000f, 5.000000f, 2.000000f, 0.100000f, "Shadow Blur 1"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -33,6 +33,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldConsoleBorderShaderFilesGbPass3ShaderDef : public ShaderDef
+{
+public:
+	HandheldConsoleBorderShaderFilesGbPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -749,31 +760,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldConsoleBorderShaderFilesGbPass3ShaderDef : public ShaderDef
+RetroArch::HandheldConsoleBorderShaderFilesGbPass3ShaderDef::HandheldConsoleBorderShaderFilesGbPass3ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldConsoleBorderShaderFilesGbPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "gb-pass3";
-		VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("shadow_blur2", -1, 48, 4, 0.000000f, 5.000000f, 2.000000f, 0.100000f, "Shadow Blur 2"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gb-pass3";
+	VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesGbPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("shadow_blur2", -1, 48, 4, 0.000000f, 5.000000f, 2.000000f, 0.100000f, "Shadow Blur 2"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef : public ShaderDef
+{
+public:
+	HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1534,34 +1545,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef : public ShaderDef
+RetroArch::HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef::HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef() : ShaderDef{}
 {
-public:
-	HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef() : ShaderDef{}
-	{
-		Name = "lcd-grid";
-		VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("video_scale", 0, 112, 4, 2.000000f, 20.000000f, 3.000000f, 1.000000f, "Video Scale"));
-		Params.push_back(ShaderParam("PAR", 0, 116, 4, 0.000000f, 20.000000f, 1.000000f, 0.010000f, "Pixel Aspect Ratio"));
-		Params.push_back(ShaderParam("GRID_STRENGTH", 0, 120, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "LCD Grid Strength"));
-		Params.push_back(ShaderParam("gamma", 0, 124, 4, 1.000000f, 5.000000f, 2.200000f, 0.100000f, "LCD Input Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lcd-grid";
+	VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("video_scale", 0, 112, 4, 2.000000f, 20.000000f, 3.000000f, 1.000000f, "Video Scale"));
+	Params.push_back(ShaderParam("PAR", 0, 116, 4, 0.000000f, 20.000000f, 1.000000f, 0.010000f, "Pixel Aspect Ratio"));
+	Params.push_back(ShaderParam("GRID_STRENGTH", 0, 120, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "LCD Grid Strength"));
+	Params.push_back(ShaderParam("gamma", 0, 124, 4, 1.000000f, 5.000000f, 2.200000f, 0.100000f, "LCD Input Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef : public ShaderDef
+{
+public:
+	HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2089,46 +2100,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef : public ShaderDef
+RetroArch::HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef::HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef() : ShaderDef{}
-	{
-		Name = "lcd-grid-v2";
-		VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RSUBPIX_R", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Colour of R subpixel: R"));
-		Params.push_back(ShaderParam("RSUBPIX_G", -1, 4, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of R subpixel: G"));
-		Params.push_back(ShaderParam("RSUBPIX_B", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of R subpixel: B"));
-		Params.push_back(ShaderParam("GSUBPIX_R", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of G subpixel: R"));
-		Params.push_back(ShaderParam("GSUBPIX_G", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Colour of G subpixel: G"));
-		Params.push_back(ShaderParam("GSUBPIX_B", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of G subpixel: B"));
-		Params.push_back(ShaderParam("BSUBPIX_R", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of B subpixel: R"));
-		Params.push_back(ShaderParam("BSUBPIX_G", -1, 28, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of B subpixel: G"));
-		Params.push_back(ShaderParam("BSUBPIX_B", -1, 32, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Colour of B subpixel: B"));
-		Params.push_back(ShaderParam("gain", -1, 36, 4, 0.500000f, 2.000000f, 1.000000f, 0.050000f, "Gain"));
-		Params.push_back(ShaderParam("gamma", -1, 40, 4, 0.500000f, 5.000000f, 3.000000f, 0.100000f, "LCD Gamma"));
-		Params.push_back(ShaderParam("blacklevel", -1, 44, 4, 0.000000f, 0.500000f, 0.050000f, 0.010000f, "Black level"));
-		Params.push_back(ShaderParam("ambient", -1, 48, 4, 0.000000f, 0.500000f, 0.000000f, 0.010000f, "Ambient"));
-		Params.push_back(ShaderParam("BGR", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR"));
-		Params.push_back(ShaderParam("video_scale", -1, 56, 4, 2.000000f, 20.000000f, 3.000000f, 1.000000f, "Video Scale"));
-		Params.push_back(ShaderParam("PAR", -1, 60, 4, 0.000000f, 20.000000f, 1.000000f, 0.010000f, "Pixel Aspect Ratio"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lcd-grid-v2";
+	VertexByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RSUBPIX_R", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Colour of R subpixel: R"));
+	Params.push_back(ShaderParam("RSUBPIX_G", -1, 4, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of R subpixel: G"));
+	Params.push_back(ShaderParam("RSUBPIX_B", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of R subpixel: B"));
+	Params.push_back(ShaderParam("GSUBPIX_R", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of G subpixel: R"));
+	Params.push_back(ShaderParam("GSUBPIX_G", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Colour of G subpixel: G"));
+	Params.push_back(ShaderParam("GSUBPIX_B", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of G subpixel: B"));
+	Params.push_back(ShaderParam("BSUBPIX_R", -1, 24, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of B subpixel: R"));
+	Params.push_back(ShaderParam("BSUBPIX_G", -1, 28, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Colour of B subpixel: G"));
+	Params.push_back(ShaderParam("BSUBPIX_B", -1, 32, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Colour of B subpixel: B"));
+	Params.push_back(ShaderParam("gain", -1, 36, 4, 0.500000f, 2.000000f, 1.000000f, 0.050000f, "Gain"));
+	Params.push_back(ShaderParam("gamma", -1, 40, 4, 0.500000f, 5.000000f, 3.000000f, 0.100000f, "LCD Gamma"));
+	Params.push_back(ShaderParam("blacklevel", -1, 44, 4, 0.000000f, 0.500000f, 0.050000f, 0.010000f, "Black level"));
+	Params.push_back(ShaderParam("ambient", -1, 48, 4, 0.000000f, 0.500000f, 0.000000f, 0.010000f, "Ambient"));
+	Params.push_back(ShaderParam("BGR", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR"));
+	Params.push_back(ShaderParam("video_scale", -1, 56, 4, 2.000000f, 20.000000f, 3.000000f, 1.000000f, "Video Scale"));
+	Params.push_back(ShaderParam("PAR", -1, 60, 4, 0.000000f, 20.000000f, 1.000000f, 0.010000f, "Pixel Aspect Ratio"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
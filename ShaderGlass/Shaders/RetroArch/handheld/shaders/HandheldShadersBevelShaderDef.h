@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersBevelShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersBevelShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersBevelShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -439,32 +450,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersBevelShaderDef : public ShaderDef
+RetroArch::HandheldShadersBevelShaderDef::HandheldShadersBevelShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersBevelShaderDef() : ShaderDef{}
-	{
-		Name = "bevel";
-		VertexByteCode = RetroArchHandheldShadersBevelShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersBevelShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersBevelShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersBevelShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BEVEL_LEVEL", -1, 52, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Bevel Level"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bevel";
+	VertexByteCode = RetroArchHandheldShadersBevelShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersBevelShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersBevelShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersBevelShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BEVEL_LEVEL", -1, 52, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Bevel Level"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -21,6 +21,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersDsHybridViewShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersDsHybridViewShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersDsHybridViewShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -736,33 +747,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersDsHybridViewShaderDef : public ShaderDef
+RetroArch::HandheldShadersDsHybridViewShaderDef::HandheldShadersDsHybridViewShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersDsHybridViewShaderDef() : ShaderDef{}
-	{
-		Name = "ds-hybrid-view";
-		VertexByteCode = RetroArchHandheldShadersDsHybridViewShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersDsHybridViewShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersDsHybridViewShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersDsHybridViewShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ds_hybrid_view_refpassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("screen_toggle", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Large Screen Toggle"));
-		Params.push_back(ShaderParam("show_both_screens", -1, 36, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Show Both Small Screens"));
-		Params.push_back(ShaderParam("filter_small", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Filter Small Screens"));
-		Samplers.push_back(ShaderSampler("Source", 3));
-		Samplers.push_back(ShaderSampler("ds_hybrid_view_refpass", 2));
+	Name = "ds-hybrid-view";
+	VertexByteCode = RetroArchHandheldShadersDsHybridViewShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersDsHybridViewShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersDsHybridViewShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersDsHybridViewShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ds_hybrid_view_refpassSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("screen_toggle", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Large Screen Toggle"));
+	Params.push_back(ShaderParam("show_both_screens", -1, 36, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Show Both Small Screens"));
+	Params.push_back(ShaderParam("filter_small", -1, 40, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Filter Small Screens"));
+	Samplers.push_back(ShaderSampler("Source", 3));
+	Samplers.push_back(ShaderSampler("ds_hybrid_view_refpass", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
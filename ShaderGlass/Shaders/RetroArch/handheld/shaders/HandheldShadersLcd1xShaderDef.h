@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcd1xShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcd1xShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcd1xShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -416,32 +427,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcd1xShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcd1xShaderDef::HandheldShadersLcd1xShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcd1xShaderDef() : ShaderDef{}
-	{
-		Name = "lcd1x";
-		VertexByteCode = RetroArchHandheldShadersLcd1xShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcd1xShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcd1xShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcd1xShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BRIGHTEN_SCANLINES", -1, 0, 4, 1.000000f, 32.000000f, 16.000000f, 0.500000f, "Brighten Scanlines"));
-		Params.push_back(ShaderParam("BRIGHTEN_LCD", -1, 4, 4, 1.000000f, 12.000000f, 4.000000f, 0.100000f, "Brighten LCD"));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lcd1x";
+	VertexByteCode = RetroArchHandheldShadersLcd1xShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcd1xShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcd1xShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcd1xShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BRIGHTEN_SCANLINES", -1, 0, 4, 1.000000f, 32.000000f, 16.000000f, 0.500000f, "Brighten Scanlines"));
+	Params.push_back(ShaderParam("BRIGHTEN_LCD", -1, 4, 4, 1.000000f, 12.000000f, 4.000000f, 0.100000f, "Brighten LCD"));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
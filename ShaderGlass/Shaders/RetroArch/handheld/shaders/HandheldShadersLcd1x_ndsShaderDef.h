@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcd1x_ndsShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcd1x_ndsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcd1x_ndsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -497,32 +508,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcd1x_ndsShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcd1x_ndsShaderDef::HandheldShadersLcd1x_ndsShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcd1x_ndsShaderDef() : ShaderDef{}
-	{
-		Name = "lcd1x_nds";
-		VertexByteCode = RetroArchHandheldShadersLcd1x_ndsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcd1x_ndsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcd1x_ndsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcd1x_ndsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BRIGHTEN_SCANLINES", -1, 0, 4, 1.000000f, 32.000000f, 16.000000f, 0.500000f, "Brighten Scanlines"));
-		Params.push_back(ShaderParam("BRIGHTEN_LCD", -1, 4, 4, 1.000000f, 12.000000f, 4.000000f, 0.100000f, "Brighten LCD"));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lcd1x_nds";
+	VertexByteCode = RetroArchHandheldShadersLcd1x_ndsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcd1x_ndsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcd1x_ndsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcd1x_ndsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BRIGHTEN_SCANLINES", -1, 0, 4, 1.000000f, 32.000000f, 16.000000f, 0.500000f, "Brighten Scanlines"));
+	Params.push_back(ShaderParam("BRIGHTEN_LCD", -1, 4, 4, 1.000000f, 12.000000f, 4.000000f, 0.100000f, "Brighten LCD"));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcd3xShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcd3xShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcd3xShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -428,33 +439,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcd3xShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcd3xShaderDef::HandheldShadersLcd3xShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcd3xShaderDef() : ShaderDef{}
-	{
-		Name = "lcd3x";
-		VertexByteCode = RetroArchHandheldShadersLcd3xShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcd3xShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcd3xShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcd3xShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("brighten_scanlines", -1, 52, 4, 1.000000f, 32.000000f, 16.000000f, 0.500000f, "Brighten Scanlines"));
-		Params.push_back(ShaderParam("brighten_lcd", -1, 56, 4, 1.000000f, 12.000000f, 4.000000f, 0.100000f, "Brighten LCD"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lcd3x";
+	VertexByteCode = RetroArchHandheldShadersLcd3xShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcd3xShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcd3xShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcd3xShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("brighten_scanlines", -1, 52, 4, 1.000000f, 32.000000f, 16.000000f, 0.500000f, "Brighten Scanlines"));
+	Params.push_back(ShaderParam("brighten_lcd", -1, 56, 4, 1.000000f, 12.000000f, 4.000000f, 0.100000f, "Brighten LCD"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersRetroTilesShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersRetroTilesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersRetroTilesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -847,38 +858,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersRetroTilesShaderDef : public ShaderDef
+RetroArch::HandheldShadersRetroTilesShaderDef::HandheldShadersRetroTilesShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersRetroTilesShaderDef() : ShaderDef{}
-	{
-		Name = "retro-tiles";
-		VertexByteCode = RetroArchHandheldShadersRetroTilesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersRetroTilesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersRetroTilesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersRetroTilesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("TILE_FORMAT", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Tile Format [ Normal | Deep]"));
-		Params.push_back(ShaderParam("TILE_DEPTH", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Tile Depth"));
-		Params.push_back(ShaderParam("TILE_SIZE", -1, 60, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Tile Size"));
-		Params.push_back(ShaderParam("COLOR_BOOST", -1, 64, 4, 1.000000f, 2.000000f, 1.000000f, 0.050000f, "Color Boost"));
-		Params.push_back(ShaderParam("OVERSCAN", -1, 68, 4, -3.000000f, 3.000000f, 0.000000f, 1.000000f, "Over Scan"));
-		Params.push_back(ShaderParam("InputGamma", -1, 72, 4, 0.000000f, 4.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
-		Params.push_back(ShaderParam("OutputGamma", -1, 76, 4, 0.000000f, 3.000000f, 2.200000f, 0.100000f, "OUTPUT GAMMA"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "retro-tiles";
+	VertexByteCode = RetroArchHandheldShadersRetroTilesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersRetroTilesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersRetroTilesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersRetroTilesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("TILE_FORMAT", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Tile Format [ Normal | Deep]"));
+	Params.push_back(ShaderParam("TILE_DEPTH", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Tile Depth"));
+	Params.push_back(ShaderParam("TILE_SIZE", -1, 60, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Tile Size"));
+	Params.push_back(ShaderParam("COLOR_BOOST", -1, 64, 4, 1.000000f, 2.000000f, 1.000000f, 0.050000f, "Color Boost"));
+	Params.push_back(ShaderParam("OVERSCAN", -1, 68, 4, -3.000000f, 3.000000f, 0.000000f, 1.000000f, "Over Scan"));
+	Params.push_back(ShaderParam("InputGamma", -1, 72, 4, 0.000000f, 4.000000f, 2.400000f, 0.100000f, "INPUT GAMMA"));
+	Params.push_back(ShaderParam("OutputGamma", -1, 76, 4, 0.000000f, 3.000000f, 2.200000f, 0.100000f, "OUTPUT GAMMA"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
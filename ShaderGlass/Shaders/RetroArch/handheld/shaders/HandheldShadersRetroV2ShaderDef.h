@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersRetroV2ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersRetroV2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersRetroV2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -572,34 +583,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersRetroV2ShaderDef : public ShaderDef
+RetroArch::HandheldShadersRetroV2ShaderDef::HandheldShadersRetroV2ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersRetroV2ShaderDef() : ShaderDef{}
-	{
-		Name = "retro-v2";
-		VertexByteCode = RetroArchHandheldShadersRetroV2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersRetroV2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersRetroV2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersRetroV2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RETRO_PIXEL_SIZE", -1, 0, 4, 0.500000f, 1.000000f, 0.840000f, 0.010000f, "Retro Pixel Size"));
-		Params.push_back(ShaderParam("RETRO_COLOR_BOOST", -1, 4, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "Retro Color Boost"));
-		Params.push_back(ShaderParam("RETRO_GAMMA_IN", -1, 8, 4, 1.000000f, 3.000000f, 2.200000f, 0.050000f, "Retro Gamma In"));
-		Params.push_back(ShaderParam("RETRO_GAMMA_OUT", -1, 12, 4, 1.000000f, 3.000000f, 2.200000f, 0.050000f, "Retro Gamma LCD"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "retro-v2";
+	VertexByteCode = RetroArchHandheldShadersRetroV2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersRetroV2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersRetroV2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersRetroV2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RETRO_PIXEL_SIZE", -1, 0, 4, 0.500000f, 1.000000f, 0.840000f, 0.010000f, "Retro Pixel Size"));
+	Params.push_back(ShaderParam("RETRO_COLOR_BOOST", -1, 4, 4, 1.000000f, 2.000000f, 1.000000f, 0.010000f, "Retro Color Boost"));
+	Params.push_back(ShaderParam("RETRO_GAMMA_IN", -1, 8, 4, 1.000000f, 3.000000f, 2.200000f, 0.050000f, "Retro Gamma In"));
+	Params.push_back(ShaderParam("RETRO_GAMMA_OUT", -1, 12, 4, 1.000000f, 3.000000f, 2.200000f, 0.050000f, "Retro Gamma LCD"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
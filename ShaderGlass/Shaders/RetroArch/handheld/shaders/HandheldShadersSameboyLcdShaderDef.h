@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersSameboyLcdShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersSameboyLcdShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersSameboyLcdShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -942,33 +953,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersSameboyLcdShaderDef : public ShaderDef
+RetroArch::HandheldShadersSameboyLcdShaderDef::HandheldShadersSameboyLcdShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersSameboyLcdShaderDef() : ShaderDef{}
-	{
-		Name = "sameboy-lcd";
-		VertexByteCode = RetroArchHandheldShadersSameboyLcdShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersSameboyLcdShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersSameboyLcdShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersSameboyLcdShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("SourceSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MVP", 0, 48, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("COLOR_LOW", -1, 0, 4, 0.000000f, 1.500000f, 0.800000f, 0.050000f, "Color Low"));
-		Params.push_back(ShaderParam("COLOR_HIGH", -1, 4, 4, 0.000000f, 1.500000f, 1.000000f, 0.050000f, "Color High"));
-		Params.push_back(ShaderParam("SCANLINE_DEPTH", -1, 8, 4, 0.000000f, 2.000000f, 0.100000f, 0.050000f, "Scanline Depth"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sameboy-lcd";
+	VertexByteCode = RetroArchHandheldShadersSameboyLcdShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersSameboyLcdShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersSameboyLcdShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersSameboyLcdShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("SourceSize", 0, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MVP", 0, 48, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("COLOR_LOW", -1, 0, 4, 0.000000f, 1.500000f, 0.800000f, 0.050000f, "Color Low"));
+	Params.push_back(ShaderParam("COLOR_HIGH", -1, 4, 4, 0.000000f, 1.500000f, 1.000000f, 0.050000f, "Color High"));
+	Params.push_back(ShaderParam("SCANLINE_DEPTH", -1, 8, 4, 0.000000f, 2.000000f, 0.100000f, 0.050000f, "Scanline Depth"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
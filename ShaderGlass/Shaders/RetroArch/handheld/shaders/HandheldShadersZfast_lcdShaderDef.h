@@ -20,6 +20,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersZfast_lcdShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersZfast_lcdShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersZfast_lcdShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -480,33 +491,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersZfast_lcdShaderDef : public ShaderDef
+RetroArch::HandheldShadersZfast_lcdShaderDef::HandheldShadersZfast_lcdShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersZfast_lcdShaderDef() : ShaderDef{}
-	{
-		Name = "zfast_lcd";
-		VertexByteCode = RetroArchHandheldShadersZfast_lcdShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersZfast_lcdShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersZfast_lcdShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersZfast_lcdShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BORDERMULT", -1, 52, 4, -40.000000f, 40.000000f, 14.000000f, 1.000000f, "Border Multiplier"));
-		Params.push_back(ShaderParam("GBAGAMMA", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "GBA Gamma Hack"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "zfast_lcd";
+	VertexByteCode = RetroArchHandheldShadersZfast_lcdShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersZfast_lcdShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersZfast_lcdShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersZfast_lcdShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BORDERMULT", -1, 52, 4, -40.000000f, 40.000000f, 14.000000f, 1.000000f, "Border Multiplier"));
+	Params.push_back(ShaderParam("GBAGAMMA", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "GBA Gamma Hack"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -32,6 +32,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -5844,34 +5855,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef : public ShaderDef
+RetroArch::HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef::HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef() : ShaderDef{}
-	{
-		Name = "authentic_gbc";
-		VertexByteCode = RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AUTH_GBC_BRIG", -1, 36, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Add brightness"));
-		Params.push_back(ShaderParam("AUTH_GBC_BLUR", -1, 40, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Anti-banding smoothing"));
-		Params.push_back(ShaderParam("AUTH_GBC_SUBPX", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable subpixel rendering"));
-		Params.push_back(ShaderParam("AUTH_GBC_SUBPX_ORIENTATION", -1, 48, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Subpixel layout (0=RGB, 1=RGB vert., 2=BGR, 3=BGR vert.)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "authentic_gbc";
+	VertexByteCode = RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersAuthentic_gbcAuthentic_gbcShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AUTH_GBC_BRIG", -1, 36, 4, 0.000000f, 1.000000f, 0.600000f, 0.050000f, "Add brightness"));
+	Params.push_back(ShaderParam("AUTH_GBC_BLUR", -1, 40, 4, 0.000000f, 1.000000f, 0.300000f, 0.050000f, "Anti-banding smoothing"));
+	Params.push_back(ShaderParam("AUTH_GBC_SUBPX", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable subpixel rendering"));
+	Params.push_back(ShaderParam("AUTH_GBC_SUBPX_ORIENTATION", -1, 48, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Subpixel layout (0=RGB, 1=RGB vert., 2=BGR, 3=BGR vert.)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
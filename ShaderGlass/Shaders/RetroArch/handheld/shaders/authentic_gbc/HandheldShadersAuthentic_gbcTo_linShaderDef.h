@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersAuthentic_gbcTo_linShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersAuthentic_gbcTo_linShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -298,27 +309,21 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersAuthentic_gbcTo_linShaderDef : public ShaderDef
+RetroArch::HandheldShadersAuthentic_gbcTo_linShaderDef::HandheldShadersAuthentic_gbcTo_linShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersAuthentic_gbcTo_linShaderDef() : ShaderDef{}
-	{
-		Name = "to_lin";
-		VertexByteCode = RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "to_lin";
+	VertexByteCode = RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersAuthentic_gbcTo_linShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
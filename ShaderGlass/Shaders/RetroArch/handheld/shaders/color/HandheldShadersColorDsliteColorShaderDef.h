@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorDsliteColorShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorDsliteColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorDsliteColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -545,31 +556,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorDsliteColorShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorDsliteColorShaderDef::HandheldShadersColorDsliteColorShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorDsliteColorShaderDef() : ShaderDef{}
-	{
-		Name = "dslite-color";
-		VertexByteCode = RetroArchHandheldShadersColorDsliteColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorDsliteColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorDsliteColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorDsliteColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Color Profile (1=sRGB, 2=DCI, 3=Rec2020)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "dslite-color";
+	VertexByteCode = RetroArchHandheldShadersColorDsliteColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorDsliteColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorDsliteColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorDsliteColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Color Profile (1=sRGB, 2=DCI, 3=Rec2020)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorGbaColorShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorGbaColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorGbaColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -580,32 +591,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorGbaColorShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorGbaColorShaderDef::HandheldShadersColorGbaColorShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorGbaColorShaderDef() : ShaderDef{}
-	{
-		Name = "gba-color";
-		VertexByteCode = RetroArchHandheldShadersColorGbaColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorGbaColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorGbaColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorGbaColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Color Profile (1=sRGB, 2=DCI, 3=Rec2020)"));
-		Params.push_back(ShaderParam("darken_screen", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "External Darken Screen"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gba-color";
+	VertexByteCode = RetroArchHandheldShadersColorGbaColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorGbaColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorGbaColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorGbaColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Color Profile (1=sRGB, 2=DCI, 3=Rec2020)"));
+	Params.push_back(ShaderParam("darken_screen", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "External Darken Screen"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorGbcColorShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorGbcColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorGbcColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -579,32 +590,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorGbcColorShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorGbcColorShaderDef::HandheldShadersColorGbcColorShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorGbcColorShaderDef() : ShaderDef{}
-	{
-		Name = "gbc-color";
-		VertexByteCode = RetroArchHandheldShadersColorGbcColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorGbcColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorGbcColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorGbcColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Color Profile (1=sRGB, 2=DCI, 3=Rec2020)"));
-		Params.push_back(ShaderParam("lighten_screen", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "External Lighten Screen"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gbc-color";
+	VertexByteCode = RetroArchHandheldShadersColorGbcColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorGbcColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorGbcColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorGbcColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Color Profile (1=sRGB, 2=DCI, 3=Rec2020)"));
+	Params.push_back(ShaderParam("lighten_screen", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "External Lighten Screen"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
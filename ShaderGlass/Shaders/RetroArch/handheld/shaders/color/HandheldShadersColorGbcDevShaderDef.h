@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorGbcDevShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorGbcDevShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorGbcDevShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -383,30 +394,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorGbcDevShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorGbcDevShaderDef::HandheldShadersColorGbcDevShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorGbcDevShaderDef() : ShaderDef{}
-	{
-		Name = "gbc-dev";
-		VertexByteCode = RetroArchHandheldShadersColorGbcDevShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorGbcDevShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorGbcDevShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorGbcDevShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gbc-dev";
+	VertexByteCode = RetroArchHandheldShadersColorGbcDevShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorGbcDevShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorGbcDevShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorGbcDevShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorGbcGambatteColorShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorGbcGambatteColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorGbcGambatteColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -343,30 +354,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorGbcGambatteColorShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorGbcGambatteColorShaderDef::HandheldShadersColorGbcGambatteColorShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorGbcGambatteColorShaderDef() : ShaderDef{}
-	{
-		Name = "gbc-gambatte-color";
-		VertexByteCode = RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gbc-gambatte-color";
+	VertexByteCode = RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorGbcGambatteColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
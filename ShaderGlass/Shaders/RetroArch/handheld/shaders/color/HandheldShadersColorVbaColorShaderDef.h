@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorVbaColorShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorVbaColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorVbaColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -527,32 +538,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorVbaColorShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorVbaColorShaderDef::HandheldShadersColorVbaColorShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorVbaColorShaderDef() : ShaderDef{}
-	{
-		Name = "vba-color";
-		VertexByteCode = RetroArchHandheldShadersColorVbaColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorVbaColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorVbaColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorVbaColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Color Mode (1=Full, 2=Slightly Cold)"));
-		Params.push_back(ShaderParam("darken_screen", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Darken Screen"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "vba-color";
+	VertexByteCode = RetroArchHandheldShadersColorVbaColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorVbaColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorVbaColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorVbaColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mode", 0, 112, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "Color Mode (1=Full, 2=Slightly Cold)"));
+	Params.push_back(ShaderParam("darken_screen", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Darken Screen"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutDsliteGreyTextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutDsliteGreyTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutDsliteGreyTextureDefs
 {
 const BYTE sData[] =
@@ -175,13 +183,10 @@ const BYTE sData[] =
 ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,219,222,1,13,88,67,250,165,151,74,18,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutDsliteGreyTextureDef : public TextureDef
+HandheldShadersColorLutDsliteGreyTextureDef::HandheldShadersColorLutDsliteGreyTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutDsliteGreyTextureDef() : TextureDef{}
-	{
-		Name = "dslite-grey.png";
-		Data = HandheldShadersColorLutDsliteGreyTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutDsliteGreyTextureDefs::sData);
-	}
-};
+	Name = "dslite-grey.png";
+	Data = HandheldShadersColorLutDsliteGreyTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutDsliteGreyTextureDefs::sData);
+}
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorLutGBALUTShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorLutGBALUTShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorLutGBALUTShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -628,35 +639,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorLutGBALUTShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorLutGBALUTShaderDef::HandheldShadersColorLutGBALUTShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorLutGBALUTShaderDef() : ShaderDef{}
-	{
-		Name = "GBA-LUT";
-		VertexByteCode = RetroArchHandheldShadersColorLutGBALUTShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorLutGBALUTShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorLutGBALUTShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorLutGBALUTShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT Selector"));
-		Params.push_back(ShaderParam("darken_gamma", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "GBA Darken Screen"));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "GBA-LUT";
+	VertexByteCode = RetroArchHandheldShadersColorLutGBALUTShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorLutGBALUTShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorLutGBALUTShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorLutGBALUTShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT Selector"));
+	Params.push_back(ShaderParam("darken_gamma", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "GBA Darken Screen"));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
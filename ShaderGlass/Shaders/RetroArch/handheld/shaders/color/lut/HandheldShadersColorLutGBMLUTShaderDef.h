@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersColorLutGBMLUTShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersColorLutGBMLUTShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersColorLutGBMLUTShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -622,35 +633,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersColorLutGBMLUTShaderDef : public ShaderDef
+RetroArch::HandheldShadersColorLutGBMLUTShaderDef::HandheldShadersColorLutGBMLUTShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersColorLutGBMLUTShaderDef() : ShaderDef{}
-	{
-		Name = "GBM-LUT";
-		VertexByteCode = RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT Selector"));
-		Params.push_back(ShaderParam("adjust_gamma", -1, 56, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Adjust Gamma"));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "GBM-LUT";
+	VertexByteCode = RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersColorLutGBMLUTShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT Selector"));
+	Params.push_back(ShaderParam("adjust_gamma", -1, 56, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Adjust Gamma"));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
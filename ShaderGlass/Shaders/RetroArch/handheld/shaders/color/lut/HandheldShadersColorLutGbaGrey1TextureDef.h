@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutGbaGrey1TextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutGbaGrey1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutGbaGrey1TextureDefs
 {
 const BYTE sData[] =
@@ -174,13 +182,10 @@ const BYTE sData[] =
 ,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutGbaGrey1TextureDef : public TextureDef
+HandheldShadersColorLutGbaGrey1TextureDef::HandheldShadersColorLutGbaGrey1TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutGbaGrey1TextureDef() : TextureDef{}
-	{
-		Name = "gba-grey1.png";
-		Data = HandheldShadersColorLutGbaGrey1TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutGbaGrey1TextureDefs::sData);
-	}
-};
+	Name = "gba-grey1.png";
+	Data = HandheldShadersColorLutGbaGrey1TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutGbaGrey1TextureDefs::sData);
+}
+#endif
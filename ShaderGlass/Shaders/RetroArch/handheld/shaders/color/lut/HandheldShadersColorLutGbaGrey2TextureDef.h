@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutGbaGrey2TextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutGbaGrey2TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutGbaGrey2TextureDefs
 {
 const BYTE sData[] =
@@ -176,13 +184,10 @@ const BYTE sData[] =
 ,0,192,180,63,162,207,67,250,41,208,241,206,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutGbaGrey2TextureDef : public TextureDef
+HandheldShadersColorLutGbaGrey2TextureDef::HandheldShadersColorLutGbaGrey2TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutGbaGrey2TextureDef() : TextureDef{}
-	{
-		Name = "gba-grey2.png";
-		Data = HandheldShadersColorLutGbaGrey2TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutGbaGrey2TextureDefs::sData);
-	}
-};
+	Name = "gba-grey2.png";
+	Data = HandheldShadersColorLutGbaGrey2TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutGbaGrey2TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutGbamicroGreyTextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutGbamicroGreyTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutGbamicroGreyTextureDefs
 {
 const BYTE sData[] =
@@ -173,13 +181,10 @@ const BYTE sData[] =
 ,0,0,0,0,0,0,0,0,0,0,0,0,0,211,62,1,36,176,67,250,223,39,253,247,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutGbamicroGreyTextureDef : public TextureDef
+HandheldShadersColorLutGbamicroGreyTextureDef::HandheldShadersColorLutGbamicroGreyTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutGbamicroGreyTextureDef() : TextureDef{}
-	{
-		Name = "gbamicro-grey.png";
-		Data = HandheldShadersColorLutGbamicroGreyTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutGbamicroGreyTextureDefs::sData);
-	}
-};
+	Name = "gbamicro-grey.png";
+	Data = HandheldShadersColorLutGbamicroGreyTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutGbamicroGreyTextureDefs::sData);
+}
+#endif
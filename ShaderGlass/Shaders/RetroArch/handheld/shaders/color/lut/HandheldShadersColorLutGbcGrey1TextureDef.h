@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutGbcGrey1TextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutGbcGrey1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutGbcGrey1TextureDefs
 {
 const BYTE sData[] =
@@ -176,13 +184,10 @@ const BYTE sData[] =
 ,192,39,241,224,67,250,26,99,221,182,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutGbcGrey1TextureDef : public TextureDef
+HandheldShadersColorLutGbcGrey1TextureDef::HandheldShadersColorLutGbcGrey1TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutGbcGrey1TextureDef() : TextureDef{}
-	{
-		Name = "gbc-grey1.png";
-		Data = HandheldShadersColorLutGbcGrey1TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutGbcGrey1TextureDefs::sData);
-	}
-};
+	Name = "gbc-grey1.png";
+	Data = HandheldShadersColorLutGbcGrey1TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutGbcGrey1TextureDefs::sData);
+}
+#endif
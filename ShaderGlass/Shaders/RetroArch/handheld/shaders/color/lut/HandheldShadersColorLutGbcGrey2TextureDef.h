@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutGbcGrey2TextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutGbcGrey2TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutGbcGrey2TextureDefs
 {
 const BYTE sData[] =
@@ -176,13 +184,10 @@ const BYTE sData[] =
 ,0,0,0,0,0,0,0,0,24,224,27,114,195,67,250,221,72,207,235,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutGbcGrey2TextureDef : public TextureDef
+HandheldShadersColorLutGbcGrey2TextureDef::HandheldShadersColorLutGbcGrey2TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutGbcGrey2TextureDef() : TextureDef{}
-	{
-		Name = "gbc-grey2.png";
-		Data = HandheldShadersColorLutGbcGrey2TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutGbcGrey2TextureDefs::sData);
-	}
-};
+	Name = "gbc-grey2.png";
+	Data = HandheldShadersColorLutGbcGrey2TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutGbcGrey2TextureDefs::sData);
+}
+#endif
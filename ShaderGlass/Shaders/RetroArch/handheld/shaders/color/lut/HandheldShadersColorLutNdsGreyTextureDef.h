@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutNdsGreyTextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutNdsGreyTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutNdsGreyTextureDefs
 {
 const BYTE sData[] =
@@ -174,13 +182,10 @@ const BYTE sData[] =
 ,0,0,96,237,27,70,224,67,250,105,103,110,185,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutNdsGreyTextureDef : public TextureDef
+HandheldShadersColorLutNdsGreyTextureDef::HandheldShadersColorLutNdsGreyTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutNdsGreyTextureDef() : TextureDef{}
-	{
-		Name = "nds-grey.png";
-		Data = HandheldShadersColorLutNdsGreyTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutNdsGreyTextureDefs::sData);
-	}
-};
+	Name = "nds-grey.png";
+	Data = HandheldShadersColorLutNdsGreyTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutNdsGreyTextureDefs::sData);
+}
+#endif
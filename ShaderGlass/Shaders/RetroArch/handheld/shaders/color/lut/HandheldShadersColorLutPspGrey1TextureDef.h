@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutPspGrey1TextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutPspGrey1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutPspGrey1TextureDefs
 {
 const BYTE sData[] =
@@ -176,13 +184,10 @@ const BYTE sData[] =
 ,164,157,67,250,253,146,28,205,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutPspGrey1TextureDef : public TextureDef
+HandheldShadersColorLutPspGrey1TextureDef::HandheldShadersColorLutPspGrey1TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutPspGrey1TextureDef() : TextureDef{}
-	{
-		Name = "psp-grey1.png";
-		Data = HandheldShadersColorLutPspGrey1TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutPspGrey1TextureDefs::sData);
-	}
-};
+	Name = "psp-grey1.png";
+	Data = HandheldShadersColorLutPspGrey1TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutPspGrey1TextureDefs::sData);
+}
+#endif
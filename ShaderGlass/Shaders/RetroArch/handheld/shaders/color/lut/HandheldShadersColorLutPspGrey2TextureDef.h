@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutPspGrey2TextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutPspGrey2TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutPspGrey2TextureDefs
 {
 const BYTE sData[] =
@@ -175,13 +183,10 @@ const BYTE sData[] =
 ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,192,15,126,45,67,250,250,11,242,187,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutPspGrey2TextureDef : public TextureDef
+HandheldShadersColorLutPspGrey2TextureDef::HandheldShadersColorLutPspGrey2TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutPspGrey2TextureDef() : TextureDef{}
-	{
-		Name = "psp-grey2.png";
-		Data = HandheldShadersColorLutPspGrey2TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutPspGrey2TextureDefs::sData);
-	}
-};
+	Name = "psp-grey2.png";
+	Data = HandheldShadersColorLutPspGrey2TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutPspGrey2TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersColorLutSp101GreyTextureDef : public TextureDef
+{
+public:
+	HandheldShadersColorLutSp101GreyTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersColorLutSp101GreyTextureDefs
 {
 const BYTE sData[] =
@@ -174,13 +182,10 @@ const BYTE sData[] =
 ,250,61,153,80,87,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersColorLutSp101GreyTextureDef : public TextureDef
+HandheldShadersColorLutSp101GreyTextureDef::HandheldShadersColorLutSp101GreyTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersColorLutSp101GreyTextureDef() : TextureDef{}
-	{
-		Name = "sp101-grey.png";
-		Data = HandheldShadersColorLutSp101GreyTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersColorLutSp101GreyTextureDefs::sData);
-	}
-};
+	Name = "sp101-grey.png";
+	Data = HandheldShadersColorLutSp101GreyTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersColorLutSp101GreyTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesBackgroundTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesBackgroundTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesBackgroundTextureDefs
 {
 const BYTE sData[] =
@@ -7962,13 +7970,10 @@ const BYTE sData[] =
 ,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesBackgroundTextureDef : public TextureDef
+HandheldShadersGameboyResourcesBackgroundTextureDef::HandheldShadersGameboyResourcesBackgroundTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesBackgroundTextureDef() : TextureDef{}
-	{
-		Name = "background.png";
-		Data = HandheldShadersGameboyResourcesBackgroundTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesBackgroundTextureDefs::sData);
-	}
-};
+	Name = "background.png";
+	Data = HandheldShadersGameboyResourcesBackgroundTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesBackgroundTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesPaletteTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesPaletteTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesPaletteTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,254,16,194,179,25,208,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesPaletteTextureDef : public TextureDef
+HandheldShadersGameboyResourcesPaletteTextureDef::HandheldShadersGameboyResourcesPaletteTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesPaletteTextureDef() : TextureDef{}
-	{
-		Name = "palette.png";
-		Data = HandheldShadersGameboyResourcesPaletteTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesPaletteTextureDefs::sData);
-	}
-};
+	Name = "palette.png";
+	Data = HandheldShadersGameboyResourcesPaletteTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesPaletteTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDefs
 {
 const BYTE sData[] =
@@ -6090,13 +6098,10 @@ const BYTE sData[] =
 ,3,102,192,12,152,71,97,254,255,221,59,215,239,173,201,14,0,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef : public TextureDef
+HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef::HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef() : TextureDef{}
-	{
-		Name = "paper-bg.png";
-		Data = HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDefs::sData);
-	}
-};
+	Name = "paper-bg.png";
+	Data = HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDefs::sData);
+}
+#endif
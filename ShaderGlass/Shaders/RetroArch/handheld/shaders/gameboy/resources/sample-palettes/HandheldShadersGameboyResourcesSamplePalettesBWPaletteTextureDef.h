@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef : public TextureDef
+HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef::HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef() : TextureDef{}
-	{
-		Name = "b-w-palette.png";
-		Data = HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDefs::sData);
-	}
-};
+	Name = "b-w-palette.png";
+	Data = HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDefs::sData);
+}
+#endif
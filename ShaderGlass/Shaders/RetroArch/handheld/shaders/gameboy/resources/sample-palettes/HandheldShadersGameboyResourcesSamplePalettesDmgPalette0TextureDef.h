@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,254,16,194,179,25,208,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef : public TextureDef
+HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef::HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef() : TextureDef{}
-	{
-		Name = "dmg-palette-0.png";
-		Data = HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDefs::sData);
-	}
-};
+	Name = "dmg-palette-0.png";
+	Data = HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDefs::sData);
+}
+#endif
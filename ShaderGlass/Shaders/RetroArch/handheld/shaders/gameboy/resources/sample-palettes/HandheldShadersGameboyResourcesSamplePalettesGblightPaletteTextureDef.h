@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,254,16,194,179,25,208,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef : public TextureDef
+HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef::HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef() : TextureDef{}
-	{
-		Name = "gblight-palette.png";
-		Data = HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDefs::sData);
-	}
-};
+	Name = "gblight-palette.png";
+	Data = HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDefs
 {
 const BYTE sData[] =
@@ -39,13 +47,10 @@ const BYTE sData[] =
 ,4,4,4,4,4,4,4,214,129,23,96,0,47,124,16,1,105,199,230,59,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef : public TextureDef
+HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef::HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef() : TextureDef{}
-	{
-		Name = "gbp-palette-high-contrast.png";
-		Data = HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDefs::sData);
-	}
-};
+	Name = "gbp-palette-high-contrast.png";
+	Data = HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDefs::sData);
+}
+#endif
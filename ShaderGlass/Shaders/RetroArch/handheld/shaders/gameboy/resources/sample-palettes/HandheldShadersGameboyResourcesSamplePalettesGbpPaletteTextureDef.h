@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,254,16,194,179,25,208,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef : public TextureDef
+HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef::HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef() : TextureDef{}
-	{
-		Name = "gbp-palette.png";
-		Data = HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDefs::sData);
-	}
-};
+	Name = "gbp-palette.png";
+	Data = HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDefs::sData);
+}
+#endif
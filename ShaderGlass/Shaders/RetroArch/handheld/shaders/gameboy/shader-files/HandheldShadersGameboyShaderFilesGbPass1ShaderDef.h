@@ -52,6 +52,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersGameboyShaderFilesGbPass1ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersGameboyShaderFilesGbPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -759,32 +770,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersGameboyShaderFilesGbPass1ShaderDef : public ShaderDef
+RetroArch::HandheldShadersGameboyShaderFilesGbPass1ShaderDef::HandheldShadersGameboyShaderFilesGbPass1ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersGameboyShaderFilesGbPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "gb-pass1";
-		VertexByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("blending_mode", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Blending Mode"));
-		Params.push_back(ShaderParam("adjacent_texel_alpha_blending", -1, 52, 4, 0.000000f, 1.000000f, 0.175500f, 0.050000f, "Neighbor Blending"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gb-pass1";
+	VertexByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("blending_mode", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Blending Mode"));
+	Params.push_back(ShaderParam("adjacent_texel_alpha_blending", -1, 52, 4, 0.000000f, 1.000000f, 0.175500f, 0.050000f, "Neighbor Blending"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
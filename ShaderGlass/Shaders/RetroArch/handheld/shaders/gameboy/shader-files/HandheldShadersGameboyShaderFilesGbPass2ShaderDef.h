@@ -33,6 +33,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersGameboyShaderFilesGbPass2ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersGameboyShaderFilesGbPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -538,30 +549,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersGameboyShaderFilesGbPass2ShaderDef : public ShaderDef
+RetroArch::HandheldShadersGameboyShaderFilesGbPass2ShaderDef::HandheldShadersGameboyShaderFilesGbPass2ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersGameboyShaderFilesGbPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "gb-pass2";
-		VertexByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gb-pass2";
+	VertexByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
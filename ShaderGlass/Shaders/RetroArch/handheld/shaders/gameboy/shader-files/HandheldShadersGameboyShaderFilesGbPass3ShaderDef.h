@@ -33,6 +33,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersGameboyShaderFilesGbPass3ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersGameboyShaderFilesGbPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -538,30 +549,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersGameboyShaderFilesGbPass3ShaderDef : public ShaderDef
+RetroArch::HandheldShadersGameboyShaderFilesGbPass3ShaderDef::HandheldShadersGameboyShaderFilesGbPass3ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersGameboyShaderFilesGbPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "gb-pass3";
-		VertexByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "gb-pass3";
+	VertexByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersGameboyShaderFilesGbPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersGbPaletteGbPaletteShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersGbPaletteGbPaletteShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -339,32 +350,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersGbPaletteGbPaletteShaderDef : public ShaderDef
+RetroArch::HandheldShadersGbPaletteGbPaletteShaderDef::HandheldShadersGbPaletteGbPaletteShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersGbPaletteGbPaletteShaderDef() : ShaderDef{}
-	{
-		Name = "gb-palette";
-		VertexByteCode = RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("COLOR_PALETTE", 3));
+	Name = "gb-palette";
+	VertexByteCode = RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersGbPaletteGbPaletteShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("COLOR_PALETTE", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGbPaletteResourcesPaletteDmgTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGbPaletteResourcesPaletteDmgTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGbPaletteResourcesPaletteDmgTextureDefs
 {
 const BYTE sData[] =
@@ -16,13 +24,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class HandheldShadersGbPaletteResourcesPaletteDmgTextureDef : public TextureDef
+HandheldShadersGbPaletteResourcesPaletteDmgTextureDef::HandheldShadersGbPaletteResourcesPaletteDmgTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGbPaletteResourcesPaletteDmgTextureDef() : TextureDef{}
-	{
-		Name = "palette-dmg.png";
-		Data = HandheldShadersGbPaletteResourcesPaletteDmgTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGbPaletteResourcesPaletteDmgTextureDefs::sData);
-	}
-};
+	Name = "palette-dmg.png";
+	Data = HandheldShadersGbPaletteResourcesPaletteDmgTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGbPaletteResourcesPaletteDmgTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGbPaletteResourcesPaletteLightTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGbPaletteResourcesPaletteLightTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGbPaletteResourcesPaletteLightTextureDefs
 {
 const BYTE sData[] =
@@ -16,13 +24,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class HandheldShadersGbPaletteResourcesPaletteLightTextureDef : public TextureDef
+HandheldShadersGbPaletteResourcesPaletteLightTextureDef::HandheldShadersGbPaletteResourcesPaletteLightTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGbPaletteResourcesPaletteLightTextureDef() : TextureDef{}
-	{
-		Name = "palette-light.png";
-		Data = HandheldShadersGbPaletteResourcesPaletteLightTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGbPaletteResourcesPaletteLightTextureDefs::sData);
-	}
-};
+	Name = "palette-light.png";
+	Data = HandheldShadersGbPaletteResourcesPaletteLightTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGbPaletteResourcesPaletteLightTextureDefs::sData);
+}
+#endif
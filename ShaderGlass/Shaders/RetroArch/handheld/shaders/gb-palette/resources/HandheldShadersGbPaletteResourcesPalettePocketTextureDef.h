@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersGbPaletteResourcesPalettePocketTextureDef : public TextureDef
+{
+public:
+	HandheldShadersGbPaletteResourcesPalettePocketTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersGbPaletteResourcesPalettePocketTextureDefs
 {
 const BYTE sData[] =
@@ -16,13 +24,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class HandheldShadersGbPaletteResourcesPalettePocketTextureDef : public TextureDef
+HandheldShadersGbPaletteResourcesPalettePocketTextureDef::HandheldShadersGbPaletteResourcesPalettePocketTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersGbPaletteResourcesPalettePocketTextureDef() : TextureDef{}
-	{
-		Name = "palette-pocket.png";
-		Data = HandheldShadersGbPaletteResourcesPalettePocketTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersGbPaletteResourcesPalettePocketTextureDefs::sData);
-	}
-};
+	Name = "palette-pocket.png";
+	Data = HandheldShadersGbPaletteResourcesPalettePocketTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersGbPaletteResourcesPalettePocketTextureDefs::sData);
+}
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcdCgwgLcdGridShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcdCgwgLcdGridShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1432,32 +1443,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcdCgwgLcdGridShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcdCgwgLcdGridShaderDef::HandheldShadersLcdCgwgLcdGridShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcdCgwgLcdGridShaderDef() : ShaderDef{}
-	{
-		Name = "lcd-grid";
-		VertexByteCode = RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GRID_STRENGTH", 0, 112, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "LCD Grid Strength"));
-		Params.push_back(ShaderParam("gamma", 0, 116, 4, 1.000000f, 5.000000f, 2.200000f, 0.100000f, "LCD Input Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lcd-grid";
+	VertexByteCode = RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcdCgwgLcdGridShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GRID_STRENGTH", 0, 112, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "LCD Grid Strength"));
+	Params.push_back(ShaderParam("gamma", 0, 116, 4, 1.000000f, 5.000000f, 2.200000f, 0.100000f, "LCD Input Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersLcdShaderBackgroundTextureDef : public TextureDef
+{
+public:
+	HandheldShadersLcdShaderBackgroundTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersLcdShaderBackgroundTextureDefs
 {
 const BYTE sData[] =
@@ -18,13 +26,10 @@ const BYTE sData[] =
 ,189,1,4,30,0,1,109,13,52,190,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class HandheldShadersLcdShaderBackgroundTextureDef : public TextureDef
+HandheldShadersLcdShaderBackgroundTextureDef::HandheldShadersLcdShaderBackgroundTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersLcdShaderBackgroundTextureDef() : TextureDef{}
-	{
-		Name = "background.png";
-		Data = HandheldShadersLcdShaderBackgroundTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersLcdShaderBackgroundTextureDefs::sData);
-	}
-};
+	Name = "background.png";
+	Data = HandheldShadersLcdShaderBackgroundTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersLcdShaderBackgroundTextureDefs::sData);
+}
+#endif
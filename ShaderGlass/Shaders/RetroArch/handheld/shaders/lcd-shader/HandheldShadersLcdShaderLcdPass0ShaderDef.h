@@ -49,6 +49,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcdShaderLcdPass0ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcdShaderLcdPass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -900,39 +911,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcdShaderLcdPass0ShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcdShaderLcdPass0ShaderDef::HandheldShadersLcdShaderLcdPass0ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcdShaderLcdPass0ShaderDef() : ShaderDef{}
-	{
-		Name = "lcd-pass-0";
-		VertexByteCode = RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("response_time", -1, 52, 4, 0.000000f, 0.777000f, 0.333000f, 0.111000f, "LCD Response Time"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
-		Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
-		Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
-		Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
-		Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
+	Name = "lcd-pass-0";
+	VertexByteCode = RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("response_time", -1, 52, 4, 0.000000f, 0.777000f, 0.333000f, 0.111000f, "LCD Response Time"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
+	Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
+	Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
+	Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
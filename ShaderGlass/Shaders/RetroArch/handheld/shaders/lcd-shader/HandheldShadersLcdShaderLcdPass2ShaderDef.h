@@ -45,6 +45,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcdShaderLcdPass2ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcdShaderLcdPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -560,37 +571,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcdShaderLcdPass2ShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcdShaderLcdPass2ShaderDef::HandheldShadersLcdShaderLcdPass2ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcdShaderLcdPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "lcd-pass-2";
-		VertexByteCode = RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LCD_to_input_ratio", -1, 52, 4, 0.000000f, 1.000000f, 0.900000f, 0.010000f, "LCD to Input Ratio"));
-		Params.push_back(ShaderParam("bg_tint_r", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "LCD Background Tint (Red)"));
-		Params.push_back(ShaderParam("bg_tint_g", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "LCD Background Tint (Green)"));
-		Params.push_back(ShaderParam("bg_tint_b", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "LCD Background Tint (Blue)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PASS1", 3));
-		Samplers.push_back(ShaderSampler("BACKGROUND", 4));
+	Name = "lcd-pass-2";
+	VertexByteCode = RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LCD_to_input_ratio", -1, 52, 4, 0.000000f, 1.000000f, 0.900000f, 0.010000f, "LCD to Input Ratio"));
+	Params.push_back(ShaderParam("bg_tint_r", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "LCD Background Tint (Red)"));
+	Params.push_back(ShaderParam("bg_tint_g", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "LCD Background Tint (Green)"));
+	Params.push_back(ShaderParam("bg_tint_b", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "LCD Background Tint (Blue)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PASS1", 3));
+	Samplers.push_back(ShaderSampler("BACKGROUND", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -58,6 +58,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersLcdShaderLcdPass3ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersLcdShaderLcdPass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -758,34 +769,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersLcdShaderLcdPass3ShaderDef : public ShaderDef
+RetroArch::HandheldShadersLcdShaderLcdPass3ShaderDef::HandheldShadersLcdShaderLcdPass3ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersLcdShaderLcdPass3ShaderDef() : ShaderDef{}
-	{
-		Name = "lcd-pass-3";
-		VertexByteCode = RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LCD_blending", -1, 52, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "LCD Blending"));
-		Params.push_back(ShaderParam("original_blending", -1, 56, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Original Blending"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PASS1", 3));
+	Name = "lcd-pass-3";
+	VertexByteCode = RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersLcdShaderLcdPass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LCD_blending", -1, 52, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "LCD Blending"));
+	Params.push_back(ShaderParam("original_blending", -1, 56, 4, 0.000000f, 0.500000f, 0.200000f, 0.010000f, "Original Blending"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PASS1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersMgbaAgb001ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersMgbaAgb001ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersMgbaAgb001ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -512,30 +523,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersMgbaAgb001ShaderDef : public ShaderDef
+RetroArch::HandheldShadersMgbaAgb001ShaderDef::HandheldShadersMgbaAgb001ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersMgbaAgb001ShaderDef() : ShaderDef{}
-	{
-		Name = "agb001";
-		VertexByteCode = RetroArchHandheldShadersMgbaAgb001ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersMgbaAgb001ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersMgbaAgb001ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersMgbaAgb001ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "agb001";
+	VertexByteCode = RetroArchHandheldShadersMgbaAgb001ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersMgbaAgb001ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersMgbaAgb001ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersMgbaAgb001ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersMgbaAgs001LightShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersMgbaAgs001LightShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersMgbaAgs001LightShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -496,34 +507,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersMgbaAgs001LightShaderDef : public ShaderDef
+RetroArch::HandheldShadersMgbaAgs001LightShaderDef::HandheldShadersMgbaAgs001LightShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersMgbaAgs001LightShaderDef() : ShaderDef{}
-	{
-		Name = "ags001-light";
-		VertexByteCode = RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("reflectionBrightness", -1, 0, 4, 0.000000f, 1.000000f, 0.070000f, 0.010000f, "Reflection brightness"));
-		Params.push_back(ShaderParam("reflectionDistanceX", -1, 4, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Reflection Distance X"));
-		Params.push_back(ShaderParam("reflectionDistanceY", -1, 8, 4, -1.000000f, 1.000000f, 0.025000f, 0.005000f, "Reflection Distance Y"));
-		Params.push_back(ShaderParam("lightBrightness", -1, 12, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Light brightness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ags001-light";
+	VertexByteCode = RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersMgbaAgs001LightShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("reflectionBrightness", -1, 0, 4, 0.000000f, 1.000000f, 0.070000f, 0.010000f, "Reflection brightness"));
+	Params.push_back(ShaderParam("reflectionDistanceX", -1, 4, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Reflection Distance X"));
+	Params.push_back(ShaderParam("reflectionDistanceY", -1, 8, 4, -1.000000f, 1.000000f, 0.025000f, 0.005000f, "Reflection Distance Y"));
+	Params.push_back(ShaderParam("lightBrightness", -1, 12, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Light brightness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersMgbaAgs001ShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersMgbaAgs001ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersMgbaAgs001ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -498,30 +509,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersMgbaAgs001ShaderDef : public ShaderDef
+RetroArch::HandheldShadersMgbaAgs001ShaderDef::HandheldShadersMgbaAgs001ShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersMgbaAgs001ShaderDef() : ShaderDef{}
-	{
-		Name = "ags001";
-		VertexByteCode = RetroArchHandheldShadersMgbaAgs001ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersMgbaAgs001ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersMgbaAgs001ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersMgbaAgs001ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ags001";
+	VertexByteCode = RetroArchHandheldShadersMgbaAgs001ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersMgbaAgs001ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersMgbaAgs001ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersMgbaAgs001ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
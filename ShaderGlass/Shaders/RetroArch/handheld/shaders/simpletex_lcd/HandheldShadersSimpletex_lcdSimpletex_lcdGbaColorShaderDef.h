@@ -58,6 +58,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef : public ShaderDef
+{
+public:
+	HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -724,37 +735,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef : public ShaderDef
+RetroArch::HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef::HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef() : ShaderDef{}
 {
-public:
-	HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef() : ShaderDef{}
-	{
-		Name = "simpletex_lcd+gba-color";
-		VertexByteCode = RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GRID_INTENSITY", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Grid Intensity"));
-		Params.push_back(ShaderParam("GRID_WIDTH", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Grid Width"));
-		Params.push_back(ShaderParam("GRID_BIAS", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Grid Bias"));
-		Params.push_back(ShaderParam("DARKEN_GRID", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Darken Grid"));
-		Params.push_back(ShaderParam("DARKEN_COLOUR", -1, 16, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Darken Colours"));
-		Params.push_back(ShaderParam("BACKGROUND_INTENSITY", -1, 20, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Background Intensity"));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("BACKGROUND", 3));
+	Name = "simpletex_lcd+gba-color";
+	VertexByteCode = RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GRID_INTENSITY", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Grid Intensity"));
+	Params.push_back(ShaderParam("GRID_WIDTH", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Grid Width"));
+	Params.push_back(ShaderParam("GRID_BIAS", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Grid Bias"));
+	Params.push_back(ShaderParam("DARKEN_GRID", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Darken Grid"));
+	Params.push_back(ShaderParam("DARKEN_COLOUR", -1, 16, 4, 0.000000f, 2.000000f, 0.000000f, 0.050000f, "Darken Colours"));
+	Params.push_back(ShaderParam("BACKGROUND_INTENSITY", -1, 20, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Background Intensity"));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 48, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("BACKGROUND", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
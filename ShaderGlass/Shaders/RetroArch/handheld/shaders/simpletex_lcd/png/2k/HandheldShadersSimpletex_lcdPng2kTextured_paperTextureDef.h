@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef : public TextureDef
+{
+public:
+	HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDefs
 {
 const BYTE sData[] =
@@ -14341,13 +14349,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef : public TextureDef
+HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef::HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef() : TextureDef{}
 {
-public:
-	HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef() : TextureDef{}
-	{
-		Name = "textured_paper.png";
-		Data = HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDefs::sData;
-		DataLength = sizeof(HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDefs::sData);
-	}
-};
+	Name = "textured_paper.png";
+	Data = HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDefs::sData;
+	DataLength = sizeof(HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDefs::sData);
+}
+#endif
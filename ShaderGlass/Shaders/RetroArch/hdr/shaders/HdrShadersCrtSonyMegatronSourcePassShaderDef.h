@@ -21,6 +21,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class HdrShadersCrtSonyMegatronSourcePassShaderDef : public ShaderDef
+{
+public:
+	HdrShadersCrtSonyMegatronSourcePassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1247,48 +1258,42 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class HdrShadersCrtSonyMegatronSourcePassShaderDef : public ShaderDef
+RetroArch::HdrShadersCrtSonyMegatronSourcePassShaderDef::HdrShadersCrtSonyMegatronSourcePassShaderDef() : ShaderDef{}
 {
-public:
-	HdrShadersCrtSonyMegatronSourcePassShaderDef() : ShaderDef{}
-	{
-		Name = "crt-sony-megatron-source-pass";
-		VertexByteCode = RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode);
-		Format = "R16G16B16A16_SFLOAT";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hcrt_hdr", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "SDR | HDR"));
-		Params.push_back(ShaderParam("hcrt_colour_space", -1, 4, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "SDR: Display's Colour Space: r709 | sRGB | DCI-P3"));
-		Params.push_back(ShaderParam("hcrt_max_nits", -1, 8, 4, 0.000000f, 10000.000000f, 1000.000000f, 10.000000f, "HDR: Display's Peak Luminance"));
-		Params.push_back(ShaderParam("hcrt_paper_white_nits", -1, 12, 4, 0.000000f, 10000.000000f, 200.000000f, 10.000000f, "HDR: Display's Paper White Luminance"));
-		Params.push_back(ShaderParam("hcrt_lcd_resolution", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Display's Resolution: 1080p | 4K | 8K"));
-		Params.push_back(ShaderParam("hcrt_lcd_subpixel", -1, 20, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Display's Subpixel Layout: RGB | RWBG (OLED) | BGR"));
-		Params.push_back(ShaderParam("hcrt_colour_system", -1, 24, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Colour System: r709 | PAL | NTSC-U | NTSC-J"));
-		Params.push_back(ShaderParam("hcrt_phosphor_set", -1, 28, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Phosphors: NONE | P22-J | P22-80 | P22-90 | RPTV | 1953"));
-		Params.push_back(ShaderParam("hcrt_expand_gamut", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HDR: Original/Vivid"));
-		Params.push_back(ShaderParam("hcrt_white_temperature_D65", -1, 36, 4, 0.000000f, 18500.000000f, 6504.000000f, 100.000000f, "D65 White Temperature (Kelvin)"));
-		Params.push_back(ShaderParam("hcrt_white_temperature_D93", -1, 40, 4, 0.000000f, 18500.000000f, 9305.000000f, 100.000000f, "D93 White Temperature (Kelvin)"));
-		Params.push_back(ShaderParam("hcrt_brightness", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("hcrt_contrast", -1, 48, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Contrast"));
-		Params.push_back(ShaderParam("hcrt_saturation", -1, 52, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("hcrt_gamma_in", -1, 56, 4, 1.000000f, 5.000000f, 2.220000f, 0.010000f, "Gamma"));
-		Params.push_back(ShaderParam("hcrt_gamma_cutoff", -1, 60, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "Inverse Gamma Cutoff (x1000)"));
-		Params.push_back(ShaderParam("hcrt_colour_accurate", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Accurate/Colour Accurate"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-sony-megatron-source-pass";
+	VertexByteCode = RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchHdrShadersCrtSonyMegatronSourcePassShaderDefs::sFragmentByteCode);
+	Format = "R16G16B16A16_SFLOAT";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hcrt_hdr", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "SDR | HDR"));
+	Params.push_back(ShaderParam("hcrt_colour_space", -1, 4, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "SDR: Display's Colour Space: r709 | sRGB | DCI-P3"));
+	Params.push_back(ShaderParam("hcrt_max_nits", -1, 8, 4, 0.000000f, 10000.000000f, 1000.000000f, 10.000000f, "HDR: Display's Peak Luminance"));
+	Params.push_back(ShaderParam("hcrt_paper_white_nits", -1, 12, 4, 0.000000f, 10000.000000f, 200.000000f, 10.000000f, "HDR: Display's Paper White Luminance"));
+	Params.push_back(ShaderParam("hcrt_lcd_resolution", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "Display's Resolution: 1080p | 4K | 8K"));
+	Params.push_back(ShaderParam("hcrt_lcd_subpixel", -1, 20, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Display's Subpixel Layout: RGB | RWBG (OLED) | BGR"));
+	Params.push_back(ShaderParam("hcrt_colour_system", -1, 24, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "Colour System: r709 | PAL | NTSC-U | NTSC-J"));
+	Params.push_back(ShaderParam("hcrt_phosphor_set", -1, 28, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Phosphors: NONE | P22-J | P22-80 | P22-90 | RPTV | 1953"));
+	Params.push_back(ShaderParam("hcrt_expand_gamut", -1, 32, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "HDR: Original/Vivid"));
+	Params.push_back(ShaderParam("hcrt_white_temperature_D65", -1, 36, 4, 0.000000f, 18500.000000f, 6504.000000f, 100.000000f, "D65 White Temperature (Kelvin)"));
+	Params.push_back(ShaderParam("hcrt_white_temperature_D93", -1, 40, 4, 0.000000f, 18500.000000f, 9305.000000f, 100.000000f, "D93 White Temperature (Kelvin)"));
+	Params.push_back(ShaderParam("hcrt_brightness", -1, 44, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("hcrt_contrast", -1, 48, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Contrast"));
+	Params.push_back(ShaderParam("hcrt_saturation", -1, 52, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("hcrt_gamma_in", -1, 56, 4, 1.000000f, 5.000000f, 2.220000f, 0.010000f, "Gamma"));
+	Params.push_back(ShaderParam("hcrt_gamma_cutoff", -1, 60, 4, 0.000000f, 100.000000f, 1.000000f, 1.000000f, "Inverse Gamma Cutoff (x1000)"));
+	Params.push_back(ShaderParam("hcrt_colour_accurate", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Mask Accurate/Colour Accurate"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
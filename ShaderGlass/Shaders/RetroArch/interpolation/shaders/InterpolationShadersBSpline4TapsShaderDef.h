@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersBSpline4TapsShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersBSpline4TapsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersBSpline4TapsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -571,31 +582,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersBSpline4TapsShaderDef : public ShaderDef
+RetroArch::InterpolationShadersBSpline4TapsShaderDef::InterpolationShadersBSpline4TapsShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersBSpline4TapsShaderDef() : ShaderDef{}
-	{
-		Name = "b-spline-4-taps";
-		VertexByteCode = RetroArchInterpolationShadersBSpline4TapsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersBSpline4TapsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersBSpline4TapsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersBSpline4TapsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "b-spline-4-taps";
+	VertexByteCode = RetroArchInterpolationShadersBSpline4TapsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersBSpline4TapsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersBSpline4TapsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersBSpline4TapsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
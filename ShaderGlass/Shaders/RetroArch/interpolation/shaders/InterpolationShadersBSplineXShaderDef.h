@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersBSplineXShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersBSplineXShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersBSplineXShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -581,31 +592,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersBSplineXShaderDef : public ShaderDef
+RetroArch::InterpolationShadersBSplineXShaderDef::InterpolationShadersBSplineXShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersBSplineXShaderDef() : ShaderDef{}
-	{
-		Name = "b-spline-x";
-		VertexByteCode = RetroArchInterpolationShadersBSplineXShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersBSplineXShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersBSplineXShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersBSplineXShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "b-spline-x";
+	VertexByteCode = RetroArchInterpolationShadersBSplineXShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersBSplineXShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersBSplineXShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersBSplineXShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersBicubic5TapsShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersBicubic5TapsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersBicubic5TapsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -768,33 +779,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersBicubic5TapsShaderDef : public ShaderDef
+RetroArch::InterpolationShadersBicubic5TapsShaderDef::InterpolationShadersBicubic5TapsShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersBicubic5TapsShaderDef() : ShaderDef{}
-	{
-		Name = "bicubic-5-taps";
-		VertexByteCode = RetroArchInterpolationShadersBicubic5TapsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersBicubic5TapsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersBicubic5TapsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersBicubic5TapsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("B", -1, 52, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff B"));
-		Params.push_back(ShaderParam("C", -1, 56, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff C"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bicubic-5-taps";
+	VertexByteCode = RetroArchInterpolationShadersBicubic5TapsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersBicubic5TapsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersBicubic5TapsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersBicubic5TapsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("B", -1, 52, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff B"));
+	Params.push_back(ShaderParam("C", -1, 56, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff C"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersBicubicShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersBicubicShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersBicubicShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1080,33 +1091,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersBicubicShaderDef : public ShaderDef
+RetroArch::InterpolationShadersBicubicShaderDef::InterpolationShadersBicubicShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersBicubicShaderDef() : ShaderDef{}
-	{
-		Name = "bicubic";
-		VertexByteCode = RetroArchInterpolationShadersBicubicShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersBicubicShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersBicubicShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersBicubicShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("B", -1, 52, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff B"));
-		Params.push_back(ShaderParam("C", -1, 56, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff C"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bicubic";
+	VertexByteCode = RetroArchInterpolationShadersBicubicShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersBicubicShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersBicubicShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersBicubicShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("B", -1, 52, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff B"));
+	Params.push_back(ShaderParam("C", -1, 56, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Bicubic Coeff C"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersBicubicXShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersBicubicXShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersBicubicXShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -707,32 +718,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersBicubicXShaderDef : public ShaderDef
+RetroArch::InterpolationShadersBicubicXShaderDef::InterpolationShadersBicubicXShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersBicubicXShaderDef() : ShaderDef{}
-	{
-		Name = "bicubic-x";
-		VertexByteCode = RetroArchInterpolationShadersBicubicXShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersBicubicXShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersBicubicXShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersBicubicXShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("B_ANTI_RINGING", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Bicubic Anti-Ringing [ OFF | ON ]"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bicubic-x";
+	VertexByteCode = RetroArchInterpolationShadersBicubicXShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersBicubicXShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersBicubicXShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersBicubicXShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("B_ANTI_RINGING", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Bicubic Anti-Ringing [ OFF | ON ]"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
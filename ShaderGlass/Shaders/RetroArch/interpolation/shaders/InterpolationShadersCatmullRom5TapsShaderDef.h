@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersCatmullRom5TapsShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersCatmullRom5TapsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersCatmullRom5TapsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -609,31 +620,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersCatmullRom5TapsShaderDef : public ShaderDef
+RetroArch::InterpolationShadersCatmullRom5TapsShaderDef::InterpolationShadersCatmullRom5TapsShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersCatmullRom5TapsShaderDef() : ShaderDef{}
-	{
-		Name = "catmull-rom-5-taps";
-		VertexByteCode = RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "catmull-rom-5-taps";
+	VertexByteCode = RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersCatmullRom5TapsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersCatmullRomXShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersCatmullRomXShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersCatmullRomXShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -707,32 +718,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersCatmullRomXShaderDef : public ShaderDef
+RetroArch::InterpolationShadersCatmullRomXShaderDef::InterpolationShadersCatmullRomXShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersCatmullRomXShaderDef() : ShaderDef{}
-	{
-		Name = "catmull-rom-x";
-		VertexByteCode = RetroArchInterpolationShadersCatmullRomXShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersCatmullRomXShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersCatmullRomXShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersCatmullRomXShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("C_ANTI_RINGING", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Catmull-Rom Anti-Ringing [ OFF | ON ]"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "catmull-rom-x";
+	VertexByteCode = RetroArchInterpolationShadersCatmullRomXShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersCatmullRomXShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersCatmullRomXShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersCatmullRomXShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("C_ANTI_RINGING", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Catmull-Rom Anti-Ringing [ OFF | ON ]"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersCubicGammaCorrectShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersCubicGammaCorrectShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersCubicGammaCorrectShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -760,30 +771,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersCubicGammaCorrectShaderDef : public ShaderDef
+RetroArch::InterpolationShadersCubicGammaCorrectShaderDef::InterpolationShadersCubicGammaCorrectShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersCubicGammaCorrectShaderDef() : ShaderDef{}
-	{
-		Name = "cubic-gamma-correct";
-		VertexByteCode = RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cubic-gamma-correct";
+	VertexByteCode = RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersCubicGammaCorrectShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersCubicShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersCubicShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersCubicShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -756,30 +767,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersCubicShaderDef : public ShaderDef
+RetroArch::InterpolationShadersCubicShaderDef::InterpolationShadersCubicShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersCubicShaderDef() : ShaderDef{}
-	{
-		Name = "cubic";
-		VertexByteCode = RetroArchInterpolationShadersCubicShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersCubicShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersCubicShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersCubicShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cubic";
+	VertexByteCode = RetroArchInterpolationShadersCubicShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersCubicShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersCubicShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersCubicShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersLanczos16ShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersLanczos16ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersLanczos16ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -950,31 +961,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersLanczos16ShaderDef : public ShaderDef
+RetroArch::InterpolationShadersLanczos16ShaderDef::InterpolationShadersLanczos16ShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersLanczos16ShaderDef() : ShaderDef{}
-	{
-		Name = "lanczos16";
-		VertexByteCode = RetroArchInterpolationShadersLanczos16ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersLanczos16ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersLanczos16ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersLanczos16ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lanczos16";
+	VertexByteCode = RetroArchInterpolationShadersLanczos16ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersLanczos16ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersLanczos16ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersLanczos16ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
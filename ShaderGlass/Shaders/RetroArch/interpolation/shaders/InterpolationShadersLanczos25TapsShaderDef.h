@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersLanczos25TapsShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersLanczos25TapsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersLanczos25TapsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -782,32 +793,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersLanczos25TapsShaderDef : public ShaderDef
+RetroArch::InterpolationShadersLanczos25TapsShaderDef::InterpolationShadersLanczos25TapsShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersLanczos25TapsShaderDef() : ShaderDef{}
-	{
-		Name = "lanczos2-5-taps";
-		VertexByteCode = RetroArchInterpolationShadersLanczos25TapsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersLanczos25TapsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersLanczos25TapsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersLanczos25TapsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("AR_STRENGTH", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Anti-Ringing Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lanczos2-5-taps";
+	VertexByteCode = RetroArchInterpolationShadersLanczos25TapsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersLanczos25TapsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersLanczos25TapsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersLanczos25TapsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("AR_STRENGTH", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Anti-Ringing Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
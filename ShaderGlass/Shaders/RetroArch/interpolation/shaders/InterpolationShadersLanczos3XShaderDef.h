@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class InterpolationShadersLanczos3XShaderDef : public ShaderDef
+{
+public:
+	InterpolationShadersLanczos3XShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchInterpolationShadersLanczos3XShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -736,32 +747,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class InterpolationShadersLanczos3XShaderDef : public ShaderDef
+RetroArch::InterpolationShadersLanczos3XShaderDef::InterpolationShadersLanczos3XShaderDef() : ShaderDef{}
 {
-public:
-	InterpolationShadersLanczos3XShaderDef() : ShaderDef{}
-	{
-		Name = "lanczos3-x";
-		VertexByteCode = RetroArchInterpolationShadersLanczos3XShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchInterpolationShadersLanczos3XShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchInterpolationShadersLanczos3XShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchInterpolationShadersLanczos3XShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LANCZOS3_ANTI_RINGING", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Lanczos3 Anti-Ringing [ OFF | ON ]"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lanczos3-x";
+	VertexByteCode = RetroArchInterpolationShadersLanczos3XShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchInterpolationShadersLanczos3XShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchInterpolationShadersLanczos3XShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchInterpolationShadersLanczos3XShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LANCZOS3_ANTI_RINGING", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Lanczos3 Anti-Ringing [ OFF | ON ]"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
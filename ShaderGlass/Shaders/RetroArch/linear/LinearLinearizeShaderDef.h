@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class LinearLinearizeShaderDef : public ShaderDef
+{
+public:
+	LinearLinearizeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchLinearLinearizeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -287,27 +298,21 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class LinearLinearizeShaderDef : public ShaderDef
+RetroArch::LinearLinearizeShaderDef::LinearLinearizeShaderDef() : ShaderDef{}
 {
-public:
-	LinearLinearizeShaderDef() : ShaderDef{}
-	{
-		Name = "linearize";
-		VertexByteCode = RetroArchLinearLinearizeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchLinearLinearizeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchLinearLinearizeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchLinearLinearizeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "linearize";
+	VertexByteCode = RetroArchLinearLinearizeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchLinearLinearizeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchLinearLinearizeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchLinearLinearizeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
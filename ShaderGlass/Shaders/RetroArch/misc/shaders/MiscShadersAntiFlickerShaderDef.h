@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersAntiFlickerShaderDef : public ShaderDef
+{
+public:
+	MiscShadersAntiFlickerShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersAntiFlickerShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -599,35 +610,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersAntiFlickerShaderDef : public ShaderDef
+RetroArch::MiscShadersAntiFlickerShaderDef::MiscShadersAntiFlickerShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersAntiFlickerShaderDef() : ShaderDef{}
-	{
-		Name = "anti-flicker";
-		VertexByteCode = RetroArchMiscShadersAntiFlickerShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersAntiFlickerShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersAntiFlickerShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersAntiFlickerShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("THRESH", -1, 52, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Luma Diff Threshold"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Name = "anti-flicker";
+	VertexByteCode = RetroArchMiscShadersAntiFlickerShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersAntiFlickerShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersAntiFlickerShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersAntiFlickerShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("THRESH", -1, 52, 4, 0.000000f, 1.000000f, 0.250000f, 0.050000f, "Luma Diff Threshold"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
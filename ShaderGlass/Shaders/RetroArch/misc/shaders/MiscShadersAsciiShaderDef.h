@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersAsciiShaderDef : public ShaderDef
+{
+public:
+	MiscShadersAsciiShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersAsciiShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -545,31 +556,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersAsciiShaderDef : public ShaderDef
+RetroArch::MiscShadersAsciiShaderDef::MiscShadersAsciiShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersAsciiShaderDef() : ShaderDef{}
-	{
-		Name = "ascii";
-		VertexByteCode = RetroArchMiscShadersAsciiShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersAsciiShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersAsciiShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersAsciiShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ascii";
+	VertexByteCode = RetroArchMiscShadersAsciiShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersAsciiShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersAsciiShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersAsciiShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersBeadShaderDef : public ShaderDef
+{
+public:
+	MiscShadersBeadShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersBeadShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -686,35 +697,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersBeadShaderDef : public ShaderDef
+RetroArch::MiscShadersBeadShaderDef::MiscShadersBeadShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersBeadShaderDef() : ShaderDef{}
-	{
-		Name = "bead";
-		VertexByteCode = RetroArchMiscShadersBeadShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersBeadShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersBeadShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersBeadShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BEAD_HIGH", -1, 52, 4, 0.000000f, 1.000000f, 0.450000f, 0.010000f, "Bead Outside Diameter"));
-		Params.push_back(ShaderParam("BEAD_LOW", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Bead Inside Diameter"));
-		Params.push_back(ShaderParam("scale_factor", -1, 60, 4, 0.000000f, 30.000000f, 0.000000f, 1.000000f, "Scale (0 = Auto)"));
-		Params.push_back(ShaderParam("BEAD_SHARP", -1, 64, 4, 1.000000f, 20.000000f, 6.000000f, 1.000000f, "Bead Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bead";
+	VertexByteCode = RetroArchMiscShadersBeadShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersBeadShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersBeadShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersBeadShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BEAD_HIGH", -1, 52, 4, 0.000000f, 1.000000f, 0.450000f, 0.010000f, "Bead Outside Diameter"));
+	Params.push_back(ShaderParam("BEAD_LOW", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Bead Inside Diameter"));
+	Params.push_back(ShaderParam("scale_factor", -1, 60, 4, 0.000000f, 30.000000f, 0.000000f, 1.000000f, "Scale (0 = Auto)"));
+	Params.push_back(ShaderParam("BEAD_SHARP", -1, 64, 4, 1.000000f, 20.000000f, 6.000000f, 1.000000f, "Bead Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
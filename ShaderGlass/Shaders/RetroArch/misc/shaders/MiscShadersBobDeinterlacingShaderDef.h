@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersBobDeinterlacingShaderDef : public ShaderDef
+{
+public:
+	MiscShadersBobDeinterlacingShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersBobDeinterlacingShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -714,34 +725,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersBobDeinterlacingShaderDef : public ShaderDef
+RetroArch::MiscShadersBobDeinterlacingShaderDef::MiscShadersBobDeinterlacingShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersBobDeinterlacingShaderDef() : ShaderDef{}
-	{
-		Name = "bob-deinterlacing";
-		VertexByteCode = RetroArchMiscShadersBobDeinterlacingShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersBobDeinterlacingShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersBobDeinterlacingShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersBobDeinterlacingShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scale", -1, 52, 4, 1.000000f, 16.000000f, 1.000000f, 1.000000f, "Deinterlacing Scale"));
-		Params.push_back(ShaderParam("ghost", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Blend Frames to Hide Bobbing"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Name = "bob-deinterlacing";
+	VertexByteCode = RetroArchMiscShadersBobDeinterlacingShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersBobDeinterlacingShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersBobDeinterlacingShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersBobDeinterlacingShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scale", -1, 52, 4, 1.000000f, 16.000000f, 1.000000f, 1.000000f, "Deinterlacing Scale"));
+	Params.push_back(ShaderParam("ghost", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Blend Frames to Hide Bobbing"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersChromaShaderDef : public ShaderDef
+{
+public:
+	MiscShadersChromaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersChromaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -876,46 +887,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersChromaShaderDef : public ShaderDef
+RetroArch::MiscShadersChromaShaderDef::MiscShadersChromaShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersChromaShaderDef() : ShaderDef{}
-	{
-		Name = "chroma";
-		VertexByteCode = RetroArchMiscShadersChromaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersChromaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersChromaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersChromaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BrightenLevel", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Brighten Level"));
-		Params.push_back(ShaderParam("BrightenAmount", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Brighten Amount"));
-		Params.push_back(ShaderParam("ContrastAmount", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Contrast Amount"));
-		Params.push_back(ShaderParam("ChromaLevel", -1, 64, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Chroma Level"));
-		Params.push_back(ShaderParam("IAmount", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "I Amount"));
-		Params.push_back(ShaderParam("QAmount", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Q Amount"));
-		Params.push_back(ShaderParam("ITilt", -1, 76, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt"));
-		Params.push_back(ShaderParam("QTilt", -1, 80, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt"));
-		Params.push_back(ShaderParam("ITiltHigh", -1, 84, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt High"));
-		Params.push_back(ShaderParam("QTiltHigh", -1, 88, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt High"));
-		Params.push_back(ShaderParam("ITiltMid", -1, 92, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt Mid"));
-		Params.push_back(ShaderParam("QTiltMid", -1, 96, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt Mid"));
-		Params.push_back(ShaderParam("ITiltLow", -1, 100, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt Low"));
-		Params.push_back(ShaderParam("QTiltLow", -1, 104, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt Low"));
-		Params.push_back(ShaderParam("LumBoost", -1, 108, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Luma Boost"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "chroma";
+	VertexByteCode = RetroArchMiscShadersChromaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersChromaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersChromaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersChromaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BrightenLevel", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Brighten Level"));
+	Params.push_back(ShaderParam("BrightenAmount", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Brighten Amount"));
+	Params.push_back(ShaderParam("ContrastAmount", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Contrast Amount"));
+	Params.push_back(ShaderParam("ChromaLevel", -1, 64, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Chroma Level"));
+	Params.push_back(ShaderParam("IAmount", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "I Amount"));
+	Params.push_back(ShaderParam("QAmount", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Q Amount"));
+	Params.push_back(ShaderParam("ITilt", -1, 76, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt"));
+	Params.push_back(ShaderParam("QTilt", -1, 80, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt"));
+	Params.push_back(ShaderParam("ITiltHigh", -1, 84, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt High"));
+	Params.push_back(ShaderParam("QTiltHigh", -1, 88, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt High"));
+	Params.push_back(ShaderParam("ITiltMid", -1, 92, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt Mid"));
+	Params.push_back(ShaderParam("QTiltMid", -1, 96, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt Mid"));
+	Params.push_back(ShaderParam("ITiltLow", -1, 100, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "I Tilt Low"));
+	Params.push_back(ShaderParam("QTiltLow", -1, 104, 4, 0.400000f, 0.600000f, 0.500000f, 0.010000f, "Q Tilt Low"));
+	Params.push_back(ShaderParam("LumBoost", -1, 108, 4, 0.000000f, 1.000000f, 0.000000f, 0.100000f, "Luma Boost"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -51,6 +51,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersChromaticityShaderDef : public ShaderDef
+{
+public:
+	MiscShadersChromaticityShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersChromaticityShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -890,33 +901,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersChromaticityShaderDef : public ShaderDef
+RetroArch::MiscShadersChromaticityShaderDef::MiscShadersChromaticityShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersChromaticityShaderDef() : ShaderDef{}
-	{
-		Name = "chromaticity";
-		VertexByteCode = RetroArchMiscShadersChromaticityShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersChromaticityShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersChromaticityShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersChromaticityShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("COLOR_MODE", -1, 52, 4, 0.000000f, 6.000000f, 0.000000f, 1.000000f, "SRGB,SMPTE C,REC709,BT2020,SMPTE240,NTSC1953,EBU"));
-		Params.push_back(ShaderParam("Dx", -1, 56, 4, -1.000000f, 3.000000f, 2.000000f, 1.000000f, "Color Temp: D50, D55, D65, D75"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "chromaticity";
+	VertexByteCode = RetroArchMiscShadersChromaticityShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersChromaticityShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersChromaticityShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersChromaticityShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("COLOR_MODE", -1, 52, 4, 0.000000f, 6.000000f, 0.000000f, 1.000000f, "SRGB,SMPTE C,REC709,BT2020,SMPTE240,NTSC1953,EBU"));
+	Params.push_back(ShaderParam("Dx", -1, 56, 4, -1.000000f, 3.000000f, 2.000000f, 1.000000f, "Color Temp: D50, D55, D65, D75"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
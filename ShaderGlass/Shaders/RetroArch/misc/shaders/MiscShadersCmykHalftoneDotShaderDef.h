@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersCmykHalftoneDotShaderDef : public ShaderDef
+{
+public:
+	MiscShadersCmykHalftoneDotShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersCmykHalftoneDotShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -689,32 +700,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersCmykHalftoneDotShaderDef : public ShaderDef
+RetroArch::MiscShadersCmykHalftoneDotShaderDef::MiscShadersCmykHalftoneDotShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersCmykHalftoneDotShaderDef() : ShaderDef{}
-	{
-		Name = "cmyk-halftone-dot";
-		VertexByteCode = RetroArchMiscShadersCmykHalftoneDotShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersCmykHalftoneDotShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersCmykHalftoneDotShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersCmykHalftoneDotShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("frequency", -1, 52, 4, 50.000000f, 500.000000f, 275.000000f, 25.000000f, "CMYK HalfTone Dot Density"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cmyk-halftone-dot";
+	VertexByteCode = RetroArchMiscShadersCmykHalftoneDotShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersCmykHalftoneDotShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersCmykHalftoneDotShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersCmykHalftoneDotShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("frequency", -1, 52, 4, 50.000000f, 500.000000f, 275.000000f, 25.000000f, "CMYK HalfTone Dot Density"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
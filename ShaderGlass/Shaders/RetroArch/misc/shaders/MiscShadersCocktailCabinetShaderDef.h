@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersCocktailCabinetShaderDef : public ShaderDef
+{
+public:
+	MiscShadersCocktailCabinetShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersCocktailCabinetShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -456,34 +467,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersCocktailCabinetShaderDef : public ShaderDef
+RetroArch::MiscShadersCocktailCabinetShaderDef::MiscShadersCocktailCabinetShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersCocktailCabinetShaderDef() : ShaderDef{}
-	{
-		Name = "cocktail-cabinet";
-		VertexByteCode = RetroArchMiscShadersCocktailCabinetShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersCocktailCabinetShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersCocktailCabinetShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersCocktailCabinetShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("height", -1, 52, 4, -3.000000f, 3.000000f, 1.000000f, 0.010000f, "CocktailTable Image Height"));
-		Params.push_back(ShaderParam("width", -1, 56, 4, -3.000000f, 3.000000f, 1.000000f, 0.050000f, "CocktailTable Image Width"));
-		Params.push_back(ShaderParam("location", -1, 60, 4, -2.000000f, 2.000000f, 0.000100f, 0.001000f, "CocktailTable Image Separation"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cocktail-cabinet";
+	VertexByteCode = RetroArchMiscShadersCocktailCabinetShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersCocktailCabinetShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersCocktailCabinetShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersCocktailCabinetShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("height", -1, 52, 4, -3.000000f, 3.000000f, 1.000000f, 0.010000f, "CocktailTable Image Height"));
+	Params.push_back(ShaderParam("width", -1, 56, 4, -3.000000f, 3.000000f, 1.000000f, 0.050000f, "CocktailTable Image Width"));
+	Params.push_back(ShaderParam("location", -1, 60, 4, -2.000000f, 2.000000f, 0.000100f, 0.001000f, "CocktailTable Image Separation"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersColorManglerShaderDef : public ShaderDef
+{
+public:
+	MiscShadersColorManglerShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersColorManglerShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -722,48 +733,42 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersColorManglerShaderDef : public ShaderDef
+RetroArch::MiscShadersColorManglerShaderDef::MiscShadersColorManglerShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersColorManglerShaderDef() : ShaderDef{}
-	{
-		Name = "color-mangler";
-		VertexByteCode = RetroArchMiscShadersColorManglerShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersColorManglerShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersColorManglerShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersColorManglerShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gamma_boost_r", -1, 0, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Gamma Mod Red Channel"));
-		Params.push_back(ShaderParam("gamma_boost_g", -1, 4, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Gamma Mod Green Channel"));
-		Params.push_back(ShaderParam("gamma_boost_b", -1, 8, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Gamma Mod Blue Channel"));
-		Params.push_back(ShaderParam("sat", -1, 12, 4, 0.000000f, 3.000000f, 1.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("lum", -1, 16, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Luminance"));
-		Params.push_back(ShaderParam("cntrst", -1, 20, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Contrast"));
-		Params.push_back(ShaderParam("r", -1, 24, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Red"));
-		Params.push_back(ShaderParam("g", -1, 28, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Green"));
-		Params.push_back(ShaderParam("b", -1, 32, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Blue"));
-		Params.push_back(ShaderParam("rg", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Green Tint"));
-		Params.push_back(ShaderParam("rb", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Blue Tint"));
-		Params.push_back(ShaderParam("gr", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Red Tint"));
-		Params.push_back(ShaderParam("gb", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Blue Tint"));
-		Params.push_back(ShaderParam("br", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Red Tint"));
-		Params.push_back(ShaderParam("bg", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Green Tint"));
-		Params.push_back(ShaderParam("blr", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Black-Red Tint"));
-		Params.push_back(ShaderParam("blg", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Black-Green Tint"));
-		Params.push_back(ShaderParam("blb", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Black-Blue Tint"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "color-mangler";
+	VertexByteCode = RetroArchMiscShadersColorManglerShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersColorManglerShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersColorManglerShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersColorManglerShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gamma_boost_r", -1, 0, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Gamma Mod Red Channel"));
+	Params.push_back(ShaderParam("gamma_boost_g", -1, 4, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Gamma Mod Green Channel"));
+	Params.push_back(ShaderParam("gamma_boost_b", -1, 8, 4, -5.000000f, 5.000000f, 0.000000f, 0.100000f, "Gamma Mod Blue Channel"));
+	Params.push_back(ShaderParam("sat", -1, 12, 4, 0.000000f, 3.000000f, 1.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("lum", -1, 16, 4, 0.000000f, 5.000000f, 1.000000f, 0.010000f, "Luminance"));
+	Params.push_back(ShaderParam("cntrst", -1, 20, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Contrast"));
+	Params.push_back(ShaderParam("r", -1, 24, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Red"));
+	Params.push_back(ShaderParam("g", -1, 28, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Green"));
+	Params.push_back(ShaderParam("b", -1, 32, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Blue"));
+	Params.push_back(ShaderParam("rg", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Green Tint"));
+	Params.push_back(ShaderParam("rb", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Blue Tint"));
+	Params.push_back(ShaderParam("gr", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Red Tint"));
+	Params.push_back(ShaderParam("gb", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Blue Tint"));
+	Params.push_back(ShaderParam("br", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Red Tint"));
+	Params.push_back(ShaderParam("bg", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Green Tint"));
+	Params.push_back(ShaderParam("blr", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Black-Red Tint"));
+	Params.push_back(ShaderParam("blg", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Black-Green Tint"));
+	Params.push_back(ShaderParam("blb", -1, 68, 4, 0.000000f, 1.000000f, 0.000000f, 0.005000f, "Black-Blue Tint"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -32,6 +32,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersColorimetryShaderDef : public ShaderDef
+{
+public:
+	MiscShadersColorimetryShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersColorimetryShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -913,34 +924,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersColorimetryShaderDef : public ShaderDef
+RetroArch::MiscShadersColorimetryShaderDef::MiscShadersColorimetryShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersColorimetryShaderDef() : ShaderDef{}
-	{
-		Name = "colorimetry";
-		VertexByteCode = RetroArchMiscShadersColorimetryShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersColorimetryShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersColorimetryShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersColorimetryShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("color_mode", -1, 0, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Colorimetry mode"));
-		Params.push_back(ShaderParam("white_point_d93", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Use D93 white point"));
-		Params.push_back(ShaderParam("clipping_method", -1, 8, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Color clipping method"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "colorimetry";
+	VertexByteCode = RetroArchMiscShadersColorimetryShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersColorimetryShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersColorimetryShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersColorimetryShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("color_mode", -1, 0, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Colorimetry mode"));
+	Params.push_back(ShaderParam("white_point_d93", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Use D93 white point"));
+	Params.push_back(ShaderParam("clipping_method", -1, 8, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Color clipping method"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersConvergenceShaderDef : public ShaderDef
+{
+public:
+	MiscShadersConvergenceShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersConvergenceShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -519,38 +530,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersConvergenceShaderDef : public ShaderDef
+RetroArch::MiscShadersConvergenceShaderDef::MiscShadersConvergenceShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersConvergenceShaderDef() : ShaderDef{}
-	{
-		Name = "convergence";
-		VertexByteCode = RetroArchMiscShadersConvergenceShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersConvergenceShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersConvergenceShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersConvergenceShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("C_STR", -1, 48, 4, 0.000000f, 0.500000f, 0.500000f, 0.050000f, "Convergence Overall Strength"));
-		Params.push_back(ShaderParam("Rx", -1, 52, 4, -5.000000f, 5.000000f, 0.900000f, 0.050000f, "Convergence Red Horiz."));
-		Params.push_back(ShaderParam("Ry", -1, 56, 4, -5.000000f, 5.000000f, 0.050000f, 0.050000f, "Convergence Red Vert."));
-		Params.push_back(ShaderParam("Gx", -1, 60, 4, -5.000000f, 5.000000f, -0.950000f, 0.050000f, "Convergence Green Horiz."));
-		Params.push_back(ShaderParam("Gy", -1, 64, 4, -5.000000f, 5.000000f, -0.050000f, 0.050000f, "Convergence Green Vert."));
-		Params.push_back(ShaderParam("Bx", -1, 68, 4, -5.000000f, 5.000000f, 0.900000f, 0.050000f, "Convergence Blue Horiz."));
-		Params.push_back(ShaderParam("By", -1, 72, 4, -5.000000f, 5.000000f, 0.050000f, 0.050000f, "Convergence Blue Vert."));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "convergence";
+	VertexByteCode = RetroArchMiscShadersConvergenceShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersConvergenceShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersConvergenceShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersConvergenceShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("C_STR", -1, 48, 4, 0.000000f, 0.500000f, 0.500000f, 0.050000f, "Convergence Overall Strength"));
+	Params.push_back(ShaderParam("Rx", -1, 52, 4, -5.000000f, 5.000000f, 0.900000f, 0.050000f, "Convergence Red Horiz."));
+	Params.push_back(ShaderParam("Ry", -1, 56, 4, -5.000000f, 5.000000f, 0.050000f, 0.050000f, "Convergence Red Vert."));
+	Params.push_back(ShaderParam("Gx", -1, 60, 4, -5.000000f, 5.000000f, -0.950000f, 0.050000f, "Convergence Green Horiz."));
+	Params.push_back(ShaderParam("Gy", -1, 64, 4, -5.000000f, 5.000000f, -0.050000f, 0.050000f, "Convergence Green Vert."));
+	Params.push_back(ShaderParam("Bx", -1, 68, 4, -5.000000f, 5.000000f, 0.900000f, 0.050000f, "Convergence Blue Horiz."));
+	Params.push_back(ShaderParam("By", -1, 72, 4, -5.000000f, 5.000000f, 0.050000f, 0.050000f, "Convergence Blue Vert."));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
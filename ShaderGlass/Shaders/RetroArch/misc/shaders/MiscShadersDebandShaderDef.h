@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersDebandShaderDef : public ShaderDef
+{
+public:
+	MiscShadersDebandShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersDebandShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -870,35 +881,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersDebandShaderDef : public ShaderDef
+RetroArch::MiscShadersDebandShaderDef::MiscShadersDebandShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersDebandShaderDef() : ShaderDef{}
-	{
-		Name = "deband";
-		VertexByteCode = RetroArchMiscShadersDebandShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersDebandShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersDebandShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersDebandShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("iterations", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Deband Iterations"));
-		Params.push_back(ShaderParam("threshold", -1, 56, 4, 1.000000f, 16.000000f, 1.000000f, 0.500000f, "Deband Threshold"));
-		Params.push_back(ShaderParam("range", -1, 60, 4, 0.000000f, 10.000000f, 1.500000f, 0.500000f, "Deband Range"));
-		Params.push_back(ShaderParam("grain", -1, 64, 4, 0.000000f, 2.000000f, 0.000000f, 0.100000f, "Deband Grain"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "deband";
+	VertexByteCode = RetroArchMiscShadersDebandShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersDebandShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersDebandShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersDebandShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("iterations", -1, 52, 4, 1.000000f, 10.000000f, 2.000000f, 1.000000f, "Deband Iterations"));
+	Params.push_back(ShaderParam("threshold", -1, 56, 4, 1.000000f, 16.000000f, 1.000000f, 0.500000f, "Deband Threshold"));
+	Params.push_back(ShaderParam("range", -1, 60, 4, 0.000000f, 10.000000f, 1.500000f, 0.500000f, "Deband Range"));
+	Params.push_back(ShaderParam("grain", -1, 64, 4, 0.000000f, 2.000000f, 0.000000f, 0.100000f, "Deband Grain"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
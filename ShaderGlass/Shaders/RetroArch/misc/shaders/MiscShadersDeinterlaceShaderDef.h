@@ -25,6 +25,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersDeinterlaceShaderDef : public ShaderDef
+{
+public:
+	MiscShadersDeinterlaceShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersDeinterlaceShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -729,34 +740,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersDeinterlaceShaderDef : public ShaderDef
+RetroArch::MiscShadersDeinterlaceShaderDef::MiscShadersDeinterlaceShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersDeinterlaceShaderDef() : ShaderDef{}
-	{
-		Name = "deinterlace";
-		VertexByteCode = RetroArchMiscShadersDeinterlaceShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersDeinterlaceShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersDeinterlaceShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersDeinterlaceShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("interlace_bff", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing BFF"));
-		Params.push_back(ShaderParam("force_noninterlaced", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force Non-interlaced"));
-		Params.push_back(ShaderParam("interlace_1080", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "1080 is Interlaced"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "deinterlace";
+	VertexByteCode = RetroArchMiscShadersDeinterlaceShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersDeinterlaceShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersDeinterlaceShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersDeinterlaceShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("interlace_bff", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interlacing BFF"));
+	Params.push_back(ShaderParam("force_noninterlaced", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force Non-interlaced"));
+	Params.push_back(ShaderParam("interlace_1080", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "1080 is Interlaced"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
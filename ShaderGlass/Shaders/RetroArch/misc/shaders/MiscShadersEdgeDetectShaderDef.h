@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersEdgeDetectShaderDef : public ShaderDef
+{
+public:
+	MiscShadersEdgeDetectShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersEdgeDetectShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -562,33 +573,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersEdgeDetectShaderDef : public ShaderDef
+RetroArch::MiscShadersEdgeDetectShaderDef::MiscShadersEdgeDetectShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersEdgeDetectShaderDef() : ShaderDef{}
-	{
-		Name = "edge-detect";
-		VertexByteCode = RetroArchMiscShadersEdgeDetectShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersEdgeDetectShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersEdgeDetectShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersEdgeDetectShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("minimum", -1, 52, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Edge Thresh Min"));
-		Params.push_back(ShaderParam("maximum", -1, 56, 4, 0.000000f, 1.000000f, 0.350000f, 0.010000f, "Edge Thresh Max"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "edge-detect";
+	VertexByteCode = RetroArchMiscShadersEdgeDetectShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersEdgeDetectShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersEdgeDetectShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersEdgeDetectShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("minimum", -1, 52, 4, 0.000000f, 1.000000f, 0.050000f, 0.010000f, "Edge Thresh Min"));
+	Params.push_back(ShaderParam("maximum", -1, 56, 4, 0.000000f, 1.000000f, 0.350000f, 0.010000f, "Edge Thresh Max"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersEgaShaderDef : public ShaderDef
+{
+public:
+	MiscShadersEgaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersEgaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -656,33 +667,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersEgaShaderDef : public ShaderDef
+RetroArch::MiscShadersEgaShaderDef::MiscShadersEgaShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersEgaShaderDef() : ShaderDef{}
-	{
-		Name = "ega";
-		VertexByteCode = RetroArchMiscShadersEgaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersEgaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersEgaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersEgaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("palette", -1, 52, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Choose palette Hercules/CGA/EGA"));
-		Params.push_back(ShaderParam("color_enhance", -1, 56, 4, 1.000000f, 4.000000f, 1.400000f, 0.050000f, "Color Enchance"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ega";
+	VertexByteCode = RetroArchMiscShadersEgaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersEgaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersEgaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersEgaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("palette", -1, 52, 4, 0.000000f, 2.000000f, 2.000000f, 1.000000f, "Choose palette Hercules/CGA/EGA"));
+	Params.push_back(ShaderParam("color_enhance", -1, 56, 4, 1.000000f, 4.000000f, 1.400000f, 0.050000f, "Color Enchance"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -24,6 +24,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersGeomShaderDef : public ShaderDef
+{
+public:
+	MiscShadersGeomShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersGeomShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2005,45 +2016,39 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersGeomShaderDef : public ShaderDef
+RetroArch::MiscShadersGeomShaderDef::MiscShadersGeomShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersGeomShaderDef() : ShaderDef{}
-	{
-		Name = "geom";
-		VertexByteCode = RetroArchMiscShadersGeomShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersGeomShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersGeomShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersGeomShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("geom_target_gamma", -1, 4, 4, 0.100000f, 5.000000f, 2.400000f, 0.100000f, "Geom Target Gamma"));
-		Params.push_back(ShaderParam("geom_monitor_gamma", -1, 8, 4, 0.100000f, 5.000000f, 2.200000f, 0.100000f, "Geom Monitor Gamma"));
-		Params.push_back(ShaderParam("geom_d", -1, 12, 4, 0.100000f, 3.000000f, 1.500000f, 0.100000f, "Geom Distance"));
-		Params.push_back(ShaderParam("geom_R", -1, 16, 4, 0.100000f, 10.000000f, 2.000000f, 0.100000f, "Geom Curvature Radius"));
-		Params.push_back(ShaderParam("geom_cornersize", -1, 20, 4, 0.001000f, 1.000000f, 0.030000f, 0.005000f, "Geom Corner Size"));
-		Params.push_back(ShaderParam("geom_cornersmooth", -1, 24, 4, 80.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Geom Corner Smoothness"));
-		Params.push_back(ShaderParam("geom_x_tilt", -1, 28, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Geom Horizontal Tilt"));
-		Params.push_back(ShaderParam("geom_y_tilt", -1, 32, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Geom Vertical Tilt"));
-		Params.push_back(ShaderParam("geom_overscan_x", -1, 36, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Horiz. Overscan %"));
-		Params.push_back(ShaderParam("geom_overscan_y", -1, 40, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Vert. Overscan %"));
-		Params.push_back(ShaderParam("geom_sharper", -1, 44, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Geom Sharpness"));
-		Params.push_back(ShaderParam("geom_curvature", -1, 48, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Geom Curvature Toggle"));
-		Params.push_back(ShaderParam("geom_lum", -1, 52, 4, 0.500000f, 2.000000f, 1.000000f, 0.010000f, "Geom Luminance"));
-		Params.push_back(ShaderParam("geom_invert_aspect", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Geom Curvature Aspect Inversion"));
-		Params.push_back(ShaderParam("geom_lod_bias", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Geom Anti-Aliasing Boost"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "geom";
+	VertexByteCode = RetroArchMiscShadersGeomShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersGeomShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersGeomShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersGeomShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("geom_target_gamma", -1, 4, 4, 0.100000f, 5.000000f, 2.400000f, 0.100000f, "Geom Target Gamma"));
+	Params.push_back(ShaderParam("geom_monitor_gamma", -1, 8, 4, 0.100000f, 5.000000f, 2.200000f, 0.100000f, "Geom Monitor Gamma"));
+	Params.push_back(ShaderParam("geom_d", -1, 12, 4, 0.100000f, 3.000000f, 1.500000f, 0.100000f, "Geom Distance"));
+	Params.push_back(ShaderParam("geom_R", -1, 16, 4, 0.100000f, 10.000000f, 2.000000f, 0.100000f, "Geom Curvature Radius"));
+	Params.push_back(ShaderParam("geom_cornersize", -1, 20, 4, 0.001000f, 1.000000f, 0.030000f, 0.005000f, "Geom Corner Size"));
+	Params.push_back(ShaderParam("geom_cornersmooth", -1, 24, 4, 80.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Geom Corner Smoothness"));
+	Params.push_back(ShaderParam("geom_x_tilt", -1, 28, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Geom Horizontal Tilt"));
+	Params.push_back(ShaderParam("geom_y_tilt", -1, 32, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Geom Vertical Tilt"));
+	Params.push_back(ShaderParam("geom_overscan_x", -1, 36, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Horiz. Overscan %"));
+	Params.push_back(ShaderParam("geom_overscan_y", -1, 40, 4, -125.000000f, 125.000000f, 100.000000f, 0.500000f, "Geom Vert. Overscan %"));
+	Params.push_back(ShaderParam("geom_sharper", -1, 44, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Geom Sharpness"));
+	Params.push_back(ShaderParam("geom_curvature", -1, 48, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Geom Curvature Toggle"));
+	Params.push_back(ShaderParam("geom_lum", -1, 52, 4, 0.500000f, 2.000000f, 1.000000f, 0.010000f, "Geom Luminance"));
+	Params.push_back(ShaderParam("geom_invert_aspect", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Geom Curvature Aspect Inversion"));
+	Params.push_back(ShaderParam("geom_lod_bias", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Geom Anti-Aliasing Boost"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -83,6 +83,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersGlassShaderDef : public ShaderDef
+{
+public:
+	MiscShadersGlassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersGlassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -4566,122 +4577,116 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersGlassShaderDef : public ShaderDef
+RetroArch::MiscShadersGlassShaderDef::MiscShadersGlassShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersGlassShaderDef() : ShaderDef{}
-	{
-		Name = "glass";
-		VertexByteCode = RetroArchMiscShadersGlassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersGlassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersGlassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersGlassShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_FLIP_HORZ", 0, 116, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_FLIP_VERT", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_overscan_percent_x", 0, 124, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_overscan_percent_y", 0, 128, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_ZOOM", 0, 132, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_XPOS", 0, 136, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_YPOS", 0, 140, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_GRAIN_STR", 0, 144, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_SHARPEN", 0, 148, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_saturation", 0, 152, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_luminance", 0, 156, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_contrast", 0, 160, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_bright_boost", 0, 164, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_black_level", 0, 168, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_target_gamma_r", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_target_gamma_g", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_target_gamma_b", 0, 180, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_monitor_gamma", 0, 184, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_TOPMASK", 0, 188, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_BOTMASK", 0, 192, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_LMASK", 0, 196, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_RMASK", 0, 200, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_rr", 0, 204, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_gg", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_bb", 0, 212, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_rg", 0, 216, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_rb", 0, 220, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_gr", 0, 224, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_gb", 0, 228, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_br", 0, 232, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_bg", 0, 236, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("temperature", 0, 240, 4, 1031.000000f, 12047.000000f, 6500.000000f, 72.000000f, "White Point"));
-		Params.push_back(ShaderParam("luma_preserve", 0, 244, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Preserve Luminance"));
-		Params.push_back(ShaderParam("wp_red", 0, 248, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Red Shift"));
-		Params.push_back(ShaderParam("wp_green", 0, 252, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Green Shift"));
-		Params.push_back(ShaderParam("wp_blue", 0, 256, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Blue Shift"));
-		Params.push_back(ShaderParam("ar_num", 0, 260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ar_den", 0, 264, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("integer_scale", 0, 268, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("overscale", 0, 272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_hpfix", 0, 276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_cntrst", 0, 280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_mid", 0, 284, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_strength", 0, 288, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mask_picker", 0, 292, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_Size1", 0, 296, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_Size2", 0, 300, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vignette", 0, 304, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vstr", 0, 308, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vpower", 0, 312, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gamma_in_lvl", 0, 316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gamma_out_lvl", 0, 320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpX", 0, 324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpY", 0, 328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("cornersize", 0, 332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("cornersmooth", 0, 336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Radius", 0, 340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Distance", 0, 344, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("x_tilt", 0, 348, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("y_tilt", 0, 352, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_csize", -1, 0, 4, 0.000000f, 0.070000f, 0.020000f, 0.010000f, "Corner Size"));
-		Params.push_back(ShaderParam("g_bsize", -1, 4, 4, 100.000000f, 600.000000f, 600.000000f, 25.000000f, "Border Smoothness"));
-		Params.push_back(ShaderParam("g_flicker", -1, 8, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Screen Flicker"));
-		Params.push_back(ShaderParam("g_shaker", -1, 12, 4, 0.000000f, 0.500000f, 0.020000f, 0.010000f, "Screen Shake"));
-		Params.push_back(ShaderParam("g_refltog", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Reflection Toggle"));
-		Params.push_back(ShaderParam("g_reflstr", -1, 20, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Refl. Brightness"));
-		Params.push_back(ShaderParam("g_reflgrain", -1, 24, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Refl. Deband Grain"));
-		Params.push_back(ShaderParam("g_fresnel", -1, 28, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Refl. Fresnel"));
-		Params.push_back(ShaderParam("g_reflblur", -1, 32, 4, 0.000000f, 1.000000f, 0.600000f, 0.100000f, "Refl. Blur"));
-		Params.push_back(ShaderParam("gz", -1, 36, 4, 1.000000f, 1.500000f, 1.200000f, 0.010000f, "Zoom"));
-		Params.push_back(ShaderParam("gx", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X"));
-		Params.push_back(ShaderParam("gy", -1, 44, 4, -1.000000f, 1.000000f, -0.010000f, 0.010000f, "Shift-Y"));
-		Params.push_back(ShaderParam("gzr", -1, 48, 4, 1.000000f, 1.500000f, 1.030000f, 0.010000f, "Zoom Red"));
-		Params.push_back(ShaderParam("gzg", -1, 52, 4, 1.000000f, 1.500000f, 1.010000f, 0.010000f, "Zoom Green"));
-		Params.push_back(ShaderParam("gzb", -1, 56, 4, 1.000000f, 1.500000f, 1.000000f, 0.010000f, "Zoom Blue"));
-		Params.push_back(ShaderParam("goxr", -1, 60, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X Red"));
-		Params.push_back(ShaderParam("goyr", -1, 64, 4, -1.000000f, 1.000000f, -0.010000f, 0.010000f, "Shift-Y Red"));
-		Params.push_back(ShaderParam("goxg", -1, 68, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X Green"));
-		Params.push_back(ShaderParam("goyg", -1, 72, 4, -1.000000f, 1.000000f, -0.010000f, 0.010000f, "Shift-Y Green"));
-		Params.push_back(ShaderParam("goxb", -1, 76, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X Blue"));
-		Params.push_back(ShaderParam("goyb", -1, 80, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-Y Blue"));
-		Params.push_back(ShaderParam("TO", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Afterglow OFF/ON"));
-		Params.push_back(ShaderParam("PH", -1, 88, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "AG Phosphor (0:RGB 1:NTSC-U 2:NTSC-J 3:PAL)"));
-		Params.push_back(ShaderParam("PER", -1, 92, 4, 0.500000f, 2.000000f, 0.750000f, 0.100000f, "Persistence (more is less)"));
-		Params.push_back(ShaderParam("ASAT", -1, 96, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Afterglow Saturation"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
-		Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
-		Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
-		Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
+	Name = "glass";
+	VertexByteCode = RetroArchMiscShadersGlassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersGlassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersGlassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersGlassShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_FLIP_HORZ", 0, 116, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_FLIP_VERT", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_overscan_percent_x", 0, 124, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_overscan_percent_y", 0, 128, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_ZOOM", 0, 132, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_XPOS", 0, 136, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_YPOS", 0, 140, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_GRAIN_STR", 0, 144, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_SHARPEN", 0, 148, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_saturation", 0, 152, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_luminance", 0, 156, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_contrast", 0, 160, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_bright_boost", 0, 164, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_black_level", 0, 168, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_target_gamma_r", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_target_gamma_g", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_target_gamma_b", 0, 180, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_monitor_gamma", 0, 184, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_TOPMASK", 0, 188, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_BOTMASK", 0, 192, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_LMASK", 0, 196, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_RMASK", 0, 200, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_rr", 0, 204, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_gg", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_bb", 0, 212, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_rg", 0, 216, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_rb", 0, 220, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_gr", 0, 224, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_gb", 0, 228, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_br", 0, 232, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_bg", 0, 236, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("temperature", 0, 240, 4, 1031.000000f, 12047.000000f, 6500.000000f, 72.000000f, "White Point"));
+	Params.push_back(ShaderParam("luma_preserve", 0, 244, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Preserve Luminance"));
+	Params.push_back(ShaderParam("wp_red", 0, 248, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Red Shift"));
+	Params.push_back(ShaderParam("wp_green", 0, 252, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Green Shift"));
+	Params.push_back(ShaderParam("wp_blue", 0, 256, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Blue Shift"));
+	Params.push_back(ShaderParam("ar_num", 0, 260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ar_den", 0, 264, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("integer_scale", 0, 268, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("overscale", 0, 272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_hpfix", 0, 276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_cntrst", 0, 280, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_mid", 0, 284, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_strength", 0, 288, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mask_picker", 0, 292, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_Size1", 0, 296, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_Size2", 0, 300, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vignette", 0, 304, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vstr", 0, 308, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vpower", 0, 312, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gamma_in_lvl", 0, 316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gamma_out_lvl", 0, 320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpX", 0, 324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpY", 0, 328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("cornersize", 0, 332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("cornersmooth", 0, 336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Radius", 0, 340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Distance", 0, 344, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("x_tilt", 0, 348, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("y_tilt", 0, 352, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_csize", -1, 0, 4, 0.000000f, 0.070000f, 0.020000f, 0.010000f, "Corner Size"));
+	Params.push_back(ShaderParam("g_bsize", -1, 4, 4, 100.000000f, 600.000000f, 600.000000f, 25.000000f, "Border Smoothness"));
+	Params.push_back(ShaderParam("g_flicker", -1, 8, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Screen Flicker"));
+	Params.push_back(ShaderParam("g_shaker", -1, 12, 4, 0.000000f, 0.500000f, 0.020000f, 0.010000f, "Screen Shake"));
+	Params.push_back(ShaderParam("g_refltog", -1, 16, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Reflection Toggle"));
+	Params.push_back(ShaderParam("g_reflstr", -1, 20, 4, 0.000000f, 1.000000f, 0.150000f, 0.010000f, "Refl. Brightness"));
+	Params.push_back(ShaderParam("g_reflgrain", -1, 24, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Refl. Deband Grain"));
+	Params.push_back(ShaderParam("g_fresnel", -1, 28, 4, 0.000000f, 1.000000f, 1.000000f, 0.100000f, "Refl. Fresnel"));
+	Params.push_back(ShaderParam("g_reflblur", -1, 32, 4, 0.000000f, 1.000000f, 0.600000f, 0.100000f, "Refl. Blur"));
+	Params.push_back(ShaderParam("gz", -1, 36, 4, 1.000000f, 1.500000f, 1.200000f, 0.010000f, "Zoom"));
+	Params.push_back(ShaderParam("gx", -1, 40, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X"));
+	Params.push_back(ShaderParam("gy", -1, 44, 4, -1.000000f, 1.000000f, -0.010000f, 0.010000f, "Shift-Y"));
+	Params.push_back(ShaderParam("gzr", -1, 48, 4, 1.000000f, 1.500000f, 1.030000f, 0.010000f, "Zoom Red"));
+	Params.push_back(ShaderParam("gzg", -1, 52, 4, 1.000000f, 1.500000f, 1.010000f, 0.010000f, "Zoom Green"));
+	Params.push_back(ShaderParam("gzb", -1, 56, 4, 1.000000f, 1.500000f, 1.000000f, 0.010000f, "Zoom Blue"));
+	Params.push_back(ShaderParam("goxr", -1, 60, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X Red"));
+	Params.push_back(ShaderParam("goyr", -1, 64, 4, -1.000000f, 1.000000f, -0.010000f, 0.010000f, "Shift-Y Red"));
+	Params.push_back(ShaderParam("goxg", -1, 68, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X Green"));
+	Params.push_back(ShaderParam("goyg", -1, 72, 4, -1.000000f, 1.000000f, -0.010000f, 0.010000f, "Shift-Y Green"));
+	Params.push_back(ShaderParam("goxb", -1, 76, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-X Blue"));
+	Params.push_back(ShaderParam("goyb", -1, 80, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Shift-Y Blue"));
+	Params.push_back(ShaderParam("TO", -1, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Afterglow OFF/ON"));
+	Params.push_back(ShaderParam("PH", -1, 88, 4, 0.000000f, 3.000000f, 2.000000f, 1.000000f, "AG Phosphor (0:RGB 1:NTSC-U 2:NTSC-J 3:PAL)"));
+	Params.push_back(ShaderParam("PER", -1, 92, 4, 0.500000f, 2.000000f, 0.750000f, 0.100000f, "Persistence (more is less)"));
+	Params.push_back(ShaderParam("ASAT", -1, 96, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Afterglow Saturation"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
+	Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
+	Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
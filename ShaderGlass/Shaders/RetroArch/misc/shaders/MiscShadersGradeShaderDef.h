@@ -128,6 +128,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersGradeShaderDef : public ShaderDef
+{
+public:
+	MiscShadersGradeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersGradeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -6030,86 +6041,80 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersGradeShaderDef : public ShaderDef
+RetroArch::MiscShadersGradeShaderDef::MiscShadersGradeShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersGradeShaderDef() : ShaderDef{}
-	{
-		Name = "grade";
-		VertexByteCode = RetroArchMiscShadersGradeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersGradeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersGradeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersGradeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vignette", 0, 116, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette Toggle"));
-		Params.push_back(ShaderParam("g_Dark_to_Dim", 0, 120, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Dark to Dim adaptation"));
-		Params.push_back(ShaderParam("g_GCompress", 0, 124, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Gamut Compression"));
-		Params.push_back(ShaderParam("wp_temperature", 0, 128, 4, 5004.000000f, 12004.000000f, 8504.000000f, 100.000000f, "White Point"));
-		Params.push_back(ShaderParam("g_analog", 0, 132, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "// ANALOG CONTROLS //"));
-		Params.push_back(ShaderParam("g_digital", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "// DIGITAL CONTROLS //"));
-		Params.push_back(ShaderParam("g_sfixes", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "// SEGA FIXES //"));
-		Params.push_back(ShaderParam("g_MD_Pal", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MD Palette"));
-		Params.push_back(ShaderParam("g_SMS_bl", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SMS Blue Lift"));
-		Params.push_back(ShaderParam("g_CRT_br", 0, 152, 4, 0.000000f, 1.200000f, 1.000000f, 0.010000f, "CRT Beam Red"));
-		Params.push_back(ShaderParam("g_CRT_bg", 0, 156, 4, 0.000000f, 1.200000f, 1.000000f, 0.010000f, "CRT Beam Green"));
-		Params.push_back(ShaderParam("g_CRT_bb", 0, 160, 4, 0.000000f, 1.200000f, 1.000000f, 0.010000f, "CRT Beam Blue"));
-		Params.push_back(ShaderParam("g_CRT_rf", 0, 164, 4, 2.000000f, 5.000000f, 5.000000f, 0.100000f, "CRT Lambert Refl. in %"));
-		Params.push_back(ShaderParam("g_CRT_sl", 0, 168, 4, 0.000000f, 100.000000f, 34.000000f, 1.000000f, "Surround Luminance -nits-"));
-		Params.push_back(ShaderParam("g_satr", 0, 172, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue vs Sat Red"));
-		Params.push_back(ShaderParam("g_satg", 0, 176, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue vs Sat Green"));
-		Params.push_back(ShaderParam("g_satb", 0, 180, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue vs Sat Blue"));
-		Params.push_back(ShaderParam("LUT_Size1", 0, 184, 4, 8.000000f, 64.000000f, 32.000000f, 16.000000f, "LUT Size 1"));
-		Params.push_back(ShaderParam("LUT1_toggle", 0, 188, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "LUT 1 Toggle"));
-		Params.push_back(ShaderParam("LUT_Size2", 0, 192, 4, 0.000000f, 64.000000f, 64.000000f, 16.000000f, "LUT Size 2"));
-		Params.push_back(ShaderParam("LUT2_toggle", 0, 196, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "LUT 2 Toggle"));
-		Params.push_back(ShaderParam("g_signal_type", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Signal Type (0:RGB 1:Composite)"));
-		Params.push_back(ShaderParam("g_crtgamut", -1, 4, 4, -3.000000f, 3.000000f, 2.000000f, 1.000000f, "Phosphor (-2:CRT-95s -1:P22-80s 1:P22-90s 2:NTSC-J 3:PAL)"));
-		Params.push_back(ShaderParam("g_space_out", -1, 8, 4, -1.000000f, 3.000000f, 0.000000f, 1.000000f, "Diplay Color Space (-1:709 0:sRGB 1:P3-D65 2:2020 3:Adobe)"));
-		Params.push_back(ShaderParam("g_hue_degrees", -1, 12, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "CRT Hue"));
-		Params.push_back(ShaderParam("g_U_SHIFT", -1, 16, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "CRT U Shift"));
-		Params.push_back(ShaderParam("g_V_SHIFT", -1, 20, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "CRT V Shift"));
-		Params.push_back(ShaderParam("g_U_MUL", -1, 24, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT U Multiplier"));
-		Params.push_back(ShaderParam("g_V_MUL", -1, 28, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT V Multiplier"));
-		Params.push_back(ShaderParam("g_CRT_b", -1, 32, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "CRT Brightness"));
-		Params.push_back(ShaderParam("g_CRT_c", -1, 36, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "CRT Contrast"));
-		Params.push_back(ShaderParam("g_CRT_l", -1, 40, 4, 2.300000f, 2.600000f, 2.500000f, 0.010000f, "CRT Gamma"));
-		Params.push_back(ShaderParam("g_lum_fix", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sega Luma Fix"));
-		Params.push_back(ShaderParam("g_vstr", -1, 48, 4, 0.000000f, 50.000000f, 50.000000f, 1.000000f, "Vignette Strength"));
-		Params.push_back(ShaderParam("g_vpower", -1, 52, 4, 0.000000f, 0.500000f, 0.500000f, 0.010000f, "Vignette Power"));
-		Params.push_back(ShaderParam("g_sat", -1, 56, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("g_vibr", -1, 60, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Dullness/Vibrance"));
-		Params.push_back(ShaderParam("g_lum", -1, 64, 4, -0.500000f, 1.000000f, 0.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("g_cntrst", -1, 68, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Contrast"));
-		Params.push_back(ShaderParam("g_mid", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Contrast Pivot"));
-		Params.push_back(ShaderParam("g_lift", -1, 76, 4, -15.000000f, 15.000000f, 0.000000f, 1.000000f, "Black Level"));
-		Params.push_back(ShaderParam("blr", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Black-Red Tint"));
-		Params.push_back(ShaderParam("blg", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Black-Green Tint"));
-		Params.push_back(ShaderParam("blb", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Black-Blue Tint"));
-		Params.push_back(ShaderParam("wlr", -1, 92, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White-Red Tint"));
-		Params.push_back(ShaderParam("wlg", -1, 96, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White-Green Tint"));
-		Params.push_back(ShaderParam("wlb", -1, 100, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White-Blue Tint"));
-		Params.push_back(ShaderParam("rg", -1, 104, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Green Tint"));
-		Params.push_back(ShaderParam("rb", -1, 108, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Blue Tint"));
-		Params.push_back(ShaderParam("gr", -1, 112, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Red Tint"));
-		Params.push_back(ShaderParam("gb", -1, 116, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Blue Tint"));
-		Params.push_back(ShaderParam("br", -1, 120, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Red Tint"));
-		Params.push_back(ShaderParam("bg", -1, 124, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Green Tint"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Name = "grade";
+	VertexByteCode = RetroArchMiscShadersGradeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersGradeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersGradeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersGradeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vignette", 0, 116, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Vignette Toggle"));
+	Params.push_back(ShaderParam("g_Dark_to_Dim", 0, 120, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Dark to Dim adaptation"));
+	Params.push_back(ShaderParam("g_GCompress", 0, 124, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Gamut Compression"));
+	Params.push_back(ShaderParam("wp_temperature", 0, 128, 4, 5004.000000f, 12004.000000f, 8504.000000f, 100.000000f, "White Point"));
+	Params.push_back(ShaderParam("g_analog", 0, 132, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "// ANALOG CONTROLS //"));
+	Params.push_back(ShaderParam("g_digital", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "// DIGITAL CONTROLS //"));
+	Params.push_back(ShaderParam("g_sfixes", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "// SEGA FIXES //"));
+	Params.push_back(ShaderParam("g_MD_Pal", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "MD Palette"));
+	Params.push_back(ShaderParam("g_SMS_bl", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SMS Blue Lift"));
+	Params.push_back(ShaderParam("g_CRT_br", 0, 152, 4, 0.000000f, 1.200000f, 1.000000f, 0.010000f, "CRT Beam Red"));
+	Params.push_back(ShaderParam("g_CRT_bg", 0, 156, 4, 0.000000f, 1.200000f, 1.000000f, 0.010000f, "CRT Beam Green"));
+	Params.push_back(ShaderParam("g_CRT_bb", 0, 160, 4, 0.000000f, 1.200000f, 1.000000f, 0.010000f, "CRT Beam Blue"));
+	Params.push_back(ShaderParam("g_CRT_rf", 0, 164, 4, 2.000000f, 5.000000f, 5.000000f, 0.100000f, "CRT Lambert Refl. in %"));
+	Params.push_back(ShaderParam("g_CRT_sl", 0, 168, 4, 0.000000f, 100.000000f, 34.000000f, 1.000000f, "Surround Luminance -nits-"));
+	Params.push_back(ShaderParam("g_satr", 0, 172, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue vs Sat Red"));
+	Params.push_back(ShaderParam("g_satg", 0, 176, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue vs Sat Green"));
+	Params.push_back(ShaderParam("g_satb", 0, 180, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue vs Sat Blue"));
+	Params.push_back(ShaderParam("LUT_Size1", 0, 184, 4, 8.000000f, 64.000000f, 32.000000f, 16.000000f, "LUT Size 1"));
+	Params.push_back(ShaderParam("LUT1_toggle", 0, 188, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "LUT 1 Toggle"));
+	Params.push_back(ShaderParam("LUT_Size2", 0, 192, 4, 0.000000f, 64.000000f, 64.000000f, 16.000000f, "LUT Size 2"));
+	Params.push_back(ShaderParam("LUT2_toggle", 0, 196, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "LUT 2 Toggle"));
+	Params.push_back(ShaderParam("g_signal_type", -1, 0, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Signal Type (0:RGB 1:Composite)"));
+	Params.push_back(ShaderParam("g_crtgamut", -1, 4, 4, -3.000000f, 3.000000f, 2.000000f, 1.000000f, "Phosphor (-2:CRT-95s -1:P22-80s 1:P22-90s 2:NTSC-J 3:PAL)"));
+	Params.push_back(ShaderParam("g_space_out", -1, 8, 4, -1.000000f, 3.000000f, 0.000000f, 1.000000f, "Diplay Color Space (-1:709 0:sRGB 1:P3-D65 2:2020 3:Adobe)"));
+	Params.push_back(ShaderParam("g_hue_degrees", -1, 12, 4, -180.000000f, 180.000000f, 0.000000f, 1.000000f, "CRT Hue"));
+	Params.push_back(ShaderParam("g_U_SHIFT", -1, 16, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "CRT U Shift"));
+	Params.push_back(ShaderParam("g_V_SHIFT", -1, 20, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "CRT V Shift"));
+	Params.push_back(ShaderParam("g_U_MUL", -1, 24, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT U Multiplier"));
+	Params.push_back(ShaderParam("g_V_MUL", -1, 28, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "CRT V Multiplier"));
+	Params.push_back(ShaderParam("g_CRT_b", -1, 32, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "CRT Brightness"));
+	Params.push_back(ShaderParam("g_CRT_c", -1, 36, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "CRT Contrast"));
+	Params.push_back(ShaderParam("g_CRT_l", -1, 40, 4, 2.300000f, 2.600000f, 2.500000f, 0.010000f, "CRT Gamma"));
+	Params.push_back(ShaderParam("g_lum_fix", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sega Luma Fix"));
+	Params.push_back(ShaderParam("g_vstr", -1, 48, 4, 0.000000f, 50.000000f, 50.000000f, 1.000000f, "Vignette Strength"));
+	Params.push_back(ShaderParam("g_vpower", -1, 52, 4, 0.000000f, 0.500000f, 0.500000f, 0.010000f, "Vignette Power"));
+	Params.push_back(ShaderParam("g_sat", -1, 56, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("g_vibr", -1, 60, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Dullness/Vibrance"));
+	Params.push_back(ShaderParam("g_lum", -1, 64, 4, -0.500000f, 1.000000f, 0.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("g_cntrst", -1, 68, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Contrast"));
+	Params.push_back(ShaderParam("g_mid", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Contrast Pivot"));
+	Params.push_back(ShaderParam("g_lift", -1, 76, 4, -15.000000f, 15.000000f, 0.000000f, 1.000000f, "Black Level"));
+	Params.push_back(ShaderParam("blr", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Black-Red Tint"));
+	Params.push_back(ShaderParam("blg", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Black-Green Tint"));
+	Params.push_back(ShaderParam("blb", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Black-Blue Tint"));
+	Params.push_back(ShaderParam("wlr", -1, 92, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White-Red Tint"));
+	Params.push_back(ShaderParam("wlg", -1, 96, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White-Green Tint"));
+	Params.push_back(ShaderParam("wlb", -1, 100, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "White-Blue Tint"));
+	Params.push_back(ShaderParam("rg", -1, 104, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Green Tint"));
+	Params.push_back(ShaderParam("rb", -1, 108, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Red-Blue Tint"));
+	Params.push_back(ShaderParam("gr", -1, 112, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Red Tint"));
+	Params.push_back(ShaderParam("gb", -1, 116, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Green-Blue Tint"));
+	Params.push_back(ShaderParam("br", -1, 120, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Red Tint"));
+	Params.push_back(ShaderParam("bg", -1, 124, 4, -1.000000f, 1.000000f, 0.000000f, 0.005000f, "Blue-Green Tint"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
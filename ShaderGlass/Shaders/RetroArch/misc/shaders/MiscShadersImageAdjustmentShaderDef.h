@@ -53,6 +53,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersImageAdjustmentShaderDef : public ShaderDef
+{
+public:
+	MiscShadersImageAdjustmentShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersImageAdjustmentShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1431,53 +1442,47 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersImageAdjustmentShaderDef : public ShaderDef
+RetroArch::MiscShadersImageAdjustmentShaderDef::MiscShadersImageAdjustmentShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersImageAdjustmentShaderDef() : ShaderDef{}
-	{
-		Name = "image-adjustment";
-		VertexByteCode = RetroArchMiscShadersImageAdjustmentShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersImageAdjustmentShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersImageAdjustmentShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersImageAdjustmentShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_FLIP_HORZ", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Horiz Axis"));
-		Params.push_back(ShaderParam("ia_FLIP_VERT", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Vert Axis"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_target_gamma", -1, 20, 4, 0.100000f, 5.000000f, 2.200000f, 0.100000f, "Target Gamma"));
-		Params.push_back(ShaderParam("ia_monitor_gamma", -1, 24, 4, 0.100000f, 5.000000f, 2.200000f, 0.100000f, "Monitor Gamma"));
-		Params.push_back(ShaderParam("ia_overscan_percent_x", -1, 28, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Horizontal Overscan %"));
-		Params.push_back(ShaderParam("ia_overscan_percent_y", -1, 32, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Vertical Overscan %"));
-		Params.push_back(ShaderParam("ia_saturation", -1, 36, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Saturation"));
-		Params.push_back(ShaderParam("ia_contrast", -1, 40, 4, 0.000000f, 10.000000f, 1.000000f, 0.050000f, "Contrast"));
-		Params.push_back(ShaderParam("ia_luminance", -1, 44, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Luminance"));
-		Params.push_back(ShaderParam("ia_black_level", -1, 48, 4, -0.300000f, 0.300000f, 0.000000f, 0.010000f, "Black Level"));
-		Params.push_back(ShaderParam("ia_bright_boost", -1, 52, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Brightness Boost"));
-		Params.push_back(ShaderParam("ia_invert", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Invert Colors"));
-		Params.push_back(ShaderParam("ia_R", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Red Channel"));
-		Params.push_back(ShaderParam("ia_G", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Green Channel"));
-		Params.push_back(ShaderParam("ia_B", -1, 68, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Blue Channel"));
-		Params.push_back(ShaderParam("ia_ZOOM", -1, 72, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Zoom Factor"));
-		Params.push_back(ShaderParam("ia_XPOS", -1, 76, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "X Modifier"));
-		Params.push_back(ShaderParam("ia_YPOS", -1, 80, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "Y Modifier"));
-		Params.push_back(ShaderParam("ia_TOPMASK", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Top"));
-		Params.push_back(ShaderParam("ia_BOTMASK", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Bottom"));
-		Params.push_back(ShaderParam("ia_LMASK", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Left"));
-		Params.push_back(ShaderParam("ia_RMASK", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Right"));
-		Params.push_back(ShaderParam("ia_GRAIN_STR", -1, 100, 4, 0.000000f, 72.000000f, 0.000000f, 6.000000f, "Film Grain"));
-		Params.push_back(ShaderParam("ia_SHARPEN", -1, 104, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Sharpen"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "image-adjustment";
+	VertexByteCode = RetroArchMiscShadersImageAdjustmentShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersImageAdjustmentShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersImageAdjustmentShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersImageAdjustmentShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_FLIP_HORZ", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Horiz Axis"));
+	Params.push_back(ShaderParam("ia_FLIP_VERT", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Vert Axis"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_target_gamma", -1, 20, 4, 0.100000f, 5.000000f, 2.200000f, 0.100000f, "Target Gamma"));
+	Params.push_back(ShaderParam("ia_monitor_gamma", -1, 24, 4, 0.100000f, 5.000000f, 2.200000f, 0.100000f, "Monitor Gamma"));
+	Params.push_back(ShaderParam("ia_overscan_percent_x", -1, 28, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Horizontal Overscan %"));
+	Params.push_back(ShaderParam("ia_overscan_percent_y", -1, 32, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Vertical Overscan %"));
+	Params.push_back(ShaderParam("ia_saturation", -1, 36, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Saturation"));
+	Params.push_back(ShaderParam("ia_contrast", -1, 40, 4, 0.000000f, 10.000000f, 1.000000f, 0.050000f, "Contrast"));
+	Params.push_back(ShaderParam("ia_luminance", -1, 44, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Luminance"));
+	Params.push_back(ShaderParam("ia_black_level", -1, 48, 4, -0.300000f, 0.300000f, 0.000000f, 0.010000f, "Black Level"));
+	Params.push_back(ShaderParam("ia_bright_boost", -1, 52, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Brightness Boost"));
+	Params.push_back(ShaderParam("ia_invert", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Invert Colors"));
+	Params.push_back(ShaderParam("ia_R", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Red Channel"));
+	Params.push_back(ShaderParam("ia_G", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Green Channel"));
+	Params.push_back(ShaderParam("ia_B", -1, 68, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Blue Channel"));
+	Params.push_back(ShaderParam("ia_ZOOM", -1, 72, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Zoom Factor"));
+	Params.push_back(ShaderParam("ia_XPOS", -1, 76, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "X Modifier"));
+	Params.push_back(ShaderParam("ia_YPOS", -1, 80, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "Y Modifier"));
+	Params.push_back(ShaderParam("ia_TOPMASK", -1, 84, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Top"));
+	Params.push_back(ShaderParam("ia_BOTMASK", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Bottom"));
+	Params.push_back(ShaderParam("ia_LMASK", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Left"));
+	Params.push_back(ShaderParam("ia_RMASK", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Right"));
+	Params.push_back(ShaderParam("ia_GRAIN_STR", -1, 100, 4, 0.000000f, 72.000000f, 0.000000f, 6.000000f, "Film Grain"));
+	Params.push_back(ShaderParam("ia_SHARPEN", -1, 104, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Sharpen"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
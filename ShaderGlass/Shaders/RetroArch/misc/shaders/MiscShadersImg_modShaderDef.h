@@ -315,6 +315,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersImg_modShaderDef : public ShaderDef
+{
+public:
+	MiscShadersImg_modShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersImg_modShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -7420,90 +7431,84 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersImg_modShaderDef : public ShaderDef
+RetroArch::MiscShadersImg_modShaderDef::MiscShadersImg_modShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersImg_modShaderDef() : ShaderDef{}
-	{
-		Name = "img_mod";
-		VertexByteCode = RetroArchMiscShadersImg_modShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersImg_modShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersImg_modShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersImg_modShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_FLIP_HORZ", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Horiz Axis"));
-		Params.push_back(ShaderParam("ia_FLIP_VERT", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Vert Axis"));
-		Params.push_back(ShaderParam("ia_overscan_percent_x", 0, 72, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Stretch Width"));
-		Params.push_back(ShaderParam("ia_overscan_percent_y", 0, 76, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Stretch Height"));
-		Params.push_back(ShaderParam("ia_ZOOM", 0, 80, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Zoom In/Out"));
-		Params.push_back(ShaderParam("ia_XPOS", 0, 84, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "Pan X"));
-		Params.push_back(ShaderParam("ia_YPOS", 0, 88, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "Pan Y"));
-		Params.push_back(ShaderParam("ia_GRAIN_STR", 0, 92, 4, 0.000000f, 72.000000f, 0.000000f, 3.000000f, "Grain Strength"));
-		Params.push_back(ShaderParam("ia_SHARPEN", 0, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Sharpen"));
-		Params.push_back(ShaderParam("ia_saturation", 0, 100, 4, 0.010000f, 2.000000f, 1.000000f, 0.010000f, "Chrominance"));
-		Params.push_back(ShaderParam("ia_luminance", 0, 104, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Luminance"));
-		Params.push_back(ShaderParam("ia_contrast", 0, 108, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_bright_boost", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_black_level", 0, 116, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Black Level"));
-		Params.push_back(ShaderParam("ia_target_gamma_r", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_target_gamma_g", 0, 124, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_target_gamma_b", 0, 128, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_monitor_gamma", 0, 132, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_TOPMASK", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Top"));
-		Params.push_back(ShaderParam("ia_BOTMASK", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Bottom"));
-		Params.push_back(ShaderParam("ia_LMASK", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Left"));
-		Params.push_back(ShaderParam("ia_RMASK", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Right"));
-		Params.push_back(ShaderParam("ia_rr", 0, 152, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Red Channel"));
-		Params.push_back(ShaderParam("ia_gg", 0, 156, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Green Channel"));
-		Params.push_back(ShaderParam("ia_bb", 0, 160, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Blue Channel"));
-		Params.push_back(ShaderParam("ia_rg", 0, 164, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_rb", 0, 168, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_gr", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_gb", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_br", 0, 180, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ia_bg", 0, 184, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("temperature", 0, 188, 4, 1031.000000f, 12047.000000f, 6500.000000f, 72.000000f, "White Point"));
-		Params.push_back(ShaderParam("luma_preserve", 0, 192, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Preserve Luminance"));
-		Params.push_back(ShaderParam("wp_red", 0, 196, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Red Shift"));
-		Params.push_back(ShaderParam("wp_green", 0, 200, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Green Shift"));
-		Params.push_back(ShaderParam("wp_blue", 0, 204, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Blue Shift"));
-		Params.push_back(ShaderParam("ar_num", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ar_den", 0, 212, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("integer_scale", 0, 216, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("overscale", 0, 220, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_hpfix", 0, 224, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Contrast Hotspot Fix"));
-		Params.push_back(ShaderParam("g_cntrst", 0, 228, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Contrast"));
-		Params.push_back(ShaderParam("g_mid", 0, 232, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Contrast Pivot"));
-		Params.push_back(ShaderParam("mask_strength", 0, 236, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Phosphor Mask Strength"));
-		Params.push_back(ShaderParam("mask_picker", 0, 240, 4, 0.000000f, 19.000000f, 0.000000f, 1.000000f, "Phosphor Mask Layout"));
-		Params.push_back(ShaderParam("LUT_Size1", 0, 244, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_Size2", 0, 248, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vignette", 0, 252, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vstr", 0, 256, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("g_vpower", 0, 260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("gamma_in_lvl", 0, 264, 4, 0.000000f, 3.000000f, 2.400000f, 0.050000f, "CRT Gamma"));
-		Params.push_back(ShaderParam("gamma_out_lvl", 0, 268, 4, 0.000000f, 3.000000f, 2.200000f, 0.050000f, "LCD Gamma"));
-		Params.push_back(ShaderParam("warpX", 0, 272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("warpY", 0, 276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("cornersize", 0, 280, 4, 0.001000f, 1.000000f, 0.030000f, 0.005000f, "Corner Size"));
-		Params.push_back(ShaderParam("cornersmooth", 0, 284, 4, 80.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Corner Smoothness"));
-		Params.push_back(ShaderParam("Radius", 0, 288, 4, 0.100000f, 10.000000f, 2.000000f, 0.100000f, "cgwg Curvature Radius"));
-		Params.push_back(ShaderParam("Distance", 0, 292, 4, 0.100000f, 3.000000f, 1.500000f, 0.100000f, "cgwg Viewing Distance"));
-		Params.push_back(ShaderParam("x_tilt", 0, 296, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Horizontal Tilt"));
-		Params.push_back(ShaderParam("y_tilt", 0, 300, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Vertical Tilt"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "img_mod";
+	VertexByteCode = RetroArchMiscShadersImg_modShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersImg_modShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersImg_modShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersImg_modShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_FLIP_HORZ", 0, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Horiz Axis"));
+	Params.push_back(ShaderParam("ia_FLIP_VERT", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Vert Axis"));
+	Params.push_back(ShaderParam("ia_overscan_percent_x", 0, 72, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Stretch Width"));
+	Params.push_back(ShaderParam("ia_overscan_percent_y", 0, 76, 4, -25.000000f, 25.000000f, 0.000000f, 1.000000f, "Stretch Height"));
+	Params.push_back(ShaderParam("ia_ZOOM", 0, 80, 4, 0.000000f, 4.000000f, 1.000000f, 0.010000f, "Zoom In/Out"));
+	Params.push_back(ShaderParam("ia_XPOS", 0, 84, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "Pan X"));
+	Params.push_back(ShaderParam("ia_YPOS", 0, 88, 4, -2.000000f, 2.000000f, 0.000000f, 0.005000f, "Pan Y"));
+	Params.push_back(ShaderParam("ia_GRAIN_STR", 0, 92, 4, 0.000000f, 72.000000f, 0.000000f, 3.000000f, "Grain Strength"));
+	Params.push_back(ShaderParam("ia_SHARPEN", 0, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Sharpen"));
+	Params.push_back(ShaderParam("ia_saturation", 0, 100, 4, 0.010000f, 2.000000f, 1.000000f, 0.010000f, "Chrominance"));
+	Params.push_back(ShaderParam("ia_luminance", 0, 104, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Luminance"));
+	Params.push_back(ShaderParam("ia_contrast", 0, 108, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_bright_boost", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_black_level", 0, 116, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "Black Level"));
+	Params.push_back(ShaderParam("ia_target_gamma_r", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_target_gamma_g", 0, 124, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_target_gamma_b", 0, 128, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_monitor_gamma", 0, 132, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_TOPMASK", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Top"));
+	Params.push_back(ShaderParam("ia_BOTMASK", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Bottom"));
+	Params.push_back(ShaderParam("ia_LMASK", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Left"));
+	Params.push_back(ShaderParam("ia_RMASK", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 0.002500f, "Overscan Mask Right"));
+	Params.push_back(ShaderParam("ia_rr", 0, 152, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Red Channel"));
+	Params.push_back(ShaderParam("ia_gg", 0, 156, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Green Channel"));
+	Params.push_back(ShaderParam("ia_bb", 0, 160, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Blue Channel"));
+	Params.push_back(ShaderParam("ia_rg", 0, 164, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_rb", 0, 168, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_gr", 0, 172, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_gb", 0, 176, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_br", 0, 180, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ia_bg", 0, 184, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("temperature", 0, 188, 4, 1031.000000f, 12047.000000f, 6500.000000f, 72.000000f, "White Point"));
+	Params.push_back(ShaderParam("luma_preserve", 0, 192, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Preserve Luminance"));
+	Params.push_back(ShaderParam("wp_red", 0, 196, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Red Shift"));
+	Params.push_back(ShaderParam("wp_green", 0, 200, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Green Shift"));
+	Params.push_back(ShaderParam("wp_blue", 0, 204, 4, -1.000000f, 1.000000f, 0.000000f, 0.010000f, "Blue Shift"));
+	Params.push_back(ShaderParam("ar_num", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ar_den", 0, 212, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("integer_scale", 0, 216, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("overscale", 0, 220, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_hpfix", 0, 224, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Contrast Hotspot Fix"));
+	Params.push_back(ShaderParam("g_cntrst", 0, 228, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Contrast"));
+	Params.push_back(ShaderParam("g_mid", 0, 232, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Contrast Pivot"));
+	Params.push_back(ShaderParam("mask_strength", 0, 236, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Phosphor Mask Strength"));
+	Params.push_back(ShaderParam("mask_picker", 0, 240, 4, 0.000000f, 19.000000f, 0.000000f, 1.000000f, "Phosphor Mask Layout"));
+	Params.push_back(ShaderParam("LUT_Size1", 0, 244, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_Size2", 0, 248, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vignette", 0, 252, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vstr", 0, 256, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("g_vpower", 0, 260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("gamma_in_lvl", 0, 264, 4, 0.000000f, 3.000000f, 2.400000f, 0.050000f, "CRT Gamma"));
+	Params.push_back(ShaderParam("gamma_out_lvl", 0, 268, 4, 0.000000f, 3.000000f, 2.200000f, 0.050000f, "LCD Gamma"));
+	Params.push_back(ShaderParam("warpX", 0, 272, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("warpY", 0, 276, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("cornersize", 0, 280, 4, 0.001000f, 1.000000f, 0.030000f, 0.005000f, "Corner Size"));
+	Params.push_back(ShaderParam("cornersmooth", 0, 284, 4, 80.000000f, 2000.000000f, 1000.000000f, 100.000000f, "Corner Smoothness"));
+	Params.push_back(ShaderParam("Radius", 0, 288, 4, 0.100000f, 10.000000f, 2.000000f, 0.100000f, "cgwg Curvature Radius"));
+	Params.push_back(ShaderParam("Distance", 0, 292, 4, 0.100000f, 3.000000f, 1.500000f, 0.100000f, "cgwg Viewing Distance"));
+	Params.push_back(ShaderParam("x_tilt", 0, 296, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Horizontal Tilt"));
+	Params.push_back(ShaderParam("y_tilt", 0, 300, 4, -0.500000f, 0.500000f, 0.000000f, 0.050000f, "Vertical Tilt"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersInterlacingShaderDef : public ShaderDef
+{
+public:
+	MiscShadersInterlacingShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersInterlacingShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -457,34 +468,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersInterlacingShaderDef : public ShaderDef
+RetroArch::MiscShadersInterlacingShaderDef::MiscShadersInterlacingShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersInterlacingShaderDef() : ShaderDef{}
-	{
-		Name = "interlacing";
-		VertexByteCode = RetroArchMiscShadersInterlacingShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersInterlacingShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersInterlacingShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersInterlacingShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("percent", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Interlacing Scanline Bright %"));
-		Params.push_back(ShaderParam("enable_480i", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Enable 480i Mode"));
-		Params.push_back(ShaderParam("top_field_first", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Top Field First Enable"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "interlacing";
+	VertexByteCode = RetroArchMiscShadersInterlacingShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersInterlacingShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersInterlacingShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersInterlacingShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("percent", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Interlacing Scanline Bright %"));
+	Params.push_back(ShaderParam("enable_480i", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Enable 480i Mode"));
+	Params.push_back(ShaderParam("top_field_first", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Top Field First Enable"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
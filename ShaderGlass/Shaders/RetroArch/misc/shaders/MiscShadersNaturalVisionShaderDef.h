@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersNaturalVisionShaderDef : public ShaderDef
+{
+public:
+	MiscShadersNaturalVisionShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersNaturalVisionShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -489,34 +500,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersNaturalVisionShaderDef : public ShaderDef
+RetroArch::MiscShadersNaturalVisionShaderDef::MiscShadersNaturalVisionShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersNaturalVisionShaderDef() : ShaderDef{}
-	{
-		Name = "natural-vision";
-		VertexByteCode = RetroArchMiscShadersNaturalVisionShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersNaturalVisionShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersNaturalVisionShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersNaturalVisionShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("GIN", -1, 32, 4, 0.000000f, 10.000000f, 2.200000f, 0.050000f, "NaturalVision Gamma In"));
-		Params.push_back(ShaderParam("GOUT", -1, 36, 4, 0.000000f, 10.000000f, 2.200000f, 0.050000f, "NaturalVision Gamma Out"));
-		Params.push_back(ShaderParam("Y", -1, 40, 4, 0.000000f, 10.000000f, 1.100000f, 0.010000f, "NaturalVision Luminance"));
-		Params.push_back(ShaderParam("I", -1, 44, 4, 0.000000f, 10.000000f, 1.100000f, 0.010000f, "NaturalVision Orange-Cyan"));
-		Params.push_back(ShaderParam("Q", -1, 48, 4, 0.000000f, 10.000000f, 1.100000f, 0.010000f, "NaturalVision Magenta-Green"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "natural-vision";
+	VertexByteCode = RetroArchMiscShadersNaturalVisionShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersNaturalVisionShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersNaturalVisionShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersNaturalVisionShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("GIN", -1, 32, 4, 0.000000f, 10.000000f, 2.200000f, 0.050000f, "NaturalVision Gamma In"));
+	Params.push_back(ShaderParam("GOUT", -1, 36, 4, 0.000000f, 10.000000f, 2.200000f, 0.050000f, "NaturalVision Gamma Out"));
+	Params.push_back(ShaderParam("Y", -1, 40, 4, 0.000000f, 10.000000f, 1.100000f, 0.010000f, "NaturalVision Luminance"));
+	Params.push_back(ShaderParam("I", -1, 44, 4, 0.000000f, 10.000000f, 1.100000f, 0.010000f, "NaturalVision Orange-Cyan"));
+	Params.push_back(ShaderParam("Q", -1, 48, 4, 0.000000f, 10.000000f, 1.100000f, 0.010000f, "NaturalVision Magenta-Green"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -43,6 +43,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersNtscColorsShaderDef : public ShaderDef
+{
+public:
+	MiscShadersNtscColorsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersNtscColorsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -509,32 +520,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersNtscColorsShaderDef : public ShaderDef
+RetroArch::MiscShadersNtscColorsShaderDef::MiscShadersNtscColorsShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersNtscColorsShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-colors";
-		VertexByteCode = RetroArchMiscShadersNtscColorsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersNtscColorsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersNtscColorsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersNtscColorsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("intensity", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "NTSC Intensity"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-colors";
+	VertexByteCode = RetroArchMiscShadersNtscColorsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersNtscColorsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersNtscColorsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersNtscColorsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("intensity", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "NTSC Intensity"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersReliefShaderDef : public ShaderDef
+{
+public:
+	MiscShadersReliefShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersReliefShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -628,31 +639,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersReliefShaderDef : public ShaderDef
+RetroArch::MiscShadersReliefShaderDef::MiscShadersReliefShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersReliefShaderDef() : ShaderDef{}
-	{
-		Name = "relief";
-		VertexByteCode = RetroArchMiscShadersReliefShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersReliefShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersReliefShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersReliefShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "relief";
+	VertexByteCode = RetroArchMiscShadersReliefShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersReliefShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersReliefShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersReliefShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersRetroPalettesShaderDef : public ShaderDef
+{
+public:
+	MiscShadersRetroPalettesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersRetroPalettesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -382,32 +393,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersRetroPalettesShaderDef : public ShaderDef
+RetroArch::MiscShadersRetroPalettesShaderDef::MiscShadersRetroPalettesShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersRetroPalettesShaderDef() : ShaderDef{}
-	{
-		Name = "retro-palettes";
-		VertexByteCode = RetroArchMiscShadersRetroPalettesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersRetroPalettesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersRetroPalettesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersRetroPalettesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pal", -1, 52, 4, 1.000000f, 15.000000f, 1.000000f, 1.000000f, "color palette colors: (1+x)^3"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "retro-palettes";
+	VertexByteCode = RetroArchMiscShadersRetroPalettesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersRetroPalettesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersRetroPalettesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersRetroPalettesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pal", -1, 52, 4, 1.000000f, 15.000000f, 1.000000f, 1.000000f, "color palette colors: (1+x)^3"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
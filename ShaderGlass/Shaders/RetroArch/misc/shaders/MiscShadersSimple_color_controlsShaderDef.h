@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersSimple_color_controlsShaderDef : public ShaderDef
+{
+public:
+	MiscShadersSimple_color_controlsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersSimple_color_controlsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1185,52 +1196,46 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersSimple_color_controlsShaderDef : public ShaderDef
+RetroArch::MiscShadersSimple_color_controlsShaderDef::MiscShadersSimple_color_controlsShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersSimple_color_controlsShaderDef() : ShaderDef{}
-	{
-		Name = "simple_color_controls";
-		VertexByteCode = RetroArchMiscShadersSimple_color_controlsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersSimple_color_controlsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersSimple_color_controlsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersSimple_color_controlsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("sc_sat", -1, 0, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Saturation"));
-		Params.push_back(ShaderParam("sc_black", -1, 4, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "Black Level"));
-		Params.push_back(ShaderParam("sc_temp", -1, 8, 4, 1031.000000f, 12047.000000f, 6863.000000f, 72.000000f, "Color Temperature in Kelvins (NTSC-J 9300)"));
-		Params.push_back(ShaderParam("sc_sega", -1, 12, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Lum Fix: ST/GEN-CPC-AMIGA"));
-		Params.push_back(ShaderParam("sc_brightness", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("sc_postbr", -1, 20, 4, 1.000000f, 2.000000f, 1.000000f, 0.050000f, "Bright Boost"));
-		Params.push_back(ShaderParam("sc_contrast", -1, 24, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Contrast"));
-		Params.push_back(ShaderParam("sc_gamma_out", -1, 28, 4, 1.000000f, 4.000000f, 2.200000f, 0.050000f, "Gamma out"));
-		Params.push_back(ShaderParam("sc_gamma_in", -1, 32, 4, 1.000000f, 4.000000f, 2.400000f, 0.050000f, "Gamma In"));
-		Params.push_back(ShaderParam("sc_mono", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mono Display On/Off"));
-		Params.push_back(ShaderParam("sc_r", -1, 40, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Mono Red/Channel"));
-		Params.push_back(ShaderParam("sc_g", -1, 44, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Mono Green/Channel"));
-		Params.push_back(ShaderParam("sc_b", -1, 48, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Mono Blue/Channel"));
-		Params.push_back(ShaderParam("sc_cs", -1, 52, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Colors: sRGB, PAL, NTSC-U, NTSC-J"));
-		Params.push_back(ShaderParam("sc_rg", -1, 56, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Green <-to-> Red Hue"));
-		Params.push_back(ShaderParam("sc_rb", -1, 60, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Red Hue"));
-		Params.push_back(ShaderParam("sc_gb", -1, 64, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Green Hue"));
-		Params.push_back(ShaderParam("r_out", -1, 68, 4, 0.000000f, 1.000000f, 0.290000f, 0.010000f, "CRT Red Vibrancy"));
-		Params.push_back(ShaderParam("g_out", -1, 72, 4, 0.000000f, 1.000000f, 0.620000f, 0.010000f, "CRT Green Vibrancy"));
-		Params.push_back(ShaderParam("b_out", -1, 76, 4, 0.000000f, 1.000000f, 0.090000f, 0.010000f, "CRT Blue Vibrancy"));
-		Params.push_back(ShaderParam("sc_postdk", -1, 80, 4, 1.000000f, 2.000000f, 1.000000f, 0.050000f, "Dark Boost"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "simple_color_controls";
+	VertexByteCode = RetroArchMiscShadersSimple_color_controlsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersSimple_color_controlsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersSimple_color_controlsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersSimple_color_controlsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("sc_sat", -1, 0, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Saturation"));
+	Params.push_back(ShaderParam("sc_black", -1, 4, 4, -0.200000f, 0.200000f, 0.000000f, 0.010000f, "Black Level"));
+	Params.push_back(ShaderParam("sc_temp", -1, 8, 4, 1031.000000f, 12047.000000f, 6863.000000f, 72.000000f, "Color Temperature in Kelvins (NTSC-J 9300)"));
+	Params.push_back(ShaderParam("sc_sega", -1, 12, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Lum Fix: ST/GEN-CPC-AMIGA"));
+	Params.push_back(ShaderParam("sc_brightness", -1, 16, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("sc_postbr", -1, 20, 4, 1.000000f, 2.000000f, 1.000000f, 0.050000f, "Bright Boost"));
+	Params.push_back(ShaderParam("sc_contrast", -1, 24, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Contrast"));
+	Params.push_back(ShaderParam("sc_gamma_out", -1, 28, 4, 1.000000f, 4.000000f, 2.200000f, 0.050000f, "Gamma out"));
+	Params.push_back(ShaderParam("sc_gamma_in", -1, 32, 4, 1.000000f, 4.000000f, 2.400000f, 0.050000f, "Gamma In"));
+	Params.push_back(ShaderParam("sc_mono", -1, 36, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Mono Display On/Off"));
+	Params.push_back(ShaderParam("sc_r", -1, 40, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Mono Red/Channel"));
+	Params.push_back(ShaderParam("sc_g", -1, 44, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Mono Green/Channel"));
+	Params.push_back(ShaderParam("sc_b", -1, 48, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Mono Blue/Channel"));
+	Params.push_back(ShaderParam("sc_cs", -1, 52, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Colors: sRGB, PAL, NTSC-U, NTSC-J"));
+	Params.push_back(ShaderParam("sc_rg", -1, 56, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Green <-to-> Red Hue"));
+	Params.push_back(ShaderParam("sc_rb", -1, 60, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Red Hue"));
+	Params.push_back(ShaderParam("sc_gb", -1, 64, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Blue <-to-> Green Hue"));
+	Params.push_back(ShaderParam("r_out", -1, 68, 4, 0.000000f, 1.000000f, 0.290000f, 0.010000f, "CRT Red Vibrancy"));
+	Params.push_back(ShaderParam("g_out", -1, 72, 4, 0.000000f, 1.000000f, 0.620000f, 0.010000f, "CRT Green Vibrancy"));
+	Params.push_back(ShaderParam("b_out", -1, 76, 4, 0.000000f, 1.000000f, 0.090000f, 0.010000f, "CRT Blue Vibrancy"));
+	Params.push_back(ShaderParam("sc_postdk", -1, 80, 4, 1.000000f, 2.000000f, 1.000000f, 0.050000f, "Dark Boost"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersSsGammaRampShaderDef : public ShaderDef
+{
+public:
+	MiscShadersSsGammaRampShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersSsGammaRampShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -548,32 +559,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersSsGammaRampShaderDef : public ShaderDef
+RetroArch::MiscShadersSsGammaRampShaderDef::MiscShadersSsGammaRampShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersSsGammaRampShaderDef() : ShaderDef{}
-	{
-		Name = "ss-gamma-ramp";
-		VertexByteCode = RetroArchMiscShadersSsGammaRampShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersSsGammaRampShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersSsGammaRampShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersSsGammaRampShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mixer", -1, 52, 4, 100.000000f, 200.000000f, 150.000000f, 1.000000f, "Gamma Boost (%)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ss-gamma-ramp";
+	VertexByteCode = RetroArchMiscShadersSsGammaRampShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersSsGammaRampShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersSsGammaRampShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersSsGammaRampShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mixer", -1, 52, 4, 100.000000f, 200.000000f, 150.000000f, 1.000000f, "Gamma Boost (%)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersTonemappingShaderDef : public ShaderDef
+{
+public:
+	MiscShadersTonemappingShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersTonemappingShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -800,34 +811,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersTonemappingShaderDef : public ShaderDef
+RetroArch::MiscShadersTonemappingShaderDef::MiscShadersTonemappingShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersTonemappingShaderDef() : ShaderDef{}
-	{
-		Name = "tonemapping";
-		VertexByteCode = RetroArchMiscShadersTonemappingShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersTonemappingShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersTonemappingShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersTonemappingShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MAP1", -1, 52, 4, 0.000000f, 7.000000f, 0.000000f, 1.000000f, "Tone Map Method Left"));
-		Params.push_back(ShaderParam("MAP2", -1, 56, 4, 0.000000f, 7.000000f, 0.000000f, 1.000000f, "Tone Map Method Right"));
-		Params.push_back(ShaderParam("SPLIT_LINE", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Split Location"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "tonemapping";
+	VertexByteCode = RetroArchMiscShadersTonemappingShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersTonemappingShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersTonemappingShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersTonemappingShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MAP1", -1, 52, 4, 0.000000f, 7.000000f, 0.000000f, 1.000000f, "Tone Map Method Left"));
+	Params.push_back(ShaderParam("MAP2", -1, 56, 4, 0.000000f, 7.000000f, 0.000000f, 1.000000f, "Tone Map Method Right"));
+	Params.push_back(ShaderParam("SPLIT_LINE", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Split Location"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
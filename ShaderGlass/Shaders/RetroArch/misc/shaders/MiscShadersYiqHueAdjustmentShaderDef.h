@@ -43,6 +43,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersYiqHueAdjustmentShaderDef : public ShaderDef
+{
+public:
+	MiscShadersYiqHueAdjustmentShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersYiqHueAdjustmentShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -602,32 +613,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersYiqHueAdjustmentShaderDef : public ShaderDef
+RetroArch::MiscShadersYiqHueAdjustmentShaderDef::MiscShadersYiqHueAdjustmentShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersYiqHueAdjustmentShaderDef() : ShaderDef{}
-	{
-		Name = "yiq-hue-adjustment";
-		VertexByteCode = RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("hue_degrees", -1, 52, 4, -360.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "yiq-hue-adjustment";
+	VertexByteCode = RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersYiqHueAdjustmentShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("hue_degrees", -1, 52, 4, -360.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersDeposterizeDeposterizePass0ShaderDef : public ShaderDef
+{
+public:
+	MiscShadersDeposterizeDeposterizePass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -674,33 +685,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersDeposterizeDeposterizePass0ShaderDef : public ShaderDef
+RetroArch::MiscShadersDeposterizeDeposterizePass0ShaderDef::MiscShadersDeposterizeDeposterizePass0ShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersDeposterizeDeposterizePass0ShaderDef() : ShaderDef{}
-	{
-		Name = "deposterize-pass0";
-		VertexByteCode = RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("EQ_THRESH1", -1, 52, 4, 0.000000f, 1.000000f, 0.010000f, 0.010000f, "Eq Limit Horizontal"));
-		Params.push_back(ShaderParam("DIFF_THRESH1", -1, 56, 4, 0.000000f, 1.000000f, 0.060000f, 0.010000f, "Diff Limit Horizontal"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "deposterize-pass0";
+	VertexByteCode = RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("EQ_THRESH1", -1, 52, 4, 0.000000f, 1.000000f, 0.010000f, 0.010000f, "Eq Limit Horizontal"));
+	Params.push_back(ShaderParam("DIFF_THRESH1", -1, 56, 4, 0.000000f, 1.000000f, 0.060000f, 0.010000f, "Diff Limit Horizontal"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
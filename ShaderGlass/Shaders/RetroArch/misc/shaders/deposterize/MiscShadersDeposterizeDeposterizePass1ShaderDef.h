@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MiscShadersDeposterizeDeposterizePass1ShaderDef : public ShaderDef
+{
+public:
+	MiscShadersDeposterizeDeposterizePass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -672,33 +683,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MiscShadersDeposterizeDeposterizePass1ShaderDef : public ShaderDef
+RetroArch::MiscShadersDeposterizeDeposterizePass1ShaderDef::MiscShadersDeposterizeDeposterizePass1ShaderDef() : ShaderDef{}
 {
-public:
-	MiscShadersDeposterizeDeposterizePass1ShaderDef() : ShaderDef{}
-	{
-		Name = "deposterize-pass1";
-		VertexByteCode = RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("EQ_THRESH2", -1, 52, 4, 0.000000f, 1.000000f, 0.010000f, 0.010000f, "Eq Limit Vertical"));
-		Params.push_back(ShaderParam("DIFF_THRESH2", -1, 56, 4, 0.000000f, 1.000000f, 0.060000f, 0.010000f, "Diff Limit Vertical"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "deposterize-pass1";
+	VertexByteCode = RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMiscShadersDeposterizeDeposterizePass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("EQ_THRESH2", -1, 52, 4, 0.000000f, 1.000000f, 0.010000f, 0.010000f, "Eq Limit Vertical"));
+	Params.push_back(ShaderParam("DIFF_THRESH2", -1, 56, 4, 0.000000f, 1.000000f, 0.060000f, 0.010000f, "Diff Limit Vertical"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
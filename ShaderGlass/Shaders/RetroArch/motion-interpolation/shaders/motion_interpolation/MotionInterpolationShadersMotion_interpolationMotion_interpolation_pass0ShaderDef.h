@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef : public ShaderDef
+{
+public:
+	MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -720,32 +731,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef : public ShaderDef
+RetroArch::MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef::MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef() : ShaderDef{}
 {
-public:
-	MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef() : ShaderDef{}
-	{
-		Name = "motion_interpolation_pass0";
-		VertexByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "motion_interpolation_pass0";
+	VertexByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
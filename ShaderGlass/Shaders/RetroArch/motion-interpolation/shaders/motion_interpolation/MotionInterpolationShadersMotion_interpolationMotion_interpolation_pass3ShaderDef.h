@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef : public ShaderDef
+{
+public:
+	MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -468,36 +479,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef : public ShaderDef
+RetroArch::MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef::MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef() : ShaderDef{}
 {
-public:
-	MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef() : ShaderDef{}
-	{
-		Name = "motion_interpolation_pass3";
-		VertexByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("MOTION_SCALE_FACTOR", -1, 52, 4, 100.000000f, 1000.000000f, 300.000000f, 50.000000f, "Motion Interp Factor"));
-		Params.push_back(ShaderParam("MOTION_MIX_FACTOR", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Motion Blur Factor"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("Pass0", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("Original", 5));
+	Name = "motion_interpolation_pass3";
+	VertexByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("MOTION_SCALE_FACTOR", -1, 52, 4, 100.000000f, 1000.000000f, 300.000000f, 50.000000f, "Motion Interp Factor"));
+	Params.push_back(ShaderParam("MOTION_MIX_FACTOR", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Motion Blur Factor"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("Pass0", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("Original", 5));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionblurShadersBraidRewindShaderDef : public ShaderDef
+{
+public:
+	MotionblurShadersBraidRewindShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionblurShadersBraidRewindShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -683,38 +694,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionblurShadersBraidRewindShaderDef : public ShaderDef
+RetroArch::MotionblurShadersBraidRewindShaderDef::MotionblurShadersBraidRewindShaderDef() : ShaderDef{}
 {
-public:
-	MotionblurShadersBraidRewindShaderDef() : ShaderDef{}
-	{
-		Name = "braid-rewind";
-		VertexByteCode = RetroArchMotionblurShadersBraidRewindShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionblurShadersBraidRewindShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionblurShadersBraidRewindShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionblurShadersBraidRewindShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
-		Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
-		Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
-		Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Name = "braid-rewind";
+	VertexByteCode = RetroArchMotionblurShadersBraidRewindShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionblurShadersBraidRewindShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionblurShadersBraidRewindShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionblurShadersBraidRewindShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
+	Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
+	Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
+	Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionblurShadersFeedbackShaderDef : public ShaderDef
+{
+public:
+	MotionblurShadersFeedbackShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionblurShadersFeedbackShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -432,32 +443,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionblurShadersFeedbackShaderDef : public ShaderDef
+RetroArch::MotionblurShadersFeedbackShaderDef::MotionblurShadersFeedbackShaderDef() : ShaderDef{}
 {
-public:
-	MotionblurShadersFeedbackShaderDef() : ShaderDef{}
-	{
-		Name = "feedback";
-		VertexByteCode = RetroArchMotionblurShadersFeedbackShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionblurShadersFeedbackShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionblurShadersFeedbackShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionblurShadersFeedbackShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("mixfactor", -1, 0, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Motionblur Fadeout"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PassFeedback0", 3));
+	Name = "feedback";
+	VertexByteCode = RetroArchMotionblurShadersFeedbackShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionblurShadersFeedbackShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionblurShadersFeedbackShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionblurShadersFeedbackShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("mixfactor", -1, 0, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Motionblur Fadeout"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PassFeedback0", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
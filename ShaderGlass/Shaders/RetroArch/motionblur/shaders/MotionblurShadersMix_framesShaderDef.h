@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionblurShadersMix_framesShaderDef : public ShaderDef
+{
+public:
+	MotionblurShadersMix_framesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionblurShadersMix_framesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -330,28 +341,22 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionblurShadersMix_framesShaderDef : public ShaderDef
+RetroArch::MotionblurShadersMix_framesShaderDef::MotionblurShadersMix_framesShaderDef() : ShaderDef{}
 {
-public:
-	MotionblurShadersMix_framesShaderDef() : ShaderDef{}
-	{
-		Name = "mix_frames";
-		VertexByteCode = RetroArchMotionblurShadersMix_framesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionblurShadersMix_framesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionblurShadersMix_framesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionblurShadersMix_framesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Name = "mix_frames";
+	VertexByteCode = RetroArchMotionblurShadersMix_framesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionblurShadersMix_framesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionblurShadersMix_framesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionblurShadersMix_framesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionblurShadersMix_frames_smartShaderDef : public ShaderDef
+{
+public:
+	MotionblurShadersMix_frames_smartShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionblurShadersMix_frames_smartShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -990,33 +1001,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionblurShadersMix_frames_smartShaderDef : public ShaderDef
+RetroArch::MotionblurShadersMix_frames_smartShaderDef::MotionblurShadersMix_frames_smartShaderDef() : ShaderDef{}
 {
-public:
-	MotionblurShadersMix_frames_smartShaderDef() : ShaderDef{}
-	{
-		Name = "mix_frames_smart";
-		VertexByteCode = RetroArchMotionblurShadersMix_frames_smartShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionblurShadersMix_frames_smartShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionblurShadersMix_frames_smartShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionblurShadersMix_frames_smartShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DEFLICKER_EMPHASIS", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Deflicker Emphasis"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
-		Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
-		Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
+	Name = "mix_frames_smart";
+	VertexByteCode = RetroArchMotionblurShadersMix_frames_smartShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionblurShadersMix_frames_smartShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionblurShadersMix_frames_smartShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionblurShadersMix_frames_smartShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DEFLICKER_EMPHASIS", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Deflicker Emphasis"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
+	Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
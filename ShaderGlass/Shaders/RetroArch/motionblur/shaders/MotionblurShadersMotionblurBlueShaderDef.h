@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class MotionblurShadersMotionblurBlueShaderDef : public ShaderDef
+{
+public:
+	MotionblurShadersMotionblurBlueShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchMotionblurShadersMotionblurBlueShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -573,37 +584,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class MotionblurShadersMotionblurBlueShaderDef : public ShaderDef
+RetroArch::MotionblurShadersMotionblurBlueShaderDef::MotionblurShadersMotionblurBlueShaderDef() : ShaderDef{}
 {
-public:
-	MotionblurShadersMotionblurBlueShaderDef() : ShaderDef{}
-	{
-		Name = "motionblur-blue";
-		VertexByteCode = RetroArchMotionblurShadersMotionblurBlueShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchMotionblurShadersMotionblurBlueShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchMotionblurShadersMotionblurBlueShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchMotionblurShadersMotionblurBlueShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
-		Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
-		Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
-		Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
-		Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
-		Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
-		Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "motionblur-blue";
+	VertexByteCode = RetroArchMotionblurShadersMotionblurBlueShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchMotionblurShadersMotionblurBlueShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchMotionblurShadersMotionblurBlueShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchMotionblurShadersMotionblurBlueShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Samplers.push_back(ShaderSampler("OriginalHistory2", 4));
+	Samplers.push_back(ShaderSampler("OriginalHistory3", 5));
+	Samplers.push_back(ShaderSampler("OriginalHistory4", 6));
+	Samplers.push_back(ShaderSampler("OriginalHistory5", 7));
+	Samplers.push_back(ShaderSampler("OriginalHistory6", 8));
+	Samplers.push_back(ShaderSampler("OriginalHistory7", 9));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -27,6 +27,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersNesColorDecoderShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersNesColorDecoderShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -988,38 +999,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersNesColorDecoderShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersNesColorDecoderShaderDef::Nes_raw_paletteShadersNesColorDecoderShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersNesColorDecoderShaderDef() : ShaderDef{}
-	{
-		Name = "nes-color-decoder";
-		VertexByteCode = RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("nes_saturation", -1, 0, 4, 0.000000f, 5.000000f, 1.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("nes_hue", -1, 4, 4, -360.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
-		Params.push_back(ShaderParam("nes_contrast", -1, 8, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Contrast"));
-		Params.push_back(ShaderParam("nes_brightness", -1, 12, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Brightness"));
-		Params.push_back(ShaderParam("nes_gamma", -1, 16, 4, 1.000000f, 2.500000f, 1.800000f, 0.050000f, "Gamma"));
-		Params.push_back(ShaderParam("nes_sony_matrix", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sony CXA2025AS US colors"));
-		Params.push_back(ShaderParam("nes_clip_method", -1, 24, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Palette clipping method"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "nes-color-decoder";
+	VertexByteCode = RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersNesColorDecoderShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("nes_saturation", -1, 0, 4, 0.000000f, 5.000000f, 1.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("nes_hue", -1, 4, 4, -360.000000f, 360.000000f, 0.000000f, 1.000000f, "Hue"));
+	Params.push_back(ShaderParam("nes_contrast", -1, 8, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Contrast"));
+	Params.push_back(ShaderParam("nes_brightness", -1, 12, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Brightness"));
+	Params.push_back(ShaderParam("nes_gamma", -1, 16, 4, 1.000000f, 2.500000f, 1.800000f, 0.050000f, "Gamma"));
+	Params.push_back(ShaderParam("nes_sony_matrix", -1, 20, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sony CXA2025AS US colors"));
+	Params.push_back(ShaderParam("nes_clip_method", -1, 24, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Palette clipping method"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
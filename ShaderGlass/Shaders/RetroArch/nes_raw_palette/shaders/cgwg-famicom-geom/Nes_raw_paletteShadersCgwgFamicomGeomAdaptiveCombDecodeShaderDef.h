@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1832,33 +1843,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef::Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef() : ShaderDef{}
-	{
-		Name = "adaptive-comb-decode";
-		VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("encode_passSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("encode_pass", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "adaptive-comb-decode";
+	VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("encode_passSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("encode_pass", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
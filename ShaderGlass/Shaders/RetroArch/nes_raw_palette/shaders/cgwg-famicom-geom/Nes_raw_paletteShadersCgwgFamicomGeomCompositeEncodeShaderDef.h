@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -571,29 +582,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef::Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef() : ShaderDef{}
-	{
-		Name = "composite-encode";
-		VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "composite-encode";
+	VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
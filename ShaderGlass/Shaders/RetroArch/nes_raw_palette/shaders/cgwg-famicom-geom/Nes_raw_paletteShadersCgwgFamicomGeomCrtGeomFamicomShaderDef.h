@@ -82,6 +82,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2563,41 +2574,35 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef::Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef() : ShaderDef{}
-	{
-		Name = "crt-geom-famicom";
-		VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVATURE_toggle", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature Toggle"));
-		Params.push_back(ShaderParam("CRTgamma", -1, 56, 4, 1.000000f, 4.000000f, 2.400000f, 0.050000f, "CRT Gamma"));
-		Params.push_back(ShaderParam("overscan_x", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Overscan X"));
-		Params.push_back(ShaderParam("overscan_y", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Overscan Y"));
-		Params.push_back(ShaderParam("distance_cgwg", -1, 68, 4, 0.100000f, 5.000000f, 2.000000f, 0.100000f, "Viewing Distance"));
-		Params.push_back(ShaderParam("radius", -1, 72, 4, 0.100000f, 5.000000f, 2.000000f, 0.100000f, "Curvature Radius"));
-		Params.push_back(ShaderParam("tiltangle_x", -1, 76, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Tilt Angle X"));
-		Params.push_back(ShaderParam("tiltangle_y", -1, 80, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Tilt Angle Y"));
-		Params.push_back(ShaderParam("cornersize", -1, 84, 4, 0.000100f, 0.100000f, 0.020000f, 0.010000f, "Corner Size"));
-		Params.push_back(ShaderParam("cornersmooth", -1, 88, 4, 0.800000f, 2000.000000f, 800.000000f, 50.000000f, "Corner Smoothness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "crt-geom-famicom";
+	VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVATURE_toggle", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Curvature Toggle"));
+	Params.push_back(ShaderParam("CRTgamma", -1, 56, 4, 1.000000f, 4.000000f, 2.400000f, 0.050000f, "CRT Gamma"));
+	Params.push_back(ShaderParam("overscan_x", -1, 60, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Overscan X"));
+	Params.push_back(ShaderParam("overscan_y", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Overscan Y"));
+	Params.push_back(ShaderParam("distance_cgwg", -1, 68, 4, 0.100000f, 5.000000f, 2.000000f, 0.100000f, "Viewing Distance"));
+	Params.push_back(ShaderParam("radius", -1, 72, 4, 0.100000f, 5.000000f, 2.000000f, 0.100000f, "Curvature Radius"));
+	Params.push_back(ShaderParam("tiltangle_x", -1, 76, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Tilt Angle X"));
+	Params.push_back(ShaderParam("tiltangle_y", -1, 80, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Tilt Angle Y"));
+	Params.push_back(ShaderParam("cornersize", -1, 84, 4, 0.000100f, 0.100000f, 0.020000f, 0.010000f, "Corner Size"));
+	Params.push_back(ShaderParam("cornersmooth", -1, 88, 4, 0.800000f, 2000.000000f, 800.000000f, 50.000000f, "Corner Smoothness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
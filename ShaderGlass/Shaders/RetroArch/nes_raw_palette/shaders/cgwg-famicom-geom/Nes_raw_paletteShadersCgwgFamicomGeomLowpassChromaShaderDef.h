@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -656,33 +667,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef::Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef() : ShaderDef{}
-	{
-		Name = "lowpass-chroma";
-		VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("postfilter_taps", -1, 52, 4, 1.000000f, 30.000000f, 15.000000f, 1.000000f, "Post-filter Taps"));
-		Params.push_back(ShaderParam("postfilter_chromacutoff", -1, 56, 4, 0.100000f, 1.000000f, 0.300000f, 0.050000f, "Post-filter Chroma Cutoff"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lowpass-chroma";
+	VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("postfilter_taps", -1, 52, 4, 1.000000f, 30.000000f, 15.000000f, 1.000000f, "Post-filter Taps"));
+	Params.push_back(ShaderParam("postfilter_chromacutoff", -1, 56, 4, 0.100000f, 1.000000f, 0.300000f, 0.050000f, "Post-filter Chroma Cutoff"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1247,34 +1258,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef::Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef() : ShaderDef{}
-	{
-		Name = "lowpass-notch-decode-yiq";
-		VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("filter_taps", -1, 52, 4, 1.000000f, 30.000000f, 15.000000f, 1.000000f, "Filter Taps"));
-		Params.push_back(ShaderParam("lumacutoff", -1, 56, 4, 0.100000f, 1.000000f, 0.900000f, 0.050000f, "Luma Cutoff"));
-		Params.push_back(ShaderParam("chromacutoff", -1, 60, 4, 0.100000f, 1.000000f, 0.300000f, 0.050000f, "Chroma Cutoff"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lowpass-notch-decode-yiq";
+	VertexByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("filter_taps", -1, 52, 4, 1.000000f, 30.000000f, 15.000000f, 1.000000f, "Filter Taps"));
+	Params.push_back(ShaderParam("lumacutoff", -1, 56, 4, 0.100000f, 1.000000f, 0.900000f, 0.050000f, "Luma Cutoff"));
+	Params.push_back(ShaderParam("chromacutoff", -1, 60, 4, 0.100000f, 1.000000f, 0.300000f, 0.050000f, "Chroma Cutoff"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -635,33 +646,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef::Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef() : ShaderDef{}
-	{
-		Name = "combFilter";
-		VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sFragmentByteCode);
-		Format = "R16G16B16A16_SFLOAT";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("combFilter", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "comb filter"));
-		Params.push_back(ShaderParam("phaseOffset", -1, 56, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "phase offset"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "combFilter";
+	VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomCombFilterShaderDefs::sFragmentByteCode);
+	Format = "R16G16B16A16_SFLOAT";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("combFilter", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "comb filter"));
+	Params.push_back(ShaderParam("phaseOffset", -1, 56, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "phase offset"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
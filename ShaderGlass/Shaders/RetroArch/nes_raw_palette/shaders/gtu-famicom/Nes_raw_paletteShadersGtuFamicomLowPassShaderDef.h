@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersGtuFamicomLowPassShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersGtuFamicomLowPassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -622,34 +633,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersGtuFamicomLowPassShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersGtuFamicomLowPassShaderDef::Nes_raw_paletteShadersGtuFamicomLowPassShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersGtuFamicomLowPassShaderDef() : ShaderDef{}
-	{
-		Name = "lowPass";
-		VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("signalResolution", -1, 48, 4, 20.000000f, 2000.000000f, 700.000000f, 10.000000f, "Signal Resolution"));
-		Params.push_back(ShaderParam("addNoise", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Add Noise"));
-		Params.push_back(ShaderParam("noiseStrength", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Noise Strength"));
-		Params.push_back(ShaderParam("FrameCount", -1, 60, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "lowPass";
+	VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomLowPassShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("signalResolution", -1, 48, 4, 20.000000f, 2000.000000f, 700.000000f, 10.000000f, "Signal Resolution"));
+	Params.push_back(ShaderParam("addNoise", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Add Noise"));
+	Params.push_back(ShaderParam("noiseStrength", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Noise Strength"));
+	Params.push_back(ShaderParam("FrameCount", -1, 60, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class Nes_raw_paletteShadersGtuFamicomNesTableTextureDef : public TextureDef
+{
+public:
+	Nes_raw_paletteShadersGtuFamicomNesTableTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace Nes_raw_paletteShadersGtuFamicomNesTableTextureDefs
 {
 const BYTE sData[] =
@@ -21,13 +29,10 @@ const BYTE sData[] =
 ,224,80,1,56,81,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class Nes_raw_paletteShadersGtuFamicomNesTableTextureDef : public TextureDef
+Nes_raw_paletteShadersGtuFamicomNesTableTextureDef::Nes_raw_paletteShadersGtuFamicomNesTableTextureDef() : TextureDef{}
 {
-public:
-	Nes_raw_paletteShadersGtuFamicomNesTableTextureDef() : TextureDef{}
-	{
-		Name = "NesTable.png";
-		Data = Nes_raw_paletteShadersGtuFamicomNesTableTextureDefs::sData;
-		DataLength = sizeof(Nes_raw_paletteShadersGtuFamicomNesTableTextureDefs::sData);
-	}
-};
+	Name = "NesTable.png";
+	Data = Nes_raw_paletteShadersGtuFamicomNesTableTextureDefs::sData;
+	DataLength = sizeof(Nes_raw_paletteShadersGtuFamicomNesTableTextureDefs::sData);
+}
+#endif
@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersGtuFamicomScaleXShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersGtuFamicomScaleXShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -837,35 +848,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersGtuFamicomScaleXShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersGtuFamicomScaleXShaderDef::Nes_raw_paletteShadersGtuFamicomScaleXShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersGtuFamicomScaleXShaderDef() : ShaderDef{}
-	{
-		Name = "scaleX";
-		VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("cropOverscan_x", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Crop Overscan X"));
-		Params.push_back(ShaderParam("signalResolutionY", -1, 56, 4, 20.000000f, 500.000000f, 200.000000f, 10.000000f, "Signal Res Y"));
-		Params.push_back(ShaderParam("signalResolutionI", -1, 60, 4, 20.000000f, 350.000000f, 125.000000f, 10.000000f, "Signal Res I"));
-		Params.push_back(ShaderParam("signalResolutionQ", -1, 64, 4, 20.000000f, 350.000000f, 125.000000f, 10.000000f, "Signal Res Q"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scaleX";
+	VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleXShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("cropOverscan_x", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Crop Overscan X"));
+	Params.push_back(ShaderParam("signalResolutionY", -1, 56, 4, 20.000000f, 500.000000f, 200.000000f, 10.000000f, "Signal Res Y"));
+	Params.push_back(ShaderParam("signalResolutionI", -1, 60, 4, 20.000000f, 350.000000f, 125.000000f, 10.000000f, "Signal Res I"));
+	Params.push_back(ShaderParam("signalResolutionQ", -1, 64, 4, 20.000000f, 350.000000f, 125.000000f, 10.000000f, "Signal Res Q"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Nes_raw_paletteShadersGtuFamicomScaleYShaderDef : public ShaderDef
+{
+public:
+	Nes_raw_paletteShadersGtuFamicomScaleYShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1047,37 +1058,31 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Nes_raw_paletteShadersGtuFamicomScaleYShaderDef : public ShaderDef
+RetroArch::Nes_raw_paletteShadersGtuFamicomScaleYShaderDef::Nes_raw_paletteShadersGtuFamicomScaleYShaderDef() : ShaderDef{}
 {
-public:
-	Nes_raw_paletteShadersGtuFamicomScaleYShaderDef() : ShaderDef{}
-	{
-		Name = "scaleY";
-		VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("noScanlines", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "No Scanlines"));
-		Params.push_back(ShaderParam("tvVerticalResolution", -1, 56, 4, 20.000000f, 1000.000000f, 250.000000f, 10.000000f, "TV Vert. Res"));
-		Params.push_back(ShaderParam("blackLevel", -1, 60, 4, -0.300000f, 0.300000f, 0.070000f, 0.010000f, "Black Level"));
-		Params.push_back(ShaderParam("contrast", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Contrast"));
-		Params.push_back(ShaderParam("gamma", -1, 68, 4, 0.500000f, 1.500000f, 1.000000f, 0.010000f, "Gamma"));
-		Params.push_back(ShaderParam("cropOverscan_y", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Crop Overscan Y"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scaleY";
+	VertexByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNes_raw_paletteShadersGtuFamicomScaleYShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("noScanlines", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "No Scanlines"));
+	Params.push_back(ShaderParam("tvVerticalResolution", -1, 56, 4, 20.000000f, 1000.000000f, 250.000000f, 10.000000f, "TV Vert. Res"));
+	Params.push_back(ShaderParam("blackLevel", -1, 60, 4, -0.300000f, 0.300000f, 0.070000f, 0.010000f, "Black Level"));
+	Params.push_back(ShaderParam("contrast", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.100000f, "Contrast"));
+	Params.push_back(ShaderParam("gamma", -1, 68, 4, 0.500000f, 1.500000f, 1.000000f, 0.010000f, "Gamma"));
+	Params.push_back(ShaderParam("cropOverscan_y", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Crop Overscan Y"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -109,6 +109,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersNtscBlastemShaderDef : public ShaderDef
+{
+public:
+	NtscShadersNtscBlastemShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersNtscBlastemShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1822,34 +1833,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersNtscBlastemShaderDef : public ShaderDef
+RetroArch::NtscShadersNtscBlastemShaderDef::NtscShadersNtscBlastemShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersNtscBlastemShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-blastem";
-		VertexByteCode = RetroArchNtscShadersNtscBlastemShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersNtscBlastemShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersNtscBlastemShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersNtscBlastemShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("comb_str", -1, 52, 4, 0.000000f, 1.000000f, 0.800000f, 0.010000f, "Combing Filter Strength"));
-		Params.push_back(ShaderParam("gamma_corr", -1, 56, 4, 1.000000f, 4.000000f, 2.200000f, 0.050000f, "Gamma Correction (2.2 = passthru)"));
-		Params.push_back(ShaderParam("scan_toggle", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Toggle"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-blastem";
+	VertexByteCode = RetroArchNtscShadersNtscBlastemShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersNtscBlastemShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersNtscBlastemShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersNtscBlastemShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("comb_str", -1, 52, 4, 0.000000f, 1.000000f, 0.800000f, 0.010000f, "Combing Filter Strength"));
+	Params.push_back(ShaderParam("gamma_corr", -1, 56, 4, 1.000000f, 4.000000f, 2.200000f, 0.050000f, "Gamma Correction (2.2 = passthru)"));
+	Params.push_back(ShaderParam("scan_toggle", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Scanline Toggle"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
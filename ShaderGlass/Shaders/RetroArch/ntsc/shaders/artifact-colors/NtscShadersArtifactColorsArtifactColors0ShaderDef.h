@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersArtifactColorsArtifactColors0ShaderDef : public ShaderDef
+{
+public:
+	NtscShadersArtifactColorsArtifactColors0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -441,32 +452,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersArtifactColorsArtifactColors0ShaderDef : public ShaderDef
+RetroArch::NtscShadersArtifactColorsArtifactColors0ShaderDef::NtscShadersArtifactColorsArtifactColors0ShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersArtifactColorsArtifactColors0ShaderDef() : ShaderDef{}
-	{
-		Name = "artifact-colors0";
-		VertexByteCode = RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("F_COL", -1, 52, 4, 0.250000f, 0.500000f, 0.250000f, 0.250000f, "F Col"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "artifact-colors0";
+	VertexByteCode = RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("F_COL", -1, 52, 4, 0.250000f, 0.500000f, 0.250000f, 0.250000f, "F Col"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
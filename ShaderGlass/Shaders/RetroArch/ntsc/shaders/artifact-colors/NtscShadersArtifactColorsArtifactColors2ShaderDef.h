@@ -23,6 +23,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersArtifactColorsArtifactColors2ShaderDef : public ShaderDef
+{
+public:
+	NtscShadersArtifactColorsArtifactColors2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -779,42 +790,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersArtifactColorsArtifactColors2ShaderDef : public ShaderDef
+RetroArch::NtscShadersArtifactColorsArtifactColors2ShaderDef::NtscShadersArtifactColorsArtifactColors2ShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersArtifactColorsArtifactColors2ShaderDef() : ShaderDef{}
-	{
-		Name = "artifact-colors2";
-		VertexByteCode = RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FIR_SIZE", -1, 52, 4, 1.000000f, 50.000000f, 29.000000f, 1.000000f, "FIR Size"));
-		Params.push_back(ShaderParam("F_COL", -1, 56, 4, 0.250000f, 0.500000f, 0.250000f, 0.250000f, "F Col"));
-		Params.push_back(ShaderParam("SATURATION", -1, 60, 4, 0.000000f, 100.000000f, 30.000000f, 1.000000f, "Saturation"));
-		Params.push_back(ShaderParam("BRIGHTNESS", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("F_LUMA_LP", -1, 68, 4, 0.000100f, 0.333333f, 0.166670f, 0.020000f, "F Luma LP"));
-		Params.push_back(ShaderParam("HUE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue"));
-		Params.push_back(ShaderParam("split", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Split Toggle"));
-		Params.push_back(ShaderParam("split_line", -1, 80, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Split Line Location"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("Pass1", 5));
-		Samplers.push_back(ShaderSampler("artifact_colors_refpass", 3));
-		Samplers.push_back(ShaderSampler("Pass2", 4));
+	Name = "artifact-colors2";
+	VertexByteCode = RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersArtifactColorsArtifactColors2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FIR_SIZE", -1, 52, 4, 1.000000f, 50.000000f, 29.000000f, 1.000000f, "FIR Size"));
+	Params.push_back(ShaderParam("F_COL", -1, 56, 4, 0.250000f, 0.500000f, 0.250000f, 0.250000f, "F Col"));
+	Params.push_back(ShaderParam("SATURATION", -1, 60, 4, 0.000000f, 100.000000f, 30.000000f, 1.000000f, "Saturation"));
+	Params.push_back(ShaderParam("BRIGHTNESS", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("F_LUMA_LP", -1, 68, 4, 0.000100f, 0.333333f, 0.166670f, 0.020000f, "F Luma LP"));
+	Params.push_back(ShaderParam("HUE", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Hue"));
+	Params.push_back(ShaderParam("split", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Split Toggle"));
+	Params.push_back(ShaderParam("split_line", -1, 80, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Split Line Location"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("Pass1", 5));
+	Samplers.push_back(ShaderSampler("artifact_colors_refpass", 3));
+	Samplers.push_back(ShaderSampler("Pass2", 4));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersBlarggBlargg0ShaderDef : public ShaderDef
+{
+public:
+	NtscShadersBlarggBlargg0ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersBlarggBlargg0ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -694,45 +705,39 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersBlarggBlargg0ShaderDef : public ShaderDef
+RetroArch::NtscShadersBlarggBlargg0ShaderDef::NtscShadersBlarggBlargg0ShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersBlarggBlargg0ShaderDef() : ShaderDef{}
-	{
-		Name = "blargg-0";
-		VertexByteCode = RetroArchNtscShadersBlarggBlargg0ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersBlarggBlargg0ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersBlarggBlargg0ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersBlarggBlargg0ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("kernel_half", -1, 20, 4, 1.000000f, 16.000000f, 16.000000f, 1.000000f, "Kernel Half-Size (speed-up)"));
-		Params.push_back(ShaderParam("ntsc_sat", -1, 24, 4, 0.000000f, 6.000000f, 2.000000f, 0.050000f, "Saturation"));
-		Params.push_back(ShaderParam("ntsc_res", -1, 28, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Resolution"));
-		Params.push_back(ShaderParam("ntsc_bri", -1, 32, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("ntsc_hue", -1, 36, 4, -1.000000f, 6.300000f, 0.000000f, 0.050000f, "Hue"));
-		Params.push_back(ShaderParam("ntsc_sharp", -1, 40, 4, -1.000000f, 1.000000f, 0.100000f, 0.050000f, "Sharpness"));
-		Params.push_back(ShaderParam("fring", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Fringing"));
-		Params.push_back(ShaderParam("afacts", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Artifacts"));
-		Params.push_back(ShaderParam("ntsc_bleed", -1, 52, 4, -0.750000f, 2.000000f, 0.000000f, 0.050000f, "Chroma Bleed"));
-		Params.push_back(ShaderParam("LUMA_CUTOFF", -1, 56, 4, 0.000000f, 1.000000f, 0.200000f, 0.005000f, "Luma Cutoff"));
-		Params.push_back(ShaderParam("stat_ph", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Dot Crawl On/Off"));
-		Params.push_back(ShaderParam("dummy", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "[ System Specific Tweaks]"));
-		Params.push_back(ShaderParam("pi_mod", -1, 68, 4, 1.000000f, 360.000000f, 96.000000f, 1.000000f, "Phase-Horiz. Angle"));
-		Params.push_back(ShaderParam("vert_scal", -1, 72, 4, 0.000000f, 2.000000f, 0.666700f, 0.055550f, "Phase-Vertical Scale"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "blargg-0";
+	VertexByteCode = RetroArchNtscShadersBlarggBlargg0ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersBlarggBlargg0ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersBlarggBlargg0ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersBlarggBlargg0ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 16, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("kernel_half", -1, 20, 4, 1.000000f, 16.000000f, 16.000000f, 1.000000f, "Kernel Half-Size (speed-up)"));
+	Params.push_back(ShaderParam("ntsc_sat", -1, 24, 4, 0.000000f, 6.000000f, 2.000000f, 0.050000f, "Saturation"));
+	Params.push_back(ShaderParam("ntsc_res", -1, 28, 4, -1.000000f, 1.000000f, 0.000000f, 0.050000f, "Resolution"));
+	Params.push_back(ShaderParam("ntsc_bri", -1, 32, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("ntsc_hue", -1, 36, 4, -1.000000f, 6.300000f, 0.000000f, 0.050000f, "Hue"));
+	Params.push_back(ShaderParam("ntsc_sharp", -1, 40, 4, -1.000000f, 1.000000f, 0.100000f, 0.050000f, "Sharpness"));
+	Params.push_back(ShaderParam("fring", -1, 44, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Fringing"));
+	Params.push_back(ShaderParam("afacts", -1, 48, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Artifacts"));
+	Params.push_back(ShaderParam("ntsc_bleed", -1, 52, 4, -0.750000f, 2.000000f, 0.000000f, 0.050000f, "Chroma Bleed"));
+	Params.push_back(ShaderParam("LUMA_CUTOFF", -1, 56, 4, 0.000000f, 1.000000f, 0.200000f, 0.005000f, "Luma Cutoff"));
+	Params.push_back(ShaderParam("stat_ph", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Dot Crawl On/Off"));
+	Params.push_back(ShaderParam("dummy", -1, 64, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, "[ System Specific Tweaks]"));
+	Params.push_back(ShaderParam("pi_mod", -1, 68, 4, 1.000000f, 360.000000f, 96.000000f, 1.000000f, "Phase-Horiz. Angle"));
+	Params.push_back(ShaderParam("vert_scal", -1, 72, 4, 0.000000f, 2.000000f, 0.666700f, 0.055550f, "Phase-Vertical Scale"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
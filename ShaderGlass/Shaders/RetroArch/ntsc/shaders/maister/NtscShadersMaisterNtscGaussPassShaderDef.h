@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersMaisterNtscGaussPassShaderDef : public ShaderDef
+{
+public:
+	NtscShadersMaisterNtscGaussPassShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersMaisterNtscGaussPassShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -747,33 +758,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersMaisterNtscGaussPassShaderDef : public ShaderDef
+RetroArch::NtscShadersMaisterNtscGaussPassShaderDef::NtscShadersMaisterNtscGaussPassShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersMaisterNtscGaussPassShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-gauss-pass";
-		VertexByteCode = RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("NTSC_CRT_GAMMA", -1, 52, 4, 0.000000f, 10.000000f, 2.500000f, 0.100000f, "NTSC CRT Gamma"));
-		Params.push_back(ShaderParam("NTSC_DISPLAY_GAMMA", -1, 56, 4, 0.000000f, 10.000000f, 2.100000f, 0.100000f, "NTSC Display Gamma"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-gauss-pass";
+	VertexByteCode = RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersMaisterNtscGaussPassShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("NTSC_CRT_GAMMA", -1, 52, 4, 0.000000f, 10.000000f, 2.500000f, 0.100000f, "NTSC CRT Gamma"));
+	Params.push_back(ShaderParam("NTSC_DISPLAY_GAMMA", -1, 56, 4, 0.000000f, 10.000000f, 2.100000f, 0.100000f, "NTSC Display Gamma"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersMaisterNtscPass1Svideo2phaseShaderDef : public ShaderDef
+{
+public:
+	NtscShadersMaisterNtscPass1Svideo2phaseShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -525,31 +536,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersMaisterNtscPass1Svideo2phaseShaderDef : public ShaderDef
+RetroArch::NtscShadersMaisterNtscPass1Svideo2phaseShaderDef::NtscShadersMaisterNtscPass1Svideo2phaseShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersMaisterNtscPass1Svideo2phaseShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-pass1-svideo-2phase";
-		VertexByteCode = RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-pass1-svideo-2phase";
+	VertexByteCode = RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersMaisterNtscPass1Svideo2phaseShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
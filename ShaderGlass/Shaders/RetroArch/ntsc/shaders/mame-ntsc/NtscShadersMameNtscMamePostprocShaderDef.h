@@ -22,6 +22,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersMameNtscMamePostprocShaderDef : public ShaderDef
+{
+public:
+	NtscShadersMameNtscMamePostprocShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersMameNtscMamePostprocShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -750,36 +761,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersMameNtscMamePostprocShaderDef : public ShaderDef
+RetroArch::NtscShadersMameNtscMamePostprocShaderDef::NtscShadersMameNtscMamePostprocShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersMameNtscMamePostprocShaderDef() : ShaderDef{}
-	{
-		Name = "mame-postproc";
-		VertexByteCode = RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("scanlines", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Toggle"));
-		Params.push_back(ShaderParam("scandark", -1, 56, 4, 0.000000f, 1.000000f, 0.175000f, 0.050000f, "Scanline Intensity"));
-		Params.push_back(ShaderParam("deconverge", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Deconvergence/Convolution"));
-		Params.push_back(ShaderParam("pincushion", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Bezel Toggle"));
-		Params.push_back(ShaderParam("hertzroll", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Refresh Roll Toggle"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "mame-postproc";
+	VertexByteCode = RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersMameNtscMamePostprocShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("scanlines", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Scanline Toggle"));
+	Params.push_back(ShaderParam("scandark", -1, 56, 4, 0.000000f, 1.000000f, 0.175000f, 0.050000f, "Scanline Intensity"));
+	Params.push_back(ShaderParam("deconverge", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Deconvergence/Convolution"));
+	Params.push_back(ShaderParam("pincushion", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Bezel Toggle"));
+	Params.push_back(ShaderParam("hertzroll", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Refresh Roll Toggle"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersNtscAdaptiveNtscPass1ShaderDef : public ShaderDef
+{
+public:
+	NtscShadersNtscAdaptiveNtscPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1162,40 +1173,34 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersNtscAdaptiveNtscPass1ShaderDef : public ShaderDef
+RetroArch::NtscShadersNtscAdaptiveNtscPass1ShaderDef::NtscShadersNtscAdaptiveNtscPass1ShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersNtscAdaptiveNtscPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-pass1";
-		VertexByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("quality", 0, 116, 4, -1.000000f, 2.000000f, 1.000000f, 1.000000f, "NTSC Preset (Svideo=0 Composite=1 RF=2 Custom=-1)"));
-		Params.push_back(ShaderParam("ntsc_sat", 0, 120, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "NTSC Color Saturation"));
-		Params.push_back(ShaderParam("cust_fringing", 0, 124, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "NTSC Custom Fringing Value"));
-		Params.push_back(ShaderParam("cust_artifacting", 0, 128, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "NTSC Custom Artifacting Value"));
-		Params.push_back(ShaderParam("ntsc_bright", 0, 132, 4, 0.000000f, 1.500000f, 1.000000f, 0.010000f, "NTSC Brightness"));
-		Params.push_back(ShaderParam("ntsc_scale", 0, 136, 4, 0.200000f, 3.000000f, 1.000000f, 0.050000f, "NTSC Resolution Scaling"));
-		Params.push_back(ShaderParam("ntsc_fields", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NTSC Merge Fields"));
-		Params.push_back(ShaderParam("ntsc_phase", 0, 144, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "NTSC Phase: Auto | 2 phase | 3 phase"));
-		Params.push_back(ShaderParam("ntsc_artifacting_rainbow", 0, 148, 4, -1.000000f, 1.000000f, 0.000000f, 0.100000f, "NTSC Artifacting Rainbow Effect"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-pass1";
+	VertexByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("quality", 0, 116, 4, -1.000000f, 2.000000f, 1.000000f, 1.000000f, "NTSC Preset (Svideo=0 Composite=1 RF=2 Custom=-1)"));
+	Params.push_back(ShaderParam("ntsc_sat", 0, 120, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "NTSC Color Saturation"));
+	Params.push_back(ShaderParam("cust_fringing", 0, 124, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "NTSC Custom Fringing Value"));
+	Params.push_back(ShaderParam("cust_artifacting", 0, 128, 4, 0.000000f, 5.000000f, 0.000000f, 0.100000f, "NTSC Custom Artifacting Value"));
+	Params.push_back(ShaderParam("ntsc_bright", 0, 132, 4, 0.000000f, 1.500000f, 1.000000f, 0.010000f, "NTSC Brightness"));
+	Params.push_back(ShaderParam("ntsc_scale", 0, 136, 4, 0.200000f, 3.000000f, 1.000000f, 0.050000f, "NTSC Resolution Scaling"));
+	Params.push_back(ShaderParam("ntsc_fields", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NTSC Merge Fields"));
+	Params.push_back(ShaderParam("ntsc_phase", 0, 144, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "NTSC Phase: Auto | 2 phase | 3 phase"));
+	Params.push_back(ShaderParam("ntsc_artifacting_rainbow", 0, 148, 4, -1.000000f, 1.000000f, 0.000000f, 0.100000f, "NTSC Artifacting Rainbow Effect"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersNtscAdaptiveNtscPass2ShaderDef : public ShaderDef
+{
+public:
+	NtscShadersNtscAdaptiveNtscPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3689,35 +3700,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersNtscAdaptiveNtscPass2ShaderDef : public ShaderDef
+RetroArch::NtscShadersNtscAdaptiveNtscPass2ShaderDef::NtscShadersNtscAdaptiveNtscPass2ShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersNtscAdaptiveNtscPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "ntsc-pass2";
-		VertexByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("linearize", 0, 112, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NTSC Linearize Output Gamma"));
-		Params.push_back(ShaderParam("ntsc_scale", 0, 116, 4, 0.200000f, 3.000000f, 1.000000f, 0.050000f, "NTSC Resolution Scaling"));
-		Params.push_back(ShaderParam("ntsc_phase", 0, 120, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "NTSC Phase: Auto | 2 phase | 3 phase"));
-		Params.push_back(ShaderParam("auto_res", 0, 124, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("chroma_scale", 0, 128, 4, 0.200000f, 4.000000f, 1.000000f, 0.200000f, "NTSC Chroma Scaling"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ntsc-pass2";
+	VertexByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersNtscAdaptiveNtscPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("linearize", 0, 112, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NTSC Linearize Output Gamma"));
+	Params.push_back(ShaderParam("ntsc_scale", 0, 116, 4, 0.200000f, 3.000000f, 1.000000f, 0.050000f, "NTSC Resolution Scaling"));
+	Params.push_back(ShaderParam("ntsc_phase", 0, 120, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "NTSC Phase: Auto | 2 phase | 3 phase"));
+	Params.push_back(ShaderParam("auto_res", 0, 124, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("chroma_scale", 0, 128, 4, 0.200000f, 4.000000f, 1.000000f, 0.200000f, "NTSC Chroma Scaling"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersNtscSimpleKaizerLpSmallShaderDef : public ShaderDef
+{
+public:
+	NtscShadersNtscSimpleKaizerLpSmallShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -495,32 +506,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersNtscSimpleKaizerLpSmallShaderDef : public ShaderDef
+RetroArch::NtscShadersNtscSimpleKaizerLpSmallShaderDef::NtscShadersNtscSimpleKaizerLpSmallShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersNtscSimpleKaizerLpSmallShaderDef() : ShaderDef{}
-	{
-		Name = "kaizer-lp-small";
-		VertexByteCode = RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("something", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "kaizer-lp-small";
+	VertexByteCode = RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersNtscSimpleKaizerLpSmallShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("something", -1, 0, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersNtscSimpleTiny_ntscShaderDef : public ShaderDef
+{
+public:
+	NtscShadersNtscSimpleTiny_ntscShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -808,35 +819,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersNtscSimpleTiny_ntscShaderDef : public ShaderDef
+RetroArch::NtscShadersNtscSimpleTiny_ntscShaderDef::NtscShadersNtscSimpleTiny_ntscShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersNtscSimpleTiny_ntscShaderDef() : ShaderDef{}
-	{
-		Name = "tiny_ntsc";
-		VertexByteCode = RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("comb", -1, 0, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Comb Filter Strength"));
-		Params.push_back(ShaderParam("ln_delay", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NES/SNES Line Delay"));
-		Params.push_back(ShaderParam("d_crawl", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NES/SNES Dot Crawl"));
-		Params.push_back(ShaderParam("sharp_pix", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharper"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "tiny_ntsc";
+	VertexByteCode = RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersNtscSimpleTiny_ntscShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", 0, 112, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("comb", -1, 0, 4, 0.000000f, 1.000000f, 0.800000f, 0.050000f, "Comb Filter Strength"));
+	Params.push_back(ShaderParam("ln_delay", -1, 4, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NES/SNES Line Delay"));
+	Params.push_back(ShaderParam("d_crawl", -1, 8, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "NES/SNES Dot Crawl"));
+	Params.push_back(ShaderParam("sharp_pix", -1, 12, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Sharper"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersPatchyNtscLinearToSrgbShaderDef : public ShaderDef
+{
+public:
+	NtscShadersPatchyNtscLinearToSrgbShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -335,32 +346,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersPatchyNtscLinearToSrgbShaderDef : public ShaderDef
+RetroArch::NtscShadersPatchyNtscLinearToSrgbShaderDef::NtscShadersPatchyNtscLinearToSrgbShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersPatchyNtscLinearToSrgbShaderDef() : ShaderDef{}
-	{
-		Name = "linear-to-srgb";
-		VertexByteCode = RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "linear-to-srgb";
+	VertexByteCode = RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersPatchyNtscLinearToSrgbShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class NtscShadersPatchyNtscP22_90s_D65TextureDef : public TextureDef
+{
+public:
+	NtscShadersPatchyNtscP22_90s_D65TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace NtscShadersPatchyNtscP22_90s_D65TextureDefs
 {
 const BYTE sData[] =
@@ -1101,13 +1109,10 @@ const BYTE sData[] =
 ,70,240,186,114,56,22,204,78,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class NtscShadersPatchyNtscP22_90s_D65TextureDef : public TextureDef
+NtscShadersPatchyNtscP22_90s_D65TextureDef::NtscShadersPatchyNtscP22_90s_D65TextureDef() : TextureDef{}
 {
-public:
-	NtscShadersPatchyNtscP22_90s_D65TextureDef() : TextureDef{}
-	{
-		Name = "P22_90s_D65.png";
-		Data = NtscShadersPatchyNtscP22_90s_D65TextureDefs::sData;
-		DataLength = sizeof(NtscShadersPatchyNtscP22_90s_D65TextureDefs::sData);
-	}
-};
+	Name = "P22_90s_D65.png";
+	Data = NtscShadersPatchyNtscP22_90s_D65TextureDefs::sData;
+	DataLength = sizeof(NtscShadersPatchyNtscP22_90s_D65TextureDefs::sData);
+}
+#endif
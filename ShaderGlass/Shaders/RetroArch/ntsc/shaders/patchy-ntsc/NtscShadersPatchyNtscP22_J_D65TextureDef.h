@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class NtscShadersPatchyNtscP22_J_D65TextureDef : public TextureDef
+{
+public:
+	NtscShadersPatchyNtscP22_J_D65TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace NtscShadersPatchyNtscP22_J_D65TextureDefs
 {
 const BYTE sData[] =
@@ -1461,13 +1469,10 @@ const BYTE sData[] =
 ,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class NtscShadersPatchyNtscP22_J_D65TextureDef : public TextureDef
+NtscShadersPatchyNtscP22_J_D65TextureDef::NtscShadersPatchyNtscP22_J_D65TextureDef() : TextureDef{}
 {
-public:
-	NtscShadersPatchyNtscP22_J_D65TextureDef() : TextureDef{}
-	{
-		Name = "P22_J_D65.png";
-		Data = NtscShadersPatchyNtscP22_J_D65TextureDefs::sData;
-		DataLength = sizeof(NtscShadersPatchyNtscP22_J_D65TextureDefs::sData);
-	}
-};
+	Name = "P22_J_D65.png";
+	Data = NtscShadersPatchyNtscP22_J_D65TextureDefs::sData;
+	DataLength = sizeof(NtscShadersPatchyNtscP22_J_D65TextureDefs::sData);
+}
+#endif
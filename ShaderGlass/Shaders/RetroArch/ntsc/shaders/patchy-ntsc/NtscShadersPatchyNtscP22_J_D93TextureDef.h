@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class NtscShadersPatchyNtscP22_J_D93TextureDef : public TextureDef
+{
+public:
+	NtscShadersPatchyNtscP22_J_D93TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace NtscShadersPatchyNtscP22_J_D93TextureDefs
 {
 const BYTE sData[] =
@@ -999,13 +1007,10 @@ const BYTE sData[] =
 ,110,148,66,197,137,164,207,155,216,93,185,135,63,110,194,191,250,22,22,126,17,58,169,214,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class NtscShadersPatchyNtscP22_J_D93TextureDef : public TextureDef
+NtscShadersPatchyNtscP22_J_D93TextureDef::NtscShadersPatchyNtscP22_J_D93TextureDef() : TextureDef{}
 {
-public:
-	NtscShadersPatchyNtscP22_J_D93TextureDef() : TextureDef{}
-	{
-		Name = "P22_J_D93.png";
-		Data = NtscShadersPatchyNtscP22_J_D93TextureDefs::sData;
-		DataLength = sizeof(NtscShadersPatchyNtscP22_J_D93TextureDefs::sData);
-	}
-};
+	Name = "P22_J_D93.png";
+	Data = NtscShadersPatchyNtscP22_J_D93TextureDefs::sData;
+	DataLength = sizeof(NtscShadersPatchyNtscP22_J_D93TextureDefs::sData);
+}
+#endif
@@ -313,6 +313,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef : public ShaderDef
+{
+public:
+	NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -11050,134 +11061,128 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef : public ShaderDef
+RetroArch::NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef::NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersPatchyNtscPatchyNtscCombineYCShaderDef() : ShaderDef{}
-	{
-		Name = "patchy-ntsc-combine-y-c";
-		VertexByteCode = RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_test_pattern", 0, 64, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Test Pattern: Color Bars, Ramps, HSV, Focused HSV, NES Full"));
-		Params.push_back(ShaderParam("pn_test_pattern_split", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Test pattern split mode (if available)"));
-		Params.push_back(ShaderParam("pn_signal_res", 0, 72, 4, 1.000000f, 32.000000f, 8.000000f, 1.000000f, "SIGNAL_RES"));
-		Params.push_back(ShaderParam("pn_width_uncropped", 0, 76, 4, 128.000000f, 720.000000f, 320.000000f, 1.000000f, "Console Horizontal Resolution (pixels) (rec. even numbers only)"));
-		Params.push_back(ShaderParam("pn_height_uncropped", 0, 80, 4, 128.000000f, 480.000000f, 224.000000f, 1.000000f, "Console Vertical Resolution (pixels) (rec. 240 or 224 only)"));
-		Params.push_back(ShaderParam("pn_width_integer_mul", 0, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Detect integer-multiplied width (such as bsnes-mercury)"));
-		Params.push_back(ShaderParam("pn_height_integer_mul", 0, 88, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Detect integer-multiplied height (such as interlaced video)"));
-		Params.push_back(ShaderParam("pn_dual_width_mode", 0, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Detect two horizontal resolutions (such as Genesis 320 vs 256)"));
-		Params.push_back(ShaderParam("pn_width_secondary_uncropped", 0, 96, 4, 128.000000f, 720.000000f, 256.000000f, 1.000000f, "Console Smaller Horizontal Resolution (pixels)"));
-		Params.push_back(ShaderParam("pn_scanline_dur", 0, 100, 4, 1.000000f, 300.000000f, 47.599998f, 0.100000f, "Scanline Duration (uSec)"));
-		Params.push_back(ShaderParam("pn_color_amplitude", 0, 104, 4, 0.025000f, 10.000000f, 1.000000f, 0.025000f, "Color Carrier Amplitude"));
-		Params.push_back(ShaderParam("pn_color_freq", 0, 108, 4, 3.479540f, 3.679540f, 3.579545f, 0.000010f, "Color Carrier Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_color_init_offset", 0, 112, 4, 0.000000f, 1.000000f, 0.100000f, 0.020000f, "Color Carrier Initial Offset"));
-		Params.push_back(ShaderParam("pn_color_line_offset", 0, 116, 4, 0.000000f, 1.000000f, 0.000000f, 0.020000f, "Color Carrier Per-Line Offset"));
-		Params.push_back(ShaderParam("pn_color_screen_offset", 0, 120, 4, 0.000000f, 1.000000f, 0.000000f, 0.020000f, "Color Carrier Per-Frame Offset"));
-		Params.push_back(ShaderParam("pn_color_screen_offset_modulo", 0, 124, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Carrier Frame Count Modulo (1 = infinity)"));
-		Params.push_back(ShaderParam("pn_nes_enable", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable NES Raw Palette Mode"));
-		Params.push_back(ShaderParam("pn_nes_phase_mod", 0, 132, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NES Battletoads / Battletoads Double Dragon Phase Cycle"));
-		Params.push_back(ShaderParam("pn_nes_real_capture", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NES color fix: Hue-skew | Real video capture LUT (unfinished)"));
-		Params.push_back(ShaderParam("pn_nes_hue_skew", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NES hue-skew PPU version: 2C02G | 2C02E"));
-		Params.push_back(ShaderParam("pn_genesis_palette", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Genesis Plus GX color fix (not for BlastEm or other consoles)"));
-		Params.push_back(ShaderParam("pn_genesis_jailbar_enable", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable Genesis jailbars on solid backgrounds (Composite only)"));
-		Params.push_back(ShaderParam("pn_genesis_jailbar_offset", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 0.062500f, "Genesis Jailbars Offset"));
-		Params.push_back(ShaderParam("pn_genesis_jailbar_amplitude", 0, 156, 4, 0.100000f, 30.000000f, 1.000000f, 0.100000f, "Genesis Jailbars Severity"));
-		Params.push_back(ShaderParam("pn_rgb_blur_enable", 0, 160, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable RGB linear blur (such as 2-chip SNES)"));
-		Params.push_back(ShaderParam("pn_rgb_blur_amount", 0, 164, 4, 0.250000f, 2.000000f, 1.000000f, 0.125000f, "RGB linear blur distance"));
-		Params.push_back(ShaderParam("pn_modulator_std", 0, 168, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Modulator standard: Rec. 601 | Rec. 709"));
-		Params.push_back(ShaderParam("pn_modulator_luma_filter_type", 0, 172, 4, -1.000000f, 2.000000f, 0.000000f, 1.000000f, "Mod. Luma Lowpass Type"));
-		Params.push_back(ShaderParam("pn_modulator_luma_filter_width", 0, 176, 4, 0.000000f, 30.000000f, 3.000000f, 0.250000f, "Mod. Luma Lowpass (Type 0) Sinc Half-Width"));
-		Params.push_back(ShaderParam("pn_modulator_luma_filter_level", 0, 180, 4, 0.500000f, 40.000000f, 2.700000f, 0.025000f, "Mod. Luma Lowpass (Type 0) Sinc Cutoff Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_modulator_luma_radius", 0, 184, 4, 0.100000f, 15.000000f, 3.000000f, 0.100000f, "Mod. Luma Lowpass (Type 1) Gaussian Blur Radius"));
-		Params.push_back(ShaderParam("pn_modulator_luma_sigma", 0, 188, 4, 0.100000f, 15.000000f, 1.500000f, 0.010000f, "Mod. Luma Lowpass (Type 1) Gaussian Blur Sigma"));
-		Params.push_back(ShaderParam("pn_modulator_luma_res", 0, 192, 4, 10.000000f, 800.000000f, 180.000000f, 2.000000f, "Mod. Luma Lowpass (Type 2) GTU Signal Res Y"));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_f_lo", 0, 196, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_f_hi", 0, 200, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_g_lo", 0, 204, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_g_mid", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_g_hi", 0, 212, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_off", 0, 216, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_luma_eq_dist", 0, 220, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_filter_type", 0, 224, 4, -1.000000f, 0.000000f, 0.000000f, 1.000000f, "Mod. Chroma Bandpass Type"));
-		Params.push_back(ShaderParam("pn_modulator_chroma_filter_width", 0, 228, 4, 0.000000f, 30.000000f, 3.000000f, 0.250000f, "Mod. Chroma Bandpass (Type 0) Half-Width"));
-		Params.push_back(ShaderParam("pn_modulator_chroma_filter_level", 0, 232, 4, 0.500000f, 6.000000f, 3.550000f, 0.025000f, "Mod. Chroma Bandpass (Type 0) Low Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_modulator_chroma_filter_level_diff", 0, 236, 4, 0.500000f, 6.000000f, 3.600000f, 0.025000f, "Mod. Chroma Bandpass (Type 0) High Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_f_lo", 0, 240, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_f_hi", 0, 244, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_g_lo", 0, 248, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_g_mid", 0, 252, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_g_hi", 0, 256, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_off", 0, 260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_modulator_chroma_eq_dist", 0, 264, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_std", 0, 268, 4, 0.000000f, 9.000000f, 8.000000f, 1.000000f, "R-Y/G-Y/B-Y formula: Rec. 601, Rec. 709, 2*JP, 5*US, Custom"));
-		Params.push_back(ShaderParam("pn_demodulator_std_defaults", 0, 272, 4, -1.000000f, 2.000000f, 2.000000f, 1.000000f, "Auto-sync Tint/Color: Off; Avg. Bars; Match red; Eyeballed"));
-		Params.push_back(ShaderParam("pn_demodulator_r_off", 0, 276, 4, 90.000000f, 130.000000f, 112.000000f, 1.000000f, "Custom R-Y offset"));
-		Params.push_back(ShaderParam("pn_demodulator_r_amp", 0, 280, 4, 0.000000f, 1.000000f, 0.840000f, 0.010000f, "Custom R-Y gain"));
-		Params.push_back(ShaderParam("pn_demodulator_g_off", 0, 284, 4, 200.000000f, 300.000000f, 235.000000f, 1.000000f, "Custom G-Y offset"));
-		Params.push_back(ShaderParam("pn_demodulator_g_amp", 0, 288, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Custom G-Y gain"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_filter_type", 0, 292, 4, -1.000000f, 6.000000f, 0.000000f, 1.000000f, "Demodulator Luma Filter Type"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_filter_width", 0, 296, 4, 0.000000f, 30.000000f, 5.000000f, 0.250000f, "(Type 0) Lowpass Sinc Window Half-Width"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_filter_level", 0, 300, 4, 0.500000f, 4.000000f, 2.150000f, 0.025000f, "(Type 0) Lowpass Sinc Cutoff Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_radius", 0, 304, 4, 0.100000f, 15.000000f, 4.500000f, 0.100000f, "(Type 1) Gaussian Blur Radius"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_sigma", 0, 308, 4, 0.100000f, 15.000000f, 1.900000f, 0.010000f, "(Type 1) Gaussian Blur Sigma"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_res", 0, 312, 4, 10.000000f, 800.000000f, 180.000000f, 2.000000f, "(Type 2) GTU Signal Res Y"));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_f_lo", 0, 316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_f_hi", 0, 320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_g_lo", 0, 324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_g_mid", 0, 328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_g_hi", 0, 332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_off", 0, 336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_luma_eq_dist", 0, 340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_filter_type", 0, 344, 4, -1.000000f, 3.000000f, 0.000000f, 1.000000f, "Demod. Chroma Filter Type"));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_filter_width", 0, 348, 4, 0.000000f, 30.000000f, 5.000000f, 0.250000f, "Demod. Chroma Bandpass (Type 0) Half-Width"));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_filter_level", 0, 352, 4, 0.500000f, 6.000000f, 3.550000f, 0.025000f, "Demod. Chroma Bandpass (Type 0) Low Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_filter_level_diff", 0, 356, 4, 0.500000f, 6.000000f, 3.600000f, 0.025000f, "Demod. Chroma Bandpass (Type 0) High Frequency (MHz)"));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_f_lo", 0, 360, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_f_hi", 0, 364, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_g_lo", 0, 368, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_g_mid", 0, 372, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_g_hi", 0, 376, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_off", 0, 380, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_chroma_eq_dist", 0, 384, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_demodulator_uv_filter_type", 0, 388, 4, -1.000000f, 0.000000f, 0.000000f, 1.000000f, "B-Y R-Y Filter Type"));
-		Params.push_back(ShaderParam("pn_demodulator_uv_filter_width", 0, 392, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "B-Y R-Y Filter Width"));
-		Params.push_back(ShaderParam("pn_connection_type", 0, 396, 4, -1.000000f, 2.000000f, 0.000000f, 1.000000f, "Cable: RF | Composite | S-Video mod | No Artifacts"));
-		Params.push_back(ShaderParam("pn_noise_rand_offset", 0, 400, 4, 0.000000f, 999.000000f, 262.000000f, 1.000000f, "Noise random seed"));
-		Params.push_back(ShaderParam("pn_noise_min_rate", 0, 404, 4, 1.000000f, 400.000000f, 50.000000f, 2.000000f, "Noise minimum rate"));
-		Params.push_back(ShaderParam("pn_noise_max_rate", 0, 408, 4, 1.000000f, 4000.000000f, 200.000000f, 2.000000f, "Noise maximum rate"));
-		Params.push_back(ShaderParam("pn_noise_counter", 0, 412, 4, 5.000000f, 2000.000000f, 100.000000f, 5.000000f, "Amount of sine waves"));
-		Params.push_back(ShaderParam("pn_noise_severity", 0, 416, 4, 0.000000f, 10.000000f, 1.000000f, 0.025000f, "Noise overall severity factor"));
-		Params.push_back(ShaderParam("pn_bad_rgb_gamma", 0, 420, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("pn_knob_contrast", 0, 424, 4, 0.000000f, 2.000000f, 0.800000f, 0.025000f, "CRT Contrast (Picture)"));
-		Params.push_back(ShaderParam("pn_knob_brightness", 0, 428, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "CRT Brightness (Black Level)"));
-		Params.push_back(ShaderParam("pn_knob_saturation", 0, 432, 4, 0.000000f, 5.000000f, 1.000000f, 0.025000f, "CRT Color (Saturation)"));
-		Params.push_back(ShaderParam("pn_knob_tint", 0, 436, 4, -45.000000f, 45.000000f, 0.000000f, 0.500000f, "CRT Tint (Hue Rotation)"));
-		Params.push_back(ShaderParam("pn_rgb_smear_enable", 0, 440, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable Smearing (Should be off unless your CRT is wearing out)"));
-		Params.push_back(ShaderParam("pn_rgb_smear_clamp", 0, 444, 4, 1.000000f, 3.000000f, 1.500000f, 0.050000f, "RGB Clamp Level (any value above this becomes equal to this)"));
-		Params.push_back(ShaderParam("pn_rgb_smear_rate", 0, 448, 4, 1.000000f, 3.000000f, 1.150000f, 0.050000f, "RGB Smear Level (after clamping, anything above this smears)"));
-		Params.push_back(ShaderParam("pn_rgb_smear_limit", 0, 452, 4, 0.000000f, 100.000000f, 30.000000f, 0.250000f, "Max Smear Detection Distance (% of screen)"));
-		Params.push_back(ShaderParam("pn_rgb_smear_res", 0, 456, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Smear Resolution (Higher is more intense but more accurate)"));
-		Params.push_back(ShaderParam("pn_gamma_type", 0, 460, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Gamma: BT.1886 + Grade black lift fix | BT.1886 | Power | sRGB"));
-		Params.push_back(ShaderParam("pn_g_CRT_l", 0, 464, 4, 2.300000f, 2.600000f, 2.500000f, 0.010000f, "Black lift fix approximate gamma"));
-		Params.push_back(ShaderParam("pn_power_gamma", 0, 468, 4, 1.500000f, 3.500000f, 2.400000f, 0.010000f, "Power gamma"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "patchy-ntsc-combine-y-c";
+	VertexByteCode = RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersPatchyNtscPatchyNtscCombineYCShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_test_pattern", 0, 64, 4, 0.000000f, 5.000000f, 0.000000f, 1.000000f, "Test Pattern: Color Bars, Ramps, HSV, Focused HSV, NES Full"));
+	Params.push_back(ShaderParam("pn_test_pattern_split", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Test pattern split mode (if available)"));
+	Params.push_back(ShaderParam("pn_signal_res", 0, 72, 4, 1.000000f, 32.000000f, 8.000000f, 1.000000f, "SIGNAL_RES"));
+	Params.push_back(ShaderParam("pn_width_uncropped", 0, 76, 4, 128.000000f, 720.000000f, 320.000000f, 1.000000f, "Console Horizontal Resolution (pixels) (rec. even numbers only)"));
+	Params.push_back(ShaderParam("pn_height_uncropped", 0, 80, 4, 128.000000f, 480.000000f, 224.000000f, 1.000000f, "Console Vertical Resolution (pixels) (rec. 240 or 224 only)"));
+	Params.push_back(ShaderParam("pn_width_integer_mul", 0, 84, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Detect integer-multiplied width (such as bsnes-mercury)"));
+	Params.push_back(ShaderParam("pn_height_integer_mul", 0, 88, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Detect integer-multiplied height (such as interlaced video)"));
+	Params.push_back(ShaderParam("pn_dual_width_mode", 0, 92, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Detect two horizontal resolutions (such as Genesis 320 vs 256)"));
+	Params.push_back(ShaderParam("pn_width_secondary_uncropped", 0, 96, 4, 128.000000f, 720.000000f, 256.000000f, 1.000000f, "Console Smaller Horizontal Resolution (pixels)"));
+	Params.push_back(ShaderParam("pn_scanline_dur", 0, 100, 4, 1.000000f, 300.000000f, 47.599998f, 0.100000f, "Scanline Duration (uSec)"));
+	Params.push_back(ShaderParam("pn_color_amplitude", 0, 104, 4, 0.025000f, 10.000000f, 1.000000f, 0.025000f, "Color Carrier Amplitude"));
+	Params.push_back(ShaderParam("pn_color_freq", 0, 108, 4, 3.479540f, 3.679540f, 3.579545f, 0.000010f, "Color Carrier Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_color_init_offset", 0, 112, 4, 0.000000f, 1.000000f, 0.100000f, 0.020000f, "Color Carrier Initial Offset"));
+	Params.push_back(ShaderParam("pn_color_line_offset", 0, 116, 4, 0.000000f, 1.000000f, 0.000000f, 0.020000f, "Color Carrier Per-Line Offset"));
+	Params.push_back(ShaderParam("pn_color_screen_offset", 0, 120, 4, 0.000000f, 1.000000f, 0.000000f, 0.020000f, "Color Carrier Per-Frame Offset"));
+	Params.push_back(ShaderParam("pn_color_screen_offset_modulo", 0, 124, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "Color Carrier Frame Count Modulo (1 = infinity)"));
+	Params.push_back(ShaderParam("pn_nes_enable", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable NES Raw Palette Mode"));
+	Params.push_back(ShaderParam("pn_nes_phase_mod", 0, 132, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NES Battletoads / Battletoads Double Dragon Phase Cycle"));
+	Params.push_back(ShaderParam("pn_nes_real_capture", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NES color fix: Hue-skew | Real video capture LUT (unfinished)"));
+	Params.push_back(ShaderParam("pn_nes_hue_skew", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "NES hue-skew PPU version: 2C02G | 2C02E"));
+	Params.push_back(ShaderParam("pn_genesis_palette", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Genesis Plus GX color fix (not for BlastEm or other consoles)"));
+	Params.push_back(ShaderParam("pn_genesis_jailbar_enable", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable Genesis jailbars on solid backgrounds (Composite only)"));
+	Params.push_back(ShaderParam("pn_genesis_jailbar_offset", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 0.062500f, "Genesis Jailbars Offset"));
+	Params.push_back(ShaderParam("pn_genesis_jailbar_amplitude", 0, 156, 4, 0.100000f, 30.000000f, 1.000000f, 0.100000f, "Genesis Jailbars Severity"));
+	Params.push_back(ShaderParam("pn_rgb_blur_enable", 0, 160, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable RGB linear blur (such as 2-chip SNES)"));
+	Params.push_back(ShaderParam("pn_rgb_blur_amount", 0, 164, 4, 0.250000f, 2.000000f, 1.000000f, 0.125000f, "RGB linear blur distance"));
+	Params.push_back(ShaderParam("pn_modulator_std", 0, 168, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Modulator standard: Rec. 601 | Rec. 709"));
+	Params.push_back(ShaderParam("pn_modulator_luma_filter_type", 0, 172, 4, -1.000000f, 2.000000f, 0.000000f, 1.000000f, "Mod. Luma Lowpass Type"));
+	Params.push_back(ShaderParam("pn_modulator_luma_filter_width", 0, 176, 4, 0.000000f, 30.000000f, 3.000000f, 0.250000f, "Mod. Luma Lowpass (Type 0) Sinc Half-Width"));
+	Params.push_back(ShaderParam("pn_modulator_luma_filter_level", 0, 180, 4, 0.500000f, 40.000000f, 2.700000f, 0.025000f, "Mod. Luma Lowpass (Type 0) Sinc Cutoff Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_modulator_luma_radius", 0, 184, 4, 0.100000f, 15.000000f, 3.000000f, 0.100000f, "Mod. Luma Lowpass (Type 1) Gaussian Blur Radius"));
+	Params.push_back(ShaderParam("pn_modulator_luma_sigma", 0, 188, 4, 0.100000f, 15.000000f, 1.500000f, 0.010000f, "Mod. Luma Lowpass (Type 1) Gaussian Blur Sigma"));
+	Params.push_back(ShaderParam("pn_modulator_luma_res", 0, 192, 4, 10.000000f, 800.000000f, 180.000000f, 2.000000f, "Mod. Luma Lowpass (Type 2) GTU Signal Res Y"));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_f_lo", 0, 196, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_f_hi", 0, 200, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_g_lo", 0, 204, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_g_mid", 0, 208, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_g_hi", 0, 212, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_off", 0, 216, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_luma_eq_dist", 0, 220, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_filter_type", 0, 224, 4, -1.000000f, 0.000000f, 0.000000f, 1.000000f, "Mod. Chroma Bandpass Type"));
+	Params.push_back(ShaderParam("pn_modulator_chroma_filter_width", 0, 228, 4, 0.000000f, 30.000000f, 3.000000f, 0.250000f, "Mod. Chroma Bandpass (Type 0) Half-Width"));
+	Params.push_back(ShaderParam("pn_modulator_chroma_filter_level", 0, 232, 4, 0.500000f, 6.000000f, 3.550000f, 0.025000f, "Mod. Chroma Bandpass (Type 0) Low Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_modulator_chroma_filter_level_diff", 0, 236, 4, 0.500000f, 6.000000f, 3.600000f, 0.025000f, "Mod. Chroma Bandpass (Type 0) High Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_f_lo", 0, 240, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_f_hi", 0, 244, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_g_lo", 0, 248, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_g_mid", 0, 252, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_g_hi", 0, 256, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_off", 0, 260, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_modulator_chroma_eq_dist", 0, 264, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_std", 0, 268, 4, 0.000000f, 9.000000f, 8.000000f, 1.000000f, "R-Y/G-Y/B-Y formula: Rec. 601, Rec. 709, 2*JP, 5*US, Custom"));
+	Params.push_back(ShaderParam("pn_demodulator_std_defaults", 0, 272, 4, -1.000000f, 2.000000f, 2.000000f, 1.000000f, "Auto-sync Tint/Color: Off; Avg. Bars; Match red; Eyeballed"));
+	Params.push_back(ShaderParam("pn_demodulator_r_off", 0, 276, 4, 90.000000f, 130.000000f, 112.000000f, 1.000000f, "Custom R-Y offset"));
+	Params.push_back(ShaderParam("pn_demodulator_r_amp", 0, 280, 4, 0.000000f, 1.000000f, 0.840000f, 0.010000f, "Custom R-Y gain"));
+	Params.push_back(ShaderParam("pn_demodulator_g_off", 0, 284, 4, 200.000000f, 300.000000f, 235.000000f, 1.000000f, "Custom G-Y offset"));
+	Params.push_back(ShaderParam("pn_demodulator_g_amp", 0, 288, 4, 0.000000f, 1.000000f, 0.330000f, 0.010000f, "Custom G-Y gain"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_filter_type", 0, 292, 4, -1.000000f, 6.000000f, 0.000000f, 1.000000f, "Demodulator Luma Filter Type"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_filter_width", 0, 296, 4, 0.000000f, 30.000000f, 5.000000f, 0.250000f, "(Type 0) Lowpass Sinc Window Half-Width"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_filter_level", 0, 300, 4, 0.500000f, 4.000000f, 2.150000f, 0.025000f, "(Type 0) Lowpass Sinc Cutoff Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_radius", 0, 304, 4, 0.100000f, 15.000000f, 4.500000f, 0.100000f, "(Type 1) Gaussian Blur Radius"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_sigma", 0, 308, 4, 0.100000f, 15.000000f, 1.900000f, 0.010000f, "(Type 1) Gaussian Blur Sigma"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_res", 0, 312, 4, 10.000000f, 800.000000f, 180.000000f, 2.000000f, "(Type 2) GTU Signal Res Y"));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_f_lo", 0, 316, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_f_hi", 0, 320, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_g_lo", 0, 324, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_g_mid", 0, 328, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_g_hi", 0, 332, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_off", 0, 336, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_luma_eq_dist", 0, 340, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_filter_type", 0, 344, 4, -1.000000f, 3.000000f, 0.000000f, 1.000000f, "Demod. Chroma Filter Type"));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_filter_width", 0, 348, 4, 0.000000f, 30.000000f, 5.000000f, 0.250000f, "Demod. Chroma Bandpass (Type 0) Half-Width"));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_filter_level", 0, 352, 4, 0.500000f, 6.000000f, 3.550000f, 0.025000f, "Demod. Chroma Bandpass (Type 0) Low Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_filter_level_diff", 0, 356, 4, 0.500000f, 6.000000f, 3.600000f, 0.025000f, "Demod. Chroma Bandpass (Type 0) High Frequency (MHz)"));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_f_lo", 0, 360, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_f_hi", 0, 364, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_g_lo", 0, 368, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_g_mid", 0, 372, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_g_hi", 0, 376, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_off", 0, 380, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_chroma_eq_dist", 0, 384, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_demodulator_uv_filter_type", 0, 388, 4, -1.000000f, 0.000000f, 0.000000f, 1.000000f, "B-Y R-Y Filter Type"));
+	Params.push_back(ShaderParam("pn_demodulator_uv_filter_width", 0, 392, 4, 1.000000f, 10.000000f, 1.000000f, 1.000000f, "B-Y R-Y Filter Width"));
+	Params.push_back(ShaderParam("pn_connection_type", 0, 396, 4, -1.000000f, 2.000000f, 0.000000f, 1.000000f, "Cable: RF | Composite | S-Video mod | No Artifacts"));
+	Params.push_back(ShaderParam("pn_noise_rand_offset", 0, 400, 4, 0.000000f, 999.000000f, 262.000000f, 1.000000f, "Noise random seed"));
+	Params.push_back(ShaderParam("pn_noise_min_rate", 0, 404, 4, 1.000000f, 400.000000f, 50.000000f, 2.000000f, "Noise minimum rate"));
+	Params.push_back(ShaderParam("pn_noise_max_rate", 0, 408, 4, 1.000000f, 4000.000000f, 200.000000f, 2.000000f, "Noise maximum rate"));
+	Params.push_back(ShaderParam("pn_noise_counter", 0, 412, 4, 5.000000f, 2000.000000f, 100.000000f, 5.000000f, "Amount of sine waves"));
+	Params.push_back(ShaderParam("pn_noise_severity", 0, 416, 4, 0.000000f, 10.000000f, 1.000000f, 0.025000f, "Noise overall severity factor"));
+	Params.push_back(ShaderParam("pn_bad_rgb_gamma", 0, 420, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("pn_knob_contrast", 0, 424, 4, 0.000000f, 2.000000f, 0.800000f, 0.025000f, "CRT Contrast (Picture)"));
+	Params.push_back(ShaderParam("pn_knob_brightness", 0, 428, 4, -0.500000f, 0.500000f, 0.000000f, 0.010000f, "CRT Brightness (Black Level)"));
+	Params.push_back(ShaderParam("pn_knob_saturation", 0, 432, 4, 0.000000f, 5.000000f, 1.000000f, 0.025000f, "CRT Color (Saturation)"));
+	Params.push_back(ShaderParam("pn_knob_tint", 0, 436, 4, -45.000000f, 45.000000f, 0.000000f, 0.500000f, "CRT Tint (Hue Rotation)"));
+	Params.push_back(ShaderParam("pn_rgb_smear_enable", 0, 440, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable Smearing (Should be off unless your CRT is wearing out)"));
+	Params.push_back(ShaderParam("pn_rgb_smear_clamp", 0, 444, 4, 1.000000f, 3.000000f, 1.500000f, 0.050000f, "RGB Clamp Level (any value above this becomes equal to this)"));
+	Params.push_back(ShaderParam("pn_rgb_smear_rate", 0, 448, 4, 1.000000f, 3.000000f, 1.150000f, 0.050000f, "RGB Smear Level (after clamping, anything above this smears)"));
+	Params.push_back(ShaderParam("pn_rgb_smear_limit", 0, 452, 4, 0.000000f, 100.000000f, 30.000000f, 0.250000f, "Max Smear Detection Distance (% of screen)"));
+	Params.push_back(ShaderParam("pn_rgb_smear_res", 0, 456, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Smear Resolution (Higher is more intense but more accurate)"));
+	Params.push_back(ShaderParam("pn_gamma_type", 0, 460, 4, 0.000000f, 3.000000f, 1.000000f, 1.000000f, "Gamma: BT.1886 + Grade black lift fix | BT.1886 | Power | sRGB"));
+	Params.push_back(ShaderParam("pn_g_CRT_l", 0, 464, 4, 2.300000f, 2.600000f, 2.500000f, 0.010000f, "Black lift fix approximate gamma"));
+	Params.push_back(ShaderParam("pn_power_gamma", 0, 468, 4, 1.500000f, 3.500000f, 2.400000f, 0.010000f, "Power gamma"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", -1, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -31,6 +31,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef : public ShaderDef
+{
+public:
+	NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1595,40 +1606,34 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef : public ShaderDef
+RetroArch::NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef::NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef() : ShaderDef{}
 {
-public:
-	NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef() : ShaderDef{}
-	{
-		Name = "trilinearLUT-switchable";
-		VertexByteCode = RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("lut_toggle", -1, 52, 4, 0.000000f, 4.000000f, 4.000000f, 1.000000f, "Gamut: sRGB, P22-80s, P22-90s, P22-J, Trinitron P22"));
-		Params.push_back(ShaderParam("lut_index", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "White point: SMPTE-C (D65) | NTSC-U (C) | NTSC-J (9300K+27MPCD)"));
-		Params.push_back(ShaderParam("lut_chroma_adapt", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(For P22-J and Trinitron w/ NTSC-J) Chromatic Adaptation to D65"));
-		Samplers.push_back(ShaderSampler("PhosphorSamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("PhosphorSamplerLUT5", 7));
-		Samplers.push_back(ShaderSampler("PhosphorSamplerLUT6", 8));
-		Samplers.push_back(ShaderSampler("PhosphorSamplerLUT2", 4));
-		Samplers.push_back(ShaderSampler("PhosphorSamplerLUT3", 5));
-		Samplers.push_back(ShaderSampler("PhosphorSamplerLUT4", 6));
+	Name = "trilinearLUT-switchable";
+	VertexByteCode = RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchNtscShadersPatchyNtscTrilinearLUTSwitchableShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("lut_toggle", -1, 52, 4, 0.000000f, 4.000000f, 4.000000f, 1.000000f, "Gamut: sRGB, P22-80s, P22-90s, P22-J, Trinitron P22"));
+	Params.push_back(ShaderParam("lut_index", -1, 56, 4, 0.000000f, 2.000000f, 1.000000f, 1.000000f, "White point: SMPTE-C (D65) | NTSC-U (C) | NTSC-J (9300K+27MPCD)"));
+	Params.push_back(ShaderParam("lut_chroma_adapt", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(For P22-J and Trinitron w/ NTSC-J) Chromatic Adaptation to D65"));
+	Samplers.push_back(ShaderSampler("PhosphorSamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("PhosphorSamplerLUT5", 7));
+	Samplers.push_back(ShaderSampler("PhosphorSamplerLUT6", 8));
+	Samplers.push_back(ShaderSampler("PhosphorSamplerLUT2", 4));
+	Samplers.push_back(ShaderSampler("PhosphorSamplerLUT3", 5));
+	Samplers.push_back(ShaderSampler("PhosphorSamplerLUT4", 6));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
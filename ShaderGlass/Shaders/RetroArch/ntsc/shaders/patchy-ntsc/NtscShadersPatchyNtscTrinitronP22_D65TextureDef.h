@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class NtscShadersPatchyNtscTrinitronP22_D65TextureDef : public TextureDef
+{
+public:
+	NtscShadersPatchyNtscTrinitronP22_D65TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace NtscShadersPatchyNtscTrinitronP22_D65TextureDefs
 {
 const BYTE sData[] =
@@ -1447,13 +1455,10 @@ const BYTE sData[] =
 ,68,46,190,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class NtscShadersPatchyNtscTrinitronP22_D65TextureDef : public TextureDef
+NtscShadersPatchyNtscTrinitronP22_D65TextureDef::NtscShadersPatchyNtscTrinitronP22_D65TextureDef() : TextureDef{}
 {
-public:
-	NtscShadersPatchyNtscTrinitronP22_D65TextureDef() : TextureDef{}
-	{
-		Name = "TrinitronP22_D65.png";
-		Data = NtscShadersPatchyNtscTrinitronP22_D65TextureDefs::sData;
-		DataLength = sizeof(NtscShadersPatchyNtscTrinitronP22_D65TextureDefs::sData);
-	}
-};
+	Name = "TrinitronP22_D65.png";
+	Data = NtscShadersPatchyNtscTrinitronP22_D65TextureDefs::sData;
+	DataLength = sizeof(NtscShadersPatchyNtscTrinitronP22_D65TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class NtscShadersPatchyNtscTrinitronP22_D93TextureDef : public TextureDef
+{
+public:
+	NtscShadersPatchyNtscTrinitronP22_D93TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace NtscShadersPatchyNtscTrinitronP22_D93TextureDefs
 {
 const BYTE sData[] =
@@ -824,13 +832,10 @@ const BYTE sData[] =
 ,156,55,237,250,250,2,219,230,225,237,140,203,191,255,31,71,213,121,40,53,64,185,134,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class NtscShadersPatchyNtscTrinitronP22_D93TextureDef : public TextureDef
+NtscShadersPatchyNtscTrinitronP22_D93TextureDef::NtscShadersPatchyNtscTrinitronP22_D93TextureDef() : TextureDef{}
 {
-public:
-	NtscShadersPatchyNtscTrinitronP22_D93TextureDef() : TextureDef{}
-	{
-		Name = "TrinitronP22_D93.png";
-		Data = NtscShadersPatchyNtscTrinitronP22_D93TextureDefs::sData;
-		DataLength = sizeof(NtscShadersPatchyNtscTrinitronP22_D93TextureDefs::sData);
-	}
-};
+	Name = "TrinitronP22_D93.png";
+	Data = NtscShadersPatchyNtscTrinitronP22_D93TextureDefs::sData;
+	DataLength = sizeof(NtscShadersPatchyNtscTrinitronP22_D93TextureDefs::sData);
+}
+#endif
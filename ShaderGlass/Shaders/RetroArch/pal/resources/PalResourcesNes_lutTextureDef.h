@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class PalResourcesNes_lutTextureDef : public TextureDef
+{
+public:
+	PalResourcesNes_lutTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace PalResourcesNes_lutTextureDefs
 {
 const BYTE sData[] =
@@ -25,13 +33,10 @@ const BYTE sData[] =
 ,69,78,68,174,66,96,130};
 }
 
-class PalResourcesNes_lutTextureDef : public TextureDef
+PalResourcesNes_lutTextureDef::PalResourcesNes_lutTextureDef() : TextureDef{}
 {
-public:
-	PalResourcesNes_lutTextureDef() : TextureDef{}
-	{
-		Name = "nes_lut.png";
-		Data = PalResourcesNes_lutTextureDefs::sData;
-		DataLength = sizeof(PalResourcesNes_lutTextureDefs::sData);
-	}
-};
+	Name = "nes_lut.png";
+	Data = PalResourcesNes_lutTextureDefs::sData;
+	DataLength = sizeof(PalResourcesNes_lutTextureDefs::sData);
+}
+#endif
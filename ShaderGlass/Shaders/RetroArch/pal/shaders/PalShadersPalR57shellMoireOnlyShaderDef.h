@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PalShadersPalR57shellMoireOnlyShaderDef : public ShaderDef
+{
+public:
+	PalShadersPalR57shellMoireOnlyShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPalShadersPalR57shellMoireOnlyShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -897,31 +908,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PalShadersPalR57shellMoireOnlyShaderDef : public ShaderDef
+RetroArch::PalShadersPalR57shellMoireOnlyShaderDef::PalShadersPalR57shellMoireOnlyShaderDef() : ShaderDef{}
 {
-public:
-	PalShadersPalR57shellMoireOnlyShaderDef() : ShaderDef{}
-	{
-		Name = "pal-r57shell-moire-only";
-		VertexByteCode = RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pal-r57shell-moire-only";
+	VertexByteCode = RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPalShadersPalR57shellMoireOnlyShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
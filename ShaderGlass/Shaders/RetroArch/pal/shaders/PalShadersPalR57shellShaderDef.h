@@ -123,6 +123,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PalShadersPalR57shellShaderDef : public ShaderDef
+{
+public:
+	PalShadersPalR57shellShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPalShadersPalR57shellShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2251,50 +2262,44 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PalShadersPalR57shellShaderDef : public ShaderDef
+RetroArch::PalShadersPalR57shellShaderDef::PalShadersPalR57shellShaderDef() : ShaderDef{}
 {
-public:
-	PalShadersPalR57shellShaderDef() : ShaderDef{}
-	{
-		Name = "pal-r57shell";
-		VertexByteCode = RetroArchPalShadersPalR57shellShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPalShadersPalR57shellShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPalShadersPalR57shellShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPalShadersPalR57shellShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Gamma", -1, 52, 4, 0.000000f, 10.000000f, 2.500000f, 0.031250f, "PAL Gamma"));
-		Params.push_back(ShaderParam("Brightness", -1, 56, 4, -1.000000f, 2.000000f, 0.000000f, 0.031250f, "PAL Brightness"));
-		Params.push_back(ShaderParam("Contrast", -1, 60, 4, -1.000000f, 2.000000f, 1.000000f, 0.031250f, "PAL Contrast"));
-		Params.push_back(ShaderParam("Saturation", -1, 64, 4, -1.000000f, 2.000000f, 1.000000f, 0.031250f, "PAL Saturation"));
-		Params.push_back(ShaderParam("HueShift", -1, 68, 4, -6.000000f, 6.000000f, -2.500000f, 0.015625f, "PAL Hue Shift"));
-		Params.push_back(ShaderParam("HueRotation", -1, 72, 4, -5.000000f, 5.000000f, 2.000000f, 0.015625f, "PAL Hue Rotation"));
-		Params.push_back(ShaderParam("Ywidth", -1, 76, 4, 1.000000f, 32.000000f, 12.000000f, 1.000000f, "PAL Y Width"));
-		Params.push_back(ShaderParam("Uwidth", -1, 80, 4, 1.000000f, 32.000000f, 23.000000f, 1.000000f, "PAL U Width"));
-		Params.push_back(ShaderParam("Vwidth", -1, 84, 4, 1.000000f, 32.000000f, 23.000000f, 1.000000f, "PAL V Width"));
-		Params.push_back(ShaderParam("TV_Pixels", -1, 88, 4, 1.000000f, 2400.000000f, 200.000000f, 1.000000f, "PAL TV Pixels"));
-		Params.push_back(ShaderParam("SizeX", -1, 92, 4, 1.000000f, 4096.000000f, 256.000000f, 1.000000f, "Active Width"));
-		Params.push_back(ShaderParam("SizeY", -1, 96, 4, 1.000000f, 4096.000000f, 240.000000f, 1.000000f, "Active Height"));
-		Params.push_back(ShaderParam("dark_scanline", -1, 100, 4, 0.000000f, 1.000000f, 0.500000f, 0.025000f, "PAL Scanline"));
-		Params.push_back(ShaderParam("Phase_Y", -1, 104, 4, 0.000000f, 12.000000f, 2.000000f, 0.025000f, "PAL Phase Y"));
-		Params.push_back(ShaderParam("Phase_One", -1, 108, 4, 0.000000f, 12.000000f, 0.000000f, 0.025000f, "PAL Phase One"));
-		Params.push_back(ShaderParam("Phase_Two", -1, 112, 4, 0.000000f, 12.000000f, 8.000000f, 0.025000f, "PAL Phase Two"));
-		Params.push_back(ShaderParam("USE_RAW_param", -1, 116, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(NES ONLY) Decode RAW Colors"));
-		Params.push_back(ShaderParam("USE_LUT_param", -1, 120, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(NES ONLY) Use RAW LUT For Speed"));
-		Samplers.push_back(ShaderSampler("nes_lut", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pal-r57shell";
+	VertexByteCode = RetroArchPalShadersPalR57shellShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPalShadersPalR57shellShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPalShadersPalR57shellShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPalShadersPalR57shellShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Gamma", -1, 52, 4, 0.000000f, 10.000000f, 2.500000f, 0.031250f, "PAL Gamma"));
+	Params.push_back(ShaderParam("Brightness", -1, 56, 4, -1.000000f, 2.000000f, 0.000000f, 0.031250f, "PAL Brightness"));
+	Params.push_back(ShaderParam("Contrast", -1, 60, 4, -1.000000f, 2.000000f, 1.000000f, 0.031250f, "PAL Contrast"));
+	Params.push_back(ShaderParam("Saturation", -1, 64, 4, -1.000000f, 2.000000f, 1.000000f, 0.031250f, "PAL Saturation"));
+	Params.push_back(ShaderParam("HueShift", -1, 68, 4, -6.000000f, 6.000000f, -2.500000f, 0.015625f, "PAL Hue Shift"));
+	Params.push_back(ShaderParam("HueRotation", -1, 72, 4, -5.000000f, 5.000000f, 2.000000f, 0.015625f, "PAL Hue Rotation"));
+	Params.push_back(ShaderParam("Ywidth", -1, 76, 4, 1.000000f, 32.000000f, 12.000000f, 1.000000f, "PAL Y Width"));
+	Params.push_back(ShaderParam("Uwidth", -1, 80, 4, 1.000000f, 32.000000f, 23.000000f, 1.000000f, "PAL U Width"));
+	Params.push_back(ShaderParam("Vwidth", -1, 84, 4, 1.000000f, 32.000000f, 23.000000f, 1.000000f, "PAL V Width"));
+	Params.push_back(ShaderParam("TV_Pixels", -1, 88, 4, 1.000000f, 2400.000000f, 200.000000f, 1.000000f, "PAL TV Pixels"));
+	Params.push_back(ShaderParam("SizeX", -1, 92, 4, 1.000000f, 4096.000000f, 256.000000f, 1.000000f, "Active Width"));
+	Params.push_back(ShaderParam("SizeY", -1, 96, 4, 1.000000f, 4096.000000f, 240.000000f, 1.000000f, "Active Height"));
+	Params.push_back(ShaderParam("dark_scanline", -1, 100, 4, 0.000000f, 1.000000f, 0.500000f, 0.025000f, "PAL Scanline"));
+	Params.push_back(ShaderParam("Phase_Y", -1, 104, 4, 0.000000f, 12.000000f, 2.000000f, 0.025000f, "PAL Phase Y"));
+	Params.push_back(ShaderParam("Phase_One", -1, 108, 4, 0.000000f, 12.000000f, 0.000000f, 0.025000f, "PAL Phase One"));
+	Params.push_back(ShaderParam("Phase_Two", -1, 112, 4, 0.000000f, 12.000000f, 8.000000f, 0.025000f, "PAL Phase Two"));
+	Params.push_back(ShaderParam("USE_RAW_param", -1, 116, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(NES ONLY) Decode RAW Colors"));
+	Params.push_back(ShaderParam("USE_LUT_param", -1, 120, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "(NES ONLY) Use RAW LUT For Speed"));
+	Samplers.push_back(ShaderSampler("nes_lut", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -30,6 +30,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersAannShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersAannShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersAannShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1522,33 +1533,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersAannShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersAannShaderDef::PixelArtScalingShadersAannShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersAannShaderDef() : ShaderDef{}
-	{
-		Name = "aann";
-		VertexByteCode = RetroArchPixelArtScalingShadersAannShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersAannShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersAannShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersAannShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("NOGAMMA", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interpolate in sRGB"));
-		Params.push_back(ShaderParam("MASKING", -1, 4, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "8px Overscan Masking"));
-		Params.push_back(ShaderParam("BILINEAR", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force Bilinear Filtering"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "aann";
+	VertexByteCode = RetroArchPixelArtScalingShadersAannShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersAannShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersAannShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersAannShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("NOGAMMA", -1, 0, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Interpolate in sRGB"));
+	Params.push_back(ShaderParam("MASKING", -1, 4, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "8px Overscan Masking"));
+	Params.push_back(ShaderParam("BILINEAR", -1, 8, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Force Bilinear Filtering"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
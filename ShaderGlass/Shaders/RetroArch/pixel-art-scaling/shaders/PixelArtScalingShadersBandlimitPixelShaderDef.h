@@ -26,6 +26,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersBandlimitPixelShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersBandlimitPixelShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1100,29 +1111,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersBandlimitPixelShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersBandlimitPixelShaderDef::PixelArtScalingShadersBandlimitPixelShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersBandlimitPixelShaderDef() : ShaderDef{}
-	{
-		Name = "bandlimit-pixel";
-		VertexByteCode = RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SMOOTHNESS", 0, 80, 4, 0.000000f, 5.000000f, 0.500000f, 0.100000f, "Smoothness"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "bandlimit-pixel";
+	VertexByteCode = RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersBandlimitPixelShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SMOOTHNESS", 0, 80, 4, 0.000000f, 5.000000f, 0.500000f, 0.100000f, "Smoothness"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersBilinearAdjustableShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersBilinearAdjustableShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -499,34 +510,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersBilinearAdjustableShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersBilinearAdjustableShaderDef::PixelArtScalingShadersBilinearAdjustableShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersBilinearAdjustableShaderDef() : ShaderDef{}
-	{
-		Name = "bilinear-adjustable";
-		VertexByteCode = RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("sharp1", -1, 48, 4, 1.000000f, 10.000000f, 1.000000f, 0.100000f, "Horizontal Sharpness"));
-		Params.push_back(ShaderParam("sharp2", -1, 52, 4, 1.000000f, 10.000000f, 1.000000f, 0.100000f, "Vertical Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "bilinear-adjustable";
+	VertexByteCode = RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersBilinearAdjustableShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FinalViewportSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("sharp1", -1, 48, 4, 1.000000f, 10.000000f, 1.000000f, 0.100000f, "Horizontal Sharpness"));
+	Params.push_back(ShaderParam("sharp2", -1, 52, 4, 1.000000f, 10.000000f, 1.000000f, 0.100000f, "Vertical Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -54,6 +54,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersCleanEdgeRotateShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersCleanEdgeRotateShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -12517,38 +12528,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersCleanEdgeRotateShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersCleanEdgeRotateShaderDef::PixelArtScalingShadersCleanEdgeRotateShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersCleanEdgeRotateShaderDef() : ShaderDef{}
-	{
-		Name = "cleanEdge-rotate";
-		VertexByteCode = RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("simthresh", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Similarity Threshold"));
-		Params.push_back(ShaderParam("linewidth", -1, 56, 4, 0.010000f, 2.000000f, 1.000000f, 0.100000f, "Line Width"));
-		Params.push_back(ShaderParam("ce_rotation", -1, 60, 4, -6.280000f, 6.280000f, 0.000000f, 0.010000f, "Rotation"));
-		Params.push_back(ShaderParam("ce_zoom", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Zoom"));
-		Params.push_back(ShaderParam("ce_x_off", -1, 68, 4, -1.000000f, 1.000000f, 0.000000f, 0.002000f, "X Offset"));
-		Params.push_back(ShaderParam("ce_y_off", -1, 72, 4, -1.000000f, 1.000000f, 0.000000f, 0.002000f, "Y Offset"));
-		Params.push_back(ShaderParam("ce_mode", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "cleanEdge Effect Toggle (debug)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cleanEdge-rotate";
+	VertexByteCode = RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersCleanEdgeRotateShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("simthresh", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Similarity Threshold"));
+	Params.push_back(ShaderParam("linewidth", -1, 56, 4, 0.010000f, 2.000000f, 1.000000f, 0.100000f, "Line Width"));
+	Params.push_back(ShaderParam("ce_rotation", -1, 60, 4, -6.280000f, 6.280000f, 0.000000f, 0.010000f, "Rotation"));
+	Params.push_back(ShaderParam("ce_zoom", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Zoom"));
+	Params.push_back(ShaderParam("ce_x_off", -1, 68, 4, -1.000000f, 1.000000f, 0.000000f, 0.002000f, "X Offset"));
+	Params.push_back(ShaderParam("ce_y_off", -1, 72, 4, -1.000000f, 1.000000f, 0.000000f, 0.002000f, "Y Offset"));
+	Params.push_back(ShaderParam("ce_mode", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "cleanEdge Effect Toggle (debug)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
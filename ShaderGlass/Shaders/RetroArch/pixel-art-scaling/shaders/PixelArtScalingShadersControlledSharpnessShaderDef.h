@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersControlledSharpnessShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersControlledSharpnessShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -479,32 +490,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersControlledSharpnessShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersControlledSharpnessShaderDef::PixelArtScalingShadersControlledSharpnessShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersControlledSharpnessShaderDef() : ShaderDef{}
-	{
-		Name = "ControlledSharpness";
-		VertexByteCode = RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("sharpness", -1, 52, 4, 0.001000f, 0.950000f, 0.400000f, 0.050000f, "Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ControlledSharpness";
+	VertexByteCode = RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersControlledSharpnessShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("sharpness", -1, 52, 4, 0.001000f, 0.950000f, 0.400000f, 0.050000f, "Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -19,6 +19,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersEdgeNpixelsShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersEdgeNpixelsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -578,32 +589,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersEdgeNpixelsShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersEdgeNpixelsShaderDef::PixelArtScalingShadersEdgeNpixelsShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersEdgeNpixelsShaderDef() : ShaderDef{}
-	{
-		Name = "edgeNpixels";
-		VertexByteCode = RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PixelCount", -1, 52, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "Pixel Count"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "edgeNpixels";
+	VertexByteCode = RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersEdgeNpixelsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PixelCount", -1, 52, 4, 1.000000f, 8.000000f, 2.000000f, 1.000000f, "Pixel Count"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -24,6 +24,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersPixellateShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersPixellateShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersPixellateShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -784,31 +795,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersPixellateShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersPixellateShaderDef::PixelArtScalingShadersPixellateShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersPixellateShaderDef() : ShaderDef{}
-	{
-		Name = "pixellate";
-		VertexByteCode = RetroArchPixelArtScalingShadersPixellateShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersPixellateShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersPixellateShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixellateShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("INTERPOLATE_IN_LINEAR_GAMMA", 0, 112, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Linear Gamma Weight"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pixellate";
+	VertexByteCode = RetroArchPixelArtScalingShadersPixellateShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersPixellateShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersPixellateShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixellateShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", 0, 64, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", 0, 80, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", 0, 96, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("INTERPOLATE_IN_LINEAR_GAMMA", 0, 112, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Linear Gamma Weight"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersSharpBilinearScanlinesShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersSharpBilinearScanlinesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -634,33 +645,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersSharpBilinearScanlinesShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersSharpBilinearScanlinesShaderDef::PixelArtScalingShadersSharpBilinearScanlinesShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersSharpBilinearScanlinesShaderDef() : ShaderDef{}
-	{
-		Name = "sharp-bilinear-scanlines";
-		VertexByteCode = RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", -1, 48, 4, 0.000000f, 1.000000f, 0.600000f, 0.010000f, "Scanline Base Brightness"));
-		Params.push_back(ShaderParam("SCANLINE_HORIZONTAL_MODULATION", -1, 52, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Scanline Horizontal Modulation"));
-		Params.push_back(ShaderParam("SCANLINE_VERTICAL_MODULATION", -1, 56, 4, 0.000000f, 2.000000f, 0.750000f, 0.010000f, "Scanline Vertical Modulation"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sharp-bilinear-scanlines";
+	VertexByteCode = RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearScanlinesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE_BASE_BRIGHTNESS", -1, 48, 4, 0.000000f, 1.000000f, 0.600000f, 0.010000f, "Scanline Base Brightness"));
+	Params.push_back(ShaderParam("SCANLINE_HORIZONTAL_MODULATION", -1, 52, 4, 0.000000f, 2.000000f, 0.000000f, 0.010000f, "Scanline Horizontal Modulation"));
+	Params.push_back(ShaderParam("SCANLINE_VERTICAL_MODULATION", -1, 56, 4, 0.000000f, 2.000000f, 0.750000f, 0.010000f, "Scanline Vertical Modulation"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
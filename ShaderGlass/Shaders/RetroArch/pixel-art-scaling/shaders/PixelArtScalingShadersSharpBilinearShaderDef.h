@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersSharpBilinearShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersSharpBilinearShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersSharpBilinearShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -456,32 +467,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersSharpBilinearShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersSharpBilinearShaderDef::PixelArtScalingShadersSharpBilinearShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersSharpBilinearShaderDef() : ShaderDef{}
-	{
-		Name = "sharp-bilinear";
-		VertexByteCode = RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SHARP_BILINEAR_PRE_SCALE", -1, 48, 4, 1.000000f, 10.000000f, 4.000000f, 1.000000f, "Sharp Bilinear Prescale"));
-		Params.push_back(ShaderParam("AUTO_PRESCALE", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Automatic Prescale"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sharp-bilinear";
+	VertexByteCode = RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SHARP_BILINEAR_PRE_SCALE", -1, 48, 4, 1.000000f, 10.000000f, 4.000000f, 1.000000f, "Sharp Bilinear Prescale"));
+	Params.push_back(ShaderParam("AUTO_PRESCALE", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Automatic Prescale"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersSharpBilinearSimpleShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersSharpBilinearSimpleShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -494,30 +505,24 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersSharpBilinearSimpleShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersSharpBilinearSimpleShaderDef::PixelArtScalingShadersSharpBilinearSimpleShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersSharpBilinearSimpleShaderDef() : ShaderDef{}
-	{
-		Name = "sharp-bilinear-simple";
-		VertexByteCode = RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sharp-bilinear-simple";
+	VertexByteCode = RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersSharpBilinearSimpleShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersUniformNearestShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersUniformNearestShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersUniformNearestShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -549,32 +560,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersUniformNearestShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersUniformNearestShaderDef::PixelArtScalingShadersUniformNearestShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersUniformNearestShaderDef() : ShaderDef{}
-	{
-		Name = "uniform-nearest";
-		VertexByteCode = RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "uniform-nearest";
+	VertexByteCode = RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersUniformNearestShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BGR_LCD_PATTERN", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "BGR output pattern"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
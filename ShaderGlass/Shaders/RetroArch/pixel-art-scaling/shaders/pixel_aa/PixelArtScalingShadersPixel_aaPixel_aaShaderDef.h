@@ -42,6 +42,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersPixel_aaPixel_aaShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersPixel_aaPixel_aaShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1220,33 +1231,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersPixel_aaPixel_aaShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersPixel_aaPixel_aaShaderDef::PixelArtScalingShadersPixel_aaPixel_aaShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersPixel_aaPixel_aaShaderDef() : ShaderDef{}
-	{
-		Name = "pixel_aa";
-		VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("PIX_AA_SHARP", -1, 36, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Pixel AA sharpening amount"));
-		Params.push_back(ShaderParam("PIX_AA_SUBPX", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable subpixel AA"));
-		Params.push_back(ShaderParam("PIX_AA_SUBPX_ORIENTATION", -1, 44, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Subpixel layout (0=RGB, 1=RGB vert., 2=BGR, 3=BGR vert.)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pixel_aa";
+	VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aaShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Rotation", -1, 32, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("PIX_AA_SHARP", -1, 36, 4, 0.000000f, 2.000000f, 1.500000f, 0.050000f, "Pixel AA sharpening amount"));
+	Params.push_back(ShaderParam("PIX_AA_SUBPX", -1, 40, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Enable subpixel AA"));
+	Params.push_back(ShaderParam("PIX_AA_SUBPX_ORIENTATION", -1, 44, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Subpixel layout (0=RGB, 1=RGB vert., 2=BGR, 3=BGR vert.)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
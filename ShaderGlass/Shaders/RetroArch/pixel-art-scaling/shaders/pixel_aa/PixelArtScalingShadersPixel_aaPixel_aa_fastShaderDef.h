@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -447,29 +458,23 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef::PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef() : ShaderDef{}
-	{
-		Name = "pixel_aa_fast";
-		VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "pixel_aa_fast";
+	VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaPixel_aa_fastShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
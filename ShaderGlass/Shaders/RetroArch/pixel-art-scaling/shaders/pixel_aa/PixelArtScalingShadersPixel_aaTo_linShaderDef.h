@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersPixel_aaTo_linShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersPixel_aaTo_linShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -298,27 +309,21 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersPixel_aaTo_linShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersPixel_aaTo_linShaderDef::PixelArtScalingShadersPixel_aaTo_linShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersPixel_aaTo_linShaderDef() : ShaderDef{}
-	{
-		Name = "to_lin";
-		VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "to_lin";
+	VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_linShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
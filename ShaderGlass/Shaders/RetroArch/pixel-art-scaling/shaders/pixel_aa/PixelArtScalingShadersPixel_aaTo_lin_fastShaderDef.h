@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef : public ShaderDef
+{
+public:
+	PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -289,27 +300,21 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef : public ShaderDef
+RetroArch::PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef::PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef() : ShaderDef{}
 {
-public:
-	PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef() : ShaderDef{}
-	{
-		Name = "to_lin_fast";
-		VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "to_lin_fast";
+	VertexByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchPixelArtScalingShadersPixel_aaTo_lin_fastShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
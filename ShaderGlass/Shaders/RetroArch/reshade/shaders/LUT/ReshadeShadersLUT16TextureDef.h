@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUT16TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUT16TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUT16TextureDefs
 {
 const BYTE sData[] =
@@ -16,13 +24,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUT16TextureDef : public TextureDef
+ReshadeShadersLUT16TextureDef::ReshadeShadersLUT16TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUT16TextureDef() : TextureDef{}
-	{
-		Name = "16.png";
-		Data = ReshadeShadersLUT16TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUT16TextureDefs::sData);
-	}
-};
+	Name = "16.png";
+	Data = ReshadeShadersLUT16TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUT16TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUT32TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUT32TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUT32TextureDefs
 {
 const BYTE sData[] =
@@ -19,13 +27,10 @@ const BYTE sData[] =
 ,0,0,0,0,29,0,0,0,64,0,0,0,0,58,203,69,34,126,159,229,25,203,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUT32TextureDef : public TextureDef
+ReshadeShadersLUT32TextureDef::ReshadeShadersLUT32TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUT32TextureDef() : TextureDef{}
-	{
-		Name = "32.png";
-		Data = ReshadeShadersLUT32TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUT32TextureDefs::sData);
-	}
-};
+	Name = "32.png";
+	Data = ReshadeShadersLUT32TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUT32TextureDefs::sData);
+}
+#endif
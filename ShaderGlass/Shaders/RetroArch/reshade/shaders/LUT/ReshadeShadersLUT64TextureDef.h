@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUT64TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUT64TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUT64TextureDefs
 {
 const BYTE sData[] =
@@ -38,13 +46,10 @@ const BYTE sData[] =
 ,0,0,0,0,0,0,0,0,191,179,1,123,186,66,254,221,204,141,251,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUT64TextureDef : public TextureDef
+ReshadeShadersLUT64TextureDef::ReshadeShadersLUT64TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUT64TextureDef() : TextureDef{}
-	{
-		Name = "64.png";
-		Data = ReshadeShadersLUT64TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUT64TextureDefs::sData);
-	}
-};
+	Name = "64.png";
+	Data = ReshadeShadersLUT64TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUT64TextureDefs::sData);
+}
+#endif
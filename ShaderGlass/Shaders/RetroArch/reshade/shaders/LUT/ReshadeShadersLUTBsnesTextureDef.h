@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTBsnesTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTBsnesTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTBsnesTextureDefs
 {
 const BYTE sData[] =
@@ -21,13 +29,10 @@ const BYTE sData[] =
 ,0,128,15,150,185,34,126,13,17,189,81,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTBsnesTextureDef : public TextureDef
+ReshadeShadersLUTBsnesTextureDef::ReshadeShadersLUTBsnesTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTBsnesTextureDef() : TextureDef{}
-	{
-		Name = "bsnes.png";
-		Data = ReshadeShadersLUTBsnesTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTBsnesTextureDefs::sData);
-	}
-};
+	Name = "bsnes.png";
+	Data = ReshadeShadersLUTBsnesTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTBsnesTextureDefs::sData);
+}
+#endif
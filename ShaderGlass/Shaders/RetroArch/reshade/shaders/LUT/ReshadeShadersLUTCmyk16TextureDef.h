@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTCmyk16TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTCmyk16TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTCmyk16TextureDefs
 {
 const BYTE sData[] =
@@ -139,13 +147,10 @@ const BYTE sData[] =
 ,90,125,172,122,91,168,177,45,172,229,117,255,255,23,80,72,109,172,155,225,157,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTCmyk16TextureDef : public TextureDef
+ReshadeShadersLUTCmyk16TextureDef::ReshadeShadersLUTCmyk16TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTCmyk16TextureDef() : TextureDef{}
-	{
-		Name = "cmyk-16.png";
-		Data = ReshadeShadersLUTCmyk16TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTCmyk16TextureDefs::sData);
-	}
-};
+	Name = "cmyk-16.png";
+	Data = ReshadeShadersLUTCmyk16TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTCmyk16TextureDefs::sData);
+}
+#endif
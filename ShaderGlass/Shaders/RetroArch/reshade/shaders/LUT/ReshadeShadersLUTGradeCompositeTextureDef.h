@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTGradeCompositeTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTGradeCompositeTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTGradeCompositeTextureDefs
 {
 const BYTE sData[] =
@@ -769,13 +777,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class ReshadeShadersLUTGradeCompositeTextureDef : public TextureDef
+ReshadeShadersLUTGradeCompositeTextureDef::ReshadeShadersLUTGradeCompositeTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTGradeCompositeTextureDef() : TextureDef{}
-	{
-		Name = "grade-composite.png";
-		Data = ReshadeShadersLUTGradeCompositeTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTGradeCompositeTextureDefs::sData);
-	}
-};
+	Name = "grade-composite.png";
+	Data = ReshadeShadersLUTGradeCompositeTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTGradeCompositeTextureDefs::sData);
+}
+#endif
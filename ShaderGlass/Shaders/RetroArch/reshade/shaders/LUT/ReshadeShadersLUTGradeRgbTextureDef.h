@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTGradeRgbTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTGradeRgbTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTGradeRgbTextureDefs
 {
 const BYTE sData[] =
@@ -382,13 +390,10 @@ const BYTE sData[] =
 ,96,130};
 }
 
-class ReshadeShadersLUTGradeRgbTextureDef : public TextureDef
+ReshadeShadersLUTGradeRgbTextureDef::ReshadeShadersLUTGradeRgbTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTGradeRgbTextureDef() : TextureDef{}
-	{
-		Name = "grade-rgb.png";
-		Data = ReshadeShadersLUTGradeRgbTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTGradeRgbTextureDefs::sData);
-	}
-};
+	Name = "grade-rgb.png";
+	Data = ReshadeShadersLUTGradeRgbTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTGradeRgbTextureDefs::sData);
+}
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersLUTLUTShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersLUTLUTShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersLUTLUTShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -425,32 +436,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersLUTLUTShaderDef : public ShaderDef
+RetroArch::ReshadeShadersLUTLUTShaderDef::ReshadeShadersLUTLUTShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersLUTLUTShaderDef() : ShaderDef{}
-	{
-		Name = "LUT";
-		VertexByteCode = RetroArchReshadeShadersLUTLUTShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersLUTLUTShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersLUTLUTShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersLUTLUTShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("SamplerLUT", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "LUT";
+	VertexByteCode = RetroArchReshadeShadersLUTLUTShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersLUTLUTShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersLUTLUTShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersLUTLUTShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("SamplerLUT", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersLUTMultiLUTShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersLUTMultiLUTShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersLUTMultiLUTShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -594,34 +605,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersLUTMultiLUTShaderDef : public ShaderDef
+RetroArch::ReshadeShadersLUTMultiLUTShaderDef::ReshadeShadersLUTMultiLUTShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersLUTMultiLUTShaderDef() : ShaderDef{}
-	{
-		Name = "multiLUT";
-		VertexByteCode = RetroArchReshadeShadersLUTMultiLUTShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersLUTMultiLUTShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersLUTMultiLUTShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersLUTMultiLUTShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT Selector"));
-		Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
-		Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "multiLUT";
+	VertexByteCode = RetroArchReshadeShadersLUTMultiLUTShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersLUTMultiLUTShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersLUTMultiLUTShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersLUTMultiLUTShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("LUT_selector_param", -1, 52, 4, 1.000000f, 2.000000f, 1.000000f, 1.000000f, "LUT Selector"));
+	Samplers.push_back(ShaderSampler("SamplerLUT1", 3));
+	Samplers.push_back(ShaderSampler("SamplerLUT2", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTNEC_XM29plus_captureTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTNEC_XM29plus_captureTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTNEC_XM29plus_captureTextureDefs
 {
 const BYTE sData[] =
@@ -573,13 +581,10 @@ const BYTE sData[] =
 ,250,31,216,0,104,37,252,195,172,188,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTNEC_XM29plus_captureTextureDef : public TextureDef
+ReshadeShadersLUTNEC_XM29plus_captureTextureDef::ReshadeShadersLUTNEC_XM29plus_captureTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTNEC_XM29plus_captureTextureDef() : TextureDef{}
-	{
-		Name = "NEC_XM29plus_capture.png";
-		Data = ReshadeShadersLUTNEC_XM29plus_captureTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTNEC_XM29plus_captureTextureDefs::sData);
-	}
-};
+	Name = "NEC_XM29plus_capture.png";
+	Data = ReshadeShadersLUTNEC_XM29plus_captureTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTNEC_XM29plus_captureTextureDefs::sData);
+}
+#endif
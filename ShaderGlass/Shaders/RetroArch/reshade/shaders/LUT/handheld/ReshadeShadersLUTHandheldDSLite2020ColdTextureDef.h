@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldDSLite2020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldDSLite2020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldDSLite2020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -574,13 +582,10 @@ const BYTE sData[] =
 ,96,130};
 }
 
-class ReshadeShadersLUTHandheldDSLite2020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldDSLite2020ColdTextureDef::ReshadeShadersLUTHandheldDSLite2020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldDSLite2020ColdTextureDef() : TextureDef{}
-	{
-		Name = "DSLite-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldDSLite2020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldDSLite2020ColdTextureDefs::sData);
-	}
-};
+	Name = "DSLite-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldDSLite2020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldDSLite2020ColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldDSLite2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldDSLite2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldDSLite2020TextureDefs
 {
 const BYTE sData[] =
@@ -570,13 +578,10 @@ const BYTE sData[] =
 ,157,46,244,160,184,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldDSLite2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldDSLite2020TextureDef::ReshadeShadersLUTHandheldDSLite2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldDSLite2020TextureDef() : TextureDef{}
-	{
-		Name = "DSLite-2020.png";
-		Data = ReshadeShadersLUTHandheldDSLite2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldDSLite2020TextureDefs::sData);
-	}
-};
+	Name = "DSLite-2020.png";
+	Data = ReshadeShadersLUTHandheldDSLite2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldDSLite2020TextureDefs::sData);
+}
+#endif
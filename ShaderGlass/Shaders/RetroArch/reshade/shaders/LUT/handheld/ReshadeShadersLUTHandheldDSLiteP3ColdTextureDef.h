@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldDSLiteP3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -566,13 +574,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef::ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef() : TextureDef{}
-	{
-		Name = "DSLite-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldDSLiteP3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteP3ColdTextureDefs::sData);
-	}
-};
+	Name = "DSLite-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldDSLiteP3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteP3ColdTextureDefs::sData);
+}
+#endif
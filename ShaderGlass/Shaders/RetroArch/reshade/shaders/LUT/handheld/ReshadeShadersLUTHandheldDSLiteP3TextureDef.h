@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldDSLiteP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldDSLiteP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldDSLiteP3TextureDefs
 {
 const BYTE sData[] =
@@ -557,13 +565,10 @@ const BYTE sData[] =
 ,3,78,207,171,91,219,131,112,123,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldDSLiteP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldDSLiteP3TextureDef::ReshadeShadersLUTHandheldDSLiteP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldDSLiteP3TextureDef() : TextureDef{}
-	{
-		Name = "DSLite-P3.png";
-		Data = ReshadeShadersLUTHandheldDSLiteP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteP3TextureDefs::sData);
-	}
-};
+	Name = "DSLite-P3.png";
+	Data = ReshadeShadersLUTHandheldDSLiteP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteP3TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -555,13 +563,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef::ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "DSLite-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDefs::sData);
-	}
-};
+	Name = "DSLite-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldDSLiteSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldDSLiteSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldDSLiteSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -556,13 +564,10 @@ const BYTE sData[] =
 ,136,1,130,41,45,144,24,20,61,230,224,255,3,118,61,216,94,50,218,129,206,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldDSLiteSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldDSLiteSRGBTextureDef::ReshadeShadersLUTHandheldDSLiteSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldDSLiteSRGBTextureDef() : TextureDef{}
-	{
-		Name = "DSLite-sRGB.png";
-		Data = ReshadeShadersLUTHandheldDSLiteSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteSRGBTextureDefs::sData);
-	}
-};
+	Name = "DSLite-sRGB.png";
+	Data = ReshadeShadersLUTHandheldDSLiteSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldDSLiteSRGBTextureDefs::sData);
+}
+#endif
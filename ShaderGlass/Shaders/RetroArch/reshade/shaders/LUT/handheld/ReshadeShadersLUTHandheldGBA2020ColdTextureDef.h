@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBA2020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBA2020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBA2020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -610,13 +618,10 @@ const BYTE sData[] =
 ,49,37,49,33,116,183,178,84,64,254,63,110,46,45,22,156,176,201,3,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBA2020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBA2020ColdTextureDef::ReshadeShadersLUTHandheldGBA2020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBA2020ColdTextureDef() : TextureDef{}
-	{
-		Name = "GBA-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBA2020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBA2020ColdTextureDefs::sData);
-	}
-};
+	Name = "GBA-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBA2020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBA2020ColdTextureDefs::sData);
+}
+#endif
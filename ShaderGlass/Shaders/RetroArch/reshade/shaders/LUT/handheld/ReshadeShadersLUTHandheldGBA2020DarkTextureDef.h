@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBA2020DarkTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBA2020DarkTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBA2020DarkTextureDefs
 {
 const BYTE sData[] =
@@ -611,13 +619,10 @@ const BYTE sData[] =
 ,157,68,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBA2020DarkTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBA2020DarkTextureDef::ReshadeShadersLUTHandheldGBA2020DarkTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBA2020DarkTextureDef() : TextureDef{}
-	{
-		Name = "GBA-2020(dark).png";
-		Data = ReshadeShadersLUTHandheldGBA2020DarkTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBA2020DarkTextureDefs::sData);
-	}
-};
+	Name = "GBA-2020(dark).png";
+	Data = ReshadeShadersLUTHandheldGBA2020DarkTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBA2020DarkTextureDefs::sData);
+}
+#endif
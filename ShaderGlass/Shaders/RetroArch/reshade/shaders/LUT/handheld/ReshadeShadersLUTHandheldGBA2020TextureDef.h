@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBA2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBA2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBA2020TextureDefs
 {
 const BYTE sData[] =
@@ -583,13 +591,10 @@ const BYTE sData[] =
 ,52,209,128,150,44,64,27,151,84,255,249,255,0,165,68,49,233,24,250,19,244,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBA2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBA2020TextureDef::ReshadeShadersLUTHandheldGBA2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBA2020TextureDef() : TextureDef{}
-	{
-		Name = "GBA-2020.png";
-		Data = ReshadeShadersLUTHandheldGBA2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBA2020TextureDefs::sData);
-	}
-};
+	Name = "GBA-2020.png";
+	Data = ReshadeShadersLUTHandheldGBA2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBA2020TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBAP3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBAP3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBAP3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -587,13 +595,10 @@ const BYTE sData[] =
 ,165,142,89,185,201,242,255,15,69,91,53,188,35,63,128,213,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBAP3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBAP3ColdTextureDef::ReshadeShadersLUTHandheldGBAP3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBAP3ColdTextureDef() : TextureDef{}
-	{
-		Name = "GBA-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBAP3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBAP3ColdTextureDefs::sData);
-	}
-};
+	Name = "GBA-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBAP3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBAP3ColdTextureDefs::sData);
+}
+#endif
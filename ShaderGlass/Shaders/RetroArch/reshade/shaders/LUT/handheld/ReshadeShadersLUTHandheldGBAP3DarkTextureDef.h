@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBAP3DarkTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBAP3DarkTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBAP3DarkTextureDefs
 {
 const BYTE sData[] =
@@ -616,13 +624,10 @@ const BYTE sData[] =
 ,239,139,143,3,174,103,240,228,24,255,47,52,199,81,199,50,99,68,233,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBAP3DarkTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBAP3DarkTextureDef::ReshadeShadersLUTHandheldGBAP3DarkTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBAP3DarkTextureDef() : TextureDef{}
-	{
-		Name = "GBA-P3(dark).png";
-		Data = ReshadeShadersLUTHandheldGBAP3DarkTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBAP3DarkTextureDefs::sData);
-	}
-};
+	Name = "GBA-P3(dark).png";
+	Data = ReshadeShadersLUTHandheldGBAP3DarkTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBAP3DarkTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBAP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBAP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBAP3TextureDefs
 {
 const BYTE sData[] =
@@ -587,13 +595,10 @@ const BYTE sData[] =
 ,20,120,28,108,247,2,165,92,149,143,64,193,127,6,224,28,37,225,20,198,167,95,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBAP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBAP3TextureDef::ReshadeShadersLUTHandheldGBAP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBAP3TextureDef() : TextureDef{}
-	{
-		Name = "GBA-P3.png";
-		Data = ReshadeShadersLUTHandheldGBAP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBAP3TextureDefs::sData);
-	}
-};
+	Name = "GBA-P3.png";
+	Data = ReshadeShadersLUTHandheldGBAP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBAP3TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBASRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBASRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBASRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -581,13 +589,10 @@ const BYTE sData[] =
 ,180,44,178,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBASRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBASRGBColdTextureDef::ReshadeShadersLUTHandheldGBASRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBASRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "GBA-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBASRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBASRGBColdTextureDefs::sData);
-	}
-};
+	Name = "GBA-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBASRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBASRGBColdTextureDefs::sData);
+}
+#endif
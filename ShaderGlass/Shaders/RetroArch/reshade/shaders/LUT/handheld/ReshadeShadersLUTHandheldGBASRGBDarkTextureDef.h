@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBASRGBDarkTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBASRGBDarkTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBASRGBDarkTextureDefs
 {
 const BYTE sData[] =
@@ -646,13 +654,10 @@ const BYTE sData[] =
 ,225,57,200,177,6,138,254,55,168,252,31,167,87,28,183,177,14,1,103,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBASRGBDarkTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBASRGBDarkTextureDef::ReshadeShadersLUTHandheldGBASRGBDarkTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBASRGBDarkTextureDef() : TextureDef{}
-	{
-		Name = "GBA-sRGB(dark).png";
-		Data = ReshadeShadersLUTHandheldGBASRGBDarkTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBASRGBDarkTextureDefs::sData);
-	}
-};
+	Name = "GBA-sRGB(dark).png";
+	Data = ReshadeShadersLUTHandheldGBASRGBDarkTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBASRGBDarkTextureDefs::sData);
+}
+#endif
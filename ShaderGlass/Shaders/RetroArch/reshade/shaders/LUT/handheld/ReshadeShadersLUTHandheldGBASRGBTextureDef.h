@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBASRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBASRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBASRGBTextureDefs
 {
 const BYTE sData[] =
@@ -579,13 +587,10 @@ const BYTE sData[] =
 ,198,156,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBASRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBASRGBTextureDef::ReshadeShadersLUTHandheldGBASRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBASRGBTextureDef() : TextureDef{}
-	{
-		Name = "GBA-sRGB.png";
-		Data = ReshadeShadersLUTHandheldGBASRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBASRGBTextureDefs::sData);
-	}
-};
+	Name = "GBA-sRGB.png";
+	Data = ReshadeShadersLUTHandheldGBASRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBASRGBTextureDefs::sData);
+}
+#endif
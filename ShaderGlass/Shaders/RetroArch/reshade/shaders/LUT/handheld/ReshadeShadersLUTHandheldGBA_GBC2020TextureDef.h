@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBA_GBC2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBA_GBC2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBA_GBC2020TextureDefs
 {
 const BYTE sData[] =
@@ -603,13 +611,10 @@ const BYTE sData[] =
 ,73,59,196,15,4,227,255,1,179,231,75,59,83,142,243,198,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBA_GBC2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBA_GBC2020TextureDef::ReshadeShadersLUTHandheldGBA_GBC2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBA_GBC2020TextureDef() : TextureDef{}
-	{
-		Name = "GBA_GBC-2020.png";
-		Data = ReshadeShadersLUTHandheldGBA_GBC2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBA_GBC2020TextureDefs::sData);
-	}
-};
+	Name = "GBA_GBC-2020.png";
+	Data = ReshadeShadersLUTHandheldGBA_GBC2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBA_GBC2020TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBA_GBCP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBA_GBCP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBA_GBCP3TextureDefs
 {
 const BYTE sData[] =
@@ -632,13 +640,10 @@ const BYTE sData[] =
 ,140,255,15,142,210,43,129,19,27,134,127,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBA_GBCP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBA_GBCP3TextureDef::ReshadeShadersLUTHandheldGBA_GBCP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBA_GBCP3TextureDef() : TextureDef{}
-	{
-		Name = "GBA_GBC-P3.png";
-		Data = ReshadeShadersLUTHandheldGBA_GBCP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBA_GBCP3TextureDefs::sData);
-	}
-};
+	Name = "GBA_GBC-P3.png";
+	Data = ReshadeShadersLUTHandheldGBA_GBCP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBA_GBCP3TextureDefs::sData);
+}
+#endif
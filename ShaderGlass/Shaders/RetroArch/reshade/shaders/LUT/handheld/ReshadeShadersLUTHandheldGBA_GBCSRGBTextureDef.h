@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -632,13 +640,10 @@ const BYTE sData[] =
 ,175,113,25,66,202,173,8,181,21,66,101,34,92,91,33,254,127,40,17,242,72,48,118,39,37,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef::ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef() : TextureDef{}
-	{
-		Name = "GBA_GBC-sRGB.png";
-		Data = ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDefs::sData);
-	}
-};
+	Name = "GBA_GBC-sRGB.png";
+	Data = ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBC2020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBC2020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBC2020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -647,13 +655,10 @@ const BYTE sData[] =
 ,170,45,1,234,255,3,137,69,236,142,75,142,246,194,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBC2020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBC2020ColdTextureDef::ReshadeShadersLUTHandheldGBC2020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBC2020ColdTextureDef() : TextureDef{}
-	{
-		Name = "GBC-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBC2020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBC2020ColdTextureDefs::sData);
-	}
-};
+	Name = "GBC-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBC2020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBC2020ColdTextureDefs::sData);
+}
+#endif
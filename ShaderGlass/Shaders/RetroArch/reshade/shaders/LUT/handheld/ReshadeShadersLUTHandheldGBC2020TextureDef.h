@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBC2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBC2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBC2020TextureDefs
 {
 const BYTE sData[] =
@@ -637,13 +645,10 @@ const BYTE sData[] =
 ,130};
 }
 
-class ReshadeShadersLUTHandheldGBC2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBC2020TextureDef::ReshadeShadersLUTHandheldGBC2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBC2020TextureDef() : TextureDef{}
-	{
-		Name = "GBC-2020.png";
-		Data = ReshadeShadersLUTHandheldGBC2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBC2020TextureDefs::sData);
-	}
-};
+	Name = "GBC-2020.png";
+	Data = ReshadeShadersLUTHandheldGBC2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBC2020TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBCDevTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBCDevTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBCDevTextureDefs
 {
 const BYTE sData[] =
@@ -418,13 +426,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBCDevTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBCDevTextureDef::ReshadeShadersLUTHandheldGBCDevTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBCDevTextureDef() : TextureDef{}
-	{
-		Name = "GBC-dev.png";
-		Data = ReshadeShadersLUTHandheldGBCDevTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBCDevTextureDefs::sData);
-	}
-};
+	Name = "GBC-dev.png";
+	Data = ReshadeShadersLUTHandheldGBCDevTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBCDevTextureDefs::sData);
+}
+#endif
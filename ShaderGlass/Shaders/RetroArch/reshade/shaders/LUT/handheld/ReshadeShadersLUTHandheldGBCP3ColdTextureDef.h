@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBCP3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBCP3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBCP3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -641,13 +649,10 @@ const BYTE sData[] =
 ,204,80,149,25,212,130,96,232,66,250,255,1,34,148,189,40,17,134,48,20,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBCP3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBCP3ColdTextureDef::ReshadeShadersLUTHandheldGBCP3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBCP3ColdTextureDef() : TextureDef{}
-	{
-		Name = "GBC-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBCP3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBCP3ColdTextureDefs::sData);
-	}
-};
+	Name = "GBC-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBCP3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBCP3ColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBCP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBCP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBCP3TextureDefs
 {
 const BYTE sData[] =
@@ -631,13 +639,10 @@ const BYTE sData[] =
 ,55,149,96,15,81,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBCP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBCP3TextureDef::ReshadeShadersLUTHandheldGBCP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBCP3TextureDef() : TextureDef{}
-	{
-		Name = "GBC-P3.png";
-		Data = ReshadeShadersLUTHandheldGBCP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBCP3TextureDefs::sData);
-	}
-};
+	Name = "GBC-P3.png";
+	Data = ReshadeShadersLUTHandheldGBCP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBCP3TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBCSRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBCSRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBCSRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -633,13 +641,10 @@ const BYTE sData[] =
 ,0,103,42,224,17,238,149,143,73,90,83,143,241,127,1,207,110,132,187,197,157,186,205,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBCSRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBCSRGBColdTextureDef::ReshadeShadersLUTHandheldGBCSRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBCSRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "GBC-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBCSRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBCSRGBColdTextureDefs::sData);
-	}
-};
+	Name = "GBC-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBCSRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBCSRGBColdTextureDefs::sData);
+}
+#endif
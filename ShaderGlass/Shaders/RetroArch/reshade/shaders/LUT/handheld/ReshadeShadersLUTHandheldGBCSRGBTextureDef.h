@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBCSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBCSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBCSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -622,13 +630,10 @@ const BYTE sData[] =
 ,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBCSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBCSRGBTextureDef::ReshadeShadersLUTHandheldGBCSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBCSRGBTextureDef() : TextureDef{}
-	{
-		Name = "GBC-sRGB.png";
-		Data = ReshadeShadersLUTHandheldGBCSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBCSRGBTextureDefs::sData);
-	}
-};
+	Name = "GBC-sRGB.png";
+	Data = ReshadeShadersLUTHandheldGBCSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBCSRGBTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBMicro2020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -646,13 +654,10 @@ const BYTE sData[] =
 ,58,10,122,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef::ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef() : TextureDef{}
-	{
-		Name = "GBMicro-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBMicro2020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBMicro2020ColdTextureDefs::sData);
-	}
-};
+	Name = "GBMicro-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBMicro2020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBMicro2020ColdTextureDefs::sData);
+}
+#endif
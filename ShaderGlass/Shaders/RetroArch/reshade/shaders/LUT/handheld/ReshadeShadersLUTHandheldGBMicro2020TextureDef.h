@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBMicro2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBMicro2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBMicro2020TextureDefs
 {
 const BYTE sData[] =
@@ -641,13 +649,10 @@ const BYTE sData[] =
 ,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBMicro2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBMicro2020TextureDef::ReshadeShadersLUTHandheldGBMicro2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBMicro2020TextureDef() : TextureDef{}
-	{
-		Name = "GBMicro-2020.png";
-		Data = ReshadeShadersLUTHandheldGBMicro2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBMicro2020TextureDefs::sData);
-	}
-};
+	Name = "GBMicro-2020.png";
+	Data = ReshadeShadersLUTHandheldGBMicro2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBMicro2020TextureDefs::sData);
+}
+#endif
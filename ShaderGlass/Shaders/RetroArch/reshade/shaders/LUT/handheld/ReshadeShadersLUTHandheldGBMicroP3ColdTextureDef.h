@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBMicroP3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -662,13 +670,10 @@ const BYTE sData[] =
 ,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef::ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef() : TextureDef{}
-	{
-		Name = "GBMicro-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBMicroP3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroP3ColdTextureDefs::sData);
-	}
-};
+	Name = "GBMicro-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBMicroP3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroP3ColdTextureDefs::sData);
+}
+#endif
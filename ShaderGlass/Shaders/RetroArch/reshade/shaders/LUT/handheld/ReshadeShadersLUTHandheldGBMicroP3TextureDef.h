@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBMicroP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBMicroP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBMicroP3TextureDefs
 {
 const BYTE sData[] =
@@ -644,13 +652,10 @@ const BYTE sData[] =
 ,232,176,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBMicroP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBMicroP3TextureDef::ReshadeShadersLUTHandheldGBMicroP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBMicroP3TextureDef() : TextureDef{}
-	{
-		Name = "GBMicro-P3.png";
-		Data = ReshadeShadersLUTHandheldGBMicroP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroP3TextureDefs::sData);
-	}
-};
+	Name = "GBMicro-P3.png";
+	Data = ReshadeShadersLUTHandheldGBMicroP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroP3TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -656,13 +664,10 @@ const BYTE sData[] =
 ,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef::ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "GBMicro-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDefs::sData);
-	}
-};
+	Name = "GBMicro-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldGBMicroSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldGBMicroSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldGBMicroSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -640,13 +648,10 @@ const BYTE sData[] =
 ,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldGBMicroSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldGBMicroSRGBTextureDef::ReshadeShadersLUTHandheldGBMicroSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldGBMicroSRGBTextureDef() : TextureDef{}
-	{
-		Name = "GBMicro-sRGB.png";
-		Data = ReshadeShadersLUTHandheldGBMicroSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroSRGBTextureDefs::sData);
-	}
-};
+	Name = "GBMicro-sRGB.png";
+	Data = ReshadeShadersLUTHandheldGBMicroSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldGBMicroSRGBTextureDefs::sData);
+}
+#endif
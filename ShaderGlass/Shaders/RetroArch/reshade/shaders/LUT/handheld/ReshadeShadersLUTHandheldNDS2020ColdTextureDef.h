@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNDS2020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNDS2020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNDS2020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -650,13 +658,10 @@ const BYTE sData[] =
 ,29,247,103,172,203,191,2,43,52,161,251,209,170,87,120,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNDS2020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldNDS2020ColdTextureDef::ReshadeShadersLUTHandheldNDS2020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNDS2020ColdTextureDef() : TextureDef{}
-	{
-		Name = "NDS-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldNDS2020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNDS2020ColdTextureDefs::sData);
-	}
-};
+	Name = "NDS-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldNDS2020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNDS2020ColdTextureDefs::sData);
+}
+#endif
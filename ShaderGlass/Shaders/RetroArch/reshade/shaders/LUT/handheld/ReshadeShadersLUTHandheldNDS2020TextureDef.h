@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNDS2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNDS2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNDS2020TextureDefs
 {
 const BYTE sData[] =
@@ -594,13 +602,10 @@ const BYTE sData[] =
 ,47,67,246,66,113,174,107,186,175,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNDS2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldNDS2020TextureDef::ReshadeShadersLUTHandheldNDS2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNDS2020TextureDef() : TextureDef{}
-	{
-		Name = "NDS-2020.png";
-		Data = ReshadeShadersLUTHandheldNDS2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNDS2020TextureDefs::sData);
-	}
-};
+	Name = "NDS-2020.png";
+	Data = ReshadeShadersLUTHandheldNDS2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNDS2020TextureDefs::sData);
+}
+#endif
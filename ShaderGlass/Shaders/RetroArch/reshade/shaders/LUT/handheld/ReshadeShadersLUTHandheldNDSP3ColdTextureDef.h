@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNDSP3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNDSP3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNDSP3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -663,13 +671,10 @@ const BYTE sData[] =
 ,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNDSP3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldNDSP3ColdTextureDef::ReshadeShadersLUTHandheldNDSP3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNDSP3ColdTextureDef() : TextureDef{}
-	{
-		Name = "NDS-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldNDSP3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNDSP3ColdTextureDefs::sData);
-	}
-};
+	Name = "NDS-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldNDSP3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNDSP3ColdTextureDefs::sData);
+}
+#endif
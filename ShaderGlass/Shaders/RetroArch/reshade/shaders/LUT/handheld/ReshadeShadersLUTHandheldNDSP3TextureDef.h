@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNDSP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNDSP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNDSP3TextureDefs
 {
 const BYTE sData[] =
@@ -610,13 +618,10 @@ const BYTE sData[] =
 ,232,183,116,206,250,53,63,255,31,108,106,58,180,94,62,42,125,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNDSP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldNDSP3TextureDef::ReshadeShadersLUTHandheldNDSP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNDSP3TextureDef() : TextureDef{}
-	{
-		Name = "NDS-P3.png";
-		Data = ReshadeShadersLUTHandheldNDSP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNDSP3TextureDefs::sData);
-	}
-};
+	Name = "NDS-P3.png";
+	Data = ReshadeShadersLUTHandheldNDSP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNDSP3TextureDefs::sData);
+}
+#endif
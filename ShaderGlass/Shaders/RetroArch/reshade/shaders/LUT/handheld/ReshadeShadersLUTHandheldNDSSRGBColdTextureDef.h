@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNDSSRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNDSSRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNDSSRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -662,13 +670,10 @@ const BYTE sData[] =
 ,180,169,10,146,8,16,56,12,247,36,168,234,226,251,31,182,251,243,18,164,226,156,59,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNDSSRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldNDSSRGBColdTextureDef::ReshadeShadersLUTHandheldNDSSRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNDSSRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "NDS-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldNDSSRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNDSSRGBColdTextureDefs::sData);
-	}
-};
+	Name = "NDS-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldNDSSRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNDSSRGBColdTextureDefs::sData);
+}
+#endif
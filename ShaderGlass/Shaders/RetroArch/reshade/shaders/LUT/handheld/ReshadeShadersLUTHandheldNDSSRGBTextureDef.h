@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNDSSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNDSSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNDSSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -598,13 +606,10 @@ const BYTE sData[] =
 ,167,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNDSSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldNDSSRGBTextureDef::ReshadeShadersLUTHandheldNDSSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNDSSRGBTextureDef() : TextureDef{}
-	{
-		Name = "NDS-sRGB.png";
-		Data = ReshadeShadersLUTHandheldNDSSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNDSSRGBTextureDefs::sData);
-	}
-};
+	Name = "NDS-sRGB.png";
+	Data = ReshadeShadersLUTHandheldNDSSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNDSSRGBTextureDefs::sData);
+}
+#endif
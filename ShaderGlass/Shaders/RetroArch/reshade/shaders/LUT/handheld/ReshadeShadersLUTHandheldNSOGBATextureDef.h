@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNSOGBATextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNSOGBATextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNSOGBATextureDefs
 {
 const BYTE sData[] =
@@ -516,13 +524,10 @@ const BYTE sData[] =
 };
 }
 
-class ReshadeShadersLUTHandheldNSOGBATextureDef : public TextureDef
+ReshadeShadersLUTHandheldNSOGBATextureDef::ReshadeShadersLUTHandheldNSOGBATextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNSOGBATextureDef() : TextureDef{}
-	{
-		Name = "NSO-GBA.png";
-		Data = ReshadeShadersLUTHandheldNSOGBATextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNSOGBATextureDefs::sData);
-	}
-};
+	Name = "NSO-GBA.png";
+	Data = ReshadeShadersLUTHandheldNSOGBATextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNSOGBATextureDefs::sData);
+}
+#endif
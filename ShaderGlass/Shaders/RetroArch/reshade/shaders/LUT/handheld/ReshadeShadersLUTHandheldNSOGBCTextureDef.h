@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldNSOGBCTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldNSOGBCTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldNSOGBCTextureDefs
 {
 const BYTE sData[] =
@@ -438,13 +446,10 @@ const BYTE sData[] =
 ,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldNSOGBCTextureDef : public TextureDef
+ReshadeShadersLUTHandheldNSOGBCTextureDef::ReshadeShadersLUTHandheldNSOGBCTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldNSOGBCTextureDef() : TextureDef{}
-	{
-		Name = "NSO-GBC.png";
-		Data = ReshadeShadersLUTHandheldNSOGBCTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldNSOGBCTextureDefs::sData);
-	}
-};
+	Name = "NSO-GBC.png";
+	Data = ReshadeShadersLUTHandheldNSOGBCTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldNSOGBCTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSP2020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSP2020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSP2020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -606,13 +614,10 @@ const BYTE sData[] =
 ,17,139,98,85,153,6,176,255,11,9,179,125,224,3,29,47,109,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSP2020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSP2020ColdTextureDef::ReshadeShadersLUTHandheldPSP2020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSP2020ColdTextureDef() : TextureDef{}
-	{
-		Name = "PSP-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldPSP2020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSP2020ColdTextureDefs::sData);
-	}
-};
+	Name = "PSP-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldPSP2020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSP2020ColdTextureDefs::sData);
+}
+#endif
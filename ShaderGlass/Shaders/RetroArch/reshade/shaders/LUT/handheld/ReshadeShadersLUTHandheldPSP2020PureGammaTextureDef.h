@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSP2020PureGammaTextureDefs
 {
 const BYTE sData[] =
@@ -560,13 +568,10 @@ const BYTE sData[] =
 ,20,37,205,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef::ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef() : TextureDef{}
-	{
-		Name = "PSP-2020(pure-gamma).png";
-		Data = ReshadeShadersLUTHandheldPSP2020PureGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSP2020PureGammaTextureDefs::sData);
-	}
-};
+	Name = "PSP-2020(pure-gamma).png";
+	Data = ReshadeShadersLUTHandheldPSP2020PureGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSP2020PureGammaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSP2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSP2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSP2020TextureDefs
 {
 const BYTE sData[] =
@@ -544,13 +552,10 @@ const BYTE sData[] =
 ,87,202,156,56,198,255,2,202,45,21,126,189,92,163,27,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSP2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSP2020TextureDef::ReshadeShadersLUTHandheldPSP2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSP2020TextureDef() : TextureDef{}
-	{
-		Name = "PSP-2020.png";
-		Data = ReshadeShadersLUTHandheldPSP2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSP2020TextureDefs::sData);
-	}
-};
+	Name = "PSP-2020.png";
+	Data = ReshadeShadersLUTHandheldPSP2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSP2020TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSPP3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSPP3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSPP3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -623,13 +631,10 @@ const BYTE sData[] =
 ,49,84,241,245,255,3,164,17,38,10,26,86,135,118,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSPP3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSPP3ColdTextureDef::ReshadeShadersLUTHandheldPSPP3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSPP3ColdTextureDef() : TextureDef{}
-	{
-		Name = "PSP-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldPSPP3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSPP3ColdTextureDefs::sData);
-	}
-};
+	Name = "PSP-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldPSPP3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSPP3ColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSPP3PureGammaTextureDefs
 {
 const BYTE sData[] =
@@ -567,13 +575,10 @@ const BYTE sData[] =
 ,50,107,139,233,201,145,255,7,145,73,173,227,80,159,235,55,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef::ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef() : TextureDef{}
-	{
-		Name = "PSP-P3(pure-gamma).png";
-		Data = ReshadeShadersLUTHandheldPSPP3PureGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSPP3PureGammaTextureDefs::sData);
-	}
-};
+	Name = "PSP-P3(pure-gamma).png";
+	Data = ReshadeShadersLUTHandheldPSPP3PureGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSPP3PureGammaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSPP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSPP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSPP3TextureDefs
 {
 const BYTE sData[] =
@@ -575,13 +583,10 @@ const BYTE sData[] =
 ,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSPP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSPP3TextureDef::ReshadeShadersLUTHandheldPSPP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSPP3TextureDef() : TextureDef{}
-	{
-		Name = "PSP-P3.png";
-		Data = ReshadeShadersLUTHandheldPSPP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSPP3TextureDefs::sData);
-	}
-};
+	Name = "PSP-P3.png";
+	Data = ReshadeShadersLUTHandheldPSPP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSPP3TextureDefs::sData);
+}
+#endif
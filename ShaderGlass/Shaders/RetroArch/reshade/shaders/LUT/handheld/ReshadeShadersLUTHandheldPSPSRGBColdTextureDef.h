@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSPSRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSPSRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSPSRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -556,13 +564,10 @@ const BYTE sData[] =
 ,81,72,155,99,21,31,73,67,133,209,204,234,189,232,255,2,9,149,131,226,38,21,217,206,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSPSRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSPSRGBColdTextureDef::ReshadeShadersLUTHandheldPSPSRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSPSRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "PSP-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldPSPSRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSPSRGBColdTextureDefs::sData);
-	}
-};
+	Name = "PSP-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldPSPSRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSPSRGBColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDefs
 {
 const BYTE sData[] =
@@ -535,13 +543,10 @@ const BYTE sData[] =
 ,133,128,64,52,97,220,133,55,84,122,54,80,237,57,175,191,251,255,1,128,208,93,50,27,93,73,25,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef::ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef() : TextureDef{}
-	{
-		Name = "PSP-sRGB(pure-gamma).png";
-		Data = ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDefs::sData);
-	}
-};
+	Name = "PSP-sRGB(pure-gamma).png";
+	Data = ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDefs::sData);
+}
+#endif
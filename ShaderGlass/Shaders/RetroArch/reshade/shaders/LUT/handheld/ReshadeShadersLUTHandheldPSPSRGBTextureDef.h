@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldPSPSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldPSPSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldPSPSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -514,13 +522,10 @@ const BYTE sData[] =
 ,154,123,24,222,157,62,115,221,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldPSPSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldPSPSRGBTextureDef::ReshadeShadersLUTHandheldPSPSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldPSPSRGBTextureDef() : TextureDef{}
-	{
-		Name = "PSP-sRGB.png";
-		Data = ReshadeShadersLUTHandheldPSPSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldPSPSRGBTextureDefs::sData);
-	}
-};
+	Name = "PSP-sRGB.png";
+	Data = ReshadeShadersLUTHandheldPSPSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldPSPSRGBTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSP1012020ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSP1012020ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSP1012020ColdTextureDefs
 {
 const BYTE sData[] =
@@ -584,13 +592,10 @@ const BYTE sData[] =
 ,193,140,223,249,255,61,70,178,26,232,99,239,84,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSP1012020ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSP1012020ColdTextureDef::ReshadeShadersLUTHandheldSP1012020ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSP1012020ColdTextureDef() : TextureDef{}
-	{
-		Name = "SP101-2020-Cold.png";
-		Data = ReshadeShadersLUTHandheldSP1012020ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSP1012020ColdTextureDefs::sData);
-	}
-};
+	Name = "SP101-2020-Cold.png";
+	Data = ReshadeShadersLUTHandheldSP1012020ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSP1012020ColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSP1012020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSP1012020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSP1012020TextureDefs
 {
 const BYTE sData[] =
@@ -564,13 +572,10 @@ const BYTE sData[] =
 ,128,63,3,187,178,140,235,116,72,179,255,7,202,143,35,195,124,163,125,162,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSP1012020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldSP1012020TextureDef::ReshadeShadersLUTHandheldSP1012020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSP1012020TextureDef() : TextureDef{}
-	{
-		Name = "SP101-2020.png";
-		Data = ReshadeShadersLUTHandheldSP1012020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSP1012020TextureDefs::sData);
-	}
-};
+	Name = "SP101-2020.png";
+	Data = ReshadeShadersLUTHandheldSP1012020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSP1012020TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSP101P3ColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSP101P3ColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSP101P3ColdTextureDefs
 {
 const BYTE sData[] =
@@ -583,13 +591,10 @@ const BYTE sData[] =
 ,254,9,175,35,3,79,26,64,187,199,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSP101P3ColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSP101P3ColdTextureDef::ReshadeShadersLUTHandheldSP101P3ColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSP101P3ColdTextureDef() : TextureDef{}
-	{
-		Name = "SP101-P3-Cold.png";
-		Data = ReshadeShadersLUTHandheldSP101P3ColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSP101P3ColdTextureDefs::sData);
-	}
-};
+	Name = "SP101-P3-Cold.png";
+	Data = ReshadeShadersLUTHandheldSP101P3ColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSP101P3ColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSP101P3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSP101P3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSP101P3TextureDefs
 {
 const BYTE sData[] =
@@ -563,13 +571,10 @@ const BYTE sData[] =
 ,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSP101P3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldSP101P3TextureDef::ReshadeShadersLUTHandheldSP101P3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSP101P3TextureDef() : TextureDef{}
-	{
-		Name = "SP101-P3.png";
-		Data = ReshadeShadersLUTHandheldSP101P3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSP101P3TextureDefs::sData);
-	}
-};
+	Name = "SP101-P3.png";
+	Data = ReshadeShadersLUTHandheldSP101P3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSP101P3TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSP101SRGBColdTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSP101SRGBColdTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSP101SRGBColdTextureDefs
 {
 const BYTE sData[] =
@@ -522,13 +530,10 @@ const BYTE sData[] =
 ,37,27,128,149,146,47,225,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSP101SRGBColdTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSP101SRGBColdTextureDef::ReshadeShadersLUTHandheldSP101SRGBColdTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSP101SRGBColdTextureDef() : TextureDef{}
-	{
-		Name = "SP101-sRGB-Cold.png";
-		Data = ReshadeShadersLUTHandheldSP101SRGBColdTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSP101SRGBColdTextureDefs::sData);
-	}
-};
+	Name = "SP101-sRGB-Cold.png";
+	Data = ReshadeShadersLUTHandheldSP101SRGBColdTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSP101SRGBColdTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSP101SRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSP101SRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSP101SRGBTextureDefs
 {
 const BYTE sData[] =
@@ -491,13 +499,10 @@ const BYTE sData[] =
 ,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSP101SRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSP101SRGBTextureDef::ReshadeShadersLUTHandheldSP101SRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSP101SRGBTextureDef() : TextureDef{}
-	{
-		Name = "SP101-sRGB.png";
-		Data = ReshadeShadersLUTHandheldSP101SRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSP101SRGBTextureDefs::sData);
-	}
-};
+	Name = "SP101-sRGB.png";
+	Data = ReshadeShadersLUTHandheldSP101SRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSP101SRGBTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLED2020GammaTextureDefs
 {
 const BYTE sData[] =
@@ -393,13 +401,10 @@ const BYTE sData[] =
 ,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef::ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-2020-Gamma.png";
-		Data = ReshadeShadersLUTHandheldSWOLED2020GammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLED2020GammaTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-2020-Gamma.png";
+	Data = ReshadeShadersLUTHandheldSWOLED2020GammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLED2020GammaTextureDefs::sData);
+}
+#endif
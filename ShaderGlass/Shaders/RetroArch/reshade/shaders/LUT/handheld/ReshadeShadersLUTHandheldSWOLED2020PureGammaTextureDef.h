@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDefs
 {
 const BYTE sData[] =
@@ -387,13 +395,10 @@ const BYTE sData[] =
 ,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef::ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-2020(pure-gamma).png";
-		Data = ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-2020(pure-gamma).png";
+	Data = ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLED2020TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLED2020TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLED2020TextureDefs
 {
 const BYTE sData[] =
@@ -389,13 +397,10 @@ const BYTE sData[] =
 ,75,18,108,81,35,165,71,208,255,3,75,252,12,114,34,231,210,75,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLED2020TextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLED2020TextureDef::ReshadeShadersLUTHandheldSWOLED2020TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLED2020TextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-2020.png";
-		Data = ReshadeShadersLUTHandheldSWOLED2020TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLED2020TextureDefs::sData);
-	}
-};
+	Name = "SWOLED-2020.png";
+	Data = ReshadeShadersLUTHandheldSWOLED2020TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLED2020TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDefs
 {
 const BYTE sData[] =
@@ -370,13 +378,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef::ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-P3-Gamma.png";
-		Data = ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-P3-Gamma.png";
+	Data = ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDefs::sData);
+}
+#endif
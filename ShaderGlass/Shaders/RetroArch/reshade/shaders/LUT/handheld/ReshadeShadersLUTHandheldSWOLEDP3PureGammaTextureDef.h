@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDefs
 {
 const BYTE sData[] =
@@ -358,13 +366,10 @@ const BYTE sData[] =
 ,112,49,216,162,52,106,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef::ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-P3(pure-gamma).png";
-		Data = ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-P3(pure-gamma).png";
+	Data = ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLEDP3TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLEDP3TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLEDP3TextureDefs
 {
 const BYTE sData[] =
@@ -371,13 +379,10 @@ const BYTE sData[] =
 ,187,209,41,88,235,45,226,173,117,196,15,250,138,136,254,23,109,125,45,192,114,227,237,3,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLEDP3TextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLEDP3TextureDef::ReshadeShadersLUTHandheldSWOLEDP3TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLEDP3TextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-P3.png";
-		Data = ReshadeShadersLUTHandheldSWOLEDP3TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDP3TextureDefs::sData);
-	}
-};
+	Name = "SWOLED-P3.png";
+	Data = ReshadeShadersLUTHandheldSWOLEDP3TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDP3TextureDefs::sData);
+}
+#endif
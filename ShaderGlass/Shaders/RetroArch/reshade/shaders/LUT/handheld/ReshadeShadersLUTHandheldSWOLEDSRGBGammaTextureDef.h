@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDefs
 {
 const BYTE sData[] =
@@ -565,13 +573,10 @@ const BYTE sData[] =
 ,86,88,229,62,234,235,63,92,251,195,245,228,5,10,4,224,255,3,93,69,114,205,55,38,22,40,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef::ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-sRGB-Gamma.png";
-		Data = ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-sRGB-Gamma.png";
+	Data = ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDefs::sData);
+}
+#endif
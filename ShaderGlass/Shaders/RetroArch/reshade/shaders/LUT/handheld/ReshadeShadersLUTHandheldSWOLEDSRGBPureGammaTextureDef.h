@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDefs
 {
 const BYTE sData[] =
@@ -589,13 +597,10 @@ const BYTE sData[] =
 ,10,253,255,127,216,199,57,1,3,197,117,201,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef::ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-sRGB(pure-gamma).png";
-		Data = ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-sRGB(pure-gamma).png";
+	Data = ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldSWOLEDSRGBTextureDefs
 {
 const BYTE sData[] =
@@ -618,13 +626,10 @@ const BYTE sData[] =
 ,250,75,99,96,0,248,255,226,246,157,121,108,27,140,238,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef : public TextureDef
+ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef::ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef() : TextureDef{}
-	{
-		Name = "SWOLED-sRGB.png";
-		Data = ReshadeShadersLUTHandheldSWOLEDSRGBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDSRGBTextureDefs::sData);
-	}
-};
+	Name = "SWOLED-sRGB.png";
+	Data = ReshadeShadersLUTHandheldSWOLEDSRGBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldSWOLEDSRGBTextureDefs::sData);
+}
+#endif
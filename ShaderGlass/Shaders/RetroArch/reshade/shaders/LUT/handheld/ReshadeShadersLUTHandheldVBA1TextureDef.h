@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldVBA1TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldVBA1TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldVBA1TextureDefs
 {
 const BYTE sData[] =
@@ -587,13 +595,10 @@ const BYTE sData[] =
 ,59,33,186,125,16,195,204,254,63,24,152,61,74,253,59,38,191,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldVBA1TextureDef : public TextureDef
+ReshadeShadersLUTHandheldVBA1TextureDef::ReshadeShadersLUTHandheldVBA1TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldVBA1TextureDef() : TextureDef{}
-	{
-		Name = "VBA-1.png";
-		Data = ReshadeShadersLUTHandheldVBA1TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldVBA1TextureDefs::sData);
-	}
-};
+	Name = "VBA-1.png";
+	Data = ReshadeShadersLUTHandheldVBA1TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldVBA1TextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersLUTHandheldVBA2TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersLUTHandheldVBA2TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersLUTHandheldVBA2TextureDefs
 {
 const BYTE sData[] =
@@ -329,13 +337,10 @@ const BYTE sData[] =
 ,126,220,209,243,101,126,147,250,141,66,127,126,196,255,1,126,3,190,30,232,57,89,249,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersLUTHandheldVBA2TextureDef : public TextureDef
+ReshadeShadersLUTHandheldVBA2TextureDef::ReshadeShadersLUTHandheldVBA2TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersLUTHandheldVBA2TextureDef() : TextureDef{}
-	{
-		Name = "VBA-2.png";
-		Data = ReshadeShadersLUTHandheldVBA2TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersLUTHandheldVBA2TextureDefs::sData);
-	}
-};
+	Name = "VBA-2.png";
+	Data = ReshadeShadersLUTHandheldVBA2TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersLUTHandheldVBA2TextureDefs::sData);
+}
+#endif
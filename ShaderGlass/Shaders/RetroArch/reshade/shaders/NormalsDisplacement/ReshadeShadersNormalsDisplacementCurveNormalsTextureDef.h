@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersNormalsDisplacementCurveNormalsTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersNormalsDisplacementCurveNormalsTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersNormalsDisplacementCurveNormalsTextureDefs
 {
 const BYTE sData[] =
@@ -417,13 +425,10 @@ const BYTE sData[] =
 ,249,98,24,0,6,204,29,72,71,123,22,23,1,215,10,120,10,204,242,93,175,251,240,231,11,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersNormalsDisplacementCurveNormalsTextureDef : public TextureDef
+ReshadeShadersNormalsDisplacementCurveNormalsTextureDef::ReshadeShadersNormalsDisplacementCurveNormalsTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersNormalsDisplacementCurveNormalsTextureDef() : TextureDef{}
-	{
-		Name = "CurveNormals.png";
-		Data = ReshadeShadersNormalsDisplacementCurveNormalsTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersNormalsDisplacementCurveNormalsTextureDefs::sData);
-	}
-};
+	Name = "CurveNormals.png";
+	Data = ReshadeShadersNormalsDisplacementCurveNormalsTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersNormalsDisplacementCurveNormalsTextureDefs::sData);
+}
+#endif
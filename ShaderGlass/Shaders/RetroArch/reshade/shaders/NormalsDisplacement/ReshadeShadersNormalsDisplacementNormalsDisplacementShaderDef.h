@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -434,33 +445,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef : public ShaderDef
+RetroArch::ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef::ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef() : ShaderDef{}
-	{
-		Name = "NormalsDisplacement";
-		VertexByteCode = RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("Displacement", -1, 52, 4, 0.000000f, 60.000000f, 20.000000f, 1.000000f, "Displacement Factor"));
-		Samplers.push_back(ShaderSampler("displacementMap", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "NormalsDisplacement";
+	VertexByteCode = RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersNormalsDisplacementNormalsDisplacementShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("Displacement", -1, 52, 4, 0.000000f, 60.000000f, 20.000000f, 1.000000f, "Displacement Factor"));
+	Samplers.push_back(ShaderSampler("displacementMap", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersBloomPassSh1nra358ShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersBloomPassSh1nra358ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -395,32 +406,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersBloomPassSh1nra358ShaderDef : public ShaderDef
+RetroArch::ReshadeShadersBloomPassSh1nra358ShaderDef::ReshadeShadersBloomPassSh1nra358ShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersBloomPassSh1nra358ShaderDef() : ShaderDef{}
-	{
-		Name = "bloom-pass-sh1nra358";
-		VertexByteCode = RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("BloomIntensity", -1, 52, 4, 1.000000f, 4.000000f, 3.000000f, 0.100000f, "BloomIntensity"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "bloom-pass-sh1nra358";
+	VertexByteCode = RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersBloomPassSh1nra358ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("BloomIntensity", -1, 52, 4, 1.000000f, 4.000000f, 3.000000f, 0.100000f, "BloomIntensity"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
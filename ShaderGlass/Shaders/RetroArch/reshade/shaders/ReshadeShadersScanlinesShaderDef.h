@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersScanlinesShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersScanlinesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersScanlinesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -447,32 +458,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersScanlinesShaderDef : public ShaderDef
+RetroArch::ReshadeShadersScanlinesShaderDef::ReshadeShadersScanlinesShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersScanlinesShaderDef() : ShaderDef{}
-	{
-		Name = "scanlines";
-		VertexByteCode = RetroArchReshadeShadersScanlinesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersScanlinesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersScanlinesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersScanlinesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("opacity", -1, 52, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "Scanlines dark"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scanlines";
+	VertexByteCode = RetroArchReshadeShadersScanlinesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersScanlinesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersScanlinesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersScanlinesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("opacity", -1, 52, 4, 0.000000f, 100.000000f, 50.000000f, 1.000000f, "Scanlines dark"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersVibrancePassSh1nra358ShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersVibrancePassSh1nra358ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -336,31 +347,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersVibrancePassSh1nra358ShaderDef : public ShaderDef
+RetroArch::ReshadeShadersVibrancePassSh1nra358ShaderDef::ReshadeShadersVibrancePassSh1nra358ShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersVibrancePassSh1nra358ShaderDef() : ShaderDef{}
-	{
-		Name = "vibrance-pass-sh1nra358";
-		VertexByteCode = RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "vibrance-pass-sh1nra358";
+	VertexByteCode = RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersVibrancePassSh1nra358ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
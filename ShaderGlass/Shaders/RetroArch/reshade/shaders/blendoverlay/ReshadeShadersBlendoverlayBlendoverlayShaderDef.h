@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersBlendoverlayBlendoverlayShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersBlendoverlayBlendoverlayShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -503,35 +514,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersBlendoverlayBlendoverlayShaderDef : public ShaderDef
+RetroArch::ReshadeShadersBlendoverlayBlendoverlayShaderDef::ReshadeShadersBlendoverlayBlendoverlayShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersBlendoverlayBlendoverlayShaderDef() : ShaderDef{}
-	{
-		Name = "blendoverlay";
-		VertexByteCode = RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OverlayMix", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Overlay Mix"));
-		Params.push_back(ShaderParam("LUTWidth", -1, 56, 4, 1.000000f, 1920.000000f, 6.000000f, 1.000000f, "LUT Width"));
-		Params.push_back(ShaderParam("LUTHeight", -1, 60, 4, 1.000000f, 1920.000000f, 4.000000f, 1.000000f, "LUT Height"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("overlay", 3));
+	Name = "blendoverlay";
+	VertexByteCode = RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersBlendoverlayBlendoverlayShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OverlayMix", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Overlay Mix"));
+	Params.push_back(ShaderParam("LUTWidth", -1, 56, 4, 1.000000f, 1920.000000f, 6.000000f, 1.000000f, "LUT Width"));
+	Params.push_back(ShaderParam("LUTHeight", -1, 60, 4, 1.000000f, 1920.000000f, 4.000000f, 1.000000f, "LUT Height"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("overlay", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
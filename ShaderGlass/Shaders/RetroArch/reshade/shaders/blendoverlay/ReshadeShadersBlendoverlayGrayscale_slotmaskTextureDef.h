@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,96,130};
 }
 
-class ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef : public TextureDef
+ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef::ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef() : TextureDef{}
-	{
-		Name = "grayscale_slotmask.png";
-		Data = ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDefs::sData);
-	}
-};
+	Name = "grayscale_slotmask.png";
+	Data = ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersBlendoverlayShadowmask4x4TextureDef : public TextureDef
+{
+public:
+	ReshadeShadersBlendoverlayShadowmask4x4TextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersBlendoverlayShadowmask4x4TextureDefs
 {
 const BYTE sData[] =
@@ -15,13 +23,10 @@ const BYTE sData[] =
 ,78,68,174,66,96,130};
 }
 
-class ReshadeShadersBlendoverlayShadowmask4x4TextureDef : public TextureDef
+ReshadeShadersBlendoverlayShadowmask4x4TextureDef::ReshadeShadersBlendoverlayShadowmask4x4TextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersBlendoverlayShadowmask4x4TextureDef() : TextureDef{}
-	{
-		Name = "shadowmask-4x4.png";
-		Data = ReshadeShadersBlendoverlayShadowmask4x4TextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersBlendoverlayShadowmask4x4TextureDefs::sData);
-	}
-};
+	Name = "shadowmask-4x4.png";
+	Data = ReshadeShadersBlendoverlayShadowmask4x4TextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersBlendoverlayShadowmask4x4TextureDefs::sData);
+}
+#endif
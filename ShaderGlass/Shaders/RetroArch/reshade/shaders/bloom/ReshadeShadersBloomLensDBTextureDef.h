@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersBloomLensDBTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersBloomLensDBTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersBloomLensDBTextureDefs
 {
 const BYTE sData[] =
@@ -6675,13 +6683,10 @@ const BYTE sData[] =
 ,1,32,204,201,177,78,0,255,3,102,101,141,108,68,140,151,77,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersBloomLensDBTextureDef : public TextureDef
+ReshadeShadersBloomLensDBTextureDef::ReshadeShadersBloomLensDBTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersBloomLensDBTextureDef() : TextureDef{}
-	{
-		Name = "LensDB.png";
-		Data = ReshadeShadersBloomLensDBTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersBloomLensDBTextureDefs::sData);
-	}
-};
+	Name = "LensDB.png";
+	Data = ReshadeShadersBloomLensDBTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersBloomLensDBTextureDefs::sData);
+}
+#endif
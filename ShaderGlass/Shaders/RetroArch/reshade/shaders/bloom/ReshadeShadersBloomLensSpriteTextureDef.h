@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersBloomLensSpriteTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersBloomLensSpriteTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersBloomLensSpriteTextureDefs
 {
 const BYTE sData[] =
@@ -15291,13 +15299,10 @@ const BYTE sData[] =
 ,253,253,203,2,251,169,127,35,194,255,119,37,224,255,11,248,70,130,197,73,244,166,71,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersBloomLensSpriteTextureDef : public TextureDef
+ReshadeShadersBloomLensSpriteTextureDef::ReshadeShadersBloomLensSpriteTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersBloomLensSpriteTextureDef() : TextureDef{}
-	{
-		Name = "LensSprite.png";
-		Data = ReshadeShadersBloomLensSpriteTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersBloomLensSpriteTextureDefs::sData);
-	}
-};
+	Name = "LensSprite.png";
+	Data = ReshadeShadersBloomLensSpriteTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersBloomLensSpriteTextureDefs::sData);
+}
+#endif
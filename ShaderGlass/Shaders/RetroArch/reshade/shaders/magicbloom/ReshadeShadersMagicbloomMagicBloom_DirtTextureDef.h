@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class ReshadeShadersMagicbloomMagicBloom_DirtTextureDef : public TextureDef
+{
+public:
+	ReshadeShadersMagicbloomMagicBloom_DirtTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace ReshadeShadersMagicbloomMagicBloom_DirtTextureDefs
 {
 const BYTE sData[] =
@@ -14978,13 +14986,10 @@ const BYTE sData[] =
 ,122,248,255,1,220,85,85,186,141,43,176,153,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class ReshadeShadersMagicbloomMagicBloom_DirtTextureDef : public TextureDef
+ReshadeShadersMagicbloomMagicBloom_DirtTextureDef::ReshadeShadersMagicbloomMagicBloom_DirtTextureDef() : TextureDef{}
 {
-public:
-	ReshadeShadersMagicbloomMagicBloom_DirtTextureDef() : TextureDef{}
-	{
-		Name = "MagicBloom_Dirt.png";
-		Data = ReshadeShadersMagicbloomMagicBloom_DirtTextureDefs::sData;
-		DataLength = sizeof(ReshadeShadersMagicbloomMagicBloom_DirtTextureDefs::sData);
-	}
-};
+	Name = "MagicBloom_Dirt.png";
+	Data = ReshadeShadersMagicbloomMagicBloom_DirtTextureDefs::sData;
+	DataLength = sizeof(ReshadeShadersMagicbloomMagicBloom_DirtTextureDefs::sData);
+}
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersMagicbloomMagicbloom_blendShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersMagicbloomMagicbloom_blendShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -903,46 +914,40 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersMagicbloomMagicbloom_blendShaderDef : public ShaderDef
+RetroArch::ReshadeShadersMagicbloomMagicbloom_blendShaderDef::ReshadeShadersMagicbloomMagicbloom_blendShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersMagicbloomMagicbloom_blendShaderDef() : ShaderDef{}
-	{
-		Name = "magicbloom_blend";
-		VertexByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ApplyBloom", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Bloom"));
-		Params.push_back(ShaderParam("fExposure", -1, 56, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Exposure"));
-		Params.push_back(ShaderParam("iDebug", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Debug: Show Bloom Contribution"));
-		Params.push_back(ShaderParam("fDirt_Intensity", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Dirt Intensity"));
-		Samplers.push_back(ShaderSampler("PreBloomPass", 3));
-		Samplers.push_back(ShaderSampler("tMagicBloom_1", 4));
-		Samplers.push_back(ShaderSampler("tMagicBloom_2", 5));
-		Samplers.push_back(ShaderSampler("tMagicBloom_3", 6));
-		Samplers.push_back(ShaderSampler("tMagicBloom_4", 7));
-		Samplers.push_back(ShaderSampler("tMagicBloom_5", 8));
-		Samplers.push_back(ShaderSampler("tMagicBloom_6", 9));
-		Samplers.push_back(ShaderSampler("tMagicBloom_7", 10));
-		Samplers.push_back(ShaderSampler("tMagicBloom_8", 11));
-		Samplers.push_back(ShaderSampler("tMagicBloom_Adapt", 12));
-		Samplers.push_back(ShaderSampler("tMagicBloom_Dirt", 13));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "magicbloom_blend";
+	VertexByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blendShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ApplyBloom", -1, 52, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Bloom"));
+	Params.push_back(ShaderParam("fExposure", -1, 56, 4, 0.000000f, 1.000000f, 0.200000f, 0.010000f, "Exposure"));
+	Params.push_back(ShaderParam("iDebug", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Debug: Show Bloom Contribution"));
+	Params.push_back(ShaderParam("fDirt_Intensity", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Dirt Intensity"));
+	Samplers.push_back(ShaderSampler("PreBloomPass", 3));
+	Samplers.push_back(ShaderSampler("tMagicBloom_1", 4));
+	Samplers.push_back(ShaderSampler("tMagicBloom_2", 5));
+	Samplers.push_back(ShaderSampler("tMagicBloom_3", 6));
+	Samplers.push_back(ShaderSampler("tMagicBloom_4", 7));
+	Samplers.push_back(ShaderSampler("tMagicBloom_5", 8));
+	Samplers.push_back(ShaderSampler("tMagicBloom_6", 9));
+	Samplers.push_back(ShaderSampler("tMagicBloom_7", 10));
+	Samplers.push_back(ShaderSampler("tMagicBloom_8", 11));
+	Samplers.push_back(ShaderSampler("tMagicBloom_Adapt", 12));
+	Samplers.push_back(ShaderSampler("tMagicBloom_Dirt", 13));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
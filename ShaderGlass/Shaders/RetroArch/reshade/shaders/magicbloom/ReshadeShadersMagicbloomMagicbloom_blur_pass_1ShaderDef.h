@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -552,34 +563,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef : public ShaderDef
+RetroArch::ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef::ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef() : ShaderDef{}
-	{
-		Name = "magicbloom_blur_pass_1";
-		VertexByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sFragmentByteCode);
-		Format = "R16G16B16A16_SFLOAT";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("fBloom_Intensity", -1, 52, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Bloom Intensity"));
-		Params.push_back(ShaderParam("fBloom_Threshold", -1, 56, 4, 1.000000f, 10.000000f, 2.000000f, 0.100000f, "Bloom Threshold"));
-		Params.push_back(ShaderParam("ApplyBloom", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Bloom"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "magicbloom_blur_pass_1";
+	VertexByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDefs::sFragmentByteCode);
+	Format = "R16G16B16A16_SFLOAT";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("fBloom_Intensity", -1, 52, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Bloom Intensity"));
+	Params.push_back(ShaderParam("fBloom_Threshold", -1, 56, 4, 1.000000f, 10.000000f, 2.000000f, 0.100000f, "Bloom Threshold"));
+	Params.push_back(ShaderParam("ApplyBloom", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Bloom"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -17,6 +17,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef : public ShaderDef
+{
+public:
+	ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -513,38 +524,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef : public ShaderDef
+RetroArch::ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef::ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef() : ShaderDef{}
 {
-public:
-	ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef() : ShaderDef{}
-	{
-		Name = "magicbloom_get_adapt";
-		VertexByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sFragmentByteCode);
-		Format = "R32G32B32A32_SFLOAT";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("fAdapt_Speed", -1, 52, 4, 0.001000f, 1.000000f, 1.000000f, 0.010000f, "Adaptation Speed"));
-		Params.push_back(ShaderParam("fAdapt_Sensitivity", -1, 56, 4, 0.000000f, 3.000000f, 1.000000f, 0.010000f, "Adaptation Sensitivity"));
-		Params.push_back(ShaderParam("f2Adapt_Clip_Min", -1, 60, 4, 0.000000f, 3.000000f, 0.000000f, 0.010000f, "Adaptation Min"));
-		Params.push_back(ShaderParam("f2Adapt_Clip_Max", -1, 64, 4, 0.000000f, 3.000000f, 1.000000f, 0.010000f, "Adaptation Max"));
-		Params.push_back(ShaderParam("ApplyBloom", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Bloom"));
-		Samplers.push_back(ShaderSampler("tMagicBloom_Small", 3));
-		Samplers.push_back(ShaderSampler("tMagicBloom_AdaptFeedback", 4));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "magicbloom_get_adapt";
+	VertexByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchReshadeShadersMagicbloomMagicbloom_get_adaptShaderDefs::sFragmentByteCode);
+	Format = "R32G32B32A32_SFLOAT";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("fAdapt_Speed", -1, 52, 4, 0.001000f, 1.000000f, 1.000000f, 0.010000f, "Adaptation Speed"));
+	Params.push_back(ShaderParam("fAdapt_Sensitivity", -1, 56, 4, 0.000000f, 3.000000f, 1.000000f, 0.010000f, "Adaptation Sensitivity"));
+	Params.push_back(ShaderParam("f2Adapt_Clip_Min", -1, 60, 4, 0.000000f, 3.000000f, 0.000000f, 0.010000f, "Adaptation Min"));
+	Params.push_back(ShaderParam("f2Adapt_Clip_Max", -1, 64, 4, 0.000000f, 3.000000f, 1.000000f, 0.010000f, "Adaptation Max"));
+	Params.push_back(ShaderParam("ApplyBloom", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Apply Bloom"));
+	Samplers.push_back(ShaderSampler("tMagicBloom_Small", 3));
+	Samplers.push_back(ShaderSampler("tMagicBloom_AdaptFeedback", 4));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
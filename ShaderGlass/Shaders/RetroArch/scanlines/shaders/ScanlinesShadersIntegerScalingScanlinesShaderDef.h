@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ScanlinesShadersIntegerScalingScanlinesShaderDef : public ShaderDef
+{
+public:
+	ScanlinesShadersIntegerScalingScanlinesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -614,34 +625,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ScanlinesShadersIntegerScalingScanlinesShaderDef : public ShaderDef
+RetroArch::ScanlinesShadersIntegerScalingScanlinesShaderDef::ScanlinesShadersIntegerScalingScanlinesShaderDef() : ShaderDef{}
 {
-public:
-	ScanlinesShadersIntegerScalingScanlinesShaderDef() : ShaderDef{}
-	{
-		Name = "integer-scaling-scanlines";
-		VertexByteCode = RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ScanlineWidth", -1, 52, 4, 0.000000f, 20.000000f, 4.000000f, 1.000000f, "Scanline Width"));
-		Params.push_back(ShaderParam("ScreenWidth", -1, 56, 4, 0.000000f, 7680.000000f, 3840.000000f, 1.000000f, "Screen Width"));
-		Params.push_back(ShaderParam("ScreenHeight", -1, 60, 4, 0.000000f, 4320.000000f, 2160.000000f, 1.000000f, "Screen Height"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "integer-scaling-scanlines";
+	VertexByteCode = RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchScanlinesShadersIntegerScalingScanlinesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ScanlineWidth", -1, 52, 4, 0.000000f, 20.000000f, 4.000000f, 1.000000f, "Scanline Width"));
+	Params.push_back(ShaderParam("ScreenWidth", -1, 56, 4, 0.000000f, 7680.000000f, 3840.000000f, 1.000000f, "Screen Width"));
+	Params.push_back(ShaderParam("ScreenHeight", -1, 60, 4, 0.000000f, 4320.000000f, 2160.000000f, 1.000000f, "Screen Height"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
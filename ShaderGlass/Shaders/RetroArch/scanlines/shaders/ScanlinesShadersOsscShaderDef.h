@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ScanlinesShadersOsscShaderDef : public ShaderDef
+{
+public:
+	ScanlinesShadersOsscShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchScanlinesShadersOsscShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -820,42 +831,36 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ScanlinesShadersOsscShaderDef : public ShaderDef
+RetroArch::ScanlinesShadersOsscShaderDef::ScanlinesShadersOsscShaderDef() : ShaderDef{}
 {
-public:
-	ScanlinesShadersOsscShaderDef() : ShaderDef{}
-	{
-		Name = "ossc";
-		VertexByteCode = RetroArchScanlinesShadersOsscShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchScanlinesShadersOsscShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchScanlinesShadersOsscShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchScanlinesShadersOsscShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OVERSCAN", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Overscan"));
-		Params.push_back(ShaderParam("ASPECTx", -1, 56, 4, 1.000000f, 32.000000f, 4.000000f, 1.000000f, "Aspect Ratio X"));
-		Params.push_back(ShaderParam("ASPECTy", -1, 60, 4, 1.000000f, 32.000000f, 3.000000f, 1.000000f, "Aspect Ratio Y"));
-		Params.push_back(ShaderParam("LINES", -1, 64, 4, 2.000000f, 5.000000f, 4.000000f, 1.000000f, "Lines"));
-		Params.push_back(ShaderParam("L1", -1, 68, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Line 1 Scanline Strength %"));
-		Params.push_back(ShaderParam("L2", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Line 2 Scanline Strength %"));
-		Params.push_back(ShaderParam("L3", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Line 3 Scanline Strength %"));
-		Params.push_back(ShaderParam("L4", -1, 80, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Line 4 Scanline Strength %"));
-		Params.push_back(ShaderParam("L5", -1, 84, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Line 5 Scanline Strength %"));
-		Params.push_back(ShaderParam("TATE", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "TATE mode"));
-		Params.push_back(ShaderParam("HYBRID", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Scanline Hybrid Blend % (depend on pixel overlayed)"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "ossc";
+	VertexByteCode = RetroArchScanlinesShadersOsscShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchScanlinesShadersOsscShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchScanlinesShadersOsscShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchScanlinesShadersOsscShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OVERSCAN", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Overscan"));
+	Params.push_back(ShaderParam("ASPECTx", -1, 56, 4, 1.000000f, 32.000000f, 4.000000f, 1.000000f, "Aspect Ratio X"));
+	Params.push_back(ShaderParam("ASPECTy", -1, 60, 4, 1.000000f, 32.000000f, 3.000000f, 1.000000f, "Aspect Ratio Y"));
+	Params.push_back(ShaderParam("LINES", -1, 64, 4, 2.000000f, 5.000000f, 4.000000f, 1.000000f, "Lines"));
+	Params.push_back(ShaderParam("L1", -1, 68, 4, 0.000000f, 1.000000f, 0.250000f, 0.010000f, "Line 1 Scanline Strength %"));
+	Params.push_back(ShaderParam("L2", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Line 2 Scanline Strength %"));
+	Params.push_back(ShaderParam("L3", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Line 3 Scanline Strength %"));
+	Params.push_back(ShaderParam("L4", -1, 80, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Line 4 Scanline Strength %"));
+	Params.push_back(ShaderParam("L5", -1, 84, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Line 5 Scanline Strength %"));
+	Params.push_back(ShaderParam("TATE", -1, 88, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "TATE mode"));
+	Params.push_back(ShaderParam("HYBRID", -1, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Scanline Hybrid Blend % (depend on pixel overlayed)"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -71,6 +71,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ScanlinesShadersResIndependentScanlinesShaderDef : public ShaderDef
+{
+public:
+	ScanlinesShadersResIndependentScanlinesShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchScanlinesShadersResIndependentScanlinesShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3535,39 +3546,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ScanlinesShadersResIndependentScanlinesShaderDef : public ShaderDef
+RetroArch::ScanlinesShadersResIndependentScanlinesShaderDef::ScanlinesShadersResIndependentScanlinesShaderDef() : ShaderDef{}
 {
-public:
-	ScanlinesShadersResIndependentScanlinesShaderDef() : ShaderDef{}
-	{
-		Name = "res-independent-scanlines";
-		VertexByteCode = RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("amp", -1, 52, 4, 0.000000f, 2.000000f, 1.250000f, 0.050000f, "Amplitude"));
-		Params.push_back(ShaderParam("phase", -1, 56, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Phase"));
-		Params.push_back(ShaderParam("lines_black", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Lines Blacks"));
-		Params.push_back(ShaderParam("lines_white", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Lines Whites"));
-		Params.push_back(ShaderParam("mask", -1, 68, 4, 0.000000f, 19.000000f, 0.000000f, 1.000000f, "Mask Layout"));
-		Params.push_back(ShaderParam("mask_weight", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Mask Weight"));
-		Params.push_back(ShaderParam("fauxRes", -1, 76, 4, 144.000000f, 288.000000f, 224.000000f, 1.000000f, "Simulated Image Height"));
-		Params.push_back(ShaderParam("autoscale", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Automatic Scale"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "res-independent-scanlines";
+	VertexByteCode = RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchScanlinesShadersResIndependentScanlinesShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("amp", -1, 52, 4, 0.000000f, 2.000000f, 1.250000f, 0.050000f, "Amplitude"));
+	Params.push_back(ShaderParam("phase", -1, 56, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Phase"));
+	Params.push_back(ShaderParam("lines_black", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Lines Blacks"));
+	Params.push_back(ShaderParam("lines_white", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Lines Whites"));
+	Params.push_back(ShaderParam("mask", -1, 68, 4, 0.000000f, 19.000000f, 0.000000f, 1.000000f, "Mask Layout"));
+	Params.push_back(ShaderParam("mask_weight", -1, 72, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Mask Weight"));
+	Params.push_back(ShaderParam("fauxRes", -1, 76, 4, 144.000000f, 288.000000f, 224.000000f, 1.000000f, "Simulated Image Height"));
+	Params.push_back(ShaderParam("autoscale", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Automatic Scale"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ScanlinesShadersScanlineFractShaderDef : public ShaderDef
+{
+public:
+	ScanlinesShadersScanlineFractShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchScanlinesShadersScanlineFractShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -488,34 +499,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ScanlinesShadersScanlineFractShaderDef : public ShaderDef
+RetroArch::ScanlinesShadersScanlineFractShaderDef::ScanlinesShadersScanlineFractShaderDef() : ShaderDef{}
 {
-public:
-	ScanlinesShadersScanlineFractShaderDef() : ShaderDef{}
-	{
-		Name = "scanline-fract";
-		VertexByteCode = RetroArchScanlinesShadersScanlineFractShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchScanlinesShadersScanlineFractShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchScanlinesShadersScanlineFractShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchScanlinesShadersScanlineFractShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("THICKNESS", -1, 52, 4, 1.000000f, 12.000000f, 2.000000f, 1.000000f, "Scanline Thickness"));
-		Params.push_back(ShaderParam("DARKNESS", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Scanline Darkness"));
-		Params.push_back(ShaderParam("BRIGHTBOOST", -1, 60, 4, 1.000000f, 1.200000f, 1.100000f, 0.100000f, "Scanline Boost Bright"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scanline-fract";
+	VertexByteCode = RetroArchScanlinesShadersScanlineFractShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchScanlinesShadersScanlineFractShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchScanlinesShadersScanlineFractShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchScanlinesShadersScanlineFractShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("THICKNESS", -1, 52, 4, 1.000000f, 12.000000f, 2.000000f, 1.000000f, "Scanline Thickness"));
+	Params.push_back(ShaderParam("DARKNESS", -1, 56, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Scanline Darkness"));
+	Params.push_back(ShaderParam("BRIGHTBOOST", -1, 60, 4, 1.000000f, 1.200000f, 1.100000f, 0.100000f, "Scanline Boost Bright"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ScanlinesShadersScanlineShaderDef : public ShaderDef
+{
+public:
+	ScanlinesShadersScanlineShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchScanlinesShadersScanlineShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -540,33 +551,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ScanlinesShadersScanlineShaderDef : public ShaderDef
+RetroArch::ScanlinesShadersScanlineShaderDef::ScanlinesShadersScanlineShaderDef() : ShaderDef{}
 {
-public:
-	ScanlinesShadersScanlineShaderDef() : ShaderDef{}
-	{
-		Name = "scanline";
-		VertexByteCode = RetroArchScanlinesShadersScanlineShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchScanlinesShadersScanlineShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchScanlinesShadersScanlineShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchScanlinesShadersScanlineShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", -1, 52, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Scanline Sine Comp A"));
-		Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.050000f, "Scanline Sine Comp B"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scanline";
+	VertexByteCode = RetroArchScanlinesShadersScanlineShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchScanlinesShadersScanlineShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchScanlinesShadersScanlineShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchScanlinesShadersScanlineShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_A", -1, 52, 4, 0.000000f, 0.100000f, 0.000000f, 0.010000f, "Scanline Sine Comp A"));
+	Params.push_back(ShaderParam("SCANLINE_SINE_COMP_B", -1, 56, 4, 0.000000f, 1.000000f, 0.150000f, 0.050000f, "Scanline Sine Comp B"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
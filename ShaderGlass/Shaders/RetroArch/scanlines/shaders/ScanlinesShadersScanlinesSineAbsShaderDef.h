@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class ScanlinesShadersScanlinesSineAbsShaderDef : public ShaderDef
+{
+public:
+	ScanlinesShadersScanlinesSineAbsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchScanlinesShadersScanlinesSineAbsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -558,35 +569,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class ScanlinesShadersScanlinesSineAbsShaderDef : public ShaderDef
+RetroArch::ScanlinesShadersScanlinesSineAbsShaderDef::ScanlinesShadersScanlinesSineAbsShaderDef() : ShaderDef{}
 {
-public:
-	ScanlinesShadersScanlinesSineAbsShaderDef() : ShaderDef{}
-	{
-		Name = "scanlines-sine-abs";
-		VertexByteCode = RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("amp", -1, 52, 4, 0.000000f, 2.000000f, 1.250000f, 0.050000f, "Amplitude"));
-		Params.push_back(ShaderParam("phase", -1, 56, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Phase"));
-		Params.push_back(ShaderParam("lines_black", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Lines Blacks"));
-		Params.push_back(ShaderParam("lines_white", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Lines Whites"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "scanlines-sine-abs";
+	VertexByteCode = RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchScanlinesShadersScanlinesSineAbsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("amp", -1, 52, 4, 0.000000f, 2.000000f, 1.250000f, 0.050000f, "Amplitude"));
+	Params.push_back(ShaderParam("phase", -1, 56, 4, 0.000000f, 2.000000f, 0.500000f, 0.050000f, "Phase"));
+	Params.push_back(ShaderParam("lines_black", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 0.050000f, "Lines Blacks"));
+	Params.push_back(ShaderParam("lines_white", -1, 64, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Lines Whites"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
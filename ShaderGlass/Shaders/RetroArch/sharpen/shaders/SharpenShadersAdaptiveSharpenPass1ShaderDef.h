@@ -56,6 +56,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersAdaptiveSharpenPass1ShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersAdaptiveSharpenPass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -871,31 +882,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersAdaptiveSharpenPass1ShaderDef : public ShaderDef
+RetroArch::SharpenShadersAdaptiveSharpenPass1ShaderDef::SharpenShadersAdaptiveSharpenPass1ShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersAdaptiveSharpenPass1ShaderDef() : ShaderDef{}
-	{
-		Name = "adaptive-sharpen-pass1";
-		VertexByteCode = RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "adaptive-sharpen-pass1";
+	VertexByteCode = RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -80,6 +80,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersAdaptiveSharpenPass2ShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersAdaptiveSharpenPass2ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -3619,33 +3630,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersAdaptiveSharpenPass2ShaderDef : public ShaderDef
+RetroArch::SharpenShadersAdaptiveSharpenPass2ShaderDef::SharpenShadersAdaptiveSharpenPass2ShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersAdaptiveSharpenPass2ShaderDef() : ShaderDef{}
-	{
-		Name = "adaptive-sharpen-pass2";
-		VertexByteCode = RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVE_HEIGHT", -1, 52, 4, 0.300000f, 2.000000f, 1.000000f, 0.100000f, "AS Curve Height"));
-		Params.push_back(ShaderParam("VIDEO_LEVEL_OUT", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "AS Video Lvl Out"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "adaptive-sharpen-pass2";
+	VertexByteCode = RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenPass2ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVE_HEIGHT", -1, 52, 4, 0.300000f, 2.000000f, 1.000000f, 0.100000f, "AS Curve Height"));
+	Params.push_back(ShaderParam("VIDEO_LEVEL_OUT", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "AS Video Lvl Out"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
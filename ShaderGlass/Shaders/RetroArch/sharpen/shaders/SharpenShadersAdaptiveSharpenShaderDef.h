@@ -69,6 +69,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersAdaptiveSharpenShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersAdaptiveSharpenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersAdaptiveSharpenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2363,32 +2374,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersAdaptiveSharpenShaderDef : public ShaderDef
+RetroArch::SharpenShadersAdaptiveSharpenShaderDef::SharpenShadersAdaptiveSharpenShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersAdaptiveSharpenShaderDef() : ShaderDef{}
-	{
-		Name = "adaptive-sharpen";
-		VertexByteCode = RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CURVE_HEIGHT", -1, 52, 4, 0.100000f, 2.000000f, 0.800000f, 0.100000f, "AS Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "adaptive-sharpen";
+	VertexByteCode = RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersAdaptiveSharpenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CURVE_HEIGHT", -1, 52, 4, 0.100000f, 2.000000f, 0.800000f, 0.100000f, "AS Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -11,6 +11,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersCheapSharpenShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersCheapSharpenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersCheapSharpenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -677,32 +688,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersCheapSharpenShaderDef : public ShaderDef
+RetroArch::SharpenShadersCheapSharpenShaderDef::SharpenShadersCheapSharpenShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersCheapSharpenShaderDef() : ShaderDef{}
-	{
-		Name = "cheap-sharpen";
-		VertexByteCode = RetroArchSharpenShadersCheapSharpenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersCheapSharpenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersCheapSharpenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersCheapSharpenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("CS_SHARPNESS", -1, 52, 4, 0.000000f, 1.000000f, 0.400000f, 0.100000f, "Sharpness"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "cheap-sharpen";
+	VertexByteCode = RetroArchSharpenShadersCheapSharpenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersCheapSharpenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersCheapSharpenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersCheapSharpenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("CS_SHARPNESS", -1, 52, 4, 0.000000f, 1.000000f, 0.400000f, 0.100000f, "Sharpness"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersDiffShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersDiffShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersDiffShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -320,32 +331,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersDiffShaderDef : public ShaderDef
+RetroArch::SharpenShadersDiffShaderDef::SharpenShadersDiffShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersDiffShaderDef() : ShaderDef{}
-	{
-		Name = "diff";
-		VertexByteCode = RetroArchSharpenShadersDiffShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersDiffShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersDiffShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersDiffShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("diff_refpass", 3));
+	Name = "diff";
+	VertexByteCode = RetroArchSharpenShadersDiffShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersDiffShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersDiffShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersDiffShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("diff_refpass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
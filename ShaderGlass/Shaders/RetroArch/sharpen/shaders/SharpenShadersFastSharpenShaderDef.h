@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersFastSharpenShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersFastSharpenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersFastSharpenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -595,34 +606,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersFastSharpenShaderDef : public ShaderDef
+RetroArch::SharpenShadersFastSharpenShaderDef::SharpenShadersFastSharpenShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersFastSharpenShaderDef() : ShaderDef{}
-	{
-		Name = "fast-sharpen";
-		VertexByteCode = RetroArchSharpenShadersFastSharpenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersFastSharpenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersFastSharpenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersFastSharpenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SHARPEN", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Sharpen strength"));
-		Params.push_back(ShaderParam("CONTR", -1, 56, 4, 0.000000f, 0.250000f, 0.070000f, 0.010000f, "Ammount of sharpening"));
-		Params.push_back(ShaderParam("DETAILS", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Details sharpened"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "fast-sharpen";
+	VertexByteCode = RetroArchSharpenShadersFastSharpenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersFastSharpenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersFastSharpenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersFastSharpenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SHARPEN", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Sharpen strength"));
+	Params.push_back(ShaderParam("CONTR", -1, 56, 4, 0.000000f, 0.250000f, 0.070000f, 0.010000f, "Ammount of sharpening"));
+	Params.push_back(ShaderParam("DETAILS", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 0.050000f, "Details sharpened"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
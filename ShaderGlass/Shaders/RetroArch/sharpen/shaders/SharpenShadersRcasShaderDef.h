@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersRcasShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersRcasShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersRcasShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -699,33 +710,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersRcasShaderDef : public ShaderDef
+RetroArch::SharpenShadersRcasShaderDef::SharpenShadersRcasShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersRcasShaderDef() : ShaderDef{}
-	{
-		Name = "rcas";
-		VertexByteCode = RetroArchSharpenShadersRcasShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersRcasShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersRcasShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersRcasShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("RCAS_STRENGTH", -1, 52, 4, 0.000000f, 1.100000f, 0.500000f, 0.050000f, "Strength of RCA sharpening"));
-		Params.push_back(ShaderParam("RCAS_DENOISE", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Suppress luma oversharpening"));
-		Samplers.push_back(ShaderSampler("Source", 1));
+	Name = "rcas";
+	VertexByteCode = RetroArchSharpenShadersRcasShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersRcasShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersRcasShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersRcasShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("RCAS_STRENGTH", -1, 52, 4, 0.000000f, 1.100000f, 0.500000f, 0.050000f, "Strength of RCA sharpening"));
+	Params.push_back(ShaderParam("RCAS_DENOISE", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Suppress luma oversharpening"));
+	Samplers.push_back(ShaderSampler("Source", 1));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersSuperResExShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersSuperResExShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersSuperResExShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1307,32 +1318,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersSuperResExShaderDef : public ShaderDef
+RetroArch::SharpenShadersSuperResExShaderDef::SharpenShadersSuperResExShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersSuperResExShaderDef() : ShaderDef{}
-	{
-		Name = "super-res-ex";
-		VertexByteCode = RetroArchSharpenShadersSuperResExShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersSuperResExShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersSuperResExShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersSuperResExShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("REFSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("REF", 3));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "super-res-ex";
+	VertexByteCode = RetroArchSharpenShadersSuperResExShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersSuperResExShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersSuperResExShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersSuperResExShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("REFSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("REF", 3));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
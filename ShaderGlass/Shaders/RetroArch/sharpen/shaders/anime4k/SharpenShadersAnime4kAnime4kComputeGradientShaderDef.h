@@ -38,6 +38,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersAnime4kAnime4kComputeGradientShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersAnime4kAnime4kComputeGradientShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -582,31 +593,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersAnime4kAnime4kComputeGradientShaderDef : public ShaderDef
+RetroArch::SharpenShadersAnime4kAnime4kComputeGradientShaderDef::SharpenShadersAnime4kAnime4kComputeGradientShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersAnime4kAnime4kComputeGradientShaderDef() : ShaderDef{}
-	{
-		Name = "anime4k-compute-gradient";
-		VertexByteCode = RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "anime4k-compute-gradient";
+	VertexByteCode = RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kComputeGradientShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -31,6 +31,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersAnime4kAnime4kPushShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersAnime4kAnime4kPushShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1122,33 +1133,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersAnime4kAnime4kPushShaderDef : public ShaderDef
+RetroArch::SharpenShadersAnime4kAnime4kPushShaderDef::SharpenShadersAnime4kAnime4kPushShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersAnime4kAnime4kPushShaderDef() : ShaderDef{}
-	{
-		Name = "anime4k-push";
-		VertexByteCode = RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("STRENGTH_PUSH", -1, 52, 4, 0.000000f, 1.000000f, 0.300000f, 0.100000f, "Luminance strength"));
-		Params.push_back(ShaderParam("STRENGTH_GRAD", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "anime4k-push";
+	VertexByteCode = RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("STRENGTH_PUSH", -1, 52, 4, 0.000000f, 1.000000f, 0.300000f, 0.100000f, "Luminance strength"));
+	Params.push_back(ShaderParam("STRENGTH_GRAD", -1, 56, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -31,6 +31,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class SharpenShadersAnime4kAnime4kPushgradWeakShaderDef : public ShaderDef
+{
+public:
+	SharpenShadersAnime4kAnime4kPushgradWeakShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1074,33 +1085,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class SharpenShadersAnime4kAnime4kPushgradWeakShaderDef : public ShaderDef
+RetroArch::SharpenShadersAnime4kAnime4kPushgradWeakShaderDef::SharpenShadersAnime4kAnime4kPushgradWeakShaderDef() : ShaderDef{}
 {
-public:
-	SharpenShadersAnime4kAnime4kPushgradWeakShaderDef() : ShaderDef{}
-	{
-		Name = "anime4k-pushgrad-weak";
-		VertexByteCode = RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("STRENGTH_PUSH", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("STRENGTH_GRAD", -1, 56, 4, 0.000000f, 1.000000f, 0.300000f, 0.100000f, "Gradient strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "anime4k-pushgrad-weak";
+	VertexByteCode = RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchSharpenShadersAnime4kAnime4kPushgradWeakShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("STRENGTH_PUSH", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("STRENGTH_GRAD", -1, 56, 4, 0.000000f, 1.000000f, 0.300000f, 0.100000f, "Gradient strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -16,6 +16,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Stereoscopic3dShadersAnaglyphToSideBySideShaderDef : public ShaderDef
+{
+public:
+	Stereoscopic3dShadersAnaglyphToSideBySideShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -901,43 +912,37 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Stereoscopic3dShadersAnaglyphToSideBySideShaderDef : public ShaderDef
+RetroArch::Stereoscopic3dShadersAnaglyphToSideBySideShaderDef::Stereoscopic3dShadersAnaglyphToSideBySideShaderDef() : ShaderDef{}
 {
-public:
-	Stereoscopic3dShadersAnaglyphToSideBySideShaderDef() : ShaderDef{}
-	{
-		Name = "anaglyph-to-side-by-side";
-		VertexByteCode = RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("eye_sep", -1, 52, 4, -1.000000f, 5.000000f, 0.500000f, 0.010000f, "Eye Separation"));
-		Params.push_back(ShaderParam("y_loc", -1, 56, 4, -1.000000f, 1.000000f, 0.500000f, 0.025000f, "Vertical Placement"));
-		Params.push_back(ShaderParam("BOTH", -1, 60, 4, -2.000000f, 2.000000f, 1.000000f, 0.005000f, "Horizontal Placement"));
-		Params.push_back(ShaderParam("ana_zoom", -1, 64, 4, -2.000000f, 2.000000f, 0.750000f, 0.050000f, "Zoom"));
-		Params.push_back(ShaderParam("WIDTH", -1, 68, 4, 1.000000f, 7.000000f, 3.050000f, 0.050000f, "Side-by-Side Image Width"));
-		Params.push_back(ShaderParam("HEIGHT", -1, 72, 4, 1.000000f, 5.000000f, 2.000000f, 0.100000f, "Side-by-Side Image Height"));
-		Params.push_back(ShaderParam("palette", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Red Palette Toggle"));
-		Params.push_back(ShaderParam("warp_enable", -1, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Lens Correction"));
-		Params.push_back(ShaderParam("warpX", -1, 84, 4, 0.000000f, 0.500000f, 0.300000f, 0.050000f, "warpX"));
-		Params.push_back(ShaderParam("warpY", -1, 88, 4, 0.000000f, 0.500000f, 0.300000f, 0.050000f, "warpY"));
-		Params.push_back(ShaderParam("anaglyph_selector", -1, 92, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Anaglyph Mode"));
-		Params.push_back(ShaderParam("eye_swap", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Swap Eyes"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "anaglyph-to-side-by-side";
+	VertexByteCode = RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchStereoscopic3dShadersAnaglyphToSideBySideShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("eye_sep", -1, 52, 4, -1.000000f, 5.000000f, 0.500000f, 0.010000f, "Eye Separation"));
+	Params.push_back(ShaderParam("y_loc", -1, 56, 4, -1.000000f, 1.000000f, 0.500000f, 0.025000f, "Vertical Placement"));
+	Params.push_back(ShaderParam("BOTH", -1, 60, 4, -2.000000f, 2.000000f, 1.000000f, 0.005000f, "Horizontal Placement"));
+	Params.push_back(ShaderParam("ana_zoom", -1, 64, 4, -2.000000f, 2.000000f, 0.750000f, 0.050000f, "Zoom"));
+	Params.push_back(ShaderParam("WIDTH", -1, 68, 4, 1.000000f, 7.000000f, 3.050000f, 0.050000f, "Side-by-Side Image Width"));
+	Params.push_back(ShaderParam("HEIGHT", -1, 72, 4, 1.000000f, 5.000000f, 2.000000f, 0.100000f, "Side-by-Side Image Height"));
+	Params.push_back(ShaderParam("palette", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Red Palette Toggle"));
+	Params.push_back(ShaderParam("warp_enable", -1, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Lens Correction"));
+	Params.push_back(ShaderParam("warpX", -1, 84, 4, 0.000000f, 0.500000f, 0.300000f, 0.050000f, "warpX"));
+	Params.push_back(ShaderParam("warpY", -1, 88, 4, 0.000000f, 0.500000f, 0.300000f, 0.050000f, "warpY"));
+	Params.push_back(ShaderParam("anaglyph_selector", -1, 92, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "Anaglyph Mode"));
+	Params.push_back(ShaderParam("eye_swap", -1, 96, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Swap Eyes"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
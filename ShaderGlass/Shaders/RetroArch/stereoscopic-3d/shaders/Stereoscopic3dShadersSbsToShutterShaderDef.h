@@ -13,6 +13,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Stereoscopic3dShadersSbsToShutterShaderDef : public ShaderDef
+{
+public:
+	Stereoscopic3dShadersSbsToShutterShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchStereoscopic3dShadersSbsToShutterShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -710,36 +721,30 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Stereoscopic3dShadersSbsToShutterShaderDef : public ShaderDef
+RetroArch::Stereoscopic3dShadersSbsToShutterShaderDef::Stereoscopic3dShadersSbsToShutterShaderDef() : ShaderDef{}
 {
-public:
-	Stereoscopic3dShadersSbsToShutterShaderDef() : ShaderDef{}
-	{
-		Name = "sbs-to-shutter";
-		VertexByteCode = RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("split_dist", -1, 52, 4, -1.000000f, 1.000000f, 0.250000f, 0.001000f, "Eye Separation"));
-		Params.push_back(ShaderParam("shutter_zoom", -1, 56, 4, 0.000000f, 2.000000f, 0.800000f, 0.010000f, "Shutter Zoom"));
-		Params.push_back(ShaderParam("shutter_eye_swap", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Shutter Swap Eyes"));
-		Params.push_back(ShaderParam("aspect_mod", -1, 64, 4, 0.000000f, 2.000000f, 0.550000f, 0.010000f, "Aspect Mod"));
-		Params.push_back(ShaderParam("crop", -1, 68, 4, 0.000000f, 1.000000f, 0.500000f, 0.005000f, "Crop Edges"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "sbs-to-shutter";
+	VertexByteCode = RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchStereoscopic3dShadersSbsToShutterShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("split_dist", -1, 52, 4, -1.000000f, 1.000000f, 0.250000f, 0.001000f, "Eye Separation"));
+	Params.push_back(ShaderParam("shutter_zoom", -1, 56, 4, 0.000000f, 2.000000f, 0.800000f, 0.010000f, "Shutter Zoom"));
+	Params.push_back(ShaderParam("shutter_eye_swap", -1, 60, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Shutter Swap Eyes"));
+	Params.push_back(ShaderParam("aspect_mod", -1, 64, 4, 0.000000f, 2.000000f, 0.550000f, 0.010000f, "Aspect Mod"));
+	Params.push_back(ShaderParam("crop", -1, 68, 4, 0.000000f, 1.000000f, 0.500000f, 0.005000f, "Crop Edges"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Stereoscopic3dShadersShutterToAnaglyphShaderDef : public ShaderDef
+{
+public:
+	Stereoscopic3dShadersShutterToAnaglyphShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -615,35 +626,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Stereoscopic3dShadersShutterToAnaglyphShaderDef : public ShaderDef
+RetroArch::Stereoscopic3dShadersShutterToAnaglyphShaderDef::Stereoscopic3dShadersShutterToAnaglyphShaderDef() : ShaderDef{}
 {
-public:
-	Stereoscopic3dShadersShutterToAnaglyphShaderDef() : ShaderDef{}
-	{
-		Name = "shutter-to-anaglyph";
-		VertexByteCode = RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("flip_eye_toggle", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Left/Right"));
-		Params.push_back(ShaderParam("green", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Green"));
-		Params.push_back(ShaderParam("blue", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Blue"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Name = "shutter-to-anaglyph";
+	VertexByteCode = RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchStereoscopic3dShadersShutterToAnaglyphShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("flip_eye_toggle", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Flip Left/Right"));
+	Params.push_back(ShaderParam("green", -1, 56, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Green"));
+	Params.push_back(ShaderParam("blue", -1, 60, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Blue"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -12,6 +12,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Stereoscopic3dShadersShutterToSideBySideShaderDef : public ShaderDef
+{
+public:
+	Stereoscopic3dShadersShutterToSideBySideShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -759,39 +770,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Stereoscopic3dShadersShutterToSideBySideShaderDef : public ShaderDef
+RetroArch::Stereoscopic3dShadersShutterToSideBySideShaderDef::Stereoscopic3dShadersShutterToSideBySideShaderDef() : ShaderDef{}
 {
-public:
-	Stereoscopic3dShadersShutterToSideBySideShaderDef() : ShaderDef{}
-	{
-		Name = "shutter-to-side-by-side";
-		VertexByteCode = RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("ZOOM", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Zoom"));
-		Params.push_back(ShaderParam("vert_pos", -1, 56, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Vertical Modifier"));
-		Params.push_back(ShaderParam("horz_pos", -1, 60, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Horizontal Modifier"));
-		Params.push_back(ShaderParam("separation", -1, 64, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Eye Separation"));
-		Params.push_back(ShaderParam("flicker", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 0.250000f, "Hold Last Frame (reduce flicker)"));
-		Params.push_back(ShaderParam("height_mod", -1, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Image Height"));
-		Params.push_back(ShaderParam("swap_eye", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Swap Eye Sequence"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
+	Name = "shutter-to-side-by-side";
+	VertexByteCode = RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchStereoscopic3dShadersShutterToSideBySideShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("ZOOM", -1, 52, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Zoom"));
+	Params.push_back(ShaderParam("vert_pos", -1, 56, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Vertical Modifier"));
+	Params.push_back(ShaderParam("horz_pos", -1, 60, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Horizontal Modifier"));
+	Params.push_back(ShaderParam("separation", -1, 64, 4, -2.000000f, 2.000000f, 0.000000f, 0.010000f, "Eye Separation"));
+	Params.push_back(ShaderParam("flicker", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 0.250000f, "Hold Last Frame (reduce flicker)"));
+	Params.push_back(ShaderParam("height_mod", -1, 72, 4, 0.000000f, 2.000000f, 1.000000f, 0.010000f, "Image Height"));
+	Params.push_back(ShaderParam("swap_eye", -1, 76, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Swap Eye Sequence"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("OriginalHistory1", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -80,6 +80,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class Stereoscopic3dShadersFubax_vrChromaticShaderDef : public ShaderDef
+{
+public:
+	Stereoscopic3dShadersFubax_vrChromaticShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2098,77 +2109,71 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class Stereoscopic3dShadersFubax_vrChromaticShaderDef : public ShaderDef
+RetroArch::Stereoscopic3dShadersFubax_vrChromaticShaderDef::Stereoscopic3dShadersFubax_vrChromaticShaderDef() : ShaderDef{}
 {
-public:
-	Stereoscopic3dShadersFubax_vrChromaticShaderDef() : ShaderDef{}
-	{
-		Name = "Chromatic";
-		VertexByteCode = RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SoloLines", 0, 64, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Lines (All, Horz, Vert, Rad)"));
-		Params.push_back(ShaderParam("TestGrid", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Calibration Grid"));
-		Params.push_back(ShaderParam("IPD", 0, 72, 4, 0.000000f, 0.750000f, 0.500000f, 0.001000f, "IPD (Interpupillary Distance)"));
-		Params.push_back(ShaderParam("StereoSwitch", 0, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Stereo Vision"));
-		Params.push_back(ShaderParam("FOV", 0, 80, 4, 0.000000f, 170.000000f, 96.000000f, 0.100000f, "Lens Distortion Power"));
-		Params.push_back(ShaderParam("LensType", 0, 84, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Lens Dist Type (Ortho, Equisolid, Equidist, Stereo)"));
-		Params.push_back(ShaderParam("K1", 0, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #1 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("K2", 0, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #2 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("K3", 0, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #3 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("K4", 0, 100, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #4 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("P1", 0, 104, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Tangential Correction #1 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("P2", 0, 108, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Tangential Correction #2 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("P3", 0, 112, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Tangential Correction #3 (Brown-Conrady Model)"));
-		Params.push_back(ShaderParam("ImageScale", 0, 116, 4, 0.250000f, 1.000000f, 1.000000f, 0.010000f, "Image Scale"));
-		Params.push_back(ShaderParam("PerspectiveSwitch", 0, 120, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Lens Correction"));
-		Params.push_back(ShaderParam("ChGreenK1", 0, 124, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (Zoom)"));
-		Params.push_back(ShaderParam("ChGreenK2", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (K1)"));
-		Params.push_back(ShaderParam("ChGreenK3", 0, 132, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (K2)"));
-		Params.push_back(ShaderParam("ChGreenK4", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (K3)"));
-		Params.push_back(ShaderParam("SoloGreen", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Green Channel Adj Solo"));
-		Params.push_back(ShaderParam("ChBlueK1", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (Zoom)"));
-		Params.push_back(ShaderParam("ChBlueK2", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (K1)"));
-		Params.push_back(ShaderParam("ChBlueK3", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (K2)"));
-		Params.push_back(ShaderParam("ChBlueK4", 0, 156, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (K3)"));
-		Params.push_back(ShaderParam("SoloBlue", 0, 160, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Blue Channel Adj Solo"));
-		Params.push_back(ShaderParam("ChromaticAbrSwitch", 0, 164, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Chromatic Correction"));
-		Params.push_back(ShaderParam("ChGreenOffsetL_x", 0, 168, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Green Center Offset X"));
-		Params.push_back(ShaderParam("ChGreenOffsetL_y", 0, 172, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Green Center Offset Y"));
-		Params.push_back(ShaderParam("ChBlueOffsetL_x", 0, 176, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Blue Center Offset X"));
-		Params.push_back(ShaderParam("ChBlueOffsetL_y", 0, 180, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Blue Center Offset Y"));
-		Params.push_back(ShaderParam("ChGreenOffsetR_x", 0, 184, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Green Center Offset X"));
-		Params.push_back(ShaderParam("ChGreenOffsetR_y", 0, 188, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Green Center Offset Y"));
-		Params.push_back(ShaderParam("ChBlueOffsetR_x", 0, 192, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Blue Center Offset X"));
-		Params.push_back(ShaderParam("ChBlueOffsetR_y", 0, 196, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Blue Center Offset Y"));
-		Params.push_back(ShaderParam("Strength", 0, 200, 4, 0.000000f, 100.000000f, 25.000000f, 0.500000f, "Sharpen Strength"));
-		Params.push_back(ShaderParam("Clamp", 0, 204, 4, 0.500000f, 1.000000f, 0.650000f, 0.001000f, "Sharpen Clamping"));
-		Params.push_back(ShaderParam("Offset", 0, 208, 4, 0.010000f, 2.000000f, 0.100000f, 0.002000f, "High-pass Offset"));
-		Params.push_back(ShaderParam("Preview", 0, 212, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Preview Sharpen Layer"));
-		Params.push_back(ShaderParam("Sharpen", 0, 216, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Sharpening"));
-		Params.push_back(ShaderParam("Nose", 0, 220, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Virtual Nose (helps nausea)"));
-		Params.push_back(ShaderParam("Brightness", 0, 224, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Virtual Nose Brightness"));
-		Params.push_back(ShaderParam("Scale_x", 0, 228, 4, 0.100000f, 1.000000f, 0.382000f, 0.010000f, "Virtual Nose Scale X"));
-		Params.push_back(ShaderParam("Scale_y", 0, 232, 4, 0.100000f, 1.000000f, 0.618000f, 0.010000f, "Virtual Nose Scale Y"));
-		Params.push_back(ShaderParam("imgzoom", 0, 236, 4, 0.100000f, 5.000000f, 1.600000f, 0.010000f, "Image Zoom"));
-		Params.push_back(ShaderParam("aspect_x", 0, 240, 4, 1.000000f, 256.000000f, 64.000000f, 1.000000f, "Image Aspect Ratio Numerator"));
-		Params.push_back(ShaderParam("aspect_y", 0, 244, 4, 1.000000f, 256.000000f, 49.000000f, 1.000000f, "Image Aspect Ratio Denominator"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "Chromatic";
+	VertexByteCode = RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchStereoscopic3dShadersFubax_vrChromaticShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SoloLines", 0, 64, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Lines (All, Horz, Vert, Rad)"));
+	Params.push_back(ShaderParam("TestGrid", 0, 68, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Calibration Grid"));
+	Params.push_back(ShaderParam("IPD", 0, 72, 4, 0.000000f, 0.750000f, 0.500000f, 0.001000f, "IPD (Interpupillary Distance)"));
+	Params.push_back(ShaderParam("StereoSwitch", 0, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Stereo Vision"));
+	Params.push_back(ShaderParam("FOV", 0, 80, 4, 0.000000f, 170.000000f, 96.000000f, 0.100000f, "Lens Distortion Power"));
+	Params.push_back(ShaderParam("LensType", 0, 84, 4, 0.000000f, 3.000000f, 0.000000f, 1.000000f, "Lens Dist Type (Ortho, Equisolid, Equidist, Stereo)"));
+	Params.push_back(ShaderParam("K1", 0, 88, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #1 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("K2", 0, 92, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #2 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("K3", 0, 96, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #3 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("K4", 0, 100, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Radial Correction #4 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("P1", 0, 104, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Tangential Correction #1 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("P2", 0, 108, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Tangential Correction #2 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("P3", 0, 112, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Tangential Correction #3 (Brown-Conrady Model)"));
+	Params.push_back(ShaderParam("ImageScale", 0, 116, 4, 0.250000f, 1.000000f, 1.000000f, 0.010000f, "Image Scale"));
+	Params.push_back(ShaderParam("PerspectiveSwitch", 0, 120, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Lens Correction"));
+	Params.push_back(ShaderParam("ChGreenK1", 0, 124, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (Zoom)"));
+	Params.push_back(ShaderParam("ChGreenK2", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (K1)"));
+	Params.push_back(ShaderParam("ChGreenK3", 0, 132, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (K2)"));
+	Params.push_back(ShaderParam("ChGreenK4", 0, 136, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Green Correction (K3)"));
+	Params.push_back(ShaderParam("SoloGreen", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Green Channel Adj Solo"));
+	Params.push_back(ShaderParam("ChBlueK1", 0, 144, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (Zoom)"));
+	Params.push_back(ShaderParam("ChBlueK2", 0, 148, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (K1)"));
+	Params.push_back(ShaderParam("ChBlueK3", 0, 152, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (K2)"));
+	Params.push_back(ShaderParam("ChBlueK4", 0, 156, 4, 0.000000f, 1.000000f, 0.000000f, 0.001000f, "Chromatic Blue Correction (K3)"));
+	Params.push_back(ShaderParam("SoloBlue", 0, 160, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Blue Channel Adj Solo"));
+	Params.push_back(ShaderParam("ChromaticAbrSwitch", 0, 164, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Chromatic Correction"));
+	Params.push_back(ShaderParam("ChGreenOffsetL_x", 0, 168, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Green Center Offset X"));
+	Params.push_back(ShaderParam("ChGreenOffsetL_y", 0, 172, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Green Center Offset Y"));
+	Params.push_back(ShaderParam("ChBlueOffsetL_x", 0, 176, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Blue Center Offset X"));
+	Params.push_back(ShaderParam("ChBlueOffsetL_y", 0, 180, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Left Blue Center Offset Y"));
+	Params.push_back(ShaderParam("ChGreenOffsetR_x", 0, 184, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Green Center Offset X"));
+	Params.push_back(ShaderParam("ChGreenOffsetR_y", 0, 188, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Green Center Offset Y"));
+	Params.push_back(ShaderParam("ChBlueOffsetR_x", 0, 192, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Blue Center Offset X"));
+	Params.push_back(ShaderParam("ChBlueOffsetR_y", 0, 196, 4, -0.200000f, 0.200000f, 0.000000f, 0.001000f, "Right Blue Center Offset Y"));
+	Params.push_back(ShaderParam("Strength", 0, 200, 4, 0.000000f, 100.000000f, 25.000000f, 0.500000f, "Sharpen Strength"));
+	Params.push_back(ShaderParam("Clamp", 0, 204, 4, 0.500000f, 1.000000f, 0.650000f, 0.001000f, "Sharpen Clamping"));
+	Params.push_back(ShaderParam("Offset", 0, 208, 4, 0.010000f, 2.000000f, 0.100000f, 0.002000f, "High-pass Offset"));
+	Params.push_back(ShaderParam("Preview", 0, 212, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Preview Sharpen Layer"));
+	Params.push_back(ShaderParam("Sharpen", 0, 216, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Sharpening"));
+	Params.push_back(ShaderParam("Nose", 0, 220, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Virtual Nose (helps nausea)"));
+	Params.push_back(ShaderParam("Brightness", 0, 224, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Virtual Nose Brightness"));
+	Params.push_back(ShaderParam("Scale_x", 0, 228, 4, 0.100000f, 1.000000f, 0.382000f, 0.010000f, "Virtual Nose Scale X"));
+	Params.push_back(ShaderParam("Scale_y", 0, 232, 4, 0.100000f, 1.000000f, 0.618000f, 0.010000f, "Virtual Nose Scale Y"));
+	Params.push_back(ShaderParam("imgzoom", 0, 236, 4, 0.100000f, 5.000000f, 1.600000f, 0.010000f, "Image Zoom"));
+	Params.push_back(ShaderParam("aspect_x", 0, 240, 4, 1.000000f, 256.000000f, 64.000000f, 1.000000f, "Image Aspect Ratio Numerator"));
+	Params.push_back(ShaderParam("aspect_y", 0, 244, 4, 1.000000f, 256.000000f, 49.000000f, 1.000000f, "Image Aspect Ratio Denominator"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class Stereoscopic3dShadersFubax_vrNoseTextureDef : public TextureDef
+{
+public:
+	Stereoscopic3dShadersFubax_vrNoseTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace Stereoscopic3dShadersFubax_vrNoseTextureDefs
 {
 const BYTE sData[] =
@@ -2681,13 +2689,10 @@ const BYTE sData[] =
 ,174,66,96,130};
 }
 
-class Stereoscopic3dShadersFubax_vrNoseTextureDef : public TextureDef
+Stereoscopic3dShadersFubax_vrNoseTextureDef::Stereoscopic3dShadersFubax_vrNoseTextureDef() : TextureDef{}
 {
-public:
-	Stereoscopic3dShadersFubax_vrNoseTextureDef() : TextureDef{}
-	{
-		Name = "nose.png";
-		Data = Stereoscopic3dShadersFubax_vrNoseTextureDefs::sData;
-		DataLength = sizeof(Stereoscopic3dShadersFubax_vrNoseTextureDefs::sData);
-	}
-};
+	Name = "nose.png";
+	Data = Stereoscopic3dShadersFubax_vrNoseTextureDefs::sData;
+	DataLength = sizeof(Stereoscopic3dShadersFubax_vrNoseTextureDefs::sData);
+}
+#endif
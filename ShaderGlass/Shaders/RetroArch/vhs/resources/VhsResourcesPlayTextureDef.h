@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class VhsResourcesPlayTextureDef : public TextureDef
+{
+public:
+	VhsResourcesPlayTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace VhsResourcesPlayTextureDefs
 {
 const BYTE sData[] =
@@ -2906,13 +2914,10 @@ const BYTE sData[] =
 ,174,66,96,130};
 }
 
-class VhsResourcesPlayTextureDef : public TextureDef
+VhsResourcesPlayTextureDef::VhsResourcesPlayTextureDef() : TextureDef{}
 {
-public:
-	VhsResourcesPlayTextureDef() : TextureDef{}
-	{
-		Name = "play.png";
-		Data = VhsResourcesPlayTextureDefs::sData;
-		DataLength = sizeof(VhsResourcesPlayTextureDefs::sData);
-	}
-};
+	Name = "play.png";
+	Data = VhsResourcesPlayTextureDefs::sData;
+	DataLength = sizeof(VhsResourcesPlayTextureDefs::sData);
+}
+#endif
@@ -7,6 +7,14 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+class VhsResourcesRewTextureDef : public TextureDef
+{
+public:
+	VhsResourcesRewTextureDef();
+};
+
+// data and constructor are compiled in one translation unit only, the shard of the texture's own category
+#ifdef GENERATED_DEFINITIONS
 namespace VhsResourcesRewTextureDefs
 {
 const BYTE sData[] =
@@ -2838,13 +2846,10 @@ const BYTE sData[] =
 ,94,87,214,191,255,187,205,246,223,20,124,137,63,211,251,219,21,177,254,47,129,0,0,0,0,73,69,78,68,174,66,96,130};
 }
 
-class VhsResourcesRewTextureDef : public TextureDef
+VhsResourcesRewTextureDef::VhsResourcesRewTextureDef() : TextureDef{}
 {
-public:
-	VhsResourcesRewTextureDef() : TextureDef{}
-	{
-		Name = "rew.png";
-		Data = VhsResourcesRewTextureDefs::sData;
-		DataLength = sizeof(VhsResourcesRewTextureDefs::sData);
-	}
-};
+	Name = "rew.png";
+	Data = VhsResourcesRewTextureDefs::sData;
+	DataLength = sizeof(VhsResourcesRewTextureDefs::sData);
+}
+#endif
@@ -187,6 +187,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersVHSProVHSPro_FirstShaderDef : public ShaderDef
+{
+public:
+	VhsShadersVHSProVHSPro_FirstShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -4172,93 +4183,87 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersVHSProVHSPro_FirstShaderDef : public ShaderDef
+RetroArch::VhsShadersVHSProVHSPro_FirstShaderDef::VhsShadersVHSProVHSPro_FirstShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersVHSProVHSPro_FirstShaderDef() : ShaderDef{}
-	{
-		Name = "VHSPro_First";
-		VertexByteCode = RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("screenLinesNum", 0, 64, 4, 1.000000f, 2160.000000f, 1080.000000f, 16.000000f, "Screen Resolution [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_Bleed_toggle", 0, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Bleeding [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_BleedMode_select", 0, 72, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Bleeding Mode [VHSPro]"));
-		Params.push_back(ShaderParam("bleedAmount", 0, 76, 4, 0.000000f, 15.000000f, 0.500000f, 0.100000f, "Bleed Stretch [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_FishEye_toggle", 0, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Fisheye [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_FishEye_Hyperspace_toggle", 0, 84, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Fisheye Hyperspace [VHSPro]"));
-		Params.push_back(ShaderParam("fisheyeBend", 0, 88, 4, 0.000000f, 3.000000f, 0.500000f, 0.050000f, "Fisheye Bend [VHSPro]"));
-		Params.push_back(ShaderParam("cutoffX", 0, 92, 4, 0.000000f, 50.000000f, 2.000000f, 1.000000f, "Fisheye Cutoff X [VHSPro]"));
-		Params.push_back(ShaderParam("cutoffY", 0, 96, 4, 0.000000f, 50.000000f, 3.000000f, 1.000000f, "Fisheye Cutoff Y [VHSPro]"));
-		Params.push_back(ShaderParam("cutoffFadeX", 0, 100, 4, 0.000000f, 50.000000f, 25.000000f, 1.000000f, "Fisheye Cutoff Fade X [VHSPro]"));
-		Params.push_back(ShaderParam("cutoffFadeY", 0, 104, 4, 0.000000f, 50.000000f, 25.000000f, 1.000000f, "Fisheye Cutoff Fade Y [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_Vignette_toggle", 0, 108, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Vignette [VHSPro]"));
-		Params.push_back(ShaderParam("vignetteAmount", 0, 112, 4, 0.000000f, 5.000000f, 0.300000f, 0.050000f, "Vignette Amount [VHSPro]"));
-		Params.push_back(ShaderParam("vignetteSpeed", 0, 116, 4, 0.000000f, 5.000000f, 1.000000f, 0.050000f, "Vignette Pulse Speed [VHSPro]"));
-		Params.push_back(ShaderParam("noiseLinesLum", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("noiseQuantizeX", 0, 124, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Quantize Noise X [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_FilmGrain_toggle", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Film Grain [VHSPro]"));
-		Params.push_back(ShaderParam("filmGrainAmount", 0, 132, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Film Grain Alpha [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_YIQNoise_toggle", 0, 136, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Signal Noise [VHSPro]"));
-		Params.push_back(ShaderParam("signalNoiseType_select", 0, 140, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Signal Noise Type [VHSPro]"));
-		Params.push_back(ShaderParam("signalNoiseAmount", 0, 144, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Signal Noise Amount [VHSPro]"));
-		Params.push_back(ShaderParam("signalNoisePower", 0, 148, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Signal Noise Power [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_LineNoise_toggle", 0, 152, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Line Noise [VHSPro]"));
-		Params.push_back(ShaderParam("lineNoiseAmount", 0, 156, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Line Noise Amount [VHSPro]"));
-		Params.push_back(ShaderParam("lineNoiseSpeed", 0, 160, 4, 0.000000f, 10.000000f, 5.000000f, 0.100000f, "Line Noise Speed [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_TapeNoise_toggle", 0, 164, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Tape Noise [VHSPro]"));
-		Params.push_back(ShaderParam("tapeNoiseTH", 0, 168, 4, 0.000000f, 1.500000f, 0.630000f, 0.010000f, "Tape Noise Amount [VHSPro]"));
-		Params.push_back(ShaderParam("tapeNoiseAmount", 0, 172, 4, 0.000000f, 1.500000f, 0.050000f, 0.010000f, "Tape Noise Alpha [VHSPro]"));
-		Params.push_back(ShaderParam("tapeNoiseSpeed", 0, 176, 4, -1.500000f, 1.500000f, 1.000000f, 0.050000f, "Tape Noise Speed [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_ScanLines_toggle", 0, 180, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Scanlines [VHSPro]"));
-		Params.push_back(ShaderParam("scanLineWidth", 0, 184, 4, 0.000000f, 20.000000f, 10.000000f, 0.250000f, "Scanlines Width [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_LinesFloat_toggle", 0, 188, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Lines Float [VHSPro]"));
-		Params.push_back(ShaderParam("linesFloatSpeed", 0, 192, 4, -3.000000f, 3.000000f, 1.000000f, 0.100000f, "Lines Float Speed [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_Stretch_toggle", 0, 196, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Stretch Noise"));
-		Params.push_back(ShaderParam("VHS_Jitter_H_toggle", 0, 200, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Interlacing [VHSPro]"));
-		Params.push_back(ShaderParam("jitterHAmount", 0, 204, 4, 0.000000f, 5.000000f, 0.150000f, 0.050000f, "Interlacing Amount [VHSPro]"));
-		Params.push_back(ShaderParam("VHSJitter_V_toggle", 0, 208, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Jitter [VHSPro]"));
-		Params.push_back(ShaderParam("jitterVAmount", 0, 212, 4, 0.000000f, 15.000000f, 7.500000f, 0.100000f, "Jitter Amount [VHSPro]"));
-		Params.push_back(ShaderParam("jitterVSpeed", 0, 216, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Jitter Speed [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_Twitch_H_toggle", 0, 220, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Horizontal Twitch [VHSPro]"));
-		Params.push_back(ShaderParam("twitchHFreq", 0, 224, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Horizontal Twitch Frequency [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_Twitch_V_toggle", 0, 228, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Vertical Twitch [VHSPro]"));
-		Params.push_back(ShaderParam("twitchVFreq", 0, 232, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Vertical Twitch Frequency [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_SignalTweak_toggle", 0, 236, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Signal Tweak [VHSPro]"));
-		Params.push_back(ShaderParam("signalAdjustY", 0, 240, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Signal Shift Y [VHSPro]"));
-		Params.push_back(ShaderParam("signalAdjustI", 0, 244, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Signal Shift I [VHSPro]"));
-		Params.push_back(ShaderParam("signalAdjustQ", 0, 248, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Signal Shift Q [VHSPro]"));
-		Params.push_back(ShaderParam("signalShiftY", 0, 252, 4, -2.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Adjust Y [VHSPro]"));
-		Params.push_back(ShaderParam("signalShiftI", 0, 256, 4, -2.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Adjust I [VHSPro]"));
-		Params.push_back(ShaderParam("signalShiftQ", 0, 260, 4, -2.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Adjust Q [VHSPro]"));
-		Params.push_back(ShaderParam("gammaCorection", 0, 264, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Gamma Correction [VHSPro]"));
-		Params.push_back(ShaderParam("VHS_Feedback_toggle", 0, 268, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Phosphor Trails [VHSPro]"));
-		Params.push_back(ShaderParam("feedbackAmount", 0, 272, 4, 0.000000f, 3.000000f, 2.000000f, 0.050000f, "Input Amount [VHSPro]"));
-		Params.push_back(ShaderParam("feedbackFade", 0, 276, 4, 0.000000f, 1.000000f, 0.820000f, 0.010000f, "Phosphor Fade [VHSPro]"));
-		Params.push_back(ShaderParam("feedbackThresh", 0, 280, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Input Cutoff [VHSPro]"));
-		Params.push_back(ShaderParam("feedbackColor_R", 0, 284, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Red Tint of Phosphor Trail"));
-		Params.push_back(ShaderParam("feedbackColor_G", 0, 288, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Green Tint of Phosphor Trail"));
-		Params.push_back(ShaderParam("feedbackColor_B", 0, 292, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Blue Tint of Phosphor Trail"));
-		Params.push_back(ShaderParam("feedbackDebug_toggle", 0, 296, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Debug Trail [VHSPro]"));
-		Params.push_back(ShaderParam("noiseLinesNum", 0, 300, 4, 1.000000f, 1080.000000f, 240.000000f, 16.000000f, "Vertical Resolution [VHSPro]"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Original", 2));
-		Samplers.push_back(ShaderSampler("tape", 3));
+	Name = "VHSPro_First";
+	VertexByteCode = RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersVHSProVHSPro_FirstShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("screenLinesNum", 0, 64, 4, 1.000000f, 2160.000000f, 1080.000000f, 16.000000f, "Screen Resolution [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_Bleed_toggle", 0, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Bleeding [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_BleedMode_select", 0, 72, 4, 1.000000f, 5.000000f, 1.000000f, 1.000000f, "Bleeding Mode [VHSPro]"));
+	Params.push_back(ShaderParam("bleedAmount", 0, 76, 4, 0.000000f, 15.000000f, 0.500000f, 0.100000f, "Bleed Stretch [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_FishEye_toggle", 0, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Fisheye [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_FishEye_Hyperspace_toggle", 0, 84, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Fisheye Hyperspace [VHSPro]"));
+	Params.push_back(ShaderParam("fisheyeBend", 0, 88, 4, 0.000000f, 3.000000f, 0.500000f, 0.050000f, "Fisheye Bend [VHSPro]"));
+	Params.push_back(ShaderParam("cutoffX", 0, 92, 4, 0.000000f, 50.000000f, 2.000000f, 1.000000f, "Fisheye Cutoff X [VHSPro]"));
+	Params.push_back(ShaderParam("cutoffY", 0, 96, 4, 0.000000f, 50.000000f, 3.000000f, 1.000000f, "Fisheye Cutoff Y [VHSPro]"));
+	Params.push_back(ShaderParam("cutoffFadeX", 0, 100, 4, 0.000000f, 50.000000f, 25.000000f, 1.000000f, "Fisheye Cutoff Fade X [VHSPro]"));
+	Params.push_back(ShaderParam("cutoffFadeY", 0, 104, 4, 0.000000f, 50.000000f, 25.000000f, 1.000000f, "Fisheye Cutoff Fade Y [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_Vignette_toggle", 0, 108, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Vignette [VHSPro]"));
+	Params.push_back(ShaderParam("vignetteAmount", 0, 112, 4, 0.000000f, 5.000000f, 0.300000f, 0.050000f, "Vignette Amount [VHSPro]"));
+	Params.push_back(ShaderParam("vignetteSpeed", 0, 116, 4, 0.000000f, 5.000000f, 1.000000f, 0.050000f, "Vignette Pulse Speed [VHSPro]"));
+	Params.push_back(ShaderParam("noiseLinesLum", 0, 120, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("noiseQuantizeX", 0, 124, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Quantize Noise X [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_FilmGrain_toggle", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Film Grain [VHSPro]"));
+	Params.push_back(ShaderParam("filmGrainAmount", 0, 132, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Film Grain Alpha [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_YIQNoise_toggle", 0, 136, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Signal Noise [VHSPro]"));
+	Params.push_back(ShaderParam("signalNoiseType_select", 0, 140, 4, 1.000000f, 3.000000f, 1.000000f, 1.000000f, "Signal Noise Type [VHSPro]"));
+	Params.push_back(ShaderParam("signalNoiseAmount", 0, 144, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Signal Noise Amount [VHSPro]"));
+	Params.push_back(ShaderParam("signalNoisePower", 0, 148, 4, 0.000000f, 1.000000f, 0.750000f, 0.010000f, "Signal Noise Power [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_LineNoise_toggle", 0, 152, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Line Noise [VHSPro]"));
+	Params.push_back(ShaderParam("lineNoiseAmount", 0, 156, 4, 0.000000f, 10.000000f, 1.000000f, 0.100000f, "Line Noise Amount [VHSPro]"));
+	Params.push_back(ShaderParam("lineNoiseSpeed", 0, 160, 4, 0.000000f, 10.000000f, 5.000000f, 0.100000f, "Line Noise Speed [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_TapeNoise_toggle", 0, 164, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Tape Noise [VHSPro]"));
+	Params.push_back(ShaderParam("tapeNoiseTH", 0, 168, 4, 0.000000f, 1.500000f, 0.630000f, 0.010000f, "Tape Noise Amount [VHSPro]"));
+	Params.push_back(ShaderParam("tapeNoiseAmount", 0, 172, 4, 0.000000f, 1.500000f, 0.050000f, 0.010000f, "Tape Noise Alpha [VHSPro]"));
+	Params.push_back(ShaderParam("tapeNoiseSpeed", 0, 176, 4, -1.500000f, 1.500000f, 1.000000f, 0.050000f, "Tape Noise Speed [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_ScanLines_toggle", 0, 180, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Scanlines [VHSPro]"));
+	Params.push_back(ShaderParam("scanLineWidth", 0, 184, 4, 0.000000f, 20.000000f, 10.000000f, 0.250000f, "Scanlines Width [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_LinesFloat_toggle", 0, 188, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Lines Float [VHSPro]"));
+	Params.push_back(ShaderParam("linesFloatSpeed", 0, 192, 4, -3.000000f, 3.000000f, 1.000000f, 0.100000f, "Lines Float Speed [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_Stretch_toggle", 0, 196, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Stretch Noise"));
+	Params.push_back(ShaderParam("VHS_Jitter_H_toggle", 0, 200, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Toggle Interlacing [VHSPro]"));
+	Params.push_back(ShaderParam("jitterHAmount", 0, 204, 4, 0.000000f, 5.000000f, 0.150000f, 0.050000f, "Interlacing Amount [VHSPro]"));
+	Params.push_back(ShaderParam("VHSJitter_V_toggle", 0, 208, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Jitter [VHSPro]"));
+	Params.push_back(ShaderParam("jitterVAmount", 0, 212, 4, 0.000000f, 15.000000f, 7.500000f, 0.100000f, "Jitter Amount [VHSPro]"));
+	Params.push_back(ShaderParam("jitterVSpeed", 0, 216, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Jitter Speed [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_Twitch_H_toggle", 0, 220, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Horizontal Twitch [VHSPro]"));
+	Params.push_back(ShaderParam("twitchHFreq", 0, 224, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Horizontal Twitch Frequency [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_Twitch_V_toggle", 0, 228, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Vertical Twitch [VHSPro]"));
+	Params.push_back(ShaderParam("twitchVFreq", 0, 232, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Vertical Twitch Frequency [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_SignalTweak_toggle", 0, 236, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Signal Tweak [VHSPro]"));
+	Params.push_back(ShaderParam("signalAdjustY", 0, 240, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Signal Shift Y [VHSPro]"));
+	Params.push_back(ShaderParam("signalAdjustI", 0, 244, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Signal Shift I [VHSPro]"));
+	Params.push_back(ShaderParam("signalAdjustQ", 0, 248, 4, -0.250000f, 0.250000f, 0.000000f, 0.010000f, "Signal Shift Q [VHSPro]"));
+	Params.push_back(ShaderParam("signalShiftY", 0, 252, 4, -2.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Adjust Y [VHSPro]"));
+	Params.push_back(ShaderParam("signalShiftI", 0, 256, 4, -2.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Adjust I [VHSPro]"));
+	Params.push_back(ShaderParam("signalShiftQ", 0, 260, 4, -2.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Adjust Q [VHSPro]"));
+	Params.push_back(ShaderParam("gammaCorection", 0, 264, 4, 0.000000f, 2.000000f, 1.000000f, 0.050000f, "Signal Gamma Correction [VHSPro]"));
+	Params.push_back(ShaderParam("VHS_Feedback_toggle", 0, 268, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Phosphor Trails [VHSPro]"));
+	Params.push_back(ShaderParam("feedbackAmount", 0, 272, 4, 0.000000f, 3.000000f, 2.000000f, 0.050000f, "Input Amount [VHSPro]"));
+	Params.push_back(ShaderParam("feedbackFade", 0, 276, 4, 0.000000f, 1.000000f, 0.820000f, 0.010000f, "Phosphor Fade [VHSPro]"));
+	Params.push_back(ShaderParam("feedbackThresh", 0, 280, 4, 0.000000f, 1.000000f, 0.100000f, 0.010000f, "Input Cutoff [VHSPro]"));
+	Params.push_back(ShaderParam("feedbackColor_R", 0, 284, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "Red Tint of Phosphor Trail"));
+	Params.push_back(ShaderParam("feedbackColor_G", 0, 288, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Green Tint of Phosphor Trail"));
+	Params.push_back(ShaderParam("feedbackColor_B", 0, 292, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "Blue Tint of Phosphor Trail"));
+	Params.push_back(ShaderParam("feedbackDebug_toggle", 0, 296, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Toggle Debug Trail [VHSPro]"));
+	Params.push_back(ShaderParam("noiseLinesNum", 0, 300, 4, 1.000000f, 1080.000000f, 240.000000f, 16.000000f, "Vertical Resolution [VHSPro]"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Original", 2));
+	Samplers.push_back(ShaderSampler("tape", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
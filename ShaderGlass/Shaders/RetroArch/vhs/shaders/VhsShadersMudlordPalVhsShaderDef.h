@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersMudlordPalVhsShaderDef : public ShaderDef
+{
+public:
+	VhsShadersMudlordPalVhsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersMudlordPalVhsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -869,38 +880,32 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersMudlordPalVhsShaderDef : public ShaderDef
+RetroArch::VhsShadersMudlordPalVhsShaderDef::VhsShadersMudlordPalVhsShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersMudlordPalVhsShaderDef() : ShaderDef{}
-	{
-		Name = "mudlord-pal-vhs";
-		VertexByteCode = RetroArchVhsShadersMudlordPalVhsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersMudlordPalVhsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersMudlordPalVhsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersMudlordPalVhsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("frameShape", -1, 52, 4, 0.000000f, 1.000000f, 0.350000f, 0.010000f, "Border mask shape"));
-		Params.push_back(ShaderParam("frameLimit", -1, 56, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Border mask limit"));
-		Params.push_back(ShaderParam("frameSharpness", -1, 60, 4, 0.000000f, 4.000000f, 1.100000f, 0.010000f, "Border mask sharpness"));
-		Params.push_back(ShaderParam("TVNoise", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "PAL signal modulation + noise"));
-		Params.push_back(ShaderParam("PALSignal", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "PAL signal simulation"));
-		Params.push_back(ShaderParam("phosphors", -1, 72, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Phosphor mask"));
-		Params.push_back(ShaderParam("border", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Border mask"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "mudlord-pal-vhs";
+	VertexByteCode = RetroArchVhsShadersMudlordPalVhsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersMudlordPalVhsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersMudlordPalVhsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersMudlordPalVhsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("frameShape", -1, 52, 4, 0.000000f, 1.000000f, 0.350000f, 0.010000f, "Border mask shape"));
+	Params.push_back(ShaderParam("frameLimit", -1, 56, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Border mask limit"));
+	Params.push_back(ShaderParam("frameSharpness", -1, 60, 4, 0.000000f, 4.000000f, 1.100000f, 0.010000f, "Border mask sharpness"));
+	Params.push_back(ShaderParam("TVNoise", -1, 64, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "PAL signal modulation + noise"));
+	Params.push_back(ShaderParam("PALSignal", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "PAL signal simulation"));
+	Params.push_back(ShaderParam("phosphors", -1, 72, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Phosphor mask"));
+	Params.push_back(ShaderParam("border", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Border mask"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -19,6 +19,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersRewindShaderDef : public ShaderDef
+{
+public:
+	VhsShadersRewindShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersRewindShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -962,33 +973,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersRewindShaderDef : public ShaderDef
+RetroArch::VhsShadersRewindShaderDef::VhsShadersRewindShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersRewindShaderDef() : ShaderDef{}
-	{
-		Name = "rewind";
-		VertexByteCode = RetroArchVhsShadersRewindShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersRewindShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersRewindShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersRewindShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("rew", 3));
+	Name = "rewind";
+	VertexByteCode = RetroArchVhsShadersRewindShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersRewindShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersRewindShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersRewindShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("rew", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -20,6 +20,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersStaticShaderDef : public ShaderDef
+{
+public:
+	VhsShadersStaticShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersStaticShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1073,34 +1084,28 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersStaticShaderDef : public ShaderDef
+RetroArch::VhsShadersStaticShaderDef::VhsShadersStaticShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersStaticShaderDef() : ShaderDef{}
-	{
-		Name = "static";
-		VertexByteCode = RetroArchVhsShadersStaticShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersStaticShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersStaticShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersStaticShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("magnitude", -1, 52, 4, 0.000000f, 25.000000f, 0.900000f, 0.100000f, "Distortion Magnitude"));
-		Params.push_back(ShaderParam("always_on", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "OSD Always On"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("play", 3));
+	Name = "static";
+	VertexByteCode = RetroArchVhsShadersStaticShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersStaticShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersStaticShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersStaticShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("magnitude", -1, 52, 4, 0.000000f, 25.000000f, 0.900000f, 0.100000f, "Distortion Magnitude"));
+	Params.push_back(ShaderParam("always_on", -1, 56, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "OSD Always On"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("play", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
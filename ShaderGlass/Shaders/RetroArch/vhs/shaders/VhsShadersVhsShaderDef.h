@@ -15,6 +15,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersVhsShaderDef : public ShaderDef
+{
+public:
+	VhsShadersVhsShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersVhsShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1988,35 +1999,29 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersVhsShaderDef : public ShaderDef
+RetroArch::VhsShadersVhsShaderDef::VhsShadersVhsShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersVhsShaderDef() : ShaderDef{}
-	{
-		Name = "vhs";
-		VertexByteCode = RetroArchVhsShadersVhsShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersVhsShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersVhsShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersVhsShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("wiggle", -1, 56, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Wiggle"));
-		Params.push_back(ShaderParam("smear", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Chroma Smear"));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("play", 3));
+	Name = "vhs";
+	VertexByteCode = RetroArchVhsShadersVhsShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersVhsShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersVhsShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersVhsShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("wiggle", -1, 56, 4, 0.000000f, 10.000000f, 0.000000f, 1.000000f, "Wiggle"));
+	Params.push_back(ShaderParam("smear", -1, 60, 4, 0.000000f, 1.000000f, 0.500000f, 0.050000f, "Chroma Smear"));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("play", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
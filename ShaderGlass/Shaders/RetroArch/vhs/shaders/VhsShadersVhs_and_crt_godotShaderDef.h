@@ -53,6 +53,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersVhs_and_crt_godotShaderDef : public ShaderDef
+{
+public:
+	VhsShadersVhs_and_crt_godotShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersVhs_and_crt_godotShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -2056,52 +2067,46 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersVhs_and_crt_godotShaderDef : public ShaderDef
+RetroArch::VhsShadersVhs_and_crt_godotShaderDef::VhsShadersVhs_and_crt_godotShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersVhs_and_crt_godotShaderDef() : ShaderDef{}
-	{
-		Name = "vhs_and_crt_godot";
-		VertexByteCode = RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("godot_scanlines_opacity", 0, 64, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Scanlines Opacity"));
-		Params.push_back(ShaderParam("godot_scanlines_width", 0, 68, 4, 0.000000f, 0.500000f, 0.250000f, 0.050000f, "Scanlines Width"));
-		Params.push_back(ShaderParam("godot_grille_opacity", 0, 72, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Grille Opacity"));
-		Params.push_back(ShaderParam("godot_pixelate", 0, 76, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("godot_roll", 0, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Roll Toggle"));
-		Params.push_back(ShaderParam("godot_roll_speed", 0, 84, 4, -20.000000f, 20.000000f, 8.000000f, 0.100000f, "Roll Speed"));
-		Params.push_back(ShaderParam("godot_roll_size", 0, 88, 4, 0.000000f, 100.000000f, 15.000000f, 1.000000f, "Roll Size"));
-		Params.push_back(ShaderParam("godot_roll_variation", 0, 92, 4, 0.100000f, 5.000000f, 1.800000f, 0.100000f, "Roll Variation"));
-		Params.push_back(ShaderParam("godot_distort_intensity", 0, 96, 4, 0.000000f, 0.200000f, 0.050000f, 0.010000f, "Distortion Intensity"));
-		Params.push_back(ShaderParam("godot_noise_opacity", 0, 100, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Noise Opacity"));
-		Params.push_back(ShaderParam("godot_noise_speed", 0, 104, 4, 0.000000f, 20.000000f, 5.000000f, 0.500000f, "Noise Speed"));
-		Params.push_back(ShaderParam("godot_static_noise_intensity", 0, 108, 4, 0.000000f, 1.000000f, 0.060000f, 0.010000f, "Static Noise Intensity"));
-		Params.push_back(ShaderParam("godot_aberration", 0, 112, 4, -1.000000f, 1.000000f, 0.030000f, 0.010000f, "Aberration"));
-		Params.push_back(ShaderParam("godot_brightness", 0, 116, 4, 0.000000f, 2.000000f, 1.400000f, 0.010000f, "Brightness"));
-		Params.push_back(ShaderParam("godot_discolor", 0, 120, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Discolor Toggle"));
-		Params.push_back(ShaderParam("godot_warp_amount", 0, 124, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Warp Amount"));
-		Params.push_back(ShaderParam("godot_clip_warp", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Clip Warp Toggle"));
-		Params.push_back(ShaderParam("godot_vignette_intensity", 0, 132, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Vignette Intensity"));
-		Params.push_back(ShaderParam("godot_vignette_opacity", 0, 136, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Vignette Opacity"));
-		Params.push_back(ShaderParam("godot_moire", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Warp Scanlines/Mask (Moire!)"));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "vhs_and_crt_godot";
+	VertexByteCode = RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersVhs_and_crt_godotShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("godot_scanlines_opacity", 0, 64, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Scanlines Opacity"));
+	Params.push_back(ShaderParam("godot_scanlines_width", 0, 68, 4, 0.000000f, 0.500000f, 0.250000f, 0.050000f, "Scanlines Width"));
+	Params.push_back(ShaderParam("godot_grille_opacity", 0, 72, 4, 0.000000f, 1.000000f, 0.300000f, 0.010000f, "Grille Opacity"));
+	Params.push_back(ShaderParam("godot_pixelate", 0, 76, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("godot_roll", 0, 80, 4, 0.000000f, 1.000000f, 1.000000f, 1.000000f, "Roll Toggle"));
+	Params.push_back(ShaderParam("godot_roll_speed", 0, 84, 4, -20.000000f, 20.000000f, 8.000000f, 0.100000f, "Roll Speed"));
+	Params.push_back(ShaderParam("godot_roll_size", 0, 88, 4, 0.000000f, 100.000000f, 15.000000f, 1.000000f, "Roll Size"));
+	Params.push_back(ShaderParam("godot_roll_variation", 0, 92, 4, 0.100000f, 5.000000f, 1.800000f, 0.100000f, "Roll Variation"));
+	Params.push_back(ShaderParam("godot_distort_intensity", 0, 96, 4, 0.000000f, 0.200000f, 0.050000f, 0.010000f, "Distortion Intensity"));
+	Params.push_back(ShaderParam("godot_noise_opacity", 0, 100, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Noise Opacity"));
+	Params.push_back(ShaderParam("godot_noise_speed", 0, 104, 4, 0.000000f, 20.000000f, 5.000000f, 0.500000f, "Noise Speed"));
+	Params.push_back(ShaderParam("godot_static_noise_intensity", 0, 108, 4, 0.000000f, 1.000000f, 0.060000f, 0.010000f, "Static Noise Intensity"));
+	Params.push_back(ShaderParam("godot_aberration", 0, 112, 4, -1.000000f, 1.000000f, 0.030000f, 0.010000f, "Aberration"));
+	Params.push_back(ShaderParam("godot_brightness", 0, 116, 4, 0.000000f, 2.000000f, 1.400000f, 0.010000f, "Brightness"));
+	Params.push_back(ShaderParam("godot_discolor", 0, 120, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Discolor Toggle"));
+	Params.push_back(ShaderParam("godot_warp_amount", 0, 124, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Warp Amount"));
+	Params.push_back(ShaderParam("godot_clip_warp", 0, 128, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Clip Warp Toggle"));
+	Params.push_back(ShaderParam("godot_vignette_intensity", 0, 132, 4, 0.000000f, 1.000000f, 0.400000f, 0.010000f, "Vignette Intensity"));
+	Params.push_back(ShaderParam("godot_vignette_opacity", 0, 136, 4, 0.000000f, 1.000000f, 0.500000f, 0.010000f, "Vignette Opacity"));
+	Params.push_back(ShaderParam("godot_moire", 0, 140, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "Warp Scanlines/Mask (Moire!)"));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -25,6 +25,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersVhs_fontShaderDef : public ShaderDef
+{
+public:
+	VhsShadersVhs_fontShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersVhs_fontShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -11386,33 +11397,27 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersVhs_fontShaderDef : public ShaderDef
+RetroArch::VhsShadersVhs_fontShaderDef::VhsShadersVhs_fontShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersVhs_fontShaderDef() : ShaderDef{}
-	{
-		Name = "vhs_font";
-		VertexByteCode = RetroArchVhsShadersVhs_fontShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersVhs_fontShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersVhs_fontShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersVhs_fontShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("godot_warp_amount", -1, 56, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Warp Amount"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "vhs_font";
+	VertexByteCode = RetroArchVhsShadersVhs_fontShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersVhs_fontShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersVhs_fontShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersVhs_fontShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameDirection", -1, 52, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("godot_warp_amount", -1, 56, 4, 0.000000f, 5.000000f, 1.000000f, 0.100000f, "Warp Amount"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersGristleVHSHorizontalSoftenShaderDef : public ShaderDef
+{
+public:
+	VhsShadersGristleVHSHorizontalSoftenShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -1080,31 +1091,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersGristleVHSHorizontalSoftenShaderDef : public ShaderDef
+RetroArch::VhsShadersGristleVHSHorizontalSoftenShaderDef::VhsShadersGristleVHSHorizontalSoftenShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersGristleVHSHorizontalSoftenShaderDef() : ShaderDef{}
-	{
-		Name = "HorizontalSoften";
-		VertexByteCode = RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "HorizontalSoften";
+	VertexByteCode = RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersGristleVHSHorizontalSoftenShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -8,6 +8,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersGristleVHSVHSShaderDef : public ShaderDef
+{
+public:
+	VhsShadersGristleVHSVHSShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersGristleVHSVHSShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -437,32 +448,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersGristleVHSVHSShaderDef : public ShaderDef
+RetroArch::VhsShadersGristleVHSVHSShaderDef::VhsShadersGristleVHSVHSShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersGristleVHSVHSShaderDef() : ShaderDef{}
-	{
-		Name = "VHS";
-		VertexByteCode = RetroArchVhsShadersGristleVHSVHSShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersGristleVHSVHSShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersGristleVHSVHSShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersGristleVHSVHSShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
-		Samplers.push_back(ShaderSampler("gristleVHS_refpass", 3));
+	Name = "VHS";
+	VertexByteCode = RetroArchVhsShadersGristleVHSVHSShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersGristleVHSVHSShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersGristleVHSVHSShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersGristleVHSVHSShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
+	Samplers.push_back(ShaderSampler("gristleVHS_refpass", 3));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -18,6 +18,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef : public ShaderDef
+{
+public:
+	VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -898,31 +909,25 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef : public ShaderDef
+RetroArch::VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef::VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef() : ShaderDef{}
 {
-public:
-	VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef() : ShaderDef{}
-	{
-		Name = "vhs_mpalko_pass1";
-		VertexByteCode = RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "vhs_mpalko_pass1";
+	VertexByteCode = RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchVhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -14,6 +14,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class WarpShadersDilationShaderDef : public ShaderDef
+{
+public:
+	WarpShadersDilationShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchWarpShadersDilationShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -680,32 +691,26 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class WarpShadersDilationShaderDef : public ShaderDef
+RetroArch::WarpShadersDilationShaderDef::WarpShadersDilationShaderDef() : ShaderDef{}
 {
-public:
-	WarpShadersDilationShaderDef() : ShaderDef{}
-	{
-		Name = "dilation";
-		VertexByteCode = RetroArchWarpShadersDilationShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchWarpShadersDilationShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchWarpShadersDilationShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchWarpShadersDilationShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("DILATION_STRENGTH", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Dilation Strength"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "dilation";
+	VertexByteCode = RetroArchWarpShadersDilationShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchWarpShadersDilationShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchWarpShadersDilationShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchWarpShadersDilationShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("DILATION_STRENGTH", -1, 52, 4, 0.000000f, 1.000000f, 0.500000f, 0.100000f, "Dilation Strength"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -10,6 +10,17 @@ This file is auto-generated, do not modify directly.
 
 #pragma once
 
+namespace RetroArch
+{
+class WarpShadersSmartMorphShaderDef : public ShaderDef
+{
+public:
+	WarpShadersSmartMorphShaderDef();
+};
+}
+
+// code and constructor are compiled in one translation unit only, the shard of the shader's own category
+#ifdef GENERATED_DEFINITIONS
 namespace RetroArchWarpShadersSmartMorphShaderDefs
 {
 static const BYTE sVertexByteCode[] =
@@ -809,39 +820,33 @@ static const BYTE sFragmentByteCode[] =
 
 }
 
-namespace RetroArch
-{
-class WarpShadersSmartMorphShaderDef : public ShaderDef
+RetroArch::WarpShadersSmartMorphShaderDef::WarpShadersSmartMorphShaderDef() : ShaderDef{}
 {
-public:
-	WarpShadersSmartMorphShaderDef() : ShaderDef{}
-	{
-		Name = "smart-morph";
-		VertexByteCode = RetroArchWarpShadersSmartMorphShaderDefs::sVertexByteCode;
-		VertexLength = sizeof(RetroArchWarpShadersSmartMorphShaderDefs::sVertexByteCode);
-		FragmentByteCode = RetroArchWarpShadersSmartMorphShaderDefs::sFragmentByteCode;
-		FragmentLength = sizeof(RetroArchWarpShadersSmartMorphShaderDefs::sFragmentByteCode);
-		Format = "";
-		Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
-		Params.push_back(ShaderParam("SM_MODE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SmartMorph Dilation / Erosion"));
-		Params.push_back(ShaderParam("SM_RANGE", -1, 56, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "SmartMorph Range 0-multi 1-hor 2-vert"));
-		Params.push_back(ShaderParam("SM_PWR", -1, 60, 4, 0.000000f, 10.000000f, 0.500000f, 0.100000f, "SmartMorph Luma Exponent"));
-		Params.push_back(ShaderParam("SM_STRMIN", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "SmartMorph MIN Strength"));
-		Params.push_back(ShaderParam("SM_STRMAX", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "SmartMorph MAX Strength"));
-		Params.push_back(ShaderParam("SM_CUTLO", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "SmartMorph LO Contrast Cutoff"));
-		Params.push_back(ShaderParam("SM_CUTHI", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "SmartMorph HI Contrast Cutoff"));
-		Params.push_back(ShaderParam("SM_DEBUG", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SmartMorph Adjust View"));
-		Samplers.push_back(ShaderSampler("Source", 2));
+	Name = "smart-morph";
+	VertexByteCode = RetroArchWarpShadersSmartMorphShaderDefs::sVertexByteCode;
+	VertexLength = sizeof(RetroArchWarpShadersSmartMorphShaderDefs::sVertexByteCode);
+	FragmentByteCode = RetroArchWarpShadersSmartMorphShaderDefs::sFragmentByteCode;
+	FragmentLength = sizeof(RetroArchWarpShadersSmartMorphShaderDefs::sFragmentByteCode);
+	Format = "";
+	Params.push_back(ShaderParam("MVP", 0, 0, 64, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SourceSize", -1, 0, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OriginalSize", -1, 16, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("OutputSize", -1, 32, 16, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("FrameCount", -1, 48, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, ""));
+	Params.push_back(ShaderParam("SM_MODE", -1, 52, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SmartMorph Dilation / Erosion"));
+	Params.push_back(ShaderParam("SM_RANGE", -1, 56, 4, 0.000000f, 2.000000f, 0.000000f, 1.000000f, "SmartMorph Range 0-multi 1-hor 2-vert"));
+	Params.push_back(ShaderParam("SM_PWR", -1, 60, 4, 0.000000f, 10.000000f, 0.500000f, 0.100000f, "SmartMorph Luma Exponent"));
+	Params.push_back(ShaderParam("SM_STRMIN", -1, 64, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "SmartMorph MIN Strength"));
+	Params.push_back(ShaderParam("SM_STRMAX", -1, 68, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "SmartMorph MAX Strength"));
+	Params.push_back(ShaderParam("SM_CUTLO", -1, 72, 4, 0.000000f, 1.000000f, 0.000000f, 0.010000f, "SmartMorph LO Contrast Cutoff"));
+	Params.push_back(ShaderParam("SM_CUTHI", -1, 76, 4, 0.000000f, 1.000000f, 1.000000f, 0.010000f, "SmartMorph HI Contrast Cutoff"));
+	Params.push_back(ShaderParam("SM_DEBUG", -1, 80, 4, 0.000000f, 1.000000f, 0.000000f, 1.000000f, "SmartMorph Adjust View"));
+	Samplers.push_back(ShaderSampler("Source", 2));
 /*
 VertexSource = %*VERTEX_SOURCE*%;
 */
 /*
 FragmentSource = %*FRAGMENT_SOURCE*%;
 */
-	}
-};
 }
+#endif
@@ -0,0 +1,28 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\anamorphic\shaders\AnamorphicShadersAnamorphicShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\anamorphic\AnamorphicAnamorphicPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddAnamorphicPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(0, new AnamorphicAnamorphicPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,62 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\anti-aliasing\shaders\aa-shader-4.0-level2\AntiAliasingShadersAaShader40Level2AaShader40Level2Pass1ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\aa-shader-4.0-level2\AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersAaShader40ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersAdvancedAaShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersFxaaShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersReverseAaShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass0ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass1ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass2ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass0ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass1ShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaAreaTexTextureDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSearchTexTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicXShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicYShaderDef.h"
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersFastSharpenShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\anti-aliasing\AntiAliasingAaShader40Level2PresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingAaShader40PresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingAdvancedAaPresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingFxaaLinearPresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingFxaaPresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingReverseAaPresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingSmaaLinearPresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingSmaaSharpenPresetDef.h"
+#include "RetroArch\anti-aliasing\AntiAliasingSmaaPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddAntiAliasingPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(1, new AntiAliasingAaShader40Level2PresetDef());
+    list.emplace_back(2, new AntiAliasingAaShader40PresetDef());
+    list.emplace_back(3, new AntiAliasingAdvancedAaPresetDef());
+    list.emplace_back(4, new AntiAliasingFxaaLinearPresetDef());
+    list.emplace_back(5, new AntiAliasingFxaaPresetDef());
+    list.emplace_back(6, new AntiAliasingReverseAaPresetDef());
+    list.emplace_back(7, new AntiAliasingSmaaLinearPresetDef());
+    list.emplace_back(8, new AntiAliasingSmaaSharpenPresetDef());
+    list.emplace_back(9, new AntiAliasingSmaaPresetDef());
+// %PRESET_CLASS%
+}
+}
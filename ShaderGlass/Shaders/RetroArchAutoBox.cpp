@@ -0,0 +1,26 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\auto-box\AutoBoxBoxCenterShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddAutoBoxPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+// %PRESET_CLASS%
+}
+}
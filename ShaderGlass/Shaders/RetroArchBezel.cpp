@@ -0,0 +1,332 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmDrezNoneShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoGlassParamsShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextAdvGlassShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmFetchDrezOutputShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\dedither\BezelMega_BezelShadersDeditherDeditherGammaPrep1BeforeShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass1ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass3ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass4ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\sgenpt-mix\BezelMega_BezelShadersHyllianSgenptMixSgenptMixPass5ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\dedither\BezelMega_BezelShadersDeditherDeditherGammaPrep2AfterShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\ps1dither\BezelMega_BezelShadersPs1ditherHsmPS1UnditherBoxBlurShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\fxaa\BezelMega_BezelShadersFxaaFxaaShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmGSharp_resamplerShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\extras\BezelMega_BezelShadersGuestExtrasHsmSharpsmootherShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseStockShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass0ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass1ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass3ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\scalefx\BezelMega_BezelShadersScalefxHsmScalefxPass4ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseIntroShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\gtu\BezelMega_BezelShadersGtuHsmGtuPass1ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\gtu\BezelMega_BezelShadersGtuHsmGtuPass2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmAfterglow0ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmPreShadersAfterglowShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\dogway\BezelMega_BezelShadersDogwayHsmGradeShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCustomFastSharpenShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmAvgLumShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmInterlaceAndLinearizeShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_horizShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeBlur_vertShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeThresholdShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\easymode\BezelMega_BezelShadersEasymodeHsmCrtEasymodeHalationShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepGlassShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseLinearizeCrtShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBlurOutsideScreenHorizShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBlurOutsideScreenVertShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseReflectionGlassShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseDelinearizeShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtDariusgGdvMiniShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\ntsc\BezelMega_BezelShadersGuestNtscHsmNtscPass1ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\ntsc\BezelMega_BezelShadersGuestNtscHsmNtscPass2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\ntsc\BezelMega_BezelShadersGuestNtscHsmNtscPass3ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCustomFastSharpenNtscShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass1ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmGaussian_horizontalShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmGaussian_verticalShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmBloom_horizontalShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmBloom_verticalShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmDeconvergenceShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\lcd-cgwg\BezelMega_BezelShadersLcdCgwgHsmLcdGridV2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoNoReflectParamsShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextAdvNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass2NoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBezelImagesUnderCrtShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseBezelImagesOverCrtShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCombinePassesNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmDeconvergenceNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseOutputSdrShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoAllParamsShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextAdvShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepImageLayersShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseReflectionShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCombinePassesShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrSuperXbrPass0ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrSuperXbrPass1ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrSuperXbrPass2ShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicXShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\hyllian\crt-super-xbr\BezelMega_BezelShadersHyllianCrtSuperXbrCustomBicubicYShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepMinimumNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtDariusgGdvMiniPotatoShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextStdGlassShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextStdShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseTextStdNoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\lcd-cgwg\BezelMega_BezelShadersLcdCgwgHsmLcdGridV2NoReflectShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBaseCacheInfoPotatoParamsShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedNtscPass2PotatoShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\base\BezelMega_BezelShadersBasePostCrtPrepPotatoShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmCrtGuestAdvancedPotatoShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\BezelMega_BezelShadersGuestHsmDeconvergencePotatoShaderDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\lcd-cgwg\BezelMega_BezelShadersLcdCgwgHsmLcdGridV2PotatoShaderDef.h"
+#include "RetroArch\bezel\uborder\shaders\support_shaders\BezelUborderShadersSupport_shadersFeedbackShaderDef.h"
+#include "RetroArch\bezel\uborder\shaders\support_shaders\BezelUborderShadersSupport_shadersAmbientLightShaderDef.h"
+#include "RetroArch\bezel\uborder\shaders\support_shaders\BezelUborderShadersSupport_shadersOriginalShaderDef.h"
+#include "RetroArch\bezel\uborder\shaders\content_shaders\BezelUborderShadersContent_shadersCrtNobodyShaderDef.h"
+#include "RetroArch\bezel\uborder\shaders\BezelUborderShadersUborderShaderDef.h"
+#include "RetroArch\bezel\uborder\shaders\content_bezel_shaders\BezelUborderShadersContent_bezel_shadersCrtNobodyBezelReflectionsShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutTrinitronLutTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutInvTrinitronLutTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutNecLutTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\guest\lut\BezelMega_BezelShadersGuestLutNtscLutTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesIntroImage_MegaBezelLogoTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesPlaceholder_Transparent_16x16TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTube_Diffuse_2390x1792TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesColored_Gel_RainbowTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTube_Shadow_1600x1200TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTubeGlassOverlayImageCropped_1440x1080TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesTopLayerImageGradient_3840x2160TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesPlaceholder_White_16x16TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesBackgroundImage_Carbon_3840x2160TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesFrameTexture_2800x2120TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesNightLightingClose_1920x1080TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesNightLightingFar_1920x1080TextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesBaked_Frame_Carbonfiber_BackgroundTextureDef.h"
+#include "RetroArch\bezel\Mega_Bezel\shaders\textures\BezelMega_BezelShadersTexturesBaked_Frame_Carbonfiber_Background_VertTextureDef.h"
+#include "RetroArch\bezel\uborder\textures\borders\BezelUborderTexturesBordersDefaultTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9x9ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass0ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass1ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass2ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass3ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass4ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass0ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass1ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass2ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLightingCombineShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensDBTextureDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensSpriteTextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVRESHADEFX__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSRESHADEFX__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYNOTUBEFX__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__EASYMODEPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMININTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMINIPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVNTSCPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\Base_CRT_Presets\BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__LCDGRIDPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_ADVGLASSPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_ADVNOREFLECTPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_ADVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_POTATOPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_SMOOTHADVGLASSPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_SMOOTHADVPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_STDGLASSPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_STDNOREFLECTPresetDef.h"
+#include "RetroArch\bezel\Mega_Bezel\Presets\BezelMega_BezelPresetsMegaBezel_STDPresetDef.h"
+#include "RetroArch\bezel\uborder\BezelUborderAmbientLightCrtPresetDef.h"
+#include "RetroArch\bezel\uborder\BezelUborderUborderBezelReflectionsPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddBezelPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(10, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__EASYMODEPresetDef());
+    list.emplace_back(11, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVMINIPresetDef());
+    list.emplace_back(12, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVNTSCPresetDef());
+    list.emplace_back(13, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__GDVPresetDef());
+    list.emplace_back(14, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVGLASS__LCDGRIDPresetDef());
+    list.emplace_back(15, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVNTSCPresetDef());
+    list.emplace_back(16, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVNOREFLECT__GDVPresetDef());
+    list.emplace_back(17, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVNTSCPresetDef());
+    list.emplace_back(18, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADVSCREENONLY__GDVPresetDef());
+    list.emplace_back(19, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVNTSCPresetDef());
+    list.emplace_back(20, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__GDVPresetDef());
+    list.emplace_back(21, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__0__SMOOTHADV__LCDGRIDPresetDef());
+    list.emplace_back(22, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVRESHADEFX__GDVPresetDef());
+    list.emplace_back(23, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(24, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADVSUPERXBR__GDVPresetDef());
+    list.emplace_back(25, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__EASYMODEPresetDef());
+    list.emplace_back(26, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMININTSCPresetDef());
+    list.emplace_back(27, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVMINIPresetDef());
+    list.emplace_back(28, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVNTSCPresetDef());
+    list.emplace_back(29, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__GDVPresetDef());
+    list.emplace_back(30, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__1__ADV__LCDGRIDPresetDef());
+    list.emplace_back(31, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSRESHADEFX__GDVPresetDef());
+    list.emplace_back(32, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(33, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASSSUPERXBR__GDVPresetDef());
+    list.emplace_back(34, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__EASYMODEPresetDef());
+    list.emplace_back(35, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMININTSCPresetDef());
+    list.emplace_back(36, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVMINIPresetDef());
+    list.emplace_back(37, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVNTSCPresetDef());
+    list.emplace_back(38, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__GDVPresetDef());
+    list.emplace_back(39, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVGLASS__LCDGRIDPresetDef());
+    list.emplace_back(40, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(41, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECTSUPERXBR__GDVPresetDef());
+    list.emplace_back(42, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVNTSCPresetDef());
+    list.emplace_back(43, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVNOREFLECT__GDVPresetDef());
+    list.emplace_back(44, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYNOTUBEFX__GDVPresetDef());
+    list.emplace_back(45, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(46, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLYSUPERXBR__GDVPresetDef());
+    list.emplace_back(47, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMININTSCPresetDef());
+    list.emplace_back(48, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVMINIPresetDef());
+    list.emplace_back(49, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVNTSCPresetDef());
+    list.emplace_back(50, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__2__ADVSCREENONLY__GDVPresetDef());
+    list.emplace_back(51, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(52, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASSSUPERXBR__GDVPresetDef());
+    list.emplace_back(53, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMININTSCPresetDef());
+    list.emplace_back(54, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVMINIPresetDef());
+    list.emplace_back(55, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVNTSCPresetDef());
+    list.emplace_back(56, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__GDVPresetDef());
+    list.emplace_back(57, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDGLASS__LCDGRIDPresetDef());
+    list.emplace_back(58, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(59, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STDSUPERXBR__GDVPresetDef());
+    list.emplace_back(60, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__EASYMODEPresetDef());
+    list.emplace_back(61, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMININTSCPresetDef());
+    list.emplace_back(62, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVMINIPresetDef());
+    list.emplace_back(63, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVNTSCPresetDef());
+    list.emplace_back(64, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__GDVPresetDef());
+    list.emplace_back(65, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__3__STD__LCDGRIDPresetDef());
+    list.emplace_back(66, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(67, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECTSUPERXBR__GDVPresetDef());
+    list.emplace_back(68, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__EASYMODEPresetDef());
+    list.emplace_back(69, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMININTSCPresetDef());
+    list.emplace_back(70, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVMINIPresetDef());
+    list.emplace_back(71, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVNTSCPresetDef());
+    list.emplace_back(72, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__GDVPresetDef());
+    list.emplace_back(73, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDNOREFLECT__LCDGRIDPresetDef());
+    list.emplace_back(74, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYNOTUBEFX__GDVPresetDef());
+    list.emplace_back(75, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(76, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLYSUPERXBR__GDVPresetDef());
+    list.emplace_back(77, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__EASYMODEPresetDef());
+    list.emplace_back(78, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMININTSCPresetDef());
+    list.emplace_back(79, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVMINIPresetDef());
+    list.emplace_back(80, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVNTSCPresetDef());
+    list.emplace_back(81, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__GDVPresetDef());
+    list.emplace_back(82, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__4__STDSCREENONLY__LCDGRIDPresetDef());
+    list.emplace_back(83, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVNTSCPresetDef());
+    list.emplace_back(84, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATOSUPERXBR__GDVPresetDef());
+    list.emplace_back(85, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__EASYMODEPresetDef());
+    list.emplace_back(86, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMININTSCPresetDef());
+    list.emplace_back(87, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVMINIPresetDef());
+    list.emplace_back(88, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVNTSCPresetDef());
+    list.emplace_back(89, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__GDVPresetDef());
+    list.emplace_back(90, new BezelMega_BezelPresetsBase_CRT_PresetsMBZ__5__POTATO__LCDGRIDPresetDef());
+    list.emplace_back(91, new BezelMega_BezelPresetsMegaBezel_ADVGLASSPresetDef());
+    list.emplace_back(92, new BezelMega_BezelPresetsMegaBezel_ADVNOREFLECTPresetDef());
+    list.emplace_back(93, new BezelMega_BezelPresetsMegaBezel_ADVPresetDef());
+    list.emplace_back(94, new BezelMega_BezelPresetsMegaBezel_POTATOPresetDef());
+    list.emplace_back(95, new BezelMega_BezelPresetsMegaBezel_SMOOTHADVGLASSPresetDef());
+    list.emplace_back(96, new BezelMega_BezelPresetsMegaBezel_SMOOTHADVPresetDef());
+    list.emplace_back(97, new BezelMega_BezelPresetsMegaBezel_STDGLASSPresetDef());
+    list.emplace_back(98, new BezelMega_BezelPresetsMegaBezel_STDNOREFLECTPresetDef());
+    list.emplace_back(99, new BezelMega_BezelPresetsMegaBezel_STDPresetDef());
+    list.emplace_back(100, new BezelUborderAmbientLightCrtPresetDef());
+    list.emplace_back(101, new BezelUborderUborderBezelReflectionsPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,100 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9x9ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseLinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterUpsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseDelinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsample_bloomShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterNaive_resampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterMoving_avgShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blendShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blend_fastShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blend_fastestShaderDef.h"
+#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussianSharpShaderDef.h"
+#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussianShaderDef.h"
+#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_horizontalSharpShaderDef.h"
+#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_verticalSharpShaderDef.h"
+#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_horizontalShaderDef.h"
+#include "RetroArch\blurs\shaders\gaussian_blur_filtering\BlursShadersGaussian_blur_filteringGaussian_verticalShaderDef.h"
+#include "RetroArch\blurs\shaders\gauss_4tap\BlursShadersGauss_4tapGauss_2tap_hShaderDef.h"
+#include "RetroArch\blurs\shaders\gauss_4tap\BlursShadersGauss_4tapGauss_2tap_vShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersGizmoBlurShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase0ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase1ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase2ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase3ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase4ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase5ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase6ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase7ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseScreen_combineShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersSharpsmootherShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersSmartBlurShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastHorizontalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastHorizontalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur43fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur43fastHorizontalShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersBlurGaussHShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersBlurGaussVShaderDef.h"
+#include "RetroArch\blurs\shaders\sunset_gaussian\BlursShadersSunset_gaussianSunset_horzShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\blurs\BlursDual_filter_2_passPresetDef.h"
+#include "RetroArch\blurs\BlursDual_filter_4_passPresetDef.h"
+#include "RetroArch\blurs\BlursDual_filter_6_passPresetDef.h"
+#include "RetroArch\blurs\BlursDual_filter_bloomPresetDef.h"
+#include "RetroArch\blurs\BlursDual_filter_bloom_fastPresetDef.h"
+#include "RetroArch\blurs\BlursDual_filter_bloom_fastestPresetDef.h"
+#include "RetroArch\blurs\BlursGaussian_blurSharpPresetDef.h"
+#include "RetroArch\blurs\BlursGaussian_blurPresetDef.h"
+#include "RetroArch\blurs\BlursGaussian_blur_2_passSharpPresetDef.h"
+#include "RetroArch\blurs\BlursGaussian_blur_2_passPresetDef.h"
+#include "RetroArch\blurs\BlursGauss_4tapPresetDef.h"
+#include "RetroArch\blurs\BlursGizmoCompositeBlurPresetDef.h"
+#include "RetroArch\blurs\BlursKawase_blur_5passPresetDef.h"
+#include "RetroArch\blurs\BlursKawase_blur_9passPresetDef.h"
+#include "RetroArch\blurs\BlursKawase_glowPresetDef.h"
+#include "RetroArch\blurs\BlursSharpsmootherPresetDef.h"
+#include "RetroArch\blurs\BlursSmartBlurPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddBlursPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(103, new BlursDual_filter_2_passPresetDef());
+    list.emplace_back(104, new BlursDual_filter_4_passPresetDef());
+    list.emplace_back(105, new BlursDual_filter_6_passPresetDef());
+    list.emplace_back(106, new BlursDual_filter_bloomPresetDef());
+    list.emplace_back(107, new BlursDual_filter_bloom_fastPresetDef());
+    list.emplace_back(108, new BlursDual_filter_bloom_fastestPresetDef());
+    list.emplace_back(109, new BlursGaussian_blurSharpPresetDef());
+    list.emplace_back(110, new BlursGaussian_blurPresetDef());
+    list.emplace_back(111, new BlursGaussian_blur_2_passSharpPresetDef());
+    list.emplace_back(112, new BlursGaussian_blur_2_passPresetDef());
+    list.emplace_back(113, new BlursGauss_4tapPresetDef());
+    list.emplace_back(114, new BlursGizmoCompositeBlurPresetDef());
+    list.emplace_back(115, new BlursKawase_blur_5passPresetDef());
+    list.emplace_back(116, new BlursKawase_blur_9passPresetDef());
+    list.emplace_back(117, new BlursKawase_glowPresetDef());
+    list.emplace_back(118, new BlursSharpsmootherPresetDef());
+    list.emplace_back(119, new BlursSmartBlurPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,178 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\border\shaders\BorderShadersAmbientGlowShaderDef.h"
+#include "RetroArch\border\shaders\autocrop-koko\BorderShadersAutocropKokoAutocrop0_precutShaderDef.h"
+#include "RetroArch\border\shaders\autocrop-koko\BorderShadersAutocropKokoAutocrop1_computeShaderDef.h"
+#include "RetroArch\border\shaders\autocrop-koko\BorderShadersAutocropKokoAutocrop2_displayShaderDef.h"
+#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_topShaderDef.h"
+#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_bottomShaderDef.h"
+#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_leftShaderDef.h"
+#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillCrop_and_sample_rightShaderDef.h"
+#include "RetroArch\border\shaders\average_fill\BorderShadersAverage_fillComposeShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersBigblurShaderDef.h"
+#include "RetroArch\border\shaders\blur_fill\BorderShadersBlur_fillRender_sampling_areasShaderDef.h"
+#include "RetroArch\border\shaders\blur_fill\BorderShadersBlur_fillComposeShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersEffectBorderIqShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersImgborderGbpShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersImgborderShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersLightgunBorderShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersImgborderSgbShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersImgborderSgbaShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\border\textures\BorderTexturesTex11TextureDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTextureDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbTextureDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaTextureDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgTextureDef.h"
+#include "RetroArch\border\textures\BorderTexturesPvmTextureDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbTextureDef.h"
+#include "RetroArch\border\sgba\BorderSgbaSgbaTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseLinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterUpsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseDelinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\gauss_4tap\BlursShadersGauss_4tapGauss_2tap_hShaderDef.h"
+#include "RetroArch\blurs\shaders\gauss_4tap\BlursShadersGauss_4tapGauss_2tap_vShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase0ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase1ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase2ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase3ShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersFeedbackShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtEasymodeShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtGeomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBrightpassShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleGeometryAaLastPassShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbaColorShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersTvoutTweaksShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersInterlacingShaderDef.h"
+#include "RetroArch\auto-box\AutoBoxBoxCenterShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtConsumerShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersDotShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-cgwg\HandheldShadersLcdCgwgLcdGridV2ShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcColorShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\border\BorderAmbientGlowPresetDef.h"
+#include "RetroArch\border\BorderAutocropKokoPresetDef.h"
+#include "RetroArch\border\BorderAverage_fillPresetDef.h"
+#include "RetroArch\border\BorderBigblurPresetDef.h"
+#include "RetroArch\border\BorderBlur_fillPresetDef.h"
+#include "RetroArch\border\BorderBlur_fill_stronger_blurPresetDef.h"
+#include "RetroArch\border\BorderBlur_fill_weaker_blurPresetDef.h"
+#include "RetroArch\border\BorderEffectBorderIqPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerCrtEasymodePresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerCrtGeom1xPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerCrtRoyalePresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerGbaColorCrtEasymodePresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerGbaColorPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutInterlacingPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutGbaColorInterlacingPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutGbaColorPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerTvoutPresetDef.h"
+#include "RetroArch\border\gameboy-player\BorderGameboyPlayerGameboyPlayerPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbCrtConsumerPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbDotPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbLcdGridV2PresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaCrtConsumerPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaDotPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaLcdGridV2PresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGbaPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgCrtConsumerPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgDotPresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgLcdGridV2PresetDef.h"
+#include "RetroArch\border\handheld-nebula\BorderHandheldNebulaHandheldNebulaGgPresetDef.h"
+#include "RetroArch\border\BorderImgborderPresetDef.h"
+#include "RetroArch\border\BorderLightgunBorderPresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbCrtEasymodePresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbCrtGeom1xPresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbCrtRoyalePresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbGbcColorTvoutInterlacingPresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbGbcColorPresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbTvoutInterlacingPresetDef.h"
+#include "RetroArch\border\sgb\BorderSgbSgbPresetDef.h"
+#include "RetroArch\border\sgba\BorderSgbaSgbaGbaColorPresetDef.h"
+#include "RetroArch\border\sgba\BorderSgbaSgbaTvoutInterlacingPresetDef.h"
+#include "RetroArch\border\sgba\BorderSgbaSgbaTvoutGbaColorInterlacingPresetDef.h"
+#include "RetroArch\border\sgba\BorderSgbaSgbaPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddBorderPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(120, new BorderAmbientGlowPresetDef());
+    list.emplace_back(121, new BorderAutocropKokoPresetDef());
+    list.emplace_back(122, new BorderAverage_fillPresetDef());
+    list.emplace_back(123, new BorderBigblurPresetDef());
+    list.emplace_back(124, new BorderBlur_fillPresetDef());
+    list.emplace_back(125, new BorderBlur_fill_stronger_blurPresetDef());
+    list.emplace_back(126, new BorderBlur_fill_weaker_blurPresetDef());
+    list.emplace_back(127, new BorderEffectBorderIqPresetDef());
+    list.emplace_back(128, new BorderGameboyPlayerGameboyPlayerCrtEasymodePresetDef());
+    list.emplace_back(129, new BorderGameboyPlayerGameboyPlayerCrtGeom1xPresetDef());
+    list.emplace_back(130, new BorderGameboyPlayerGameboyPlayerCrtRoyalePresetDef());
+    list.emplace_back(131, new BorderGameboyPlayerGameboyPlayerGbaColorCrtEasymodePresetDef());
+    list.emplace_back(132, new BorderGameboyPlayerGameboyPlayerGbaColorPresetDef());
+    list.emplace_back(133, new BorderGameboyPlayerGameboyPlayerTvoutInterlacingPresetDef());
+    list.emplace_back(134, new BorderGameboyPlayerGameboyPlayerTvoutGbaColorInterlacingPresetDef());
+    list.emplace_back(135, new BorderGameboyPlayerGameboyPlayerTvoutGbaColorPresetDef());
+    list.emplace_back(136, new BorderGameboyPlayerGameboyPlayerTvoutPresetDef());
+    list.emplace_back(137, new BorderGameboyPlayerGameboyPlayerPresetDef());
+    list.emplace_back(138, new BorderHandheldNebulaHandheldNebulaGbCrtConsumerPresetDef());
+    list.emplace_back(139, new BorderHandheldNebulaHandheldNebulaGbDotPresetDef());
+    list.emplace_back(140, new BorderHandheldNebulaHandheldNebulaGbLcdGridV2PresetDef());
+    list.emplace_back(141, new BorderHandheldNebulaHandheldNebulaGbPresetDef());
+    list.emplace_back(142, new BorderHandheldNebulaHandheldNebulaGbaCrtConsumerPresetDef());
+    list.emplace_back(143, new BorderHandheldNebulaHandheldNebulaGbaDotPresetDef());
+    list.emplace_back(144, new BorderHandheldNebulaHandheldNebulaGbaLcdGridV2PresetDef());
+    list.emplace_back(145, new BorderHandheldNebulaHandheldNebulaGbaPresetDef());
+    list.emplace_back(146, new BorderHandheldNebulaHandheldNebulaGgCrtConsumerPresetDef());
+    list.emplace_back(147, new BorderHandheldNebulaHandheldNebulaGgDotPresetDef());
+    list.emplace_back(148, new BorderHandheldNebulaHandheldNebulaGgLcdGridV2PresetDef());
+    list.emplace_back(149, new BorderHandheldNebulaHandheldNebulaGgPresetDef());
+    list.emplace_back(150, new BorderImgborderPresetDef());
+    list.emplace_back(151, new BorderLightgunBorderPresetDef());
+    list.emplace_back(152, new BorderSgbSgbCrtEasymodePresetDef());
+    list.emplace_back(153, new BorderSgbSgbCrtGeom1xPresetDef());
+    list.emplace_back(154, new BorderSgbSgbCrtRoyalePresetDef());
+    list.emplace_back(155, new BorderSgbSgbGbcColorTvoutInterlacingPresetDef());
+    list.emplace_back(156, new BorderSgbSgbGbcColorPresetDef());
+    list.emplace_back(157, new BorderSgbSgbTvoutInterlacingPresetDef());
+    list.emplace_back(158, new BorderSgbSgbPresetDef());
+    list.emplace_back(159, new BorderSgbaSgbaGbaColorPresetDef());
+    list.emplace_back(160, new BorderSgbaSgbaTvoutInterlacingPresetDef());
+    list.emplace_back(161, new BorderSgbaSgbaTvoutGbaColorInterlacingPresetDef());
+    list.emplace_back(162, new BorderSgbaSgbaPresetDef());
+// %PRESET_CLASS%
+}
+}
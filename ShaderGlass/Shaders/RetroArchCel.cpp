@@ -0,0 +1,38 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\cel\shaders\CelShadersAdvcartoonShaderDef.h"
+#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_ShaderShaderDef.h"
+#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_HShaderDef.h"
+#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_Blur_VShaderDef.h"
+#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_OutlineShaderDef.h"
+#include "RetroArch\cel\shaders\MMJ_Cel\CelShadersMMJ_CelMMJ_Cel_Shader_MP_ColorShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\cel\CelAdvcartoonPresetDef.h"
+#include "RetroArch\cel\CelMMJ_Cel_ShaderPresetDef.h"
+#include "RetroArch\cel\CelMMJ_Cel_Shader_MPPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddCelPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(163, new CelAdvcartoonPresetDef());
+    list.emplace_back(164, new CelMMJ_Cel_ShaderPresetDef());
+    list.emplace_back(165, new CelMMJ_Cel_Shader_MPPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,526 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\crt\shaders\CrtShadersCrtEasymodeShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtGeomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBrightpassShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleGeometryAaLastPassShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersTvoutTweaksShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtConsumerShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersAdvanced_CRT_shader_whkrmrgks0ShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilCopyShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilDownsample2xHorzShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilDownsample2xVertShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilTonemapAndDownsampleHorzShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilTonemapAndDownsampleVertShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilGaussianBlurHorzShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroUtilGaussianBlurVertShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroCrtGenerateMasksShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroCrtGenerateScreenTextureShaderDef.h"
+#include "RetroArch\crt\shaders\cathode-retro\CrtShadersCathodeRetroCathodeRetroCrtRgbToCrt_noSignalShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrt1tapShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtApertureShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtBlurPiShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtCaligariShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtCgwgFastShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtCyclonShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationBlur_vertShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationThresholdShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationCrtEasymodeHalationShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtFrutbunnShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtGdvMiniUltraShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtGdvMiniShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxePhosphor_applyShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxePhosphor_updateShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeGaussxShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeGaussyShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef.h"
+#include "RetroArch\crt\shaders\crt-consumer\CrtShadersCrtConsumerLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtGeomMiniShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastStockShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastPreShadersShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastBloom_horizontalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastBloom_verticalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastDeconvergenceFShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastPerfPassShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastPreShadersfShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastLinearizefShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass1fShaderDef.h"
+#include "RetroArch\crt\shaders\guest\fast\CrtShadersGuestFastCrtGuestAdvancedPass2fShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdStockShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdAfterglow0ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdPreShadersAfterglowShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdLinearizeHdShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdCrtGuestAdvancedHdPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdGaussian_horizontalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdGaussian_verticalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdBloom_horizontalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdBloom_verticalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdCrtGuestAdvancedHdPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\hd\CrtShadersGuestHdDeconvergenceHdShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedStockShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedAfterglow0ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedPreShadersAfterglowShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass3ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCustomFastSharpenShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedAvgLumNtscShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedLinearizeNtscShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCrtGuestAdvancedNtscPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedGaussian_verticalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedBloom_verticalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCrtGuestAdvancedNtscPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedDeconvergenceNtscShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedAvgLumShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedGaussian_horizontalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedBloom_horizontalShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedCrtGuestAdvancedShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\CrtShadersGuestAdvancedDeconvergenceShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllian3dShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianFastShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\CrtShadersHyllianSupportMultiLUTModifiedShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\ntsc\shaders\ntsc-adaptive-lite\CrtShadersHyllianSupportNtscShadersNtscAdaptiveLiteNtscLitePass1ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\ntsc\shaders\ntsc-adaptive-lite\CrtShadersHyllianSupportNtscShadersNtscAdaptiveLiteNtscLitePass2ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\CrtShadersHyllianSupportLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianSincPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\CrtShadersHyllianSupportMultiLUTLinearShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianBaseShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\glow\CrtShadersHyllianSupportGlowThresholdShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\glow\CrtShadersHyllianSupportGlowBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\glow\CrtShadersHyllianSupportGlowBlurGlowMaskGeomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-interlaced-halation\CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-interlaced-halation\CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-interlaced-halation\CrtShadersCrtInterlacedHalationCrtInterlacedHalationPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtLottesFastShaderDef.h"
+#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassBloompassShaderDef.h"
+#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassScanpassGlowShaderDef.h"
+#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassScanpassShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtLottesShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtMattiasShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcH_blurShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcResizeShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcCrt_reflectShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcBGcolor_pass1ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcBGcolor_pass2ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcImgborderShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcTv_reflectionShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcHorizontal_ringingShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcNtsc_pass1ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\src\CrtShadersCrtMaximusRoyaleSrcNtsc_pass2ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtNesMiniShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtNobodyShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtPiShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtPocketShaderDef.h"
+#include "RetroArch\crt\shaders\crt-potato\shader-files\CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef.h"
+#include "RetroArch\crt\shaders\crt-potato\shader-files\CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtResswitchGlitchKokoShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxFakeBloomIntelShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskFakeBloomIntelShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleGeometryAaLastPassIntelShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxFakeBloomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskFakeBloomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleMaskResizeVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleMaskResizeHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBrightpassShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxIntelShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskIntelShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtSimpleShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtSinesShaderDef.h"
+#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestCubicShaderDef.h"
+#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestScanlineShaderDef.h"
+#include "RetroArch\crt\shaders\crt-slangtest\CrtShadersCrtSlangtestSincShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrSuperXbrPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrSuperXbrPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrSuperXbrPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCustomBicubicXShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCustomBicubicYShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCrtCustomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrThresholdShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrBlur_vertShaderDef.h"
+#include "RetroArch\crt\shaders\crt-super-xbr\CrtShadersCrtSuperXbrCustomResolveShaderDef.h"
+#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleScanlineInterpolationShaderDef.h"
+#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleScanlineSimpleShaderDef.h"
+#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleBrightenShaderDef.h"
+#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleSunsetGaussianVertShaderDef.h"
+#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleSunsetGaussianHorizShaderDef.h"
+#include "RetroArch\crt\shaders\torridgristle\CrtShadersTorridgristleCandyBloomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6CrtYo6FlatTrinitronTvShaderDef.h"
+#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6CrtYo6NativeResolutionShaderDef.h"
+#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6CrtYo6WarpShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowGauss_horizShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowGauss_vertShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowThresholdShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowBlur_vertShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowResolveShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowLanczos_horizShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimCompositeShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimScreenShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPostDownsampleShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPostUpsampleShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPresentShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersFakeCrtGeomPotatoShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersFakeCrtGeomShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersFakelottesShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersGizmoCrtShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersGizmoSlotmaskCrtShaderDef.h"
+#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsGlowTrails0ShaderDef.h"
+#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsGlowTrails1ShaderDef.h"
+#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesGritsScanlinesShaderDef.h"
+#include "RetroArch\crt\shaders\gtu-v050\CrtShadersGtuV050Pass1ShaderDef.h"
+#include "RetroArch\crt\shaders\gtu-v050\CrtShadersGtuV050Pass2ShaderDef.h"
+#include "RetroArch\crt\shaders\gtu-v050\CrtShadersGtuV050Pass3ShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_ntsc_encodeShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_ntsc_decodeShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_colorShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_prescaleShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_deconvergeShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_scanlineShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_defocusShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_postShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_phosphorShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_chromaShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_distortionShaderDef.h"
+#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtBufCShaderDef.h"
+#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtBufDShaderDef.h"
+#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtImageShaderDef.h"
+#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieAccumulateShaderDef.h"
+#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieBlur_vertShaderDef.h"
+#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieNewpixieCrtShaderDef.h"
+#include "RetroArch\crt\shaders\newpixie-mini\CrtShadersNewpixieMiniNewpixieMiniShaderDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutScanlinesInterlaceLinearizeShaderDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutPhosphorlutPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutPhosphorlutPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\rt_curvature\CrtShadersRt_curvatureRt_curvatureShaderDef.h"
+#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsCombineShaderDef.h"
+#include "RetroArch\crt\shaders\vt220\CrtShadersVt220Vt220ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersYee64ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersYeetronShaderDef.h"
+#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_compositeShaderDef.h"
+#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_curvatureShaderDef.h"
+#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_geoShaderDef.h"
+#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_coarsemaskShaderDef.h"
+#include "RetroArch\crt\shaders\zfast_crt\CrtShadersZfast_crtZfast_crt_finemaskShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersDotmaskShaderDef.h"
+#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassBloompassGlowShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersSnesHiresBlendShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersSlotmaskShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef.h"
+#include "RetroArch\crt\shaders\crt-consumer\CrtShadersCrtConsumerBezelTextureDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutTrinitronLutTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutNecLutTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutNtscLutTextureDef.h"
+#include "RetroArch\crt\shaders\hyllian\support\LUT\CrtShadersHyllianSupportLUTSomeGradeTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1TextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2TextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3TextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_bgTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_bgTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_2_ledTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_ledTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_1_lights_alphaTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9TV_frame_3_lights_alphaTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frameTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9MONITOR_frame_lights_alphaTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_1_shapeTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\FrameTextures\16_9\CrtShadersCrtMaximusRoyaleFrameTextures16_9Frame_2_shapeTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor128pxHTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphor512pxHTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix128pxHTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorMatrix512pxHTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots128pxHTextureDef.h"
+#include "RetroArch\crt\shaders\crt-maximus-royale\TilePhosphorTextures\CrtShadersCrtMaximusRoyaleTilePhosphorTexturesTilePhosphorDots512pxHTextureDef.h"
+#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesMask1TextureDef.h"
+#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesCrtPotatoThinTextureDef.h"
+#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64BGRshiftedTextureDef.h"
+#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6PhosphorFlatTrinitronTvTextureDef.h"
+#include "RetroArch\crt\shaders\crt-yo6\CrtShadersCrtYo6KVM1420BTextureDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimArtifactsTextureDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimMaskTextureDef.h"
+#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesScanlineLUT4pxTextureDef.h"
+#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesTrinitron_colorTextureDef.h"
+#include "RetroArch\crt\shaders\GritsScanlines\CrtShadersGritsScanlinesFakeSelfIlluminationTextureDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\resources\CrtShadersMame_hlslResourcesApertureGrilleTextureDef.h"
+#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtBasilicaTextureDef.h"
+#include "RetroArch\crt\shaders\metacrt\CrtShadersMetacrtWoodgrainTextureDef.h"
+#include "RetroArch\crt\shaders\newpixie\CrtShadersNewpixieCrtframeTextureDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsShadowmaskTextureDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsApertureGrilleTextureDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsSlotmaskTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersAdvancedAaShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersFxaaShaderDef.h"
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseLinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterUpsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseDelinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsample_bloomShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterNaive_resampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterMoving_avgShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blendShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blend_fastShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastHorizontalShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersRcasShaderDef.h"
+#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayBlendoverlayShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersJinc2ShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastHorizontalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur43fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur43fastHorizontalShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeRgbTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeCompositeTextureDef.h"
+#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayShadowmask4x4TextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\crt\CrtAdvanced_crt_whkrmrgks0PresetDef.h"
+#include "RetroArch\crt\CrtCathodeRetro_noSignalPresetDef.h"
+#include "RetroArch\crt\CrtCrt1tapBloomPresetDef.h"
+#include "RetroArch\crt\CrtCrt1tapBloom_fastPresetDef.h"
+#include "RetroArch\crt\CrtCrt1tapPresetDef.h"
+#include "RetroArch\crt\CrtCrtAperturePresetDef.h"
+#include "RetroArch\crt\CrtCrtBlurPiSharpPresetDef.h"
+#include "RetroArch\crt\CrtCrtBlurPiSoftPresetDef.h"
+#include "RetroArch\crt\CrtCrtCaligariPresetDef.h"
+#include "RetroArch\crt\CrtCrtCgwgFastPresetDef.h"
+#include "RetroArch\crt\CrtCrtConsumerPresetDef.h"
+#include "RetroArch\crt\CrtCrtCyclonPresetDef.h"
+#include "RetroArch\crt\CrtCrtEasymodeHalationPresetDef.h"
+#include "RetroArch\crt\CrtCrtEasymodePresetDef.h"
+#include "RetroArch\crt\CrtCrtFrutbunnPresetDef.h"
+#include "RetroArch\crt\CrtCrtGdvMiniUltraTrinitronPresetDef.h"
+#include "RetroArch\crt\CrtCrtGdvMiniPresetDef.h"
+#include "RetroArch\crt\CrtCrtGeomDeluxePresetDef.h"
+#include "RetroArch\crt\CrtCrtGeomMiniPresetDef.h"
+#include "RetroArch\crt\CrtCrtGeomTatePresetDef.h"
+#include "RetroArch\crt\CrtCrtGeomPresetDef.h"
+#include "RetroArch\crt\CrtCrtGuestAdvancedFastPresetDef.h"
+#include "RetroArch\crt\CrtCrtGuestAdvancedFastestPresetDef.h"
+#include "RetroArch\crt\CrtCrtGuestAdvancedHdPresetDef.h"
+#include "RetroArch\crt\CrtCrtGuestAdvancedNtscPresetDef.h"
+#include "RetroArch\crt\CrtCrtGuestAdvancedPresetDef.h"
+#include "RetroArch\crt\CrtCrtHyllian3dPresetDef.h"
+#include "RetroArch\crt\CrtCrtHyllianFastPresetDef.h"
+#include "RetroArch\crt\CrtCrtHyllianNtscRainbowPresetDef.h"
+#include "RetroArch\crt\CrtCrtHyllianNtscPresetDef.h"
+#include "RetroArch\crt\CrtCrtHyllianSincCompositePresetDef.h"
+#include "RetroArch\crt\CrtCrtHyllianPresetDef.h"
+#include "RetroArch\crt\CrtCrtInterlacedHalationPresetDef.h"
+#include "RetroArch\crt\CrtCrtLottesFastPresetDef.h"
+#include "RetroArch\crt\CrtCrtLottesMultipassGlowPresetDef.h"
+#include "RetroArch\crt\CrtCrtLottesMultipassPresetDef.h"
+#include "RetroArch\crt\CrtCrtLottesPresetDef.h"
+#include "RetroArch\crt\CrtCrtMattiasPresetDef.h"
+#include "RetroArch\crt\CrtCrtMaximusRoyaleFastModePresetDef.h"
+#include "RetroArch\crt\CrtCrtMaximusRoyaleHalfResModePresetDef.h"
+#include "RetroArch\crt\CrtCrtMaximusRoyalePresetDef.h"
+#include "RetroArch\crt\CrtCrtNesMiniPresetDef.h"
+#include "RetroArch\crt\CrtCrtNobodyPresetDef.h"
+#include "RetroArch\crt\CrtCrtPiPresetDef.h"
+#include "RetroArch\crt\CrtCrtPocketPresetDef.h"
+#include "RetroArch\crt\CrtCrtPotatoBVMPresetDef.h"
+#include "RetroArch\crt\CrtCrtPotatoCoolPresetDef.h"
+#include "RetroArch\crt\CrtCrtPotatoWarmPresetDef.h"
+#include "RetroArch\crt\CrtCrtResswitchGlitchKokoPresetDef.h"
+#include "RetroArch\crt\CrtCrtRoyaleFakeBloomIntelPresetDef.h"
+#include "RetroArch\crt\CrtCrtRoyaleFakeBloomPresetDef.h"
+#include "RetroArch\crt\CrtCrtRoyaleFastPresetDef.h"
+#include "RetroArch\crt\CrtCrtRoyaleIntelPresetDef.h"
+#include "RetroArch\crt\CrtCrtRoyalePresetDef.h"
+#include "RetroArch\crt\CrtCrtSimplePresetDef.h"
+#include "RetroArch\crt\CrtCrtSinesPresetDef.h"
+#include "RetroArch\crt\CrtCrtSlangtestCubicPresetDef.h"
+#include "RetroArch\crt\CrtCrtSlangtestLanczosPresetDef.h"
+#include "RetroArch\crt\CrtCrtSuperXbrPresetDef.h"
+#include "RetroArch\crt\CrtCrtTorridgristlePresetDef.h"
+#include "RetroArch\crt\CrtCrtYo6FlatTrinitronTvPresetDef.h"
+#include "RetroArch\crt\CrtCrtYo6KV21CL10BPresetDef.h"
+#include "RetroArch\crt\CrtCrtYo6KVM1420BSharpPresetDef.h"
+#include "RetroArch\crt\CrtCrtYo6KVM1420BPresetDef.h"
+#include "RetroArch\crt\CrtCrtglow_gaussPresetDef.h"
+#include "RetroArch\crt\CrtCrtglow_lanczosPresetDef.h"
+#include "RetroArch\crt\CrtCrtsimPresetDef.h"
+#include "RetroArch\crt\CrtFakeCrtGeomPotatoPresetDef.h"
+#include "RetroArch\crt\CrtFakeCrtGeomPresetDef.h"
+#include "RetroArch\crt\CrtFakelottesPresetDef.h"
+#include "RetroArch\crt\CrtGizmoCrtPresetDef.h"
+#include "RetroArch\crt\CrtGizmoSlotmaskCrtPresetDef.h"
+#include "RetroArch\crt\CrtGlow_trailsPresetDef.h"
+#include "RetroArch\crt\CrtGritsScanlinesPresetDef.h"
+#include "RetroArch\crt\CrtGtuV050PresetDef.h"
+#include "RetroArch\crt\CrtMame_hlslPresetDef.h"
+#include "RetroArch\crt\CrtMetacrtPresetDef.h"
+#include "RetroArch\crt\CrtNewpixieCrtPresetDef.h"
+#include "RetroArch\crt\CrtNewpixieMiniPresetDef.h"
+#include "RetroArch\crt\CrtPhosphorlutPresetDef.h"
+#include "RetroArch\crt\CrtRay_traced_curvaturePresetDef.h"
+#include "RetroArch\crt\CrtRay_traced_curvature_appendPresetDef.h"
+#include "RetroArch\crt\CrtTvoutTweaksPresetDef.h"
+#include "RetroArch\crt\CrtVectorGlowAltRenderPresetDef.h"
+#include "RetroArch\crt\CrtVectorGlowPresetDef.h"
+#include "RetroArch\crt\CrtVt220PresetDef.h"
+#include "RetroArch\crt\CrtYee64PresetDef.h"
+#include "RetroArch\crt\CrtYeetronPresetDef.h"
+#include "RetroArch\crt\CrtZfastCrtCompositePresetDef.h"
+#include "RetroArch\crt\CrtZfastCrtCurvaturePresetDef.h"
+#include "RetroArch\crt\CrtZfastCrtGeoPresetDef.h"
+#include "RetroArch\crt\CrtZfastCrtHdmaskPresetDef.h"
+#include "RetroArch\crt\CrtZfastCrtPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddCrtPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(166, new CrtAdvanced_crt_whkrmrgks0PresetDef());
+    list.emplace_back(167, new CrtCathodeRetro_noSignalPresetDef());
+    list.emplace_back(168, new CrtCrt1tapBloomPresetDef());
+    list.emplace_back(169, new CrtCrt1tapBloom_fastPresetDef());
+    list.emplace_back(170, new CrtCrt1tapPresetDef());
+    list.emplace_back(171, new CrtCrtAperturePresetDef());
+    list.emplace_back(172, new CrtCrtBlurPiSharpPresetDef());
+    list.emplace_back(173, new CrtCrtBlurPiSoftPresetDef());
+    list.emplace_back(174, new CrtCrtCaligariPresetDef());
+    list.emplace_back(175, new CrtCrtCgwgFastPresetDef());
+    list.emplace_back(176, new CrtCrtConsumerPresetDef());
+    list.emplace_back(177, new CrtCrtCyclonPresetDef());
+    list.emplace_back(178, new CrtCrtEasymodeHalationPresetDef());
+    list.emplace_back(179, new CrtCrtEasymodePresetDef());
+    list.emplace_back(180, new CrtCrtFrutbunnPresetDef());
+    list.emplace_back(181, new CrtCrtGdvMiniUltraTrinitronPresetDef());
+    list.emplace_back(182, new CrtCrtGdvMiniPresetDef());
+    list.emplace_back(183, new CrtCrtGeomDeluxePresetDef());
+    list.emplace_back(184, new CrtCrtGeomMiniPresetDef());
+    list.emplace_back(185, new CrtCrtGeomTatePresetDef());
+    list.emplace_back(186, new CrtCrtGeomPresetDef());
+    list.emplace_back(187, new CrtCrtGuestAdvancedFastPresetDef());
+    list.emplace_back(188, new CrtCrtGuestAdvancedFastestPresetDef());
+    list.emplace_back(189, new CrtCrtGuestAdvancedHdPresetDef());
+    list.emplace_back(190, new CrtCrtGuestAdvancedNtscPresetDef());
+    list.emplace_back(191, new CrtCrtGuestAdvancedPresetDef());
+    list.emplace_back(192, new CrtCrtHyllian3dPresetDef());
+    list.emplace_back(193, new CrtCrtHyllianFastPresetDef());
+    list.emplace_back(194, new CrtCrtHyllianNtscRainbowPresetDef());
+    list.emplace_back(195, new CrtCrtHyllianNtscPresetDef());
+    list.emplace_back(196, new CrtCrtHyllianSincCompositePresetDef());
+    list.emplace_back(197, new CrtCrtHyllianPresetDef());
+    list.emplace_back(198, new CrtCrtInterlacedHalationPresetDef());
+    list.emplace_back(199, new CrtCrtLottesFastPresetDef());
+    list.emplace_back(200, new CrtCrtLottesMultipassGlowPresetDef());
+    list.emplace_back(201, new CrtCrtLottesMultipassPresetDef());
+    list.emplace_back(202, new CrtCrtLottesPresetDef());
+    list.emplace_back(203, new CrtCrtMattiasPresetDef());
+    list.emplace_back(204, new CrtCrtMaximusRoyaleFastModePresetDef());
+    list.emplace_back(205, new CrtCrtMaximusRoyaleHalfResModePresetDef());
+    list.emplace_back(206, new CrtCrtMaximusRoyalePresetDef());
+    list.emplace_back(207, new CrtCrtNesMiniPresetDef());
+    list.emplace_back(208, new CrtCrtNobodyPresetDef());
+    list.emplace_back(209, new CrtCrtPiPresetDef());
+    list.emplace_back(210, new CrtCrtPocketPresetDef());
+    list.emplace_back(211, new CrtCrtPotatoBVMPresetDef());
+    list.emplace_back(212, new CrtCrtPotatoCoolPresetDef());
+    list.emplace_back(213, new CrtCrtPotatoWarmPresetDef());
+    list.emplace_back(214, new CrtCrtResswitchGlitchKokoPresetDef());
+    list.emplace_back(215, new CrtCrtRoyaleFakeBloomIntelPresetDef());
+    list.emplace_back(216, new CrtCrtRoyaleFakeBloomPresetDef());
+    list.emplace_back(217, new CrtCrtRoyaleFastPresetDef());
+    list.emplace_back(218, new CrtCrtRoyaleIntelPresetDef());
+    list.emplace_back(219, new CrtCrtRoyalePresetDef());
+    list.emplace_back(220, new CrtCrtSimplePresetDef());
+    list.emplace_back(221, new CrtCrtSinesPresetDef());
+    list.emplace_back(222, new CrtCrtSlangtestCubicPresetDef());
+    list.emplace_back(223, new CrtCrtSlangtestLanczosPresetDef());
+    list.emplace_back(224, new CrtCrtSuperXbrPresetDef());
+    list.emplace_back(225, new CrtCrtTorridgristlePresetDef());
+    list.emplace_back(226, new CrtCrtYo6FlatTrinitronTvPresetDef());
+    list.emplace_back(227, new CrtCrtYo6KV21CL10BPresetDef());
+    list.emplace_back(228, new CrtCrtYo6KVM1420BSharpPresetDef());
+    list.emplace_back(229, new CrtCrtYo6KVM1420BPresetDef());
+    list.emplace_back(230, new CrtCrtglow_gaussPresetDef());
+    list.emplace_back(231, new CrtCrtglow_lanczosPresetDef());
+    list.emplace_back(232, new CrtCrtsimPresetDef());
+    list.emplace_back(233, new CrtFakeCrtGeomPotatoPresetDef());
+    list.emplace_back(234, new CrtFakeCrtGeomPresetDef());
+    list.emplace_back(235, new CrtFakelottesPresetDef());
+    list.emplace_back(236, new CrtGizmoCrtPresetDef());
+    list.emplace_back(237, new CrtGizmoSlotmaskCrtPresetDef());
+    list.emplace_back(238, new CrtGlow_trailsPresetDef());
+    list.emplace_back(239, new CrtGritsScanlinesPresetDef());
+    list.emplace_back(240, new CrtGtuV050PresetDef());
+    list.emplace_back(241, new CrtMame_hlslPresetDef());
+    list.emplace_back(242, new CrtMetacrtPresetDef());
+    list.emplace_back(243, new CrtNewpixieCrtPresetDef());
+    list.emplace_back(244, new CrtNewpixieMiniPresetDef());
+    list.emplace_back(245, new CrtPhosphorlutPresetDef());
+    list.emplace_back(246, new CrtRay_traced_curvaturePresetDef());
+    list.emplace_back(247, new CrtRay_traced_curvature_appendPresetDef());
+    list.emplace_back(248, new CrtTvoutTweaksPresetDef());
+    list.emplace_back(249, new CrtVectorGlowAltRenderPresetDef());
+    list.emplace_back(250, new CrtVectorGlowPresetDef());
+    list.emplace_back(251, new CrtVt220PresetDef());
+    list.emplace_back(252, new CrtYee64PresetDef());
+    list.emplace_back(253, new CrtYeetronPresetDef());
+    list.emplace_back(254, new CrtZfastCrtCompositePresetDef());
+    list.emplace_back(255, new CrtZfastCrtCurvaturePresetDef());
+    list.emplace_back(256, new CrtZfastCrtGeoPresetDef());
+    list.emplace_back(257, new CrtZfastCrtHdmaskPresetDef());
+    list.emplace_back(258, new CrtZfastCrtPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,31 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\deblur\shaders\DeblurShadersDeblurLumaShaderDef.h"
+#include "RetroArch\deblur\shaders\DeblurShadersDeblurShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\deblur\DeblurDeblurLumaPresetDef.h"
+#include "RetroArch\deblur\DeblurDeblurPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddDeblurPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(259, new DeblurDeblurLumaPresetDef());
+    list.emplace_back(260, new DeblurDeblurPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,52 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\denoisers\shaders\DenoisersShadersBilateralHorizontalShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersBilateralVerticalShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersBilateralShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersFastBilateralShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersMedian_3x3ShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersMedian_5x5ShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersSlowBilateralShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass1ShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersJinc2ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass0ShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\denoisers\DenoisersBilateral2pPresetDef.h"
+#include "RetroArch\denoisers\DenoisersBilateralPresetDef.h"
+#include "RetroArch\denoisers\DenoisersCrtFastBilateralSuperXbrPresetDef.h"
+#include "RetroArch\denoisers\DenoisersFastBilateralPresetDef.h"
+#include "RetroArch\denoisers\DenoisersMedian_3x3PresetDef.h"
+#include "RetroArch\denoisers\DenoisersMedian_5x5PresetDef.h"
+#include "RetroArch\denoisers\DenoisersSlowBilateralPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddDenoisersPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(261, new DenoisersBilateral2pPresetDef());
+    list.emplace_back(262, new DenoisersBilateralPresetDef());
+    list.emplace_back(263, new DenoisersCrtFastBilateralSuperXbrPresetDef());
+    list.emplace_back(264, new DenoisersFastBilateralPresetDef());
+    list.emplace_back(265, new DenoisersMedian_3x3PresetDef());
+    list.emplace_back(266, new DenoisersMedian_5x5PresetDef());
+    list.emplace_back(267, new DenoisersSlowBilateralPresetDef());
+// %PRESET_CLASS%
+}
+}
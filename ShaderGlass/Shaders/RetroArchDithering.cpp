@@ -0,0 +1,91 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\dithering\shaders\DitheringShadersBayerMatrixDitheringShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersBayer_4x4ShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersBlue_noiseShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersBlue_noise_dynamicShaderDef.h"
+#include "RetroArch\dithering\shaders\cbod-v1\DitheringShadersCbodV1CbodV1Pass1ShaderDef.h"
+#include "RetroArch\dithering\shaders\cbod-v1\DitheringShadersCbodV1CbodV1Pass2ShaderDef.h"
+#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherLinearizeShaderDef.h"
+#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherCheckerboardDeditherPass1ShaderDef.h"
+#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherCheckerboardDeditherPass2ShaderDef.h"
+#include "RetroArch\dithering\shaders\checkerboard-dedither\DitheringShadersCheckerboardDeditherCheckerboardDeditherPass3ShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersGSharp_resamplerShaderDef.h"
+#include "RetroArch\dithering\shaders\gdapt\DitheringShadersGdaptGdaptPass0ShaderDef.h"
+#include "RetroArch\dithering\shaders\gdapt\DitheringShadersGdaptGdaptPass1ShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersGenditherShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersJinc2DeditherShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass0ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass1ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass2ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass3ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass4ShaderDef.h"
+#include "RetroArch\dithering\shaders\ps1dither\DitheringShadersPs1ditherPS1UnditherBoxBlurShaderDef.h"
+#include "RetroArch\dithering\shaders\ps1dither\DitheringShadersPs1ditherPS1UnditherAntiBayerShaderDef.h"
+#include "RetroArch\dithering\shaders\ps1dither\DitheringShadersPs1ditherPS1UnditherComparisonMkIIShaderDef.h"
+#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixLinearizeShaderDef.h"
+#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass1ShaderDef.h"
+#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass2ShaderDef.h"
+#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass3ShaderDef.h"
+#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass4ShaderDef.h"
+#include "RetroArch\dithering\shaders\sgenpt-mix\DitheringShadersSgenptMixSgenptMixPass5ShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersSgenptMixShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\dithering\shaders\blue-noise\DitheringShadersBlueNoiseLDR_RGB1_0TextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\dithering\DitheringBayerMatrixDitheringPresetDef.h"
+#include "RetroArch\dithering\DitheringBayer_4x4PresetDef.h"
+#include "RetroArch\dithering\DitheringBlue_noisePresetDef.h"
+#include "RetroArch\dithering\DitheringBlue_noise_dynamic_4BitPresetDef.h"
+#include "RetroArch\dithering\DitheringBlue_noise_dynamic_monochromePresetDef.h"
+#include "RetroArch\dithering\DitheringCbod_v1PresetDef.h"
+#include "RetroArch\dithering\DitheringCheckerboardDeditherPresetDef.h"
+#include "RetroArch\dithering\DitheringGSharp_resamplerPresetDef.h"
+#include "RetroArch\dithering\DitheringGdaptPresetDef.h"
+#include "RetroArch\dithering\DitheringGenditherPresetDef.h"
+#include "RetroArch\dithering\DitheringJinc2DeditherPresetDef.h"
+#include "RetroArch\dithering\DitheringMdaptPresetDef.h"
+#include "RetroArch\dithering\DitheringPs1DeditherBoxblurPresetDef.h"
+#include "RetroArch\dithering\DitheringPs1DeditherComparisonPresetDef.h"
+#include "RetroArch\dithering\DitheringPs1DitherPresetDef.h"
+#include "RetroArch\dithering\DitheringSgenptMixMultipassPresetDef.h"
+#include "RetroArch\dithering\DitheringSgenptMixPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddDitheringPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(268, new DitheringBayerMatrixDitheringPresetDef());
+    list.emplace_back(269, new DitheringBayer_4x4PresetDef());
+    list.emplace_back(270, new DitheringBlue_noisePresetDef());
+    list.emplace_back(271, new DitheringBlue_noise_dynamic_4BitPresetDef());
+    list.emplace_back(272, new DitheringBlue_noise_dynamic_monochromePresetDef());
+    list.emplace_back(273, new DitheringCbod_v1PresetDef());
+    list.emplace_back(274, new DitheringCheckerboardDeditherPresetDef());
+    list.emplace_back(275, new DitheringGSharp_resamplerPresetDef());
+    list.emplace_back(276, new DitheringGdaptPresetDef());
+    list.emplace_back(277, new DitheringGenditherPresetDef());
+    list.emplace_back(278, new DitheringJinc2DeditherPresetDef());
+    list.emplace_back(279, new DitheringMdaptPresetDef());
+    list.emplace_back(280, new DitheringPs1DeditherBoxblurPresetDef());
+    list.emplace_back(281, new DitheringPs1DeditherComparisonPresetDef());
+    list.emplace_back(282, new DitheringPs1DitherPresetDef());
+    list.emplace_back(283, new DitheringSgenptMixMultipassPresetDef());
+    list.emplace_back(284, new DitheringSgenptMixPresetDef());
+// %PRESET_CLASS%
+}
+}
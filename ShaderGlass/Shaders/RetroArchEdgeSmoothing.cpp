@@ -0,0 +1,295 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\cleanEdge\shaders\EdgeSmoothingCleanEdgeShadersCleanEdgeScaleShaderDef.h"
+#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShaders3PointShaderDef.h"
+#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersCutShaderDef.h"
+#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtExtendedShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportLinearizeShaderDef.h"
+#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtJincShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportDelinearizeShaderDef.h"
+#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtXbrLv1ShaderDef.h"
+#include "RetroArch\edge-smoothing\ddt\shaders\EdgeSmoothingDdtShadersDdtShaderDef.h"
+#include "RetroArch\edge-smoothing\eagle\shaders\EdgeSmoothingEagleShaders2xsaiShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2CshiftRgbShaderDef.h"
+#include "RetroArch\edge-smoothing\eagle\shaders\EdgeSmoothingEagleShadersSuper2xsaiShaderDef.h"
+#include "RetroArch\edge-smoothing\eagle\shaders\EdgeSmoothingEagleShadersSupereagleShaderDef.h"
+#include "RetroArch\edge-smoothing\fsr\shaders\EdgeSmoothingFsrShadersFsrPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\fsr\shaders\EdgeSmoothingFsrShadersFsrPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq2xHalphonShaderDef.h"
+#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq2xShaderDef.h"
+#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq3xShaderDef.h"
+#include "RetroArch\edge-smoothing\hqx\shaders\EdgeSmoothingHqxShadersHq4xShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediJincShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediHybridPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediHybridPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediHybridPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersRgbToYuvShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass2LumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2CshiftLumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2OnPassoutput0ShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersYuvToRgb2xShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1RgbShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass2RgbShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersYuvToRgb4xShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass1RgbShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass2RgbShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass1LumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns32Win8x4Pass2LumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2OnPassoutput3ShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns64Win8x4Pass1RgbShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns64Win8x4Pass2RgbShaderDef.h"
+#include "RetroArch\edge-smoothing\omniscale\shaders\EdgeSmoothingOmniscaleShadersOmniscaleLegacyShaderDef.h"
+#include "RetroArch\edge-smoothing\omniscale\shaders\EdgeSmoothingOmniscaleShadersOmniscaleShaderDef.h"
+#include "RetroArch\edge-smoothing\sabr\shaders\EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef.h"
+#include "RetroArch\edge-smoothing\sabr\shaders\EdgeSmoothingSabrShadersSabrV30ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass3ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass4ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass4HybridShaderDef.h"
+#include "RetroArch\edge-smoothing\scalehq\shaders\EdgeSmoothingScalehqShaders2xScaleHQShaderDef.h"
+#include "RetroArch\edge-smoothing\scalehq\shaders\EdgeSmoothingScalehqShaders4xScaleHQShaderDef.h"
+#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersEpxShaderDef.h"
+#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersMmpxShaderDef.h"
+#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale2xShaderDef.h"
+#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale2xplusShaderDef.h"
+#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale2xSFXShaderDef.h"
+#include "RetroArch\edge-smoothing\scalenx\shaders\EdgeSmoothingScalenxShadersScale3xShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrFastPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrCustomJinc2SharperShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv2-multipass\EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv2-multipass\EdgeSmoothingXbrShadersXbrLv2MultipassXbrLv2Pass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportBSplineXShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportBSplineYShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass1bShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders2xbrzShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders4xbrzShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders5xbrzShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShaders6xbrzShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\xbrz-freescale-multipass\EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\xbrz-freescale-multipass\EdgeSmoothingXbrzShadersXbrzFreescaleMultipassXbrzFreescalePass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbrz\shaders\EdgeSmoothingXbrzShadersXbrzFreescaleShaderDef.h"
+#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2ShaderDef.h"
+#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalShaderDef.h"
+#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2Pass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2HqShaderDef.h"
+#include "RetroArch\edge-smoothing\xsoft\shaders\EdgeSmoothingXsoftShaders4xsoftShaderDef.h"
+#include "RetroArch\edge-smoothing\xsoft\shaders\EdgeSmoothingXsoftShaders4xsoftSdBShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1bShaderDef.h"
+#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\edge-smoothing\hqx\resources\EdgeSmoothingHqxResourcesHq2xTextureDef.h"
+#include "RetroArch\edge-smoothing\hqx\resources\EdgeSmoothingHqxResourcesHq3xTextureDef.h"
+#include "RetroArch\edge-smoothing\hqx\resources\EdgeSmoothingHqxResourcesHq4xTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicXShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicYShaderDef.h"
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass0ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass1ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass2ShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersJinc2ShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersFastBilateralShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersSlowBilateralShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBSplineXShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBSplineYShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersCheapSharpenShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersVhsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersNaturalVisionShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersVibrancePassSh1nra358ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass0ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersDotmaskShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline16XShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline16YShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaAreaTexTextureDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSearchTexTextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\edge-smoothing\cleanEdge\EdgeSmoothingCleanEdgeCleanEdgeScalePresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdt3PointPresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtCutPresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtExtendedPresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtJincLinearPresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtJincPresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtXbrLv1PresetDef.h"
+#include "RetroArch\edge-smoothing\ddt\EdgeSmoothingDdtDdtPresetDef.h"
+#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagle2xsaiFixPixelShiftPresetDef.h"
+#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagle2xsaiPresetDef.h"
+#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagleSuper2xsaiFixPixelShiftPresetDef.h"
+#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagleSuper2xsaiPresetDef.h"
+#include "RetroArch\edge-smoothing\eagle\EdgeSmoothingEagleSupereaglePresetDef.h"
+#include "RetroArch\edge-smoothing\fsr\EdgeSmoothingFsrFsrEasuPresetDef.h"
+#include "RetroArch\edge-smoothing\fsr\EdgeSmoothingFsrFsrPresetDef.h"
+#include "RetroArch\edge-smoothing\fsr\EdgeSmoothingFsrSmaaFsrPresetDef.h"
+#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq2xHalphonPresetDef.h"
+#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq2xPresetDef.h"
+#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq3xPresetDef.h"
+#include "RetroArch\edge-smoothing\hqx\EdgeSmoothingHqxHq4xPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediFastBilateralNediPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediHybridSharperPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediHybridPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediSharperPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\EdgeSmoothingNediNediPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariantPresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant2PresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant3PresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant4PresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant5PresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant6PresetDef.h"
+#include "RetroArch\edge-smoothing\nedi\presets\EdgeSmoothingNediPresetsBilateralVariant7PresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns162xLumaPresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns162xRgbPresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns164xLumaPresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns322xRgbNns324xLumaPresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns324xRgbPresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns642xNns324xNns168xRgbPresetDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\EdgeSmoothingNnedi3Nnedi3Nns642xNns324xRgbPresetDef.h"
+#include "RetroArch\edge-smoothing\omniscale\EdgeSmoothingOmniscaleOmniscaleLegacyPresetDef.h"
+#include "RetroArch\edge-smoothing\omniscale\EdgeSmoothingOmniscaleOmniscalePresetDef.h"
+#include "RetroArch\edge-smoothing\sabr\EdgeSmoothingSabrSabrHybridDeposterizePresetDef.h"
+#include "RetroArch\edge-smoothing\sabr\EdgeSmoothingSabrSabrPresetDef.h"
+#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefxRAAPresetDef.h"
+#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefx9xPresetDef.h"
+#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefxHybridPresetDef.h"
+#include "RetroArch\edge-smoothing\scalefx\EdgeSmoothingScalefxScalefxPresetDef.h"
+#include "RetroArch\edge-smoothing\scalehq\EdgeSmoothingScalehq2xScaleHQPresetDef.h"
+#include "RetroArch\edge-smoothing\scalehq\EdgeSmoothingScalehq4xScaleHQPresetDef.h"
+#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxEpxPresetDef.h"
+#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxMmpxPresetDef.h"
+#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale2xPresetDef.h"
+#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale2xplusPresetDef.h"
+#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale2xSFXPresetDef.h"
+#include "RetroArch\edge-smoothing\scalenx\EdgeSmoothingScalenxScale3xPresetDef.h"
+#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrSuperXbrFastPresetDef.h"
+#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrSuperXbrPresetDef.h"
+#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv2SharpPresetDef.h"
+#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv2PresetDef.h"
+#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv3SharpPresetDef.h"
+#include "RetroArch\edge-smoothing\xbr\EdgeSmoothingXbrXbrLv3PresetDef.h"
+#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz2xbrzLinearPresetDef.h"
+#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz4xbrzLinearPresetDef.h"
+#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz5xbrzLinearPresetDef.h"
+#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrz6xbrzLinearPresetDef.h"
+#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrzXbrzFreescaleMultipassPresetDef.h"
+#include "RetroArch\edge-smoothing\xbrz\EdgeSmoothingXbrzXbrzFreescalePresetDef.h"
+#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal2xsalLevel2CrtPresetDef.h"
+#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal2xsalPresetDef.h"
+#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal4xsalLevel2CrtPresetDef.h"
+#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal4xsalLevel2HqPresetDef.h"
+#include "RetroArch\edge-smoothing\xsal\EdgeSmoothingXsal4xsalLevel2PresetDef.h"
+#include "RetroArch\edge-smoothing\xsoft\EdgeSmoothingXsoft4xsoftPresetDef.h"
+#include "RetroArch\edge-smoothing\xsoft\EdgeSmoothingXsoft4xsoftSdBPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddEdgeSmoothingPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(285, new EdgeSmoothingCleanEdgeCleanEdgeScalePresetDef());
+    list.emplace_back(286, new EdgeSmoothingDdt3PointPresetDef());
+    list.emplace_back(287, new EdgeSmoothingDdtCutPresetDef());
+    list.emplace_back(288, new EdgeSmoothingDdtDdtExtendedPresetDef());
+    list.emplace_back(289, new EdgeSmoothingDdtDdtJincLinearPresetDef());
+    list.emplace_back(290, new EdgeSmoothingDdtDdtJincPresetDef());
+    list.emplace_back(291, new EdgeSmoothingDdtDdtXbrLv1PresetDef());
+    list.emplace_back(292, new EdgeSmoothingDdtDdtPresetDef());
+    list.emplace_back(293, new EdgeSmoothingEagle2xsaiFixPixelShiftPresetDef());
+    list.emplace_back(294, new EdgeSmoothingEagle2xsaiPresetDef());
+    list.emplace_back(295, new EdgeSmoothingEagleSuper2xsaiFixPixelShiftPresetDef());
+    list.emplace_back(296, new EdgeSmoothingEagleSuper2xsaiPresetDef());
+    list.emplace_back(297, new EdgeSmoothingEagleSupereaglePresetDef());
+    list.emplace_back(298, new EdgeSmoothingFsrFsrEasuPresetDef());
+    list.emplace_back(299, new EdgeSmoothingFsrFsrPresetDef());
+    list.emplace_back(300, new EdgeSmoothingFsrSmaaFsrPresetDef());
+    list.emplace_back(301, new EdgeSmoothingHqxHq2xHalphonPresetDef());
+    list.emplace_back(302, new EdgeSmoothingHqxHq2xPresetDef());
+    list.emplace_back(303, new EdgeSmoothingHqxHq3xPresetDef());
+    list.emplace_back(304, new EdgeSmoothingHqxHq4xPresetDef());
+    list.emplace_back(305, new EdgeSmoothingNediFastBilateralNediPresetDef());
+    list.emplace_back(306, new EdgeSmoothingNediNediHybridSharperPresetDef());
+    list.emplace_back(307, new EdgeSmoothingNediNediHybridPresetDef());
+    list.emplace_back(308, new EdgeSmoothingNediNediSharperPresetDef());
+    list.emplace_back(309, new EdgeSmoothingNediNediPresetDef());
+    list.emplace_back(310, new EdgeSmoothingNediPresetsBilateralVariantPresetDef());
+    list.emplace_back(311, new EdgeSmoothingNediPresetsBilateralVariant2PresetDef());
+    list.emplace_back(312, new EdgeSmoothingNediPresetsBilateralVariant3PresetDef());
+    list.emplace_back(313, new EdgeSmoothingNediPresetsBilateralVariant4PresetDef());
+    list.emplace_back(314, new EdgeSmoothingNediPresetsBilateralVariant5PresetDef());
+    list.emplace_back(315, new EdgeSmoothingNediPresetsBilateralVariant6PresetDef());
+    list.emplace_back(316, new EdgeSmoothingNediPresetsBilateralVariant7PresetDef());
+    list.emplace_back(317, new EdgeSmoothingNnedi3Nnedi3Nns162xLumaPresetDef());
+    list.emplace_back(318, new EdgeSmoothingNnedi3Nnedi3Nns162xRgbPresetDef());
+    list.emplace_back(319, new EdgeSmoothingNnedi3Nnedi3Nns164xLumaPresetDef());
+    list.emplace_back(320, new EdgeSmoothingNnedi3Nnedi3Nns322xRgbNns324xLumaPresetDef());
+    list.emplace_back(321, new EdgeSmoothingNnedi3Nnedi3Nns324xRgbPresetDef());
+    list.emplace_back(322, new EdgeSmoothingNnedi3Nnedi3Nns642xNns324xNns168xRgbPresetDef());
+    list.emplace_back(323, new EdgeSmoothingNnedi3Nnedi3Nns642xNns324xRgbPresetDef());
+    list.emplace_back(324, new EdgeSmoothingOmniscaleOmniscaleLegacyPresetDef());
+    list.emplace_back(325, new EdgeSmoothingOmniscaleOmniscalePresetDef());
+    list.emplace_back(326, new EdgeSmoothingSabrSabrHybridDeposterizePresetDef());
+    list.emplace_back(327, new EdgeSmoothingSabrSabrPresetDef());
+    list.emplace_back(328, new EdgeSmoothingScalefxScalefxRAAPresetDef());
+    list.emplace_back(329, new EdgeSmoothingScalefxScalefx9xPresetDef());
+    list.emplace_back(330, new EdgeSmoothingScalefxScalefxHybridPresetDef());
+    list.emplace_back(331, new EdgeSmoothingScalefxScalefxPresetDef());
+    list.emplace_back(332, new EdgeSmoothingScalehq2xScaleHQPresetDef());
+    list.emplace_back(333, new EdgeSmoothingScalehq4xScaleHQPresetDef());
+    list.emplace_back(334, new EdgeSmoothingScalenxEpxPresetDef());
+    list.emplace_back(335, new EdgeSmoothingScalenxMmpxPresetDef());
+    list.emplace_back(336, new EdgeSmoothingScalenxScale2xPresetDef());
+    list.emplace_back(337, new EdgeSmoothingScalenxScale2xplusPresetDef());
+    list.emplace_back(338, new EdgeSmoothingScalenxScale2xSFXPresetDef());
+    list.emplace_back(339, new EdgeSmoothingScalenxScale3xPresetDef());
+    list.emplace_back(340, new EdgeSmoothingXbrSuperXbrFastPresetDef());
+    list.emplace_back(341, new EdgeSmoothingXbrSuperXbrPresetDef());
+    list.emplace_back(342, new EdgeSmoothingXbrXbrLv2SharpPresetDef());
+    list.emplace_back(343, new EdgeSmoothingXbrXbrLv2PresetDef());
+    list.emplace_back(344, new EdgeSmoothingXbrXbrLv3SharpPresetDef());
+    list.emplace_back(345, new EdgeSmoothingXbrXbrLv3PresetDef());
+    list.emplace_back(346, new EdgeSmoothingXbrz2xbrzLinearPresetDef());
+    list.emplace_back(347, new EdgeSmoothingXbrz4xbrzLinearPresetDef());
+    list.emplace_back(348, new EdgeSmoothingXbrz5xbrzLinearPresetDef());
+    list.emplace_back(349, new EdgeSmoothingXbrz6xbrzLinearPresetDef());
+    list.emplace_back(350, new EdgeSmoothingXbrzXbrzFreescaleMultipassPresetDef());
+    list.emplace_back(351, new EdgeSmoothingXbrzXbrzFreescalePresetDef());
+    list.emplace_back(352, new EdgeSmoothingXsal2xsalLevel2CrtPresetDef());
+    list.emplace_back(353, new EdgeSmoothingXsal2xsalPresetDef());
+    list.emplace_back(354, new EdgeSmoothingXsal4xsalLevel2CrtPresetDef());
+    list.emplace_back(355, new EdgeSmoothingXsal4xsalLevel2HqPresetDef());
+    list.emplace_back(356, new EdgeSmoothingXsal4xsalLevel2PresetDef());
+    list.emplace_back(357, new EdgeSmoothingXsoft4xsoftPresetDef());
+    list.emplace_back(358, new EdgeSmoothingXsoft4xsoftSdBPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,34 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\film\shaders\FilmShadersFilmGrainShaderDef.h"
+#include "RetroArch\film\shaders\FilmShadersFilm_noiseShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\film\resources\FilmResourcesFilm_noise1TextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTLUTShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTCmyk16TextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\film\FilmFilmGrainPresetDef.h"
+#include "RetroArch\film\FilmTechnicolorPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddFilmPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(359, new FilmFilmGrainPresetDef());
+    list.emplace_back(360, new FilmTechnicolorPresetDef());
+// %PRESET_CLASS%
+}
+}
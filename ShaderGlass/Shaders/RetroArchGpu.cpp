@@ -0,0 +1,33 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\gpu\shaders\3dfx\GpuShaders3dfx3dfx_pass_0ShaderDef.h"
+#include "RetroArch\gpu\shaders\3dfx\GpuShaders3dfx3dfx_pass_1ShaderDef.h"
+#include "RetroArch\gpu\shaders\3dfx\GpuShaders3dfx3dfx_pass_2ShaderDef.h"
+#include "RetroArch\gpu\shaders\GpuShadersPowervr2ShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\gpu\Gpu3dfx_4x1PresetDef.h"
+#include "RetroArch\gpu\GpuPowervr2PresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddGpuPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(361, new Gpu3dfx_4x1PresetDef());
+    list.emplace_back(362, new GpuPowervr2PresetDef());
+// %PRESET_CLASS%
+}
+}
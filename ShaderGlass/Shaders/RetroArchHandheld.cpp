@@ -0,0 +1,268 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbaColorShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersDotShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-cgwg\HandheldShadersLcdCgwgLcdGridV2ShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcColorShaderDef.h"
+#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgb001ShaderDef.h"
+#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgs001ShaderDef.h"
+#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgs001LightShaderDef.h"
+#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcTo_linShaderDef.h"
+#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcAuthentic_gbcShaderDef.h"
+#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcTo_lin_fastShaderDef.h"
+#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcAuthentic_gbc_fastShaderDef.h"
+#include "RetroArch\handheld\shaders\authentic_gbc\HandheldShadersAuthentic_gbcAuthentic_gbc_single_passShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersBevelShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorDsliteColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBALUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBCLUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcGambatteColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBMLUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbMicroColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorNdsColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorNSOGbaColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorNSOGbcColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorPalmColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorPspColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorSp101ColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorSwitchOLEDColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorVbaColorShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass0ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass1ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass2ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass3ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass4ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesGbPass5ShaderDef.h"
+#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass1ShaderDef.h"
+#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass2ShaderDef.h"
+#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass3ShaderDef.h"
+#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass4ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\HandheldConsoleBorderShaderFilesBorderAutoScaleShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\lcd-cgwg\HandheldConsoleBorderShaderFilesLcdCgwgLcdGridV2ShaderDef.h"
+#include "RetroArch\handheld\console-border\shader-files\lcd-cgwg\HandheldConsoleBorderShaderFilesLcdCgwgLcdGridShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersDsHybridViewShaderDef.h"
+#include "RetroArch\handheld\shaders\gameboy\shader-files\HandheldShadersGameboyShaderFilesGbPass0ShaderDef.h"
+#include "RetroArch\handheld\shaders\gb-palette\HandheldShadersGbPaletteGbPaletteShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcDevShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-cgwg\HandheldShadersLcdCgwgLcdGridShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass0ShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass1ShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass2ShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderLcdPass3ShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersLcd1xShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersLcd1x_ndsShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersLcd1x_pspShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersLcd3xShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersRetroTilesShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersRetroV2ShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersRetroV3ShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersSameboyLcdShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd4kShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersZfast_lcdShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbaColor4kShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbcColor4kShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbcColorShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pGbaColorShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pGbcColorShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutDsliteGreyTextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbaGrey1TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbaGrey2TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbcGrey1TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbcGrey2TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbamicroGreyTextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutNdsGreyTextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutPspGrey1TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutPspGrey2TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutSp101GreyTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesDmgPaletteTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesDmgBackgroundTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesDmgBorderSquare4xTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesDmgPalette0TextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-bgs\HandheldShadersGameboyResourcesSampleBgsDmgBgTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesGblightPaletteTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-bgs\HandheldShadersGameboyResourcesSampleBgsPaperBgTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPocketBorderSquare4xTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesGbpPaletteTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPocketPaletteTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPocketBackgroundTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesGbaBorderSquare4xTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesColorBorderSquare4xTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesGgBorderSquare4xTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesNgpcBorderSquare4xTextureDef.h"
+#include "RetroArch\handheld\console-border\resources\HandheldConsoleBorderResourcesPspBorderTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesBWPaletteTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\sample-palettes\HandheldShadersGameboyResourcesSamplePalettesGbpPaletteHighContrastTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\HandheldShadersGameboyResourcesPaletteTextureDef.h"
+#include "RetroArch\handheld\shaders\gameboy\resources\HandheldShadersGameboyResourcesBackgroundTextureDef.h"
+#include "RetroArch\handheld\shaders\gb-palette\resources\HandheldShadersGbPaletteResourcesPaletteDmgTextureDef.h"
+#include "RetroArch\handheld\shaders\gb-palette\resources\HandheldShadersGbPaletteResourcesPaletteLightTextureDef.h"
+#include "RetroArch\handheld\shaders\gb-palette\resources\HandheldShadersGbPaletteResourcesPalettePocketTextureDef.h"
+#include "RetroArch\handheld\shaders\lcd-shader\HandheldShadersLcdShaderBackgroundTextureDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\png\4k\HandheldShadersSimpletex_lcdPng4kTextured_paperTextureDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\png\2k\HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersFeedbackShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
+#include "RetroArch\edge-smoothing\sabr\shaders\EdgeSmoothingSabrShadersSabrV30ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass3ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass4ShaderDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTMultiLUTShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersResponseTimeShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT64TextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\handheld\HandheldAgb001PresetDef.h"
+#include "RetroArch\handheld\HandheldAgs001PresetDef.h"
+#include "RetroArch\handheld\HandheldAuthentic_gbcPresetDef.h"
+#include "RetroArch\handheld\HandheldAuthentic_gbc_fastPresetDef.h"
+#include "RetroArch\handheld\HandheldAuthentic_gbc_single_passPresetDef.h"
+#include "RetroArch\handheld\HandheldBevelPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModDsliteColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModGbaColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModGbcColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModGbcGambatteColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModGbMicroColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModNdsColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModNSOGbaColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModNSOGbcColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModPalmColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModPspColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModSp101ColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModSwitchOLEDColorPresetDef.h"
+#include "RetroArch\handheld\color-mod\HandheldColorModVbaColorPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderDmgPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbDmgAltPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbLightAltPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbPocketAltPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbPocketPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaAgb001ColorMotionblurPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaAgs001ColorMotionblurPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaLcdGridV2PresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbaPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbcLcdGridV2PresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGbcPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderGgPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderNgpcPresetDef.h"
+#include "RetroArch\handheld\console-border\HandheldConsoleBorderPspPresetDef.h"
+#include "RetroArch\handheld\HandheldDotPresetDef.h"
+#include "RetroArch\handheld\HandheldDsHybridSabrPresetDef.h"
+#include "RetroArch\handheld\HandheldDsHybridScalefxPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyAdvanceDotMatrixPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyColorDotMatrixWhiteBgPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyColorDotMatrixPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyDarkModePresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyLightModePresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyLightPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyPocketHighContrastPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyPocketPresetDef.h"
+#include "RetroArch\handheld\HandheldGameboyPresetDef.h"
+#include "RetroArch\handheld\HandheldGbPaletteDmgPresetDef.h"
+#include "RetroArch\handheld\HandheldGbPaletteLightPresetDef.h"
+#include "RetroArch\handheld\HandheldGbPalettePocketPresetDef.h"
+#include "RetroArch\handheld\HandheldGbcDevPresetDef.h"
+#include "RetroArch\handheld\HandheldLcdGridV2PresetDef.h"
+#include "RetroArch\handheld\HandheldLcdGridPresetDef.h"
+#include "RetroArch\handheld\HandheldLcdShaderPresetDef.h"
+#include "RetroArch\handheld\HandheldLcd1xPresetDef.h"
+#include "RetroArch\handheld\HandheldLcd1x_ndsPresetDef.h"
+#include "RetroArch\handheld\HandheldLcd1x_pspPresetDef.h"
+#include "RetroArch\handheld\HandheldLcd3xPresetDef.h"
+#include "RetroArch\handheld\HandheldRetroTilesPresetDef.h"
+#include "RetroArch\handheld\HandheldRetroV2PresetDef.h"
+#include "RetroArch\handheld\HandheldRetroV3PresetDef.h"
+#include "RetroArch\handheld\HandheldSameboyLcdPresetDef.h"
+#include "RetroArch\handheld\HandheldSimpletex_lcd4kPresetDef.h"
+#include "RetroArch\handheld\HandheldSimpletex_lcdPresetDef.h"
+#include "RetroArch\handheld\HandheldSimpletex_lcd_720pPresetDef.h"
+#include "RetroArch\handheld\HandheldZfastLcdPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddHandheldPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(363, new HandheldAgb001PresetDef());
+    list.emplace_back(364, new HandheldAgs001PresetDef());
+    list.emplace_back(365, new HandheldAuthentic_gbcPresetDef());
+    list.emplace_back(366, new HandheldAuthentic_gbc_fastPresetDef());
+    list.emplace_back(367, new HandheldAuthentic_gbc_single_passPresetDef());
+    list.emplace_back(368, new HandheldBevelPresetDef());
+    list.emplace_back(369, new HandheldColorModDsliteColorPresetDef());
+    list.emplace_back(370, new HandheldColorModGbaColorPresetDef());
+    list.emplace_back(371, new HandheldColorModGbcColorPresetDef());
+    list.emplace_back(372, new HandheldColorModGbcGambatteColorPresetDef());
+    list.emplace_back(373, new HandheldColorModGbMicroColorPresetDef());
+    list.emplace_back(374, new HandheldColorModNdsColorPresetDef());
+    list.emplace_back(375, new HandheldColorModNSOGbaColorPresetDef());
+    list.emplace_back(376, new HandheldColorModNSOGbcColorPresetDef());
+    list.emplace_back(377, new HandheldColorModPalmColorPresetDef());
+    list.emplace_back(378, new HandheldColorModPspColorPresetDef());
+    list.emplace_back(379, new HandheldColorModSp101ColorPresetDef());
+    list.emplace_back(380, new HandheldColorModSwitchOLEDColorPresetDef());
+    list.emplace_back(381, new HandheldColorModVbaColorPresetDef());
+    list.emplace_back(382, new HandheldConsoleBorderDmgPresetDef());
+    list.emplace_back(383, new HandheldConsoleBorderGbDmgAltPresetDef());
+    list.emplace_back(384, new HandheldConsoleBorderGbLightAltPresetDef());
+    list.emplace_back(385, new HandheldConsoleBorderGbPocketAltPresetDef());
+    list.emplace_back(386, new HandheldConsoleBorderGbPocketPresetDef());
+    list.emplace_back(387, new HandheldConsoleBorderGbaAgb001ColorMotionblurPresetDef());
+    list.emplace_back(388, new HandheldConsoleBorderGbaAgs001ColorMotionblurPresetDef());
+    list.emplace_back(389, new HandheldConsoleBorderGbaLcdGridV2PresetDef());
+    list.emplace_back(390, new HandheldConsoleBorderGbaPresetDef());
+    list.emplace_back(391, new HandheldConsoleBorderGbcLcdGridV2PresetDef());
+    list.emplace_back(392, new HandheldConsoleBorderGbcPresetDef());
+    list.emplace_back(393, new HandheldConsoleBorderGgPresetDef());
+    list.emplace_back(394, new HandheldConsoleBorderNgpcPresetDef());
+    list.emplace_back(395, new HandheldConsoleBorderPspPresetDef());
+    list.emplace_back(396, new HandheldDotPresetDef());
+    list.emplace_back(397, new HandheldDsHybridSabrPresetDef());
+    list.emplace_back(398, new HandheldDsHybridScalefxPresetDef());
+    list.emplace_back(399, new HandheldGameboyAdvanceDotMatrixPresetDef());
+    list.emplace_back(400, new HandheldGameboyColorDotMatrixWhiteBgPresetDef());
+    list.emplace_back(401, new HandheldGameboyColorDotMatrixPresetDef());
+    list.emplace_back(402, new HandheldGameboyDarkModePresetDef());
+    list.emplace_back(403, new HandheldGameboyLightModePresetDef());
+    list.emplace_back(404, new HandheldGameboyLightPresetDef());
+    list.emplace_back(405, new HandheldGameboyPocketHighContrastPresetDef());
+    list.emplace_back(406, new HandheldGameboyPocketPresetDef());
+    list.emplace_back(407, new HandheldGameboyPresetDef());
+    list.emplace_back(408, new HandheldGbPaletteDmgPresetDef());
+    list.emplace_back(409, new HandheldGbPaletteLightPresetDef());
+    list.emplace_back(410, new HandheldGbPalettePocketPresetDef());
+    list.emplace_back(411, new HandheldGbcDevPresetDef());
+    list.emplace_back(412, new HandheldLcdGridV2PresetDef());
+    list.emplace_back(413, new HandheldLcdGridPresetDef());
+    list.emplace_back(414, new HandheldLcdShaderPresetDef());
+    list.emplace_back(415, new HandheldLcd1xPresetDef());
+    list.emplace_back(416, new HandheldLcd1x_ndsPresetDef());
+    list.emplace_back(417, new HandheldLcd1x_pspPresetDef());
+    list.emplace_back(418, new HandheldLcd3xPresetDef());
+    list.emplace_back(419, new HandheldRetroTilesPresetDef());
+    list.emplace_back(420, new HandheldRetroV2PresetDef());
+    list.emplace_back(421, new HandheldRetroV3PresetDef());
+    list.emplace_back(422, new HandheldSameboyLcdPresetDef());
+    list.emplace_back(423, new HandheldSimpletex_lcd4kPresetDef());
+    list.emplace_back(424, new HandheldSimpletex_lcdPresetDef());
+    list.emplace_back(425, new HandheldSimpletex_lcd_720pPresetDef());
+    list.emplace_back(426, new HandheldZfastLcdPresetDef());
+// %PRESET_CLASS%
+}
+}
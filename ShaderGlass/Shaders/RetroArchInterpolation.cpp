@@ -0,0 +1,90 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicXShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicYShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubicShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersJinc2ShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBSplineXShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBSplineYShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline16XShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline16YShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBSpline4TapsShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBicubic5TapsShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRom5TapsShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRomXShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRomYShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCatmullRomShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLinearizeShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCubicGammaCorrectShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCubicShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersHermiteShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos16ShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos25TapsShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos3XShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos3YShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersQuilezShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline36XShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline36YShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\interpolation\InterpolationBSpline4TapsPresetDef.h"
+#include "RetroArch\interpolation\InterpolationBSplineFastPresetDef.h"
+#include "RetroArch\interpolation\InterpolationBicubic5TapsPresetDef.h"
+#include "RetroArch\interpolation\InterpolationBicubicFastPresetDef.h"
+#include "RetroArch\interpolation\InterpolationBicubicPresetDef.h"
+#include "RetroArch\interpolation\InterpolationCatmullRom5TapsPresetDef.h"
+#include "RetroArch\interpolation\InterpolationCatmullRomFastPresetDef.h"
+#include "RetroArch\interpolation\InterpolationCatmullRomPresetDef.h"
+#include "RetroArch\interpolation\InterpolationCubicGammaCorrectPresetDef.h"
+#include "RetroArch\interpolation\InterpolationCubicPresetDef.h"
+#include "RetroArch\interpolation\InterpolationHermitePresetDef.h"
+#include "RetroArch\interpolation\InterpolationJinc2SharpPresetDef.h"
+#include "RetroArch\interpolation\InterpolationJinc2SharperPresetDef.h"
+#include "RetroArch\interpolation\InterpolationJinc2PresetDef.h"
+#include "RetroArch\interpolation\InterpolationLanczos16PresetDef.h"
+#include "RetroArch\interpolation\InterpolationLanczos25TapsPresetDef.h"
+#include "RetroArch\interpolation\InterpolationLanczos3FastPresetDef.h"
+#include "RetroArch\interpolation\InterpolationQuilezPresetDef.h"
+#include "RetroArch\interpolation\InterpolationSpline16FastPresetDef.h"
+#include "RetroArch\interpolation\InterpolationSpline36FastPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddInterpolationPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(427, new InterpolationBSpline4TapsPresetDef());
+    list.emplace_back(428, new InterpolationBSplineFastPresetDef());
+    list.emplace_back(429, new InterpolationBicubic5TapsPresetDef());
+    list.emplace_back(430, new InterpolationBicubicFastPresetDef());
+    list.emplace_back(431, new InterpolationBicubicPresetDef());
+    list.emplace_back(432, new InterpolationCatmullRom5TapsPresetDef());
+    list.emplace_back(433, new InterpolationCatmullRomFastPresetDef());
+    list.emplace_back(434, new InterpolationCatmullRomPresetDef());
+    list.emplace_back(435, new InterpolationCubicGammaCorrectPresetDef());
+    list.emplace_back(436, new InterpolationCubicPresetDef());
+    list.emplace_back(437, new InterpolationHermitePresetDef());
+    list.emplace_back(438, new InterpolationJinc2SharpPresetDef());
+    list.emplace_back(439, new InterpolationJinc2SharperPresetDef());
+    list.emplace_back(440, new InterpolationJinc2PresetDef());
+    list.emplace_back(441, new InterpolationLanczos16PresetDef());
+    list.emplace_back(442, new InterpolationLanczos25TapsPresetDef());
+    list.emplace_back(443, new InterpolationLanczos3FastPresetDef());
+    list.emplace_back(444, new InterpolationQuilezPresetDef());
+    list.emplace_back(445, new InterpolationSpline16FastPresetDef());
+    list.emplace_back(446, new InterpolationSpline36FastPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,29 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\linear\LinearLinearizeShaderDef.h"
+#include "RetroArch\linear\LinearLinearGammaCorrectShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\linear\LinearLinearGammaCorrectPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddLinearPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(447, new LinearLinearGammaCorrectPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,145 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersInterlacingShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersNaturalVisionShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersAccessibility_modsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersAntiFlickerShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersAsciiShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersBeadShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersBobDeinterlacingShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersChromaShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersChromaticityShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersCmykHalftoneDotShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersCocktailCabinetShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersColorManglerShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersColorimetryShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersConvergenceShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersDebandShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersDeinterlaceShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersEdgeDetectShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersEgaShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersGeomShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersGlassShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersGradeNoLUTShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersGradeShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersImg_modShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersNight_modeShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersNtscColorsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersReliefShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersRetroPalettesShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersSimple_color_controlsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersSsGammaRampShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersTonemappingShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersWhite_pointShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersYiqHueAdjustmentShaderDef.h"
+#include "RetroArch\misc\shaders\deposterize\MiscShadersDeposterizeDeposterizePass0ShaderDef.h"
+#include "RetroArch\misc\shaders\deposterize\MiscShadersDeposterizeDeposterizePass1ShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyColorShaderDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscLinearToSrgbShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT64TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT32TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT16TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_80s_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_90s_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_J_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrinitronP22_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_J_D93TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrinitronP22_D93TextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\misc\MiscAccessibility_modsPresetDef.h"
+#include "RetroArch\misc\MiscAntiFlickerPresetDef.h"
+#include "RetroArch\misc\MiscAsciiPresetDef.h"
+#include "RetroArch\misc\MiscBeadPresetDef.h"
+#include "RetroArch\misc\MiscBobDeinterlacingPresetDef.h"
+#include "RetroArch\misc\MiscChromaPresetDef.h"
+#include "RetroArch\misc\MiscChromaticityPresetDef.h"
+#include "RetroArch\misc\MiscCmykHalftoneDotPresetDef.h"
+#include "RetroArch\misc\MiscCocktailCabinetPresetDef.h"
+#include "RetroArch\misc\MiscColorManglerPresetDef.h"
+#include "RetroArch\misc\MiscColorimetryPresetDef.h"
+#include "RetroArch\misc\MiscConvergencePresetDef.h"
+#include "RetroArch\misc\MiscDebandPresetDef.h"
+#include "RetroArch\misc\MiscDeinterlacePresetDef.h"
+#include "RetroArch\misc\MiscEdgeDetectPresetDef.h"
+#include "RetroArch\misc\MiscEgaPresetDef.h"
+#include "RetroArch\misc\MiscGeomAppendPresetDef.h"
+#include "RetroArch\misc\MiscGeomPresetDef.h"
+#include "RetroArch\misc\MiscGlassPresetDef.h"
+#include "RetroArch\misc\MiscGradeNoLUTPresetDef.h"
+#include "RetroArch\misc\MiscGradePresetDef.h"
+#include "RetroArch\misc\MiscHalf_resPresetDef.h"
+#include "RetroArch\misc\MiscImageAdjustmentPresetDef.h"
+#include "RetroArch\misc\MiscImg_modPresetDef.h"
+#include "RetroArch\misc\MiscInterlacingPresetDef.h"
+#include "RetroArch\misc\MiscNaturalVisionPresetDef.h"
+#include "RetroArch\misc\MiscNightModePresetDef.h"
+#include "RetroArch\misc\MiscNtscColorsPresetDef.h"
+#include "RetroArch\misc\MiscPatchyColorPresetDef.h"
+#include "RetroArch\misc\MiscReliefPresetDef.h"
+#include "RetroArch\misc\MiscRetroPalettesPresetDef.h"
+#include "RetroArch\misc\MiscSimple_color_controlsPresetDef.h"
+#include "RetroArch\misc\MiscSsGammaRampPresetDef.h"
+#include "RetroArch\misc\MiscTonemappingPresetDef.h"
+#include "RetroArch\misc\MiscWhite_pointPresetDef.h"
+#include "RetroArch\misc\MiscYiqHueAdjustmentPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddMiscPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(448, new MiscAccessibility_modsPresetDef());
+    list.emplace_back(449, new MiscAntiFlickerPresetDef());
+    list.emplace_back(450, new MiscAsciiPresetDef());
+    list.emplace_back(451, new MiscBeadPresetDef());
+    list.emplace_back(452, new MiscBobDeinterlacingPresetDef());
+    list.emplace_back(453, new MiscChromaPresetDef());
+    list.emplace_back(454, new MiscChromaticityPresetDef());
+    list.emplace_back(455, new MiscCmykHalftoneDotPresetDef());
+    list.emplace_back(456, new MiscCocktailCabinetPresetDef());
+    list.emplace_back(457, new MiscColorManglerPresetDef());
+    list.emplace_back(458, new MiscColorimetryPresetDef());
+    list.emplace_back(459, new MiscConvergencePresetDef());
+    list.emplace_back(460, new MiscDebandPresetDef());
+    list.emplace_back(461, new MiscDeinterlacePresetDef());
+    list.emplace_back(462, new MiscEdgeDetectPresetDef());
+    list.emplace_back(463, new MiscEgaPresetDef());
+    list.emplace_back(464, new MiscGeomAppendPresetDef());
+    list.emplace_back(465, new MiscGeomPresetDef());
+    list.emplace_back(466, new MiscGlassPresetDef());
+    list.emplace_back(467, new MiscGradeNoLUTPresetDef());
+    list.emplace_back(468, new MiscGradePresetDef());
+    list.emplace_back(469, new MiscHalf_resPresetDef());
+    list.emplace_back(470, new MiscImageAdjustmentPresetDef());
+    list.emplace_back(471, new MiscImg_modPresetDef());
+    list.emplace_back(472, new MiscInterlacingPresetDef());
+    list.emplace_back(473, new MiscNaturalVisionPresetDef());
+    list.emplace_back(474, new MiscNightModePresetDef());
+    list.emplace_back(475, new MiscNtscColorsPresetDef());
+    list.emplace_back(476, new MiscPatchyColorPresetDef());
+    list.emplace_back(477, new MiscReliefPresetDef());
+    list.emplace_back(478, new MiscRetroPalettesPresetDef());
+    list.emplace_back(479, new MiscSimple_color_controlsPresetDef());
+    list.emplace_back(480, new MiscSsGammaRampPresetDef());
+    list.emplace_back(481, new MiscTonemappingPresetDef());
+    list.emplace_back(482, new MiscWhite_pointPresetDef());
+    list.emplace_back(483, new MiscYiqHueAdjustmentPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,29 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\motion-interpolation\shaders\motion_interpolation\MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass0ShaderDef.h"
+#include "RetroArch\motion-interpolation\shaders\motion_interpolation\MotionInterpolationShadersMotion_interpolationMotion_interpolation_pass3ShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\motion-interpolation\MotionInterpolationMotion_interpolationPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddMotionInterpolationPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(484, new MotionInterpolationMotion_interpolationPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,49 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\motionblur\shaders\MotionblurShadersFeedbackShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersResponseTimeShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersBraidRewindShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersMix_framesShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersMix_frames_smartShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersMotionblurBlueShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersMotionblurColorShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersMotionblurSimpleShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\motionblur\MotionblurBraidRewindPresetDef.h"
+#include "RetroArch\motionblur\MotionblurFeedbackPresetDef.h"
+#include "RetroArch\motionblur\MotionblurMix_framesPresetDef.h"
+#include "RetroArch\motionblur\MotionblurMix_frames_smartPresetDef.h"
+#include "RetroArch\motionblur\MotionblurMotionblurBluePresetDef.h"
+#include "RetroArch\motionblur\MotionblurMotionblurColorPresetDef.h"
+#include "RetroArch\motionblur\MotionblurMotionblurSimplePresetDef.h"
+#include "RetroArch\motionblur\MotionblurResponseTimePresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddMotionblurPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(485, new MotionblurBraidRewindPresetDef());
+    list.emplace_back(486, new MotionblurFeedbackPresetDef());
+    list.emplace_back(487, new MotionblurMix_framesPresetDef());
+    list.emplace_back(488, new MotionblurMix_frames_smartPresetDef());
+    list.emplace_back(489, new MotionblurMotionblurBluePresetDef());
+    list.emplace_back(490, new MotionblurMotionblurColorPresetDef());
+    list.emplace_back(491, new MotionblurMotionblurSimplePresetDef());
+    list.emplace_back(492, new MotionblurResponseTimePresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,49 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomCompositeEncodeShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomLowpassNotchDecodeYiqShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomAdaptiveCombDecodeShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomLowpassChromaShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\cgwg-famicom-geom\Nes_raw_paletteShadersCgwgFamicomGeomCrtGeomFamicomShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomDAC_LUTShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomLowPassShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomCombFilterShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomScaleXShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomScaleYShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\Nes_raw_paletteShadersNesColorDecoderShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\nes_raw_palette\shaders\gtu-famicom\Nes_raw_paletteShadersGtuFamicomNesTableTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite3phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseShaderDef.h"
+#include "RetroArch\pal\shaders\PalShadersPalR57shellShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\pal\resources\PalResourcesNes_lutTextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\nes_raw_palette\Nes_raw_paletteCgwgFamicomGeomPresetDef.h"
+#include "RetroArch\nes_raw_palette\Nes_raw_paletteGtuFamicomPresetDef.h"
+#include "RetroArch\nes_raw_palette\Nes_raw_paletteNtscNesPresetDef.h"
+#include "RetroArch\nes_raw_palette\Nes_raw_palettePalR57shellRawPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddNes_raw_palettePresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(494, new Nes_raw_paletteCgwgFamicomGeomPresetDef());
+    list.emplace_back(495, new Nes_raw_paletteGtuFamicomPresetDef());
+    list.emplace_back(496, new Nes_raw_paletteNtscNesPresetDef());
+    list.emplace_back(497, new Nes_raw_palettePalR57shellRawPresetDef());
+// %PRESET_CLASS%
+}
+}
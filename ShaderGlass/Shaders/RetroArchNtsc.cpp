@@ -0,0 +1,108 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscPatchyColorShaderDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrilinearLUTSwitchableShaderDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscLinearToSrgbShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite3phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors0ShaderDef.h"
+#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors2ShaderDef.h"
+#include "RetroArch\ntsc\shaders\blargg\NtscShadersBlarggBlargg0ShaderDef.h"
+#include "RetroArch\ntsc\shaders\blargg\NtscShadersBlarggBlargg1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\mame-ntsc\NtscShadersMameNtscMameNtscShaderDef.h"
+#include "RetroArch\ntsc\shaders\mame-ntsc\NtscShadersMameNtscMamePostprocShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscGaussPassShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscStockShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseGammaShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Svideo3phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite2phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass22phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass22phaseGammaShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Svideo2phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive\NtscShadersNtscAdaptiveNtscPass1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive\NtscShadersNtscAdaptiveNtscPass2ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive-tate\NtscShadersNtscAdaptiveTateNtscTatePass1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive-tate\NtscShadersNtscAdaptiveTateNtscTatePass2ShaderDef.h"
+#include "RetroArch\ntsc\shaders\NtscShadersNtscBlastemShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleNtscMiniShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleNtscSimple1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleNtscSimple2ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleKaizerLpSmallShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-simple\NtscShadersNtscSimpleTiny_ntscShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseLinearShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_80s_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_90s_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_J_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrinitronP22_D65TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscP22_J_D93TextureDef.h"
+#include "RetroArch\ntsc\shaders\patchy-ntsc\NtscShadersPatchyNtscTrinitronP22_D93TextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass3ShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_ntsc_encodeShaderDef.h"
+#include "RetroArch\crt\shaders\mame_hlsl\shaders\CrtShadersMame_hlslShadersMame_ntsc_decodeShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\ntsc\NtscArtifactColorsPresetDef.h"
+#include "RetroArch\ntsc\NtscBlarggPresetDef.h"
+#include "RetroArch\ntsc\NtscMameNtscPresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc256pxCompositeScanlinePresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc256pxCompositePresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc256pxSvideoScanlinePresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc256pxSvideoPresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc320pxCompositeScanlinePresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc320pxCompositePresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc320pxSvideoScanlinePresetDef.h"
+#include "RetroArch\ntsc\NtscNtsc320pxSvideoPresetDef.h"
+#include "RetroArch\ntsc\NtscNtscAdaptive4xPresetDef.h"
+#include "RetroArch\ntsc\NtscNtscAdaptiveOldPresetDef.h"
+#include "RetroArch\ntsc\NtscNtscAdaptiveTatePresetDef.h"
+#include "RetroArch\ntsc\NtscNtscAdaptivePresetDef.h"
+#include "RetroArch\ntsc\NtscNtscBlastemPresetDef.h"
+#include "RetroArch\ntsc\NtscNtscMdRainbowsPresetDef.h"
+#include "RetroArch\ntsc\NtscNtscMiniPresetDef.h"
+#include "RetroArch\ntsc\NtscNtscSimplePresetDef.h"
+#include "RetroArch\ntsc\NtscTiny_ntscPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddNtscPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(498, new NtscArtifactColorsPresetDef());
+    list.emplace_back(499, new NtscBlarggPresetDef());
+    list.emplace_back(500, new NtscMameNtscPresetDef());
+    list.emplace_back(501, new NtscNtsc256pxCompositeScanlinePresetDef());
+    list.emplace_back(502, new NtscNtsc256pxCompositePresetDef());
+    list.emplace_back(503, new NtscNtsc256pxSvideoScanlinePresetDef());
+    list.emplace_back(504, new NtscNtsc256pxSvideoPresetDef());
+    list.emplace_back(505, new NtscNtsc320pxCompositeScanlinePresetDef());
+    list.emplace_back(506, new NtscNtsc320pxCompositePresetDef());
+    list.emplace_back(507, new NtscNtsc320pxSvideoScanlinePresetDef());
+    list.emplace_back(508, new NtscNtsc320pxSvideoPresetDef());
+    list.emplace_back(509, new NtscNtscAdaptive4xPresetDef());
+    list.emplace_back(510, new NtscNtscAdaptiveOldPresetDef());
+    list.emplace_back(511, new NtscNtscAdaptiveTatePresetDef());
+    list.emplace_back(512, new NtscNtscAdaptivePresetDef());
+    list.emplace_back(513, new NtscNtscBlastemPresetDef());
+    list.emplace_back(514, new NtscNtscMdRainbowsPresetDef());
+    list.emplace_back(515, new NtscNtscMiniPresetDef());
+    list.emplace_back(516, new NtscNtscSimplePresetDef());
+    list.emplace_back(517, new NtscTiny_ntscPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,35 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\pal\shaders\PalShadersPalR57shellShaderDef.h"
+#include "RetroArch\pal\shaders\PalShadersPalR57shellMoireOnlyShaderDef.h"
+#include "RetroArch\pal\shaders\PalShadersPalSinglepassShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\pal\resources\PalResourcesNes_lutTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\pal\PalPalR57shellMoireOnlyPresetDef.h"
+#include "RetroArch\pal\PalPalR57shellPresetDef.h"
+#include "RetroArch\pal\PalPalSinglepassPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddPalPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(518, new PalPalR57shellMoireOnlyPresetDef());
+    list.emplace_back(519, new PalPalR57shellPresetDef());
+    list.emplace_back(520, new PalPalSinglepassPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,94 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersAannShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersBandlimitPixelShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersBilinearAdjustableShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\box_filter_aa\PixelArtScalingShadersBox_filter_aaBox_filter_aa_xformShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersCleanEdgeRotateShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersControlledSharpnessShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersEdge1pixelShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersEdgeNpixelsShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersGridBlendHybridShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersPixellateShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaTo_linShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aaShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaTo_lin_fastShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aa_fastShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aa_single_passShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\pixel_aa\PixelArtScalingShadersPixel_aaPixel_aa_xformShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpBilinearScanlinesShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpBilinearSimpleShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpBilinearShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSharpShimmerlessShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSmootheststepShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersSmuberStepShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersUniformNearestShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\linear\LinearLinearizeShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\pixel-art-scaling\PixelArtScalingAannPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingBandlimitPixelPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingBilinearAdjustablePresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingBox_filter_aa_xformPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingCleanEdgeRotatePresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingControlled_sharpnessPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingEdge1pixelPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingEdgeNpixelsPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingGridBlendHybridPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingPixellatePresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aaPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aa_fastPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aa_single_passPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingPixel_aa_xformPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinear2xPrescalePresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinearScanlinesPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinearSimplePresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpBilinearPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSharpShimmerlessPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSmootheststepPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingSmuberstepPresetDef.h"
+#include "RetroArch\pixel-art-scaling\PixelArtScalingUniformNearestPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddPixelArtScalingPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(521, new PixelArtScalingAannPresetDef());
+    list.emplace_back(522, new PixelArtScalingBandlimitPixelPresetDef());
+    list.emplace_back(523, new PixelArtScalingBilinearAdjustablePresetDef());
+    list.emplace_back(524, new PixelArtScalingBox_filter_aa_xformPresetDef());
+    list.emplace_back(525, new PixelArtScalingCleanEdgeRotatePresetDef());
+    list.emplace_back(526, new PixelArtScalingControlled_sharpnessPresetDef());
+    list.emplace_back(527, new PixelArtScalingEdge1pixelPresetDef());
+    list.emplace_back(528, new PixelArtScalingEdgeNpixelsPresetDef());
+    list.emplace_back(529, new PixelArtScalingGridBlendHybridPresetDef());
+    list.emplace_back(530, new PixelArtScalingPixellatePresetDef());
+    list.emplace_back(531, new PixelArtScalingPixel_aaPresetDef());
+    list.emplace_back(532, new PixelArtScalingPixel_aa_fastPresetDef());
+    list.emplace_back(533, new PixelArtScalingPixel_aa_single_passPresetDef());
+    list.emplace_back(534, new PixelArtScalingPixel_aa_xformPresetDef());
+    list.emplace_back(535, new PixelArtScalingSharpBilinear2xPrescalePresetDef());
+    list.emplace_back(536, new PixelArtScalingSharpBilinearScanlinesPresetDef());
+    list.emplace_back(537, new PixelArtScalingSharpBilinearSimplePresetDef());
+    list.emplace_back(538, new PixelArtScalingSharpBilinearPresetDef());
+    list.emplace_back(539, new PixelArtScalingSharpShimmerlessPresetDef());
+    list.emplace_back(540, new PixelArtScalingSmootheststepPresetDef());
+    list.emplace_back(541, new PixelArtScalingSmuberstepPresetDef());
+    list.emplace_back(542, new PixelArtScalingUniformNearestPresetDef());
+// %PRESET_CLASS%
+}
+}
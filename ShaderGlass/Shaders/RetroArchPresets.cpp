@@ -0,0 +1,720 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\anti-aliasing\shaders\aa-shader-4.0-level2\AntiAliasingShadersAaShader40Level2AaShader40Level2Pass1ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\aa-shader-4.0-level2\AntiAliasingShadersAaShader40Level2AaShader40Level2Pass2ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersAaShader40ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\AntiAliasingShadersFxaaShaderDef.h"
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass0ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass1ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSmaaPass2ShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersFastSharpenShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseLinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterUpsampleShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseDelinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterDownsample_bloomShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterNaive_resampleShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterMoving_avgShaderDef.h"
+#include "RetroArch\blurs\shaders\dual_filter\BlursShadersDual_filterBloom_blendShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersGizmoBlurShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase0ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase1ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase2ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseKawase3ShaderDef.h"
+#include "RetroArch\blurs\shaders\kawase\BlursShadersKawaseScreen_combineShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersSharpsmootherShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersSmartBlurShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtGeomShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomApproxShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur9fastHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleMaskResizeHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBrightpassShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src\CrtShadersCrtRoyaleSrcCrtRoyaleGeometryAaLastPassShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbaColorShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersTvoutTweaksShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersInterlacingShaderDef.h"
+#include "RetroArch\border\shaders\BorderShadersImgborderShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtConsumerShaderDef.h"
+#include "RetroArch\handheld\shaders\lcd-cgwg\HandheldShadersLcdCgwgLcdGridV2ShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbcColorShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationBlur_vertShaderDef.h"
+#include "RetroArch\crt\shaders\crt-easymode-halation\CrtShadersCrtEasymodeHalationThresholdShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxePhosphor_applyShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxePhosphor_updateShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeGaussxShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeGaussyShaderDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\CrtShadersGeomDeluxeCrtGeomDeluxeShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\ntsc\CrtShadersGuestAdvancedNtscNtscPass3ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass1ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianSincPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassScanpassGlowShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtLottesShaderDef.h"
+#include "RetroArch\crt\shaders\crt-potato\shader-files\CrtShadersCrtPotatoShaderFilesUltra_potatoShaderDef.h"
+#include "RetroArch\crt\shaders\crt-potato\shader-files\CrtShadersCrtPotatoShaderFilesCrtPotatoShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleFirstPassLinearizeCrtGammaBobFieldsShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleScanlinesVerticalInterlacingShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleMaskResizeVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleMaskResizeHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleScanlinesHorizontalApplyMaskShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBrightpassShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomVerticalShaderDef.h"
+#include "RetroArch\crt\shaders\crt-royale\src-fast\CrtShadersCrtRoyaleSrcFastCrtRoyaleBloomHorizontalReconstituteShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersCrtSimpleShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersJinc2ShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowGauss_horizShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowGauss_vertShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowThresholdShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowBlur_horizShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowBlur_vertShaderDef.h"
+#include "RetroArch\crt\shaders\glow\CrtShadersGlowResolveShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimCompositeShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPostDownsampleShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPostUpsampleShaderDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimPresentShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersGizmoCrtShaderDef.h"
+#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsGlowTrails0ShaderDef.h"
+#include "RetroArch\crt\shaders\glow-trails\CrtShadersGlowTrailsGlowTrails1ShaderDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutScanlinesInterlaceLinearizeShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastVerticalShaderDef.h"
+#include "RetroArch\blurs\shaders\royale\BlursShadersRoyaleBlur5fastHorizontalShaderDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutPhosphorlutPass0ShaderDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\CrtShadersPhosphorlutPhosphorlutPass1ShaderDef.h"
+#include "RetroArch\deblur\shaders\DeblurShadersDeblurShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersFastBilateralShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass2ShaderDef.h"
+#include "RetroArch\crt\shaders\hyllian\CrtShadersHyllianCrtHyllianPass0ShaderDef.h"
+#include "RetroArch\denoisers\shaders\DenoisersShadersMedian_3x3ShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersGSharp_resamplerShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass0ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass1ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass2ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass3ShaderDef.h"
+#include "RetroArch\dithering\shaders\mdapt\passes\DitheringShadersMdaptPassesMdaptPass4ShaderDef.h"
+#include "RetroArch\dithering\shaders\DitheringShadersSgenptMixShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportLinearizeShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\support\EdgeSmoothingXbrShadersSupportDelinearizeShaderDef.h"
+#include "RetroArch\edge-smoothing\fsr\shaders\EdgeSmoothingFsrShadersFsrPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\fsr\shaders\EdgeSmoothingFsrShadersFsrPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\nedi\shaders\EdgeSmoothingNediShadersNediJincShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersVhsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersNaturalVisionShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersVibrancePassSh1nra358ShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersRgbToYuvShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass1LumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersNnedi3Nns16Win8x4Pass2LumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2CshiftLumaShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersJinc2OnPassoutput0ShaderDef.h"
+#include "RetroArch\edge-smoothing\nnedi3\shaders\EdgeSmoothingNnedi3ShadersYuvToRgb4xShaderDef.h"
+#include "RetroArch\edge-smoothing\sabr\shaders\EdgeSmoothingSabrShadersSabrHybridDeposterizeShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass3ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\EdgeSmoothingScalefxShadersScalefxPass4ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass0ShaderDef.h"
+#include "RetroArch\anti-aliasing\shaders\reverse-aa-post3x\AntiAliasingShadersReverseAaPost3xReverseAaPost3xPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass2ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass3ShaderDef.h"
+#include "RetroArch\edge-smoothing\scalefx\shaders\old\EdgeSmoothingScalefxShadersOldScalefxPass7ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\xbr-lv3-multipass\EdgeSmoothingXbrShadersXbrLv3MultipassXbrLv3Pass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xsoft\shaders\EdgeSmoothingXsoftShaders4xsoftShaderDef.h"
+#include "RetroArch\film\shaders\FilmShadersFilmGrainShaderDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTLUTShaderDef.h"
+#include "RetroArch\gpu\shaders\GpuShadersPowervr2ShaderDef.h"
+#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgb001ShaderDef.h"
+#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgs001ShaderDef.h"
+#include "RetroArch\handheld\shaders\mgba\HandheldShadersMgbaAgs001LightShaderDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTMultiLUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorDsliteColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBALUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBCLUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGBMLUTShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorGbMicroColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorNdsColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorPalmColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorPspColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorSp101ColorShaderDef.h"
+#include "RetroArch\handheld\shaders\color\HandheldShadersColorVbaColorShaderDef.h"
+#include "RetroArch\motionblur\shaders\MotionblurShadersResponseTimeShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersRetroV2ShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersRetroV3ShaderDef.h"
+#include "RetroArch\handheld\shaders\HandheldShadersSameboyLcdShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersBSpline4TapsShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos25TapsShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline36XShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersSpline36YShaderDef.h"
+#include "RetroArch\linear\LinearLinearizeShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersChromaticityShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersColorManglerShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersColorimetryShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersConvergenceShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersGlassShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersGradeShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersNtscColorsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersSimple_color_controlsShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersSsGammaRampShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersTonemappingShaderDef.h"
+#include "RetroArch\nes_raw_palette\shaders\Nes_raw_paletteShadersNesColorDecoderShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite3phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseShaderDef.h"
+#include "RetroArch\pal\shaders\PalShadersPalR57shellShaderDef.h"
+#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors0ShaderDef.h"
+#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\artifact-colors\NtscShadersArtifactColorsArtifactColors2ShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Svideo3phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite2phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass22phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Svideo2phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive\NtscShadersNtscAdaptiveNtscPass1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive\NtscShadersNtscAdaptiveNtscPass2ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive-tate\NtscShadersNtscAdaptiveTateNtscTatePass1ShaderDef.h"
+#include "RetroArch\ntsc\shaders\ntsc-adaptive-tate\NtscShadersNtscAdaptiveTateNtscTatePass2ShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersBandlimitPixelShaderDef.h"
+#include "RetroArch\pixel-art-scaling\shaders\PixelArtScalingShadersPixellateShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersRewindShaderDef.h"
+#include "RetroArch\subframe-bfi\shaders\SubframeBfiShadersCrtBeamSimulatorShaderDef.h"
+#include "RetroArch\crt\shaders\crt-lottes-multipass\CrtShadersCrtLottesMultipassBloompassGlowShaderDef.h"
+#include "RetroArch\warp\shaders\WarpShadersSmartMorphShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseLinearShaderDef.h"
+#include "RetroArch\downsample\shaders\DownsampleShadersDrezGSharp_resamplerShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbaColor4kShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbaColorShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbcColor4kShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcdGbcColorShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pGbaColorShaderDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\HandheldShadersSimpletex_lcdSimpletex_lcd_720pGbcColorShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1bShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlineShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersScanlinesShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersBloomPassSh1nra358ShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersBlurGaussHShaderDef.h"
+#include "RetroArch\blurs\shaders\BlursShadersBlurGaussVShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersBlurHazeSh1nra358ShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersSnesHiresBlendShaderDef.h"
+#include "RetroArch\edge-smoothing\xsal\shaders\EdgeSmoothingXsalShaders2xsalLevel2XbrShaderDef.h"
+// %SHADER_INCLUDE%
+
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaAreaTexTextureDef.h"
+#include "RetroArch\anti-aliasing\shaders\smaa\AntiAliasingShadersSmaaSearchTexTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPResizeTo64TextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearShadowMaskEDPTextureDef.h"
+#include "RetroArch\border\textures\BorderTexturesPvmTextureDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksAperture_2_4_rgbTextureDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksSlot_2_5x4_bgrTextureDef.h"
+#include "RetroArch\crt\shaders\geom-deluxe\masks\CrtShadersGeomDeluxeMasksDelta_2_4x1_rgbTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutTrinitronLutTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutInvTrinitronLutTextureDef.h"
+#include "RetroArch\crt\shaders\guest\advanced\lut\CrtShadersGuestAdvancedLutNtscLutTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeRgbTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeCompositeTextureDef.h"
+#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesMask1TextureDef.h"
+#include "RetroArch\crt\shaders\crt-potato\resources\CrtShadersCrtPotatoResourcesCrtPotatoThickTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearApertureGrille15Wide8And5d5SpacingResizeTo64BGRTextureDef.h"
+#include "RetroArch\crt\shaders\crt-royale\CrtShadersCrtRoyaleTileableLinearSlotMaskTall15Wide9And4d5Horizontal9d14VerticalSpacingResizeTo64BGRshiftedTextureDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimArtifactsTextureDef.h"
+#include "RetroArch\crt\shaders\crtsim\CrtShadersCrtsimMaskTextureDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsShadowmaskTextureDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsApertureGrilleTextureDef.h"
+#include "RetroArch\crt\shaders\phosphorlut\luts\CrtShadersPhosphorlutLutsSlotmaskTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT64TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutDsliteGreyTextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbaGrey1TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbaGrey2TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbcGrey1TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbcGrey2TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutGbamicroGreyTextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutNdsGreyTextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutPspGrey1TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutPspGrey2TextureDef.h"
+#include "RetroArch\handheld\shaders\color\lut\HandheldShadersColorLutSp101GreyTextureDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\png\4k\HandheldShadersSimpletex_lcdPng4kTextured_paperTextureDef.h"
+#include "RetroArch\handheld\shaders\simpletex_lcd\png\2k\HandheldShadersSimpletex_lcdPng2kTextured_paperTextureDef.h"
+#include "RetroArch\pal\resources\PalResourcesNes_lutTextureDef.h"
+#include "RetroArch\vhs\resources\VhsResourcesRewTextureDef.h"
+#include "RetroArch\vhs\resources\VhsResourcesPlayTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTNEC_XM29plus_captureTextureDef.h"
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\presets\blurs\PresetsBlursDualBloomFilterAaLv2FsrGammaRampGlassPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursDualBloomFilterAaLv2FsrGammaRampPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursDualBloomFilterAaLv2FsrPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampGsharpResamplerPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrGsharpResamplerPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursGizmoCompositeBlurAaLv2FsrPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursKawaseGlowBspline4tapsFsrGammaRampTonemappingPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursSmartblurBspline4tapsFsrGammaRampVhsPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursSmartblurBspline4tapsFsrGammaRampPresetDef.h"
+#include "RetroArch\presets\blurs\PresetsBlursSmartblurBspline4tapsFsrPresetDef.h"
+#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrColorManglerColorimetryPresetDef.h"
+#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrPresetDef.h"
+#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorCrtroyaleNtscSvideoPresetDef.h"
+#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyaleNtscSvideoPresetDef.h"
+#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyalePresetDef.h"
+#include "RetroArch\presets\crt-beam-simulator\PresetsCrtBeamSimulatorCrtBeamSimulatorNnedi3Nns164xLumaFsrCrtroyalePresetDef.h"
+#include "RetroArch\presets\PresetsCrtGeomSimplePresetDef.h"
+#include "RetroArch\presets\PresetsCrtHyllianSincSmartblurSgenptPresetDef.h"
+#include "RetroArch\presets\PresetsCrtHyllianSmartblurSgenptPresetDef.h"
+#include "RetroArch\presets\PresetsCrtLottesMultipassInterlacedGlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpCompositeGlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpCompositePresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x4GlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x4PresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x5GlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x5PresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x6GlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpSvideoNtsc_x6PresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateCompositeGlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateCompositePresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x4GlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x4PresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x5GlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x5PresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x6GlowPresetDef.h"
+#include "RetroArch\presets\crt-ntsc-sharp\PresetsCrtNtscSharpTateSvideoNtsc_x6PresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalC64MonitorPresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtGeomDeluxeNtscAdaptivePresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyaleFastNtscCompositePresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyaleNtscCompositePresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyaleNtscSvideoPresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtRoyalePalR57shellPresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalCrtglow_gauss_ntscPresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalMy_old_tvPresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalNtscPhosphorlutPresetDef.h"
+#include "RetroArch\presets\crt-plus-signal\PresetsCrtPlusSignalNtsclutPhosphorlutPresetDef.h"
+#include "RetroArch\presets\crt-potato\PresetsCrtPotatoCrtPotatoColorimetryConvergencePresetDef.h"
+#include "RetroArch\presets\PresetsCrtRoyaleDownsamplePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePsxPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureSnesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastNtscRfSlotmaskNesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastRgbAperturePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyaleFastRgbSlotPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePsxPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeSnesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmRgbBlendPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmRgbShmupPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\4k\PresetsCrtRoyaleFast4kCrtRoyalePvmRgbPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePsxPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureSnesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastNtscRfSlotmaskNesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastRgbAperturePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyaleFastRgbSlotPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePsxPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeSnesPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmRgbBlendPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmRgbShmupPresetDef.h"
+#include "RetroArch\presets\crt-royale-fast\PresetsCrtRoyaleFastCrtRoyalePvmRgbPresetDef.h"
+#include "RetroArch\presets\PresetsCrtRoyaleKurozumiPresetDef.h"
+#include "RetroArch\presets\PresetsCrtRoyaleSmoothPresetDef.h"
+#include "RetroArch\presets\PresetsCrtRoyaleXm29plusPresetDef.h"
+#include "RetroArch\presets\PresetsCrtsimGrungyPresetDef.h"
+#include "RetroArch\presets\downsample\PresetsDownsampleDrez8xFsrAaLv2Bspline4tapsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Bspline4tapsNtscColorsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Bspline4tapsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2DeblurPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2GlassPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Kawase5blurNtscColorsGlassPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Kawase5blurNtscColorsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3GlassPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3NtscColorsGlassPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3NtscColorsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2Median3x3PresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2NaturalvisionGlassPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2NaturalvisionVhsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2NaturalvisionPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2SabrHybridDeposterizePresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2VhsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrAaLv2PresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoBvmVhsPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoBvmPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoColorimetryConvergencePresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrCrtPotatoWarmColorimetryConvergencePresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrCrtroyaleXm29plusPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrCrtroyalePresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrLv2AaChromacityGlassPresetDef.h"
+#include "RetroArch\presets\fsr\PresetsFsrFsrSmaaColorimetryConvergencePresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtCurvatorPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtMegadriveCurvatorPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtMegadrivePresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtN64CurvatorPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtN64PresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtPsxCurvatorPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtPsxPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnes4kPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnesCurvator4kPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnesDarkCurvatorPresetDef.h"
+#include "RetroArch\presets\gizmo-crt\PresetsGizmoCrtGizmoCrtSnesDarkPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModAgb001GbaColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModAgs001GbaColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModBandlimitPixelGbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2DsliteColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2DsliteColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbaColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbcColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbcColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbMicroColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2GbMicroColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2NdsColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2NdsColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PalmColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PalmColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PspColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2PspColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2Sp101ColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2Sp101ColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2VbaColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModLcdGridV2VbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2GbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2GbcColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2ImageAdjustmentPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2NdsColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2PspColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV2VbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModRetroV3NdsColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSameboyLcdGbcColorMotionblurPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbaColor4kPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbcColor4kPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcdGbcColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcd_720pGbaColorPresetDef.h"
+#include "RetroArch\presets\handheld-plus-color-mod\PresetsHandheldPlusColorModSimpletex_lcd_720pGbcColorPresetDef.h"
+#include "RetroArch\presets\PresetsImgborderRoyaleKurozumiPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2FsrGammaRampPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2FsrPowervrPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2FsrPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsAaLv2PresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationBspline4tapsFsrVhsPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationLanczos25tapsFsrGammaRampVhsPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationLanczos25tapsFsrGammaRampPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationLanczos25tapsFsrPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationSpline36FastFsrGammaRampVhsPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationSpline36FastFsrGammaRampPresetDef.h"
+#include "RetroArch\presets\interpolation\PresetsInterpolationSpline36FastFsrPresetDef.h"
+#include "RetroArch\presets\PresetsMdaptFastBilateralSuper4xbrScanlinesPresetDef.h"
+#include "RetroArch\presets\PresetsNediPowervrSharpenPresetDef.h"
+#include "RetroArch\presets\PresetsNesColorDecoderColorimetryPixellatePresetDef.h"
+#include "RetroArch\presets\PresetsNesColorDecoderPixellatePresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxRAAAaFastPresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxRAAAaPresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxAaFastPresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefxAaPresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefx9AaBlurHazyNtscSh1nra358PresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingScalefx9AaBlurHazyVibranceSh1nra358PresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaSharpsmootherPresetDef.h"
+#include "RetroArch\presets\scalefx-plus-smoothing\PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNesColorDecoderPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc256pxCompositePresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc256pxSvideoPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc2phaseCompositePresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc2phaseSvideoPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc320pxCompositePresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc320pxSvideoPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc3phaseCompositePresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtsc3phaseSvideoPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutNtscNesPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutSnesHiresBlendPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutJincSharpenPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutPixelsharpPresetDef.h"
+#include "RetroArch\presets\tvout\PresetsTvoutTvoutPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNesColorDecoderInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc256pxCompositeInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc256pxSvideoInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc2phaseCompositeInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc2phaseSvideoInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc320pxCompositeInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc320pxSvideoInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc3phaseCompositeInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtsc3phaseSvideoInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutNtscNesInterlacingPresetDef.h"
+#include "RetroArch\presets\tvout+interlacing\PresetsTvoutInterlacingTvoutJincSharpenInterlacingPresetDef.h"
+#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv32xsalLv2AaSoftPresetDef.h"
+#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv32xsalLv2AaPresetDef.h"
+#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv3AaFastPresetDef.h"
+#include "RetroArch\presets\xbr-xsal\PresetsXbrXsalXbrLv3AaSoftFastPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddPresetsPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(543, new PresetsBlursDualBloomFilterAaLv2FsrGammaRampGlassPresetDef());
+    list.emplace_back(544, new PresetsBlursDualBloomFilterAaLv2FsrGammaRampPresetDef());
+    list.emplace_back(545, new PresetsBlursDualBloomFilterAaLv2FsrPresetDef());
+    list.emplace_back(546, new PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampGsharpResamplerPresetDef());
+    list.emplace_back(547, new PresetsBlursGizmoCompositeBlurAaLv2FsrGammaRampPresetDef());
+    list.emplace_back(548, new PresetsBlursGizmoCompositeBlurAaLv2FsrGsharpResamplerPresetDef());
+    list.emplace_back(549, new PresetsBlursGizmoCompositeBlurAaLv2FsrPresetDef());
+    list.emplace_back(550, new PresetsBlursKawaseGlowBspline4tapsFsrGammaRampTonemappingPresetDef());
+    list.emplace_back(551, new PresetsBlursSmartblurBspline4tapsFsrGammaRampVhsPresetDef());
+    list.emplace_back(552, new PresetsBlursSmartblurBspline4tapsFsrGammaRampPresetDef());
+    list.emplace_back(553, new PresetsBlursSmartblurBspline4tapsFsrPresetDef());
+    list.emplace_back(554, new PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrColorManglerColorimetryPresetDef());
+    list.emplace_back(555, new PresetsCrtBeamSimulatorCrtBeamSimulatorCrtFastBilateralSuperXbrPresetDef());
+    list.emplace_back(556, new PresetsCrtBeamSimulatorCrtBeamSimulatorCrtroyaleNtscSvideoPresetDef());
+    list.emplace_back(557, new PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyaleNtscSvideoPresetDef());
+    list.emplace_back(558, new PresetsCrtBeamSimulatorCrtBeamSimulatorFsrCrtroyalePresetDef());
+    list.emplace_back(559, new PresetsCrtBeamSimulatorCrtBeamSimulatorNnedi3Nns164xLumaFsrCrtroyalePresetDef());
+    list.emplace_back(560, new PresetsCrtGeomSimplePresetDef());
+    list.emplace_back(561, new PresetsCrtHyllianSincSmartblurSgenptPresetDef());
+    list.emplace_back(562, new PresetsCrtHyllianSmartblurSgenptPresetDef());
+    list.emplace_back(563, new PresetsCrtLottesMultipassInterlacedGlowPresetDef());
+    list.emplace_back(564, new PresetsCrtNtscSharpCompositeGlowPresetDef());
+    list.emplace_back(565, new PresetsCrtNtscSharpCompositePresetDef());
+    list.emplace_back(566, new PresetsCrtNtscSharpSvideoNtsc_x4GlowPresetDef());
+    list.emplace_back(567, new PresetsCrtNtscSharpSvideoNtsc_x4PresetDef());
+    list.emplace_back(568, new PresetsCrtNtscSharpSvideoNtsc_x5GlowPresetDef());
+    list.emplace_back(569, new PresetsCrtNtscSharpSvideoNtsc_x5PresetDef());
+    list.emplace_back(570, new PresetsCrtNtscSharpSvideoNtsc_x6GlowPresetDef());
+    list.emplace_back(571, new PresetsCrtNtscSharpSvideoNtsc_x6PresetDef());
+    list.emplace_back(572, new PresetsCrtNtscSharpTateCompositeGlowPresetDef());
+    list.emplace_back(573, new PresetsCrtNtscSharpTateCompositePresetDef());
+    list.emplace_back(574, new PresetsCrtNtscSharpTateSvideoNtsc_x4GlowPresetDef());
+    list.emplace_back(575, new PresetsCrtNtscSharpTateSvideoNtsc_x4PresetDef());
+    list.emplace_back(576, new PresetsCrtNtscSharpTateSvideoNtsc_x5GlowPresetDef());
+    list.emplace_back(577, new PresetsCrtNtscSharpTateSvideoNtsc_x5PresetDef());
+    list.emplace_back(578, new PresetsCrtNtscSharpTateSvideoNtsc_x6GlowPresetDef());
+    list.emplace_back(579, new PresetsCrtNtscSharpTateSvideoNtsc_x6PresetDef());
+    list.emplace_back(580, new PresetsCrtPlusSignalC64MonitorPresetDef());
+    list.emplace_back(581, new PresetsCrtPlusSignalCrtGeomDeluxeNtscAdaptivePresetDef());
+    list.emplace_back(582, new PresetsCrtPlusSignalCrtRoyaleFastNtscCompositePresetDef());
+    list.emplace_back(583, new PresetsCrtPlusSignalCrtRoyaleNtscCompositePresetDef());
+    list.emplace_back(584, new PresetsCrtPlusSignalCrtRoyaleNtscSvideoPresetDef());
+    list.emplace_back(585, new PresetsCrtPlusSignalCrtRoyalePalR57shellPresetDef());
+    list.emplace_back(586, new PresetsCrtPlusSignalCrtglow_gauss_ntscPresetDef());
+    list.emplace_back(587, new PresetsCrtPlusSignalMy_old_tvPresetDef());
+    list.emplace_back(588, new PresetsCrtPlusSignalNtscPhosphorlutPresetDef());
+    list.emplace_back(589, new PresetsCrtPlusSignalNtsclutPhosphorlutPresetDef());
+    list.emplace_back(590, new PresetsCrtPotatoCrtPotatoColorimetryConvergencePresetDef());
+    list.emplace_back(591, new PresetsCrtRoyaleDownsamplePresetDef());
+    list.emplace_back(592, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef());
+    list.emplace_back(593, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureGenesisPresetDef());
+    list.emplace_back(594, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePsxPresetDef());
+    list.emplace_back(595, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeApertureSnesPresetDef());
+    list.emplace_back(596, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeAperturePresetDef());
+    list.emplace_back(597, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef());
+    list.emplace_back(598, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef());
+    list.emplace_back(599, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef());
+    list.emplace_back(600, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef());
+    list.emplace_back(601, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscCompositeSlotmaskPresetDef());
+    list.emplace_back(602, new PresetsCrtRoyaleFast4kCrtRoyaleFastNtscRfSlotmaskNesPresetDef());
+    list.emplace_back(603, new PresetsCrtRoyaleFast4kCrtRoyaleFastRgbAperturePresetDef());
+    list.emplace_back(604, new PresetsCrtRoyaleFast4kCrtRoyaleFastRgbSlotPresetDef());
+    list.emplace_back(605, new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef());
+    list.emplace_back(606, new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeGenesisPresetDef());
+    list.emplace_back(607, new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePsxPresetDef());
+    list.emplace_back(608, new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositeSnesPresetDef());
+    list.emplace_back(609, new PresetsCrtRoyaleFast4kCrtRoyalePvmNtscCompositePresetDef());
+    list.emplace_back(610, new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbBlendPresetDef());
+    list.emplace_back(611, new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbShmupPresetDef());
+    list.emplace_back(612, new PresetsCrtRoyaleFast4kCrtRoyalePvmRgbPresetDef());
+    list.emplace_back(613, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisRainbowEffectPresetDef());
+    list.emplace_back(614, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureGenesisPresetDef());
+    list.emplace_back(615, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePsxPresetDef());
+    list.emplace_back(616, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeApertureSnesPresetDef());
+    list.emplace_back(617, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeAperturePresetDef());
+    list.emplace_back(618, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisRainbowEffectPresetDef());
+    list.emplace_back(619, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskGenesisPresetDef());
+    list.emplace_back(620, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPsxPresetDef());
+    list.emplace_back(621, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskSnesPresetDef());
+    list.emplace_back(622, new PresetsCrtRoyaleFastCrtRoyaleFastNtscCompositeSlotmaskPresetDef());
+    list.emplace_back(623, new PresetsCrtRoyaleFastCrtRoyaleFastNtscRfSlotmaskNesPresetDef());
+    list.emplace_back(624, new PresetsCrtRoyaleFastCrtRoyaleFastRgbAperturePresetDef());
+    list.emplace_back(625, new PresetsCrtRoyaleFastCrtRoyaleFastRgbSlotPresetDef());
+    list.emplace_back(626, new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisRainbowEffectPresetDef());
+    list.emplace_back(627, new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeGenesisPresetDef());
+    list.emplace_back(628, new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePsxPresetDef());
+    list.emplace_back(629, new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositeSnesPresetDef());
+    list.emplace_back(630, new PresetsCrtRoyaleFastCrtRoyalePvmNtscCompositePresetDef());
+    list.emplace_back(631, new PresetsCrtRoyaleFastCrtRoyalePvmRgbBlendPresetDef());
+    list.emplace_back(632, new PresetsCrtRoyaleFastCrtRoyalePvmRgbShmupPresetDef());
+    list.emplace_back(633, new PresetsCrtRoyaleFastCrtRoyalePvmRgbPresetDef());
+    list.emplace_back(634, new PresetsCrtRoyaleKurozumiPresetDef());
+    list.emplace_back(635, new PresetsCrtRoyaleSmoothPresetDef());
+    list.emplace_back(636, new PresetsCrtRoyaleXm29plusPresetDef());
+    list.emplace_back(637, new PresetsCrtsimGrungyPresetDef());
+    list.emplace_back(638, new PresetsDownsampleDrez8xFsrAaLv2Bspline4tapsPresetDef());
+    list.emplace_back(639, new PresetsFsrFsrAaLv2Bspline4tapsNtscColorsPresetDef());
+    list.emplace_back(640, new PresetsFsrFsrAaLv2Bspline4tapsPresetDef());
+    list.emplace_back(641, new PresetsFsrFsrAaLv2DeblurPresetDef());
+    list.emplace_back(642, new PresetsFsrFsrAaLv2GlassPresetDef());
+    list.emplace_back(643, new PresetsFsrFsrAaLv2Kawase5blurNtscColorsGlassPresetDef());
+    list.emplace_back(644, new PresetsFsrFsrAaLv2Kawase5blurNtscColorsPresetDef());
+    list.emplace_back(645, new PresetsFsrFsrAaLv2Median3x3GlassPresetDef());
+    list.emplace_back(646, new PresetsFsrFsrAaLv2Median3x3NtscColorsGlassPresetDef());
+    list.emplace_back(647, new PresetsFsrFsrAaLv2Median3x3NtscColorsPresetDef());
+    list.emplace_back(648, new PresetsFsrFsrAaLv2Median3x3PresetDef());
+    list.emplace_back(649, new PresetsFsrFsrAaLv2NaturalvisionGlassPresetDef());
+    list.emplace_back(650, new PresetsFsrFsrAaLv2NaturalvisionVhsPresetDef());
+    list.emplace_back(651, new PresetsFsrFsrAaLv2NaturalvisionPresetDef());
+    list.emplace_back(652, new PresetsFsrFsrAaLv2SabrHybridDeposterizePresetDef());
+    list.emplace_back(653, new PresetsFsrFsrAaLv2VhsPresetDef());
+    list.emplace_back(654, new PresetsFsrFsrAaLv2PresetDef());
+    list.emplace_back(655, new PresetsFsrFsrCrtPotatoBvmVhsPresetDef());
+    list.emplace_back(656, new PresetsFsrFsrCrtPotatoBvmPresetDef());
+    list.emplace_back(657, new PresetsFsrFsrCrtPotatoColorimetryConvergencePresetDef());
+    list.emplace_back(658, new PresetsFsrFsrCrtPotatoWarmColorimetryConvergencePresetDef());
+    list.emplace_back(659, new PresetsFsrFsrCrtroyaleXm29plusPresetDef());
+    list.emplace_back(660, new PresetsFsrFsrCrtroyalePresetDef());
+    list.emplace_back(661, new PresetsFsrFsrLv2AaChromacityGlassPresetDef());
+    list.emplace_back(662, new PresetsFsrFsrSmaaColorimetryConvergencePresetDef());
+    list.emplace_back(663, new PresetsGizmoCrtGizmoCrtCurvatorPresetDef());
+    list.emplace_back(664, new PresetsGizmoCrtGizmoCrtMegadriveCurvatorPresetDef());
+    list.emplace_back(665, new PresetsGizmoCrtGizmoCrtMegadrivePresetDef());
+    list.emplace_back(666, new PresetsGizmoCrtGizmoCrtN64CurvatorPresetDef());
+    list.emplace_back(667, new PresetsGizmoCrtGizmoCrtN64PresetDef());
+    list.emplace_back(668, new PresetsGizmoCrtGizmoCrtPsxCurvatorPresetDef());
+    list.emplace_back(669, new PresetsGizmoCrtGizmoCrtPsxPresetDef());
+    list.emplace_back(670, new PresetsGizmoCrtGizmoCrtSnes4kPresetDef());
+    list.emplace_back(671, new PresetsGizmoCrtGizmoCrtSnesCurvator4kPresetDef());
+    list.emplace_back(672, new PresetsGizmoCrtGizmoCrtSnesDarkCurvatorPresetDef());
+    list.emplace_back(673, new PresetsGizmoCrtGizmoCrtSnesDarkPresetDef());
+    list.emplace_back(674, new PresetsHandheldPlusColorModAgb001GbaColorMotionblurPresetDef());
+    list.emplace_back(675, new PresetsHandheldPlusColorModAgs001GbaColorMotionblurPresetDef());
+    list.emplace_back(676, new PresetsHandheldPlusColorModBandlimitPixelGbaColorPresetDef());
+    list.emplace_back(677, new PresetsHandheldPlusColorModLcdGridV2DsliteColorMotionblurPresetDef());
+    list.emplace_back(678, new PresetsHandheldPlusColorModLcdGridV2DsliteColorPresetDef());
+    list.emplace_back(679, new PresetsHandheldPlusColorModLcdGridV2GbaColorMotionblurPresetDef());
+    list.emplace_back(680, new PresetsHandheldPlusColorModLcdGridV2GbaColorPresetDef());
+    list.emplace_back(681, new PresetsHandheldPlusColorModLcdGridV2GbcColorMotionblurPresetDef());
+    list.emplace_back(682, new PresetsHandheldPlusColorModLcdGridV2GbcColorPresetDef());
+    list.emplace_back(683, new PresetsHandheldPlusColorModLcdGridV2GbMicroColorMotionblurPresetDef());
+    list.emplace_back(684, new PresetsHandheldPlusColorModLcdGridV2GbMicroColorPresetDef());
+    list.emplace_back(685, new PresetsHandheldPlusColorModLcdGridV2NdsColorMotionblurPresetDef());
+    list.emplace_back(686, new PresetsHandheldPlusColorModLcdGridV2NdsColorPresetDef());
+    list.emplace_back(687, new PresetsHandheldPlusColorModLcdGridV2PalmColorMotionblurPresetDef());
+    list.emplace_back(688, new PresetsHandheldPlusColorModLcdGridV2PalmColorPresetDef());
+    list.emplace_back(689, new PresetsHandheldPlusColorModLcdGridV2PspColorMotionblurPresetDef());
+    list.emplace_back(690, new PresetsHandheldPlusColorModLcdGridV2PspColorPresetDef());
+    list.emplace_back(691, new PresetsHandheldPlusColorModLcdGridV2Sp101ColorMotionblurPresetDef());
+    list.emplace_back(692, new PresetsHandheldPlusColorModLcdGridV2Sp101ColorPresetDef());
+    list.emplace_back(693, new PresetsHandheldPlusColorModLcdGridV2VbaColorMotionblurPresetDef());
+    list.emplace_back(694, new PresetsHandheldPlusColorModLcdGridV2VbaColorPresetDef());
+    list.emplace_back(695, new PresetsHandheldPlusColorModRetroV2GbaColorPresetDef());
+    list.emplace_back(696, new PresetsHandheldPlusColorModRetroV2GbcColorPresetDef());
+    list.emplace_back(697, new PresetsHandheldPlusColorModRetroV2ImageAdjustmentPresetDef());
+    list.emplace_back(698, new PresetsHandheldPlusColorModRetroV2NdsColorPresetDef());
+    list.emplace_back(699, new PresetsHandheldPlusColorModRetroV2PspColorPresetDef());
+    list.emplace_back(700, new PresetsHandheldPlusColorModRetroV2VbaColorPresetDef());
+    list.emplace_back(701, new PresetsHandheldPlusColorModRetroV3NdsColorPresetDef());
+    list.emplace_back(702, new PresetsHandheldPlusColorModSameboyLcdGbcColorMotionblurPresetDef());
+    list.emplace_back(703, new PresetsHandheldPlusColorModSimpletex_lcdGbaColor4kPresetDef());
+    list.emplace_back(704, new PresetsHandheldPlusColorModSimpletex_lcdGbaColorPresetDef());
+    list.emplace_back(705, new PresetsHandheldPlusColorModSimpletex_lcdGbcColor4kPresetDef());
+    list.emplace_back(706, new PresetsHandheldPlusColorModSimpletex_lcdGbcColorPresetDef());
+    list.emplace_back(707, new PresetsHandheldPlusColorModSimpletex_lcd_720pGbaColorPresetDef());
+    list.emplace_back(708, new PresetsHandheldPlusColorModSimpletex_lcd_720pGbcColorPresetDef());
+    list.emplace_back(709, new PresetsImgborderRoyaleKurozumiPresetDef());
+    list.emplace_back(710, new PresetsInterpolationBspline4tapsAaLv2FsrGammaRampPresetDef());
+    list.emplace_back(711, new PresetsInterpolationBspline4tapsAaLv2FsrPowervrPresetDef());
+    list.emplace_back(712, new PresetsInterpolationBspline4tapsAaLv2FsrPresetDef());
+    list.emplace_back(713, new PresetsInterpolationBspline4tapsAaLv2PresetDef());
+    list.emplace_back(714, new PresetsInterpolationBspline4tapsFsrVhsPresetDef());
+    list.emplace_back(715, new PresetsInterpolationLanczos25tapsFsrGammaRampVhsPresetDef());
+    list.emplace_back(716, new PresetsInterpolationLanczos25tapsFsrGammaRampPresetDef());
+    list.emplace_back(717, new PresetsInterpolationLanczos25tapsFsrPresetDef());
+    list.emplace_back(718, new PresetsInterpolationSpline36FastFsrGammaRampVhsPresetDef());
+    list.emplace_back(719, new PresetsInterpolationSpline36FastFsrGammaRampPresetDef());
+    list.emplace_back(720, new PresetsInterpolationSpline36FastFsrPresetDef());
+    list.emplace_back(721, new PresetsMdaptFastBilateralSuper4xbrScanlinesPresetDef());
+    list.emplace_back(722, new PresetsNediPowervrSharpenPresetDef());
+    list.emplace_back(723, new PresetsNesColorDecoderColorimetryPixellatePresetDef());
+    list.emplace_back(724, new PresetsNesColorDecoderPixellatePresetDef());
+    list.emplace_back(725, new PresetsScalefxPlusSmoothingScalefxRAAAaFastPresetDef());
+    list.emplace_back(726, new PresetsScalefxPlusSmoothingScalefxRAAAaPresetDef());
+    list.emplace_back(727, new PresetsScalefxPlusSmoothingScalefxAaFastPresetDef());
+    list.emplace_back(728, new PresetsScalefxPlusSmoothingScalefxAaPresetDef());
+    list.emplace_back(729, new PresetsScalefxPlusSmoothingScalefx9AaBlurHazyNtscSh1nra358PresetDef());
+    list.emplace_back(730, new PresetsScalefxPlusSmoothingScalefx9AaBlurHazyVibranceSh1nra358PresetDef());
+    list.emplace_back(731, new PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaSharpsmootherPresetDef());
+    list.emplace_back(732, new PresetsScalefxPlusSmoothingXsoftScalefxLevel2aaPresetDef());
+    list.emplace_back(733, new PresetsTvoutTvoutNesColorDecoderPresetDef());
+    list.emplace_back(734, new PresetsTvoutTvoutNtsc256pxCompositePresetDef());
+    list.emplace_back(735, new PresetsTvoutTvoutNtsc256pxSvideoPresetDef());
+    list.emplace_back(736, new PresetsTvoutTvoutNtsc2phaseCompositePresetDef());
+    list.emplace_back(737, new PresetsTvoutTvoutNtsc2phaseSvideoPresetDef());
+    list.emplace_back(738, new PresetsTvoutTvoutNtsc320pxCompositePresetDef());
+    list.emplace_back(739, new PresetsTvoutTvoutNtsc320pxSvideoPresetDef());
+    list.emplace_back(740, new PresetsTvoutTvoutNtsc3phaseCompositePresetDef());
+    list.emplace_back(741, new PresetsTvoutTvoutNtsc3phaseSvideoPresetDef());
+    list.emplace_back(742, new PresetsTvoutTvoutNtscNesPresetDef());
+    list.emplace_back(743, new PresetsTvoutTvoutSnesHiresBlendPresetDef());
+    list.emplace_back(744, new PresetsTvoutTvoutJincSharpenPresetDef());
+    list.emplace_back(745, new PresetsTvoutTvoutPixelsharpPresetDef());
+    list.emplace_back(746, new PresetsTvoutTvoutPresetDef());
+    list.emplace_back(747, new PresetsTvoutInterlacingTvoutInterlacingPresetDef());
+    list.emplace_back(748, new PresetsTvoutInterlacingTvoutNesColorDecoderInterlacingPresetDef());
+    list.emplace_back(749, new PresetsTvoutInterlacingTvoutNtsc256pxCompositeInterlacingPresetDef());
+    list.emplace_back(750, new PresetsTvoutInterlacingTvoutNtsc256pxSvideoInterlacingPresetDef());
+    list.emplace_back(751, new PresetsTvoutInterlacingTvoutNtsc2phaseCompositeInterlacingPresetDef());
+    list.emplace_back(752, new PresetsTvoutInterlacingTvoutNtsc2phaseSvideoInterlacingPresetDef());
+    list.emplace_back(753, new PresetsTvoutInterlacingTvoutNtsc320pxCompositeInterlacingPresetDef());
+    list.emplace_back(754, new PresetsTvoutInterlacingTvoutNtsc320pxSvideoInterlacingPresetDef());
+    list.emplace_back(755, new PresetsTvoutInterlacingTvoutNtsc3phaseCompositeInterlacingPresetDef());
+    list.emplace_back(756, new PresetsTvoutInterlacingTvoutNtsc3phaseSvideoInterlacingPresetDef());
+    list.emplace_back(757, new PresetsTvoutInterlacingTvoutNtscNesInterlacingPresetDef());
+    list.emplace_back(758, new PresetsTvoutInterlacingTvoutJincSharpenInterlacingPresetDef());
+    list.emplace_back(759, new PresetsXbrXsalXbrLv32xsalLv2AaSoftPresetDef());
+    list.emplace_back(760, new PresetsXbrXsalXbrLv32xsalLv2AaPresetDef());
+    list.emplace_back(761, new PresetsXbrXsalXbrLv3AaFastPresetDef());
+    list.emplace_back(762, new PresetsXbrXsalXbrLv3AaSoftFastPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,245 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass0ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass1ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass2ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass3ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomBloomPass4ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass0ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass1ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensFlarePass2ShaderDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLightingCombineShaderDef.h"
+#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayBlendoverlayShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersVibrancePassSh1nra358ShaderDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTLUTShaderDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTMultiLUTShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersScanlinesShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersBloomPassSh1nra358ShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersBlurHazeSh1nra358ShaderDef.h"
+#include "RetroArch\reshade\shaders\ReshadeShadersFilmGrainShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_1ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_2ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_3ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_4ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_5ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_6ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_7ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blur_pass_8ShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_get_small_lumaShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_get_adaptShaderDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicbloom_blendShaderDef.h"
+#include "RetroArch\reshade\shaders\NormalsDisplacement\ReshadeShadersNormalsDisplacementNormalsDisplacementShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensDBTextureDef.h"
+#include "RetroArch\reshade\shaders\bloom\ReshadeShadersBloomLensSpriteTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeRgbTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTGradeCompositeTextureDef.h"
+#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayShadowmask4x4TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTCmyk16TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT64TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT32TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUT16TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTNEC_XM29plus_captureTextureDef.h"
+#include "RetroArch\reshade\shaders\blendoverlay\ReshadeShadersBlendoverlayGrayscale_slotmaskTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\ReshadeShadersLUTBsnesTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLite2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLite2020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteP3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldDSLiteSRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA2020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBAP3DarkTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBAP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBAP3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA2020DarkTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBASRGBDarkTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBASRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBASRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA_GBC2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA_GBCP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBA_GBCSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCDevTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBC2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBC2020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCP3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBCSRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicro2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicro2020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroP3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldGBMicroSRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDS2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDS2020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSP3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNDSSRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNSOGBATextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldNSOGBCTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSP2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSP2020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPP3PureGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPP3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSP2020PureGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPSRGBPureGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldPSPSRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP1012020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP1012020ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101P3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101P3ColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101SRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSP101SRGBColdTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDP3PureGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDP3TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLED2020PureGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLED2020TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDSRGBPureGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDSRGBTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLED2020GammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDP3GammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldSWOLEDSRGBGammaTextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldVBA1TextureDef.h"
+#include "RetroArch\reshade\shaders\LUT\handheld\ReshadeShadersLUTHandheldVBA2TextureDef.h"
+#include "RetroArch\reshade\shaders\magicbloom\ReshadeShadersMagicbloomMagicBloom_DirtTextureDef.h"
+#include "RetroArch\reshade\shaders\NormalsDisplacement\ReshadeShadersNormalsDisplacementCurveNormalsTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersCmykHalftoneDotShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\reshade\ReshadeBlendoverlayPresetDef.h"
+#include "RetroArch\reshade\ReshadeBloomPresetDef.h"
+#include "RetroArch\reshade\ReshadeBsnesGammaRampPresetDef.h"
+#include "RetroArch\reshade\ReshadeFilmGrainPresetDef.h"
+#include "RetroArch\reshade\ReshadeHalftonePrintPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsDSLite2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsDSLiteP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsDSLiteSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBAP3DarkPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBAP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBARec2020DarkPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBARec2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBASRGBDarkPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBASRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA_GBC2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA_GBCP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBA_GBCSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCDevColorspacePresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBC2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCRec2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBCSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBMicro2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBMicroP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsGBMicroSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDS2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDSP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDSRec2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNDSSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNSOGBAPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsNSOGBCPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSP2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPP3PureGamma22PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPRec2020SRGBGamma22PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPRec2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPSRGBSRGBGamma22PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsPSPSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSP1012020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSP101P3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSP101SRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDP3SRGBGamma22PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDRec2020SRGBGamma22PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDRec2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDSRGBSRGBGamma22PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSwitchOLEDSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSWOLED2020PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSWOLEDP3PresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsSWOLEDSRGBPresetDef.h"
+#include "RetroArch\reshade\handheld-color-LUTs\ReshadeHandheldColorLUTsVBAColorspacePresetDef.h"
+#include "RetroArch\reshade\ReshadeLutPresetDef.h"
+#include "RetroArch\reshade\ReshadeMagicbloomPresetDef.h"
+#include "RetroArch\reshade\ReshadeNormalsDisplacementPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddReshadePresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(763, new ReshadeBlendoverlayPresetDef());
+    list.emplace_back(764, new ReshadeBloomPresetDef());
+    list.emplace_back(765, new ReshadeBsnesGammaRampPresetDef());
+    list.emplace_back(766, new ReshadeFilmGrainPresetDef());
+    list.emplace_back(767, new ReshadeHalftonePrintPresetDef());
+    list.emplace_back(768, new ReshadeHandheldColorLUTsDSLite2020PresetDef());
+    list.emplace_back(769, new ReshadeHandheldColorLUTsDSLiteP3PresetDef());
+    list.emplace_back(770, new ReshadeHandheldColorLUTsDSLiteSRGBPresetDef());
+    list.emplace_back(771, new ReshadeHandheldColorLUTsGBA2020PresetDef());
+    list.emplace_back(772, new ReshadeHandheldColorLUTsGBAP3DarkPresetDef());
+    list.emplace_back(773, new ReshadeHandheldColorLUTsGBAP3PresetDef());
+    list.emplace_back(774, new ReshadeHandheldColorLUTsGBARec2020DarkPresetDef());
+    list.emplace_back(775, new ReshadeHandheldColorLUTsGBARec2020PresetDef());
+    list.emplace_back(776, new ReshadeHandheldColorLUTsGBASRGBDarkPresetDef());
+    list.emplace_back(777, new ReshadeHandheldColorLUTsGBASRGBPresetDef());
+    list.emplace_back(778, new ReshadeHandheldColorLUTsGBA_GBC2020PresetDef());
+    list.emplace_back(779, new ReshadeHandheldColorLUTsGBA_GBCP3PresetDef());
+    list.emplace_back(780, new ReshadeHandheldColorLUTsGBA_GBCSRGBPresetDef());
+    list.emplace_back(781, new ReshadeHandheldColorLUTsGBCDevColorspacePresetDef());
+    list.emplace_back(782, new ReshadeHandheldColorLUTsGBC2020PresetDef());
+    list.emplace_back(783, new ReshadeHandheldColorLUTsGBCP3PresetDef());
+    list.emplace_back(784, new ReshadeHandheldColorLUTsGBCRec2020PresetDef());
+    list.emplace_back(785, new ReshadeHandheldColorLUTsGBCSRGBPresetDef());
+    list.emplace_back(786, new ReshadeHandheldColorLUTsGBMicro2020PresetDef());
+    list.emplace_back(787, new ReshadeHandheldColorLUTsGBMicroP3PresetDef());
+    list.emplace_back(788, new ReshadeHandheldColorLUTsGBMicroSRGBPresetDef());
+    list.emplace_back(789, new ReshadeHandheldColorLUTsNDS2020PresetDef());
+    list.emplace_back(790, new ReshadeHandheldColorLUTsNDSP3PresetDef());
+    list.emplace_back(791, new ReshadeHandheldColorLUTsNDSRec2020PresetDef());
+    list.emplace_back(792, new ReshadeHandheldColorLUTsNDSSRGBPresetDef());
+    list.emplace_back(793, new ReshadeHandheldColorLUTsNSOGBAPresetDef());
+    list.emplace_back(794, new ReshadeHandheldColorLUTsNSOGBCPresetDef());
+    list.emplace_back(795, new ReshadeHandheldColorLUTsPSP2020PresetDef());
+    list.emplace_back(796, new ReshadeHandheldColorLUTsPSPP3PureGamma22PresetDef());
+    list.emplace_back(797, new ReshadeHandheldColorLUTsPSPP3PresetDef());
+    list.emplace_back(798, new ReshadeHandheldColorLUTsPSPRec2020SRGBGamma22PresetDef());
+    list.emplace_back(799, new ReshadeHandheldColorLUTsPSPRec2020PresetDef());
+    list.emplace_back(800, new ReshadeHandheldColorLUTsPSPSRGBSRGBGamma22PresetDef());
+    list.emplace_back(801, new ReshadeHandheldColorLUTsPSPSRGBPresetDef());
+    list.emplace_back(802, new ReshadeHandheldColorLUTsSP1012020PresetDef());
+    list.emplace_back(803, new ReshadeHandheldColorLUTsSP101P3PresetDef());
+    list.emplace_back(804, new ReshadeHandheldColorLUTsSP101SRGBPresetDef());
+    list.emplace_back(805, new ReshadeHandheldColorLUTsSwitchOLEDP3SRGBGamma22PresetDef());
+    list.emplace_back(806, new ReshadeHandheldColorLUTsSwitchOLEDP3PresetDef());
+    list.emplace_back(807, new ReshadeHandheldColorLUTsSwitchOLEDRec2020SRGBGamma22PresetDef());
+    list.emplace_back(808, new ReshadeHandheldColorLUTsSwitchOLEDRec2020PresetDef());
+    list.emplace_back(809, new ReshadeHandheldColorLUTsSwitchOLEDSRGBSRGBGamma22PresetDef());
+    list.emplace_back(810, new ReshadeHandheldColorLUTsSwitchOLEDSRGBPresetDef());
+    list.emplace_back(811, new ReshadeHandheldColorLUTsSWOLED2020PresetDef());
+    list.emplace_back(812, new ReshadeHandheldColorLUTsSWOLEDP3PresetDef());
+    list.emplace_back(813, new ReshadeHandheldColorLUTsSWOLEDSRGBPresetDef());
+    list.emplace_back(814, new ReshadeHandheldColorLUTsVBAColorspacePresetDef());
+    list.emplace_back(815, new ReshadeLutPresetDef());
+    list.emplace_back(816, new ReshadeMagicbloomPresetDef());
+    list.emplace_back(817, new ReshadeNormalsDisplacementPresetDef());
+// %PRESET_CLASS%
+}
+}
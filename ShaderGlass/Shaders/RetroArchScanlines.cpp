@@ -0,0 +1,52 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlineShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersIntegerScalingScanlinesShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersOsscShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersResIndependentScanlinesShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlineFractShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlinesRereShaderDef.h"
+#include "RetroArch\scanlines\shaders\ScanlinesShadersScanlinesSineAbsShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos3XShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersLanczos3YShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersSimple_color_controlsShaderDef.h"
+#include "RetroArch\crt\shaders\CrtShadersSlotmaskShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\scanlines\ScanlinesIntegerScalingScanlinesPresetDef.h"
+#include "RetroArch\scanlines\ScanlinesOsscPresetDef.h"
+#include "RetroArch\scanlines\ScanlinesOssc_slotPresetDef.h"
+#include "RetroArch\scanlines\ScanlinesResIndependentScanlinesPresetDef.h"
+#include "RetroArch\scanlines\ScanlinesScanlineFractPresetDef.h"
+#include "RetroArch\scanlines\ScanlinesScanlinePresetDef.h"
+#include "RetroArch\scanlines\ScanlinesScanlinesRerePresetDef.h"
+#include "RetroArch\scanlines\ScanlinesScanlinesSineAbsPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddScanlinesPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(818, new ScanlinesIntegerScalingScanlinesPresetDef());
+    list.emplace_back(819, new ScanlinesOsscPresetDef());
+    list.emplace_back(820, new ScanlinesOssc_slotPresetDef());
+    list.emplace_back(821, new ScanlinesResIndependentScanlinesPresetDef());
+    list.emplace_back(822, new ScanlinesScanlineFractPresetDef());
+    list.emplace_back(823, new ScanlinesScanlinePresetDef());
+    list.emplace_back(824, new ScanlinesScanlinesRerePresetDef());
+    list.emplace_back(825, new ScanlinesScanlinesSineAbsPresetDef());
+// %PRESET_CLASS%
+}
+}
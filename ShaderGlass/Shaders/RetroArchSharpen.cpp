@@ -0,0 +1,56 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersFastSharpenShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersRcasShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersCheapSharpenShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenPass1ShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersAdaptiveSharpenPass2ShaderDef.h"
+#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kComputeLumShaderDef.h"
+#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kPushShaderDef.h"
+#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kComputeGradientShaderDef.h"
+#include "RetroArch\sharpen\shaders\anime4k\SharpenShadersAnime4kAnime4kPushgradWeakShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersDiffShaderDef.h"
+#include "RetroArch\sharpen\shaders\SharpenShadersSuperResExShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass0ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass1ShaderDef.h"
+#include "RetroArch\edge-smoothing\xbr\shaders\super-xbr\EdgeSmoothingXbrShadersSuperXbrSuperXbrPass2ShaderDef.h"
+#include "RetroArch\interpolation\shaders\InterpolationShadersCubicShaderDef.h"
+#include "RetroArch\misc\shaders\deposterize\MiscShadersDeposterizeDeposterizePass0ShaderDef.h"
+#include "RetroArch\misc\shaders\deposterize\MiscShadersDeposterizeDeposterizePass1ShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\sharpen\SharpenAdaptiveSharpenMultipassPresetDef.h"
+#include "RetroArch\sharpen\SharpenAdaptiveSharpenPresetDef.h"
+#include "RetroArch\sharpen\SharpenAnime4kPresetDef.h"
+#include "RetroArch\sharpen\SharpenCheapSharpenPresetDef.h"
+#include "RetroArch\sharpen\SharpenRca_sharpenPresetDef.h"
+#include "RetroArch\sharpen\SharpenSuperXbrSuperResPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddSharpenPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(826, new SharpenAdaptiveSharpenMultipassPresetDef());
+    list.emplace_back(827, new SharpenAdaptiveSharpenPresetDef());
+    list.emplace_back(828, new SharpenAnime4kPresetDef());
+    list.emplace_back(829, new SharpenCheapSharpenPresetDef());
+    list.emplace_back(830, new SharpenRca_sharpenPresetDef());
+    list.emplace_back(831, new SharpenSuperXbrSuperResPresetDef());
+// %PRESET_CLASS%
+}
+}
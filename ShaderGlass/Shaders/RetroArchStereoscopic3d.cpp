@@ -0,0 +1,51 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersAnaglyphToSideBySideShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrVRShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrChromaticShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrFilmicSharpenShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrVR_noseShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersShutterToAnaglyphShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersShutterToSideBySideShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersSideBySideSimpleShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersSbsToInterlacedShaderDef.h"
+#include "RetroArch\stereoscopic-3d\shaders\Stereoscopic3dShadersSbsToShutterShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\stereoscopic-3d\shaders\fubax_vr\Stereoscopic3dShadersFubax_vrNoseTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dAnaglyphToSideBySidePresetDef.h"
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dFubax_vrPresetDef.h"
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dShutterToAnaglyphPresetDef.h"
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dShutterToSideBySidePresetDef.h"
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dSideBySideSimplePresetDef.h"
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dSideBySideToInterlacedPresetDef.h"
+#include "RetroArch\stereoscopic-3d\Stereoscopic3dSideBySideToShutterPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddStereoscopic3dPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(832, new Stereoscopic3dAnaglyphToSideBySidePresetDef());
+    list.emplace_back(833, new Stereoscopic3dFubax_vrPresetDef());
+    list.emplace_back(834, new Stereoscopic3dShutterToAnaglyphPresetDef());
+    list.emplace_back(835, new Stereoscopic3dShutterToSideBySidePresetDef());
+    list.emplace_back(836, new Stereoscopic3dSideBySideSimplePresetDef());
+    list.emplace_back(837, new Stereoscopic3dSideBySideToInterlacedPresetDef());
+    list.emplace_back(838, new Stereoscopic3dSideBySideToShutterPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,30 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\stock\StockStockShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\stock\StockBilinearPresetDef.h"
+#include "RetroArch\stock\StockNearestPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddStockPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(102, new StockBilinearPresetDef());
+    list.emplace_back(493, new StockNearestPresetDef());
+// %PRESET_CLASS%
+}
+}
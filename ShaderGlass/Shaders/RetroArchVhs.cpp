@@ -0,0 +1,63 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\vhs\shaders\VhsShadersVhsShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersRewindShaderDef.h"
+#include "RetroArch\vhs\shaders\gristleVHS\VhsShadersGristleVHSHorizontalSoftenShaderDef.h"
+#include "RetroArch\vhs\shaders\gristleVHS\VhsShadersGristleVHSVHSShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersMudlordPalVhsShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersStaticShaderDef.h"
+#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_ThirdShaderDef.h"
+#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_TapeShaderDef.h"
+#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_FirstShaderDef.h"
+#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_SecondShaderDef.h"
+#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_ForthShaderDef.h"
+#include "RetroArch\vhs\shaders\VHSPro\VhsShadersVHSProVHSPro_ClearShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersVhs_and_crt_godotShaderDef.h"
+#include "RetroArch\vhs\shaders\VhsShadersVhs_fontShaderDef.h"
+#include "RetroArch\vhs\shaders\vhs_mpalko\VhsShadersVhs_mpalkoVhs_mpalko_pass0ShaderDef.h"
+#include "RetroArch\vhs\shaders\vhs_mpalko\VhsShadersVhs_mpalkoVhs_mpalko_pass1ShaderDef.h"
+// %SHADER_DEFINITION%
+
+#include "RetroArch\vhs\resources\VhsResourcesRewTextureDef.h"
+#include "RetroArch\vhs\resources\VhsResourcesPlayTextureDef.h"
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+#include "RetroArch\stock\StockStockShaderDef.h"
+#include "RetroArch\misc\shaders\MiscShadersImageAdjustmentShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass1Composite3phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscPass23phaseShaderDef.h"
+#include "RetroArch\ntsc\shaders\maister\NtscShadersMaisterNtscStockShaderDef.h"
+#include "RetroArch\blurs\shaders\sunset_gaussian\BlursShadersSunset_gaussianSunset_horzShaderDef.h"
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\vhs\VhsGristleVHSPresetDef.h"
+#include "RetroArch\vhs\VhsMudlordPalVhsPresetDef.h"
+#include "RetroArch\vhs\VhsNtscVcrPresetDef.h"
+#include "RetroArch\vhs\VhsVhsPresetDef.h"
+#include "RetroArch\vhs\VhsVHSProPresetDef.h"
+#include "RetroArch\vhs\VhsVhs_and_crt_godotPresetDef.h"
+#include "RetroArch\vhs\VhsVhs_mpalkoPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddVhsPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(839, new VhsGristleVHSPresetDef());
+    list.emplace_back(840, new VhsMudlordPalVhsPresetDef());
+    list.emplace_back(841, new VhsNtscVcrPresetDef());
+    list.emplace_back(842, new VhsVhsPresetDef());
+    list.emplace_back(843, new VhsVHSProPresetDef());
+    list.emplace_back(844, new VhsVhs_and_crt_godotPresetDef());
+    list.emplace_back(845, new VhsVhs_mpalkoPresetDef());
+// %PRESET_CLASS%
+}
+}
@@ -0,0 +1,29 @@
+#include "pch.h"
+
+#include "..\ShaderList.h"
+
+// shaders and textures of this category, defined here only
+#define GENERATED_DEFINITIONS
+#include "RetroArch\warp\shaders\WarpShadersSmartMorphShaderDef.h"
+#include "RetroArch\warp\shaders\WarpShadersDilationShaderDef.h"
+// %SHADER_DEFINITION%
+
+// %TEXTURE_DEFINITION%
+#undef GENERATED_DEFINITIONS
+
+// shaders and textures of other categories its presets use
+// %SHADER_INCLUDE%
+
+// %TEXTURE_INCLUDE%
+
+#include "RetroArch\warp\WarpDilationPresetDef.h"
+// %PRESET_INCLUDE%
+
+namespace RetroArch
+{
+void AddWarpPresets(std::vector<std::pair<int, PresetDef*>>& list)
+{
+    list.emplace_back(846, new WarpDilationPresetDef());
+// %PRESET_CLASS%
+}
+}
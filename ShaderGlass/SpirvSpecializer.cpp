@@ -0,0 +1,161 @@
+#include "pch.h"
+
+#include "SpirvSpecializer.h"
+#include <set>
+#include <stdexcept>
+
+constexpr uint32_t SPIRV_MAGIC  = 0x07230203;
+constexpr size_t   SPIRV_HEADER = 5; // words before the first instruction
+
+// opcodes and storage classes used, from the SPIR-V specification
+constexpr uint32_t OP_MEMBER_NAME            = 6;
+constexpr uint32_t OP_TYPE_INT               = 21;
+constexpr uint32_t OP_TYPE_FLOAT             = 22;
+constexpr uint32_t OP_TYPE_POINTER           = 32;
+constexpr uint32_t OP_CONSTANT               = 43;
+constexpr uint32_t OP_FUNCTION               = 54;
+constexpr uint32_t OP_VARIABLE               = 59;
+constexpr uint32_t OP_LOAD                   = 61;
+constexpr uint32_t OP_ACCESS_CHAIN           = 65;
+constexpr uint32_t OP_IN_BOUNDS_ACCESS_CHAIN = 66;
+constexpr uint32_t OP_DECORATE               = 71;
+constexpr uint32_t STORAGE_UNIFORM           = 2;
+constexpr uint32_t STORAGE_PUSH_CONSTANT     = 9;
+
+static std::string literalString(const uint32_t* words, size_t count)
+{
+    std::string text(reinterpret_cast<const char*>(words), count * sizeof(uint32_t));
+    return text.substr(0, text.find('\0'));
+}
+
+int SpecializeSpirv(std::vector<uint32_t>& module, const std::map<std::string, float>& constants)
+{
+    if(module.size() < SPIRV_HEADER || module[0] != SPIRV_MAGIC)
+        throw std::runtime_error("Not a SPIR-V module");
+
+    struct Fold
+    {
+        size_t   offset; // of the load
+        uint32_t type;
+        uint32_t id;
+        float    value;
+    };
+
+    std::map<std::pair<uint32_t, uint32_t>, std::string> memberNames; // by struct and member index
+    std::set<uint32_t>                                   intTypes;
+    std::set<uint32_t>                                   floatTypes;
+    std::map<uint32_t, uint32_t>                         intConstants;  // id to value
+    std::map<uint32_t, uint32_t>                         blockPointers; // pointer type to the struct it points to
+    std::map<uint32_t, uint32_t>                         blocks;        // variable to its struct
+    std::map<uint32_t, float>                            members;       // access chain to the value of its member
+    std::vector<Fold>                                    folds;
+    std::set<uint32_t>                                   foldedIds;
+    size_t                                               functions = 0; // constants go before the first function
+
+    for(size_t offset = SPIRV_HEADER; offset < module.size();)
+    {
+        const auto opcode = module[offset] & 0xffff;
+        const auto count  = module[offset] >> 16;
+        if(count == 0 || offset + count > module.size())
+            throw std::runtime_error("Malformed SPIR-V module");
+
+        const auto operands = &module[offset + 1];
+        switch(opcode)
+        {
+        case OP_MEMBER_NAME:
+            if(count >= 4)
+                memberNames[std::make_pair(operands[0], operands[1])] = literalString(operands + 2, count - 3);
+            break;
+        case OP_TYPE_INT:
+            if(count == 4 && operands[1] == 32)
+                intTypes.insert(operands[0]);
+            break;
+        case OP_TYPE_FLOAT:
+            if(count >= 3 && operands[1] == 32)
+                floatTypes.insert(operands[0]);
+            break;
+        case OP_TYPE_POINTER:
+            if(count == 4 && (operands[1] == STORAGE_UNIFORM || operands[1] == STORAGE_PUSH_CONSTANT))
+                blockPointers[operands[0]] = operands[2];
+            break;
+        case OP_CONSTANT:
+            if(count == 4 && intTypes.contains(operands[0]))
+                intConstants[operands[1]] = operands[2];
+            break;
+        case OP_VARIABLE:
+            if(count >= 4)
+            {
+                const auto pointer = blockPointers.find(operands[0]);
+                if(pointer != blockPointers.end())
+                    blocks[operands[1]] = pointer->second;
+            }
+            break;
+        case OP_FUNCTION:
+            if(functions == 0)
+                functions = offset;
+            break;
+        case OP_ACCESS_CHAIN:
+        case OP_IN_BOUNDS_ACCESS_CHAIN:
+            // parameters are read as a member of the block by a constant index
+            if(count == 5)
+            {
+                const auto block = blocks.find(operands[2]);
+                const auto index = intConstants.find(operands[3]);
+                if(block == blocks.end() || index == intConstants.end())
+                    break;
+                const auto name = memberNames.find(std::make_pair(block->second, index->second));
+                if(name == memberNames.end())
+                    break;
+                const auto value = constants.find(name->second);
+                if(value != constants.end())
+                    members[operands[1]] = value->second;
+            }
+            break;
+        case OP_LOAD:
+            if(count >= 4 && floatTypes.contains(operands[0]))
+            {
+                const auto member = members.find(operands[2]);
+                if(member != members.end())
+                {
+                    folds.push_back({offset, operands[0], operands[1], member->second});
+                    foldedIds.insert(operands[1]);
+                }
+            }
+            break;
+        }
+        offset += count;
+    }
+
+    if(folds.empty())
+        return 0;
+
+    // loads are dropped and their ids defined as constants instead, which dominate every use;
+    // access chains left unused are for spirv-opt to remove
+    std::vector<uint32_t> output(module.begin(), module.begin() + SPIRV_HEADER);
+    output.reserve(module.size() + folds.size());
+    auto fold = folds.begin();
+    for(size_t offset = SPIRV_HEADER; offset < module.size();)
+    {
+        const auto opcode = module[offset] & 0xffff;
+        const auto count  = module[offset] >> 16;
+        if(offset == functions)
+        {
+            for(const auto& f : folds)
+            {
+                uint32_t bits;
+                memcpy(&bits, &f.value, sizeof(bits));
+                output.insert(output.end(), {(4u << 16) | OP_CONSTANT, f.type, f.id, bits});
+            }
+        }
+
+        const auto skip = (fold != folds.end() && fold->offset == offset) || (opcode == OP_DECORATE && foldedIds.contains(module[offset + 1]));
+        if(fold != folds.end() && fold->offset == offset)
+            fold++;
+        if(!skip)
+            output.insert(output.end(), module.begin() + offset, module.begin() + offset + count);
+        offset += count;
+    }
+
+    module.swap(output);
+    return static_cast<int>(folds.size());
+}
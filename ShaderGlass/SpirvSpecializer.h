@@ -0,0 +1,11 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+// folds float members of uniform and push constant blocks into a SPIR-V module as constants: each load of a member
+// named in constants becomes an OpConstant defining the same id, so spirv-opt can then fold the expressions and
+// remove the branches depending on it; the block layout is left as it is, so reflection of the original still applies
+// returns the number of loads folded, throws std::runtime_error if the module can't be parsed
+int SpecializeSpirv(std::vector<uint32_t>& module, const std::map<std::string, float>& constants);
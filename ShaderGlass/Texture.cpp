@@ -5,11 +5,10 @@
 #pragma comment(lib, "dxguid.lib")
 
 #include "Texture.h"
-#include "WIC\WICTextureLoader11.h"
 
 Texture::Texture(TextureDef& textureDef) : m_linear(false), m_mipmap(false), m_repeat(false), m_clamp(false), m_mirror(false), m_textureDef(textureDef)
 {
-    m_name = textureDef.PresetParams["name"];
+    Get("name", m_name);
     std::string value;
     if(Get("linear", value) && value == "true")
         m_linear = true;
@@ -26,20 +25,9 @@ Texture::Texture(TextureDef& textureDef) : m_linear(false), m_mipmap(false), m_r
     }
 }
 
-void Texture::Create(winrt::com_ptr<ID3D11Device> d3dDevice)
+void Texture::Create(RenderBackend& backend)
 {
-    auto hr = DirectX::CreateWICTextureFromMemoryEx(d3dDevice.get(),
-                                                    nullptr,
-                                                    m_textureDef.Data,
-                                                    m_textureDef.DataLength,
-                                                    0,
-                                                    D3D11_USAGE_DEFAULT,
-                                                    D3D11_BIND_SHADER_RESOURCE,
-                                                    0,
-                                                    0,
-                                                    DirectX::WIC_LOADER_IGNORE_SRGB | DirectX::WIC_LOADER_FORCE_RGBA32,
-                                                    m_textureResource.put(),
-                                                    m_textureView.put());
+    m_texture = backend.LoadTexture(m_textureDef);
 }
 
 bool Texture::Get(const std::string& presetParam, std::string& value)
@@ -55,6 +43,5 @@ bool Texture::Get(const std::string& presetParam, std::string& value)
 
 Texture::~Texture()
 {
-    m_textureView     = nullptr;
-    m_textureResource = nullptr;
+    m_texture = nullptr;
 }
@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include "TextureDef.h"
+#include "RenderBackend.h"
 
 #pragma once
 
@@ -14,11 +15,10 @@ public:
     bool                      m_clamp;
     bool                      m_repeat;
     bool                      m_mirror;
-    winrt::com_ptr<ID3D11Resource> m_textureResource;
-    winrt::com_ptr<ID3D11ShaderResourceView> m_textureView;
+    std::shared_ptr<RenderTexture> m_texture;
 
     Texture(TextureDef& textureDef);
-    void Create(winrt::com_ptr<ID3D11Device> d3dDevice);
+    void Create(RenderBackend& backend);
     ~Texture();
 
 private:
@@ -0,0 +1,147 @@
+#include "pch.h"
+
+#include "TextureCache.h"
+#include "WIC\WICTextureLoader11.h"
+
+std::mutex                                                                    TextureCache::s_mutex {};
+std::map<std::pair<ID3D11Device*, const BYTE*>, std::weak_ptr<DecodedTexture>> TextureCache::s_textures {};
+int                                                                           TextureCache::s_hits {0};
+int                                                                           TextureCache::s_decodes {0};
+
+std::shared_ptr<DecodedTexture> TextureCache::Get(winrt::com_ptr<ID3D11Device> d3dDevice, const TextureDef& textureDef)
+{
+    // TextureDefs of different presets point to the same embedded data
+    const auto key = std::make_pair(d3dDevice.get(), textureDef.Data);
+
+    std::unique_lock lock(s_mutex);
+    auto             it = s_textures.find(key);
+    if(it != s_textures.end())
+    {
+        auto texture = it->second.lock();
+        if(texture)
+        {
+            s_hits++;
+            return texture;
+        }
+    }
+
+    auto texture = Decode(d3dDevice, textureDef);
+    if(texture)
+    {
+        s_textures[key] = texture;
+        s_decodes++;
+    }
+
+    // forget textures no longer used by any preset
+    for(auto et = s_textures.begin(); et != s_textures.end();)
+    {
+        if(et->second.expired())
+            et = s_textures.erase(et);
+        else
+            et++;
+    }
+    return texture;
+}
+
+std::shared_ptr<DecodedTexture> TextureCache::Decode(winrt::com_ptr<ID3D11Device> d3dDevice, const TextureDef& textureDef)
+{
+    if(textureDef.IsRaw())
+        return CreateRaw(d3dDevice, textureDef);
+
+    auto texture = std::make_shared<DecodedTexture>();
+    auto hr      = DirectX::CreateWICTextureFromMemoryEx(d3dDevice.get(),
+                                                    nullptr,
+                                                    textureDef.Data,
+                                                    textureDef.DataLength,
+                                                    0,
+                                                    D3D11_USAGE_DEFAULT,
+                                                    D3D11_BIND_SHADER_RESOURCE,
+                                                    0,
+                                                    0,
+                                                    DirectX::WIC_LOADER_IGNORE_SRGB | DirectX::WIC_LOADER_FORCE_RGBA32,
+                                                    texture->resource.put(),
+                                                    texture->view.put());
+    if(FAILED(hr))
+        return nullptr;
+
+    return texture;
+}
+
+bool TextureCache::GetPitch(DXGI_FORMAT format, UINT width, UINT height, UINT& rowPitch, UINT& rows)
+{
+    switch(format)
+    {
+    case DXGI_FORMAT_R8G8B8A8_UNORM:
+        rowPitch = width * 4;
+        rows     = height;
+        return true;
+    case DXGI_FORMAT_BC1_UNORM:
+    case DXGI_FORMAT_BC3_UNORM:
+        // rows of 4x4 blocks, 8 or 16 bytes each
+        rowPitch = max(1U, (width + 3) / 4) * (format == DXGI_FORMAT_BC1_UNORM ? 8 : 16);
+        rows     = max(1U, (height + 3) / 4);
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::shared_ptr<DecodedTexture> TextureCache::CreateRaw(winrt::com_ptr<ID3D11Device> d3dDevice, const TextureDef& textureDef)
+{
+    const auto header = reinterpret_cast<const RawTextureHeader*>(textureDef.Data);
+
+    D3D11_TEXTURE2D_DESC desc = {};
+    desc.Width                = header->width;
+    desc.Height               = header->height;
+    desc.MipLevels            = header->mipLevels;
+    desc.ArraySize            = 1;
+    desc.Format               = static_cast<DXGI_FORMAT>(header->format);
+    desc.SampleDesc.Count     = 1;
+    desc.SampleDesc.Quality   = 0;
+    desc.Usage                = D3D11_USAGE_IMMUTABLE;
+    desc.BindFlags            = D3D11_BIND_SHADER_RESOURCE;
+
+    // mip levels follow the header as-is, no decoding needed
+    std::vector<D3D11_SUBRESOURCE_DATA> levels(header->mipLevels);
+    const BYTE*                         data = textureDef.Data + sizeof(RawTextureHeader);
+    const BYTE*                         end  = textureDef.Data + textureDef.DataLength;
+    for(UINT level = 0; level < header->mipLevels; level++)
+    {
+        const UINT width  = max(1U, header->width >> level);
+        const UINT height = max(1U, header->height >> level);
+        UINT       rowPitch, rows;
+        if(!GetPitch(desc.Format, width, height, rowPitch, rows))
+            return nullptr;
+
+        if(data + static_cast<size_t>(rowPitch) * rows > end)
+            return nullptr;
+
+        levels[level].pSysMem          = data;
+        levels[level].SysMemPitch      = rowPitch;
+        levels[level].SysMemSlicePitch = 0;
+        data += static_cast<size_t>(rowPitch) * rows;
+    }
+
+    auto                            texture = std::make_shared<DecodedTexture>();
+    winrt::com_ptr<ID3D11Texture2D> texture2D;
+    auto                            hr = d3dDevice->CreateTexture2D(&desc, levels.data(), texture2D.put());
+    if(FAILED(hr))
+        return nullptr;
+
+    hr = d3dDevice->CreateShaderResourceView(texture2D.get(), nullptr, texture->view.put());
+    if(FAILED(hr))
+        return nullptr;
+
+    texture->resource = texture2D.as<ID3D11Resource>();
+    return texture;
+}
+
+int TextureCache::Hits()
+{
+    return s_hits;
+}
+
+int TextureCache::Decodes()
+{
+    return s_decodes;
+}
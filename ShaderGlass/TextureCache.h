@@ -0,0 +1,29 @@
+#pragma once
+
+#include "TextureDef.h"
+#include <mutex>
+
+struct DecodedTexture
+{
+    winrt::com_ptr<ID3D11Resource>           resource;
+    winrt::com_ptr<ID3D11ShaderResourceView> view;
+};
+
+// process-wide cache of decoded preset textures, shared by all presets using the same TextureDef
+class TextureCache
+{
+public:
+    static std::shared_ptr<DecodedTexture> Get(winrt::com_ptr<ID3D11Device> d3dDevice, const TextureDef& textureDef);
+    static int                             Hits();
+    static int                             Decodes();
+
+private:
+    static std::shared_ptr<DecodedTexture> Decode(winrt::com_ptr<ID3D11Device> d3dDevice, const TextureDef& textureDef);
+    static std::shared_ptr<DecodedTexture> CreateRaw(winrt::com_ptr<ID3D11Device> d3dDevice, const TextureDef& textureDef);
+    static bool                            GetPitch(DXGI_FORMAT format, UINT width, UINT height, UINT& rowPitch, UINT& rows);
+
+    static std::mutex                                                                    s_mutex;
+    static std::map<std::pair<ID3D11Device*, const BYTE*>, std::weak_ptr<DecodedTexture>> s_textures;
+    static int                                                                           s_hits;
+    static int                                                                           s_decodes;
+};
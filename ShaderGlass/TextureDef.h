@@ -1,5 +1,17 @@
 #pragma once
 
+// layout of textures pre-decoded by ShaderGen, followed by tightly packed mip levels
+// (RGBA8 or BC1/BC3 blocks)
+struct RawTextureHeader
+{
+    char     magic[4]; // SGTX
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t mipLevels;
+    uint32_t format; // DXGI_FORMAT
+};
+
 class TextureDef
 {
 public:
@@ -10,6 +22,11 @@ public:
     int                                DataLength;
     std::map<std::string, std::string> PresetParams;
 
+    bool IsRaw() const
+    {
+        return Data && DataLength >= static_cast<int>(sizeof(RawTextureHeader)) && memcmp(Data, "SGTX", 4) == 0;
+    }
+
     TextureDef& Param(const std::string& presetKey, const std::string& presetValue)
     {
         PresetParams.insert(std::make_pair(presetKey, presetValue));
@@ -0,0 +1,69 @@
+#include "pch.h"
+
+#include "TextureMemory.h"
+
+size_t TextureMemory::Total() const
+{
+    size_t total = 0;
+    for(auto bytes : m_bytes)
+        total += bytes;
+    return total;
+}
+
+std::string TextureMemory::Describe() const
+{
+    std::string description;
+    char        entry[64];
+    for(size_t c = 0; c < m_bytes.size(); c++)
+    {
+        snprintf(entry, 64, "%s %.1f MB, ", Name(static_cast<TextureCategory>(c)), m_bytes[c] / (1024.0f * 1024.0f));
+        description += entry;
+    }
+    snprintf(entry, 64, "total %.1f MB", Total() / (1024.0f * 1024.0f));
+    return description + entry;
+}
+
+const char* TextureMemory::Name(TextureCategory category)
+{
+    switch(category)
+    {
+    case TextureCategory::PassOutput:
+        return "pass";
+    case TextureCategory::Feedback:
+        return "feedback";
+    case TextureCategory::History:
+        return "history";
+    case TextureCategory::Original:
+        return "original";
+    case TextureCategory::Preset:
+        return "preset";
+    case TextureCategory::Swapchain:
+        return "swapchain";
+    default:
+        return "";
+    }
+}
+
+size_t TextureMemory::Bytes(uint32_t width, uint32_t height, TextureFormat format)
+{
+    // 4x4 blocks of 8 or 16 bytes
+    if(format == TextureFormat::BC1 || format == TextureFormat::BC3)
+        return static_cast<size_t>(max(1U, (width + 3) / 4)) * max(1U, (height + 3) / 4) * (format == TextureFormat::BC1 ? 8 : 16);
+
+    const size_t texelSize = format == TextureFormat::RGBA16F ? 8 : 4;
+    return static_cast<size_t>(width) * height * texelSize;
+}
+
+size_t TextureMemory::Bytes(const RenderTexture& texture)
+{
+    size_t   bytes  = 0;
+    uint32_t width  = texture.width;
+    uint32_t height = texture.height;
+    for(uint32_t m = 0; m < max(texture.mipLevels, 1U); m++)
+    {
+        bytes += Bytes(width, height, texture.format);
+        width  = max(width / 2, 1U);
+        height = max(height / 2, 1U);
+    }
+    return bytes;
+}
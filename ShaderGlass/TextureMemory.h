@@ -0,0 +1,36 @@
+#pragma once
+
+#include "RenderBackend.h"
+#include <array>
+#include <string>
+
+enum class TextureCategory
+{
+    PassOutput,
+    Feedback,
+    History,
+    Original,
+    Preset,
+    Swapchain,
+    Count
+};
+
+// GPU memory held by a chain's textures, by category
+class TextureMemory
+{
+public:
+    void   Reset() { m_bytes.fill(0); }
+    void   Add(TextureCategory category, size_t bytes) { m_bytes[static_cast<size_t>(category)] += bytes; }
+    void   Add(TextureCategory category, const RenderTexture& texture) { Add(category, Bytes(texture)); }
+    size_t Bytes(TextureCategory category) const { return m_bytes[static_cast<size_t>(category)]; }
+    size_t Total() const;
+
+    std::string Describe() const; // e.g. "pass 31.6 MB, feedback 0.0 MB, ..., total 47.5 MB"
+
+    static const char* Name(TextureCategory category);
+    static size_t      Bytes(uint32_t width, uint32_t height, TextureFormat format);
+    static size_t      Bytes(const RenderTexture& texture); // incl. mip chain
+
+private:
+    std::array<size_t, static_cast<size_t>(TextureCategory::Count)> m_bytes {};
+};
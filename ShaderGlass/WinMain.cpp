@@ -4,6 +4,10 @@
 #include "ShaderWindow.h"
 #include "ParamsWindow.h"
 #include "BrowserWindow.h"
+#include "BatchProcessor.h"
+#include "Benchmark.h"
+#include "Regression.h"
+#include "SelfTest.h"
 
 #pragma comment(                                                                                                                           \
     linker,                                                                                                                                \
@@ -14,6 +18,28 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
     UNREFERENCED_PARAMETER(hPrevInstance);
     UNREFERENCED_PARAMETER(lpCmdLine);
 
+    // headless batch, benchmark, regression and self-test modes need neither windows nor capture
+    {
+        int               numArgs;
+        auto              args = CommandLineToArgvW(GetCommandLineW(), &numArgs);
+        BatchOptions      batchOptions;
+        BenchmarkOptions  benchmarkOptions;
+        RegressionOptions regressionOptions;
+        const auto        batch     = args && BatchProcessor::ParseArgs(numArgs, args, batchOptions);
+        const auto        benchmark = args && Benchmark::ParseArgs(numArgs, args, benchmarkOptions);
+        const auto        regress   = args && Regression::ParseArgs(numArgs, args, regressionOptions);
+        const auto        selftest  = args && SelfTest::ParseArgs(numArgs, args);
+        LocalFree(args);
+        if(batch)
+            return BatchProcessor(batchOptions).Run();
+        if(benchmark)
+            return Benchmark(benchmarkOptions).Run();
+        if(regress)
+            return Regression(regressionOptions).Run();
+        if(selftest)
+            return SelfTest().Run();
+    }
+
     if(!winrt::Windows::Foundation::Metadata::ApiInformation::IsApiContractPresent(L"Windows.Foundation.UniversalApiContract", 8))
     {
         MessageBox(NULL, L"ShaderGlass requires Windows 10 version 1903 or later.", L"ShaderGlass", MB_OK | MB_ICONERROR);
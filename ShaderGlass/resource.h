@@ -18,6 +18,9 @@
 #define IDM_UPDATE_PARAMS               112
 #define IDM_PIXELSIZE_DPI               113
 #define IDM_OUTPUT_FREESCALE            114
+#define IDM_UPDATE_PRESETS              115
+#define IDM_PRESET_CHANGED              116
+#define IDM_PRESET_SPECIALIZED          117
 #define IDR_MAINFRAME                   128
 #define IDD_INPUT_DIALOG                129
 #define IDB_SHADER                      135
@@ -149,6 +152,12 @@
 #define ID_RECENTPROFILES_FDS           32901
 #define ID_PROCESSING_RECENT            32902
 #define ID_HELP_README                  32903
+#define ID_PROCESSING_PROFILEPASSES     32904
+#define ID_PROCESSING_EXPORTTRACE       32905
+#define ID_BROWSER_SHOWCOST             32906
+#define ID_BROWSER_SORTBYCOST           32907
+#define ID_SHADER_LOADPRESET            32908
+#define ID_SHADER_SPECIALIZE            32909
 #define IDC_STATIC                      -1
 #define IDC_STATIC_LABEL                -1
 
@@ -158,8 +167,8 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NO_MFC                     1
 #define _APS_NEXT_RESOURCE_VALUE        137
-#define _APS_NEXT_COMMAND_VALUE         32904
+#define _APS_NEXT_COMMAND_VALUE         32910
 #define _APS_NEXT_CONTROL_VALUE         1001
-#define _APS_NEXT_SYMED_VALUE           115
+#define _APS_NEXT_SYMED_VALUE           118
 #endif
 #endif